@@ -94,6 +94,7 @@
 #include "canvas/Persistency/Common/FindOneP.h"
 #include "fhiclcpp/ParameterSet.h"
 #include "messagefacility/MessageLogger/MessageLogger.h"
+#include "cetlib/cpu_timer.h"
 
 #include "larcore/Geometry/Geometry.h"
 #include "nusimdata/SimulationBase/MCTruth.h"
@@ -121,6 +122,7 @@
 #include "lardataobj/AnalysisBase/FlashMatch.h"
 
 #include "icaruscode/RecoUtils/RecoUtils.h"
+#include "icaruscode/Utilities/ColumnarTreeExport.h"
 
 #include <cstring> // std::memcpy()
 #include <vector>
@@ -663,6 +665,16 @@ namespace icarus {
    * - <b>UseBuffers</b> (default: false): if enabled, memory is allocated for
    *   tree data for all the run; otherwise, it's allocated on each event, used
    *   and freed; use "true" for speed, "false" to save memory
+   * - <b>ColumnarBuffering</b> (default: false): if enabled, every branch
+   *   accumulates its column in a large in-memory buffer and all the columns
+   *   are compressed and flushed to the file together, instead of each of the
+   *   hundreds of branches spilling its own small basket independently
+   * - <b>FlushBufferMB</b> (default: 64): with ColumnarBuffering enabled,
+   *   total size of the in-memory columns that triggers a flush
+   * - <b>BasketSizeKB</b> (default: 512): with ColumnarBuffering enabled,
+   *   size of the in-memory buffer of each branch
+   * - <b>CompressionLevel</b> (default: -1): with ColumnarBuffering enabled,
+   *   if non-negative, compression level applied to every branch
    * - <b>SaveAuxDetInfo</b> (default: false): if enabled, auxiliary detector
    *   data will be extracted and included in the tree
    */
@@ -676,6 +688,7 @@ namespace icarus {
     /// read access to event
     void analyze(const art::Event& evt);
   //  void beginJob() {}
+    void endJob();
     void beginSubRun(const art::SubRun& sr);
 
   private:
@@ -706,7 +719,13 @@ namespace icarus {
     std::vector<std::string> fCalorimetryModuleLabel;
     std::vector<std::string> fParticleIDModuleLabel;
     std::string fPOTModuleLabel;
-    bool fUseBuffer; ///< whether to use a permanent buffer (faster, huge memory)    
+    bool fUseBuffer; ///< whether to use a permanent buffer (faster, huge memory)
+    bool fColumnarBuffering; ///< whether to buffer full columns and flush them in large blocks
+    size_t fFlushBufferMB; ///< total in-memory column size (MiB) triggering a flush
+    size_t fBasketSizeKB; ///< per-branch column buffer size (KiB)
+    int fCompressionLevel; ///< if non-negative, compression level applied to every branch
+    bool fColumnarTuned; ///< whether the branch buffers have been resized already
+    std::string fColumnarExportDir; ///< if non-empty, export the tree as NumPy columns there at end of job
     bool fSaveAuxDetInfo; ///< whether to extract and save auxiliary detector data
     bool fSaveCryInfo; ///whether to extract and save CRY particle data
     bool fSaveGenieInfo; ///whether to extract and save Genie information
@@ -720,6 +739,10 @@ namespace icarus {
 
     bool isCosmics;      ///< if it contains cosmics
     bool fSaveCaloCosmics; ///< save calorimetry information for cosmics
+
+    /// Wall time accumulated computing each branch group, reported at end of
+    /// job; groups whose fSave* flag is off are skipped and cost nothing
+    std::map<std::string, double> fGroupTimeMap;
     float fG4minE;         ///< Energy threshold to save g4 particle info
     /// Returns the number of trackers configured
     size_t GetNTrackers() const { return fTrackModuleLabel.size(); }
@@ -1673,6 +1696,12 @@ icarus::AnalysisTree::AnalysisTree(fhicl::ParameterSet const& pset) :
   fParticleIDModuleLabel    (pset.get< std::vector<std::string> >("ParticleIDModuleLabel")   ),
   fPOTModuleLabel           (pset.get< std::string >("POTModuleLabel")          ),
   fUseBuffer                (pset.get< bool >("UseBuffers", false)),
+  fColumnarBuffering        (pset.get< bool >("ColumnarBuffering", false)),
+  fFlushBufferMB            (pset.get< size_t >("FlushBufferMB", 64)),
+  fBasketSizeKB             (pset.get< size_t >("BasketSizeKB", 512)),
+  fCompressionLevel         (pset.get< int >("CompressionLevel", -1)),
+  fColumnarTuned            (false),
+  fColumnarExportDir        (pset.get< std::string >("ColumnarExportDir", "")),
   fSaveAuxDetInfo           (pset.get< bool >("SaveAuxDetInfo", false)),
   fSaveCryInfo              (pset.get< bool >("SaveCryInfo", false)),  
   fSaveGenieInfo	    (pset.get< bool >("SaveGenieInfo", false)), 
@@ -1689,6 +1718,7 @@ icarus::AnalysisTree::AnalysisTree(fhicl::ParameterSet const& pset) :
   if (fSaveAuxDetInfo == true) fSaveGeantInfo = true;
   mf::LogInfo("AnalysisTree") << "Configuration:"
     << "\n  UseBuffers: " << std::boolalpha << fUseBuffer
+    << "\n  ColumnarBuffering: " << std::boolalpha << fColumnarBuffering
     ;
   if (GetNTrackers() > kMaxTrackers) {
     throw art::Exception(art::errors::Configuration)
@@ -1718,9 +1748,26 @@ void icarus::AnalysisTree::CreateTree(bool bClearData /* = false */) {
   if (!fTree) {
     art::ServiceHandle<art::TFileService> tfs;
     fTree = tfs->make<TTree>("anatree","analysis tree");
+    if (fColumnarBuffering) {
+      // accumulate the entries in memory and write all the columns out
+      // together once they reach the configured size, rather than letting
+      // each branch spill its own small basket independently
+      fTree->SetAutoFlush(-static_cast<Long64_t>(fFlushBufferMB * 1048576));
+    }
   }
   CreateData(bClearData);
   SetAddresses();
+  if (fColumnarBuffering && !fColumnarTuned) {
+    // the branches exist only after the first SetAddresses() call; give each
+    // one a buffer large enough to hold its column between flushes
+    fTree->SetBasketSize("*", fBasketSizeKB * 1024);
+    if (fCompressionLevel >= 0) {
+      TIter branchIter(fTree->GetListOfBranches());
+      while (TObject* pBranchObj = branchIter())
+        static_cast<TBranch*>(pBranchObj)->SetCompressionLevel(fCompressionLevel);
+    }
+    fColumnarTuned = true;
+  }
 } // icarus::AnalysisTree::CreateTree()
 
 
@@ -1802,7 +1849,12 @@ void icarus::AnalysisTree::analyze(const art::Event& evt)
         //by looking for the highest energy deposition
         //std::map<art::Ptr<simb::MCTruth>,double> mctruthemap;
       static bool isfirsttime = true;
-      if (isfirsttime){
+      // the cosmic origin scan backtracks every hit in the event; its only
+      // consumer is the track calorimetry saving decision, so skip it (and its
+      // cost) entirely when track information is not saved
+      if (isfirsttime && fSaveTrackInfo){
+        cet::cpu_timer theClockCosmicScan;
+        theClockCosmicScan.start();
 	for (size_t i = 0; i<hitlist.size(); i++){
 	  //if (hitlist[i]->View() == geo::kV){//collection view
           std::vector<sim::TrackIDE> eveIDs = backTracker->HitToEveTrackIDEs(clockData, hitlist[i]);
@@ -1815,6 +1867,8 @@ void icarus::AnalysisTree::analyze(const art::Event& evt)
 	}
 	isfirsttime = false;
 	if (fSaveCaloCosmics) isCosmics = false; //override to save calo info
+        theClockCosmicScan.stop();
+        fGroupTimeMap["track cosmic scan"] += theClockCosmicScan.accumulated_real_time();
       }
 
 //        double maxenergy = -1;
@@ -1916,6 +1970,9 @@ void icarus::AnalysisTree::analyze(const art::Event& evt)
 
   //hit information
   if (fSaveHitInfo){
+    cet::cpu_timer theClockHits;
+    theClockHits.start();
+
     fData->no_hits = (int) NHits;
     if (NHits > kMaxHits) {
       // got this error? consider increasing kMaxHits
@@ -1977,10 +2034,16 @@ void icarus::AnalysisTree::analyze(const art::Event& evt)
         }
       }
     }
-  }// end (fSaveHitInfo) 
+
+    theClockHits.stop();
+    fGroupTimeMap["hits"] += theClockHits.accumulated_real_time();
+  }// end (fSaveHitInfo)
 
   //vertex information
   if (fSaveVertexInfo){
+    cet::cpu_timer theClockVertex;
+    theClockVertex.start();
+
     fData->nvtx = NVertices;
     if (NVertices > kMaxVertices){
       // got this error? consider increasing kMaxVerticestra
@@ -1993,10 +2056,16 @@ void icarus::AnalysisTree::analyze(const art::Event& evt)
       vtxlist[i]->XYZ(xyz);
       for (size_t j = 0; j<3; ++j) fData->vtx[i][j] = xyz[j];
     }
+
+    theClockVertex.stop();
+    fGroupTimeMap["vertices"] += theClockVertex.accumulated_real_time();
   }// end (fSaveVertexInfo)
     
   //track information for multiple trackers
   if (fSaveTrackInfo){
+    cet::cpu_timer theClockTracks;
+    theClockTracks.start();
+
     for (unsigned int iTracker=0; iTracker < NTrackers; ++iTracker){
       AnalysisTreeDataStruct::TrackDataStruct& TrackerData = fData->GetTrackerData(iTracker);
     
@@ -2334,15 +2403,21 @@ void icarus::AnalysisTree::analyze(const art::Event& evt)
       }//end if (isMC)
     }//end loop over track
   }//end loop over track module labels
- }// end (fSaveTrackInfo) 
+
+    theClockTracks.stop();
+    fGroupTimeMap["tracks"] += theClockTracks.accumulated_real_time();
+ }// end (fSaveTrackInfo)
   
   /*trkf::TrackMomentumCalculator trkm;  
   std::cout<<"\t"<<trkm.GetTrackMomentum(200,2212)<<"\t"<<trkm.GetTrackMomentum(-10, 13)<<"\t"<<trkm.GetTrackMomentum(300,-19)<<"\n";
 */
   //mc truth information
   if (isMC){
-    if (fSaveCryInfo){ 
-      //store cry (cosmic generator information) 
+    if (fSaveCryInfo){
+      cet::cpu_timer theClockCry;
+      theClockCry.start();
+
+      //store cry (cosmic generator information)
       fData->mcevts_truthcry = mclistcry.size();
       fData->cry_no_primaries = nCryPrimaries;
       //fData->cry_no_primaries;
@@ -2362,8 +2437,11 @@ void icarus::AnalysisTree::analyze(const art::Event& evt)
         fData->cry_trackID[iPartc]=partc.TrackId();
         fData->cry_ND[iPartc]=partc.NumberDaughters();
         fData->cry_mother[iPartc]=partc.Mother();
-      } // for cry particles  
-    }// end fSaveCryInfo   
+      } // for cry particles
+
+      theClockCry.stop();
+      fGroupTimeMap["cry"] += theClockCry.accumulated_real_time();
+    }// end fSaveCryInfo
 
     fData->mcevts_truth = mclist.size();
     //Brailsford 2017/10/16
@@ -2373,6 +2451,8 @@ void icarus::AnalysisTree::analyze(const art::Event& evt)
 
     if (fData->mcevts_truth > 0){//at least one mc record
     if (fSaveGenieInfo){
+      cet::cpu_timer theClockGenie;
+      theClockGenie.start();
 
       //Brailsford 2017/10/16 
       //Issue 17917
@@ -2483,10 +2563,16 @@ void icarus::AnalysisTree::analyze(const art::Event& evt)
           fData->genie_mother[iPart]=part.Mother();
         } // for particle
       } //if neutrino set
-    }// end (fSaveGenieInfo)  
+
+      theClockGenie.stop();
+      fGroupTimeMap["genie"] += theClockGenie.accumulated_real_time();
+    }// end (fSaveGenieInfo)
 
       //GEANT particles information
-      if (fSaveGeantInfo){ 
+      if (fSaveGeantInfo){
+        cet::cpu_timer theClockGeant;
+        theClockGeant.start();
+
         const sim::ParticleList& plist = partInventory->ParticleList();
         
         std::string pri("primary");
@@ -2676,7 +2762,10 @@ void icarus::AnalysisTree::analyze(const art::Event& evt)
         } // while ancestry exists
         ++currentMergedId;
       } // for merging check
-     } // if (fSaveGeantInfo) 
+
+      theClockGeant.stop();
+      fGroupTimeMap["geant"] += theClockGeant.accumulated_real_time();
+     } // if (fSaveGeantInfo)
       
     }//if (mcevts_truth)
   }//if (isMC){
@@ -2725,6 +2814,23 @@ void icarus::AnalysisTree::analyze(const art::Event& evt)
   }
 } // icarus::AnalysisTree::analyze()
 
+void icarus::AnalysisTree::endJob()
+{
+  // report how much time went into each enabled branch group, so slimmed
+  // configurations can tell which groups are worth turning off
+  mf::LogInfo logStream("AnalysisTree");
+  logStream << "Time spent computing each branch group (disabled groups are skipped):";
+  for (auto const& groupTime: fGroupTimeMap)
+    logStream << "\n  " << groupTime.first << ": " << groupTime.second << " s";
+  if (fGroupTimeMap.empty()) logStream << "\n  (no groups enabled)";
+
+  // optional columnar export for the Python-based calibration workflows
+  if (!fColumnarExportDir.empty() && fTree) {
+    icarus::ns::util::ColumnarTreeExport exporter { fColumnarExportDir };
+    exporter.exportTree(*fTree, "anatree");
+  } // if columnar export
+} // icarus::AnalysisTree::endJob()
+
 void icarus::AnalysisTree::HitsPurity(detinfo::DetectorClocksData const& clockData, std::vector< art::Ptr<recob::Hit> > const& hits, Int_t& trackid, Float_t& purity, double& maxe){
 
   trackid = -1;
@@ -90,6 +90,7 @@ namespace icarus {
     int Nothere(std::vector<int>* a, int b);
     int Notheref(std::vector<float>* a, float b);
     Double_t FoundMeanLog(std::vector<float>* a,float b);
+    void FitAccumulated(int run, int subrun, int ev);
 
   private:
 
@@ -143,8 +144,23 @@ namespace icarus {
     int fgruppifcl;
 int fdwclusfcl;
 int fdsclusfcl;
+    int faccumeventsfcl;
+    int faccummaxsamplesfcl;
     bool fPersistPurityInfo;
-    
+
+    //per-tpc sufficient statistics of the good samples accumulated across
+    //the events: counts and moments of (drift time, log(area))
+    //the incremental fit is re-solved in closed form from these sums so the
+    //cost of a refit does not grow with the accumulated statistics
+    double accum_n[4];
+    double accum_st[4];
+    double accum_stt[4];
+    double accum_sy[4];
+    double accum_sty[4];
+    int accum_samples;
+    int accum_events;
+    TH1F* purityaccum;
+
     TNtuple* purityTuple;
     bool fFillAnaTuple;
 
@@ -187,10 +203,19 @@ namespace icarus{
     , fgruppifcl            (pset.get< int >         ("GruppiFCL",8))
     , fdwclusfcl            (pset.get< int >         ("DeltaWClusFCL",3))
     , fdsclusfcl            (pset.get< int >         ("DeltaSClusFCL",100))
+    , faccumeventsfcl       (pset.get< int >         ("AccumEventsFCL",0))
+    , faccummaxsamplesfcl   (pset.get< int >         ("AccumMaxSamplesFCL",200000))
     , fPersistPurityInfo    (pset.get< bool  >       ("PersistPurityInfo",false))
     , fFillAnaTuple         (pset.get< bool  >       ("FillAnaTuple",false))
   {
 
+    accum_events=0;
+    accum_samples=0;
+    for(int ijk=0;ijk<4;ijk++)
+      {
+	accum_n[ijk]=0;accum_st[ijk]=0;accum_stt[ijk]=0;accum_sy[ijk]=0;accum_sty[ijk]=0;
+      }
+
     //declare what we produce .. allow it to not be persistable to the event
     if(fPersistPurityInfo)
       produces< std::vector<anab::TPCPurityInfo> >("",art::Persistable::Yes);
@@ -235,6 +260,7 @@ namespace icarus{
    h_hittime_3 = tfs->make<TH1F>("h_hittime_3","",2500,-0.5,2499.5);
 
     purityvalues2 = tfs->make<TH1F>("purityvalues2","purityvalues2",20000,-10,10);
+    purityaccum = tfs->make<TH1F>("purityaccum","purityaccum",20000,-10,10);
     puritytpc0 = tfs->make<TH1F>("puritytpc0","puritytpc0",20000,-10,10);
     puritytpc1 = tfs->make<TH1F>("puritytpc1","puritytpc1",20000,-10,10);
     puritytpc2 = tfs->make<TH1F>("puritytpc2","puritytpc2",20000,-10,10);
@@ -273,6 +299,8 @@ namespace icarus{
   
   void ICARUSPurityDQM::endJob()
   {
+    //solve whatever statistics are left in the accumulators
+    if(faccumeventsfcl>0 && accum_samples>0)FitAccumulated(-1,-1,-1);
     std::ofstream goodpurofinal("valore_indicativo.out",std::ios::app);
     goodpurofinal << purityvalues2->GetMean() << std::endl;
     //if(fPrintLevel == -1) outFile.close();
@@ -348,6 +376,36 @@ std::sort(usedhere->begin(),usedhere->end(), [](float &c, float &d){ return c<d;
 */
   }
       
+  void ICARUSPurityDQM::FitAccumulated(int run, int subrun, int ev)
+  {
+    //straight line fit of log(area) versus drift time solved in closed form
+    //from the per-tpc sufficient statistics, one solution for every tpc with
+    //enough samples: no replay of the samples, so a refit costs the same no
+    //matter how much statistics has been accumulated
+    //the result goes in purityaccum and in purity_incremental.out so the
+    //purity can be followed while the events are processed
+    //all the samples enter with the same uncertainty (0.23, as in the event
+    //by event fits) so the slope matches the old pol1 fit of the samples
+    std::ofstream goodpuroacc("purity_incremental.out",std::ios::app);
+    for(int tpc=0;tpc<4;tpc++)
+      {
+	double nnn=accum_n[tpc];
+	if(nnn>100)
+	  {
+	    double delta=nnn*accum_stt[tpc]-accum_st[tpc]*accum_st[tpc];
+	    if(delta<=0)continue;
+	    float slope_accum=(nnn*accum_sty[tpc]-accum_st[tpc]*accum_sy[tpc])/delta;
+	    float error_slope_accum=0.23*sqrt(nnn/delta);
+	    std::cout << " INCREMENTAL PURITY " << tpc+fcryofcl*10 << " " << -slope_accum*1000. << " with " << nnn << " samples " << std::endl;
+	    if(fabs(slope_accum)<0.01)
+	      {
+		purityaccum->Fill(-slope_accum*1000.);
+		goodpuroacc << run << " " << subrun << " " << ev << " " << tpc+fcryofcl*10 << " " << slope_accum << " " << error_slope_accum << " " << nnn << std::endl;
+	      }
+	  }
+      }
+  }
+
   void ICARUSPurityDQM::produce(art::Event& evt)
   {
     
@@ -944,6 +1002,18 @@ if(delta_sample_selected>1900)
 				    ex[k]=0;
 				    ez[k]=60;
 				    ey[k]=0.23;
+				    //update also the sufficient statistics for the incremental fits
+				    if(faccumeventsfcl>0 && accum_samples<faccummaxsamplesfcl)
+				      {
+					double ttt=(*hittimegood)[k];
+					double yyy=log((*hitareagood)[k]);
+					accum_n[tpc_number]+=1;
+					accum_st[tpc_number]+=ttt;
+					accum_stt[tpc_number]+=ttt*ttt;
+					accum_sy[tpc_number]+=yyy;
+					accum_sty[tpc_number]+=ttt*yyy;
+					accum_samples+=1;
+				      }
 			      }
 			    //std::cout<<""<<std::endl;
 			    //std::cout<<"HERE line 872"<<std::endl;
@@ -1175,6 +1245,22 @@ if(delta_sample_selected>1900)
     }
     */
     
+    //every faccumeventsfcl events solve the accumulated fit and restart the sums
+    if(faccumeventsfcl>0)
+      {
+	accum_events+=1;
+	if(accum_events>=faccumeventsfcl)
+	  {
+	    FitAccumulated(evt.run(),evt.subRun(),evt.event());
+	    for(int ijk=0;ijk<4;ijk++)
+	      {
+		accum_n[ijk]=0;accum_st[ijk]=0;accum_stt[ijk]=0;accum_sy[ijk]=0;accum_sty[ijk]=0;
+	      }
+	    accum_samples=0;
+	    accum_events=0;
+	  }
+      }
+
    //put info onto the event
     evt.put(std::move(outputPtrVector));
   } // produces
@@ -41,6 +41,7 @@
 
 // C++ Includes
 #include <map>
+#include <set>
 #include <vector>
 #include <tuple>
 #include <algorithm>
@@ -89,6 +90,7 @@ private:
     // The parameters we'll read from the .fcl file.
     std::vector<art::InputTag> fRawDigitProducerLabelVec;
     art::InputTag              fSimChannelProducerLabel;
+    std::set<raw::ChannelID_t> fChannelSet;              ///< If not empty, only these channels are analyzed
 
     // The variables that will go into the n-tuple.
     int fEvent;
@@ -169,6 +171,14 @@ void RawDigitAna::reconfigure(fhicl::ParameterSet const& p)
     fRawDigitProducerLabelVec = p.get< std::vector<art::InputTag> >("RawDigitModuleLabel",   std::vector<art::InputTag>() = {"rawdigitfilter"});
     fSimChannelProducerLabel  = p.get< std::string                >("SimChannelModuleLabel", "largeant"      );
 
+    // Optional channel whitelist: when given, only the listed channels are
+    // passed to the histogram tools (and so decompressed by them). This is
+    // what monitoring jobs watching a handful of channels should set.
+    std::vector<raw::ChannelID_t> channelVec = p.get< std::vector<raw::ChannelID_t> >("AnalyzeChannels", std::vector<raw::ChannelID_t>());
+
+    fChannelSet.clear();
+    fChannelSet.insert(channelVec.begin(),channelVec.end());
+
     // Implement the tools for handling the responses
     const std::vector<fhicl::ParameterSet>& rawDigitHistogramToolVec = p.get<std::vector<fhicl::ParameterSet>>("RawDigitHistogramToolList");
     
@@ -209,14 +219,31 @@ void RawDigitAna::analyze(const art::Event& event)
         
         if (simChannelHandle.isValid())
         {
-            for(const auto& simChannel : *simChannelHandle) channelMap[simChannel.Channel()] = &simChannel;
+            for(const auto& simChannel : *simChannelHandle)
+            {
+                if (!fChannelSet.empty() && !fChannelSet.count(simChannel.Channel())) continue;
+
+                channelMap[simChannel.Channel()] = &simChannel;
+            }
         }
-        
+
         if (rawDigitHandle.isValid())
         {
             IRawDigitHistogramTool::RawDigitPtrVec allRawDigitVec;
-            art::fill_ptr_vector(allRawDigitVec, rawDigitHandle);
-            
+
+            if (fChannelSet.empty()) art::fill_ptr_vector(allRawDigitVec, rawDigitHandle);
+            else
+            {
+                // Channel whitelist in effect: hand the tools only the digits
+                // they will analyze. Checking the channel number does not touch
+                // the ADC vector, so the unselected digits are never decompressed
+                for(size_t rdIdx = 0; rdIdx < rawDigitHandle->size(); rdIdx++)
+                {
+                    if (fChannelSet.count((*rawDigitHandle)[rdIdx].Channel()))
+                        allRawDigitVec.emplace_back(rawDigitHandle, rdIdx);
+                }
+            }
+
             for(auto& rawDigitHistTool : fRawDigitHistogramToolVec) rawDigitHistTool->fillHistograms(clockData, detProp, allRawDigitVec,channelMap);
         }
     }
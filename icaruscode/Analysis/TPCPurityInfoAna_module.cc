@@ -20,9 +20,13 @@
 //purity info class
 #include "sbnobj/Common/Analysis/TPCPurityInfo.hh"
 
+//batched (SoA) counterpart of the purity records
+#include "icaruscode/IcarusObj/PurityRecordBatch.h"
+
 //output to ntuple
 #include "art_root_io/TFileService.h"
 #include "TNtuple.h"
+#include "TTree.h"
 
 namespace ana {
   class TPCPurityInfoAna;
@@ -48,7 +52,14 @@ private:
 
   // Declare member data here.
   art::InputTag const fPurityInfoLabel;
+  art::InputTag const fPurityBatchLabel;
   TNtuple* fPurityTuple;
+  TTree* fBatchTree;
+
+  //staging copy of the batch product: the tree branches are bound straight
+  //onto its arrays, so filling is a few contiguous vector copies per event
+  icarus::PurityRecordBatch fBatch;
+  int fRun, fSubRun, fEvent;
 
   bool fPrintInfo;
 
@@ -58,9 +69,11 @@ private:
 ana::TPCPurityInfoAna::TPCPurityInfoAna(fhicl::ParameterSet const& p)
   : EDAnalyzer{p}  // ,
   , fPurityInfoLabel(p.get<art::InputTag>("PurityInfoLabel"))
+  , fPurityBatchLabel(p.get<art::InputTag>("PurityBatchLabel",p.get<art::InputTag>("PurityInfoLabel")))
   , fPrintInfo(p.get<bool>("PrintInfo",false))
 {
   consumes< std::vector<anab::TPCPurityInfo> >(fPurityInfoLabel);
+  mayConsume< icarus::PurityRecordBatch >(fPurityBatchLabel);
 }
 
 void ana::TPCPurityInfoAna::beginJob()
@@ -71,6 +84,20 @@ void ana::TPCPurityInfoAna::beginJob()
 
   fPurityTuple = tfs->make<TNtuple>("purityTuple","Purity Tuple","run:subrun:ev:cryo:tpc:wires:ticks:att:err");
 
+  //one entry per event, with the batch arrays mapped directly onto branches
+  fBatchTree = tfs->make<TTree>("purityBatchTree","Purity Record Batches");
+  fBatchTree->Branch("run",    &fRun,    "run/I");
+  fBatchTree->Branch("subrun", &fSubRun, "subrun/I");
+  fBatchTree->Branch("ev",     &fEvent,  "ev/I");
+  fBatchTree->Branch("cryo",     "std::vector<int>",    &fBatch.cryostat);
+  fBatchTree->Branch("tpc",      "std::vector<int>",    &fBatch.tpc);
+  fBatchTree->Branch("trackidx", "std::vector<int>",    &fBatch.trackIdx);
+  fBatchTree->Branch("wirerange","std::vector<int>",    &fBatch.wireRange);
+  fBatchTree->Branch("wires",    "std::vector<int>",    &fBatch.wires);
+  fBatchTree->Branch("ticks",    "std::vector<int>",    &fBatch.ticks);
+  fBatchTree->Branch("att",      "std::vector<double>", &fBatch.attenuation);
+  fBatchTree->Branch("err",      "std::vector<double>", &fBatch.fracError);
+
 }
 void ana::TPCPurityInfoAna::analyze(art::Event const& e)
 {
@@ -81,6 +108,29 @@ void ana::TPCPurityInfoAna::analyze(art::Event const& e)
 	      << ", Event " << e.event() 
 	      << ":" << std::endl;
 
+  //prefer the batched records when the producer published them: one bulk
+  //copy per event instead of a record-at-a-time marshaling
+  art::Handle< icarus::PurityRecordBatch > batchHandle;
+  e.getByLabel(fPurityBatchLabel,batchHandle);
+
+  if(batchHandle.isValid()){
+
+    fRun    = e.run();
+    fSubRun = e.subRun();
+    fEvent  = e.event();
+    fBatch  = *batchHandle;
+    fBatchTree->Fill();
+
+    if(fPrintInfo)
+      std::cout << "\tThere are " << fBatch.size() << " purity records in the batch."
+		<< std::endl;
+
+    for(size_t i_r = 0; i_r < fBatch.size(); ++i_r)
+      fPurityTuple->Fill(e.run(),e.subRun(),e.event(),fBatch.cryostat[i_r],fBatch.tpc[i_r],fBatch.wires[i_r],fBatch.ticks[i_r],fBatch.attenuation[i_r],fBatch.fracError[i_r]);
+
+    return;
+  }
+
   art::Handle< std::vector<anab::TPCPurityInfo> > purityInfoHandle;
   e.getByLabel(fPurityInfoLabel,purityInfoHandle);
   auto const& purityInfoVec(*purityInfoHandle);
@@ -54,6 +54,9 @@
 //purity info class
 #include "sbnobj/Common/Analysis/TPCPurityInfo.hh"
 
+//batched (SoA) counterpart of the purity records
+#include "icaruscode/IcarusObj/PurityRecordBatch.h"
+
 // Eigen includes
 #include "Eigen/Core"
 #include "Eigen/Dense"
@@ -66,6 +69,7 @@
 #include <algorithm>
 #include <numeric>
 #include <functional>
+#include <random>
 #include <tuple>
 
 namespace TPCPurityMonitor
@@ -182,6 +186,11 @@ private:
     // Reject outliers
     void RejectOutliers(HitStatusChargePairVec& hitPairVector, const PrincipalComponents2D& pca) const;
 
+    // RANSAC-style alternative to the fit/reject/refit sequence for long tracks:
+    // fit random subsamples, keep the model with the largest inlier set, then
+    // run the standard PCA on the surviving hits
+    bool RANSACFit(HitStatusChargePairVec& hitPairVector, PrincipalComponents2D& pca) const;
+
     // The following typedefs will, obviously, be useful
     double length(const recob::Track* track);
 
@@ -199,6 +208,11 @@ private:
     bool                       fUseHitIntegral;     ///< Setting to false swaps to "SummedADC"
     bool                       fWeightByChiSq;      ///< Weight the PCA by the hit chisquare
     bool                       fDiagnosticTuple;    ///< Output the diagnostic tuple
+    bool                       fUseRANSAC;          ///< Use the subsampled RANSAC fit for long tracks
+    unsigned                   fRANSACMinHits;      ///< Below this many hits fall back to the full fit
+    unsigned                   fRANSACSampleSize;   ///< Number of hits in each random subsample
+    unsigned                   fRANSACMaxIterations;///< Maximum number of subsamples to try
+    double                     fRANSACTolerance;    ///< Log charge residual defining an inlier
 
     float                      fSamplingRate;       ///< Recover the sampling rate from the clock data
 
@@ -270,6 +284,10 @@ TPCPurityMonitor::TPCPurityMonitor(fhicl::ParameterSet const& parameterSet)
     // We're going to output purity objects
     produces<std::vector<anab::TPCPurityInfo>>("",art::Persistable::Yes);
 
+    // ... plus the same records batched as contiguous arrays, so consumers
+    // can bulk-copy them into their tree branches
+    produces<icarus::PurityRecordBatch>("",art::Persistable::Yes);
+
     // Read in the parameters from the .fcl file.
     this->reconfigure(parameterSet);
 }
@@ -365,6 +383,11 @@ void TPCPurityMonitor::reconfigure(fhicl::ParameterSet const& p)
     fUseHitIntegral     = p.get< bool                       >("UseHitIntegral",         true);
     fWeightByChiSq      = p.get< bool                       >("WeightByChiSq",         false);
     fDiagnosticTuple    = p.get< bool                       >("DiagnosticTuple",        true);
+    fUseRANSAC          = p.get< bool                       >("UseRANSAC",             false);
+    fRANSACMinHits      = p.get< unsigned                   >("RANSACMinHits",          1000);
+    fRANSACSampleSize   = p.get< unsigned                   >("RANSACSampleSize",        100);
+    fRANSACMaxIterations= p.get< unsigned                   >("RANSACMaxIterations",      20);
+    fRANSACTolerance    = p.get< double                     >("RANSACTolerance",         0.5);
 
     return;
 }
@@ -374,6 +397,7 @@ void TPCPurityMonitor::produce(art::Event& event)
 {
     //setup output vector#include "lardataobj/RecoBase/TrackHitMeta.h"
     std::unique_ptr< std::vector<anab::TPCPurityInfo> > outputPtrVector(new std::vector<anab::TPCPurityInfo>());
+    std::unique_ptr< icarus::PurityRecordBatch >        outputBatch(new icarus::PurityRecordBatch());
 
     fNumEvents++;
     
@@ -510,15 +534,24 @@ void TPCPurityMonitor::produce(art::Event& event)
 
             PrincipalComponents2D pca;
 
-            GetPrincipalComponents2D(hitStatusChargePairVec, pca);
+            if (fUseRANSAC && hitStatusChargePairVec.size() >= fRANSACMinHits)
+            {
+                // Long track: the iterative fit cost is dominated by the number of hits,
+                // use the subsampled RANSAC fit instead
+                if (!RANSACFit(hitStatusChargePairVec, pca)) continue;
+            }
+            else
+            {
+                GetPrincipalComponents2D(hitStatusChargePairVec, pca);
 
-            // Reject the outliers
-            RejectOutliers(hitStatusChargePairVec, pca);
+                // Reject the outliers
+                RejectOutliers(hitStatusChargePairVec, pca);
 
-            // Recompute the pca
-            GetPrincipalComponents2D(hitStatusChargePairVec, pca);
+                // Recompute the pca
+                GetPrincipalComponents2D(hitStatusChargePairVec, pca);
+            }
 
-            // If the PCA faild then we should bail out 
+            // If the PCA faild then we should bail out
             if (!pca.getSvdOK()) continue;
 
             // Now get the 3D PCA so we can use this to help select on track straightness
@@ -562,6 +595,9 @@ void TPCPurityMonitor::produce(art::Event& event)
 
             outputPtrVector->emplace_back(purityInfo);
 
+            outputBatch->addRecord(wireID.Cryostat, wireID.TPC, trackIdx, maxWire - minWire,
+                                   purityInfo.Wires, purityInfo.Ticks, purityInfo.Attenuation, purityInfo.FracError);
+
             if (fDiagnosticTuple)
             {
                 fRunNumber    = event.run();
@@ -683,6 +719,7 @@ void TPCPurityMonitor::produce(art::Event& event)
     
     //put info onto the event
     event.put(std::move(outputPtrVector));
+    event.put(std::move(outputBatch));
 
     return;
 }
@@ -921,6 +958,101 @@ void TPCPurityMonitor::GetPrincipalComponents3D(const HitStatusChargePairVec& hi
     return;
 }
 
+bool TPCPurityMonitor::RANSACFit(HitStatusChargePairVec& hitPairVector, PrincipalComponents2D& pca) const
+{
+    // Flatten the good hits into parallel arrays so the residual loop below is
+    // simple arithmetic over contiguous memory the compiler can vectorize
+    std::vector<double> times;
+    std::vector<double> logCharges;
+    std::vector<size_t> indices;
+
+    times.reserve(hitPairVector.size());
+    logCharges.reserve(hitPairVector.size());
+    indices.reserve(hitPairVector.size());
+
+    for(size_t idx = 0; idx < hitPairVector.size(); idx++)
+    {
+        const HitStatusChargePair& hitPair = hitPairVector[idx];
+
+        if (!hitPair.second.first) continue;
+
+        times.emplace_back(fSamplingRate * hitPair.first.first->PeakTime());
+        logCharges.emplace_back(std::log(hitPair.second.second));
+        indices.emplace_back(idx);
+    }
+
+    size_t numGood = times.size();
+
+    if (numGood < std::max(size_t(fRANSACSampleSize),size_t(fMinNumHits))) return false;
+
+    // Fixed seeding so a given track always gives the same answer
+    std::mt19937                          rng(numGood);
+    std::uniform_int_distribution<size_t> pick(0, numGood - 1);
+
+    std::vector<char> bestInliers(numGood, 0);
+    std::vector<char> inliers(numGood, 0);
+    size_t            bestCount(0);
+    int               staleCount(0);
+
+    for(unsigned iter = 0; iter < fRANSACMaxIterations; iter++)
+    {
+        // Least squares line through a random subsample of the hits
+        double sumT(0.);
+        double sumQ(0.);
+        double sumTT(0.);
+        double sumTQ(0.);
+
+        for(unsigned smp = 0; smp < fRANSACSampleSize; smp++)
+        {
+            size_t idx = pick(rng);
+
+            sumT  += times[idx];
+            sumQ  += logCharges[idx];
+            sumTT += times[idx] * times[idx];
+            sumTQ += times[idx] * logCharges[idx];
+        }
+
+        double denom = double(fRANSACSampleSize) * sumTT - sumT * sumT;
+
+        if (std::abs(denom) < std::numeric_limits<double>::epsilon()) continue;
+
+        double slope     = (double(fRANSACSampleSize) * sumTQ - sumT * sumQ) / denom;
+        double intercept = (sumQ - slope * sumT) / double(fRANSACSampleSize);
+
+        // Score the model by counting the inliers over all the good hits
+        size_t count(0);
+
+        for(size_t idx = 0; idx < numGood; idx++)
+        {
+            inliers[idx] = std::abs(logCharges[idx] - slope * times[idx] - intercept) < fRANSACTolerance;
+            count       += inliers[idx];
+        }
+
+        if (count > bestCount)
+        {
+            bestCount   = count;
+            bestInliers = inliers;
+            staleCount  = 0;
+        }
+        // Early termination: the consensus set has stopped growing
+        else if (++staleCount > 2) break;
+
+        // ... or nearly every hit already agrees with the best model
+        if (bestCount > 0.95 * numGood) break;
+    }
+
+    if (bestCount < fMinNumHits) return false;
+
+    // Tag the hits outside the consensus set so the downstream code skips them...
+    for(size_t idx = 0; idx < numGood; idx++)
+        if (!bestInliers[idx]) hitPairVector[indices[idx]].second.first = false;
+
+    // ... and extract the final axes from the consensus set with the standard PCA
+    GetPrincipalComponents2D(hitPairVector, pca);
+
+    return pca.getSvdOK();
+}
+
 void TPCPurityMonitor::RejectOutliers(HitStatusChargePairVec& hitPairVector, const PrincipalComponents2D& pca) const
 {
     double                 slope  = pca.getEigenVectors().row(1)[1] / pca.getEigenVectors().row(1)[0];
@@ -41,6 +41,7 @@
 #include "lardataobj/Simulation/SimEnergyDeposit.h"
 #include "nusimdata/SimulationBase/MCParticle.h"
 #include "larsim/Simulation/LArG4Parameters.h"
+#include "icaruscode/CRT/CRTUtils/RecoUtils.h"
 
 // Eigen
 #include <Eigen/Dense>
@@ -540,20 +541,11 @@ void ThroughgoingmuonAnalyzer::analyze(art::Event const& evt)
     // There are several things going on here... for each channel we have particles (track id's) depositing energy in a range to ticks
     // So... for each channel we want to build a structure that relates particles to tdc ranges and deposited energy (or electrons)
     // Here is a complicated structure:
-    using TDCToIDEMap             = std::map<unsigned short, sim::IDE>; // We need this one in order
-    using ChanToTDCToIDEMap       = std::map<raw::ChannelID_t, TDCToIDEMap>;
-    using PartToChanToTDCToIDEMap = std::unordered_map<int, ChanToTDCToIDEMap>;
+    using TDCToIDEMap             = RecoUtils::TDCToIDEMap; // We need this one in order
+    using PartToChanToTDCToIDEMap = RecoUtils::TrackIDToChanToTDCToIDEMap;
 
-    PartToChanToTDCToIDEMap partToChanToTDCToIDEMap;
-  
-    // Build out the above data structure
-    for(const auto& simChannel : *simChannelHandle)
-    {
-        for(const auto& tdcide : simChannel.TDCIDEMap())
-        {
-            for(const auto& ide : tdcide.second) partToChanToTDCToIDEMap[ide.trackID][simChannel.Channel()][tdcide.first] = ide;
-        }
-    }
+    // Build out the above data structure (shared with the other truth matching analyzers)
+    PartToChanToTDCToIDEMap partToChanToTDCToIDEMap = RecoUtils::BuildTrackIDToSimChannelIndex(*simChannelHandle);
 
     // Here we make a map between track ID and associatied SimEnergyDeposit objects
     // We'll need this for sorting out the track direction at each hit
@@ -590,12 +582,9 @@ void ThroughgoingmuonAnalyzer::analyze(art::Event const& evt)
     HitToMCPartToIdxMap hitToMcPartToIdxMap;
     
     // It is useful to create a mapping between trackID and MCParticle
-    using TrackIDToMCParticleMap = std::unordered_map<int, const simb::MCParticle*>;
-    
-    TrackIDToMCParticleMap trackIDToMCParticleMap;
-    
-    for(const auto& mcParticle : *mcParticleHandle)
-        trackIDToMCParticleMap[mcParticle.TrackId()] = &mcParticle;
+    using TrackIDToMCParticleMap = RecoUtils::TrackIDToMCParticleMap;
+
+    TrackIDToMCParticleMap trackIDToMCParticleMap = RecoUtils::BuildTrackIDToMCParticleMap(*mcParticleHandle);
     
     const lariov::ChannelStatusProvider& chanFilt = art::ServiceHandle<lariov::ChannelStatusService>()->GetProvider();
 
@@ -56,6 +56,7 @@
 
 // C++ Includes
 #include <map>
+#include <set>
 #include <vector>
 #include <tuple>
 #include <algorithm>
@@ -119,6 +120,7 @@ private:
     std::vector<art::InputTag> fWireProducerLabelVec;
     std::vector<art::InputTag> fPFParticleProducerLabelVec;
     std::vector<art::InputTag> fTrackProducerLabelVec;
+    std::set<raw::ChannelID_t> fChannelSet;              ///< If not empty, only hits on these channels are analyzed
 
     // The variables that will go into the n-tuple.
     int fEvent;
@@ -198,7 +200,14 @@ void TrackHitAna::reconfigure(fhicl::ParameterSet const& p)
     fPFParticleProducerLabelVec = p.get< std::vector<art::InputTag> >("PFParticleProducerLabel", std::vector<art::InputTag>() = {"cluster3d"});
     fTrackProducerLabelVec      = p.get< std::vector<art::InputTag> >("TrackProducerLabel",      std::vector<art::InputTag>() = {"trackkalmanhit"});
     fWireProducerLabelVec       = p.get< std::vector<art::InputTag> >("WireProducerLabel",       std::vector<art::InputTag>() = {"caldata"});
-    
+
+    // Optional channel whitelist: when given, only hits on the listed channels
+    // are passed to the histogram tools
+    std::vector<raw::ChannelID_t> channelVec = p.get< std::vector<raw::ChannelID_t> >("AnalyzeChannels", std::vector<raw::ChannelID_t>());
+
+    fChannelSet.clear();
+    fChannelSet.insert(channelVec.begin(),channelVec.end());
+
     // Implement the tools for handling the responses
     const std::vector<fhicl::ParameterSet>& hitHistogramToolVec = p.get<std::vector<fhicl::ParameterSet>>("HitHistogramToolList");
     
@@ -227,8 +236,19 @@ void TrackHitAna::analyze(const art::Event& event)
         if (hitHandle.isValid())
         {
             IHitHistogramTool::HitPtrVec allHitVec;
-            art::fill_ptr_vector(allHitVec, hitHandle);
-            
+
+            if (fChannelSet.empty()) art::fill_ptr_vector(allHitVec, hitHandle);
+            else
+            {
+                // Channel whitelist in effect: hand the tools only the hits
+                // on the channels they will analyze
+                for(size_t hitIdx = 0; hitIdx < hitHandle->size(); hitIdx++)
+                {
+                    if (fChannelSet.count((*hitHandle)[hitIdx].Channel()))
+                        allHitVec.emplace_back(hitHandle, hitIdx);
+                }
+            }
+
             for(auto& hitHistTool : fHitHistogramToolVec) hitHistTool->fillHistograms(allHitVec);
         }
     }
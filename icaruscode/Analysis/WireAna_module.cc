@@ -98,6 +98,11 @@ private:
     // Keep track of the hit histogramming tools here
     std::vector<std::unique_ptr<IWireHistogramTool>> fWireHistogramToolVec;
 
+    // Accounting of time the event loop spends blocked on histogram filling,
+    // reported at end of job
+    double fFillTimeTotal;
+    double fFillTimeMax;
+
     std::vector<std::vector<double>> fChannelPedVec;
 
     // Other variables that will be shared between different methods.
@@ -146,6 +151,10 @@ void WireAna::beginJob()
 
     // zero out the event counter
     fNumEvents = 0;
+
+    // zero out the fill time accounting
+    fFillTimeTotal = 0.;
+    fFillTimeMax   = 0.;
 }
 
 //-----------------------------------------------------------------------
@@ -216,8 +225,21 @@ void WireAna::analyze(const art::Event& event)
         {
             IWireHistogramTool::WirePtrVec wireVec;
             art::fill_ptr_vector(wireVec, wireHandle);
-    
+
+            // Time the filling so stalls on the histogramming show up in the
+            // end of job accounting
+            cet::cpu_timer theClockFill;
+
+            theClockFill.start();
+
             for(auto& wireHistTool : fWireHistogramToolVec) wireHistTool->fillHistograms(wireVec,channelMap,fNumEvents);
+
+            theClockFill.stop();
+
+            double fillTime = theClockFill.accumulated_real_time();
+
+            fFillTimeTotal += fillTime;
+            fFillTimeMax    = std::max(fFillTimeMax, fillTime);
         }
     }
 
@@ -229,6 +251,11 @@ void WireAna::endJob()
     // Make a call to normalize histograms if so desired
     for(auto& wireHistTool : fWireHistogramToolVec) wireHistTool->endJob(fNumEvents);
 
+    // Report the time the event loop spent blocked on histogram filling
+    mf::LogInfo("WireAna") << "WireAna histogram filling: " << fFillTimeTotal
+                           << " s total over " << fNumEvents << " events (worst event: "
+                           << fFillTimeMax << " s)";
+
     return;
 }
 
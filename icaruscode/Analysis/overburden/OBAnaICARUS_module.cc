@@ -33,6 +33,10 @@
 
 #include "larcorealg/CoreUtils/ParticleFilters.h" // util::PositionInVolumeFilter
 #include "larcore/Geometry/Geometry.h"
+#include "icaruscode/Geometry/ActiveVolumeDistanceField.h"
+
+#include "tbb/parallel_for.h"
+#include "tbb/blocked_range.h"
 
 #include <boost/uuid/uuid.hpp>            // uuid class
 #include <boost/uuid/uuid_generators.hpp> // generators
@@ -75,7 +79,8 @@ private:
   bool InDetector(const double& x, const double& y, const double& z) const;
 
   /// Check if an MCP passes through the detector, sets step to the step index when particle is in detector
-  bool InDetector(const art::Ptr<simb::MCParticle>, int & step);
+  bool InDetector(const art::Ptr<simb::MCParticle>, int & step,
+		  const icarus::ActiveVolumeDistanceField& distField);
 
   /// Saves the pi0 info to a separate tree, give the pi0 track id
   void SavePi0ShowerInfo(int pi0_track_id);
@@ -762,8 +767,32 @@ void obana::OBAnaICARUS::analyze(art::Event const& e)
     _trackid_to_mcparticle[mcp->TrackId()] = *mcp;
   }
 
+  // Tracing the trajectories against the detector is by far the expensive
+  // part of the primary loop below, and it is independent particle by
+  // particle: chunk the primaries across TBB worker threads, staging the
+  // results in per-particle slots so the tree variables are then filled
+  // serially, in the original particle order.
+  std::vector<size_t> primary_v;
+  primary_v.reserve(mcp_v.size());
   for (size_t i = 0; i < mcp_v.size(); i++) {
-    auto mcp = mcp_v.at(i);
+    if (mcp_v.at(i)->Process() == "primary") primary_v.push_back(i);
+  }
+
+  std::vector<int> primary_step(primary_v.size(), 0);
+  std::vector<char> primary_in_det(primary_v.size(), 0);
+
+  art::ServiceHandle<icarus::ActiveVolumeDistanceField const> dist_field;
+  tbb::parallel_for(tbb::blocked_range<size_t>(0, primary_v.size()),
+    [&](const tbb::blocked_range<size_t>& range) {
+      for (size_t p = range.begin(); p < range.end(); p++) {
+        int step = 0;
+        primary_in_det[p] = InDetector(mcp_v.at(primary_v[p]), step, *dist_field);
+        primary_step[p] = step;
+      }
+    });
+
+  for (size_t p = 0; p < primary_v.size(); p++) {
+    auto mcp = mcp_v.at(primary_v[p]);
     //      bool in_det = InDetector(mcp);
 
     // Only save the MCP if it's a primary, or if it crosses the det
@@ -792,9 +821,9 @@ void obana::OBAnaICARUS::analyze(art::Event const& e)
       //      _mcp_intpc.push_back(InDetector(mcp));
       // _neut_par_uuid = _uuid_str + "-" + std::to_string(mcp->TrackId());
 
-      int step = 0;
-      bool in_det = InDetector(mcp, step);
-      _mcp_intpc.push_back(in_det);      
+      int step = primary_step[p];
+      bool in_det = primary_in_det[p];
+      _mcp_intpc.push_back(in_det);
       
       if (mcp->PdgCode() == 2112 && in_det){ /// save the daughter of neutron entring to TPCs 
 	unsigned int nSec = mcp->NumberDaughters();
@@ -1588,26 +1617,35 @@ bool obana::OBAnaICARUS::InDetector(art::Ptr<simb::MCTruth> mctruth){
 }
 */
 
-bool obana::OBAnaICARUS::InDetector(art::Ptr<simb::MCParticle> mcp, int & step) {
+bool obana::OBAnaICARUS::InDetector(art::Ptr<simb::MCParticle> mcp, int & step,
+				    const icarus::ActiveVolumeDistanceField& distField) {
   auto t = mcp->Trajectory();
   //  std::cout<< "size of trajectory: "<< mcp->NumberTrajectoryPoints() << "\t" << t.size() << std::endl;
-  const geo::GeometryCore*           fGeometry;             ///< pointer to Geometry service
-  fGeometry           = lar::providerFrom<geo::Geometry>();
+  // precomputed active volume distance field: no per-point geometry navigation
+
+  // Coarse stepping far from the boundaries: a point at distance d outside
+  // the active volumes cannot be closer than d - s to them after moving by s,
+  // so trajectory points closer than d to the last queried point are provably
+  // still outside and are skipped without any field lookup at all. The first
+  // contained point is still found exactly.
+  geo::Point_t lastQuery;
+  double clearance = 0.;
 
   for (size_t i = 0; i < t.size(); i++) {
     // std::cout << "step: " << i << " , has energy : " << mcp->E(i) << "\t" <<mcp->PdgCode()<< std::endl;
     const TLorentzVector& pos = mcp->Position(i);
     geo::Point_t trackPoint(pos.X(),pos.Y(),pos.Z());
 
-    const geo::TPCGeo* tpcGeo = fGeometry->PositionToTPCptr(trackPoint);
+    if (clearance > 0. && (trackPoint - lastQuery).R() < clearance) continue;
 
-    if (!tpcGeo) continue;
-    //    if (tpcGeo->ID() != C0id) continue; // point not in cryostat 0
-    if (tpcGeo->ActiveBoundingBox().ContainsPosition(trackPoint)){
+    double const d = distField.distance(trackPoint);
+    if (d > 0.){
       step = i;
       //      std::cout << "Indide the boundary, step: " << step << " , has energy : " << mcp->E(step) << std::endl;
-      return true; 
+      return true;
     }
+    clearance = -d;
+    lastQuery = trackPoint;
     // if (InDetector(t.X(i), t.Y(i), t.Z(i))) return true;
   }
   return false;
@@ -25,6 +25,7 @@
 
 #include <cmath>
 #include <algorithm>
+#include <unordered_set>
 
 namespace HitEfficiencyAnalysis
 {
@@ -330,13 +331,32 @@ void HitEfficiencyAnalysis::fillHistograms(const art::Event& event) const
     using PartToChanToTDCToIDEMap = std::map<int, ChanToTDCToIDEMap>;
     
     PartToChanToTDCToIDEMap partToChanToTDCToIDEMap;
-    
-    // Build out the above data structure
+
+    // The accumulation loop below only ever looks at primary muons, so find
+    // their track IDs first and keep everything else out of the structure:
+    // in a full cosmic sample most of the IDEs belong to secondaries and
+    // would be inserted only to be skipped later
+    art::Handle< std::vector<simb::MCParticle>> mcParticleHandle;
+    event.getByLabel(fMCParticleProducerLabel, mcParticleHandle);
+
+    if (!mcParticleHandle.isValid()) return;
+
+    std::unordered_set<int> selectedTrackIDs;
+
+    for(const auto& mcParticle : *mcParticleHandle)
+    {
+        // Looking for primary muons (e.g. CR Tracks)
+        if (fabs(mcParticle.PdgCode()) == 13 && mcParticle.Process() == "primary") selectedTrackIDs.insert(mcParticle.TrackId());
+    }
+
+    // Build out the above data structure, SimChannels with no deposit from a
+    // selected track contribute nothing and are passed over
     for(const auto& simChannel : *simChannelHandle)
     {
         for(const auto& tdcide : simChannel.TDCIDEMap())
         {
-            for(const auto& ide : tdcide.second) partToChanToTDCToIDEMap[ide.trackID][simChannel.Channel()][tdcide.first] = ide.numElectrons;
+            for(const auto& ide : tdcide.second)
+                if (selectedTrackIDs.count(ide.trackID)) partToChanToTDCToIDEMap[ide.trackID][simChannel.Channel()][tdcide.first] = ide.numElectrons;
         }
     }
 
@@ -350,11 +370,8 @@ void HitEfficiencyAnalysis::fillHistograms(const art::Event& event) const
         
         art::Handle< std::vector<recob::Hit> > hitHandle;
         event.getByLabel(fHitProducerLabelVec[tpcID], hitHandle);
-        
-        art::Handle< std::vector<simb::MCParticle>> mcParticleHandle;
-        event.getByLabel(fMCParticleProducerLabel, mcParticleHandle);
-        
-        if (!wireHandle.isValid() || !hitHandle.isValid() || !mcParticleHandle.isValid()) return;
+
+        if (!wireHandle.isValid() || !hitHandle.isValid()) return;
     
         // Find the associations between wire data and hits
         // What we want to be able to do is look up hits that have been associated to Wire data
@@ -377,32 +394,18 @@ void HitEfficiencyAnalysis::fillHistograms(const art::Event& event) const
         ChanToHitVecMap channelToHitVec;
         
         for(const auto& hit : *hitHandle) channelToHitVec[hit.Channel()].push_back(&hit);
-        
-        // It is useful to create a mapping between trackID and MCParticle
-        using TrackIDToMCParticleMap = std::map<int, const simb::MCParticle*>;
-        
-        TrackIDToMCParticleMap trackIDToMCParticleMap;
-        
-        for(const auto& mcParticle : *mcParticleHandle) trackIDToMCParticleMap[mcParticle.TrackId()] = &mcParticle;
-        
+
         std::vector<int> nSimChannelHitVec = {0,0,0};
         std::vector<int> nRecobHitVec      = {0,0,0};
 
         for(const auto& partToChanInfo : partToChanToTDCToIDEMap)
         {
-            TrackIDToMCParticleMap::const_iterator trackIDToMCPartItr = trackIDToMCParticleMap.find(partToChanInfo.first);
-
-            if (trackIDToMCPartItr == trackIDToMCParticleMap.end()) continue;
+            // The structure was built from the selected (primary muon) tracks
+            // only, so every entry here passes the old PDG/process cuts
 
-            int         trackPDGCode = trackIDToMCPartItr->second->PdgCode();
-            std::string processName  = trackIDToMCPartItr->second->Process();
-
-            // Looking for primary muons (e.g. CR Tracks)
-            if (fabs(trackPDGCode) != 13 || processName != "primary") continue;
-    
             for(const auto& chanToTDCToIDEMap : partToChanInfo.second)
             {
-                TDCToIDEMap tdcToIDEMap = chanToTDCToIDEMap.second;
+                const TDCToIDEMap& tdcToIDEMap = chanToTDCToIDEMap.second;
                 float       totalElectrons(0.);
                 float       maxElectrons(0.);
                 int         nMatchedWires(0);
@@ -101,10 +101,51 @@ public:
     void fillHistograms(const art::Event&)  const override;
     
 private:
-    
+
     // Clear mutable variables
     void clear() const;
-    
+
+    // Streaming histogram accumulator: the hot loops bump a plain integer
+    // count array matching the histogram binning and the counts are committed
+    // to the ROOT histogram in one pass at end of job. This keeps the virtual
+    // TH1::Fill call out of the per-channel/per-hit code
+    class HistAccumulator
+    {
+    public:
+        void init(TH1F* hist)
+        {
+            fHist  = hist;
+            fNBins = hist->GetNbinsX();
+            fXMin  = hist->GetXaxis()->GetXmin();
+            fXMax  = hist->GetXaxis()->GetXmax();
+            fScale = double(fNBins) / (fXMax - fXMin);
+            fCounts.assign(fNBins + 2, 0);   // with under/overflow slots
+        }
+
+        void fill(double value) const
+        {
+            int bin = value < fXMin ? 0 : value >= fXMax ? fNBins + 1 : 1 + int((value - fXMin) * fScale);
+            fCounts[bin]++;
+        }
+
+        void commit()
+        {
+            // Weighted fills at the bin centers reproduce the binned statistics
+            for(int bin = 0; bin < int(fCounts.size()); bin++)
+                if (fCounts[bin] > 0) fHist->Fill(fHist->GetXaxis()->GetBinCenter(bin), double(fCounts[bin]));
+
+            std::fill(fCounts.begin(),fCounts.end(),0);
+        }
+
+    private:
+        TH1F*                             fHist  = nullptr;
+        int                               fNBins = 0;
+        double                            fXMin  = 0.;
+        double                            fXMax  = 0.;
+        double                            fScale = 0.;
+        mutable std::vector<unsigned int> fCounts;
+    };
+
     // Fcl parameters.
     art::InputTag               fRawDigitProducerLabel;
     art::InputTag               fWireProducerLabel;
@@ -118,19 +159,20 @@ private:
     std::vector<float>          fSigmaVec;               ///< Window size for matching to SimChannels
     int                         fMinAllowedChanStatus;   ///< Don't consider channels with lower status
 
-    // Pointers to the histograms we'll create.
-    std::vector<TH1F*>          fTotalElectronsHistVec;
-    std::vector<TH1F*>          fMaxElectronsHistVec;
-    std::vector<TH1F*>          fHitElectronsVec;
-    std::vector<TH1F*>          fHitSumADCVec;
-    std::vector<TH1F*>          fHitIntegralHistVec;
-    std::vector<TH1F*>          fHitPulseHeightVec;
-    std::vector<TH1F*>          fHitPulseWidthVec;
-    std::vector<TH1F*>          fSimNumTDCVec;
-    std::vector<TH1F*>          fHitNumTDCVec;
-    std::vector<TH1F*>          fSnippetLenVec;
-    std::vector<TH1F*>          fNMatchedHitVec;
-    std::vector<TH1F*>          fDeltaMidTDCVec;
+    // Pointers to the histograms we'll create; the hottest 1D histograms
+    // are filled through accumulators and committed at end of job
+    std::vector<HistAccumulator> fTotalElectronsHistVec;
+    std::vector<HistAccumulator> fMaxElectronsHistVec;
+    std::vector<HistAccumulator> fHitElectronsVec;
+    std::vector<HistAccumulator> fHitSumADCVec;
+    std::vector<HistAccumulator> fHitIntegralHistVec;
+    std::vector<HistAccumulator> fHitPulseHeightVec;
+    std::vector<HistAccumulator> fHitPulseWidthVec;
+    std::vector<HistAccumulator> fSimNumTDCVec;
+    std::vector<HistAccumulator> fHitNumTDCVec;
+    std::vector<HistAccumulator> fSnippetLenVec;
+    std::vector<HistAccumulator> fNMatchedHitVec;
+    std::vector<HistAccumulator> fDeltaMidTDCVec;
     std::vector<TProfile*>      fWireEfficVec;
     std::vector<TProfile*>      fWireEfficPHVec;
     std::vector<TProfile*>      fHitEfficVec;
@@ -139,8 +181,8 @@ private:
     std::vector<TProfile*>      fHitEfficRMSVec;
     std::vector<TProfile*>      fCosXZvRMSVec;
     std::vector<TProfile2D*>    fHitENEvXZVec;
-    std::vector<TH1F*>          fSimDivHitChgVec;
-    std::vector<TH1F*>          fSimDivHitChg1Vec;
+    std::vector<HistAccumulator> fSimDivHitChgVec;
+    std::vector<HistAccumulator> fSimDivHitChg1Vec;
     std::vector<TH2F*>          fHitVsSimChgVec;
     std::vector<TH2F*>          fHitVsSimIntVec;
     std::vector<TH2F*>          fToteVHitEIntVec;
@@ -270,23 +312,23 @@ void HitFinderAnalysis::initializeHists(art::ServiceHandle<art::TFileService>& t
 
     for(size_t plane = 0; plane < fGeometry->Nplanes(); plane++)
     {
-        fTotalElectronsHistVec.at(plane) = dir.make<TH1F>(("TotalElecs"  + std::to_string(plane)).c_str(), ";Total # electrons",     250,    0.,  100000.);
-        fMaxElectronsHistVec.at(plane)   = dir.make<TH1F>(("MaxElecs"    + std::to_string(plane)).c_str(), ";Max # electrons",       250,    0.,  20000.);
-        fHitElectronsVec.at(plane)       = dir.make<TH1F>(("HitElecs"    + std::to_string(plane)).c_str(), ";# e- in Hit Range",     250,    0.,  100000.);
-        fHitSumADCVec.at(plane)          = dir.make<TH1F>(("SumADC"      + std::to_string(plane)).c_str(), "Hit Sum ADC",            200,    0.,  1000.);
-        fHitIntegralHistVec.at(plane)    = dir.make<TH1F>(("Integral"    + std::to_string(plane)).c_str(), "Hit Integral",           200,    0.,  1000.);
-        fHitPulseHeightVec.at(plane)     = dir.make<TH1F>(("PulseHeight" + std::to_string(plane)).c_str(), "Hit PH (ADC)",           200,    0.,  150.);
-        fHitPulseWidthVec.at(plane)      = dir.make<TH1F>(("PulseWidth"  + std::to_string(plane)).c_str(), "Hit PulseWidth;Hit RMS", 100,    0.,  20.);
-        fSimNumTDCVec.at(plane)          = dir.make<TH1F>(("SimNumTDC"   + std::to_string(plane)).c_str(), ";TDC ticks",             100,    0.,  100.);
-        fHitNumTDCVec.at(plane)          = dir.make<TH1F>(("HitNumTDC"   + std::to_string(plane)).c_str(), ";ticks",                 100,    0.,  100.);
-        fSnippetLenVec.at(plane)         = dir.make<TH1F>(("SnippetLen"  + std::to_string(plane)).c_str(), ";ticks",                 100,    0.,  100.);
-        fNMatchedHitVec.at(plane)        = dir.make<TH1F>(("NMatched"    + std::to_string(plane)).c_str(), ";# hits",                 20,    0.,  20.);
-        fDeltaMidTDCVec.at(plane)        = dir.make<TH1F>(("DeltaMid"    + std::to_string(plane)).c_str(), ";# hits",                 50,  -25.,  25.);
+        fTotalElectronsHistVec.at(plane).init(dir.make<TH1F>(("TotalElecs"  + std::to_string(plane)).c_str(), ";Total # electrons",     250,    0.,  100000.));
+        fMaxElectronsHistVec.at(plane).init(dir.make<TH1F>(("MaxElecs"    + std::to_string(plane)).c_str(), ";Max # electrons",       250,    0.,  20000.));
+        fHitElectronsVec.at(plane).init(dir.make<TH1F>(("HitElecs"    + std::to_string(plane)).c_str(), ";# e- in Hit Range",     250,    0.,  100000.));
+        fHitSumADCVec.at(plane).init(dir.make<TH1F>(("SumADC"      + std::to_string(plane)).c_str(), "Hit Sum ADC",            200,    0.,  1000.));
+        fHitIntegralHistVec.at(plane).init(dir.make<TH1F>(("Integral"    + std::to_string(plane)).c_str(), "Hit Integral",           200,    0.,  1000.));
+        fHitPulseHeightVec.at(plane).init(dir.make<TH1F>(("PulseHeight" + std::to_string(plane)).c_str(), "Hit PH (ADC)",           200,    0.,  150.));
+        fHitPulseWidthVec.at(plane).init(dir.make<TH1F>(("PulseWidth"  + std::to_string(plane)).c_str(), "Hit PulseWidth;Hit RMS", 100,    0.,  20.));
+        fSimNumTDCVec.at(plane).init(dir.make<TH1F>(("SimNumTDC"   + std::to_string(plane)).c_str(), ";TDC ticks",             100,    0.,  100.));
+        fHitNumTDCVec.at(plane).init(dir.make<TH1F>(("HitNumTDC"   + std::to_string(plane)).c_str(), ";ticks",                 100,    0.,  100.));
+        fSnippetLenVec.at(plane).init(dir.make<TH1F>(("SnippetLen"  + std::to_string(plane)).c_str(), ";ticks",                 100,    0.,  100.));
+        fNMatchedHitVec.at(plane).init(dir.make<TH1F>(("NMatched"    + std::to_string(plane)).c_str(), ";# hits",                 20,    0.,  20.));
+        fDeltaMidTDCVec.at(plane).init(dir.make<TH1F>(("DeltaMid"    + std::to_string(plane)).c_str(), ";# hits",                 50,  -25.,  25.));
         fNSimChannelHitsVec.at(plane)    = dir.make<TH1F>(("NSimChan"    + std::to_string(plane)).c_str(), ";# hits",                100,    0.,  1200.);
         fNRecobHitVec.at(plane)          = dir.make<TH1F>(("NRecobHit"   + std::to_string(plane)).c_str(), ";# hits",                100,    0.,  1200.);
         fHitEfficiencyVec.at(plane)      = dir.make<TH1F>(("PlnEffic"    + std::to_string(plane)).c_str(), ";# hits",                101,    0.,  1.01);
-        fSimDivHitChgVec.at(plane)       = dir.make<TH1F>(("SimDivHit"   + std::to_string(plane)).c_str(), ";# e / SummedADC",       200,    0.,  200.);
-        fSimDivHitChg1Vec.at(plane)      = dir.make<TH1F>(("SimDivHit1"  + std::to_string(plane)).c_str(), ";# e / Integral",        200,    0.,  200.);
+        fSimDivHitChgVec.at(plane).init(dir.make<TH1F>(("SimDivHit"   + std::to_string(plane)).c_str(), ";# e / SummedADC",       200,    0.,  200.));
+        fSimDivHitChg1Vec.at(plane).init(dir.make<TH1F>(("SimDivHit1"  + std::to_string(plane)).c_str(), ";# e / Integral",        200,    0.,  200.));
 
         fHitVsSimChgVec.at(plane)        = dir.make<TH2F>(("HitVSimQ"  + std::to_string(plane)).c_str(), "# e vs Hit SumADC;SumADC;# e",     50, 0.,   1000., 50, 0., 100000.);
         fHitVsSimIntVec.at(plane)        = dir.make<TH2F>(("HitVSimI"  + std::to_string(plane)).c_str(), "# e vs Hit Integral;Integral;# e", 50, 0.,   1000., 50, 0., 100000.);
@@ -590,8 +632,8 @@ void HitFinderAnalysis::fillHistograms(const art::Event& event) const
 
             totalElectrons = std::min(totalElectrons, float(99900.));
             
-            fTotalElectronsHistVec[plane]->Fill(totalElectrons, 1.);
-            fMaxElectronsHistVec[plane]->Fill(maxElectrons, 1.);
+            fTotalElectronsHistVec[plane].fill(totalElectrons);
+            fMaxElectronsHistVec[plane].fill(maxElectrons);
             
             nSimChannelHitVec[plane]++;
 
@@ -603,7 +645,7 @@ void HitFinderAnalysis::fillHistograms(const art::Event& event) const
             unsigned short stopTick  = clockData.TPCTDC2Tick(stopTDC)         + fOffsetVec[plane];
             unsigned short maxETick  = clockData.TPCTDC2Tick(maxElectronsTDC) + fOffsetVec[plane];
 
-            fSimNumTDCVec[plane]->Fill(stopTick - startTick, 1.);
+            fSimNumTDCVec[plane].fill(stopTick - startTick);
     
             // Set up to extract the "best" parameters in the event of more than one hit for this pulse train
             float          nElectronsTotalBest(0.);
@@ -726,19 +768,19 @@ void HitFinderAnalysis::fillHistograms(const art::Event& event) const
                             float chgRatioADC = hitSummedADCBest > 0. ? totalElectrons / hitSummedADCBest : 0.;
                             float chgRatioInt = hitIntegralBest  > 0. ? totalElectrons / hitIntegralBest  : 0.;
         
-                            fHitSumADCVec[plane]->Fill(hitSummedADCBest, 1.);
-                            fHitIntegralHistVec[plane]->Fill(hitIntegralBest, 1.);
-                            fSimDivHitChgVec[plane]->Fill(chgRatioADC, 1.);
-                            fSimDivHitChg1Vec[plane]->Fill(chgRatioInt, 1.);
+                            fHitSumADCVec[plane].fill(hitSummedADCBest);
+                            fHitIntegralHistVec[plane].fill(hitIntegralBest);
+                            fSimDivHitChgVec[plane].fill(chgRatioADC);
+                            fSimDivHitChg1Vec[plane].fill(chgRatioInt);
                             fHitVsSimChgVec[plane]->Fill(std::min(hitSummedADCBest,float(999.)), totalElectrons, 1.);
                             fHitVsSimIntVec[plane]->Fill(std::min(hitIntegralBest,float(999.)), totalElectrons, 1.);
                             fToteVHitEIntVec[plane]->Fill(std::min(totalElectrons,float(99999.)),std::min(nElectronsTotalBest,float(99999.)),1.);
-                            fHitPulseHeightVec[plane]->Fill(std::min(hitPeakAmpBest,float(149.5)), 1.);
-                            fHitPulseWidthVec[plane]->Fill(std::min(hitRMSBest,float(19.8)), 1.);
-                            fHitElectronsVec[plane]->Fill(nElectronsTotalBest, 1.);
-                            fHitNumTDCVec[plane]->Fill(std::min(float(hitStopTickBest - hitStartTickBest),float(99.5)), 1.);
-                            fSnippetLenVec[plane]->Fill(std::min(hitSnippetLenBest, float(99.5)), 1.);
-                            fDeltaMidTDCVec[plane]->Fill(hitPeakTimeBest - maxETick, 1.);
+                            fHitPulseHeightVec[plane].fill(std::min(hitPeakAmpBest,float(149.5)));
+                            fHitPulseWidthVec[plane].fill(std::min(hitRMSBest,float(19.8)));
+                            fHitElectronsVec[plane].fill(nElectronsTotalBest);
+                            fHitNumTDCVec[plane].fill(std::min(float(hitStopTickBest - hitStartTickBest),float(99.5)));
+                            fSnippetLenVec[plane].fill(std::min(hitSnippetLenBest, float(99.5)));
+                            fDeltaMidTDCVec[plane].fill(hitPeakTimeBest - maxETick);
                         
                             nRecobHitVec[plane]++;
                         }
@@ -764,7 +806,7 @@ void HitFinderAnalysis::fillHistograms(const art::Event& event) const
             float matchHit   = std::min(nMatchedHits,1);
             float snippetLen = std::min(float(stopTick - startTick),float(99.5));
         
-            fNMatchedHitVec[plane]->Fill(nMatchedHits, 1.);
+            fNMatchedHitVec[plane].fill(nMatchedHits);
             fHitEfficVec[plane]->Fill(totalElectrons,   matchHit,   1.);
             fHitEfficPHVec[plane]->Fill(maxElectrons,   matchHit,   1.);
             fHitEfficXZVec[plane]->Fill(cosThetaXZ,     matchHit,   1.);
@@ -824,6 +866,22 @@ void HitFinderAnalysis::fillHistograms(const art::Event& event) const
 // Useful for normalizing histograms
 void HitFinderAnalysis::endJob(int numEvents)
 {
+    // Commit the accumulated counts to the ROOT histograms in one pass
+    for(auto& accumulator : fTotalElectronsHistVec) accumulator.commit();
+    for(auto& accumulator : fMaxElectronsHistVec)   accumulator.commit();
+    for(auto& accumulator : fHitElectronsVec)       accumulator.commit();
+    for(auto& accumulator : fHitSumADCVec)          accumulator.commit();
+    for(auto& accumulator : fHitIntegralHistVec)    accumulator.commit();
+    for(auto& accumulator : fHitPulseHeightVec)     accumulator.commit();
+    for(auto& accumulator : fHitPulseWidthVec)      accumulator.commit();
+    for(auto& accumulator : fSimNumTDCVec)          accumulator.commit();
+    for(auto& accumulator : fHitNumTDCVec)          accumulator.commit();
+    for(auto& accumulator : fSnippetLenVec)         accumulator.commit();
+    for(auto& accumulator : fNMatchedHitVec)        accumulator.commit();
+    for(auto& accumulator : fDeltaMidTDCVec)        accumulator.commit();
+    for(auto& accumulator : fSimDivHitChgVec)       accumulator.commit();
+    for(auto& accumulator : fSimDivHitChg1Vec)      accumulator.commit();
+
     return;
 }
     
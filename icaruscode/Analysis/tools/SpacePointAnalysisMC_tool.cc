@@ -981,20 +981,38 @@ void SpacePointAnalysisMC::compareSpacePointsToSim(const art::Event&
             // Look up assocations to hits
             art::FindManyP<recob::Hit> spHitAssnVec(spacePointHandle, event, spacePointLabel);
 
-            // And now, without further adieu, here we begin the loop that will actually produce some useful output.
-            // Loop over all space points and find out their true nature
+            // One-pass association flattening: resolve every space point's hit
+            // associations into contiguous pointer arrays up front so the analysis
+            // loop below runs over flat memory instead of going back through the
+            // association container for each space point
+            std::vector<const recob::SpacePoint*> flatSpacePointVec;
+            std::vector<const recob::Hit*>        flatHitVec;
+
+            flatSpacePointVec.reserve(spacePointHandle->size());
+            flatHitVec.reserve(3 * spacePointHandle->size());
+
             for(size_t idx = 0; idx < spacePointHandle->size(); idx++)
             {
-                art::Ptr<recob::SpacePoint> spacePointPtr(spacePointHandle,idx);
+                const std::vector<art::Ptr<recob::Hit>>& assnHitVec = spHitAssnVec.at(idx);
 
-                std::vector<art::Ptr<recob::Hit>> associatedHits(spHitAssnVec.at(spacePointPtr.key()));
-
-                if (associatedHits.size() != 3)
+                if (assnHitVec.size() != 3)
                 {
-                    mf::LogDebug("SpacePointAnalysisMC") << "I am certain this cannot happen... but here you go, space point with " << associatedHits.size() << " hits" << std::endl;
+                    mf::LogDebug("SpacePointAnalysisMC") << "I am certain this cannot happen... but here you go, space point with " << assnHitVec.size() << " hits" << std::endl;
                     continue;
                 }
 
+                flatSpacePointVec.push_back(&spacePointHandle->at(idx));
+
+                for(const auto& hitPtr : assnHitVec) flatHitVec.push_back(hitPtr.get());
+            }
+
+            // And now, without further adieu, here we begin the loop that will actually produce some useful output.
+            // Loop over all space points and find out their true nature
+            for(size_t spIdx = 0; spIdx < flatSpacePointVec.size(); spIdx++)
+            {
+                const recob::SpacePoint* spacePointPtr  = flatSpacePointVec[spIdx];
+                const recob::Hit* const* associatedHits = &flatHitVec[3 * spIdx];
+
                 // Retrieve the magic numbers from the space point
                 float spQuality   = spacePointPtr->Chisq();
                 float spCharge    = spacePointPtr->ErrXYZ()[1];
@@ -1020,15 +1038,17 @@ void SpacePointAnalysisMC::compareSpacePointsToSim(const art::Event&
                 std::vector<const recob::Hit*> recobHitVec(3,nullptr);
 
                 // Now we can use our maps to find out if the hits making up the SpacePoint are truly related...
-                for(const auto& hitPtr : associatedHits)
+                for(size_t hitIdx = 0; hitIdx < 3; hitIdx++)
                 {
-                    RecobHitToVoxelIDMap::const_iterator hitToVoxelItr = recobHitToVoxelIDMap.find(hitPtr.get());
+                    const recob::Hit* hitPtr = associatedHits[hitIdx];
+
+                    RecobHitToVoxelIDMap::const_iterator hitToVoxelItr = recobHitToVoxelIDMap.find(hitPtr);
 
                     float peakAmplitude = hitPtr->PeakAmplitude();
                     float peakTime      = hitPtr->PeakTime();
                     int   plane         = hitPtr->WireID().Plane;
 
-                    recobHitVec[plane] = hitPtr.get();
+                    recobHitVec[plane] = hitPtr;
 
                     numHits++;
                     averagePH += peakAmplitude;
@@ -1053,14 +1073,14 @@ void SpacePointAnalysisMC::compareSpacePointsToSim(const art::Event&
 
                 Triplet hitTriplet(recobHitVec[0],recobHitVec[1],recobHitVec[2]);
 
-                tripletMap[hitTriplet].emplace_back(spacePointPtr.get());
+                tripletMap[hitTriplet].emplace_back(spacePointPtr);
 
                 averagePH /= float(numHits);
                 averagePT /= float(numHits);
 
-                for(const auto& hitPtr : associatedHits)
+                for(size_t hitIdx = 0; hitIdx < 3; hitIdx++)
                 {
-                    float delT = hitPtr->PeakTime() - averagePT;
+                    float delT = associatedHits[hitIdx]->PeakTime() - averagePT;
 
                     if (std::abs(delT) > std::abs(largestDelT)) largestDelT = delT;
                 }
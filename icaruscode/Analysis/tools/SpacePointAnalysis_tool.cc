@@ -522,7 +522,7 @@ void SpacePointAnalysis::processSpacePoints(const art::Event&                  e
         {
             art::Ptr<recob::PFParticle> pfParticle(pfParticleHandle,idx);
 
-            std::vector<art::Ptr<recob::SpacePoint>> spacePointVec(pfPartSpacePointAssns.at(pfParticle.key()));
+            const std::vector<art::Ptr<recob::SpacePoint>>& spacePointVec = pfPartSpacePointAssns.at(pfParticle.key());
 
             pfParticleToNumSPMap[pfParticle.get()] = spacePointVec.size();
 
@@ -532,31 +532,56 @@ void SpacePointAnalysis::processSpacePoints(const art::Event&                  e
         // Ok now we want the reverse look up
         art::FindManyP<recob::PFParticle> spacePointPFPartAssns(spacePointHandle, event, collectionLabel);
 
-        std::unordered_map<const recob::Hit*,int> uniqueHitMap;
+        // One-pass association flattening: both association chains are resolved
+        // into contiguous arrays up front so the analysis loop below runs over
+        // flat memory instead of going back through the association containers
+        // for each space point. The hit lists vary in size so they are packed
+        // back to back with an offset table
+        std::vector<const recob::SpacePoint*> flatSpacePointVec;
+        std::vector<const recob::Hit*>        flatHitVec;
+        std::vector<size_t>                   flatHitOffsetVec;
+        std::vector<int>                      flatNumSPInPFPartVec;
+
+        flatSpacePointVec.reserve(spacePointHandle->size());
+        flatHitVec.reserve(3 * spacePointHandle->size());
+        flatHitOffsetVec.reserve(spacePointHandle->size() + 1);
+        flatNumSPInPFPartVec.reserve(spacePointHandle->size());
+
+        flatHitOffsetVec.push_back(0);
 
-        // And now, without further adieu, here we begin the loop that will actually produce some useful output.
-        // Loop over all space points and find out their true nature
         for(size_t idx = 0; idx < spacePointHandle->size(); idx++)
         {
-            // Recover space point
-            art::Ptr<recob::SpacePoint> spacePointPtr(spacePointHandle,idx);
-
-            std::vector<art::Ptr<recob::Hit>> associatedHits(spHitAssnVec.at(spacePointPtr.key()));
+            const std::vector<art::Ptr<recob::Hit>>& assnHitVec = spHitAssnVec.at(idx);
 
-            if (associatedHits.size() < 2)
+            if (assnHitVec.size() < 2)
             {
-                mf::LogDebug("SpacePointAnalysis") << "I am certain this cannot happen... but here you go, space point with " << associatedHits.size() << " hits" << std::endl;
+                mf::LogDebug("SpacePointAnalysis") << "I am certain this cannot happen... but here you go, space point with " << assnHitVec.size() << " hits" << std::endl;
                 continue;
             }
 
-            // Recover the PFParticle associated to this space point and get the number of associated hits
-            int nSpacePointsInPFParticle(0);
+            // Recover the PFParticle associated to this space point and get the number of associated space points
+            const std::vector<art::Ptr<recob::PFParticle>>& pfParticleVec = spacePointPFPartAssns.at(idx);
+
+            flatSpacePointVec.push_back(&spacePointHandle->at(idx));
+            flatNumSPInPFPartVec.push_back(pfParticleVec.size() == 1 ? pfParticleToNumSPMap.at(pfParticleVec[0].get()) : 0);
+
+            for(const auto& hitPtr : assnHitVec) flatHitVec.push_back(hitPtr.get());
 
-            std::vector<art::Ptr<recob::PFParticle>> pfParticleVec(spacePointPFPartAssns.at(spacePointPtr.key()));
+            flatHitOffsetVec.push_back(flatHitVec.size());
+        }
 
-            if (pfParticleVec.size() == 1) nSpacePointsInPFParticle = pfParticleToNumSPMap.at(pfParticleVec[0].get());
+        std::unordered_map<const recob::Hit*,int> uniqueHitMap;
 
-            mf::LogDebug("SpacePointAnalysis") << "==> pfPartVec size: " << pfParticleVec.size() << ", # space points: " << nSpacePointsInPFParticle << std::endl;
+        // And now, without further adieu, here we begin the loop that will actually produce some useful output.
+        // Loop over all space points and find out their true nature
+        for(size_t spIdx = 0; spIdx < flatSpacePointVec.size(); spIdx++)
+        {
+            // Recover space point
+            const recob::SpacePoint* spacePointPtr = flatSpacePointVec[spIdx];
+
+            int nSpacePointsInPFParticle = flatNumSPInPFPartVec[spIdx];
+
+            mf::LogDebug("SpacePointAnalysis") << "==> # space points in PFParticle: " << nSpacePointsInPFParticle << std::endl;
 
             // Retrieve the magic numbers from the space point
             float              spQuality       = spacePointPtr->Chisq();
@@ -583,8 +608,10 @@ void SpacePointAnalysis::processSpacePoints(const art::Event&                  e
             std::vector<float> peakAmpVec;
 
             // Now we can use our maps to find out if the hits making up the SpacePoint are truly related...
-            for(const auto& hitPtr : associatedHits)
+            for(size_t hitIdx = flatHitOffsetVec[spIdx]; hitIdx < flatHitOffsetVec[spIdx+1]; hitIdx++)
             {
+                const recob::Hit* hitPtr = flatHitVec[hitIdx];
+
                 float peakAmplitude = hitPtr->PeakAmplitude();
                 float peakTime      = hitPtr->PeakTime();
                 float rms           = hitPtr->RMS();
@@ -593,9 +620,9 @@ void SpacePointAnalysis::processSpacePoints(const art::Event&                  e
                 peakAmpVec.emplace_back(peakAmplitude);
 
                 // Add to the set
-                uniqueHitMap[hitPtr.get()] = nSpacePointsInPFParticle;
+                uniqueHitMap[hitPtr] = nSpacePointsInPFParticle;
 
-                recobHitVec[plane] = hitPtr.get();
+                recobHitVec[plane] = hitPtr;
                 numHits++;
                 averagePH  += peakAmplitude;
                 smallestPH  = std::min(peakAmplitude,smallestPH);
@@ -615,7 +642,7 @@ void SpacePointAnalysis::processSpacePoints(const art::Event&                  e
 
             Triplet hitTriplet(recobHitVec[0],recobHitVec[1],recobHitVec[2]);
 
-            tripletMap[hitTriplet].emplace_back(spacePointPtr.get());
+            tripletMap[hitTriplet].emplace_back(spacePointPtr);
 
             averagePH /= float(numHits);
             averagePT /= float(numHits);
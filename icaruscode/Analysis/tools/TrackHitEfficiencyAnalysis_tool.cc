@@ -28,8 +28,12 @@
 #include "TProfile2D.h"
 #include "TTree.h"
 
+#include "tbb/parallel_for.h"
+#include "tbb/blocked_range.h"
+
 #include <cmath>
 #include <algorithm>
+#include <unordered_set>
 
 namespace TrackHitEfficiencyAnalysis
 {
@@ -418,7 +422,25 @@ void TrackHitEfficiencyAnalysis::fillHistograms(const art::Event& event) const
     using PartToChanToTDCToIDEMap = std::unordered_map<int, ChanToTDCIDEMap>;
     
     PartToChanToTDCToIDEMap partToChanToTDCToIDEMap;
-    
+
+    // It is useful to create a mapping between trackID and MCParticle; built
+    // before the SimChannel scan so the track selection below can be applied
+    // while the structure is filled
+    using TrackIDToMCParticleMap = std::unordered_map<int, const simb::MCParticle*>;
+
+    TrackIDToMCParticleMap trackIDToMCParticleMap;
+    std::unordered_set<int> selectedTrackIDs;
+
+    for(const auto& mcParticle : *mcParticleHandle)
+    {
+        trackIDToMCParticleMap[mcParticle.TrackId()] = &mcParticle;
+
+        // Looking for primary muons (e.g. CR Tracks) - same selection as the
+        // accumulation loop, so deposits from anything else never enter the
+        // structure and channels with no selected activity are never touched
+        if (fabs(mcParticle.PdgCode()) == 13 && mcParticle.Process() == "primary") selectedTrackIDs.insert(mcParticle.TrackId());
+    }
+
     // Build out the above data structure
     for(const auto& simChannel : *simChannelHandle)
     {
@@ -429,14 +451,32 @@ void TrackHitEfficiencyAnalysis::fillHistograms(const art::Event& event) const
             for(const auto& ide : tdcide.second) //chanToTDCToIDEMap[simChannel.Channel()][tdcide.first] = ide;
             {
                 if (ide.energy < fSimChannelMinEnergy) continue;
-                
+
+                if (!selectedTrackIDs.count(ide.trackID)) continue;
+
                 partToChanToTDCToIDEMap[ide.trackID][channel].emplace_back(tdcide.first,&ide);
-                
+
                 if (ide.energy < std::numeric_limits<float>::epsilon()) mf::LogDebug("SpacePointAnalysis") << ">> epsilon simchan deposited energy: " << ide.energy << std::endl;
             }
         }
     }
-    
+
+    // Time order each channel's TDC/IDE vector once, up front, instead of copying
+    // and re-sorting it in the accumulation loop below. The sorts are independent
+    // of each other so they can be farmed out
+    std::vector<TickTDCIDEVec*> tdcIDEVecPtrVec;
+
+    for(auto& partToChanInfo : partToChanToTDCToIDEMap)
+        for(auto& chanToTDCToIDEMap : partToChanInfo.second) tdcIDEVecPtrVec.push_back(&chanToTDCToIDEMap.second);
+
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, tdcIDEVecPtrVec.size()),
+        [&tdcIDEVecPtrVec](const tbb::blocked_range<size_t>& range)
+        {
+            for(size_t idx = range.begin(); idx < range.end(); idx++)
+                std::sort(tdcIDEVecPtrVec[idx]->begin(),tdcIDEVecPtrVec[idx]->end(),[](const auto& left, const auto& right){return left.first < right.first;});
+        }
+    );
+
     // what needs to be done?
     // First we define a straightforward channel to Wire map so we can look up a given
     // channel's Wire data as we loop over SimChannels.
@@ -484,14 +524,6 @@ void TrackHitEfficiencyAnalysis::fillHistograms(const art::Event& event) const
         for(const auto& hit : *hitHandle) channelToHitVec[hit.Channel()].push_back(&hit);
     }
     
-    // It is useful to create a mapping between trackID and MCParticle
-    using TrackIDToMCParticleMap = std::unordered_map<int, const simb::MCParticle*>;
-    
-    TrackIDToMCParticleMap trackIDToMCParticleMap;
-    
-    for(const auto& mcParticle : *mcParticleHandle)
-      trackIDToMCParticleMap[mcParticle.TrackId()] = &mcParticle;
-    
     const lariov::ChannelStatusProvider& chanFilt = art::ServiceHandle<lariov::ChannelStatusService>()->GetProvider();
     
     std::vector<int> nSimChannelHitVec  = {0,0,0};
@@ -571,16 +603,15 @@ void TrackHitEfficiencyAnalysis::fillHistograms(const art::Event& event) const
                 //            }
             }
         
-            TickTDCIDEVec  tdcToIDEVec = chanToTDCToIDEMap.second;
-            float          totalElectrons(0.);
-            float          maxElectrons(0.);
-            unsigned short maxElectronsTDC(0);
-            int            nMatchedWires(0);
-            int            nMatchedHits(0);
-
-            // Make sure the vector is time ordered
-            std::sort(tdcToIDEVec.begin(),tdcToIDEVec.end(),[](const auto& left, const auto& right){return left.first < right.first;});
-        
+            // The vector was time ordered up front, so it can be used in place
+            // rather than copied and sorted for every channel
+            const TickTDCIDEVec& tdcToIDEVec = chanToTDCToIDEMap.second;
+            float                totalElectrons(0.);
+            float                maxElectrons(0.);
+            unsigned short       maxElectronsTDC(0);
+            int                  nMatchedWires(0);
+            int                  nMatchedHits(0);
+
             // The below try-catch block may no longer be necessary
             // Decode the channel and make sure we have a valid one
             std::vector<geo::WireID> wids = fGeometry->ChannelToWire(chanToTDCToIDEMap.first);
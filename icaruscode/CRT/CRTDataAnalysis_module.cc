@@ -59,6 +59,7 @@
 #include "sbnobj/ICARUS/CRT/CRTData.hh"
 #include "sbnobj/Common/CRT/CRTHit.hh"
 #include "icaruscode/CRT/CRTUtils/CRTCommonUtils.h"
+#include "icaruscode/Utilities/ColumnarTreeExport.h"
 
 #include "icaruscode/Decode/DecoderTools/IDecoder.h"
 #include "icaruscode/Decode/ChannelMapping/IICARUSChannelMap.h"
@@ -119,6 +120,12 @@ namespace crt {
 	Name("CrtWindow"),
 	  Comment("window for looking data [ns]")
 	  };
+
+      fhicl::Atom<std::string> ColumnarExportDir {
+	Name("ColumnarExportDir"),
+	  Comment("if not empty, export the ntuples as NumPy columns into this directory at end of job"),
+	  ""
+	  };
     }; // Config
     
     using Parameters = art::EDAnalyzer::Table<Config>;
@@ -134,6 +141,7 @@ namespace crt {
     virtual void beginJob() override;
     virtual void beginRun(const art::Run& run) override;
     virtual void analyze (const art::Event& event) override;
+    virtual void endJob() override;
 
     //void reconfigure(fhicl::ParameterSet const & p);
   private:
@@ -153,6 +161,7 @@ namespace crt {
     double fQSlope;         ///< Pedestal slope of SiPMs [ADC/photon]
     double fPEThresh;       ///< threshold[PE] above which charge amplitudes used in hit reco
     uint64_t fCrtWindow;    ///< Looking data window within trigger timestamp [ns]
+    std::string fColumnarExportDir; ///< if not empty, export the ntuples as NumPy columns there
 
     static map<int, vector<pair<int,int>>> fFebMap;
 
@@ -246,6 +255,7 @@ namespace crt {
     , fQSlope(config().QSlope())
     , fPEThresh(config().PEThresh())
     , fCrtWindow(config().CrtWindow())
+    , fColumnarExportDir(config().ColumnarExportDir())
     , fCrtutils(new CRTCommonUtils())
       
   {
@@ -525,8 +535,16 @@ namespace crt {
 
 
   } // CRTDataAnalysis::analyze()
-  
-  
+
+  void CRTDataAnalysis::endJob()
+  {
+    if (fColumnarExportDir.empty()) return;
+    icarus::ns::util::ColumnarTreeExport exporter { fColumnarExportDir };
+    if (fDAQNtuple) exporter.exportTree(*fDAQNtuple, fDAQNtuple->GetName());
+    if (fHitNtuple) exporter.exportTree(*fHitNtuple, fHitNtuple->GetName());
+  } // CRTDataAnalysis::endJob()
+
+
   DEFINE_ART_MODULE(CRTDataAnalysis)
 
 } // namespace crt
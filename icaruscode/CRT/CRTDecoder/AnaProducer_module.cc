@@ -37,6 +37,7 @@
 #include "icaruscode/CRT/CRTDecoder/CrtCalTree.h"
 #include "icaruscode/CRT/CRTDecoder/CRTTiming.h"
 #include "icaruscode/CRT/CRTDecoder/CRTRawTree.h"
+#include "icaruscode/CRT/CRTDecoder/CRTColumnStore.h"
 
 using std::vector;
 using std::map;
@@ -81,6 +82,12 @@ public:
          Comment("CRT layer inner (i) or outer (o)")
          };
 
+       fhicl::Atom<std::string> ColumnDir {
+         Name("columnDir"),
+         Comment("directory for the columnar binary sidecar of the anaTree (empty: don't write it)"),
+         ""
+         };
+
        fhicl::Sequence<uint8_t> MacsNI {
          Name("macsNI"),
          Comment("mac addresses for each FEB in the north, inner daisychain")
@@ -115,6 +122,7 @@ private:
    bool    pCalibrate;
    vector<uint8_t> pMacs;
    float   pPeThresh;
+   string  pColumnDir;
 
    map<uint8_t,vector<TH1F*>*> fMacToHistos;
    map<uint8_t,vector<TH1F*>*> fMacToPEHistos;
@@ -196,8 +204,9 @@ icarus::crt::AnaProducer::AnaProducer(Parameters const& config)
   : EDAnalyzer(config), 
     pFile(config().CalFile()), 
     pCalibrate(config().Calibrate()), 
-    //pMacs(config().Macs()), 
+    //pMacs(config().Macs()),
     pPeThresh(config().PeThresh()),
+    pColumnDir(config().ColumnDir()),
     fRegion(config().Region()),
     fLayer(config().Layer())
 {
@@ -534,7 +543,7 @@ void icarus::crt::AnaProducer::endJob(){
 	std::cout << "initiallizing time utility" << std::endl;
 	icarus::crt::CRTRawTree traw(fRawTree);
 	icarus::crt::CRTTiming time(traw);
-	const map<size_t,size_t>* sortedToRaw = time.GetOrderedToRawMap();
+	const vector<size_t>* sortedToRaw = time.GetOrderedToRawMap();
 	std::cout << "done. sorted through " << sortedToRaw->size() << " entries" << std::endl;
 	if(sortedToRaw->size()!=nRaw)
 		std::cout << "WARNING: sort map and rawTree are of different size!" << std::endl;
@@ -542,6 +551,12 @@ void icarus::crt::AnaProducer::endJob(){
 	//time.DumpRawTimes(0);
 	//time.DumpSortedTimes(0);
 
+	//optionally mirror the anaTree rows into the columnar binary sidecar,
+	//one memory-mappable array per variable per FEB (see CRTColumnStore.h):
+	//the timing correlation downstream reads those with CRTColumnReader
+	icarus::crt::CRTColumnWriter* colWriter = 0;
+	if(!pColumnDir.empty()) colWriter = new CRTColumnWriter(pColumnDir);
+
 	std::cout << "filling AnaTree..." << std::endl;
 	for(size_t iraw=0; iraw<nRaw; iraw++) {
 		//if(sortedToRaw->find(iraw)==sortedToRaw->end()) {
@@ -584,7 +599,17 @@ void icarus::crt::AnaProducer::endJob(){
 		if(fMaxPE<pPeThresh) fIsNoise = true;
 
 		fAnaTree->Fill();
-	}//end 
+		if(colWriter)
+			colWriter->Fill(fMac5,fT0,fMaxChan,fMaxPE,fTotPE,
+			                fNChanAbove,fIsNoise,fPollRate,fInstRate,fPE);
+	}//end
+
+	if(colWriter) {
+		std::cout << "writing columnar sidecar to " << pColumnDir << std::endl;
+		colWriter->Write();
+		delete colWriter;
+	}
+
 	std::cout << "done" << std::endl;
 
 }
@@ -0,0 +1,208 @@
+#ifndef CRT_COLUMN_STORE_CC
+#define CRT_COLUMN_STORE_CC
+
+#include "icaruscode/CRT/CRTDecoder/CRTColumnStore.h"
+
+#include <fstream>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+using namespace icarus::crt;
+
+// ----- writer -----
+
+CRTColumnWriter::CRTColumnWriter(std::string dir) {
+	fDir = dir;
+}
+
+void CRTColumnWriter::Fill(uint8_t mac, uint64_t t0, uint8_t maxChan,
+                           float maxPE, float totPE, uint8_t nAbove,
+                           bool isNoise, float pollRate, float instRate,
+                           const float* pe) {
+
+	FebColumns& cols = fFebs[mac];
+	cols.t0.push_back(t0);
+	cols.maxChan.push_back(maxChan);
+	cols.maxPE.push_back(maxPE);
+	cols.totPE.push_back(totPE);
+	cols.nAbove.push_back(nAbove);
+	cols.isNoise.push_back(isNoise ? 1 : 0);
+	cols.pollRate.push_back(pollRate);
+	cols.instRate.push_back(instRate);
+	for(size_t ch=0; ch<32; ch++) cols.pe.push_back(pe[ch]);
+}
+
+void CRTColumnWriter::WriteColumn(uint8_t mac, std::string var,
+                                  const void* data, size_t bytes) const {
+
+	std::string path = fDir+"/mac"+std::to_string(mac)+"_"+var+".col";
+	std::ofstream out(path, std::ios::binary|std::ios::trunc);
+	if(!out.is_open()) {
+		std::cout << "ERROR in CRTColumnWriter::WriteColumn: cannot open "
+		          << path << std::endl;
+		return;
+	}
+	out.write((const char*)data, bytes);
+}
+
+void CRTColumnWriter::Write() {
+
+	for(auto const& feb : fFebs) {
+		uint8_t mac = feb.first;
+		const FebColumns& c = feb.second;
+		WriteColumn(mac, "t0",       c.t0.data(),       c.t0.size()*sizeof(uint64_t));
+		WriteColumn(mac, "maxChan",  c.maxChan.data(),  c.maxChan.size());
+		WriteColumn(mac, "maxPE",    c.maxPE.data(),    c.maxPE.size()*sizeof(float));
+		WriteColumn(mac, "totPE",    c.totPE.data(),    c.totPE.size()*sizeof(float));
+		WriteColumn(mac, "nAbove",   c.nAbove.data(),   c.nAbove.size());
+		WriteColumn(mac, "isNoise",  c.isNoise.data(),  c.isNoise.size());
+		WriteColumn(mac, "pollRate", c.pollRate.data(), c.pollRate.size()*sizeof(float));
+		WriteColumn(mac, "instRate", c.instRate.data(), c.instRate.size()*sizeof(float));
+		WriteColumn(mac, "pe",       c.pe.data(),       c.pe.size()*sizeof(float));
+		std::cout << "wrote " << c.t0.size() << " rows of columns for mac5 "
+		          << (short)mac << std::endl;
+	}
+}
+
+size_t CRTColumnWriter::GetNFebs() const {
+	return fFebs.size();
+}
+
+// ----- reader -----
+
+CRTColumnReader::CRTColumnReader(std::string dir, uint8_t mac) {
+	fDir = dir;
+	fMac5 = mac;
+	fNEntries = 0;
+
+	//t0 is mapped first and fixes the row count the other columns must match
+	fT0 = MapColumn("t0", sizeof(uint64_t), 1);
+	fNEntries = fT0.bytes/sizeof(uint64_t);
+
+	fMaxChan  = MapColumn("maxChan",  sizeof(uint8_t), 1);
+	fMaxPE    = MapColumn("maxPE",    sizeof(float),   1);
+	fTotPE    = MapColumn("totPE",    sizeof(float),   1);
+	fNAbove   = MapColumn("nAbove",   sizeof(uint8_t), 1);
+	fIsNoise  = MapColumn("isNoise",  sizeof(uint8_t), 1);
+	fPollRate = MapColumn("pollRate", sizeof(float),   1);
+	fInstRate = MapColumn("instRate", sizeof(float),   1);
+	fPE       = MapColumn("pe",       sizeof(float),   32);
+}
+
+CRTColumnReader::~CRTColumnReader() {
+	Unmap(fT0);
+	Unmap(fMaxChan);
+	Unmap(fMaxPE);
+	Unmap(fTotPE);
+	Unmap(fNAbove);
+	Unmap(fIsNoise);
+	Unmap(fPollRate);
+	Unmap(fInstRate);
+	Unmap(fPE);
+}
+
+CRTColumnReader::Column CRTColumnReader::MapColumn(std::string var,
+                                                   size_t elemSize,
+                                                   size_t elemPerRow) {
+
+	Column col;
+	std::string path = fDir+"/mac"+std::to_string(fMac5)+"_"+var+".col";
+
+	int fd = open(path.c_str(), O_RDONLY);
+	if(fd < 0) {
+		std::cout << "ERROR in CRTColumnReader::MapColumn: cannot open "
+		          << path << std::endl;
+		return col;
+	}
+
+	struct stat st;
+	if(fstat(fd, &st) != 0 || st.st_size == 0) {
+		std::cout << "ERROR in CRTColumnReader::MapColumn: cannot stat "
+		          << path << std::endl;
+		close(fd);
+		return col;
+	}
+
+	if(fNEntries != 0 &&
+	   (size_t)st.st_size != fNEntries*elemSize*elemPerRow) {
+		std::cout << "ERROR in CRTColumnReader::MapColumn: " << path
+		          << " size does not match the t0 column!" << std::endl;
+		close(fd);
+		return col;
+	}
+
+	void* data = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd); //the mapping keeps its own reference
+	if(data == MAP_FAILED) {
+		std::cout << "ERROR in CRTColumnReader::MapColumn: mmap failed for "
+		          << path << std::endl;
+		return col;
+	}
+
+	col.data = data;
+	col.bytes = st.st_size;
+	return col;
+}
+
+void CRTColumnReader::Unmap(Column& col) {
+	if(col.data != nullptr) munmap((void*)col.data, col.bytes);
+	col.data = nullptr;
+	col.bytes = 0;
+}
+
+size_t CRTColumnReader::GetNEntries() const {
+	return fNEntries;
+}
+
+uint8_t CRTColumnReader::Mac5() const {
+	return fMac5;
+}
+
+uint64_t CRTColumnReader::GetAbsTime(size_t ientry) const {
+	if(ientry >= fNEntries) {
+		std::cout << "ERROR in CRTColumnReader::GetAbsTime: entry out of range" << std::endl;
+		return UINT64_MAX;
+	}
+	return ((const uint64_t*)fT0.data)[ientry];
+}
+
+uint64_t CRTColumnReader::T0(size_t ientry) const {
+	return ((const uint64_t*)fT0.data)[ientry];
+}
+
+uint8_t CRTColumnReader::MaxChan(size_t ientry) const {
+	return ((const uint8_t*)fMaxChan.data)[ientry];
+}
+
+float CRTColumnReader::MaxPE(size_t ientry) const {
+	return ((const float*)fMaxPE.data)[ientry];
+}
+
+float CRTColumnReader::TotPE(size_t ientry) const {
+	return ((const float*)fTotPE.data)[ientry];
+}
+
+uint8_t CRTColumnReader::NChanAbove(size_t ientry) const {
+	return ((const uint8_t*)fNAbove.data)[ientry];
+}
+
+bool CRTColumnReader::IsNoise(size_t ientry) const {
+	return ((const uint8_t*)fIsNoise.data)[ientry] != 0;
+}
+
+float CRTColumnReader::PollRate(size_t ientry) const {
+	return ((const float*)fPollRate.data)[ientry];
+}
+
+float CRTColumnReader::InstRate(size_t ientry) const {
+	return ((const float*)fInstRate.data)[ientry];
+}
+
+float CRTColumnReader::PE(size_t ientry, uint8_t chan) const {
+	return ((const float*)fPE.data)[ientry*32+chan];
+}
+
+#endif
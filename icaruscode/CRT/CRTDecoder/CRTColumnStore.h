@@ -0,0 +1,97 @@
+#ifndef CRT_COLUMN_STORE_H
+#define CRT_COLUMN_STORE_H
+
+#include <cstdint>
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <map>
+
+namespace icarus {
+ namespace crt {
+	class CRTColumnWriter;
+	class CRTColumnReader;
+ }
+}
+
+//writes the preprocessed (anaTree) variables as one flat binary array per
+//variable, per FEB: <dir>/mac<mac5>_<var>.col, values in host byte order.
+//the arrays can be memory mapped back with CRTColumnReader so that the
+//timing correlation scans are sequential reads instead of random TTree access
+class icarus::crt::CRTColumnWriter {
+
+ public:
+	CRTColumnWriter(std::string dir);
+	void      Fill(uint8_t mac, uint64_t t0, uint8_t maxChan, float maxPE,
+	               float totPE, uint8_t nAbove, bool isNoise,
+	               float pollRate, float instRate, const float* pe);
+	void      Write();
+	size_t    GetNFebs() const;
+
+ private:
+	//columns accumulated for one FEB, in fill order
+	struct FebColumns {
+		std::vector<uint64_t> t0;
+		std::vector<uint8_t>  maxChan;
+		std::vector<float>    maxPE;
+		std::vector<float>    totPE;
+		std::vector<uint8_t>  nAbove;
+		std::vector<uint8_t>  isNoise;
+		std::vector<float>    pollRate;
+		std::vector<float>    instRate;
+		std::vector<float>    pe; //32 values per row
+	};
+
+	void      WriteColumn(uint8_t mac, std::string var,
+	                      const void* data, size_t bytes) const;
+
+	std::string fDir;
+	std::map<uint8_t,FebColumns> fFebs;
+};
+
+//memory maps the columns of one FEB written by CRTColumnWriter; accessors
+//index rows directly into the mapped arrays (no entry loading, no copies)
+class icarus::crt::CRTColumnReader {
+
+ public:
+	CRTColumnReader(std::string dir, uint8_t mac);
+	~CRTColumnReader();
+	size_t    GetNEntries() const;
+	uint8_t   Mac5() const;
+	uint64_t  GetAbsTime(size_t ientry) const;
+	uint64_t  T0(size_t ientry) const;
+	uint8_t   MaxChan(size_t ientry) const;
+	float     MaxPE(size_t ientry) const;
+	float     TotPE(size_t ientry) const;
+	uint8_t   NChanAbove(size_t ientry) const;
+	bool      IsNoise(size_t ientry) const;
+	float     PollRate(size_t ientry) const;
+	float     InstRate(size_t ientry) const;
+	float     PE(size_t ientry, uint8_t chan) const;
+
+ private:
+	struct Column {
+		const void* data = nullptr;
+		size_t      bytes = 0;
+	};
+
+	Column    MapColumn(std::string var, size_t elemSize, size_t elemPerRow);
+	void      Unmap(Column& col);
+
+	std::string fDir;
+	uint8_t   fMac5;
+	size_t    fNEntries;
+
+	Column    fT0;
+	Column    fMaxChan;
+	Column    fMaxPE;
+	Column    fTotPE;
+	Column    fNAbove;
+	Column    fIsNoise;
+	Column    fPollRate;
+	Column    fInstRate;
+	Column    fPE;
+};
+
+#endif
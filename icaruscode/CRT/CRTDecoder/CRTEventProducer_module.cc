@@ -72,6 +72,7 @@ namespace crt {
 
    std::string fInFile;
    float       fTimeWindow;
+   TFile*      fInputFile = nullptr;
    icarus::crt::CRTPreProcessTree* fAnaTree;
 
    std::map<size_t,size_t> fEventEntryStart;
@@ -109,9 +110,12 @@ namespace crt {
 
   void CRTEventProducer::beginJob()
   {
+	//the file and the tree reader stay open for the whole job: reopening
+	//them (and rebinding all the branches) once per art event dominated
+	//the standalone stream jobs which chew through hours of readout
 	std::cout << "opening file " << fInFile << std::endl;
-	TFile fin(fInFile.c_str());
-	TTree* tree=(TTree*)fin.FindObjectAny("anaTree");
+	fInputFile = new TFile(fInFile.c_str());
+	TTree* tree=(TTree*)fInputFile->FindObjectAny("anaTree");
 	if(tree==nullptr) std::cout << "anaTree not found!" << std::endl;
 	fAnaTree = new icarus::crt::CRTPreProcessTree(tree);
 
@@ -142,23 +146,17 @@ namespace crt {
 	if(fEventEntryEnd.size()!=fEventEntryStart.size())
 		std::cout << "event map start/end size mismatch!" << std::endl;
 
-	fin.Close();
-	delete fAnaTree;
-
   } // CRTEventProducer::beginJob()
  
   void CRTEventProducer::produce(art::Event & event)
   {
-    TFile fin(fInFile.c_str());
-    TTree* tree=(TTree*)fin.FindObjectAny("anaTree");
-    if(tree==nullptr) std::cout << "anaTree not found!" << std::endl;
-    fAnaTree = new icarus::crt::CRTPreProcessTree(tree);
-
     std::unique_ptr< std::vector<icarus::crt::CRTData> > crtdata( new std::vector<icarus::crt::CRTData>);
 
     size_t eveId = (size_t) event.event();
     std::cout << "processing event " << eveId << " with " << fEventEntryEnd[eveId]+1-fEventEntryStart[eveId] << " triggers" << std::endl;
 
+    crtdata->reserve(fEventEntryEnd[eveId]+1-fEventEntryStart[eveId]);
+
     int entry=0;
     for(size_t ientry=fEventEntryStart[eveId]; ientry<=fEventEntryEnd[eveId]; ientry++){
 	fAnaTree->Load(ientry);
@@ -179,15 +177,17 @@ namespace crt {
 
     }//for entries in time slice
 
-    delete fAnaTree;
-    fin.Close();
-
     event.put(std::move(crtdata));
 
   } // CRTEventProducer::produce()
 
   void CRTEventProducer::endJob()
   {
+	delete fAnaTree;
+	if(fInputFile!=nullptr){
+		fInputFile->Close();
+		delete fInputFile;
+	}
 
   } // CRTEventProducer::endJob()
 
@@ -62,7 +62,7 @@ int main(int argc, char *argv[]) {
 	icarus::crt::CRTPreProcessTree cpt(intree);
 	icarus::crt::CRTTiming ct(cpt);
 
-	const map<size_t,size_t>* sortedToRaw = ct.GetOrderedToRawMap();
+	const vector<size_t>* sortedToRaw = ct.GetOrderedToRawMap();
 	std::cout << "done sorting " << sortedToRaw->size() << " entries" << std::endl;
 
 
@@ -8,8 +8,10 @@ using namespace icarus::crt;
 
 CRTPreProcessTree::CRTPreProcessTree(TTree* tr) {
 	fTree = tr;
-        //fTree->SetMaxVirtualSize(16e9);
-        fTree->LoadBaskets(16e9);
+        //calibration runs no longer fit in memory: use a bounded read cache
+        //instead of loading every basket up front
+        //fTree->LoadBaskets(16e9);
+        fTree->SetCacheSize(200e6);
 	Init();
 }
 
@@ -43,7 +45,9 @@ uint64_t CRTPreProcessTree::GetAbsTime(size_t ientry) const {
                 return UINT64_MAX;
         }
 
-        fTree->GetEntry(ientry);
+        //time ordering calls this once per entry: stream only the t0
+        //baskets instead of decompressing every branch
+        b_T0->GetEntry(ientry);
         return (uint64_t)fT0;
 }
 
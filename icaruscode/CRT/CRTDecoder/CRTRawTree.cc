@@ -8,8 +8,10 @@ using namespace icarus::crt;
 CRTRawTree::CRTRawTree(TTree* tr){
 
 	fTree = tr;
-	//fTree->SetMaxVirtualSize(16e9);
-	fTree->LoadBaskets(16e9);
+	//calibration runs no longer fit in memory: use a bounded read cache
+	//instead of loading every basket up front
+	//fTree->LoadBaskets(16e9);
+	fTree->SetCacheSize(200e6);
 	Init();
 }
 
@@ -47,7 +49,9 @@ uint64_t CRTRawTree::GetAbsTime(size_t ientry) const {
 		return UINT64_MAX;
 	}
 
-	fTree->GetEntry(ientry);
+	//time ordering calls this once per entry: stream only the timestamp
+	//baskets instead of decompressing every branch
+	b_Fragment_timestamp->GetEntry(ientry);
 	return (uint64_t)fFragment_timestamp;
 }
 
@@ -94,10 +98,10 @@ uint64_t CRTRawTree::GetInterval(size_t ientry1, size_t ientry2) const {
         }
 
 	uint64_t tprev, tnext;
-        fTree->GetEntry(ientry1);
+        b_Fragment_timestamp->GetEntry(ientry1);
         tprev = fFragment_timestamp;
 
-        fTree->GetEntry(ientry2);
+        b_Fragment_timestamp->GetEntry(ientry2);
 	tnext = fFragment_timestamp;
 
 	if(tnext < tprev){
@@ -10,6 +10,7 @@ using namespace icarus::crt;
 CRTTiming::CRTTiming(CRTPreProcessTree& pre) {
         fPre = &pre;
 	fRaw = 0;
+	fCols = 0;
         fHasSort = false;
 	fType='p';
 	fNEntries = fPre->GetNEntries();
@@ -18,19 +19,32 @@ CRTTiming::CRTTiming(CRTPreProcessTree& pre) {
 CRTTiming::CRTTiming(CRTRawTree& raw) {
 	fRaw = &raw;
 	fPre = 0;
+	fCols = 0;
 	fHasSort = false;
 	fType = 'r';
 	fNEntries = fRaw->GetNEntries();
 }
 
+CRTTiming::CRTTiming(CRTColumnReader& cols) {
+	fCols = &cols;
+	fRaw = 0;
+	fPre = 0;
+	fHasSort = false;
+	fType = 'c';
+	fNEntries = fCols->GetNEntries();
+}
+
 void CRTTiming::TimeOrder() {
 
 	vector<pair<size_t,uint64_t>> pairs;
+	pairs.reserve(fNEntries);
 
 	for(size_t ientry=0; ientry<fNEntries; ientry++) {
 		uint64_t t0=0;
 		if(fType=='p') t0 = fPre->GetAbsTime(ientry);
 		if(fType=='r') t0 = fRaw->GetAbsTime(ientry);
+		//mapped column: a sequential scan of the t0 array, no tree access
+		if(fType=='c') t0 = fCols->GetAbsTime(ientry);
 		pairs.push_back(make_pair(ientry,t0));
 	}
 
@@ -38,6 +52,8 @@ void CRTTiming::TimeOrder() {
         	return a.second < b.second;   
         });
 
+	fRawToOrdered.resize(fNEntries);
+	fOrderedToRaw.resize(fNEntries);
 	for(size_t ientry=0; ientry<fNEntries; ientry++) {
 		fRawToOrdered[pairs[ientry].first] = ientry;
 		fOrderedToRaw[ientry] = pairs[ientry].first;
@@ -48,14 +64,14 @@ void CRTTiming::TimeOrder() {
 	return;
 }
 
-const map<size_t,size_t>* CRTTiming::GetRawToOrderedMap() {
+const vector<size_t>* CRTTiming::GetRawToOrderedMap() {
 
 	if(!fHasSort) TimeOrder();
 
 	return &fRawToOrdered;
 }
 
-const map<size_t,size_t>* CRTTiming::GetOrderedToRawMap() {
+const vector<size_t>* CRTTiming::GetOrderedToRawMap() {
 
         if(!fHasSort) TimeOrder();
 
@@ -68,6 +84,7 @@ void CRTTiming::DumpSortedTimes(size_t nmax=0) {
 
 		if(fType=='p') std::cout << fPre->GetAbsTime(fOrderedToRaw[i]) << std::endl;
 		if(fType=='r') std::cout << fRaw->GetAbsTime(fOrderedToRaw[i]) << std::endl;
+		if(fType=='c') std::cout << fCols->GetAbsTime(fOrderedToRaw[i]) << std::endl;
 
 	}
 }
@@ -78,6 +95,7 @@ void CRTTiming::DumpRawTimes(size_t nmax=0) {
 
 		if(fType=='p') std::cout << fPre->GetAbsTime(i) << std::endl;
                 if(fType=='r') std::cout << fRaw->GetAbsTime(i) << std::endl;
+                if(fType=='c') std::cout << fCols->GetAbsTime(i) << std::endl;
 
         }
 }
@@ -12,6 +12,7 @@
 
 #include "icaruscode/CRT/CRTDecoder/CRTRawTree.h"
 #include "icaruscode/CRT/CRTDecoder/CRTPreProcessTree.h"
+#include "icaruscode/CRT/CRTDecoder/CRTColumnStore.h"
 
 using std::map;
 using std::vector;
@@ -29,17 +30,21 @@ class icarus::crt::CRTTiming {
   public:
 	explicit CRTTiming(CRTPreProcessTree &raw);
 	explicit CRTTiming(CRTRawTree &raw);
+	explicit CRTTiming(CRTColumnReader &cols);
 	void TimeOrder();
-	const map<size_t,size_t>* GetRawToOrderedMap();
-	const map<size_t,size_t>* GetOrderedToRawMap();
+	const vector<size_t>* GetRawToOrderedMap();
+	const vector<size_t>* GetOrderedToRawMap();
 	void DumpSortedTimes(size_t nmax);
 	void DumpRawTimes(size_t nmax);
 
   private:
 	const CRTRawTree* fRaw;
 	const CRTPreProcessTree* fPre;
-	map<size_t,size_t> fRawToOrdered;	
-	map<size_t,size_t> fOrderedToRaw;
+	const CRTColumnReader* fCols;
+	//indexed by raw (sorted) entry number: maps stored one node per entry
+	//and did not fit in memory for large runs
+	vector<size_t> fRawToOrdered;
+	vector<size_t> fOrderedToRaw;
 	bool fHasSort;
 	char fType;
 	size_t fNEntries;
@@ -39,6 +39,16 @@ CrtCal::CrtCal(const vector<TH1F*>* histos) : fHistos(histos) {
 
 	fChanStats    = new long[32];
 
+	//fit workspace objects are created lazily on first use
+	fPedGausFit  = nullptr;
+	fPeakGausFit = nullptr;
+	fGainLinFit  = nullptr;
+	fLangausFit  = nullptr;
+	fSpectrum    = nullptr;
+	fPedCanvas   = nullptr;
+	fSpecCanvas  = nullptr;
+	fGainCanvas  = nullptr;
+
         fPeakNorm     = new float*[32];
         fPeakNormErr  = new float*[32];
         fPeakSigma    = new float*[32];
@@ -176,6 +186,15 @@ CrtCal::~CrtCal(){
 	delete[] fLangausGaussSigmaErr;
 	delete[] fLangausXsqr;
 	delete[] fLangausNdf;
+
+	delete fPedGausFit;
+	delete fPeakGausFit;
+	delete fGainLinFit;
+	delete fLangausFit;
+	delete fSpectrum;
+	delete fPedCanvas;
+	delete fSpecCanvas;
+	delete fGainCanvas;
 }
 
 void CrtCal::IndexToMacChan(){
@@ -343,23 +362,36 @@ void CrtCal::PedFit(TH1F* h, size_t chan, float* statsarr, bool save=false){
         const int max_val = h->GetMaximum();
         const int max_adc = h->GetBinLowEdge(max_bin);
 
-        //Define fitting function:
-        TF1 *gausfit = new TF1("gausfit","[0]*exp(-0.5*((x-[1])/[2])^2)",max_adc-12,max_adc+12);
+        //Define fitting function (created once, re-ranged for every channel):
+        if(fPedGausFit==nullptr){
+                fPedGausFit = new TF1("gausfit","[0]*exp(-0.5*((x-[1])/[2])^2)",max_adc-12,max_adc+12);
+
+                //Set parameter names:
+                fPedGausFit->SetParName(0,"Constant");
+                fPedGausFit->SetParName(1,"Peak value");
+                fPedGausFit->SetParName(2,"sigma");
+        }
+        TF1 *gausfit = fPedGausFit;
+        gausfit->SetRange(max_adc-12,max_adc+12);
 
-        //Set parameter names:
-        gausfit->SetParName(0,"Constant");
-        gausfit->SetParName(1,"Peak value");
-        gausfit->SetParName(2,"sigma");
+        //seed sigma from the spread of the restricted histogram instead of a
+        //fixed guess so the minimizer starts close and converges in fewer steps
+        float sigmaSeed = h->GetStdDev();
+        if(sigmaSeed<1.0) sigmaSeed=1.0;
+        if(sigmaSeed>50.0) sigmaSeed=50.0;
 
         //Initial guesses for the parameters:
         gausfit->SetParameter(0,max_val);
         gausfit->SetParLimits(0,0.5*max_val,1000*max_val);
         gausfit->SetParameter(1,max_adc);
         gausfit->SetParLimits(1,max_adc-20,max_adc+20);
-        gausfit->SetParameter(2,50.0);//h->GetStdDev());
+        gausfit->SetParameter(2,sigmaSeed);
         gausfit->SetParLimits(2,1,50);
 
-        TCanvas *c = new TCanvas();
+        if(fPedCanvas==nullptr) fPedCanvas = new TCanvas();
+        TCanvas *c = fPedCanvas;
+        c->Clear();
+        c->cd();
         c->SetGrid();
 
         gStyle->Reset("Modern");
@@ -442,8 +474,6 @@ void CrtCal::PedFit(TH1F* h, size_t chan, float* statsarr, bool save=false){
                 img->WriteImage(fname);
 
                 delete img;
-                delete gausfit;
-                delete c;
         }//end save opt
 
         return;// statarr;
@@ -461,10 +491,14 @@ void CrtCal::GainFit(TH1F* h, size_t chan, float** statsarr, bool save){
 	h->GetXaxis()->SetRangeUser(350,700);
 	h->SetStats(kFALSE);
 
-	TCanvas* cspec = new TCanvas();
+	if(fSpecCanvas==nullptr) fSpecCanvas = new TCanvas();
+	TCanvas* cspec = fSpecCanvas;
+	cspec->Clear();
+	cspec->cd();
 	h->Draw("e0hist");
 
-        TSpectrum *s = new TSpectrum();
+        if(fSpectrum==nullptr) fSpectrum = new TSpectrum();
+        TSpectrum *s = fSpectrum;
         //args=source histo, sigma of searched peaks, options, threshold
         int nPeak = s->Search(h,tSpectrumSigma,"",tSpectrumThreshold);
 	//std::cout << "found " << nPeak << " peaks to fit" << std::endl;
@@ -555,8 +589,10 @@ void CrtCal::GainFit(TH1F* h, size_t chan, float** statsarr, bool save){
         //fit peaks about TSpectrum values
         for (int g=0 ; g<nPeak&&g<(int)nPeakMax; g++)
         {
-                //initial gaus fit to peak from TSpectrum
-                TF1 *gfit = new TF1("gfit","gaus",y[g]-20,y[g]+20);
+                //initial gaus fit to peak from TSpectrum (one reusable function)
+                if(fPeakGausFit==nullptr) fPeakGausFit = new TF1("gfit","gaus",y[g]-20,y[g]+20);
+                TF1 *gfit = fPeakGausFit;
+                gfit->SetRange(y[g]-20,y[g]+20);
                 gfit->SetParameter(0,h->GetBinContent(h->FindBin(y[g])));//200);
                 gfit->SetParameter(1,y[g]);
                 gfit->SetParameter(2,12);
@@ -622,12 +658,18 @@ void CrtCal::GainFit(TH1F* h, size_t chan, float** statsarr, bool save){
         //graph of adc(y) vs. photo-peak number (x)
         TGraphErrors* gr_mean = new TGraphErrors(gg,gx,gy,0,gey);
 
-        //linear fit function
-        TF1 *fit = new TF1("fit","[0] + [1]*x",gx[0]-0.25,gx[gg-1]+0.25);
+        //linear fit function (created once, re-ranged per channel)
+        if(fGainLinFit==nullptr){
+                fGainLinFit = new TF1("fit","[0] + [1]*x",gx[0]-0.25,gx[gg-1]+0.25);
+
+                //name the gain fit parameters
+                fGainLinFit->SetParName(1,"Gain");
+                fGainLinFit->SetParName(0, "Pedestal");
+        }
+        TF1 *fit = fGainLinFit;
+        fit->SetRange(gx[0]-0.25,gx[gg-1]+0.25);
 
-        //name, initialize gain fit parameters
-        fit->SetParName(1,"Gain");
-        fit->SetParName(0, "Pedestal");
+        //initialize gain fit parameters
         fit->SetParameter(1,gainSeed);
         fit->SetParameter(0,peds[chan]);
         fit->SetParLimits(1,gainSeed-20,gainSeed+20);
@@ -644,6 +686,7 @@ void CrtCal::GainFit(TH1F* h, size_t chan, float** statsarr, bool save){
                 //std::cout << "gain fit X^2 too large...shifting all peaks by 1" << std::endl;
                 chisqr=fit->GetChisquare();
                 for(int i=1; i<gg; i++) gx[i]+=1;
+                delete gr_mean;
                 gr_mean = new TGraphErrors(gg,gx,gy,0,gey);
                 fit->SetRange(gx[0]-0.25,gx[gg-1]+0.25);
                 gr_mean->Fit(fit, "QR");
@@ -651,6 +694,7 @@ void CrtCal::GainFit(TH1F* h, size_t chan, float** statsarr, bool save){
                 else
                 {
                         for(int i=1; i<gg; i++) gx[i]-=2;
+                        delete gr_mean;
                         gr_mean = new TGraphErrors(gg,gx,gy,0,gey);
                         fit->SetRange(gx[0]-0.25,gx[gg-1]+0.25);
                         gr_mean->Fit(fit, "QR");
@@ -658,6 +702,7 @@ void CrtCal::GainFit(TH1F* h, size_t chan, float** statsarr, bool save){
                         else
                         {
                                 for(int i=1; i<gg; i++) gx[i]+=1;
+                                delete gr_mean;
                                 gr_mean = new TGraphErrors(gg,gx,gy,0,gey);
                                 fit->SetRange(gx[0]-0.25,gx[gg-1]+0.25);
                                 gr_mean->Fit(fit, "QR");
@@ -686,7 +731,9 @@ void CrtCal::GainFit(TH1F* h, size_t chan, float** statsarr, bool save){
 
 	//std::cout << "drawing..." << std::endl;
 
-        TCanvas *c2 = new TCanvas();
+        if(fGainCanvas==nullptr) fGainCanvas = new TCanvas();
+        TCanvas *c2 = fGainCanvas;
+        c2->Clear();
         c2->cd();
         c2->SetGrid();
 
@@ -774,14 +821,11 @@ void CrtCal::GainFit(TH1F* h, size_t chan, float** statsarr, bool save){
 
                 //deallocate memory
                 delete img;
-                delete c2;
-		delete cspec;
 		//delete img2;
-                delete gr_mean;
-                delete fit;
-                delete s;
         }
 
+	delete gr_mean;
+
 	//std::cout << "done" << std::endl;
 
         return;// statarr;
@@ -908,22 +952,25 @@ Double_t langaufun(Double_t *x, Double_t *par) {
     //   NDF             returns ndf
  
     Int_t i;
-    Char_t FunName[100];
- 
-    sprintf(FunName,"Fitfcn_%s",his->GetName());
- 
+
 //    TF1 *ffitold = (TF1*)ROOT->GetListOfFunctions()->FindObject(FunName);
 //    if (ffitold) delete ffitold;
- 
-    TF1 *ffit = new TF1(FunName,langaufun,fitrange[0],fitrange[1],4);
+
+    //the convolution function is expensive to build, so one instance is kept
+    //for the lifetime of the board and only re-ranged/re-seeded per channel
+    if (fLangausFit==nullptr) {
+       fLangausFit = new TF1("langaufit",langaufun,fitrange[0],fitrange[1],4);
+       fLangausFit->SetParNames("Width","MP","Area","GSigma");
+    }
+    TF1 *ffit = fLangausFit;
+    ffit->SetRange(fitrange[0],fitrange[1]);
     ffit->SetParameters(startvalues);
-    ffit->SetParNames("Width","MP","Area","GSigma");
- 
+
     for (i=0; i<4; i++) {
        ffit->SetParLimits(i, parlimitslo[i], parlimitshi[i]);
     }
- 
-    his->Fit(FunName,"RB0");   // fit within specified range, use ParLimits, do not plot
+
+    his->Fit(ffit,"RB0");   // fit within specified range, use ParLimits, do not plot
  
     ffit->GetParameters(fitparams);    // obtain fit parameters
     for (i=0; i<4; i++) {
@@ -944,6 +991,15 @@ void CrtCal::langaus_fit(TH1F* h, double& lang_lan_wid, double& lang_lan_wid_err
 	Double_t my_parlimitslo[4] = { 0, 100, 1000, 100 };
 	Double_t my_parlimitshi[4] = { 1000, 10000, 10000000, 1000 };
 
+	//seed MP and area analytically from the spectrum itself (histogram
+	//maximum and integral inside the fit range) so the minimizer starts
+	//close to the answer instead of at fixed guesses
+	h->GetXaxis()->SetRangeUser(my_fitrange[0],my_fitrange[1]);
+	const Double_t mpSeed = h->GetBinCenter(h->GetMaximumBin());
+	const Double_t areaSeed = h->Integral("width");
+	if(mpSeed>my_parlimitslo[1] && mpSeed<my_parlimitshi[1]) my_startvalues[1] = mpSeed;
+	if(areaSeed>my_parlimitslo[2] && areaSeed<my_parlimitshi[2]) my_startvalues[2] = areaSeed;
+
 	//set up receptacles for relevant fit information
 	Double_t my_fitparams[4], my_fiterrors[4], my_ChiSqr; 
 	Int_t my_NDF;
@@ -956,8 +1012,8 @@ void CrtCal::langaus_fit(TH1F* h, double& lang_lan_wid, double& lang_lan_wid_err
 	lang_gauss_sigma = my_fitparams[3]; lang_gauss_sigma_err = my_fiterrors[3];
 	lang_chisq = my_ChiSqr; lang_ndf = my_NDF;
 
-
-	delete my_langaus;
+	//my_langaus points at the reusable workspace function: not deleted here
+	(void) my_langaus;
 }
 
 
@@ -141,6 +141,18 @@ class icarus::crt::CrtCal {
 	int*  fNabove;
 	long* fChanStats;
 
+	//reusable fit workspace: the fit functions, peak searcher and canvases
+	//are created once per board and re-seeded/re-ranged for every channel,
+	//instead of being reallocated for each of the ~10k channels in a run
+	TF1*       fPedGausFit;
+	TF1*       fPeakGausFit;
+	TF1*       fGainLinFit;
+	TF1*       fLangausFit;
+	TSpectrum* fSpectrum;
+	TCanvas*   fPedCanvas;
+	TCanvas*   fSpecCanvas;
+	TCanvas*   fGainCanvas;
+
 	double* fLangausWidth;
 	double* fLangausWidthErr;
 	double* fLangausLandauMP;
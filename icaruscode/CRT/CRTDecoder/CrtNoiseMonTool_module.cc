@@ -59,6 +59,19 @@ private:
   std::map<uint8_t,std::vector<float>> macToRateTop;
   std::map<uint8_t,std::vector<uint64_t>> macToRateTopTime;
 
+  //token-bucket throttling of the kept samples (see analyze()):
+  //each FEB gets MaxSampleRate tokens per second of run time, up to
+  //BurstSamples; a poll is only stored if a token is available, and the
+  //polls dropped in between are folded into the weight of the next stored
+  //sample so the rate histograms stay statistically unbiased
+  float fMaxSampleRate; //max stored samples per FEB per second of run time [Hz]
+  float fBurstSamples;  //bucket capacity [samples]
+  std::map<uint8_t,double> macToTokens;
+  std::map<uint8_t,uint64_t> macToLastRefill;
+  std::map<uint8_t,float> macToPending; //polls seen since the last stored one
+  std::map<uint8_t,std::vector<float>> macToWeightSide;
+  std::map<uint8_t,std::vector<float>> macToWeightTop;
+
   //AA: this list will need to be updated (and perhaps moved to a separate file)
   //  const uint8_t macsWestIn[6]   = {21,19,17,22,23,24};
   //const uint8_t macsWestOut[6]  = {13,11,10,14,15,16};
@@ -100,6 +113,11 @@ icarus::crt::CrtNoiseMonTool::CrtNoiseMonTool(fhicl::ParameterSet const & pset)
   : EDAnalyzer(pset)
 {
 
+  //defaults comfortably above the nominal poll rate: throttling only kicks
+  //in during the high-rate periods where the monitor used to be turned off
+  fMaxSampleRate = pset.get<float>("MaxSampleRate",10.0);
+  fBurstSamples  = pset.get<float>("BurstSamples",100.0);
+
   //this is how you setup/use the TFileService
   //I do this here in the constructor to setup the histogram just once
   //but you can call the TFileService and make new objects from anywhere
@@ -168,18 +186,43 @@ void icarus::crt::CrtNoiseMonTool::analyze(art::Event const & evt) {
     const double   dt      = (hit.this_poll_start-hit.last_poll_start)*1.0e-9; //interval between consecutive polls [s]
     const float    rate    = 1.0e-3*hit.hits_in_poll/dt; //poll-averaged event rate [kHz]
 
+    const bool sideCRT = IsSideCRT(hit);
+
     //avoid processing the same poll multiple times (they all have the same
     //    if(macToRateTime[mac5].size()!=0 && macToRateTime[mac5].back() == runtime) continue;
-    if(IsSideCRT(hit)){
+    if(sideCRT){
       //avoid processing the same poll multiple times (they all have the same
       if(macToRateSideTime[mac5].size()!=0 && macToRateSideTime[mac5].back() == runtime) continue;
-      macToRateSideTime[mac5].push_back(runtime);
-      macToRateSide[mac5].push_back(rate);
     }else{
       //avoid processing the same poll multiple times (they all have the same
       if(macToRateTopTime[mac5].size()!=0 && macToRateTopTime[mac5].back() == runtime) continue;
+    }
+
+    //token bucket: refill with run time, pay one token per stored sample
+    if(macToLastRefill.find(mac5)==macToLastRefill.end()){
+      macToTokens[mac5] = fBurstSamples; //a fresh FEB starts with a full bucket
+      macToLastRefill[mac5] = runtime;
+    }
+    macToTokens[mac5] = std::min((double)fBurstSamples,
+        macToTokens[mac5] + (runtime-macToLastRefill[mac5])*fMaxSampleRate);
+    macToLastRefill[mac5] = runtime;
+    macToPending[mac5] += 1.0;
+
+    if(macToTokens[mac5] < 1.0) continue; //over budget: drop, but it's counted
+    macToTokens[mac5] -= 1.0;
+
+    //the dropped polls ride along as extra weight on this sample
+    const float weight = macToPending[mac5];
+    macToPending[mac5] = 0.0;
+
+    if(sideCRT){
+      macToRateSideTime[mac5].push_back(runtime);
+      macToRateSide[mac5].push_back(rate);
+      macToWeightSide[mac5].push_back(weight);
+    }else{
       macToRateTopTime[mac5].push_back(runtime);
       macToRateTop[mac5].push_back(rate);
+      macToWeightTop[mac5].push_back(weight);
     }
   }
 }//end analyze
@@ -257,16 +300,19 @@ void icarus::crt::CrtNoiseMonTool::endJob(){
       float* rate = new float[n];
       float* time = new float[n];
       float meanRate =0.0;
+      float sumWeight =0.0;
       for(size_t i=0; i<n; i++){
          rate[i] = macToRateSide[mac][i];
 	 time[i] = macToRateSideTime[mac][i];
-	 meanRate+=rate[i];
+	 float w = macToWeightSide[mac][i];
+	 meanRate+=rate[i]*w;
+	 sumWeight+=w;
 
-         h->Fill(rate[i]);
+         h->Fill(rate[i],w); //weight makes up for the throttled-out polls
       }
       std::cout << "mean rate before division: " << meanRate << std::endl;
-      meanRate*=1.0/n;
-      std::cout << "mean rate averaged over " << n << " points: " << meanRate << std::endl;
+      if(sumWeight>0.0) meanRate*=1.0/sumWeight;
+      std::cout << "mean rate averaged over " << sumWeight << " polls (" << n << " stored): " << meanRate << std::endl;
       meanRate*=1.0/30;
 
       std::cout << "relative (to 30kHz) average "+htitle << " = " << meanRate << std::endl;
@@ -309,16 +355,19 @@ void icarus::crt::CrtNoiseMonTool::endJob(){
       float* rate = new float[n];
       float* time = new float[n];
       float meanRate =0.0;
+      float sumWeight =0.0;
       for(size_t i=0; i<n; i++){
          rate[i] = macToRateTop[mac][i];
 	 time[i] = macToRateTopTime[mac][i];
-	 meanRate+=rate[i];
+	 float w = macToWeightTop[mac][i];
+	 meanRate+=rate[i]*w;
+	 sumWeight+=w;
 
-         h->Fill(rate[i]);
+         h->Fill(rate[i],w); //weight makes up for the throttled-out polls
       }
       std::cout << "mean rate before division: " << meanRate << std::endl;
-      meanRate*=1.0/n;
-      std::cout << "mean rate averaged over " << n << " points: " << meanRate << std::endl;
+      if(sumWeight>0.0) meanRate*=1.0/sumWeight;
+      std::cout << "mean rate averaged over " << sumWeight << " polls (" << n << " stored): " << meanRate << std::endl;
       meanRate*=1.0/30;
 
       std::cout << "relative (to 30kHz) average "+htitle << " = " << meanRate << std::endl;
@@ -30,8 +30,11 @@
 #include "sbndaq-artdaq-core/Overlays/FragmentType.hh"
 #include "sbndaq-artdaq-core/Overlays/Common/BernCRTTranslator.hh"
 
+#include "art/Framework/Services/Registry/ServiceHandle.h"
+
 #include "icaruscode/Decode/DecoderTools/IDecoder.h"
 #include "icaruscode/Decode/ChannelMapping/IICARUSChannelMap.h"
+#include "icaruscode/Utilities/ProductSizeAdvisor.h"
 
 #include "sbnobj/ICARUS/CRT/CRTData.hh"
 
@@ -41,6 +44,8 @@
 #include "TH1F.h"
 #include "TNtuple.h"
 
+#include "tbb/parallel_for.h"
+
 #include <memory>
 #include <algorithm>
 #include <cassert>
@@ -77,9 +82,15 @@ private:
   void     CorrectForCableDelay(icarus::crt::BernCRTTranslator & hit);
   bool     IsSideCRT(icarus::crt::BernCRTTranslator & hit);
 
+  // Unpack a single FEB hit into CRT data; each hit is independent of all
+  // the others, so this may be run on several hits concurrently
+  std::vector<icarus::crt::CRTData> DecodeHit(icarus::crt::BernCRTTranslator& hit);
+
   // Declare member data here.
   const icarusDB::IICARUSChannelMap* fChannelMap = nullptr;
 
+  bool fAsyncDecode; ///< whether to decode the hits in concurrent tasks
+
   std::map<uint8_t, int32_t> FEB_delay_side; //<mac5, delay in ns>
   std::map<uint8_t, int32_t> FEB_delay_top;  //<mac5, delay in ns>
 };
@@ -89,6 +100,7 @@ crt::DecoderICARUSCRT::DecoderICARUSCRT(fhicl::ParameterSet const& p)
   : EDProducer{p}
 {
   fChannelMap = art::ServiceHandle<icarusDB::IICARUSChannelMap const>{}.get();
+  fAsyncDecode = p.get<bool>("AsyncDecode", false);
   produces< std::vector<icarus::crt::CRTData> >();
 
   {
@@ -169,6 +181,44 @@ void crt::DecoderICARUSCRT::produce(art::Event& evt)
 
   }
 
+  // decode each hit independently, concurrently if so configured; results
+  // are collected per hit and merged in input order below, so the output
+  // does not depend on the decoding schedule
+  std::vector<std::vector<icarus::crt::CRTData>> dataByHit{ hit_vector.size() };
+
+  if (fAsyncDecode) {
+    tbb::parallel_for(std::size_t{ 0 }, hit_vector.size(),
+      [&, this](std::size_t const iHit)
+      {
+        dataByHit[iHit] = DecodeHit(hit_vector[iHit]);
+      }
+      );
+  }
+  else {
+    for (std::size_t iHit = 0; iHit < hit_vector.size(); ++iHit)
+      dataByHit[iHit] = DecodeHit(hit_vector[iHit]);
+  }
+
+  // move the data which is actually present in the final data product;
+  // the reservation advisor remembers how large the recent events came out
+  auto& sizeAdvisor = *art::ServiceHandle<icarus::ns::util::ProductSizeAdvisor>();
+  auto crtdata = std::make_unique<std::vector<icarus::crt::CRTData>>();
+  crtdata->reserve(sizeAdvisor.recommendedCapacity("DecoderICARUSCRT/CRTData"));
+  for (std::vector<icarus::crt::CRTData>& hitData: dataByHit) {
+    for (icarus::crt::CRTData& crtDataElem: hitData) {
+      if (crtDataElem.fMac5 == 0) continue; // not a valid Mac5, data is not present
+      crtdata->push_back(std::move(crtDataElem));
+    }
+  }
+  sizeAdvisor.reportSize("DecoderICARUSCRT/CRTData", crtdata->size());
+
+  evt.put(std::move(crtdata));
+
+}
+
+std::vector<icarus::crt::CRTData> crt::DecoderICARUSCRT::DecodeHit(icarus::crt::BernCRTTranslator& hit)
+{
+
   struct Recipe_t {
 
     unsigned int destMac5;
@@ -183,8 +233,7 @@ void crt::DecoderICARUSCRT::produce(art::Event& evt)
 
   // vector: Mac5 -> its CRT data
   std::vector<icarus::crt::CRTData> allCRTdata;
-  
-  for (auto & hit : hit_vector){
+
     CorrectForCableDelay(hit);  //add PPS cable length
 
     if(IsSideCRT(hit)) {
@@ -470,16 +519,7 @@ void crt::DecoderICARUSCRT::produce(art::Event& evt)
         allCRTdata.push_back(data);
     }
 
-  } // loop over all hits in an event
-
-  // move the data which is actually present in the final data product
-  auto crtdata = std::make_unique<std::vector<icarus::crt::CRTData>>();
-  for (icarus::crt::CRTData& crtDataElem: allCRTdata) {
-    if (crtDataElem.fMac5 == 0) continue; // not a valid Mac5, data is not present
-    crtdata->push_back(std::move(crtDataElem));
-  }
-
-  evt.put(std::move(crtdata));
+  return allCRTdata;
 
 }
 
@@ -161,6 +161,7 @@ void icarus::crt::CRTDetSim::produce(art::Event& event) {
 
     //clear detAlg member data
     detAlg.ClearTaggers();
+    detAlg.SetEventIndex(event.id().event());
 
     // Handle for (truth) AuxDetSimChannels
     art::Handle< vector<sim::AuxDetSimChannel> > adChanHandle;;
@@ -37,7 +37,9 @@
 #include "sbnobj/Common/CRT/CRTTrack.hh"
 #include "icaruscode/CRT/CRTUtils/CRTCommonUtils.h"
 #include "icaruscode/CRT/CRTUtils/CRTBackTracker.h"
+#include "icaruscode/CRT/CRTUtils/TimeCoincidenceSweep.h"
 #include "icaruscode/Decode/DataProducts/ExtraTriggerInfo.h"
+#include "icaruscode/Utilities/AssnsPrefetch.h"
 
 //C++ includes
 #include <vector>
@@ -276,6 +278,13 @@ void icarus::crt::CRTPMTMatchingAna::analyze(art::Event const& e)
       art::fill_ptr_vector(opFlashLists[i], flashHandles[i]);
   }
 
+  //resolve the flash->ophit associations once per event instead of
+  //rebuilding a FindManyP for every CRT hit in the loop below
+  std::map<int,util::AssnsPrefetch<recob::OpFlash,recob::OpHit>> flashToHits;
+  for(auto const& flashList : opFlashLists)
+    flashToHits[flashList.first] = util::prefetchAssns<recob::OpHit>(
+      e, flashHandles[flashList.first], fFlashLabels[flashList.first]);
+
 
   //CRTHits
   art::Handle< std::vector<CRTHit> > crtHitListHandle;
@@ -285,14 +294,15 @@ void icarus::crt::CRTPMTMatchingAna::analyze(art::Event const& e)
 
   fNCrt = crtHitList.size();
 
-  for(auto const& crt : crtHitList){
-    vector<double> xyzt, xyzerr;
-    TVector3 rcrt(crt->x_pos,crt->y_pos,crt->z_pos);
-    m_gate_crt_diff = m_gate_start_timestamp - crt->ts0_ns;
-    xyzt.push_back(rcrt.X());
-    xyzt.push_back(rcrt.Y());
-    xyzt.push_back(rcrt.Z());
+  //merged time line: instead of re-scanning every flash and every OpHit for
+  //each CRT hit (O(hits x flashes)), sort everything once and sweep it
+  enum { kCrtStream = 0, kFlashStream = 1, kOpHitStream = 10 };
+  TimeCoincidenceSweep sweep;
+  sweep.Reserve(crtHitList.size()+opHitList.size());
 
+  vector<double> crtT(crtHitList.size());
+  for(size_t icrt=0; icrt<crtHitList.size(); icrt++){
+    auto const& crt = crtHitList[icrt];
     double tcrt = double(m_gate_start_timestamp - crt->ts0_ns)/1e3;
     tcrt = -tcrt+1e6;
 
@@ -300,6 +310,63 @@ void icarus::crt::CRTPMTMatchingAna::analyze(art::Event const& e)
     //uint64_t tcrt = crt->ts0_ns;
 
     //    std::cout <<"T0: " << crt->ts0_ns << " , tcrt : " << tcrt << std::endl;
+    crtT[icrt] = tcrt;
+    sweep.AddEntry(tcrt, icrt, kCrtStream);
+  }
+
+  for(auto const& flashList : opFlashLists)
+    for(size_t iflash=0; iflash<flashList.second.size(); iflash++){
+      auto const& flash = flashList.second[iflash];
+      if(flash->TotalPE()<fFlashPeThresh){
+	continue;
+      }
+      sweep.AddEntry(flash->Time(), iflash, kFlashStream+flashList.first);
+    }
+
+  for(size_t ihit=0; ihit<opHitList.size(); ihit++){
+    if(opHitList[ihit]->PE()<fHitPeThresh){
+      continue;
+    }
+    sweep.AddEntry(opHitList[ihit]->PeakTime(), ihit, kOpHitStream);
+  }
+
+  sweep.Sort();
+
+  //classify the candidates over the flat pair arrays the sweep produced:
+  //per CRT hit, the flash closest in time (over all the flash lists)...
+  vector<int>    bestFlashList(crtHitList.size(), -1);
+  vector<size_t> bestFlash(crtHitList.size(), 0);
+  vector<double> bestFlashDt(crtHitList.size(), DBL_MAX);
+  for(auto const& flashList : opFlashLists)
+    for(auto const& cand : sweep.ClosestPairs(kCrtStream, kFlashStream+flashList.first)){
+      if(abs(cand.dt)<abs(bestFlashDt[cand.probe])) {
+	bestFlashDt[cand.probe] = cand.dt;
+	bestFlashList[cand.probe] = flashList.first;
+	bestFlash[cand.probe] = cand.cand;
+      }
+    }
+
+  //...and the largest-PE OpHit within the coincidence window
+  vector<size_t> bestHit(crtHitList.size(), 0);
+  vector<double> bestHitPE(crtHitList.size(), 0.);
+  for(auto const& cand : sweep.WindowPairs(kCrtStream, kOpHitStream, fCoinWindow)){
+    double const pe = opHitList[cand.cand]->PE();
+    if(abs(cand.dt)<fCoinWindow && pe>bestHitPE[cand.probe]) {
+      bestHitPE[cand.probe] = pe;
+      bestHit[cand.probe] = cand.cand;
+    }
+  }
+
+  for(size_t icrt=0; icrt<crtHitList.size(); icrt++){
+    auto const& crt = crtHitList[icrt];
+    vector<double> xyzt, xyzerr;
+    TVector3 rcrt(crt->x_pos,crt->y_pos,crt->z_pos);
+    m_gate_crt_diff = m_gate_start_timestamp - crt->ts0_ns;
+    xyzt.push_back(rcrt.X());
+    xyzt.push_back(rcrt.Y());
+    xyzt.push_back(rcrt.Z());
+
+    double tcrt = crtT[icrt];
     xyzt.push_back(tcrt);
     fCrtXYZT.push_back(xyzt);
 
@@ -319,56 +386,47 @@ void icarus::crt::CRTPMTMatchingAna::analyze(art::Event const& e)
     double flashHitT = DBL_MAX, flashHitPE=DBL_MAX, flashHitDiff=DBL_MAX;
     vector<double> flashHitxyzt;
 
-    for(auto const& flashList : opFlashLists) {
+    if(bestFlashList[icrt]>=0) {
 
-      art::FindManyP<recob::OpHit> findManyHits(flashHandles[flashList.first], e, fFlashLabels[flashList.first]);
+      size_t const iflash = bestFlash[icrt];
+      auto const& flash = opFlashLists[bestFlashList[icrt]][iflash];
 
-      for(size_t iflash=0; iflash<flashList.second.size(); iflash++) {
+      double tflash = flash->Time();//*1e3;//-fOpDelay;
 
-	auto const& flash = flashList.second[iflash];
-	if(flash->TotalPE()<fFlashPeThresh){
-	  continue;
+      TVector3 rflash(0,flash->YCenter(),flash->ZCenter());
+      TVector3 vdiff = rcrt-rflash;
+      //std::cout << "flash time: "<<flash->Time() << " absdiff : "<< abs(tcrt-tflash)<< std::endl;
+      peflash = flash->TotalPE();
+      tdiff = tcrt-tflash;
+      rdiff = vdiff.Mag();
+      xyzt.clear();
+      xyzt.push_back(rflash.X());
+      xyzt.push_back(rflash.Y());
+      xyzt.push_back(rflash.Z());
+      xyzt.push_back(tflash);
+      matched = true;
+      matchtpc = bestFlashList[icrt];
+
+      auto const hits = flashToHits[bestFlashList[icrt]].at(iflash);
+      for(auto const& hit : hits) {
+	double tPmt = hit->PeakTime();//*1.e3;//-fOpDelay;
+	if( tPmt < flashHitT) {
+	  flashHitT = tPmt;
+	  flashHitPE = hit->PE();
+	  //FlashHit position/time
+	  double pos[3];
+	  fGeometryService->OpDetGeoFromOpChannel(hit->OpChannel()).GetCenter(pos);
+	  flashHitxyzt.clear();
+	  for(int i=0; i<3; i++) flashHitxyzt.push_back(pos[i]);
+	  flashHitxyzt.push_back(flashHitT);
+
+	  //FlashHit distance
+	  TVector3 rflashHit(pos[0],pos[1],pos[2]);
+	  TVector3 vdiffHit = rcrt-rflashHit;
+	  flashHitDiff = vdiffHit.Mag();
 	}
-
-	double tflash = flash->Time();//*1e3;//-fOpDelay;
-
-	TVector3 rflash(0,flash->YCenter(),flash->ZCenter());
-	TVector3 vdiff = rcrt-rflash;
-	//std::cout << "flash time: "<<flash->Time() << " absdiff : "<< abs(tcrt-tflash)<< std::endl;
-	if(abs(tcrt-tflash)<abs(tdiff)) {
-	  peflash = flash->TotalPE();
-	  tdiff = tcrt-tflash;
-	  rdiff = vdiff.Mag();
-	  xyzt.clear();
-	  xyzt.push_back(rflash.X());
-	  xyzt.push_back(rflash.Y());
-	  xyzt.push_back(rflash.Z());
-	  xyzt.push_back(tflash);
-	  matched = true;
-	  matchtpc = flashList.first;
-
-	  vector<art::Ptr<recob::OpHit>> hits = findManyHits.at(iflash);
-	  for(auto const& hit : hits) {
-	    double tPmt = hit->PeakTime();//*1.e3;//-fOpDelay;
-	    if( tPmt < flashHitT) {
-	      flashHitT = tPmt;
-	      flashHitPE = hit->PE();
-	      //FlashHit position/time
-	      double pos[3];
-	      fGeometryService->OpDetGeoFromOpChannel(hit->OpChannel()).GetCenter(pos);
-	      flashHitxyzt.clear();
-	      for(int i=0; i<3; i++) flashHitxyzt.push_back(pos[i]);
-	      flashHitxyzt.push_back(flashHitT);
-
-	      //FlashHit distance
-	      TVector3 rflashHit(pos[0],pos[1],pos[2]);
-	      TVector3 vdiffHit = rcrt-rflashHit;
-	      flashHitDiff = vdiffHit.Mag();
-	    }
-	  }//loop over flash hits
-	}//if minimum tdiff
-      }//for OpFlash in this flash list
-    }//for flash lists
+      }//loop over flash hits
+    }//if a flash was matched
     if(!matched) {
       peflash = DBL_MAX;
       for(int i=0; i<4; i++) xyzt.push_back(DBL_MAX);
@@ -392,36 +450,27 @@ void icarus::crt::CRTPMTMatchingAna::analyze(art::Event const& e)
     rdiff = DBL_MAX;
     xyzt.clear();
 
-    double pemax = 0.;
-    for(auto const& hit : opHitList) {
+    if(bestHitPE[icrt]>0.) {
+      auto const& hit = opHitList[bestHit[icrt]];
       double thit = hit->PeakTime();//*1e3-fOpDelay;
-      if(hit->PE()<fHitPeThresh){
-	continue;
-      }
 
+      //hitXYZT
+      double pos[3];
+      fGeometryService->OpDetGeoFromOpChannel(hit->OpChannel()).GetCenter(pos);
+
+      //distHit
+      TVector3 rhit (pos[0],pos[1],pos[2]);
+      TVector3 vdiff = rcrt-rhit;
+      rdiff = vdiff.Mag();
+      peflash = hit->PE();
+      tdiff = tcrt-thit;
+      xyzt.clear();
+      for(int i=0; i<3; i++) xyzt.push_back(pos[i]);
+      xyzt.push_back(thit);
 
-      //if(abs(tcrt-thit)<abs(tdiff)) {
-      if(abs(tcrt-thit)<fCoinWindow && hit->PE()>pemax) {
-	pemax = hit->PE();
-
-	//hitXYZT
-	double pos[3];
-	fGeometryService->OpDetGeoFromOpChannel(hit->OpChannel()).GetCenter(pos);
-
-	//distHit
-	TVector3 rhit (pos[0],pos[1],pos[2]);
-	TVector3 vdiff = rcrt-rhit;
-	rdiff = vdiff.Mag();
-	peflash = hit->PE();
-	tdiff = tcrt-thit;
-	xyzt.clear();
-	for(int i=0; i<3; i++) xyzt.push_back(pos[i]);
-	xyzt.push_back(thit);
-
-	matched = true;
-	std::cout << "thit: "<<thit << " , tcrt: " << tcrt << " , tdiff " << tdiff  << std::endl;
-      }//if min tof
-    }//for OpHits
+      matched = true;
+      std::cout << "thit: "<<thit << " , tcrt: " << tcrt << " , tdiff " << tdiff  << std::endl;
+    }//if an OpHit was matched in the window
     if(!matched) {
       tdiff = DBL_MAX;
       peflash = DBL_MAX;
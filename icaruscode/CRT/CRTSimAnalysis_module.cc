@@ -63,6 +63,7 @@
 #include "sbnobj/Common/CRT/CRTTrack.hh"
 #include "icaruscode/CRT/CRTUtils/CRTCommonUtils.h"
 #include "icaruscode/CRT/CRTUtils/CRTBackTracker.h"
+#include "icaruscode/CRT/CRTUtils/RecoUtils.h"
 
 using std::string;
 using std::vector;
@@ -563,7 +564,7 @@ namespace crt {
 
     // Define a "handle" to point to a vector of MCParticle objects.
     art::Handle< vector<simb::MCParticle> > particleHandle;
-    map< int, const simb::MCParticle*> particleMap;
+    RecoUtils::TrackIDToMCParticleMap particleMap;
 
     if (!event.getByLabel("generator", genHandle)) {
         std::cout << "could not get handle to gen objects!!!" << std::endl;
@@ -625,12 +626,7 @@ namespace crt {
     // order. Since we may have to search the list of particles, let's
     // put them into a map. To save both space and time, the map
     // will not contain a copy of the MCParticle, but a pointer to it.
-    for ( auto const& particle : (*particleHandle) )
-    {
-        // Add the address of the MCParticle to the map, with the
-        // track ID as the key.
-        particleMap.insert(std::make_pair(particle.TrackId(),&particle));
-    }
+    particleMap = RecoUtils::BuildTrackIDToMCParticleMap(*particleHandle);
 
     std::cout << "event " << fEvent << " with " << particleMap.size() << " MCParticles" << std::endl;
 
@@ -686,7 +682,7 @@ namespace crt {
         fSimEndProcess = ProcessToICode(particle.EndProcess());
        
         if(fMother!=0){ //if not primary
-            map<int,const simb::MCParticle*>::const_iterator it = particleMap.find(fMother);
+            RecoUtils::TrackIDToMCParticleMap::const_iterator it = particleMap.find(fMother);
             if(it==particleMap.end()){
                 fParentPDG=INT_MAX;
                 fParentE = FLT_MAX;
@@ -697,7 +693,7 @@ namespace crt {
                 fParentE = it->second->E(0);
                 int tmpID=it->second->Mother();
                 size_t ctr=0;
-                map<int,const simb::MCParticle*>::iterator it2 = particleMap.begin();
+                RecoUtils::TrackIDToMCParticleMap::iterator it2 = particleMap.begin();
 		
 		if(fParentPDG==13||fParentPDG==-13) fProgenitor = it->second->TrackId();
                 else while(it2!=particleMap.end()&&ctr<particleMap.size()){
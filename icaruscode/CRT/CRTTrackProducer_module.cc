@@ -190,8 +190,8 @@ namespace crt {
               for (auto &keyVal : hits){
     
 		// string ip = keyVal.first;
-		int ip = keyVal.first;
-		vector<pair<sbn::crt::CRTHit, vector<int>>> ahits = trackAlg.AverageHits(hits[ip], hitIds);
+		//average the hits of this plane (entry already at hand, no second map lookup)
+		vector<pair<sbn::crt::CRTHit, vector<int>>> ahits = trackAlg.AverageHits(keyVal.second, hitIds);
 
 		allHits.insert(allHits.end(), ahits.begin(), ahits.end());
     
@@ -32,7 +32,11 @@ namespace icarus{
         fDataTrueIds.clear();
         fSimHitTrueIds.clear();
         fTrackTrueIds.clear();
-   
+        fDataIdIndex.clear();
+        fTrueHitIdIndex.clear();
+        fSimHitIdIndex.clear();
+        fTrackIdIndex.clear();
+
         //CRTTrueHit
         art::Handle< std::vector<CRTHit>> crtTrueHitHandle;
         std::vector<art::Ptr<CRTHit> > crtTrueHitList;
@@ -45,6 +49,7 @@ namespace icarus{
             for(size_t hit_i = 0; hit_i < crtTrueHitList.size(); hit_i++){
 
                 trueHitPtrMap[crtTrueHitList[hit_i]] = hit_i;
+                fTrueHitIdIndex[crtTrueHitList[hit_i]->ts1_ns].push_back(hit_i);
                 std::vector<art::Ptr<sim::AuxDetIDE>> ides = findManyIdes.at(hit_i);
 
                 for(size_t i = 0; i < ides.size(); i++){
@@ -70,6 +75,8 @@ namespace icarus{
             for(size_t data_i = 0; data_i < crtDataList.size(); data_i++){
       
                 dataPtrMap[crtDataList[data_i]] = data_i;
+                fDataIdIndex[std::make_pair(crtDataList[data_i]->fMac5,
+                                            crtDataList[data_i]->fTs0)].push_back(data_i);
                 // Get all the true IDs from all the IDEs in the hit
                 std::vector<art::Ptr<sim::AuxDetIDE>> ides = findManyIdes.at(data_i);
  
@@ -101,6 +108,7 @@ namespace icarus{
             for(size_t hit_i = 0; hit_i < crtSimHitList.size(); hit_i++){
       
                 simHitPtrMap[crtSimHitList[hit_i]] = hit_i;
+                fSimHitIdIndex[crtSimHitList[hit_i]->ts1_ns].push_back(hit_i);
                 std::vector<art::Ptr<CRTData>> data = findManyData.at(hit_i);
       
                 for(size_t data_i = 0; data_i < data.size(); data_i++){
@@ -131,7 +139,8 @@ namespace icarus{
             art::FindManyP<CRTHit> findManyHits(crtTrackHandle, event, fCRTTrackLabel);
       
             for(size_t track_i = 0; track_i < crtTrackList.size(); track_i++){
-      
+
+                fTrackIdIndex[crtTrackList[track_i]->ts1_ns].push_back(track_i);
                 std::vector<art::Ptr<CRTHit>> hits = findManyHits.at(track_i);
                 for(size_t hit_i = 0; hit_i < hits.size(); hit_i++){
       
@@ -145,9 +154,18 @@ namespace icarus{
         }//if CRTrack product found
         else
             mf::LogWarning("CRTBackTracker") << "no CRTTrack products found";
-      
+
+        fCachedEventId = event.id();
+
     }//Initialize
 
+    //-----------------------------------------------------------------------------
+    void CRTBackTracker::UpdateCache(const art::Event& event){
+
+        if(event.id() == fCachedEventId) return;
+        Initialize(event);
+    }
+
     // ---------------------------------------------------------------------------------------    
     // Check that two CRT data products are the same
     bool CRTBackTracker::DataCompare(const CRTData& data1, const CRTData& data2){
@@ -206,47 +224,42 @@ namespace icarus{
     // --------------------------------------------------------------------------------------------    
     // Get all the true particle IDs that contributed to the CRT data product
     std::vector<int> CRTBackTracker::AllTrueIds(const art::Event& event, const CRTData& data){
-    
+
       std::vector<int> ids;
-    
+
+      // (re)build the truth maps if this is a new event
+      UpdateCache(event);
+
       // Get a handle to the CRT data in the event
       auto crtDataHandle = event.getValidHandle<std::vector<CRTData>>(fCRTDataLabel);
-      art::FindManyP<sim::AuxDetIDE> findManyIdes(crtDataHandle, event, fCRTDataLabel);
-    
-      // Find which one matches the data passed to the function
-      int data_i = 0, index = 0;
-   
-      int nmatch=0; 
-      for(auto const& crtData : (*crtDataHandle)){
-    
-        if(DataCompare(crtData, data)) {
-            data_i = index;
-            nmatch++;
-        }
-    
-        index++;
+
+      // Find which one matches the data passed to the function:
+      // any full match shares mac5 and t0, so only those candidates are scanned
+      int data_i = 0, nmatch = 0;
+
+      auto const itIndex = fDataIdIndex.find(std::make_pair(data.fMac5, data.fTs0));
+      if(itIndex != fDataIdIndex.end()){
+          for(const int index : itIndex->second){
+              if(DataCompare((*crtDataHandle)[index], data)) {
+                  data_i = index;
+                  nmatch++;
+              }
+          }
       }
-      if(nmatch==0) 
+      if(nmatch==0) {
           mf::LogError("CRTBackTracker::AllTrueIds") << "no matches for provided CRTData product found!";
-      if(nmatch>1) 
+          return ids;
+      }
+      if(nmatch>1)
           mf::LogError("CRTBackTracker::AllTrueIds") << "multiple matches for given CRTData product found!";
 
-      // Get all the true IDs from all the IDEs in the hit
-      std::vector<art::Ptr<sim::AuxDetIDE>> ides = findManyIdes.at(data_i);
-    
-      for(size_t i = 0; i < ides.size(); i++){
-    
-        int id = ides[i]->trackID;
-    
-        if(fRollupUnsavedIds) id = std::abs(id);
-    
-        ids.push_back(id);
+      // Get all the true IDs accumulated for that data product
+      // (map keys are already sorted and unique)
+      for(auto const& di : fDataTrueIds[data_i]){
+
+        ids.push_back(di.first);
       }
-    
-      // Remove any repeated IDs
-      std::sort(ids.begin(), ids.end());
-      ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
-    
+
       return ids;
     }
 
@@ -255,23 +268,27 @@ namespace icarus{
     std::vector<int> CRTBackTracker::AllTrueIds(const art::Event& event, const CRTHit& hit){
     
         std::vector<int> ids;
-      
+
+        // (re)build the truth maps if this is a new event
+        UpdateCache(event);
+
         // Get a handle to the CRT hits in the event
         art::Handle< std::vector<CRTHit> > crtSimHitHandle;
         art::Handle< std::vector<CRTHit> > crtTrueHitHandle;
- 
-        // Find which one matches the hit passed to the function
-        int hit_i = -1, tmp_hit_i = -1, index = 0;
-        bool sim=false, findsim=false, findtrue=false;      
+
+        // Find which one matches the hit passed to the function:
+        // any full match shares ts1, so only those candidates are scanned
+        int hit_i = -1, tmp_hit_i = -1;
+        bool sim=false, findsim=false, findtrue=false;
 
         //try to get a handle to CRTSimHits
         if(event.getByLabel(fCRTSimHitLabel,crtSimHitHandle)) {
             findsim = true;
             //find vector index matching the passed CRTHit
-            for(auto const& crtHit : (*crtSimHitHandle)){
-      
-                if(HitCompare(crtHit, hit)) tmp_hit_i = index;
-                index++;
+            auto const itIndex = fSimHitIdIndex.find(hit.ts1_ns);
+            if(itIndex != fSimHitIdIndex.end()){
+                for(const int index : itIndex->second)
+                    if(HitCompare((*crtSimHitHandle)[index], hit)) tmp_hit_i = index;
             }
 
             if(tmp_hit_i!=-1) {
@@ -284,12 +301,11 @@ namespace icarus{
         //try to get handle to CRTTrueHits
         if(event.getByLabel(fCRTTrueHitLabel,crtTrueHitHandle)) {
             findtrue = true;
-            index=0;
             //find vector index matching the passed CRTHit
-            for(auto const& crtHit : (*crtTrueHitHandle)){
-                
-                if(HitCompare(crtHit, hit)) tmp_hit_i = index;
-                index++;
+            auto const itIndex = fTrueHitIdIndex.find(hit.ts1_ns);
+            if(itIndex != fTrueHitIdIndex.end()){
+                for(const int index : itIndex->second)
+                    if(HitCompare((*crtTrueHitHandle)[index], hit)) tmp_hit_i = index;
             }
             if(tmp_hit_i!=-1){
                 if(hit_i!=-1) {
@@ -308,40 +324,13 @@ namespace icarus{
             return ids;
         }
 
-        // Get the crt data associated to that hit and the IDEs associate to the data
-        std::vector<art::Ptr<sim::AuxDetIDE>> ides;
-      
-        // Get all the true IDs from all the IDEs in the hit
-        if(sim) {
-            art::FindManyP<CRTData> findManyData(crtSimHitHandle, event, fCRTSimHitLabel);
-            std::vector<art::Ptr<CRTData>> data;
-            data = findManyData.at(hit_i);
-            art::FindManyP<sim::AuxDetIDE> findManySimIdes(data, event, fCRTDataLabel);
-            for(size_t i = 0; i < data.size(); i++){
-      
-                ides = findManySimIdes.at(i);
-                for(size_t j = 0; j < ides.size(); j++){
-      
-                    int id = ides[j]->trackID;
-                    if(fRollupUnsavedIds) id = std::abs(id);
-                    ids.push_back(id);
-                }
-            }
-        }//if sim
-        else {
-            art::FindManyP<sim::AuxDetIDE> findManyTrueIdes(crtTrueHitHandle, event, fCRTTrueHitLabel);
-            ides = findManyTrueIdes.at(hit_i);
-            for(auto const& ide : ides) {
-                int id = ide->trackID;
-                if(fRollupUnsavedIds) id = std::abs(id);
-                ids.push_back(id);
-            }
-        }//else true
+        // Get all the true IDs accumulated for that hit
+        // (map keys are already sorted and unique)
+        auto const& trueIds = sim? fSimHitTrueIds[hit_i] : fTrueHitTrueIds[hit_i];
+        for(auto const& hi : trueIds) {
+            ids.push_back(hi.first);
+        }
 
-        // Remove any repeated IDs
-        std::sort(ids.begin(), ids.end());
-        ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
-      
         return ids;
     }
 
@@ -350,96 +339,67 @@ namespace icarus{
     std::vector<int> CRTBackTracker::AllTrueIds(const art::Event& event, const CRTTrack& track){
     
       std::vector<int> ids;
+
+      // (re)build the truth maps if this is a new event
+      UpdateCache(event);
+
       // Get a handle to the CRT tracks in the event
       auto crtTrackHandle = event.getValidHandle<std::vector<CRTTrack>>(fCRTTrackLabel);
-      art::FindManyP<CRTHit> findManyHits(crtTrackHandle, event, fCRTTrackLabel);
-      // Find which one matches the track passed to the function
-      int track_i = 0, index = 0;
-    
-      for(auto const& crtTrack : (*crtTrackHandle)){
-    
-        if(TrackCompare(crtTrack, track)) track_i = index;
-        index++;
+
+      // Find which one matches the track passed to the function:
+      // any full match shares ts1, so only those candidates are scanned
+      int track_i = -1;
+
+      auto const itIndex = fTrackIdIndex.find(track.ts1_ns);
+      if(itIndex != fTrackIdIndex.end()){
+          for(const int index : itIndex->second)
+              if(TrackCompare((*crtTrackHandle)[index], track)) track_i = index;
       }
-    
-      // Get the crt hits associated to that hit and the data associate to the hits
-      std::vector<art::Ptr<CRTHit>> hits = findManyHits.at(track_i);
-      art::FindManyP<CRTData> findManyData(hits, event, fCRTSimHitLabel);
-    
-      // Get all the true IDs from all the IDEs in the track
-      for(size_t i = 0; i < hits.size(); i++){
-    
-        std::vector<art::Ptr<CRTData>> data = findManyData.at(i);
-        art::FindManyP<sim::AuxDetIDE> findManyIdes(data, event, fCRTDataLabel);
-        for(size_t j = 0; j < data.size(); j++){
-    
-          std::vector<art::Ptr<sim::AuxDetIDE>> ides = findManyIdes.at(j);
-          for(size_t k = 0; k < ides.size(); k++){
-    
-            int id = ides[k]->trackID;
-            if(fRollupUnsavedIds) id = std::abs(id);
-            ids.push_back(id);
-    
-          }
-        }
+      if(track_i==-1) {
+          mf::LogError("CRTBackTracker::AllTrueIds") << "no match for passed CRTTrack found!";
+          return ids;
       }
-    
-      // Remove any repeated IDs
-      std::sort(ids.begin(), ids.end());
-      ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
-    
+
+      // Get all the true IDs accumulated for that track
+      // (map keys are already sorted and unique)
+      for(auto const& ti : fTrackTrueIds[track_i]){
+
+        ids.push_back(ti.first);
+      }
+
       return ids;
     }
 
     //------------------------------------------------------------------------------------------    
     // Get the true particle ID that contributed the most energy to the CRT data product
     int CRTBackTracker::TrueIdFromTotalEnergy(const art::Event& event, const CRTData& data){
-    
-      std::map<int, double> ids;
-    
+
+      // (re)build the truth maps if this is a new event
+      UpdateCache(event);
+
       // Get a handle to the CRT data in the event
       auto crtDataHandle = event.getValidHandle<std::vector<CRTData>>(fCRTDataLabel);
-      art::FindManyP<sim::AuxDetIDE> findManyIdes(crtDataHandle, event, fCRTDataLabel);
-    
-      // Find which one matches the data passed to the function
-      int data_i = 0, index = 0;
-    
-      for(auto const& crtData : (*crtDataHandle)){
-    
-        if(DataCompare(crtData, data)) data_i = index;
-        index++;
-      }
-    
-      // Get all the true IDs from all the IDEs in the hit
-      std::vector<art::Ptr<sim::AuxDetIDE>> ides = findManyIdes.at(data_i);
-    
-      for(size_t i = 0; i < ides.size(); i++){
-    
-        int id = ides[i]->trackID;
-        if(fRollupUnsavedIds) id = std::abs(id);
-        ids[id] += ides[i]->energyDeposited;
-      }
-    
-      // Find the true ID that contributed the most energy
-      double maxEnergy = -1;
-      int trueId = -99999;
-    
-      for(auto &id : ids){
-    
-        if(id.second > maxEnergy){
-    
-          maxEnergy = id.second;
-          trueId = id.first;
-        }
+
+      // Find which one matches the data passed to the function:
+      // any full match shares mac5 and t0, so only those candidates are scanned
+      int data_i = -1;
+
+      auto const itIndex = fDataIdIndex.find(std::make_pair(data.fMac5, data.fTs0));
+      if(itIndex != fDataIdIndex.end()){
+          for(const int index : itIndex->second)
+              if(DataCompare((*crtDataHandle)[index], data)) data_i = index;
       }
-    
-      return trueId;
+      if(data_i==-1) return -99999;
+
+      return TrueIdFromDataId(event, data_i);
     }
 
     //-------------------------------------------------------------------------------------------
     int CRTBackTracker::TrueIdFromDataId(const art::Event& event, int data_i){
-    
-      if(fDataTrueIds.find(data_i) != fDataTrueIds.end()){ 
+
+      UpdateCache(event);
+
+      if(fDataTrueIds.find(data_i) != fDataTrueIds.end()){
     
         double maxEnergy = -1;
         int trueId = -99999;
@@ -462,61 +422,34 @@ namespace icarus{
     //--------------------------------------------------------------------------------------------
     // Get the true particle ID that contributed the most energy to the CRT hit
     int CRTBackTracker::TrueIdFromTotalEnergy(const art::Event& event, const CRTHit& hit){
-    
-      std::map<int, double> ids;
-    
+
+      // (re)build the truth maps if this is a new event
+      UpdateCache(event);
+
       // Get a handle to the CRT hits in the event
       auto crtHitHandle = event.getValidHandle<std::vector<CRTHit>>(fCRTSimHitLabel);
-      art::FindManyP<CRTData> findManyData(crtHitHandle, event, fCRTSimHitLabel);
-    
-      // Find which one matches the hit passed to the function
-      int hit_i = 0, index = 0;
-    
-      for(auto const& crtHit : (*crtHitHandle)){
-    
-        if(HitCompare(crtHit, hit)) hit_i = index;
-        index++;
-      }
-    
-      // Get the crt data associated to that hit and the IDEs associate to the data
-      std::vector<art::Ptr<CRTData>> data = findManyData.at(hit_i);
-      art::FindManyP<sim::AuxDetIDE> findManyIdes(data, event, fCRTDataLabel);
-    
-      // Get all the true IDs from all the IDEs in the hit
-      for(size_t i = 0; i < data.size(); i++){
-    
-        std::vector<art::Ptr<sim::AuxDetIDE>> ides = findManyIdes.at(i);
-    
-        for(size_t j = 0; j < ides.size(); j++){
-    
-          int id = ides[j]->trackID;
-          if(fRollupUnsavedIds) id = std::abs(id);
-          ids[id] += ides[j]->energyDeposited;
-        }
-      }
-    
-      // Find the true ID that contributed the most energy
-      double maxEnergy = -1;
-      int trueId = -99999;
-    
-      for(auto &id : ids){
-    
-        if(id.second > maxEnergy){
-    
-          maxEnergy = id.second;
-          trueId = id.first;
-    
-        }
+
+      // Find which one matches the hit passed to the function:
+      // any full match shares ts1, so only those candidates are scanned
+      int hit_i = -1;
+
+      auto const itIndex = fSimHitIdIndex.find(hit.ts1_ns);
+      if(itIndex != fSimHitIdIndex.end()){
+          for(const int index : itIndex->second)
+              if(HitCompare((*crtHitHandle)[index], hit)) hit_i = index;
       }
-    
-      return trueId;
-    
+      if(hit_i==-1) return -99999;
+
+      return TrueIdFromHitId(event, hit_i);
+
     }
 
     //-----------------------------------------------------------------------------------------
     int CRTBackTracker::TrueIdFromHitId(const art::Event& event, int hit_i){
-    
-      if(fSimHitTrueIds.find(hit_i) != fSimHitTrueIds.end()){ 
+
+      UpdateCache(event);
+
+      if(fSimHitTrueIds.find(hit_i) != fSimHitTrueIds.end()){
     
         double maxEnergy = -1;
         int trueId = -99999;
@@ -541,66 +474,33 @@ namespace icarus{
     //--------------------------------------------------------------------------------------------    
     // Get the true particle ID that contributed the most energy to the CRT track
     int CRTBackTracker::TrueIdFromTotalEnergy(const art::Event& event, const CRTTrack& track){
-    
-      std::map<int, double> ids;
-    
+
+      // (re)build the truth maps if this is a new event
+      UpdateCache(event);
+
       // Get a handle to the CRT tracks in the event
       auto crtTrackHandle = event.getValidHandle<std::vector<CRTTrack>>(fCRTTrackLabel);
-      art::FindManyP<CRTHit> findManyHits(crtTrackHandle, event, fCRTTrackLabel);
-    
-      // Find which one matches the track passed to the function
-      int track_i = 0, index = 0;
-    
-      for(auto const& crtTrack : (*crtTrackHandle)){
-    
-        if(TrackCompare(crtTrack, track)) track_i = index;
-        index++;
-      }
-    
-      // Get the crt hits associated to that hit and the data associate to the hits
-      std::vector<art::Ptr<CRTHit>> hits = findManyHits.at(track_i);
-      art::FindManyP<CRTData> findManyData(hits, event, fCRTSimHitLabel);
-    
-      // Get all the true IDs from all the IDEs in the track
-      for(size_t i = 0; i < hits.size(); i++){
-    
-        std::vector<art::Ptr<CRTData>> data = findManyData.at(i);
-        art::FindManyP<sim::AuxDetIDE> findManyIdes(data, event, fCRTDataLabel);
-    
-        for(size_t j = 0; j < data.size(); j++){
-    
-          std::vector<art::Ptr<sim::AuxDetIDE>> ides = findManyIdes.at(j);
-    
-          for(size_t k = 0; k < ides.size(); k++){
-    
-            int id = ides[k]->trackID;
-            if(fRollupUnsavedIds) id = std::abs(id);
-            ids[id] += ides[k]->energyDeposited;
-          }
-        }
-    
-      }
-    
-      // Find the true ID that contributed the most energy
-      double maxEnergy = -1;
-      int trueId = -99999;
-    
-      for(auto &id : ids){
-    
-        if(id.second > maxEnergy){
-    
-          maxEnergy = id.second;
-          trueId = id.first;
-        }
+
+      // Find which one matches the track passed to the function:
+      // any full match shares ts1, so only those candidates are scanned
+      int track_i = -1;
+
+      auto const itIndex = fTrackIdIndex.find(track.ts1_ns);
+      if(itIndex != fTrackIdIndex.end()){
+          for(const int index : itIndex->second)
+              if(TrackCompare((*crtTrackHandle)[index], track)) track_i = index;
       }
-    
-      return trueId;
+      if(track_i==-1) return -99999;
+
+      return TrueIdFromTrackId(event, track_i);
     }
 
     //--------------------------------------------------------------------------
     int CRTBackTracker::TrueIdFromTrackId(const art::Event& event, int track_i){
-    
-      if(fTrackTrueIds.find(track_i) != fTrackTrueIds.end()){ 
+
+      UpdateCache(event);
+
+      if(fTrackTrueIds.find(track_i) != fTrackTrueIds.end()){
     
         double maxEnergy = -1;
     
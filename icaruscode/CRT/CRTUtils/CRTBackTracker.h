@@ -32,6 +32,8 @@
 #include "sbnobj/Common/CRT/CRTTrack.hh"
 
 // c++
+#include <map>
+#include <utility>
 #include <vector>
 
 namespace icarus{
@@ -79,7 +81,8 @@ class icarus::crt::CRTBackTracker {
 
     void reconfigure(const Config& config);
 
-    // Initialize to speed things up
+    // Initialize to speed things up; called lazily by the queries below,
+    // so the truth maps are built once per event and reused
     void Initialize(const art::Event& event);
 
     // Check that two CRT data products are the same
@@ -120,17 +123,29 @@ class icarus::crt::CRTBackTracker {
 
   private:
 
+    // Rebuild the truth maps if the cached ones are from a different event
+    void UpdateCache(const art::Event& event);
+
     art::InputTag fCRTTrueHitLabel;
     art::InputTag fCRTDataLabel;
     art::InputTag fCRTSimHitLabel;
     art::InputTag fCRTTrackLabel;
 
     bool fRollupUnsavedIds;
+    art::EventID fCachedEventId; ///< event the cached maps below were built from
     std::map<int, std::map<int, double>> fTrueHitTrueIds;
     std::map<int, std::map<int, double>> fDataTrueIds;
     std::map<int, std::map<int, double>> fSimHitTrueIds;
     std::map<int, std::map<int, double>> fTrackTrueIds;
 
+    // inverted indices from product key to position in the collection, so
+    // single-product queries need no scan over the whole collection;
+    // candidates sharing a key are disambiguated with the Compare functions
+    std::map<std::pair<uint8_t, uint64_t>, std::vector<int>> fDataIdIndex; //(mac5,ts0)
+    std::map<double, std::vector<int>> fTrueHitIdIndex;                    //ts1_ns
+    std::map<double, std::vector<int>> fSimHitIdIndex;                     //ts1_ns
+    std::map<double, std::vector<int>> fTrackIdIndex;                      //ts1_ns
+
 };
 
 #endif
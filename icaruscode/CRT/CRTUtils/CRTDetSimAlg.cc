@@ -3,6 +3,8 @@
 
 #include "icaruscode/CRT/CRTUtils/CRTDetSimAlg.h"
 
+#include <algorithm>
+
 namespace icarus{
  namespace crt {
 
@@ -16,7 +18,9 @@ namespace icarus{
     CRTDetSimAlg::CRTDetSimAlg(fhicl::ParameterSet const & p, CLHEP::HepRandomEngine& engine) :
         fNsim_m(0), fNsim_d(0), fNsim_c(0), fNchandat_m(0), fNchandat_d(0), fNchandat_c(0),
         fNmissthr_c(0), fNmissthr_d(0), fNmissthr_m(0), fNmiss_strcoin_c(0), fNdual_m(0),
-        fHasFilledTaggers(false), fRandEngine(engine)
+        fHasFilledTaggers(false), fRandEngine(engine),
+        fCounterEngine(dynamic_cast<icarus::ns::util::CounterBasedEngine*>(&engine)),
+        fEventIndex(0)
     {
 
         this->reconfigure(p);
@@ -105,7 +109,26 @@ namespace icarus{
         // Front-end logic: For CERN or DC modules require at least one hit in each X-X layer.
         if (fUltraVerbose) std::cout << '\n' << "about to loop over taggers (size " << fTaggers.size() << " )" << std::endl;
 
-        for (auto trg : fTaggers) {
+        //time-sorted timestamps of each MINOS FEB, indexed once here so that the
+        //layer-layer coincidence check below can search only the entries within
+        //the coincidence window instead of scanning every FEB's full data
+        map<uint8_t, vector<uint64_t>> minosFebT0;
+        if (fApplyCoincidenceM) {
+            for (auto const& trg : fTaggers) {
+                if (trg.second.type != 'm') continue;
+                vector<uint64_t>& febT0 = minosFebT0[trg.first];
+                febT0.reserve(trg.second.data.size());
+                for (auto const& dat : trg.second.data)
+                    febT0.push_back(dat.first.ts);
+                std::sort(febT0.begin(), febT0.end());
+            }
+        }
+        //largest timestamp difference which can pass the coincidence window cut
+        uint64_t const maxDiffM = (fLayerCoincidenceWindowM > 0.)
+            ? (uint64_t)std::ceil(fLayerCoincidenceWindowM) : 0;
+
+        //iterate by reference: the data is large and is time-sorted in place
+        for (auto& trg : fTaggers) {
             //if(trg.second.data.size()!=trg.second.ide.size())
             //    std::cout << "WARNING DATA AND INDEX VECTOR SIZE MISMATCH!" << std::endl;
 
@@ -194,7 +217,7 @@ namespace icarus{
               //for c and d modules, just need time stamps within tagger obj
               //for m modules, need to check coincidence with other tagger objs
               if (trg.second.type=='m' && !minosPairFound && fApplyCoincidenceM) {
-                  for (auto trg2 :fTaggers) {
+                  for (auto const& trg2 : fTaggers) {
 
                       if( trg2.second.type!='m' || //is other mod 'm' type
                         trg.second.modid == trg2.second.modid || //other mod not same as this one
@@ -203,10 +226,13 @@ namespace icarus{
                           continue;
 
                       //find entry within coincidence window starting with this FEB's
-                      //triggering channel in coincidence candidate's FEB
-                      for ( size_t j=0; j< trg2.second.data.size(); j++ ) {
-                          uint64_t t2tmp = trg2.second.data[j].first.ts; //in us
-                          if ( util::absDiff(t2tmp,ttrig) < fLayerCoincidenceWindowM) {
+                      //triggering channel in coincidence candidate's FEB:
+                      //only the time-ordered entries within the window are checked
+                      vector<uint64_t> const& febT0 = minosFebT0[trg2.first];
+                      uint64_t const tmin = (ttrig > maxDiffM)? ttrig - maxDiffM : 0;
+                      for (auto itT2 = std::lower_bound(febT0.begin(), febT0.end(), tmin);
+                           itT2 != febT0.end() && *itT2 <= ttrig + maxDiffM; ++itT2) {
+                          if ( util::absDiff(*itT2,ttrig) < fLayerCoincidenceWindowM) {
                               minosPairFound = true;
                               break;
                           }
@@ -474,6 +500,10 @@ namespace icarus{
         detinfo::ElecClock trigClock = clockData.TriggerClock();
         fHasFilledTaggers = true;
 
+        //counter-based engines draw from an independent stream per (event,strip)
+        if(fCounterEngine)
+            fCounterEngine->setEventChannel(fEventIndex, (adid << 16) | adsid);
+
         const geo::AuxDetGeo& adGeo = geoService->AuxDet(adid); //pointer to module object
         const geo::AuxDetSensitiveGeo& adsGeo = adGeo.SensitiveVolume(adsid); //pointer to strip object
         const char auxDetType = fCrtutils->GetAuxDetType(adid); //CRT module type (c, d, or m)
@@ -886,6 +916,13 @@ namespace icarus{
         return (uint64_t)t;//clock.Ticks();
     }//CRTDetSim::GetChannelTriggerTicks()
 
+    //---------------------------------------------------------------
+    // tells a counter-based engine which event is being processed (no-op otherwise)
+    void CRTDetSimAlg::SetEventIndex(uint32_t eventIndex) {
+
+        fEventIndex = eventIndex;
+    }
+
     //---------------------------------------------------------------
     // function to clear member data at beginning of each art::event
     void CRTDetSimAlg::ClearTaggers() {
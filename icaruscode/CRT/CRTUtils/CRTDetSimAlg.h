@@ -21,6 +21,9 @@
 #include "CLHEP/Random/RandGauss.h"
 #include "CLHEP/Random/RandPoisson.h"
 
+//icaruscode includes
+#include "icaruscode/Utilities/CounterBasedEngine.h"
+
 //C++ includes
 #include <cmath>
 #include <map>
@@ -73,6 +76,10 @@ class icarus::crt::CRTDetSimAlg {
     CRTDetSimAlg(fhicl::ParameterSet const & p, CLHEP::HepRandomEngine& fRandEngine);
     void reconfigure(fhicl::ParameterSet const & p);
 
+    //when the engine passed to the constructor is a CounterBasedEngine, tells it
+    //the current event so each (event,strip) pair draws from its own stream
+    void SetEventIndex(uint32_t eventIndex);
+
     void ClearTaggers();
     //given a vector of AuxDetIDEs, fill a map of tagger objects with intermediate ChannelData + aux info
     void FillTaggers(detinfo::DetectorClocksData const& clockData,
@@ -134,6 +141,8 @@ class icarus::crt::CRTDetSimAlg {
 
     CRTCommonUtils* fCrtutils;
     CLHEP::HepRandomEngine& fRandEngine;
+    icarus::ns::util::CounterBasedEngine* fCounterEngine; //non-null if fRandEngine is counter-based
+    uint32_t fEventIndex; //current event number, used to key the counter-based streams
 
     // A list of hit taggers, before any coincidence requirement (mac5 -> tagger)
     map<uint8_t, Tagger> fTaggers;
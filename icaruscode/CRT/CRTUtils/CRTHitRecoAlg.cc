@@ -1,4 +1,5 @@
 #include "CRTHitRecoAlg.h"
+#include "tbb/parallel_for.h"
 #include <algorithm>
 using namespace icarus::crt;
 
@@ -147,13 +148,77 @@ vector<pair<sbn::crt::CRTHit, vector<int>>> CRTHitRecoAlg::CreateCRTHits(vector<
 
     }//loop over CRTData products
 
+    // each side region is independent from the others: when allowed, search
+    // them in parallel, each region into its own buffer, and merge the buffers
+    // afterward (in region order, so that the result does not depend on how
+    // the searches were scheduled)
+    vector<pair<string const*, vector<size_t> const*>> sideRegions;
+    for(auto const& regIndices : sideRegionToIndices)
+      sideRegions.push_back(std::make_pair(&regIndices.first, &regIndices.second));
+
+    vector<SideHitResults> sideResults(sideRegions.size());
+
+    auto const processRegion = [this, &crtList, &sideRegions, &sideResults]
+      (size_t reg_i)
+      {
+        MakeSideHitsInRegion(crtList, *sideRegions[reg_i].first,
+                             *sideRegions[reg_i].second, sideResults[reg_i]);
+      };
+
+    if(fVerbose || foutCSVFile) {
+      // verbose logging and the CSV dump are not thread safe: stay serial
+      for(size_t reg_i=0; reg_i<sideRegions.size(); reg_i++)
+        processRegion(reg_i);
+    }
+    else
+      tbb::parallel_for(size_t{0}, sideRegions.size(), processRegion);
+
+    // merge the per-region buffers, in region order
     vector<size_t> unusedDataIndex;
-    for(auto const& regIndices : sideRegionToIndices) {
+    for(size_t reg_i=0; reg_i<sideRegions.size(); reg_i++) {
+
+      SideHitResults& results = sideResults[reg_i];
+      string const& region = *sideRegions[reg_i].first;
+
+      for(auto& regionHit : results.hits)
+        returnHits.push_back(std::move(regionHit));
+      unusedDataIndex.insert(unusedDataIndex.end(),
+                             results.unusedDataIndex.begin(),
+                             results.unusedDataIndex.end());
+      nHitM += results.nHit;
+      nMissM += results.nMiss;
+
+      if(results.nHit > 0) {
+        if((regs.insert(region)).second) regCounts[region] = results.nHit;
+        else regCounts[region] += results.nHit;
+      }
+    }//loop over side CRT regions
+    
+    if(fVerbose) {
+          mf::LogInfo("CRT") << returnHits.size() << " CRT hits produced!" << '\n'
+              << "  nHitC: " << nHitC  << " , nHitD: " << nHitD  << " , nHitM: " << nHitM  << '\n'
+              << "  nMisC: " << nMissC << " , nMisD: " << nMissD << " , nMisM: " << nMissM << '\n';
+          auto cts = regCounts.begin();
+          mf::LogInfo("CRT") << " CRT Hits by region" << '\n';
+          while (cts != regCounts.end()) {
+              mf::LogInfo("CRT") << "reg: " << (*cts).first << " , hits: " << (*cts).second << '\n';
+              cts++;
+          }
+    }//if Verbose
+  
+    return returnHits;
+}
+//---------------------------------------------------------------------------------------
+void CRTHitRecoAlg::MakeSideHitsInRegion(vector<art::Ptr<CRTData>> const& crtList,
+                                         string const& region, vector<size_t> const& indices,
+                                         SideHitResults& results) {
+
+      vector<int> dataIds;
+
       
       if(fVerbose) 
-	mf::LogInfo("CRTHitRecoAlg: ") << "searching for side CRT hits in region, " << regIndices.first << '\n';
+	mf::LogInfo("CRTHitRecoAlg: ") << "searching for side CRT hits in region, " << region << '\n';
       
-      vector<size_t> indices = regIndices.second;
       
       if(fVerbose)
 	mf::LogInfo("CRTHitRecoAlg: ") << "number of hits associated to this region : " << indices.size() << '\n';
@@ -210,21 +275,17 @@ vector<pair<sbn::crt::CRTHit, vector<int>>> CRTHitRecoAlg::CreateCRTHits(vector<
 	    CRTHit hit = MakeSideHit(coinData);
             
 	    if(IsEmptyHit(hit)){
-	      unusedDataIndex.push_back(indices[index_i]);
-	      nMissM++;
+	      results.unusedDataIndex.push_back(indices[index_i]);
+	      results.nMiss++;
 	    }
 	    else {
 	      if(fVerbose)
 		mf::LogInfo("CRTHitRecoAlg: ") << "MINOS hit produced" << '\n';
               
-	      returnHits.push_back(std::make_pair(hit,dataIds));
+	      results.hits.push_back(std::make_pair(hit,dataIds));
 	      
-	      if ((regs.insert(regIndices.first)).second) 
-		regCounts[regIndices.first] = 1;
-	      else 
-		regCounts[regIndices.first]++;
 	      
-	      nHitM++;
+	      results.nHit++;
 	    }
 	    index_i = index_j-1;
 	    if(index_j==indices.size()-1)
@@ -234,22 +295,7 @@ vector<pair<sbn::crt::CRTHit, vector<int>>> CRTHitRecoAlg::CreateCRTHits(vector<
 	  }//if jth data out of coinc window
 	}//inner loop over data
       }// outer loop over data
-    }//loop over side CRTData products
-    
-    if(fVerbose) {
-          mf::LogInfo("CRT") << returnHits.size() << " CRT hits produced!" << '\n'
-              << "  nHitC: " << nHitC  << " , nHitD: " << nHitD  << " , nHitM: " << nHitM  << '\n'
-              << "  nMisC: " << nMissC << " , nMisD: " << nMissD << " , nMisM: " << nMissM << '\n';
-          auto cts = regCounts.begin();
-          mf::LogInfo("CRT") << " CRT Hits by region" << '\n';
-          while (cts != regCounts.end()) {
-              mf::LogInfo("CRT") << "reg: " << (*cts).first << " , hits: " << (*cts).second << '\n';
-              cts++;
-          }
-    }//if Verbose
-  
-    return returnHits;
-}
+}//CRTHitRecoAlg::MakeSideHitsInRegion()
 //--------------------------------------------------------------------------------------------
 // Function to make filling a CRTHit a bit faster
 sbn::crt::CRTHit CRTHitRecoAlg::FillCRTHit(vector<uint8_t> tfeb_id, map<uint8_t,vector<pair<int,float>>> tpesmap,
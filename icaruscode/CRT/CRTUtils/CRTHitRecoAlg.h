@@ -176,6 +176,20 @@ class icarus::crt::CRTHitRecoAlg {
   // Check if a hit is empty
   bool IsEmptyHit(CRTHit hit);
 
+  //Side CRT hits reconstructed from a single region
+  struct SideHitResults {
+    vector<pair<CRTHit,vector<int>>> hits; ///< hits with their CRTData indices
+    vector<size_t> unusedDataIndex;        ///< indices of data unused in hits
+    uint16_t nHit = 0;                     ///< number of hits produced
+    uint16_t nMiss = 0;                    ///< number of empty hits discarded
+  };
+
+  //Search for side CRT hit coincidences within a single region;
+  //regions are independent, so this may be run on several regions in parallel
+  void MakeSideHitsInRegion(vector<art::Ptr<CRTData>> const& crtList,
+                            string const& region, vector<size_t> const& indices,
+                            SideHitResults& results);
+
   static  bool compareBytime(art::Ptr<CRTData> const &a, art::Ptr<CRTData> const &b){
     return a->fTs0 < b->fTs0;
   }
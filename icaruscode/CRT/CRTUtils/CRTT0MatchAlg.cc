@@ -32,6 +32,7 @@ namespace icarus{
     fDoverLLimit = config.DoverLLimit();
     fPEcut = config.PEcut();
     fMaxUncert = config.MaxUncert();
+    fDCAPrefilterMargin = config.DCAPrefilterMargin();
     //  fDistEndpointAVedge = config.DistEndpointAVedge();
 
     return;
@@ -112,6 +113,21 @@ namespace icarus{
   } // CRTT0MatchAlg::DistToOfClosestApproach()
 
 
+  double CRTT0MatchAlg::TransverseLineDistance(TVector3 const& pos, TVector3 const& dir,
+					       sbn::crt::CRTHit const& crtHit){
+
+    // distance between the track line and the CRT hit centre, both projected
+    // on the y-z plane; being a projection, it can only underestimate the
+    // three-dimensional distance of closest approach
+    double const dy = crtHit.y_pos - pos.Y();
+    double const dz = crtHit.z_pos - pos.Z();
+    double const norm = std::hypot(dir.Y(), dir.Z());
+    if (norm < 1e-6) return std::hypot(dy, dz); // track along the drift direction
+    return std::abs(dir.Y()*dz - dir.Z()*dy) / norm;
+
+  } // CRTT0MatchAlg::TransverseLineDistance()
+
+
   std::pair<TVector3, TVector3> CRTT0MatchAlg::TrackDirectionAverage(recob::Track track, double frac)
   {
     // Calculate direction as an average over directions
@@ -234,9 +250,10 @@ namespace icarus{
 
     auto start = tpcTrack.Vertex<TVector3>();
     auto end = tpcTrack.End<TVector3>();
-    // Get the drift direction from the TPC
-    int driftDirection = TPCGeoUtil::DriftDirectionFromHits(fGeometryService, hits);
-    std::pair<double, double> xLimits = TPCGeoUtil::XLimitsFromHits(fGeometryService, hits);
+    // Get the drift limits and direction from the TPC in a single pass
+    TPCGeoUtil::TPCLimits limits = TPCGeoUtil::LimitsFromHits(fGeometryService, hits);
+    int driftDirection = limits.driftDirection;
+    std::pair<double, double> xLimits = std::make_pair(limits.minX, limits.maxX);
     // Get the allowed t0 range
     std::pair<double, double> t0MinMax = TrackT0Range(detProp, start.X(), end.X(), driftDirection, xLimits);
 
@@ -256,9 +273,10 @@ namespace icarus{
 
     auto start = tpcTrack.Vertex<TVector3>();
     auto end = tpcTrack.End<TVector3>();
-    // Get the drift direction from the TPC
-    int driftDirection = TPCGeoUtil::DriftDirectionFromHits(fGeometryService, hits);
-    std::pair<double, double> xLimits = TPCGeoUtil::XLimitsFromHits(fGeometryService, hits);
+    // Get the drift limits and direction from the TPC in a single pass
+    TPCGeoUtil::TPCLimits limits = TPCGeoUtil::LimitsFromHits(fGeometryService, hits);
+    int driftDirection = limits.driftDirection;
+    std::pair<double, double> xLimits = std::make_pair(limits.minX, limits.maxX);
     // Get the allowed t0 range
     std::pair<double, double> t0MinMax = TrackT0Range(detProp, start.X(), end.X(), driftDirection, xLimits);
 
@@ -283,7 +301,10 @@ namespace icarus{
     //  std::vector<std::pair<sbn::crt::CRTHit, double>> t0Candidates;
     std::vector<matchCand> t0Candidates;
 
-
+    // the average track direction does not depend on the CRT hit:
+    // compute it once instead of once per hit
+    std::pair<TVector3, TVector3> avgStartEndDir;
+    if (fDirMethod==2) avgStartEndDir = TrackDirectionAverage(tpcTrack, fTrackDirectionFrac);
 
     // Loop over all the CRT hits
     for(auto &crtHit : crtHits){
@@ -310,11 +331,23 @@ namespace icarus{
       //Calculate Track direction
       std::pair<TVector3, TVector3> startEndDir;
       // dirmethod=2 is original algorithm, dirmethod=1 is simple algorithm for which SCE corrections are possible
-      if (fDirMethod==2)  startEndDir = TrackDirectionAverage(tpcTrack, fTrackDirectionFrac);
+      if (fDirMethod==2)  startEndDir = avgStartEndDir;
       else startEndDir = TrackDirection(detProp, tpcTrack, fTrackDirectionFrac, crtTime, driftDirection);
       TVector3 startDir = startEndDir.first;
       TVector3 endDir = startEndDir.second;
-    
+
+      // cheap conservative rejection: the DCA cannot be smaller than the
+      // track-hit distance in the y-z projection (which no drift time shift
+      // can change), so hits transversally far from both track lines cannot
+      // pass the distance cut and the expensive extrapolation can be skipped;
+      // the margin covers the space charge corrections (a few cm at most)
+      if (fDCAPrefilterMargin >= 0.) {
+	double allowance = fDistanceLimit + fDCAPrefilterMargin;
+	if (fDCAuseBox) allowance += crtHit.y_err + crtHit.z_err;
+	if (TransverseLineDistance(start, startDir, crtHit) > allowance
+	    && TransverseLineDistance(end, endDir, crtHit) > allowance) continue;
+      }
+
       // Calculate the distance between the crossing point and the CRT hit, SCE corrections are done inside but dropped
       double startDist = DistOfClosestApproach(detProp, start, startDir, crtHit, driftDirection, crtTime);
       double endDist = DistOfClosestApproach(detProp, end, endDir, crtHit, driftDirection, crtTime);
@@ -453,11 +486,14 @@ namespace icarus{
   // Simple distance of closest approach between infinite track and centre of hit
   double CRTT0MatchAlg::SimpleDCA(sbn::crt::CRTHit hit, TVector3 start, TVector3 direction){
 
-    TVector3 pos (hit.x_pos, hit.y_pos, hit.z_pos);
-    TVector3 end = start + direction;
-    double denominator = direction.Mag();
-    double numerator = (pos - start).Cross(pos - end).Mag();
-    return numerator/denominator;
+    double posX = hit.x_pos;
+    double posY = hit.y_pos;
+    double posZ = hit.z_pos;
+    double dca;
+    TPCGeoUtil::PointLineDCA(start.X(), start.Y(), start.Z(),
+                             direction.X(), direction.Y(), direction.Z(),
+                             &posX, &posY, &posZ, 1, &dca);
+    return dca;
 
   }
 
@@ -156,6 +156,12 @@ namespace icarus{
           1000.0
 	  };
 
+      fhicl::Atom<double> DCAPrefilterMargin {
+        Name("DCAPrefilterMargin"),
+          Comment("safety margin (cm) added to DistanceLimit when rejecting hits by transverse track-hit distance before the full DCA computation; negative = no prefilter"),
+          30.0
+	  };
+
       /* fhicl::Atom<double> DistEndpointAVedge { */
       /*   Name("DistEndpointAVedge"), */
       /*     Comment("Max distance allowed from track endpoint to edge of FV along track extrapolation to CRT hit (cm)"), */
@@ -226,6 +232,10 @@ namespace icarus{
     // Simple distance of closest approach between infinite track and centre of hit
     double SimpleDCA(sbn::crt::CRTHit hit, TVector3 start, TVector3 direction);
 
+    // Distance between infinite track and centre of hit projected on the y-z plane;
+    // a lower bound to the DCA which no drift time shift along x can change
+    static double TransverseLineDistance(TVector3 const& pos, TVector3 const& dir, sbn::crt::CRTHit const& crtHit);
+
     // Minimum distance from infinite track to CRT hit assuming that hit is a 2D square
     double DistToCrtHit(sbn::crt::CRTHit hit, TVector3 start, TVector3 end);
 
@@ -254,6 +264,7 @@ namespace icarus{
     double fDoverLLimit;
     double fPEcut;
     double fMaxUncert;
+    double fDCAPrefilterMargin;
     //    double fDistEndpointAVedge;
 
     art::InputTag fTPCTrackLabel;
@@ -35,7 +35,10 @@ std::vector<std::vector<art::Ptr<sbn::crt::CRTHit>>> CRTTrackRecoAlg::CreateCRTT
 {
 
   std::vector<std::vector<art::Ptr<sbn::crt::CRTHit>>> crtTzeroVect;
-  int iflag[2000] = {};
+  // Reuse the flag buffer across calls: zeroing a fixed-size array every
+  // event dominated for the typical few-hit event, and the old 2000-slot
+  // array silently overflowed beyond that
+  fHitUsed.assign(hits.size(), 0);
 
   // Sort CRTHits by time
   std::sort(hits.begin(), hits.end(), [](auto& left, auto& right)->bool{
@@ -44,10 +47,10 @@ std::vector<std::vector<art::Ptr<sbn::crt::CRTHit>>> CRTTrackRecoAlg::CreateCRTT
   // Loop over crt hits
   for(size_t i = 0; i<hits.size(); i++){
       //if hit unused
-      if(iflag[i] == 0){
+      if(fHitUsed[i] == 0){
 	vector<art::Ptr<sbn::crt::CRTHit>> crtTzero;
           double time_ns_A = hits[i]->ts0_ns;
-          iflag[i]=1;
+          fHitUsed[i]=1;
           crtTzero.push_back(hits[i]);
 
           // Sort into a Tzero collection
@@ -55,12 +58,12 @@ std::vector<std::vector<art::Ptr<sbn::crt::CRTHit>>> CRTTrackRecoAlg::CreateCRTT
           for(size_t j = i+1; j<hits.size(); j++){
 
               //if hit unused
-              if(iflag[j] == 0){
+              if(fHitUsed[j] == 0){
                   // If ts1_ns - ts1_ns < diff then put them in a vector
                   double time_ns_B = hits[j]->ts0_ns;
                   double diff = std::abs(time_ns_B - time_ns_A) * 1e-3; // [us]
                   if(diff < fTimeLimit){
-                      iflag[j] = 1; //mark hit used
+                      fHitUsed[j] = 1; //mark hit used
                       crtTzero.push_back(hits[j]);
                   }
               }
@@ -114,7 +117,7 @@ sbn::crt::CRTTrack CRTTrackRecoAlg::FillCrtTrack(sbn::crt::CRTHit hit1, sbn::crt
 } // CRTTrackRecoAlg::FillCrtTrack()
 
 // Function to average hits within a certain distance of each other w/associations
-vector<pair<sbn::crt::CRTHit, vector<int>>> CRTTrackRecoAlg::AverageHits(vector<art::Ptr<sbn::crt::CRTHit>> hits, map<art::Ptr<sbn::crt::CRTHit>, int> hitIds)
+vector<pair<sbn::crt::CRTHit, vector<int>>> CRTTrackRecoAlg::AverageHits(vector<art::Ptr<sbn::crt::CRTHit>> const& hits, map<art::Ptr<sbn::crt::CRTHit>, int> const& hitIds)
 {
     vector<pair<sbn::crt::CRTHit, vector<int>>> returnHits;
     vector<art::Ptr<sbn::crt::CRTHit>> aveHits;
@@ -152,7 +155,7 @@ vector<pair<sbn::crt::CRTHit, vector<int>>> CRTTrackRecoAlg::AverageHits(vector<
 	  sbn::crt::CRTHit aveHit = DoAverage(aveHits);
 	  vector<int> ids;
         for(size_t i = 0; i < aveHits.size(); i++){
-            ids.push_back(hitIds[aveHits[i]]);
+            ids.push_back(hitIds.at(aveHits[i]));
         }
 
         returnHits.push_back(std::make_pair(aveHit, ids));
@@ -171,7 +174,7 @@ vector<pair<sbn::crt::CRTHit, vector<int>>> CRTTrackRecoAlg::AverageHits(vector<
 } // CRTTrackRecoAlg::AverageHits()
 
 //average clustered CRTHits together (w/o keeping associations)
-vector<sbn::crt::CRTHit> CRTTrackRecoAlg::AverageHits(vector<art::Ptr<sbn::crt::CRTHit>> hits)
+vector<sbn::crt::CRTHit> CRTTrackRecoAlg::AverageHits(vector<art::Ptr<sbn::crt::CRTHit>> const& hits)
 {
     vector<sbn::crt::CRTHit> returnHits;
     vector<art::Ptr<sbn::crt::CRTHit>> aveHits;
@@ -214,7 +217,7 @@ vector<sbn::crt::CRTHit> CRTTrackRecoAlg::AverageHits(vector<art::Ptr<sbn::crt::
 } // CRTTrackRecoAlg::AverageHits()
   
 // Take a list of hits and find average parameters
-sbn::crt::CRTHit CRTTrackRecoAlg::DoAverage(vector<art::Ptr<sbn::crt::CRTHit>> hits)
+sbn::crt::CRTHit CRTTrackRecoAlg::DoAverage(vector<art::Ptr<sbn::crt::CRTHit>> const& hits)
 {
   //std::cout << "hits inside CRTTrackRecoAlg::DoAverage:++++++++++++++++ "<< hits[0] << std::endl;
   // Initialize values
@@ -258,7 +261,7 @@ sbn::crt::CRTHit CRTTrackRecoAlg::DoAverage(vector<art::Ptr<sbn::crt::CRTHit>> h
 } // CRTTrackRecoAlg::DoAverage()
 
 // Function to create tracks from tzero hit collections
-vector<pair<sbn::crt::CRTTrack, vector<int>>> CRTTrackRecoAlg::CreateTracks(vector<pair<sbn::crt::CRTHit, vector<int>>> hits)
+vector<pair<sbn::crt::CRTTrack, vector<int>>> CRTTrackRecoAlg::CreateTracks(vector<pair<sbn::crt::CRTHit, vector<int>>> const& hits)
 {
     vector<pair<sbn::crt::CRTTrack, vector<int>>> returnTracks;
 
@@ -269,11 +272,11 @@ vector<pair<sbn::crt::CRTTrack, vector<int>>> CRTTrackRecoAlg::CreateTracks(vect
     //Calculate the distance between all hits on different planes
     for(size_t i = 0; i < hits.size(); i++){
 
-        sbn::crt::CRTHit hit1 = hits[i].first;
+        sbn::crt::CRTHit const& hit1 = hits[i].first;
 
         for(size_t j = 0; j < hits.size(); j++){
 
-            sbn::crt::CRTHit hit2 = hits[j].first;
+            sbn::crt::CRTHit const& hit2 = hits[j].first;
             pair<size_t, size_t> hitPair = std::make_pair(i, j);
             pair<size_t, size_t> rhitPair = std::make_pair(j, i);
 
@@ -302,8 +305,8 @@ vector<pair<sbn::crt::CRTTrack, vector<int>>> CRTTrackRecoAlg::CreateTracks(vect
 
         //Make sure bottom plane hit is always hit_i
         if(hits[hit_j].first.tagger=="volTaggerBot_0") std::swap(hit_i, hit_j);
-        sbn::crt::CRTHit ihit = hits[hit_i].first;
-        sbn::crt::CRTHit jhit = hits[hit_j].first;
+        sbn::crt::CRTHit const& ihit = hits[hit_i].first;
+        sbn::crt::CRTHit const& jhit = hits[hit_j].first;
 
         //If the bottom plane hit is a 1D hit
         if(ihit.x_err>100. || ihit.z_err>100.){
@@ -329,7 +332,7 @@ vector<pair<sbn::crt::CRTTrack, vector<int>>> CRTTrackRecoAlg::CreateTracks(vect
                         continue;
 
                     //Calculate the distance between the track crossing point and the true hit
-                    sbn::crt::CRTHit khit = hits[k].first;
+                    sbn::crt::CRTHit const& khit = hits[k].first;
                     TVector3 mid(khit.x_pos, khit.y_pos, khit.z_pos);
                     TVector3 cross = CrossPoint(khit, start, diff);
                     double dist = (cross-mid).Mag();
@@ -374,7 +377,7 @@ vector<pair<sbn::crt::CRTTrack, vector<int>>> CRTTrackRecoAlg::CreateTracks(vect
                     continue;
 
                 //Calculate distance to other hits not on the planes of the track hits
-		sbn::crt::CRTHit khit = hits[k].first;
+		sbn::crt::CRTHit const& khit = hits[k].first;
                 TVector3 mid(khit.x_pos, khit.y_pos, khit.z_pos);
                 TVector3 cross = CrossPoint(khit, start, diff);
                 double dist = (cross-mid).Mag();
@@ -451,7 +454,7 @@ vector<pair<sbn::crt::CRTTrack, vector<int>>> CRTTrackRecoAlg::CreateTracks(vect
 } // CRTTrackRecoAlg::CreateTracks()
 
 //Create tracks from CRTHits
-vector<sbn::crt::CRTTrack> CRTTrackRecoAlg::CreateTracks(vector<sbn::crt::CRTHit> hits)
+vector<sbn::crt::CRTTrack> CRTTrackRecoAlg::CreateTracks(vector<sbn::crt::CRTHit> const& hits)
 {
     vector<sbn::crt::CRTTrack> returnTracks;
     //Store list of hit pairs with distance between them
@@ -460,10 +463,10 @@ vector<sbn::crt::CRTTrack> CRTTrackRecoAlg::CreateTracks(vector<sbn::crt::CRTHit
 
     //Calculate the distance between all hits on different planes
     for(size_t i = 0; i < hits.size(); i++){
-        sbn::crt::CRTHit hit1 = hits[i];
+        sbn::crt::CRTHit const& hit1 = hits[i];
         for(size_t j = 0; j < hits.size(); j++){
 
-            sbn::crt::CRTHit hit2 = hits[j];
+            sbn::crt::CRTHit const& hit2 = hits[j];
             pair<size_t, size_t> hitPair = std::make_pair(i, j);
             pair<size_t, size_t> rhitPair = std::make_pair(j, i);
 
@@ -494,8 +497,8 @@ vector<sbn::crt::CRTTrack> CRTTrackRecoAlg::CreateTracks(vector<sbn::crt::CRTHit
         if(hits[hit_j].tagger=="volTaggerBot_0") 
             std::swap(hit_i, hit_j);
 
-        sbn::crt::CRTHit ihit = hits[hit_i];
-        sbn::crt::CRTHit jhit = hits[hit_j];
+        sbn::crt::CRTHit const& ihit = hits[hit_i];
+        sbn::crt::CRTHit const& jhit = hits[hit_j];
 
         //If the bottom plane hit is a 1D hit
         if(ihit.x_err>100. || ihit.z_err>100.){
@@ -521,7 +524,7 @@ vector<sbn::crt::CRTTrack> CRTTrackRecoAlg::CreateTracks(vector<sbn::crt::CRTHit
                         continue;
 
                     //Calculate the distance between the track crossing point and the true hit
-                    sbn::crt::CRTHit khit = hits[k];
+                    sbn::crt::CRTHit const& khit = hits[k];
                     TVector3 mid(khit.x_pos, khit.y_pos, khit.z_pos);
                     TVector3 cross = CrossPoint(khit, start, diff);
                     double dist = (cross-mid).Mag();
@@ -563,7 +566,7 @@ vector<sbn::crt::CRTTrack> CRTTrackRecoAlg::CreateTracks(vector<sbn::crt::CRTHit
                     continue;
 
                 //Calculate distance to other hits not on the planes of the track hits
-		sbn::crt::CRTHit khit = hits[k];
+		sbn::crt::CRTHit const& khit = hits[k];
                 TVector3 mid(khit.x_pos, khit.y_pos, khit.z_pos);
                 TVector3 cross = CrossPoint(khit, start, diff);
                 double dist = (cross-mid).Mag();
@@ -634,7 +637,7 @@ vector<sbn::crt::CRTTrack> CRTTrackRecoAlg::CreateTracks(vector<sbn::crt::CRTHit
 } // CRTTrackRecoAlg::CreateTracks()
 
 // Function to calculate the crossing point of a track and tagger
-TVector3 CRTTrackRecoAlg::CrossPoint(sbn::crt::CRTHit hit, TVector3 start, TVector3 diff)//FIXME change to DCA
+TVector3 CRTTrackRecoAlg::CrossPoint(sbn::crt::CRTHit const& hit, TVector3 start, TVector3 diff)//FIXME change to DCA
 {
     TVector3 cross;
     // Use the error to get the fixed coordinate of a tagger
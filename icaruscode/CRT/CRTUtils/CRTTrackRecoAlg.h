@@ -100,18 +100,18 @@ namespace crt{
     sbn::crt::CRTTrack FillCrtTrack(sbn::crt::CRTHit hit1, sbn::crt::CRTHit hit2, bool complete);
 
     // Function to average hits within a certain distance of each other
-    vector<pair<sbn::crt::CRTHit, vector<int>>> AverageHits(vector<art::Ptr<sbn::crt::CRTHit>> hits, map<art::Ptr<sbn::crt::CRTHit>, int> hitIds);
-    vector<sbn::crt::CRTHit> AverageHits(vector<art::Ptr<sbn::crt::CRTHit>> hits);
+    vector<pair<sbn::crt::CRTHit, vector<int>>> AverageHits(vector<art::Ptr<sbn::crt::CRTHit>> const& hits, map<art::Ptr<sbn::crt::CRTHit>, int> const& hitIds);
+    vector<sbn::crt::CRTHit> AverageHits(vector<art::Ptr<sbn::crt::CRTHit>> const& hits);
 
     // Take a list of hits and find average parameters
-    sbn::crt::CRTHit DoAverage(vector<art::Ptr<sbn::crt::CRTHit>> hits);
+    sbn::crt::CRTHit DoAverage(vector<art::Ptr<sbn::crt::CRTHit>> const& hits);
 
     // Create CRTTracks from list of hits
-    vector<pair<sbn::crt::CRTTrack, vector<int>>> CreateTracks(vector<pair<sbn::crt::CRTHit, vector<int>>> hits);
-    vector<sbn::crt::CRTTrack> CreateTracks(vector<sbn::crt::CRTHit> hits);
+    vector<pair<sbn::crt::CRTTrack, vector<int>>> CreateTracks(vector<pair<sbn::crt::CRTHit, vector<int>>> const& hits);
+    vector<sbn::crt::CRTTrack> CreateTracks(vector<sbn::crt::CRTHit> const& hits);
 
     // Calculate the tagger crossing point of CRTTrack candidate
-    TVector3 CrossPoint(sbn::crt::CRTHit hit, TVector3 start, TVector3 diff);
+    TVector3 CrossPoint(sbn::crt::CRTHit const& hit, TVector3 start, TVector3 diff);
 
   private:
 
@@ -121,6 +121,11 @@ namespace crt{
     double fAverageHitDistance;
     double fDistanceLimit;
 
+    // Hit-used flags reused by CreateCRTTzeros() across calls: for the
+    // high-rate streams most events have few hits and re-creating working
+    // containers every event dominated over the actual clustering
+    vector<char> fHitUsed;
+
     CRTHitRecoAlg hitAlg;
 
   };
@@ -182,3 +182,22 @@ double RecoUtils::CalculateTrackLength(const art::Ptr<recob::Track> track){
   }
   return length;
 }
+
+RecoUtils::TrackIDToMCParticleMap RecoUtils::BuildTrackIDToMCParticleMap(const std::vector<simb::MCParticle>& particleVec){
+  TrackIDToMCParticleMap trackIDToMCParticleMap;
+  trackIDToMCParticleMap.reserve(particleVec.size());
+  for (const simb::MCParticle& particle : particleVec)
+    trackIDToMCParticleMap[particle.TrackId()] = &particle;
+  return trackIDToMCParticleMap;
+}
+
+RecoUtils::TrackIDToChanToTDCToIDEMap RecoUtils::BuildTrackIDToSimChannelIndex(const std::vector<sim::SimChannel>& simChannelVec){
+  TrackIDToChanToTDCToIDEMap trackIDToChanToTDCToIDEMap;
+  for (const sim::SimChannel& simChannel : simChannelVec){
+    for (const auto& tdcide : simChannel.TDCIDEMap()){
+      for (const sim::IDE& ide : tdcide.second)
+        trackIDToChanToTDCToIDEMap[ide.trackID][simChannel.Channel()][tdcide.first] = ide;
+    }
+  }
+  return trackIDToChanToTDCToIDEMap;
+}
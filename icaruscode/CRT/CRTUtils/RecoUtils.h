@@ -26,6 +26,7 @@
 #include "nusimdata/SimulationBase/MCTruth.h"
 #include "lardataobj/RecoBase/Hit.h"
 #include "lardataobj/RecoBase/Track.h"
+#include "lardataobj/Simulation/SimChannel.h"
 //#include "lardataobj/RecoBase/Track.h"
 //#include "lardataobj/RecoBase/Shower.h"
 //#include "lardataobj/AnalysisBase/MVAPIDResult.h"
@@ -38,6 +39,7 @@ namespace detinfo { class DetectorClocksData; }
 // c++
 #include <vector>
 #include <map>
+#include <unordered_map>
 
 // ROOT
 #include "TTree.h"
@@ -74,8 +76,25 @@ namespace RecoUtils{
 
   // Calculates the total length of a recob::track by summing up the distances between adjacent traj. points
 
-  double CalculateTrackLength(const art::Ptr<recob::Track> track); 
-  
+  double CalculateTrackLength(const art::Ptr<recob::Track> track);
+
+  // Index from geant4 track ID to the MCParticle with that track ID, for constant time lookups.
+  // The pointers point into the input vector, so the index is only good for as long as that is
+
+  using TrackIDToMCParticleMap = std::unordered_map<int, const simb::MCParticle*>;
+
+  TrackIDToMCParticleMap BuildTrackIDToMCParticleMap(const std::vector<simb::MCParticle>& particleVec);
+
+  // Index of the SimChannel energy deposits keyed by geant4 track ID, then channel, then TDC tick,
+  // so the deposits of one true particle on one wire can be found without scanning all the SimChannels.
+  // Several analyzers used to re-derive this same structure per event
+
+  using TDCToIDEMap                = std::map<unsigned short, sim::IDE>;
+  using ChanToTDCToIDEMap          = std::map<raw::ChannelID_t, TDCToIDEMap>;
+  using TrackIDToChanToTDCToIDEMap = std::unordered_map<int, ChanToTDCToIDEMap>;
+
+  TrackIDToChanToTDCToIDEMap BuildTrackIDToSimChannelIndex(const std::vector<sim::SimChannel>& simChannelVec);
+
 }
 
 #endif
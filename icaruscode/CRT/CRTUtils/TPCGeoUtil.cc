@@ -1,5 +1,7 @@
 #include "TPCGeoUtil.h"
 
+#include <cmath>
+
 namespace icarus {
   namespace TPCGeoUtil {
     int DetectedInTPC(std::vector<art::Ptr<recob::Hit>> hits){
@@ -40,6 +42,23 @@ namespace icarus {
       return driftDirection;
     }
 
+    TPCLimits LimitsFromHits(const geo::GeometryCore *GeometryService, std::vector<art::Ptr<recob::Hit>> const& hits){
+      // Defaults (no drift direction, zero limits) apply when there are no
+      // hits or the track is stitched (in multiple TPCs), matching what
+      // XLimitsFromHits() and DriftDirectionFromHits() return in those cases
+      TPCLimits limits;
+      if(hits.size() == 0) return limits;
+      if(DetectedInTPC(hits) == -1) return limits;
+
+      geo::TPCID tpcID = hits[0]->WireID().asTPCID();
+      const geo::TPCGeo& tpcGeo = GeometryService->GetElement(tpcID);
+      limits.minX = tpcGeo.MinX();
+      limits.maxX = tpcGeo.MaxX();
+      double driftDirection = tpcGeo.DetectDriftDirection();
+      if(std::abs(driftDirection) == 1) limits.driftDirection = driftDirection;
+      return limits;
+    }
+
     // Is point inside given TPC
     bool InsideTPC(geo::Point_t point, const geo::TPCGeo& tpc, double buffer){
       if(point.X() < (tpc.MinX()-buffer) || point.X() > (tpc.MaxX()+buffer)
@@ -48,6 +67,26 @@ namespace icarus {
       return true;
     }
 
+    void PointLineDCA(double startX, double startY, double startZ,
+                      double dirX, double dirY, double dirZ,
+                      const double* pointX, const double* pointY, const double* pointZ,
+                      std::size_t nPoints, double* dca){
+      // The loop body is plain componentwise arithmetic on parallel arrays
+      // with no branches, so the compiler can unroll and vectorize it; the
+      // products are grouped pairwise to allow fused multiply-add contraction
+      double norm = std::sqrt(dirX*dirX + dirY*dirY + dirZ*dirZ);
+      double invNorm = (norm > 0.) ? 1./norm : 0.;
+      for(std::size_t i = 0; i < nPoints; i++){
+        double dx = pointX[i] - startX;
+        double dy = pointY[i] - startY;
+        double dz = pointZ[i] - startZ;
+        double crossX = dy*dirZ - dz*dirY;
+        double crossY = dz*dirX - dx*dirZ;
+        double crossZ = dx*dirY - dy*dirX;
+        dca[i] = std::sqrt(crossX*crossX + crossY*crossY + crossZ*crossZ)*invNorm;
+      }
+    }
+
   } // namespace TPCGeoUtil
 } // namespace icarus
 
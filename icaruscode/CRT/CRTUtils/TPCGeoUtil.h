@@ -17,16 +17,34 @@
 #include "lardataobj/RecoBase/Hit.h"
 
 // c++
+#include <cstddef>
 #include <vector>
 
 namespace icarus {
   namespace TPCGeoUtil {
+    // Frozen snapshot of the drift boundaries of the TPC a hit collection
+    // lives in; filled with a single pass over the hits and a single geometry
+    // lookup, so callers needing both the limits and the drift direction do
+    // not scan the collection twice
+    struct TPCLimits {
+      int driftDirection = 0;
+      double minX = 0.;
+      double maxX = 0.;
+    };
     int DetectedInTPC(std::vector<art::Ptr<recob::Hit>> hits);
     // Work out the drift limits for a collection of hits
     std::pair<double, double> XLimitsFromHits(const geo::GeometryCore *GeometryService, std::vector<art::Ptr<recob::Hit>> hits);
+    // Work out the drift limits and direction together in one pass
+    TPCLimits LimitsFromHits(const geo::GeometryCore *GeometryService, std::vector<art::Ptr<recob::Hit>> const& hits);
     // Is point inside given TPC
     bool InsideTPC(geo::Point_t point, const geo::TPCGeo& tpc, double buffer);
     int DriftDirectionFromHits(const geo::GeometryCore *GeometryService, std::vector<art::Ptr<recob::Hit>> hits);
+    // Distance of closest approach between an infinite line and each point of
+    // a batch stored as parallel coordinate arrays
+    void PointLineDCA(double startX, double startY, double startZ,
+                      double dirX, double dirY, double dirZ,
+                      const double* pointX, const double* pointY, const double* pointZ,
+                      std::size_t nPoints, double* dca);
   } // namespace TPCGeoUtil
 } // namespace icarus
 #endif
@@ -0,0 +1,119 @@
+#include "icaruscode/CRT/CRTUtils/TimeCoincidenceSweep.h"
+
+#include <array>
+#include <cmath>
+#include <cstring>
+
+using namespace icarus::crt;
+
+void TimeCoincidenceSweep::AddEntry(double time, size_t index, int stream) {
+    fTimeline.push_back({time, index, stream});
+}
+
+void TimeCoincidenceSweep::Reserve(size_t n) {
+    fTimeline.reserve(fTimeline.size()+n);
+}
+
+void TimeCoincidenceSweep::Clear() {
+    fTimeline.clear();
+}
+
+uint64_t TimeCoincidenceSweep::SortKey(double time) {
+
+    uint64_t bits;
+    std::memcpy(&bits, &time, sizeof(bits));
+    //flip everything for negative values, only the sign bit for positive ones:
+    //the resulting unsigned keys sort like the original doubles
+    if(bits & 0x8000000000000000ULL) return ~bits;
+    return bits ^ 0x8000000000000000ULL;
+}
+
+void TimeCoincidenceSweep::Sort() {
+
+    //LSD radix sort of the time line on the 8 bytes of the time key,
+    //least significant byte first: 8 counting-sort passes, no comparisons
+    size_t const n = fTimeline.size();
+    if(n < 2) return;
+
+    std::vector<uint64_t> keys(n);
+    for(size_t i=0; i<n; i++) keys[i] = SortKey(fTimeline[i].time);
+
+    std::vector<Entry>    scratch(n);
+    std::vector<uint64_t> scratchKeys(n);
+
+    for(int shift=0; shift<64; shift+=8) {
+
+        std::array<size_t,257> count{};
+        for(size_t i=0; i<n; i++)
+            count[((keys[i]>>shift)&0xFFU)+1]++;
+        for(size_t b=1; b<257; b++) count[b] += count[b-1];
+
+        for(size_t i=0; i<n; i++) {
+            size_t const dest = count[(keys[i]>>shift)&0xFFU]++;
+            scratch[dest] = fTimeline[i];
+            scratchKeys[dest] = keys[i];
+        }
+
+        fTimeline.swap(scratch);
+        keys.swap(scratchKeys);
+    }
+}
+
+std::vector<TimeCoincidenceSweep::Pair>
+TimeCoincidenceSweep::WindowPairs(int probeStream, int candStream, double window) const {
+
+    std::vector<Pair> pairs;
+
+    //single sweep: as the probes come in time order, the beginning of their
+    //candidate window only ever moves forward
+    size_t lo = 0;
+    for(size_t i=0; i<fTimeline.size(); i++) {
+
+        if(fTimeline[i].stream != probeStream) continue;
+        double const tprobe = fTimeline[i].time;
+
+        while(lo < fTimeline.size() && fTimeline[lo].time < tprobe-window) lo++;
+
+        for(size_t j=lo; j<fTimeline.size() && fTimeline[j].time <= tprobe+window; j++) {
+            if(fTimeline[j].stream != candStream) continue;
+            pairs.push_back({fTimeline[i].index, fTimeline[j].index, tprobe-fTimeline[j].time});
+        }
+    }
+
+    return pairs;
+}
+
+std::vector<TimeCoincidenceSweep::Pair>
+TimeCoincidenceSweep::ClosestPairs(int probeStream, int candStream) const {
+
+    std::vector<Pair> pairs;
+
+    //walk the sorted time line keeping the latest candidate seen so far;
+    //the closest candidate to a probe is either that one or the next one,
+    //found by a second cursor that also only moves forward
+    size_t const n = fTimeline.size();
+    size_t lastCand = n; //n = none yet
+    size_t nextCand = 0;
+
+    for(size_t i=0; i<n; i++) {
+
+        if(fTimeline[i].stream == candStream) { lastCand = i; continue; }
+        if(fTimeline[i].stream != probeStream) continue;
+
+        if(nextCand <= i) nextCand = i+1;
+        while(nextCand < n && fTimeline[nextCand].stream != candStream) nextCand++;
+
+        double const tprobe = fTimeline[i].time;
+        size_t best = n;
+        if(lastCand < n) best = lastCand;
+        if(nextCand < n &&
+           (best == n ||
+            std::abs(tprobe-fTimeline[nextCand].time) < std::abs(tprobe-fTimeline[best].time)))
+            best = nextCand;
+
+        if(best < n)
+            pairs.push_back({fTimeline[i].index, fTimeline[best].index, tprobe-fTimeline[best].time});
+    }
+
+    return pairs;
+}
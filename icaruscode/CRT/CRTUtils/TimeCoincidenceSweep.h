@@ -0,0 +1,76 @@
+#ifndef IC_TIMECOINCIDENCESWEEP_H
+#define IC_TIMECOINCIDENCESWEEP_H
+
+///////////////////////////////////////////////////////////////////////////
+// TimeCoincidenceSweep
+//
+// Merged time-line engine for CRT-PMT (and similar) time coincidences.
+// All the collections of interest (CRT hits, optical flashes, optical
+// hits, ...) are entered as timestamped entries tagged by a stream code,
+// the merged time line is radix-sorted once, and then:
+//  * WindowPairs() emits, with a single sweep of the time line, every
+//    (probe, candidate) pair closer in time than a given window;
+//  * ClosestPairs() emits for every probe entry the candidate entry
+//    closest in time, regardless of any window.
+// The pairs come out as flat arrays so that the caller can classify the
+// candidates in a tight loop, instead of re-scanning one collection for
+// every element of the other (which is O(N x M)).
+//
+// Used by CRTPMTMatchingAna; intended to be shared with the trigger-level
+// cosmic veto studies.
+///////////////////////////////////////////////////////////////////////////
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace icarus{
+ namespace crt {
+    class TimeCoincidenceSweep;
+ }
+}
+
+class icarus::crt::TimeCoincidenceSweep {
+
+ public:
+
+    //one timestamped entry of the merged time line
+    struct Entry {
+        double   time;   //timestamp, in whatever (common!) units the caller uses
+        size_t   index;  //index of the entry in its source collection
+        int      stream; //code of the source collection
+    };
+
+    //one (probe, candidate) coincidence
+    struct Pair {
+        size_t   probe;      //index of the probe in its source collection
+        size_t   cand;       //index of the candidate in its source collection
+        double   dt;         //probe time - candidate time
+    };
+
+    void     AddEntry(double time, size_t index, int stream);
+    void     Reserve(size_t n);
+    void     Clear();
+
+    //sorts the merged time line; call once, after all the AddEntry() calls
+    void     Sort();
+
+    //all the candidates of stream candStream within +/-window of each entry
+    //of stream probeStream, in time order of the probes
+    std::vector<Pair> WindowPairs(int probeStream, int candStream, double window) const;
+
+    //the single candidate of stream candStream closest in time to each entry
+    //of stream probeStream (at most one pair per probe)
+    std::vector<Pair> ClosestPairs(int probeStream, int candStream) const;
+
+ private:
+
+    std::vector<Entry> fTimeline; //the merged time line (sorted after Sort())
+
+    //maps a double onto an unsigned key with the same ordering,
+    //so that the time line can be radix-sorted byte by byte
+    static uint64_t SortKey(double time);
+
+};
+
+#endif
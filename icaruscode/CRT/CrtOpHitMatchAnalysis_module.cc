@@ -38,6 +38,7 @@
 #include "sbnobj/Common/CRT/CRTTrack.hh"
 #include "icaruscode/CRT/CRTUtils/CRTCommonUtils.h"
 #include "icaruscode/CRT/CRTUtils/CRTBackTracker.h"
+#include "icaruscode/Utilities/AssnsPrefetch.h"
 
 //C++ includes
 #include <vector>
@@ -355,6 +356,14 @@ void CrtOpHitMatchAnalysis::analyze(art::Event const& e)
           art::fill_ptr_vector(opFlashLists[i], flashHandles[i]);
   }
 
+  //resolve the flash->ophit associations once per event: the per-CRTHit loop
+  //below queries them for every CRT hit, and rebuilding a FindManyP there
+  //re-resolved the whole association product each time
+  std::map<int,util::AssnsPrefetch<recob::OpFlash,recob::OpHit>> flashToHits;
+  for(auto const& flashList : opFlashLists)
+      flashToHits[flashList.first] = util::prefetchAssns<recob::OpHit>(
+              e, flashHandles[flashList.first], fFlashLabels[flashList.first]);
+
   for(auto const& flashList : opFlashLists) {
       fNFlash +=  flashList.second.size();
 
@@ -413,15 +422,18 @@ void CrtOpHitMatchAnalysis::analyze(art::Event const& e)
   if( e.getByLabel(fCrtTrackModuleLabel,crtTrackListHandle))
       art::fill_ptr_vector(crtTrackList, crtTrackListHandle);
 
-  art::FindManyP<CRTHit> findManyHits(
-          crtTrackListHandle, e, fCrtTrackModuleLabel);
+  //no track product, no associations to resolve (and nothing to loop on)
+  auto const trackToHits = crtTrackListHandle.isValid()
+      ? util::prefetchAssns<CRTHit>(e, crtTrackListHandle, fCrtTrackModuleLabel)
+      : util::AssnsPrefetch<sbn::crt::CRTTrack,CRTHit>{};
 
 
   //get time-ordered(ascending) vector of hits for each track
-  std::vector<std::vector<art::Ptr<CRTHit>>> trackhits; 
+  std::vector<std::vector<art::Ptr<CRTHit>>> trackhits;
   for(size_t itrk=0; itrk<crtTrackList.size(); itrk++){
 
-      std::vector<art::Ptr<CRTHit>> trkhits = findManyHits.at(itrk);
+      auto const trkHitSpan = trackToHits.at(itrk);
+      std::vector<art::Ptr<CRTHit>> trkhits(trkHitSpan.begin(),trkHitSpan.end());
       std::sort(trkhits.begin(),trkhits.end(),
         [](const art::Ptr<CRTHit>& a, const art::Ptr<CRTHit>& b)->bool
         { 
@@ -564,8 +576,7 @@ void CrtOpHitMatchAnalysis::analyze(art::Event const& e)
 
       for(auto const& flashList : opFlashLists) {
 
-          art::FindManyP<recob::OpHit> findManyHits(
-                    flashHandles[flashList.first], e, fFlashLabels[flashList.first]);
+          auto const& findManyHits = flashToHits[flashList.first];
 
           for(size_t iflash=0; iflash<flashList.second.size(); iflash++) { 
 
@@ -589,7 +600,7 @@ void CrtOpHitMatchAnalysis::analyze(art::Event const& e)
                   matched = true;
                   matchtpc = flashList.first;
 
-                  vector<art::Ptr<recob::OpHit>> hits = findManyHits.at(iflash);
+                  auto const hits = findManyHits.at(iflash);
                   for(auto const& hit : hits) {
                       double tPmt = hit->PeakTime()*1.e3-fOpDelay;
                       if( tPmt < flashHitT) {
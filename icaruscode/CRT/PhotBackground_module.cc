@@ -65,6 +65,15 @@ private:
 
     int EnteredLar(const TLorentzVector& v, bool& iv, bool& fv);
 
+    // Result of the region walk over one muon trajectory. Several brems
+    // photons can share the same mother muon and the walk is identical for
+    // all of them, so it is done once per muon and the result cached
+    struct MuTrajRegions {
+        vector<int> regs;
+        bool iv = false;
+        bool av = false;
+    };
+
     crt::CRTBackTracker bt;
     crt::CRTCommonUtils* fCrtutils;
 
@@ -138,6 +147,7 @@ void PhotBackground::analyze(art::Event const& e)
     art::Handle< vector<sbn::crt::CRTHit> > trueHitHandle;
     vector< art::Ptr<sbn::crt::CRTHit> > trueHitList;
     map<int,vector<art::Ptr<sbn::crt::CRTHit>>> muToTrueHits;
+    map<int,MuTrajRegions> muTrajCache;
 
     if( e.getByLabel("crttruehit",trueHitHandle) ) 
         art::fill_ptr_vector(trueHitList,trueHitHandle);
@@ -192,7 +202,8 @@ void PhotBackground::analyze(art::Event const& e)
 
 
 
-        if(idToMu.find(phot->Mother())==idToMu.end())
+        auto const itMu = idToMu.find(phot->Mother());
+        if(itMu==idToMu.end())
             throw cet::exception("PhotBackground") <<
                   "no match muon found for mubrems photons" << std::endl;
 
@@ -221,12 +232,24 @@ void PhotBackground::analyze(art::Event const& e)
             }
         }
 
-        for(size_t i=0; i<idToMu[phot->Mother()]->NumberTrajectoryPoints(); i++){
+        auto itTraj = muTrajCache.find(phot->Mother());
+        if(itTraj==muTrajCache.end()){
+
+            MuTrajRegions trajRegions;
+
+            for(size_t i=0; i<itMu->second->NumberTrajectoryPoints(); i++){
 
-            const TLorentzVector& position = idToMu[phot->Mother()]->Position(i);
-            fMuRegs.push_back(EnteredLar(position, fMuIV, fMuAV));
+                const TLorentzVector& position = itMu->second->Position(i);
+                trajRegions.regs.push_back(EnteredLar(position, trajRegions.iv, trajRegions.av));
+
+            }//for traj pts
+
+            itTraj = muTrajCache.emplace(phot->Mother(),std::move(trajRegions)).first;
+        }
 
-        }//for traj pts
+        fMuIV = itTraj->second.iv;
+        fMuAV = itTraj->second.av;
+        fMuRegs.insert(fMuRegs.end(),itTraj->second.regs.begin(),itTraj->second.regs.end());
 
         std::sort(fMuRegs.begin(),fMuRegs.end());
         fMuRegs.resize(std::distance(fMuRegs.begin(),std::unique(fMuRegs.begin(),fMuRegs.end())));
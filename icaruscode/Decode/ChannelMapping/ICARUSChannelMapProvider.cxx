@@ -19,7 +19,124 @@
 
 #include <string>
 #include <iostream>
+#include <fstream>
+#include <sstream>
 #include <cassert>
+#include <cstdint>
+#include <future>
+#include <mutex>
+
+namespace {
+
+    // ------------------------------------------------------------------------
+    // Minimal binary (de)serialization used for the channel map snapshot.
+    // The format is private to this provider: a magic/version word, the run
+    // validity interval and a payload checksum, followed by the maps in a
+    // fixed order, each container length prefixed.
+    // ------------------------------------------------------------------------
+    constexpr std::uint64_t snapshotMagic = 0x49434d4150303032ULL; // "ICMAP002"
+
+    // FNV-1a over the serialized payload; vouches that the snapshot content
+    // is intact (truncation, corruption, casual tampering)
+    std::uint64_t snapshotChecksum(const std::string& payload)
+    {
+        std::uint64_t hash = 0xcbf29ce484222325ULL;
+
+        for(unsigned char byte : payload)
+        {
+            hash ^= byte;
+            hash *= 0x100000001b3ULL;
+        }
+
+        return hash;
+    }
+
+    template <typename T>
+    std::enable_if_t<std::is_arithmetic<T>::value> writeItem(std::ostream& os, const T& val)
+    {
+        os.write(reinterpret_cast<const char*>(&val), sizeof(T));
+    }
+
+    void writeItem(std::ostream& os, const std::string& val)
+    {
+        writeItem(os, std::uint64_t(val.size()));
+        os.write(val.data(), val.size());
+    }
+
+    template <typename T, typename U>
+    void writeItem(std::ostream& os, const std::pair<T,U>& val)
+    {
+        writeItem(os, val.first);
+        writeItem(os, val.second);
+    }
+
+    template <typename T>
+    void writeItem(std::ostream& os, const std::vector<T>& val)
+    {
+        writeItem(os, std::uint64_t(val.size()));
+        for(const auto& item : val) writeItem(os, item);
+    }
+
+    template <typename K, typename V>
+    void writeItem(std::ostream& os, const std::map<K,V>& val)
+    {
+        writeItem(os, std::uint64_t(val.size()));
+        for(const auto& item : val) writeItem(os, item);
+    }
+
+    template <typename T>
+    std::enable_if_t<std::is_arithmetic<T>::value> readItem(std::istream& is, T& val)
+    {
+        is.read(reinterpret_cast<char*>(&val), sizeof(T));
+    }
+
+    void readItem(std::istream& is, std::string& val)
+    {
+        std::uint64_t size(0);
+        readItem(is, size);
+        val.resize(size);
+        is.read(&val[0], size);
+    }
+
+    template <typename T, typename U>
+    void readItem(std::istream& is, std::pair<T,U>& val)
+    {
+        readItem(is, val.first);
+        readItem(is, val.second);
+    }
+
+    // std::map values arrive as pairs with const keys; read into a mutable copy
+    template <typename T, typename U>
+    void readItem(std::istream& is, std::pair<const T,U>& val)
+    {
+        readItem(is, const_cast<T&>(val.first));
+        readItem(is, val.second);
+    }
+
+    template <typename T>
+    void readItem(std::istream& is, std::vector<T>& val)
+    {
+        std::uint64_t size(0);
+        readItem(is, size);
+        val.resize(size);
+        for(auto& item : val) readItem(is, item);
+    }
+
+    template <typename K, typename V>
+    void readItem(std::istream& is, std::map<K,V>& val)
+    {
+        std::uint64_t size(0);
+        readItem(is, size);
+        val.clear();
+        for(std::uint64_t idx = 0; idx < size; idx++)
+        {
+            std::pair<K,V> item;
+            readItem(is, item);
+            val.emplace_hint(val.end(), std::move(item));
+        }
+    }
+
+} // local namespace
 
 namespace icarusDB
 {
@@ -31,13 +148,57 @@ ICARUSChannelMapProvider::ICARUSChannelMapProvider(const fhicl::ParameterSet& ps
 
     mf::LogInfo("ICARUSChannelMapProvider") << "Building the channel mapping" ;
 
-    fDiagnosticOutput = pset.get<bool>("DiagnosticOutput", false);
+    fDiagnosticOutput      = pset.get<bool        >("DiagnosticOutput",      false);
+    fChannelMapCacheFile   = pset.get<std::string >("ChannelMapCacheFile",      "");
+    fSnapshotValidityBegin = pset.get<unsigned int>("SnapshotValidityBegin",     0);
+    fSnapshotValidityEnd   = pset.get<unsigned int>("SnapshotValidityEnd",       0);
+
+    // Recover the fhicl parameters for the mapping tool; kept around so the
+    // database remains reachable if a snapshot turns out not to cover a run
+    fChannelMappingToolParams = pset.get<fhicl::ParameterSet>("ChannelMappingTool");
+
+    // If a cached binary snapshot is available then skip the database parse
+    // entirely; worker nodes that have already seen this database version
+    // start up from the snapshot in a fraction of the time
+    if (!fChannelMapCacheFile.empty() && loadSnapshot(fChannelMapCacheFile))
+    {
+        mf::LogInfo("ICARUSChannelMapProvider") << "Channel mapping restored from snapshot " << fChannelMapCacheFile;
+
+        fLoadedFromSnapshot = true;
 
-    // Recover the vector of fhicl parameters for the ROI tools
-    const fhicl::ParameterSet&channelMappingParams = pset.get<fhicl::ParameterSet>("ChannelMappingTool");
+        buildFlatLookups();
 
-    // Get instance of the mapping tool (allowing switch between database instances)
-    fChannelMappingTool = art::make_tool<IChannelMapping>(channelMappingParams);
+        return;
+    }
+
+    // No snapshot: the mapping has to come from the database. The plugin tool
+    // is created here on the calling thread, but the (slow) database queries
+    // run in the background so the rest of the job initialization proceeds in
+    // parallel; the begin-run validity check (or the first accessor) joins the
+    // build through waitForLoad() and swaps in a ready mapping instead of
+    // stalling the event loop
+    fChannelMappingTool = art::make_tool<IChannelMapping>(fChannelMappingToolParams);
+
+    fLoadPending.store(true, std::memory_order_release);
+    fPendingLoad = std::async(std::launch::async, [this]()
+        {
+            buildFromDatabase();
+
+            // Leave a snapshot behind so the next job on this node skips the parse
+            if (!fChannelMapCacheFile.empty()) saveSnapshot(fChannelMapCacheFile);
+
+            buildFlatLookups();
+        });
+
+    return;
+}
+
+//----------------------------------------------------------------------
+void ICARUSChannelMapProvider::buildFromDatabase()
+{
+    // Get instance of the mapping tool (allowing switch between database instances);
+    // the background-build path creates it up front on the main thread
+    if (!fChannelMappingTool) fChannelMappingTool = art::make_tool<IChannelMapping>(fChannelMappingToolParams);
 
     cet::cpu_timer theClockFragmentIDs;
 
@@ -132,93 +293,481 @@ ICARUSChannelMapProvider::ICARUSChannelMapProvider(const fhicl::ParameterSet& ps
 
 
     mf::LogInfo("ICARUSChannelMapProvider") << "==> FragmentID map time: " << fragmentIDsTime << ", Readout IDs time: " << readoutIDsTime << std::endl;
-    
+
+    return;
+}
+
+//----------------------------------------------------------------------
+void ICARUSChannelMapProvider::ensureValidityFor(unsigned int run)
+{
+    // Join a build still running in the background before the run starts
+    waitForLoad();
+
+    // A mapping built directly from the database is always the current one
+    if (!fLoadedFromSnapshot) return;
+
+    bool covered = run >= fSnapshotValidityBegin
+                && (fSnapshotValidityEnd == 0 || run <= fSnapshotValidityEnd);
+
+    if (covered) return;
+
+    mf::LogWarning("ICARUSChannelMapProvider") << "Channel map snapshot " << fChannelMapCacheFile
+                                               << " does not cover run " << run << ", updating the mapping from the database";
+
+    fLoadedFromSnapshot = false;
+
+    applyDifferentialUpdate();
+
+    return;
+}
+
+//----------------------------------------------------------------------
+template <typename Map>
+unsigned int ICARUSChannelMapProvider::applyMapDelta(Map& current, Map&& fresh)
+{
+    unsigned int nChanges(0);
+
+    // Insert the new entries and overwrite the modified ones; untouched
+    // entries are left in place (their addresses remain valid)
+    for(auto& freshPair : fresh)
+    {
+        typename Map::iterator currentItr = current.find(freshPair.first);
+
+        if (currentItr == current.end())
+        {
+            current.emplace(freshPair.first, std::move(freshPair.second));
+            nChanges++;
+        }
+        else if (!(currentItr->second == freshPair.second))
+        {
+            currentItr->second = std::move(freshPair.second);
+            nChanges++;
+        }
+    }
+
+    // Erase the entries that dropped out of the mapping
+    for(typename Map::iterator currentItr = current.begin(); currentItr != current.end(); )
+    {
+        if (fresh.find(currentItr->first) == fresh.end())
+        {
+            currentItr = current.erase(currentItr);
+            nChanges++;
+        }
+        else currentItr++;
+    }
+
+    return nChanges;
+}
+
+//----------------------------------------------------------------------
+void ICARUSChannelMapProvider::applyDifferentialUpdate()
+{
+    // The mapping tools only hand out complete maps, so the delta is computed
+    // here: the fresh build goes to temporaries and is applied onto the
+    // current content entry by entry. A run transition that does not actually
+    // change the hardware state leaves the maps (and the generation counter)
+    // untouched, so downstream caches keyed on the generation stay valid.
+    if (!fChannelMappingTool) fChannelMappingTool = art::make_tool<IChannelMapping>(fChannelMappingToolParams);
+
+    IChannelMapping::TPCFragmentIDToReadoutIDMap            freshFragmentToReadoutMap;
+    IChannelMapping::TPCReadoutBoardToChannelMap            freshReadoutBoardToChannelMap;
+    IChannelMapping::FragmentToDigitizerChannelMap          freshFragmentToDigitizerMap;
+    IChannelMapping::CRTChannelIDToHWtoSimMacAddressPairMap freshCRTChannelIDToHWtoSimMacAddressPairMap;
+    IChannelMapping::TopCRTHWtoSimMacAddressPairMap         freshTopCRTHWtoSimMacAddressPairMap;
+    IChannelMapping::SideCRTChannelToCalibrationMap         freshSideCRTChannelToCalibrationMap;
+
+    if (fChannelMappingTool->BuildTPCFragmentIDToReadoutIDMap(freshFragmentToReadoutMap))
+        throw cet::exception("ICARUSChannelMapProvider") << "Cannot recover the Fragment ID channel map from the database \n";
+
+    if (fChannelMappingTool->BuildTPCReadoutBoardToChannelMap(freshReadoutBoardToChannelMap))
+        throw cet::exception("ICARUSChannelMapProvider") << "Cannot recover the readout board channel map from the database \n";
+
+    if (fChannelMappingTool->BuildFragmentToDigitizerChannelMap(freshFragmentToDigitizerMap))
+        throw cet::exception("ICARUSChannelMapProvider") << "Cannot recover the Fragment ID channel map from the database \n";
+
+    if (fChannelMappingTool->BuildCRTChannelIDToHWtoSimMacAddressPairMap(freshCRTChannelIDToHWtoSimMacAddressPairMap))
+        throw cet::exception("CRTDecoder") << "Cannot recover the HW MAC Address  from the database \n";
+
+    if (fChannelMappingTool->BuildTopCRTHWtoSimMacAddressPairMap(freshTopCRTHWtoSimMacAddressPairMap))
+        throw cet::exception("CRTDecoder") << "Cannot recover the Top CRT HW MAC Address  from the database \n";
+
+    if (fChannelMappingTool->BuildSideCRTCalibrationMap(freshSideCRTChannelToCalibrationMap))
+        throw cet::exception("ICARUSChannelMapProvider") << "Cannot recover the charge calibration information from the database \n";
+
+    unsigned int nChanges(0);
+
+    nChanges += applyMapDelta(fFragmentToReadoutMap,                   std::move(freshFragmentToReadoutMap));
+    nChanges += applyMapDelta(fReadoutBoardToChannelMap,               std::move(freshReadoutBoardToChannelMap));
+    nChanges += applyMapDelta(fFragmentToDigitizerMap,                 std::move(freshFragmentToDigitizerMap));
+    nChanges += applyMapDelta(fCRTChannelIDToHWtoSimMacAddressPairMap, std::move(freshCRTChannelIDToHWtoSimMacAddressPairMap));
+    nChanges += applyMapDelta(fTopCRTHWtoSimMacAddressPairMap,         std::move(freshTopCRTHWtoSimMacAddressPairMap));
+    nChanges += applyMapDelta(fSideCRTChannelToCalibrationMap,         std::move(freshSideCRTChannelToCalibrationMap));
+
+    if (nChanges == 0)
+    {
+        mf::LogInfo("ICARUSChannelMapProvider") << "Channel mapping unchanged by the database update";
+        return;
+    }
+
+    mf::LogInfo("ICARUSChannelMapProvider") << "Channel mapping updated in place: " << nChanges << " records changed";
+
+    // The derived tables have to follow the maps; the generation bump tells
+    // the callers caching them that revalidation is actually needed
+    buildFlatLookups();
+
+    fMappingGeneration++;
+
     return;
 }
 
-bool ICARUSChannelMapProvider::hasFragmentID(const unsigned int fragmentID) const 
+//----------------------------------------------------------------------
+unsigned int ICARUSChannelMapProvider::getMappingGeneration() const
 {
-    return fFragmentToReadoutMap.find(fragmentID) != fFragmentToReadoutMap.end();
+    waitForLoad();
+
+    return fMappingGeneration;
+}
+
+//----------------------------------------------------------------------
+void ICARUSChannelMapProvider::waitForLoad() const
+{
+    // Once the mapping is ready this is a single relaxed flag test
+    if (!fLoadPending.load(std::memory_order_acquire)) return;
+
+    std::lock_guard<std::mutex> lock(fLoadMutex);
+
+    // get() both joins the background build and rethrows anything it threw
+    if (fPendingLoad.valid()) fPendingLoad.get();
+
+    fLoadPending.store(false, std::memory_order_release);
+
+    return;
+}
+
+//----------------------------------------------------------------------
+void ICARUSChannelMapProvider::buildFlatLookups()
+{
+    // Only build the direct index tables when the key span is compact; for a
+    // sparse keying the maps are kept as the lookup path
+    constexpr unsigned int maxKeySpan(1 << 20);
+
+    fFragmentFlatLookup.clear();
+    fBoardFlatLookup.clear();
+
+    if (!fFragmentToReadoutMap.empty())
+    {
+        unsigned int minKey = fFragmentToReadoutMap.begin()->first;
+        unsigned int maxKey = fFragmentToReadoutMap.rbegin()->first;
+
+        if (maxKey - minKey < maxKeySpan)
+        {
+            fFragmentKeyOffset = minKey;
+            fFragmentFlatLookup.assign(maxKey - minKey + 1, nullptr);
+
+            for(const auto& pair : fFragmentToReadoutMap) fFragmentFlatLookup[pair.first - minKey] = &pair.second;
+        }
+    }
+
+    if (!fReadoutBoardToChannelMap.empty())
+    {
+        unsigned int minKey = fReadoutBoardToChannelMap.begin()->first;
+        unsigned int maxKey = fReadoutBoardToChannelMap.rbegin()->first;
+
+        if (maxKey - minKey < maxKeySpan)
+        {
+            fBoardKeyOffset = minKey;
+            fBoardFlatLookup.assign(maxKey - minKey + 1, nullptr);
+
+            for(const auto& pair : fReadoutBoardToChannelMap) fBoardFlatLookup[pair.first - minKey] = &pair.second;
+        }
+    }
+
+    // Concatenate the channel records of each fragment's boards in payload order
+    // so the decoders can walk one contiguous array per crate
+    fCrateChannelRunMap.clear();
+
+    for(const auto& fragPair : fFragmentToReadoutMap)
+    {
+        ChannelPlanePairVec& channelRun = fCrateChannelRunMap[fragPair.first];
+
+        size_t totalChannels(0);
+
+        for(const unsigned int boardID : fragPair.second.second)
+        {
+            IChannelMapping::TPCReadoutBoardToChannelMap::const_iterator boardItr = fReadoutBoardToChannelMap.find(boardID);
+
+            if (boardItr != fReadoutBoardToChannelMap.end()) totalChannels += boardItr->second.second.size();
+        }
+
+        channelRun.reserve(totalChannels);
+
+        for(const unsigned int boardID : fragPair.second.second)
+        {
+            IChannelMapping::TPCReadoutBoardToChannelMap::const_iterator boardItr = fReadoutBoardToChannelMap.find(boardID);
+
+            if (boardItr == fReadoutBoardToChannelMap.end()) continue;
+
+            channelRun.insert(channelRun.end(), boardItr->second.second.begin(), boardItr->second.second.end());
+        }
+    }
+
+    // Build the inverse as a flat channel indexed table of board/slot/offset
+    fChannelToBoardPosition.clear();
+
+    for(const auto& boardPair : fReadoutBoardToChannelMap)
+    {
+        const ChannelPlanePairVec& channelPlanePairVec = boardPair.second.second;
+
+        for(size_t chanIdx = 0; chanIdx < channelPlanePairVec.size(); chanIdx++)
+        {
+            unsigned int channel = channelPlanePairVec[chanIdx].first;
+
+            if (channel >= fChannelToBoardPosition.size()) fChannelToBoardPosition.resize(channel + 1);
+
+            fChannelToBoardPosition[channel] = ChannelBoardPosition{boardPair.first, boardPair.second.first, (unsigned int)chanIdx};
+        }
+    }
+
+    return;
+}
+
+//----------------------------------------------------------------------
+IChannelMapping::CrateNameReadoutIDPair const* ICARUSChannelMapProvider::findTPCfragmentEntry(unsigned int fragmentID) const
+{
+    if (!fFragmentFlatLookup.empty())
+    {
+        unsigned int index = fragmentID - fFragmentKeyOffset;
+
+        return index < fFragmentFlatLookup.size() ? fFragmentFlatLookup[index] : nullptr;
+    }
+
+    IChannelMapping::TPCFragmentIDToReadoutIDMap::const_iterator itr = fFragmentToReadoutMap.find(fragmentID);
+
+    return itr != fFragmentToReadoutMap.end() ? &itr->second : nullptr;
+}
+
+//----------------------------------------------------------------------
+IChannelMapping::SlotChannelVecPair const* ICARUSChannelMapProvider::findTPCboardEntry(unsigned int boardID) const
+{
+    if (!fBoardFlatLookup.empty())
+    {
+        unsigned int index = boardID - fBoardKeyOffset;
+
+        return index < fBoardFlatLookup.size() ? fBoardFlatLookup[index] : nullptr;
+    }
+
+    IChannelMapping::TPCReadoutBoardToChannelMap::const_iterator itr = fReadoutBoardToChannelMap.find(boardID);
+
+    return itr != fReadoutBoardToChannelMap.end() ? &itr->second : nullptr;
+}
+
+//----------------------------------------------------------------------
+bool ICARUSChannelMapProvider::loadSnapshot(const std::string& fileName)
+{
+    std::ifstream snapshot(fileName, std::ios::in | std::ios::binary);
+
+    if (!snapshot.is_open()) return false;
+
+    std::uint64_t magic(0);
+    readItem(snapshot, magic);
+
+    if (magic != snapshotMagic)
+    {
+        mf::LogWarning("ICARUSChannelMapProvider") << "Ignoring channel map snapshot " << fileName << " with unexpected format";
+        return false;
+    }
+
+    std::uint64_t validityBegin(0);
+    std::uint64_t validityEnd(0);
+    std::uint64_t checksum(0);
+    std::string   payload;
+
+    readItem(snapshot, validityBegin);
+    readItem(snapshot, validityEnd);
+    readItem(snapshot, checksum);
+    readItem(snapshot, payload);
+
+    // The checksum vouches for the payload: a truncated or corrupted file
+    // is rejected here and the database is queried instead
+    if (!snapshot.good() || snapshotChecksum(payload) != checksum)
+    {
+        mf::LogWarning("ICARUSChannelMapProvider") << "Ignoring channel map snapshot " << fileName << " failing the checksum test";
+        return false;
+    }
+
+    std::istringstream payloadStream(payload);
+
+    readItem(payloadStream, fFragmentToReadoutMap);
+    readItem(payloadStream, fReadoutBoardToChannelMap);
+    readItem(payloadStream, fFragmentToDigitizerMap);
+    readItem(payloadStream, fCRTChannelIDToHWtoSimMacAddressPairMap);
+    readItem(payloadStream, fTopCRTHWtoSimMacAddressPairMap);
+    readItem(payloadStream, fSideCRTChannelToCalibrationMap);
+
+    if (payloadStream.fail()) return false;
+
+    // The validity interval travels with the snapshot, not with the job
+    // configuration that happens to read it
+    fSnapshotValidityBegin = validityBegin;
+    fSnapshotValidityEnd   = validityEnd;
+
+    return true;
+}
+
+//----------------------------------------------------------------------
+void ICARUSChannelMapProvider::saveSnapshot(const std::string& fileName) const
+{
+    std::ofstream snapshot(fileName, std::ios::out | std::ios::binary | std::ios::trunc);
+
+    if (!snapshot.is_open())
+    {
+        mf::LogWarning("ICARUSChannelMapProvider") << "Could not write channel map snapshot to " << fileName;
+        return;
+    }
+
+    std::ostringstream payloadStream(std::ios::out | std::ios::binary);
+
+    writeItem(payloadStream, fFragmentToReadoutMap);
+    writeItem(payloadStream, fReadoutBoardToChannelMap);
+    writeItem(payloadStream, fFragmentToDigitizerMap);
+    writeItem(payloadStream, fCRTChannelIDToHWtoSimMacAddressPairMap);
+    writeItem(payloadStream, fTopCRTHWtoSimMacAddressPairMap);
+    writeItem(payloadStream, fSideCRTChannelToCalibrationMap);
+
+    const std::string payload = payloadStream.str();
+
+    writeItem(snapshot, snapshotMagic);
+    writeItem(snapshot, std::uint64_t(fSnapshotValidityBegin));
+    writeItem(snapshot, std::uint64_t(fSnapshotValidityEnd));
+    writeItem(snapshot, snapshotChecksum(payload));
+    writeItem(snapshot, payload);
+
+    return;
+}
+
+bool ICARUSChannelMapProvider::hasFragmentID(const unsigned int fragmentID) const
+{
+    waitForLoad();
+
+    return findTPCfragmentEntry(fragmentID) != nullptr;
 }
 
 
 unsigned int ICARUSChannelMapProvider::nTPCfragmentIDs() const {
+  waitForLoad();
   return fFragmentToReadoutMap.size();
 }
 
 
 const std::string&  ICARUSChannelMapProvider::getCrateName(const unsigned int fragmentID) const
 {
-    IChannelMapping::TPCFragmentIDToReadoutIDMap::const_iterator fragToReadoutItr = fFragmentToReadoutMap.find(fragmentID);
+    waitForLoad();
+
+    IChannelMapping::CrateNameReadoutIDPair const* fragEntry = findTPCfragmentEntry(fragmentID);
 
-    if (fragToReadoutItr == fFragmentToReadoutMap.end())
+    if (!fragEntry)
         throw cet::exception("ICARUSChannelMapProvider") << "Fragment ID " << fragmentID << " not found in lookup map when looking up crate name \n";
 
-    return fragToReadoutItr->second.first;
+    return fragEntry->first;
 }
 
 const ReadoutIDVec& ICARUSChannelMapProvider::getReadoutBoardVec(const unsigned int fragmentID) const
 {
-    IChannelMapping::TPCFragmentIDToReadoutIDMap::const_iterator fragToReadoutItr = fFragmentToReadoutMap.find(fragmentID);
+    waitForLoad();
 
-    if (fragToReadoutItr == fFragmentToReadoutMap.end())
+    IChannelMapping::CrateNameReadoutIDPair const* fragEntry = findTPCfragmentEntry(fragmentID);
+
+    if (!fragEntry)
         throw cet::exception("ICARUSChannelMapProvider") << "Fragment ID " << fragmentID << " not found in lookup map when looking up board vector \n";
 
-    return fragToReadoutItr->second.second;
+    return fragEntry->second;
 
 }
 
 const TPCReadoutBoardToChannelMap& ICARUSChannelMapProvider::getReadoutBoardToChannelMap() const
 {
+    waitForLoad();
+
     return fReadoutBoardToChannelMap;
 }
 
 
 bool ICARUSChannelMapProvider::hasBoardID(const unsigned int boardID)  const
 {
-    return fReadoutBoardToChannelMap.find(boardID) != fReadoutBoardToChannelMap.end();
+    waitForLoad();
+
+    return findTPCboardEntry(boardID) != nullptr;
 }
 
 
 unsigned int ICARUSChannelMapProvider::nTPCboardIDs() const {
+  waitForLoad();
   return fReadoutBoardToChannelMap.size();
 }
 
 
 unsigned int ICARUSChannelMapProvider::getBoardSlot(const unsigned int boardID)  const
 {
-    IChannelMapping::TPCReadoutBoardToChannelMap::const_iterator readoutBoardItr = fReadoutBoardToChannelMap.find(boardID);
+    waitForLoad();
+
+    IChannelMapping::SlotChannelVecPair const* boardEntry = findTPCboardEntry(boardID);
 
-    if (readoutBoardItr == fReadoutBoardToChannelMap.end())
+    if (!boardEntry)
         throw cet::exception("ICARUSChannelMapProvider") << "Board ID " << boardID << " not found in lookup map when looking up board slot \n";
 
-    return readoutBoardItr->second.first;
+    return boardEntry->first;
 }
 
  const ChannelPlanePairVec& ICARUSChannelMapProvider::getChannelPlanePair(const unsigned int boardID) const
 {
-    IChannelMapping::TPCReadoutBoardToChannelMap::const_iterator readoutBoardItr = fReadoutBoardToChannelMap.find(boardID);
+    waitForLoad();
 
-    if (readoutBoardItr == fReadoutBoardToChannelMap.end())
+    IChannelMapping::SlotChannelVecPair const* boardEntry = findTPCboardEntry(boardID);
+
+    if (!boardEntry)
         throw cet::exception("ICARUSChannelMapProvider") << "Board ID " << boardID << " not found in lookup map when looking up channel/plane pair \n";
 
-    return readoutBoardItr->second.second;
+    return boardEntry->second;
 
 }
 
+const ChannelPlanePairVec& ICARUSChannelMapProvider::getCrateChannelRun(const unsigned int fragmentID) const
+{
+    waitForLoad();
+
+    std::map<unsigned int, ChannelPlanePairVec>::const_iterator runItr = fCrateChannelRunMap.find(fragmentID);
+
+    if (runItr == fCrateChannelRunMap.end())
+        throw cet::exception("ICARUSChannelMapProvider") << "Fragment ID " << fragmentID << " not found in lookup map when looking up crate channel run \n";
+
+    return runItr->second;
+}
+
+const ChannelBoardPositionVec& ICARUSChannelMapProvider::getChannelToBoardPosition() const
+{
+    waitForLoad();
+
+    return fChannelToBoardPosition;
+}
+
 bool ICARUSChannelMapProvider::hasPMTDigitizerID(const unsigned int fragmentID)   const
 {
+    waitForLoad();
+
     return findPMTfragmentEntry(fragmentID) != nullptr;
 }
 
 
 unsigned int ICARUSChannelMapProvider::nPMTfragmentIDs() const {
+  waitForLoad();
   return fFragmentToDigitizerMap.size();
 }
 
 
 const DigitizerChannelChannelIDPairVec& ICARUSChannelMapProvider::getChannelIDPairVec(const unsigned int fragmentID) const
 {
+    waitForLoad();
+
     DigitizerChannelChannelIDPairVec const* digitizerPair = findPMTfragmentEntry(fragmentID);
     
     if (digitizerPair) return *digitizerPair;
@@ -228,6 +777,8 @@ const DigitizerChannelChannelIDPairVec& ICARUSChannelMapProvider::getChannelIDPa
 
   unsigned int ICARUSChannelMapProvider::getSimMacAddress(const unsigned int hwmacaddress)  const
   {
+    waitForLoad();
+
     unsigned int   simmacaddress = 0;
 
     for(const auto& pair : fCRTChannelIDToHWtoSimMacAddressPairMap){
@@ -240,6 +791,8 @@ const DigitizerChannelChannelIDPairVec& ICARUSChannelMapProvider::getChannelIDPa
   
   unsigned int ICARUSChannelMapProvider::gettopSimMacAddress(const unsigned int hwmacaddress)  const
   {
+    waitForLoad();
+
     unsigned int   simmacaddress = 0;
 
     for(const auto& pair : fTopCRTHWtoSimMacAddressPairMap){
@@ -252,6 +805,8 @@ const DigitizerChannelChannelIDPairVec& ICARUSChannelMapProvider::getChannelIDPa
    
   std::pair<double, double> ICARUSChannelMapProvider::getSideCRTCalibrationMap(int mac5, int chan) const
   {
+    waitForLoad();
+
     std::pair<double, double> gainandpedestal(-99, -99);
     for(const auto& pair : fSideCRTChannelToCalibrationMap){
       if ((int)pair.first.first == mac5 && (int)pair.first.second == chan)
@@ -18,6 +18,10 @@
 // C/C++ standard libraries
 #include <string>
 #include <memory> // std::unique_ptr<>
+#include <vector>
+#include <atomic>
+#include <future>
+#include <mutex>
 
 
 // -----------------------------------------------------------------------------
@@ -46,6 +50,10 @@ public:
     unsigned int                            getBoardSlot(const unsigned int)        const override;
     const ChannelPlanePairVec&              getChannelPlanePair(const unsigned int) const override;
 
+    // Section for payload-order iteration
+    const ChannelPlanePairVec&              getCrateChannelRun(const unsigned int)  const override;
+    const ChannelBoardPositionVec&          getChannelToBoardPosition()             const override;
+
     // Section for PMT channel mapping
     bool                                    hasPMTDigitizerID(const unsigned int)   const override;
 
@@ -57,8 +65,11 @@ public:
     unsigned int                            getSimMacAddress   (const unsigned int)    const override;
     unsigned int                            gettopSimMacAddress(const unsigned int)    const override;
 
-    /// Returns the Gain and Pedestal for Side CRT 
-    std::pair<double, double>               getSideCRTCalibrationMap(int mac5, int chan) const override;    
+    /// Returns the Gain and Pedestal for Side CRT
+    std::pair<double, double>               getSideCRTCalibrationMap(int mac5, int chan) const override;
+
+    /// Returns the generation counter of the mapping content.
+    unsigned int                            getMappingGeneration()  const override;
 
     /// Returns the channel mapping database key for the specified PMT fragment ID.
     static constexpr unsigned int PMTfragmentIDtoDBkey(unsigned int fragmentID);
@@ -66,10 +77,31 @@ public:
     /// Returns the PMT fragment ID for the specified channel mapping database key.
     static constexpr unsigned int DBkeyToPMTfragmentID(unsigned int DBkey);
 
+    /// Checks that a mapping restored from snapshot covers the specified run;
+    /// if it does not, the mapping is rebuilt from the database.
+    void ensureValidityFor(unsigned int run);
+
 private:
-    
-    bool fDiagnosticOutput;
-      
+
+    bool        fDiagnosticOutput;
+    std::string fChannelMapCacheFile; ///< if set, binary snapshot used to skip the database parse
+
+    unsigned int fSnapshotValidityBegin; ///< first run the snapshot is good for
+    unsigned int fSnapshotValidityEnd;   ///< last run the snapshot is good for (0: open ended)
+    bool         fLoadedFromSnapshot = false; ///< whether the mapping came from the snapshot
+
+    fhicl::ParameterSet fChannelMappingToolParams; ///< kept for rebuilding on a validity miss
+
+    /// Generation of the mapping content; starts at 1 so a zero-initialized
+    /// cached generation on the caller side never matches by accident.
+    unsigned int fMappingGeneration = 1;
+
+    /// Database build running in the background since construction; every
+    /// accessor joins it through waitForLoad() before touching the maps.
+    mutable std::atomic<bool> fLoadPending{false};
+    mutable std::mutex        fLoadMutex;
+    mutable std::future<void> fPendingLoad;
+
     IChannelMapping::TPCFragmentIDToReadoutIDMap   fFragmentToReadoutMap;
       
     IChannelMapping::TPCReadoutBoardToChannelMap   fReadoutBoardToChannelMap;
@@ -89,6 +121,52 @@ private:
     DigitizerChannelChannelIDPairVec const* findPMTfragmentEntry
       (unsigned int fragmentID) const;
 
+    /// Flat direct-index lookup tables for the decoding hot loop. Entries are
+    /// pointers into the maps above; a null entry means "not in the map". The
+    /// tables are only built when the key span is compact enough (which it is
+    /// for the production mapping), otherwise lookups fall back to the maps.
+    std::vector<IChannelMapping::CrateNameReadoutIDPair const*> fFragmentFlatLookup;
+    unsigned int                                                fFragmentKeyOffset = 0;
+    std::vector<IChannelMapping::SlotChannelVecPair const*>     fBoardFlatLookup;
+    unsigned int                                                fBoardKeyOffset = 0;
+
+    /// Per-fragment channel records of all the crate's boards concatenated in
+    /// payload order, so the decode inner loop walks one contiguous array.
+    std::map<unsigned int, ChannelPlanePairVec> fCrateChannelRunMap;
+
+    /// Flat channel ID indexed table of board/slot/payload offset (the inverse
+    /// of the payload-order runs), for the noise filters.
+    ChannelBoardPositionVec fChannelToBoardPosition;
+
+    /// Builds the flat lookup tables and payload-order runs from the loaded maps.
+    void buildFlatLookups();
+
+    /// Joins a mapping build still running in the background (and rethrows
+    /// anything it threw); a cheap flag test once the mapping is ready.
+    void waitForLoad() const;
+
+    /// Fills all the maps by querying the database through the mapping tool.
+    void buildFromDatabase();
+
+    /// Rebuilds the mapping from the database as a differential update: only
+    /// the entries that differ from the current content are touched, and the
+    /// generation counter is bumped only when something actually changed.
+    void applyDifferentialUpdate();
+
+    /// Applies `fresh` onto `current` in place; returns the number of entries
+    /// inserted, modified or erased.
+    template <typename Map>
+    static unsigned int applyMapDelta(Map& current, Map&& fresh);
+
+    /// Attempts to read all the mapping from the binary snapshot; false if unusable.
+    bool loadSnapshot(const std::string& fileName);
+
+    /// Writes all the mapping to a binary snapshot for later jobs.
+    void saveSnapshot(const std::string& fileName) const;
+
+    IChannelMapping::CrateNameReadoutIDPair const* findTPCfragmentEntry(unsigned int fragmentID) const;
+    IChannelMapping::SlotChannelVecPair     const* findTPCboardEntry   (unsigned int boardID)    const;
+
 }; // icarusDB::ICARUSChannelMapProvider
 
 
@@ -10,6 +10,7 @@
 #include "art/Framework/Services/Registry/ActivityRegistry.h"
 #include "art/Framework/Services/Registry/ServiceDefinitionMacros.h"
 #include "art/Framework/Services/Registry/ServiceDeclarationMacros.h"
+#include "art/Framework/Principal/Run.h"
 #include "fhiclcpp/ParameterSet.h"
 #include "cetlib_except/exception.h"
 
@@ -17,11 +18,15 @@
 // -----------------------------------------------------------------------------
 namespace icarusDB { class ICARUSChannelMap; }
 class icarusDB::ICARUSChannelMap: public ICARUSChannelMapProvider {
-    
+
     public:
-  
+
   ICARUSChannelMap(const fhicl::ParameterSet& pset, art::ActivityRegistry& reg);
-  
+
+  /// Joins a mapping build still running in the background and verifies that
+  /// a mapping restored from snapshot covers the incoming run.
+  void preBeginRun(art::Run const& run);
+
 }; // class icarusDB::ICARUSChannelMap
 
 
@@ -29,9 +34,14 @@ class icarusDB::ICARUSChannelMap: public ICARUSChannelMapProvider {
 // ---  Implementation
 // -----------------------------------------------------------------------------
 icarusDB::ICARUSChannelMap::ICARUSChannelMap
-  (const fhicl::ParameterSet& pset, art::ActivityRegistry& /* reg */)
+  (const fhicl::ParameterSet& pset, art::ActivityRegistry& reg)
   : ICARUSChannelMapProvider(pset)
-  {}
+  { reg.sPreBeginRun.watch(this, &ICARUSChannelMap::preBeginRun); }
+
+
+// -----------------------------------------------------------------------------
+void icarusDB::ICARUSChannelMap::preBeginRun(art::Run const& run)
+  { ensureValidityFor(run.run()); }
 
 
 // -----------------------------------------------------------------------------
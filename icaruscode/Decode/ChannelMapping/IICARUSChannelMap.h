@@ -31,6 +31,16 @@ using ChannelPlanePairVec              = std::vector<ChannelPlanePair>;
 using SlotChannelVecPair               = std::pair<unsigned int, ChannelPlanePairVec>;
 using TPCReadoutBoardToChannelMap      = std::map<unsigned int, SlotChannelVecPair>;
 
+// Position of a channel in the readout: board, slot and payload offset.
+// A boardID of ~0U marks a channel with no board assigned
+struct ChannelBoardPosition
+{
+    unsigned int boardID = ~0U;  ///< ID of the readout board serving the channel
+    unsigned int slot    = 0;    ///< Slot of the board in its crate
+    unsigned int offset  = 0;    ///< Position of the channel in the board payload
+};
+using ChannelBoardPositionVec          = std::vector<ChannelBoardPosition>;
+
 class IICARUSChannelMap //: private lar::EnsureOnlyOneSchedule
 {
 public:
@@ -51,6 +61,13 @@ public:
     virtual unsigned int                            getBoardSlot(const unsigned int)        const = 0;
     virtual const ChannelPlanePairVec&              getChannelPlanePair(const unsigned int) const = 0;
 
+    // Section for payload-order iteration
+    /// Returns the channel/plane records of all the boards of the given TPC fragment
+    /// concatenated in payload (board, then channel) order as one contiguous array.
+    virtual const ChannelPlanePairVec&              getCrateChannelRun(const unsigned int)  const = 0;
+    /// Returns the flat channel ID indexed table of board/slot/payload offset.
+    virtual const ChannelBoardPositionVec&          getChannelToBoardPosition()             const = 0;
+
     // Section for recovering PMT information
     virtual bool                                    hasPMTDigitizerID(const unsigned int)   const = 0;
     /// Returns the number of PMT fragment IDs known to the service.
@@ -61,6 +78,11 @@ public:
     virtual unsigned int                         gettopSimMacAddress(const unsigned int)    const = 0;    
 
     virtual std::pair<double, double>          getSideCRTCalibrationMap(int mac5, int chan) const = 0;
+
+    /// Generation counter of the mapping content: bumped only when the maps
+    /// actually change, so callers caching flat arrays or references derived
+    /// from the mapping can revalidate with one integer comparison per run.
+    virtual unsigned int                            getMappingGeneration()                  const = 0;
 };
 
 } // end of namespace
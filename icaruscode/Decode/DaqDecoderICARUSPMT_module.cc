@@ -8,6 +8,8 @@
 
 
 // ICARUS/SBN libraries
+#include "icaruscode/IcarusObj/PackedOpDetWaveform.h"
+#include "icaruscode/Decode/DataProducts/PMTFragmentIntegrity.h"
 #include "icaruscode/Decode/DecoderTools/details/PMTDecoderUtils.h"
 #include "icaruscode/Decode/DecoderTools/Dumpers/FragmentDumper.h"
 #include "icaruscode/Decode/ChannelMapping/IICARUSChannelMap.h"
@@ -39,6 +41,9 @@
 #include "artdaq-core/Data/ContainerFragment.hh"
 #include "artdaq-core/Data/Fragment.hh"
 
+// TBB
+#include "tbb/parallel_for.h"
+
 // framework libraries
 #include "art_root_io/TFileService.h"
 #include "art/Framework/Services/Registry/ServiceHandle.h" 
@@ -67,6 +72,7 @@
 #include <vector>
 #include <string>
 #include <optional>
+#include <utility> // std::pair
 #include <cassert>
 
 
@@ -145,6 +151,22 @@ namespace icarus { class DaqDecoderICARUSPMT; }
  *     if this option is set to `false`, all PMT readout boards are assumed to
  *     have been triggered at the time of the global trigger. By default, this
  *     option is set to `true` unless `TriggerTag` is specified empty.
+ * * `DecodeWindowStart`, `DecodeWindowEnd` (nanoseconds, optional): if both
+ *     are specified, only the waveforms overlapping the time window between
+ *     `DecodeWindowStart` and `DecodeWindowEnd` relative to the global trigger
+ *     time are decoded; the selection is performed on the fragment header
+ *     alone, so the payload of the waveforms out of the window is never
+ *     decoded nor copied. By default, all the waveforms are decoded.
+ * * `PackedWaveforms` (flag, default: `false`): if set, a bit-packed copy of
+ *     the decoded waveforms (`icarus::PackedOpDetWaveform`) is also produced;
+ *     dropping the plain `raw::OpDetWaveform` collection on output then cuts
+ *     the persistent PMT data volume by roughly the ratio of the sample width
+ *     (14 bits) to the plain 16-bit storage.
+ * * `FragmentIntegrity` (flag, default: `false`): if set, a per-board summary
+ *     of checksums of the fragment payloads (`icarus::PMTFragmentIntegrity`)
+ *     is also produced; two decodings of the same raw data can then be
+ *     cross-checked board by board from the summaries alone, without
+ *     re-decoding or comparing the waveforms themselves.
  * * `DataTrees` (list of strings, default: none): list of data trees to be
  *     produced; if none (default), then `TFileService` is not required.
  * * `LogCategory` (string, default: `DaqDecoderICARUSPMT`): name of the message
@@ -446,6 +468,13 @@ class icarus::DaqDecoderICARUSPMT: public art::EDProducer {
       Comment("enable dump of the whole V1730 data (huge)"),
       false // default
       };
+
+    fhicl::Atom<bool> ParallelBoards {
+      Name("ParallelBoards"),
+      Comment
+        ("decode the readout boards in concurrent tasks (disabled when data trees or packet dump are requested)"),
+      false // default
+      };
     
     fhicl::Atom<bool> RequireKnownBoards {
       Name("RequireKnownBoards"),
@@ -484,6 +513,36 @@ class icarus::DaqDecoderICARUSPMT: public art::EDProducer {
         ("assume that V1730 counter (Trigger Time Tag) is reset every second")
       };
     
+    fhicl::OptionalAtom<nanoseconds> DecodeWindowStart {
+      Name("DecodeWindowStart"),
+      Comment(
+        "only decode waveforms overlapping the trigger-relative window"
+        " starting at this time (requires DecodeWindowEnd)"
+        )
+      };
+
+    fhicl::OptionalAtom<nanoseconds> DecodeWindowEnd {
+      Name("DecodeWindowEnd"),
+      Comment(
+        "only decode waveforms overlapping the trigger-relative window"
+        " ending at this time (requires DecodeWindowStart)"
+        )
+      };
+
+    fhicl::Atom<bool> PackedWaveforms {
+      Name("PackedWaveforms"),
+      Comment
+        ("also produce a bit-packed copy of the decoded waveforms"),
+      false // default
+      };
+
+    fhicl::Atom<bool> FragmentIntegrity {
+      Name("FragmentIntegrity"),
+      Comment
+        ("also produce per-board checksums of the PMT fragment payloads"),
+      false // default
+      };
+
     fhicl::Sequence<std::string> DataTrees {
       fhicl::Name("DataTrees"),
       fhicl::Comment
@@ -564,7 +623,10 @@ class icarus::DaqDecoderICARUSPMT: public art::EDProducer {
   bool const fDiagnosticOutput;
   
   bool const fPacketDump; ///< Dump V1730 data.
-  
+
+  /// Whether to decode the readout boards in concurrent tasks.
+  bool const fParallelBoards;
+
   /// Whether info on all input boards is required.
   bool const fRequireKnownBoards;
   
@@ -578,7 +640,17 @@ class icarus::DaqDecoderICARUSPMT: public art::EDProducer {
   std::optional<art::InputTag> const fTriggerTag;
   
   bool const fTTTresetEverySecond; ///< Whether V1730 TTT is reset every second.
-  
+
+  /// If set, only the waveforms overlapping this trigger-relative time window
+  /// (start and end of the window, in this order) are decoded.
+  std::optional<std::pair<nanoseconds, nanoseconds>> const fDecodeWindow;
+
+  /// Whether to also produce a bit-packed copy of the waveforms.
+  bool const fPackedWaveforms;
+
+  /// Whether to also produce the per-board fragment checksum summary.
+  bool const fFragmentIntegrity;
+
   /// All board setup settings.
   std::vector<daq::details::BoardSetup_t> const fBoardSetup;
   
@@ -820,9 +892,11 @@ class icarus::DaqDecoderICARUSPMT: public art::EDProducer {
     (artdaq::Fragment const& sourceFragment) const;
 
   /// Extracts waveforms from the specified fragments from a board.
+  /// If `summaries` is not null, appends one integrity summary per fragment.
   std::vector<raw::OpDetWaveform> processBoardFragments(
     artdaq::FragmentPtrs const& artdaqFragment,
-    TriggerInfo_t const& triggerInfo
+    TriggerInfo_t const& triggerInfo,
+    std::vector<PMTFragmentIntegrity::FragmentSummary>* summaries = nullptr
     );
   
   // --- END ---- Input data management ----------------------------------------
@@ -846,7 +920,17 @@ class icarus::DaqDecoderICARUSPMT: public art::EDProducer {
   
   /// Returns whether nominal trigger time is within `nTicks` from `time`.
   bool containsGlobalTrigger(electronics_time time, std::size_t nTicks) const;
-  
+
+  /// Returns whether a waveform starting at `time` and `nTicks` long overlaps
+  /// the configured decode window; always `true` when no window is configured.
+  bool overlapsDecodeWindow(electronics_time time, std::size_t nTicks) const;
+
+  /// Extracts the decode window boundaries from the configuration;
+  /// throws if only one of the two boundaries is specified or if they are
+  /// not in increasing order.
+  static std::optional<std::pair<nanoseconds, nanoseconds>> makeDecodeWindow
+    (Config const& config);
+
   /// Returns a waveform merging of the `indices` ones from `allWaveforms`.
   /// The merged waveforms are emptied of their content.
   raw::OpDetWaveform mergeWaveformGroup(
@@ -875,11 +959,15 @@ class icarus::DaqDecoderICARUSPMT: public art::EDProducer {
    * This method fills the information for the PMT fragment tree
    * (`fillPMTfragmentTree()`) and creates PMT waveforms from the fragment data
    * (`createFragmentWaveforms()`).
+   * If `summary` is not null, it is filled with the integrity checksums of the
+   * fragment payload (`makeFragmentSummary()`); this happens for all the
+   * fragments, including the ones which end up not being decoded.
    */
   std::vector<raw::OpDetWaveform> processFragment(
     artdaq::Fragment const& artdaqFragment,
     NeededBoardInfo_t const& boardInfo,
-    TriggerInfo_t const& triggerInfo
+    TriggerInfo_t const& triggerInfo,
+    PMTFragmentIntegrity::FragmentSummary* summary = nullptr
     );
 
   
@@ -899,6 +987,10 @@ class icarus::DaqDecoderICARUSPMT: public art::EDProducer {
   /// Extracts useful information from fragment data.
   FragmentInfo_t extractFragmentInfo
     (artdaq::Fragment const& artdaqFragment) const;
+
+  /// Returns the integrity summary (checksums) of the fragment in `fragInfo`.
+  static PMTFragmentIntegrity::FragmentSummary makeFragmentSummary
+    (FragmentInfo_t const& fragInfo);
   
   /// Extracts the fragment ID (i.e. board ID) from the specified `fragment`.
   static BoardID_t extractFragmentBoardID(artdaq::Fragment const& fragment);
@@ -1085,6 +1177,35 @@ std::string icarus::DaqDecoderICARUSPMT::listTreeNames
 } // icarus::DaqDecoderICARUSPMT::listTreeNames()
 
 
+//------------------------------------------------------------------------------
+auto icarus::DaqDecoderICARUSPMT::makeDecodeWindow(Config const& config)
+  -> std::optional<std::pair<nanoseconds, nanoseconds>>
+{
+  std::optional const start
+    = ::util::fhicl::getOptionalValue(config.DecodeWindowStart);
+  std::optional const stop
+    = ::util::fhicl::getOptionalValue(config.DecodeWindowEnd);
+
+  if (start.has_value() != stop.has_value()) {
+    throw cet::exception("DaqDecoderICARUSPMT")
+      << "Configuration parameters '" << config.DecodeWindowStart.name()
+      << "' and '" << config.DecodeWindowEnd.name()
+      << "' must be specified together.\n";
+  }
+
+  if (!start) return std::nullopt;
+
+  if (*stop <= *start) {
+    throw cet::exception("DaqDecoderICARUSPMT")
+      << "Configuration parameter '" << config.DecodeWindowEnd.name()
+      << "' (" << *stop << ") must be larger than '"
+      << config.DecodeWindowStart.name() << "' (" << *start << ").\n";
+  }
+
+  return std::make_pair(*start, *stop);
+} // icarus::DaqDecoderICARUSPMT::makeDecodeWindow()
+
+
 //------------------------------------------------------------------------------
 icarus::DaqDecoderICARUSPMT::DaqDecoderICARUSPMT(Parameters const& params)
   : art::EDProducer(params)
@@ -1092,6 +1213,9 @@ icarus::DaqDecoderICARUSPMT::DaqDecoderICARUSPMT(Parameters const& params)
   , fSurviveExceptions{ params().SurviveExceptions() }
   , fDiagnosticOutput{ params().DiagnosticOutput() }
   , fPacketDump{ params().PacketDump() }
+  , fParallelBoards{
+      params().ParallelBoards() && !fPacketDump && params().DataTrees().empty()
+    }
   , fRequireKnownBoards{ params().RequireKnownBoards() }
   , fRequireBoardConfig{ params().RequireBoardConfig() }
   , fPMTconfigTag{ ::util::fhicl::getOptionalValue(params().PMTconfigTag) }
@@ -1100,6 +1224,9 @@ icarus::DaqDecoderICARUSPMT::DaqDecoderICARUSPMT(Parameters const& params)
     ::util::fhicl::getOptionalValue(params().TTTresetEverySecond)
       .value_or(fTriggerTag.has_value())
     }
+  , fDecodeWindow{ makeDecodeWindow(params()) }
+  , fPackedWaveforms{ params().PackedWaveforms() }
+  , fFragmentIntegrity{ params().FragmentIntegrity() }
   , fBoardSetup{ params().BoardSetup() }
   , fLogCategory{ params().LogCategory() }
   , fDetTimings
@@ -1124,6 +1251,8 @@ icarus::DaqDecoderICARUSPMT::DaqDecoderICARUSPMT(Parameters const& params)
   // produced data products declaration
   //
   produces<std::vector<raw::OpDetWaveform>>();
+  if (fPackedWaveforms) produces<std::vector<PackedOpDetWaveform>>();
+  if (fFragmentIntegrity) produces<PMTFragmentIntegrity>();
   
   //
   // additional initialization
@@ -1149,6 +1278,15 @@ icarus::DaqDecoderICARUSPMT::DaqDecoderICARUSPMT(Parameters const& params)
     log << "\n * trigger information from: '" << fTriggerTag->encode() << '\'';
   else
     log << "\n * trigger time from event timestamp [fallback]";
+  if (fParallelBoards)
+    log << "\n * readout boards are decoded in concurrent tasks";
+  if (fDecodeWindow) {
+    log << "\n * only waveforms overlapping " << fDecodeWindow->first
+      << " to " << fDecodeWindow->second
+      << " from the global trigger are decoded";
+  }
+  if (fPackedWaveforms)
+    log << "\n * a bit-packed copy of the waveforms is also produced";
   if (fRequireKnownBoards) {
     log << "\n * all readout boards in input must be known (from `"
       << params().BoardSetup.name() << "` or `"
@@ -1246,8 +1384,12 @@ void icarus::DaqDecoderICARUSPMT::produce(art::Event& event) {
   // output data product initialization
   //
   std::vector<raw::OpDetWaveform> opDetWaveforms;
-  
-  
+
+  std::unique_ptr<PMTFragmentIntegrity> fragmentIntegrity;
+  if (fFragmentIntegrity)
+    fragmentIntegrity = std::make_unique<PMTFragmentIntegrity>();
+
+
   // ---------------------------------------------------------------------------
   // pre-processing
   //
@@ -1261,36 +1403,78 @@ void icarus::DaqDecoderICARUSPMT::produce(art::Event& event) {
   bool duplicateBoards = false;
   try { // catch-all
     auto const& fragments = readInputFragments(event);
-    
+
+    // collect the fragments of each board up front: this is header-level work
+    // only, and it leaves one independent decoding task per board
+    std::vector<artdaq::FragmentPtrs> boardFragments;
     for (artdaq::Fragment const& fragment: fragments) {
-      
-      artdaq::FragmentPtrs const& fragmentCollection
+
+      artdaq::FragmentPtrs fragmentCollection
         = makeFragmentCollection(fragment);
-      
+
       if (empty(fragmentCollection)) {
         mf::LogWarning("DaqDecoderICARUSPMT")
           << "Found a data fragment (ID=" << extractFragmentBoardID(fragment)
           << ") containing no data.";
         continue;
       } // if no data
-      
+
       BoardID_t const boardID
         = extractFragmentBoardID(*(fragmentCollection.front()));
       if (++boardCounts[boardID] > 1U) duplicateBoards = true;
-      
-      appendTo(
-        opDetWaveforms,
-        processBoardFragments(fragmentCollection, triggerInfo)
-        );
-      
+
+      boardFragments.push_back(std::move(fragmentCollection));
+
     } // for all input fragments
-    
+
+    // decode the boards, concurrently if so configured; results are collected
+    // per board and merged in input order below, so the output does not depend
+    // on the decoding schedule
+    std::vector<std::vector<raw::OpDetWaveform>> waveformsByBoard
+      { boardFragments.size() };
+
+    // like the waveforms, the integrity summaries are written into a per-board
+    // slot by each decoding task and merged in input order afterwards
+    std::vector<std::vector<PMTFragmentIntegrity::FragmentSummary>>
+      summariesByBoard { boardFragments.size() };
+
+    auto boardSummaries = [this, &summariesByBoard](std::size_t const iBoard)
+      { return fFragmentIntegrity? &(summariesByBoard[iBoard]): nullptr; };
+
+    if (fParallelBoards) {
+      tbb::parallel_for(std::size_t{ 0 }, boardFragments.size(),
+        [&, this](std::size_t const iBoard)
+        {
+          waveformsByBoard[iBoard] = processBoardFragments
+            (boardFragments[iBoard], triggerInfo, boardSummaries(iBoard));
+        }
+        );
+    }
+    else {
+      for (auto const iBoard: util::counter(boardFragments.size())) {
+        waveformsByBoard[iBoard] = processBoardFragments
+          (boardFragments[iBoard], triggerInfo, boardSummaries(iBoard));
+      }
+    } // if parallel ... else
+
+    for (std::vector<raw::OpDetWaveform>& waveforms: waveformsByBoard)
+      appendTo(opDetWaveforms, std::move(waveforms));
+
+    if (fragmentIntegrity) {
+      for (std::vector<PMTFragmentIntegrity::FragmentSummary>& summaries
+        : summariesByBoard)
+      {
+        appendTo(fragmentIntegrity->fragments, std::move(summaries));
+      }
+    } // if integrity summary
+
   }
   catch (cet::exception const& e) {
     if (!fSurviveExceptions) throw;
     mf::LogError("DaqDecoderICARUSPMT")
       << "Error while attempting to decode PMT data:\n" << e.what() << '\n';
     opDetWaveforms.clear();
+    if (fragmentIntegrity) fragmentIntegrity->fragments.clear();
     ++fNFailures;
   }
   catch (...) {
@@ -1298,6 +1482,7 @@ void icarus::DaqDecoderICARUSPMT::produce(art::Event& event) {
     mf::LogError("DaqDecoderICARUSPMT")
       << "Error while attempting to decode PMT data.\n";
     opDetWaveforms.clear();
+    if (fragmentIntegrity) fragmentIntegrity->fragments.clear();
     ++fNFailures;
   }
   
@@ -1324,10 +1509,20 @@ void icarus::DaqDecoderICARUSPMT::produce(art::Event& event) {
   // ---------------------------------------------------------------------------
   // output
   //
+  if (fPackedWaveforms) {
+    auto packedWaveforms = std::make_unique<std::vector<PackedOpDetWaveform>>();
+    packedWaveforms->reserve(opDetWaveforms.size());
+    for (raw::OpDetWaveform const& waveform: opDetWaveforms)
+      packedWaveforms->emplace_back(waveform);
+    event.put(std::move(packedWaveforms));
+  } // if packed waveforms
+
+  if (fragmentIntegrity) event.put(std::move(fragmentIntegrity));
+
   event.put(
     std::make_unique<std::vector<raw::OpDetWaveform>>(std::move(opDetWaveforms))
     );
-  
+
 } // icarus::DaqDecoderICARUSPMT::produce()
 
 
@@ -1415,6 +1610,16 @@ bool icarus::DaqDecoderICARUSPMT::containsGlobalTrigger
 } // icarus::DaqDecoderICARUSPMT::containsGlobalTrigger(waveform)
 
 
+//------------------------------------------------------------------------------
+bool icarus::DaqDecoderICARUSPMT::overlapsDecodeWindow
+  (electronics_time time, std::size_t nTicks) const
+{
+  if (!fDecodeWindow) return true;
+  return (time < fNominalTriggerTime + fDecodeWindow->second)
+    && (fNominalTriggerTime + fDecodeWindow->first < time + nTicks * fOpticalTick);
+} // icarus::DaqDecoderICARUSPMT::overlapsDecodeWindow()
+
+
 //------------------------------------------------------------------------------
 bool icarus::DaqDecoderICARUSPMT::UpdatePMTConfiguration
   (sbn::PMTconfiguration const* PMTconfig)
@@ -1704,9 +1909,11 @@ void icarus::DaqDecoderICARUSPMT::checkFragmentType
 //------------------------------------------------------------------------------
 auto icarus::DaqDecoderICARUSPMT::processBoardFragments(
   artdaq::FragmentPtrs const& artdaqFragments,
-  TriggerInfo_t const& triggerInfo
+  TriggerInfo_t const& triggerInfo,
+  std::vector<PMTFragmentIntegrity::FragmentSummary>* summaries
+    /* = nullptr */
 ) -> std::vector<raw::OpDetWaveform> {
-  
+
   if (artdaqFragments.empty()) return {};
   
   artdaq::Fragment const& referenceFragment = *(artdaqFragments.front());
@@ -1722,8 +1929,12 @@ auto icarus::DaqDecoderICARUSPMT::processBoardFragments(
     << " fragments";
   
   std::vector<raw::OpDetWaveform> waveforms;
-  for (artdaq::FragmentPtr const& fragment: artdaqFragments)
-    appendTo(waveforms, processFragment(*fragment, boardInfo, triggerInfo));
+  for (artdaq::FragmentPtr const& fragment: artdaqFragments) {
+    PMTFragmentIntegrity::FragmentSummary* summary
+      = summaries? &(summaries->emplace_back()): nullptr;
+    appendTo
+      (waveforms, processFragment(*fragment, boardInfo, triggerInfo, summary));
+  } // for
   
   mergeWaveforms(waveforms);
   
@@ -1736,7 +1947,8 @@ auto icarus::DaqDecoderICARUSPMT::processBoardFragments(
 auto icarus::DaqDecoderICARUSPMT::processFragment(
   artdaq::Fragment const& artdaqFragment,
   NeededBoardInfo_t const& boardInfo,
-  TriggerInfo_t const& triggerInfo
+  TriggerInfo_t const& triggerInfo,
+  PMTFragmentIntegrity::FragmentSummary* summary /* = nullptr */
 ) -> std::vector<raw::OpDetWaveform> {
   
   checkFragmentType(artdaqFragment);
@@ -1750,17 +1962,32 @@ auto icarus::DaqDecoderICARUSPMT::processFragment(
   } // if diagnostics
   
   FragmentInfo_t const fragInfo = extractFragmentInfo(artdaqFragment);
-  
+
+  // the checksums are computed on the payload as delivered by the DAQ,
+  // before any decision on whether (or how much of) it gets decoded
+  if (summary) *summary = makeFragmentSummary(fragInfo);
+
   auto const timeStamp
     = fragmentWaveformTimestamp(fragInfo, boardInfo, triggerInfo.time);
     
   if (fTreeFragment) fillPMTfragmentTree(fragInfo, triggerInfo, timeStamp);
-  
+
+  // when a decode window is configured, fragments entirely out of it are
+  // dropped here, before any of their waveform payload is decoded or copied
+  if ((timeStamp != NoTimestamp)
+    && !overlapsDecodeWindow(timeStamp, fragInfo.nSamplesPerChannel))
+  {
+    mf::LogTrace(fLogCategory)
+      << "PMT fragment starting at " << timeStamp
+      << " skipped: out of the configured decode window.";
+    return {};
+  }
+
   return (timeStamp != NoTimestamp)
     ? createFragmentWaveforms(fragInfo, timeStamp)
     : std::vector<raw::OpDetWaveform>{}
     ;
-  
+
 } // icarus::DaqDecoderICARUSPMT::processFragment()
 
 
@@ -2075,6 +2302,28 @@ auto icarus::DaqDecoderICARUSPMT::extractFragmentInfo
 } // icarus::DaqDecoderICARUSPMT::extractFragmentInfo()
 
 
+//------------------------------------------------------------------------------
+auto icarus::DaqDecoderICARUSPMT::makeFragmentSummary
+  (FragmentInfo_t const& fragInfo) -> PMTFragmentIntegrity::FragmentSummary
+{
+
+  std::size_t const nEnabledChannels
+    = setBitIndices<16U>(fragInfo.enabledChannels).second;
+  std::size_t const nSamples = nEnabledChannels * fragInfo.nSamplesPerChannel;
+
+  return { // C++20: write the member names explicitly
+    fragInfo.fragmentID,
+    fragInfo.eventCounter,
+    fragInfo.TTT,
+    fragInfo.enabledChannels,
+    static_cast<std::uint32_t>(nSamples),
+    PMTFragmentIntegrity::payloadCRC32(fragInfo.data, nSamples),
+    PMTFragmentIntegrity::sampleSum32(fragInfo.data, nSamples)
+    };
+
+} // icarus::DaqDecoderICARUSPMT::makeFragmentSummary()
+
+
 //------------------------------------------------------------------------------
 electronics_time icarus::DaqDecoderICARUSPMT::fragmentWaveformTimestamp(
   FragmentInfo_t const& fragInfo,
@@ -46,6 +46,8 @@
 #include "sbndaq-artdaq-core/Overlays/ICARUS/PhysCrateFragment.hh"
 
 #include "icaruscode/Decode/DecoderTools/IDecoderFilter.h"
+#include "icaruscode/Decode/DecoderTools/DecodeTimingTracker.h"
+#include "icaruscode/Decode/DataProducts/DecodeTimingSummary.h"
 
 #include "icarus_signal_processing/ICARUSSigProcDefs.h"
 #include "icarus_signal_processing/WaveformTools.h"
@@ -132,6 +134,8 @@ private:
     // Statistics.
     int                                          fNumEvent;             ///< Number of events seen.
 
+    icarus::DecodeTimingPercentiles              fTimingStats;          ///< Per-stage timing statistics over the job
+
     size_t                                       fFragmentOffset;       ///< The fragment offset to set channel numbering
 
     // Useful services, keep copies for now (we can update during begin run periods)
@@ -212,6 +216,9 @@ DaqDecoderICARUSTPC::DaqDecoderICARUSTPC(fhicl::ParameterSet const & pset, art::
             produces<std::vector<raw::RawDigit>>(fragmentLabel.instance() + fOutputCoherentPath);
     }
 
+    // Per-event record of where the decode time went
+    produces<icarus::DecodeTimingSummary>();
+
     // Report.
     mf::LogInfo("DaqDecoderICARUSTPC") << "DaqDecoderICARUSTPC configured\n";
 }
@@ -274,7 +281,12 @@ void DaqDecoderICARUSTPC::produce(art::Event & event, art::ProcessingFrame const
 
     theClockTotal.start();
 
-    // Loop through the list of input daq fragment collections one by one 
+    // Per-event record of where the decode time goes, stage by stage
+    std::unique_ptr<icarus::DecodeTimingSummary> timingSummary = std::make_unique<icarus::DecodeTimingSummary>();
+
+    timingSummary->sourceLabel = "DaqDecoderICARUSTPC";
+
+    // Loop through the list of input daq fragment collections one by one
     // We are not trying to multi thread at this stage because we are trying to control
     // overall memory usage at this level. We'll multi thread internally...
     for(const auto& fragmentLabel : fFragmentsLabelVec)
@@ -285,7 +297,7 @@ void DaqDecoderICARUSTPC::produce(art::Event & event, art::ProcessingFrame const
         ConcurrentRawDigitCol concurrentRawDigits;
         ConcurrentRawDigitCol concurrentRawRawDigits;
         ConcurrentRawDigitCol coherentRawDigits;
-    
+
         // ... Launch multiple threads with TBB to do the deconvolution and find ROIs in parallel
         auto const clockData = art::ServiceHandle<detinfo::DetectorClocksService>()->DataFor(event);
         multiThreadFragmentProcessing fragmentProcessing(*this,
@@ -295,10 +307,18 @@ void DaqDecoderICARUSTPC::produce(art::Event & event, art::ProcessingFrame const
                                                          concurrentRawRawDigits,
                                                          coherentRawDigits);
 
-        tbb::parallel_for(tbb::blocked_range<size_t>(0, daq_handle->size()), fragmentProcessing);
-    
+        {
+            // covers fragment parsing and noise filtering across all threads
+            icarus::StageStopwatch timer(*timingSummary, "fragmentDecode");
+
+            tbb::parallel_for(tbb::blocked_range<size_t>(0, daq_handle->size()), fragmentProcessing);
+        }
+
+        // the remainder of the loop body assembles the output products
+        icarus::StageStopwatch timer(*timingSummary, "productAssembly");
+
         // Copy the raw digits from the concurrent vector to our output vector
-        RawDigitCollectionPtr rawDigitCollection = std::make_unique<std::vector<raw::RawDigit>>(std::move_iterator(concurrentRawDigits.begin()), 
+        RawDigitCollectionPtr rawDigitCollection = std::make_unique<std::vector<raw::RawDigit>>(std::move_iterator(concurrentRawDigits.begin()),
                                                                                                 std::move_iterator(concurrentRawDigits.end()));
     
         // Want the RawDigits to be sorted in channel order... has to be done somewhere so why not now?
@@ -340,6 +360,11 @@ void DaqDecoderICARUSTPC::produce(art::Event & event, art::ProcessingFrame const
 
     mf::LogInfo("DaqDecoderICARUSTPC") << "==> DaqDecoderICARUSTPC total time: " << totalTime << std::endl;
 
+    // Keep the running statistics and store the summary in the event
+    fTimingStats.add(*timingSummary);
+
+    event.put(std::move(timingSummary));
+
     return;
 }
 
@@ -468,6 +493,9 @@ void DaqDecoderICARUSTPC::saveRawDigits(const icarus_signal_processing::ArrayFlo
 void DaqDecoderICARUSTPC::endJob(art::ProcessingFrame const&)
 {
     mf::LogInfo("DaqDecoderICARUSTPC") << "Looked at " << fNumEvent << " events" << std::endl;
+
+    // The tail percentiles, not the average, decide keep-up processing margins
+    fTimingStats.report("DaqDecoderICARUSTPC");
 }
 
 } // end of namespace
@@ -37,17 +37,21 @@
 #include "tbb/blocked_range.h"
 #include "tbb/task_arena.h"
 #include "tbb/spin_mutex.h"
-#include "tbb/concurrent_vector.h"
 
 #include "larcore/Geometry/Geometry.h"
 #include "lardata/DetectorInfoServices/DetectorClocksService.h"
 #include "lardataobj/RawData/RawDigit.h"
 #include "lardataobj/RecoBase/Wire.h"         // This for outputting the ROIs
+
+#include "icaruscode/Decode/DataProducts/ChannelOccupancyIndex.h"
+#include "icaruscode/Decode/DataProducts/LatencyStamp.h"
+#include "icaruscode/Decode/DataProducts/TriggerClassification.h"
 #include "lardata/ArtDataHelper/WireCreator.h"
 
 #include "sbndaq-artdaq-core/Overlays/ICARUS/PhysCrateFragment.hh"
 
 #include "icaruscode/Decode/DecoderTools/INoiseFilter.h"
+#include "icaruscode/Decode/DecoderTools/details/ADCBlockTranspose.h"
 #include "icaruscode/Decode/ChannelMapping/IICARUSChannelMap.h"
 
 #include "icarus_signal_processing/ICARUSSigProcDefs.h"
@@ -81,8 +85,19 @@ public:
     using RawDigitCollectionPtr = std::unique_ptr<RawDigitCollection>;
     using WireCollection        = std::vector<recob::Wire>;
     using WireCollectionPtr     = std::unique_ptr<WireCollection>;
-    using ConcurrentRawDigitCol = tbb::concurrent_vector<raw::RawDigit>;
-    using ConcurrentWireCol     = tbb::concurrent_vector<recob::Wire>;
+
+    // Define a per-fragment output shard. Each parallel task writes only the
+    // shard for its own fragment so the output side needs no locking at all;
+    // at the end the shards are merged into the output collections with a
+    // single size-prefixed reservation followed by moves
+    struct OutputShard
+    {
+        RawDigitCollection fRawRawDigits;   ///< pedestal corrected (not noise filtered) waveforms
+        RawDigitCollection fRawDigits;      ///< noise filtered waveforms
+        RawDigitCollection fCoherentDigits; ///< coherent noise correction vectors
+        WireCollection     fROIs;           ///< candidate ROIs
+    };
+    using OutputShardVec        = std::vector<OutputShard>;
 
     // Define data structures for organizing the decoded fragments
     // The idea is to form complete "images" organized by "logical" TPC. Here we are including
@@ -103,11 +118,9 @@ public:
     // Function to do the work
     void processSingleFragment(size_t,
                                detinfo::DetectorClocksData const& clockData,
-                               art::Handle<artdaq::Fragments>, 
-                               ConcurrentRawDigitCol&,
-                               ConcurrentRawDigitCol&,
-                               ConcurrentRawDigitCol&,
-                               ConcurrentWireCol&) const;
+                               art::Handle<artdaq::Fragments>,
+                               OutputShard&,
+                               bool roiOnly) const;
 
 private:
     class multiThreadFragmentProcessing
@@ -116,40 +129,34 @@ private:
         multiThreadFragmentProcessing(DaqDecoderICARUSTPCwROI const&     parent,
                                       detinfo::DetectorClocksData const& clockData,
                                       art::Handle<artdaq::Fragments>&    fragmentsHandle,
-                                      ConcurrentRawDigitCol&             concurrentRawRawDigits,
-                                      ConcurrentRawDigitCol&             concurrentRawDigits,
-                                      ConcurrentRawDigitCol&             coherentRawDigits,
-                                      ConcurrentWireCol&                 concurrentROIs)
+                                      OutputShardVec&                    outputShardVec,
+                                      bool                               roiOnly)
             : fDaqDecoderICARUSTPCwROI(parent),
               fClockData{clockData},
               fFragmentsHandle(fragmentsHandle),
-              fConcurrentRawRawDigits(concurrentRawRawDigits),
-              fConcurrentRawDigits(concurrentRawDigits),
-              fCoherentRawDigits(coherentRawDigits),
-              fConcurrentROIs(concurrentROIs)
+              fOutputShardVec(outputShardVec),
+              fROIOnly(roiOnly)
         {}
 
         void operator()(const tbb::blocked_range<size_t>& range) const
         {
             for (size_t idx = range.begin(); idx < range.end(); idx++)
-              fDaqDecoderICARUSTPCwROI.processSingleFragment(idx, fClockData, fFragmentsHandle, fConcurrentRawRawDigits, fConcurrentRawDigits, fCoherentRawDigits, fConcurrentROIs);
+              fDaqDecoderICARUSTPCwROI.processSingleFragment(idx, fClockData, fFragmentsHandle, fOutputShardVec[idx], fROIOnly);
         }
     private:
         const DaqDecoderICARUSTPCwROI&     fDaqDecoderICARUSTPCwROI;
         detinfo::DetectorClocksData const& fClockData;
         art::Handle<artdaq::Fragments>&    fFragmentsHandle;
-        ConcurrentRawDigitCol&             fConcurrentRawRawDigits;
-        ConcurrentRawDigitCol&             fConcurrentRawDigits;
-        ConcurrentRawDigitCol&             fCoherentRawDigits;
-        ConcurrentWireCol&                 fConcurrentROIs;
+        OutputShardVec&                    fOutputShardVec;
+        bool                               fROIOnly;
     };
 
     // Function to save our RawDigits
-    void saveRawDigits(const icarus_signal_processing::ArrayFloat&, 
-                       const icarus_signal_processing::VectorFloat&, 
+    void saveRawDigits(const icarus_signal_processing::ArrayFloat&,
+                       const icarus_signal_processing::VectorFloat&,
                        const icarus_signal_processing::VectorFloat&,
                        const icarus_signal_processing::VectorInt&,
-                       ConcurrentRawDigitCol&) const;
+                       RawDigitCollection&) const;
 
     // Fcl parameters.
     std::vector<art::InputTag>                                  fFragmentsLabelVec;          ///< The input artdaq fragment label vector (for more than one)
@@ -158,6 +165,8 @@ private:
     std::string                                                 fOutputRawWavePath;          ///< Path to assign to the output if asked for
     std::string                                                 fOutputCoherentPath;         ///< Path to assign to the output if asked for
     bool                                                        fDiagnosticOutput;           ///< Set this to get lots of messages
+    art::InputTag                                               fTriggerClassificationLabel; ///< If set, consult the trigger classification (from an upstream trigger decode) to do ROI-only decoding of offbeam gates
+    bool                                                        fStampLatency;               ///< Put a latency stamp for the keep-up budget monitoring
     float                                                       fSigmaForTruncation;         ///< Cut for truncated rms calc
     size_t                                                      fCoherentNoiseGrouping;      ///< Grouping for removing coherent noise
 
@@ -228,6 +237,7 @@ DaqDecoderICARUSTPCwROI::DaqDecoderICARUSTPCwROI(fhicl::ParameterSet const & pse
     {
         produces<std::vector<raw::RawDigit>>(fragmentLabel.instance());
         produces<std::vector<recob::Wire>>(fragmentLabel.instance());
+        produces<icarus::ChannelOccupancyIndex>(fragmentLabel.instance());
 
         if (fOutputRawWaveform)
             produces<std::vector<raw::RawDigit>>(fragmentLabel.instance() + fOutputRawWavePath);
@@ -236,6 +246,9 @@ DaqDecoderICARUSTPCwROI::DaqDecoderICARUSTPCwROI(fhicl::ParameterSet const & pse
             produces<std::vector<raw::RawDigit>>(fragmentLabel.instance() + fOutputCoherentPath);
     }
 
+    // The latency stamp for the keep-up budget monitoring, one per event
+    if (fStampLatency) produces<icarus::LatencyStamp>();
+
     // Set up a WireID to ROP plane number table
     PlaneToWireOffsetMap planeToLastWireOffsetMap; 
 
@@ -300,6 +313,8 @@ void DaqDecoderICARUSTPCwROI::configure(fhicl::ParameterSet const & pset)
     fOutputRawWavePath     = pset.get<std::string               >("OutputRawWavePath",                                               "raw");
     fOutputCoherentPath    = pset.get<std::string               >("OutputCoherentPath",                                              "Cor");
     fDiagnosticOutput      = pset.get<bool                      >("DiagnosticOutput",                                                false);
+    fTriggerClassificationLabel = pset.get<art::InputTag        >("TriggerClassificationLabel",                          art::InputTag());
+    fStampLatency          = pset.get<bool                      >("StampLatency",                                                    false);
     fSigmaForTruncation    = pset.get<float                     >("NSigmaForTrucation",                                                3.5);
     fCoherentNoiseGrouping = pset.get<size_t                    >("CoherentGrouping",                                                   64);
 }
@@ -326,6 +341,22 @@ void DaqDecoderICARUSTPCwROI::produce(art::Event & event, art::ProcessingFrame c
 
     mf::LogDebug("DaqDecoderICARUSTPCwROI") << "**** Processing raw data fragments ****" << std::endl;
 
+    // If the trigger decoder ran ahead of us we can consult its classification
+    // of the event: offbeam gates get decoded to candidate ROIs only, skipping
+    // the dense noise filtered waveform output which dominates the output work
+    bool roiOnly(false);
+
+    if (!fTriggerClassificationLabel.empty())
+    {
+        art::Handle<icarus::TriggerClassification> classificationHandle;
+        event.getByLabel(fTriggerClassificationLabel, classificationHandle);
+
+        if (classificationHandle.isValid() && classificationHandle->isOffbeam()) roiOnly = true;
+
+        if (fDiagnosticOutput && roiOnly)
+            mf::LogDebug(fLogCategory) << "==> Offbeam gate, decoding candidate ROIs only" << std::endl;
+    }
+
     // Check the concurrency 
     int max_concurrency = tbb::this_task_arena::max_concurrency();
 
@@ -343,10 +374,9 @@ void DaqDecoderICARUSTPCwROI::produce(art::Event & event, art::ProcessingFrame c
         art::Handle<artdaq::Fragments> daq_handle;
         event.getByLabel(fragmentLabel, daq_handle);
 
-        ConcurrentRawDigitCol concurrentRawDigits;
-        ConcurrentRawDigitCol concurrentRawRawDigits;
-        ConcurrentRawDigitCol coherentRawDigits;
-        ConcurrentWireCol     concurrentROIs;
+        // One output shard per fragment: distinct tasks write distinct shards
+        // so the decode loop runs with no synchronization on the output side
+        OutputShardVec outputShardVec(daq_handle->size());
 
         PlaneIdxToImageMap   planeIdxToImageMap;
         PlaneIdxToChannelMap planeIdxToChannelMap;
@@ -369,7 +399,7 @@ void DaqDecoderICARUSTPCwROI::produce(art::Event & event, art::ProcessingFrame c
         // ... Launch multiple threads with TBB to do the deconvolution and find ROIs in parallel
         auto const clockData = art::ServiceHandle<detinfo::DetectorClocksService>()->DataFor(event);
 
-        multiThreadFragmentProcessing fragmentProcessing(*this, clockData, daq_handle, concurrentRawRawDigits, concurrentRawDigits, coherentRawDigits, concurrentROIs);
+        multiThreadFragmentProcessing fragmentProcessing(*this, clockData, daq_handle, outputShardVec, roiOnly);
 
         tbb::parallel_for(tbb::blocked_range<size_t>(0, daq_handle->size()), fragmentProcessing);
 
@@ -377,11 +407,25 @@ void DaqDecoderICARUSTPCwROI::produce(art::Event & event, art::ProcessingFrame c
     //    multiThreadImageProcessing imageProcessing(*this, clockData, channelArrayPairVec, concurrentRawDigits, coherentRawDigits, concurrentROIs);
 
     //    tbb::parallel_for(tbb::blocked_range<size_t>(0, fNumROPs), imageProcessing);
-    
-        // Copy the raw digits from the concurrent vector to our output vector
-        RawDigitCollectionPtr rawDigitCollection = std::make_unique<std::vector<raw::RawDigit>>(std::move_iterator(concurrentRawDigits.begin()), 
-                                                                                                std::move_iterator(concurrentRawDigits.end()));
-    
+
+        // Merge the shards into the output collections: one pass to size the
+        // outputs so a single reservation covers everything, then move
+        size_t nRawDigits(0);
+        size_t nROIs(0);
+
+        for(const auto& outputShard : outputShardVec)
+        {
+            nRawDigits += outputShard.fRawDigits.size();
+            nROIs      += outputShard.fROIs.size();
+        }
+
+        RawDigitCollectionPtr rawDigitCollection = std::make_unique<std::vector<raw::RawDigit>>();
+
+        rawDigitCollection->reserve(nRawDigits);
+
+        for(auto& outputShard : outputShardVec)
+            std::move(outputShard.fRawDigits.begin(),outputShard.fRawDigits.end(),std::back_inserter(*rawDigitCollection));
+
         // Want the RawDigits to be sorted in channel order... has to be done somewhere so why not now?
         std::sort(rawDigitCollection->begin(),rawDigitCollection->end(),[](const auto& left,const auto&right){return left.Channel() < right.Channel();});
 
@@ -396,20 +440,48 @@ void DaqDecoderICARUSTPCwROI::produce(art::Event & event, art::ProcessingFrame c
         event.put(std::move(rawDigitCollection), fragmentLabel.instance());
 
         // Do the same to output the candidate ROIs
-        WireCollectionPtr wireCollection = std::make_unique<std::vector<recob::Wire>>(std::move_iterator(concurrentROIs.begin()),
-                                                                                      std::move_iterator(concurrentROIs.end()));
+        WireCollectionPtr wireCollection = std::make_unique<std::vector<recob::Wire>>();
+
+        wireCollection->reserve(nROIs);
+
+        for(auto& outputShard : outputShardVec)
+            std::move(outputShard.fROIs.begin(),outputShard.fROIs.end(),std::back_inserter(*wireCollection));
 
         std::sort(wireCollection->begin(),wireCollection->end(),[](const auto& left, const auto& right){return left.Channel() < right.Channel();});
 
+        // Distill the compact occupancy index from the candidate ROIs so that
+        // downstream consumers can skip the channels with no activity at all
+        std::unique_ptr<icarus::ChannelOccupancyIndex> occupancyIndex = std::make_unique<icarus::ChannelOccupancyIndex>();
+
+        for(const recob::Wire& wire : *wireCollection)
+        {
+            const recob::Wire::RegionsOfInterest_t& signalROI = wire.SignalROI();
+
+            if (signalROI.n_ranges() == 0) continue;
+
+            const auto& ranges = signalROI.get_ranges();
+
+            occupancyIndex->addChannel(wire.Channel(),
+                                       signalROI.n_ranges(),
+                                       ranges.front().begin_index(),
+                                       ranges.back().end_index());
+        }
+
         event.put(std::move(wireCollection), fragmentLabel.instance());
+
+        event.put(std::move(occupancyIndex), fragmentLabel.instance());
     
     
         if (fOutputRawWaveform)
         {
-            // Copy the raw digits from the concurrent vector to our output vector
-            RawDigitCollectionPtr rawRawDigitCollection = std::make_unique<std::vector<raw::RawDigit>>(std::move_iterator(concurrentRawRawDigits.begin()), 
-                                                                                                       std::move_iterator(concurrentRawRawDigits.end()));
-    
+            // Merge the raw digits from the shards into our output vector
+            RawDigitCollectionPtr rawRawDigitCollection = std::make_unique<std::vector<raw::RawDigit>>();
+
+            rawRawDigitCollection->reserve(nRawDigits);
+
+            for(auto& outputShard : outputShardVec)
+                std::move(outputShard.fRawRawDigits.begin(),outputShard.fRawRawDigits.end(),std::back_inserter(*rawRawDigitCollection));
+
             // Want the RawDigits to be sorted in channel order... has to be done somewhere so why not now?
             std::sort(rawRawDigitCollection->begin(),rawRawDigitCollection->end(),[](const auto& left,const auto&right){return left.Channel() < right.Channel();});
     
@@ -419,10 +491,14 @@ void DaqDecoderICARUSTPCwROI::produce(art::Event & event, art::ProcessingFrame c
     
         if (fOutputCorrection)
         {
-            // Copy the raw digits from the concurrent vector to our output vector
-            RawDigitCollectionPtr coherentCollection = std::make_unique<std::vector<raw::RawDigit>>(std::move_iterator(coherentRawDigits.begin()), 
-                                                                                                    std::move_iterator(coherentRawDigits.end()));
-    
+            // Merge the raw digits from the shards into our output vector
+            RawDigitCollectionPtr coherentCollection = std::make_unique<std::vector<raw::RawDigit>>();
+
+            coherentCollection->reserve(nRawDigits);
+
+            for(auto& outputShard : outputShardVec)
+                std::move(outputShard.fCoherentDigits.begin(),outputShard.fCoherentDigits.end(),std::back_inserter(*coherentCollection));
+
             // Want the RawDigits to be sorted in channel order... has to be done somewhere so why not now?
             std::sort(coherentCollection->begin(),coherentCollection->end(),[](const auto& left,const auto&right){return left.Channel() < right.Channel();});
     
@@ -431,6 +507,10 @@ void DaqDecoderICARUSTPCwROI::produce(art::Event & event, art::ProcessingFrame c
         }
     }
 
+    // Stamp the completion of the decode for the latency budget monitoring
+    if (fStampLatency)
+        event.put(std::make_unique<icarus::LatencyStamp>(icarus::LatencyStamp::stamp("decode")));
+
     theClockTotal.stop();
 
     double totalTime = theClockTotal.accumulated_real_time();
@@ -443,10 +523,8 @@ void DaqDecoderICARUSTPCwROI::produce(art::Event & event, art::ProcessingFrame c
 void DaqDecoderICARUSTPCwROI::processSingleFragment(size_t                             idx,
                                                     detinfo::DetectorClocksData const& clockData,
                                                     art::Handle<artdaq::Fragments>     fragmentHandle,
-                                                    ConcurrentRawDigitCol&             concurrentRawRawDigitCol,
-                                                    ConcurrentRawDigitCol&             concurrentRawDigitCol,
-                                                    ConcurrentRawDigitCol&             coherentRawDigitCol,
-                                                    ConcurrentWireCol&                 concurrentROIs) const
+                                                    OutputShard&                       outputShard,
+                                                    bool                               roiOnly) const
 {
     cet::cpu_timer theClockProcess;
 
@@ -524,6 +602,11 @@ void DaqDecoderICARUSTPCwROI::processSingleFragment(size_t
     channelArrayPair.first.resize(nChannelsPerBoard);
     channelArrayPair.second.resize(nChannelsPerBoard,icarus_signal_processing::VectorFloat(nSamplesPerChannel));
 
+    // Caller owned output buffer for the noise filtered waveforms: with the zero-copy
+    // filter interface the chain is fragment -> transpose into channelArrayPair ->
+    // filter in place -> denoised, with no staging copies inside the filter tool
+    icarus_signal_processing::ArrayFloat denoised(nChannelsPerBoard,icarus_signal_processing::VectorFloat(nSamplesPerChannel));
+
     // Now set up for output, we need to convert back from float to short int so use this
     raw::RawDigit::ADCvector_t wvfm(nSamplesPerChannel);
 
@@ -556,17 +639,15 @@ void DaqDecoderICARUSTPCwROI::processSingleFragment(size_t
         // Get the pointer to the start of this board's block of data
         const icarus::A2795DataBlock::data_t* dataBlock = physCrateFragment.BoardData(board);
 
-        // Copy to input data array
+        // Copy to input data array, transposing the tick-major board block to
+        // channel-major rows in a single cache-blocked pass
+        daq::details::transposeADCBlock(dataBlock, nChannelsPerBoard, nSamplesPerChannel, channelArrayPair.second);
+
         for(size_t chanIdx = 0; chanIdx < nChannelsPerBoard; chanIdx++)
         {
             // Get the channel number on the Fragment
 //            raw::ChannelID_t channel = channelPlanePairVec[chanIdx].first;
 
-            icarus_signal_processing::VectorFloat& rawDataVec = channelArrayPair.second[chanIdx];
-
-            for(size_t tick = 0; tick < nSamplesPerChannel; tick++)
-                rawDataVec[tick] = -dataBlock[chanIdx + tick * nChannelsPerBoard];
-
             // Keep track of the channel
             channelArrayPair.first[chanIdx] = channelPlanePairVec[chanIdx];
 
@@ -575,7 +656,9 @@ void DaqDecoderICARUSTPCwROI::processSingleFragment(size_t
         }
 
         //process_fragment(event, rawfrag, product_collection, header_collection);
-        decoderTool->process_fragment(clockData, channelArrayPair.first, channelArrayPair.second, fCoherentNoiseGrouping);
+        // Note this is the zero-copy entry point: the input array comes back pedestal
+        // corrected and the noise filtered waveforms land in our denoised array
+        decoderTool->process_fragment(clockData, channelArrayPair.first, channelArrayPair.second, denoised, fCoherentNoiseGrouping);
 
         // We need to recalculate pedestals for the noise corrected waveforms
         icarus_signal_processing::WaveformTools<float> waveformTools;
@@ -589,10 +672,7 @@ void DaqDecoderICARUSTPCwROI::processSingleFragment(size_t
 
         float sigmaCut(fSigmaForTruncation);
 
-        // Recover the denoised waveform
-        const icarus_signal_processing::ArrayFloat& denoised = decoderTool->getWaveLessCoherent();
-
-        icarus_signal_processing::VectorFloat       pedCorWaveforms(denoised[0].size());
+        icarus_signal_processing::VectorFloat pedCorWaveforms(denoised[0].size());
 
         for(size_t chanIdx = 0; chanIdx < nChannelsPerBoard; chanIdx++)
         {
@@ -600,47 +680,53 @@ void DaqDecoderICARUSTPCwROI::processSingleFragment(size_t
             raw::ChannelID_t channel = channelPlanePairVec[chanIdx].first;
 
             // Are we storing the raw waveforms?
-            if (fOutputRawWaveform)
+            if (fOutputRawWaveform && !roiOnly)
             {
-                const icarus_signal_processing::VectorFloat& waveform = decoderTool->getPedCorWaveforms()[chanIdx];
+                // The input array was pedestal corrected in place by the filter tool
+                const icarus_signal_processing::VectorFloat& waveform = channelArrayPair.second[chanIdx];
 
                 // Need to convert from float to short int
                 std::transform(waveform.begin(),waveform.end(),wvfm.begin(),[](const auto& val){return short(std::round(val));});
-    
-                ConcurrentRawDigitCol::iterator newRawObjItr = concurrentRawRawDigitCol.emplace_back(channel,wvfm.size(),wvfm); 
 
-                newRawObjItr->SetPedestal(decoderTool->getPedestalVals()[chanIdx],decoderTool->getFullRMSVals()[chanIdx]);
+                raw::RawDigit& newRawObj = outputShard.fRawRawDigits.emplace_back(channel,wvfm.size(),wvfm);
+
+                newRawObj.SetPedestal(decoderTool->getPedestalVals()[chanIdx],decoderTool->getFullRMSVals()[chanIdx]);
             }
 
-            if (fOutputCorrection)
+            if (fOutputCorrection && !roiOnly)
             {
                 const icarus_signal_processing::VectorFloat& corrections = decoderTool->getCorrectedMedians()[chanIdx];
 
                 // Need to convert from float to short int
                 std::transform(corrections.begin(),corrections.end(),wvfm.begin(),[](const auto& val){return short(std::round(val));});
 
-                //ConcurrentRawDigitCol::iterator newRawObjItr = coherentRawDigitCol.emplace_back(channel,wvfm.size(),wvfm); 
-                ConcurrentRawDigitCol::iterator newRawObjItr = coherentRawDigitCol.push_back(raw::RawDigit(channel,wvfm.size(),wvfm)); 
+                raw::RawDigit& newRawObj = outputShard.fCoherentDigits.emplace_back(channel,wvfm.size(),wvfm);
 
-                newRawObjItr->SetPedestal(0.,0.);
+                newRawObj.SetPedestal(0.,0.);
             }
 
-            // Now determine the pedestal and correct for it
-            waveformTools.getPedestalCorrectedWaveform(denoised[chanIdx],
-                                                       pedCorWaveforms,
-                                                       sigmaCut,
-                                                       localPedestal,
-                                                       localFullRMS,
-                                                       localTruncRMS,
-                                                       localNumTruncBins,
-                                                       localRangeBins);
+            // For ROI-only decoding skip the dense waveform output entirely:
+            // the pedestal recalculation and float to short conversion are
+            // only needed to build the RawDigit
+            if (!roiOnly)
+            {
+                // Now determine the pedestal and correct for it
+                waveformTools.getPedestalCorrectedWaveform(denoised[chanIdx],
+                                                           pedCorWaveforms,
+                                                           sigmaCut,
+                                                           localPedestal,
+                                                           localFullRMS,
+                                                           localTruncRMS,
+                                                           localNumTruncBins,
+                                                           localRangeBins);
 
-            // Need to convert from float to short int
-            std::transform(denoised[chanIdx].begin(),denoised[chanIdx].end(),wvfm.begin(),[](const auto& val){return short(std::round(val));});
+                // Need to convert from float to short int
+                std::transform(denoised[chanIdx].begin(),denoised[chanIdx].end(),wvfm.begin(),[](const auto& val){return short(std::round(val));});
 
-            ConcurrentRawDigitCol::iterator newObjItr = concurrentRawDigitCol.emplace_back(channel,wvfm.size(),wvfm); 
+                raw::RawDigit& newObj = outputShard.fRawDigits.emplace_back(channel,wvfm.size(),wvfm);
 
-            newObjItr->SetPedestal(localPedestal,localFullRMS);
+                newObj.SetPedestal(localPedestal,localFullRMS);
+            }
 
             // And, finally, the ROIs 
             const icarus_signal_processing::VectorBool& chanROIs = decoderTool->getROIVals()[chanIdx];
@@ -667,7 +753,7 @@ void DaqDecoderICARUSTPCwROI::processSingleFragment(size_t
                 roiIdx++;
             }
         
-            concurrentROIs.push_back(recob::WireCreator(std::move(ROIVec),channel,fGeometry->View(channel)).move());
+            outputShard.fROIs.push_back(recob::WireCreator(std::move(ROIVec),channel,fGeometry->View(channel)).move());
         }
     }
 
@@ -10,6 +10,7 @@
 #include "art/Framework/Services/Registry/ServiceHandle.h"
 #include "art/Framework/Principal/Event.h"
 #include "art/Framework/Principal/Handle.h"
+#include "art/Framework/Principal/Run.h"
 
 #include "canvas/Utilities/InputTag.h"
 #include "fhiclcpp/ParameterSet.h"
@@ -35,6 +36,7 @@ namespace daq
     DaqDecoderICARUSTrigger & operator = (DaqDecoderICARUSTrigger &&) = delete;
 
     void produce(art::Event & e) override;
+    void beginRun(art::Run & run) override;
     
   private:
     std::unique_ptr<IDecoder> fDecoderTool;
@@ -52,6 +54,12 @@ namespace daq
     return;
   }
   
+  void DaqDecoderICARUSTrigger::beginRun(art::Run & run)
+  {
+    fDecoderTool->setupRun(run);
+    return;
+  }
+
   void DaqDecoderICARUSTrigger::produce(art::Event & event)
   {
     fDecoderTool->initializeDataProducts();
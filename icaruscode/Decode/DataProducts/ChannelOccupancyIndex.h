@@ -0,0 +1,80 @@
+/**
+ * @file   icaruscode/Decode/DataProducts/ChannelOccupancyIndex.h
+ * @brief  Compact per-event index of which TPC channels carry activity.
+ *
+ * The ROI-finding decoders learn which channels have any signal while they
+ * build their candidate regions of interest; this product preserves that
+ * knowledge in a form downstream consumers can query in constant time, so
+ * that hit finding and the like can skip dead regions without re-scanning
+ * every channel. On low occupancy (e.g. calibration) triggers that is most
+ * of the detector.
+ */
+
+#ifndef ICARUSCODE_DECODE_DATAPRODUCTS_CHANNELOCCUPANCYINDEX_H
+#define ICARUSCODE_DECODE_DATAPRODUCTS_CHANNELOCCUPANCYINDEX_H
+
+// LArSoft libraries
+#include "larcoreobj/SimpleTypesAndConstants/RawTypes.h" // raw::ChannelID_t
+
+// C/C++ standard libraries
+#include <cstdint>
+#include <vector>
+
+
+// -----------------------------------------------------------------------------
+namespace icarus { struct ChannelOccupancyIndex; }
+
+/**
+ * @brief Bit-packed channel activity plus per-channel ROI summaries.
+ *
+ * The bitmap answers "does this channel have any activity?" in constant
+ * time; the channel list carries, for each active channel, the number of
+ * regions of interest and the tick extent they span, in ascending channel
+ * order (the order the producing decoders emit their wires in).
+ */
+struct icarus::ChannelOccupancyIndex {
+
+  /// Activity summary of a single channel.
+  struct ChannelActivity {
+    raw::ChannelID_t channel   = raw::InvalidChannelID; ///< Channel ID.
+    unsigned int     nROIs     = 0U; ///< Number of regions of interest.
+    unsigned int     beginTick = 0U; ///< First tick with activity.
+    unsigned int     endTick   = 0U; ///< Tick after the last with activity.
+  }; // struct ChannelActivity
+
+  /// One bit per channel ID (bit `ID % 64` of word `ID / 64`): set if active.
+  std::vector<std::uint64_t> activityBits;
+
+  /// Per-channel summaries of the active channels, ascending channel order.
+  std::vector<ChannelActivity> channels;
+
+
+  /// Records activity on `channel`; expected in ascending channel order.
+  void addChannel(raw::ChannelID_t channel,
+                  unsigned int nROIs,
+                  unsigned int beginTick,
+                  unsigned int endTick)
+    {
+      std::size_t const word = channel / 64U;
+      if (word >= activityBits.size()) activityBits.resize(word + 1U, 0ULL);
+      activityBits[word] |= 1ULL << (channel % 64U);
+      channels.push_back({ channel, nROIs, beginTick, endTick });
+    }
+
+  /// Returns whether `channel` has any recorded activity.
+  bool isActive(raw::ChannelID_t channel) const
+    {
+      std::size_t const word = channel / 64U;
+      return (word < activityBits.size())
+        && (activityBits[word] & (1ULL << (channel % 64U)));
+    }
+
+  /// Returns the number of channels with recorded activity.
+  std::size_t nActiveChannels() const { return channels.size(); }
+
+}; // struct icarus::ChannelOccupancyIndex
+
+
+// -----------------------------------------------------------------------------
+
+#endif // ICARUSCODE_DECODE_DATAPRODUCTS_CHANNELOCCUPANCYINDEX_H
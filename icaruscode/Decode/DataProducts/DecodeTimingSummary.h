@@ -0,0 +1,78 @@
+/**
+ * @file   icaruscode/Decode/DataProducts/DecodeTimingSummary.h
+ * @brief  Per-event record of where the decoding stages spent their time.
+ *
+ * This is a lightweight diagnostic data product: decoder modules accumulate
+ * the wall clock time spent in each of their stages (fragment parsing, noise
+ * filtering, product assembly, ...) and store the result in the event, so
+ * that keep-up processing performance can be tracked offline and regressions
+ * between releases show up in the output itself.
+ */
+
+#ifndef ICARUSCODE_DECODE_DATAPRODUCTS_DECODETIMINGSUMMARY_H
+#define ICARUSCODE_DECODE_DATAPRODUCTS_DECODETIMINGSUMMARY_H
+
+// C/C++ standard libraries
+#include <string>
+#include <vector>
+
+
+// -----------------------------------------------------------------------------
+namespace icarus { struct DecodeTimingSummary; }
+
+/**
+ * @brief Wall clock time spent by a decoder module in each of its stages.
+ *
+ * Stage names are chosen by the producing module; the convention is short
+ * camel case labels like `"fragmentParse"`, `"noiseFilter"` and
+ * `"productAssembly"`. Times from repeated executions of the same stage
+ * within the event (e.g. one per fragment) are summed into a single entry.
+ */
+struct icarus::DecodeTimingSummary {
+
+  /// Accumulated time of a single decoding stage.
+  struct StageTime {
+    std::string  name;         ///< Name of the stage.
+    double       seconds = 0.; ///< Accumulated wall clock time [s]
+    unsigned int entries = 0U; ///< Number of timed intervals summed up.
+  }; // struct StageTime
+
+  std::string sourceLabel; ///< Label of the module the times belong to.
+
+  std::vector<StageTime> stages; ///< One entry per instrumented stage.
+
+
+  /// Adds `seconds` to the stage `name`, creating the entry if needed.
+  void addTime(std::string const& name, double seconds)
+    {
+      for (StageTime& stage: stages) {
+        if (stage.name != name) continue;
+        stage.seconds += seconds;
+        ++stage.entries;
+        return;
+      }
+      stages.push_back({ name, seconds, 1U });
+    }
+
+  /// Returns the entry of stage `name`, `nullptr` if that stage is not there.
+  StageTime const* findStage(std::string const& name) const
+    {
+      for (StageTime const& stage: stages)
+        if (stage.name == name) return &stage;
+      return nullptr;
+    }
+
+  /// Returns the time accumulated by all the stages together [s]
+  double totalSeconds() const
+    {
+      double total = 0.;
+      for (StageTime const& stage: stages) total += stage.seconds;
+      return total;
+    }
+
+}; // struct icarus::DecodeTimingSummary
+
+
+// -----------------------------------------------------------------------------
+
+#endif // ICARUSCODE_DECODE_DATAPRODUCTS_DECODETIMINGSUMMARY_H
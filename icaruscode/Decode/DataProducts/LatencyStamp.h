@@ -0,0 +1,67 @@
+/**
+ * @file   icaruscode/Decode/DataProducts/LatencyStamp.h
+ * @brief  Wall clock stamp marking when a processing stage finished an event.
+ * @author Gianluca Petrillo (petrillo@slac.stanford.edu)
+ *
+ * The keep-up stream (decode, hit finding, CRT matching...) operates under a
+ * hard latency budget. Each participating module puts one of these stamps at
+ * the end of its processing, under its own module label; a monitoring module
+ * (`icarus::LatencyBudgetMonitor`) then reads the stamps in pipeline order,
+ * histograms the per-stage latencies and raises an alarm when the end-to-end
+ * time exceeds the budget.
+ *
+ * Stamping a stage takes two lines:
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * produces<icarus::LatencyStamp>();                          // constructor
+ * event.put(std::make_unique<icarus::LatencyStamp>
+ *   (icarus::LatencyStamp::stamp("myStage")));               // end of produce()
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ */
+
+#ifndef ICARUSCODE_DECODE_DATAPRODUCTS_LATENCYSTAMP_H
+#define ICARUSCODE_DECODE_DATAPRODUCTS_LATENCYSTAMP_H
+
+// C/C++ standard libraries
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+
+// -----------------------------------------------------------------------------
+namespace icarus { struct LatencyStamp; }
+
+/**
+ * @brief Wall clock time at which one processing stage finished an event.
+ *
+ * Times are in nanoseconds from the Unix epoch (system clock), so stamps from
+ * different processes on the same (synchronized) host can be compared.
+ */
+struct icarus::LatencyStamp {
+
+  std::string stage; ///< Name of the stage that put the stamp.
+
+  std::uint64_t time = 0U; ///< Wall clock of the stamp [ns from Unix epoch]
+
+  // --- BEGIN -- Access -------------------------------------------------------
+
+  /// Returns whether the stamp was ever set.
+  bool isValid() const { return time != 0U; }
+
+  // --- END -- Access ---------------------------------------------------------
+
+
+  /// Returns the current wall clock time [ns from Unix epoch]
+  static std::uint64_t now()
+    {
+      return std::chrono::duration_cast<std::chrono::nanoseconds>
+        (std::chrono::system_clock::now().time_since_epoch()).count();
+    }
+
+  /// Returns a stamp of the current time for the stage named `stageName`.
+  static LatencyStamp stamp(std::string stageName)
+    { return { std::move(stageName), now() }; }
+
+}; // icarus::LatencyStamp
+
+
+#endif // ICARUSCODE_DECODE_DATAPRODUCTS_LATENCYSTAMP_H
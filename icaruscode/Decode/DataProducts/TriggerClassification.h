@@ -0,0 +1,58 @@
+/**
+ * @file   icaruscode/Decode/DataProducts/TriggerClassification.h
+ * @brief  Lightweight classification of the trigger of an event.
+ *
+ * The trigger fragment is by far the cheapest one to decode, so in a
+ * topology where the trigger decoder runs first this product lets the heavy
+ * TPC and PMT decoders tailor (or skip most of) their work before touching
+ * their own fragments: for example, an offbeam gate can be decoded to
+ * regions of interest only, with no dense waveform output.
+ * Only information needed for that routing decision belongs here; the full
+ * trigger description lives in `sbn::ExtraTriggerInfo`.
+ */
+
+#ifndef ICARUSCODE_DECODE_DATAPRODUCTS_TRIGGERCLASSIFICATION_H
+#define ICARUSCODE_DECODE_DATAPRODUCTS_TRIGGERCLASSIFICATION_H
+
+
+// -----------------------------------------------------------------------------
+namespace icarus { struct TriggerClassification; }
+
+/**
+ * @brief Summary of the trigger of an event for downstream decoder routing.
+ *
+ * The gate type uses the codes from the trigger hardware (the same ones the
+ * trigger decoder translates into `sbn::triggerSource`); `Unknown` doubles
+ * as the "no classification" value, so that consumers fall back to their
+ * full decoding path when the trigger could not be classified.
+ */
+struct icarus::TriggerClassification {
+
+  // --- BEGIN -- Gate type codes from the trigger hardware --------------------
+  static constexpr int Unknown     = 0; ///< Gate type not known (or not set).
+  static constexpr int BNB         = 1; ///< Gate opened on BNB beam.
+  static constexpr int NuMI        = 2; ///< Gate opened on NuMI beam.
+  static constexpr int OffbeamBNB  = 3; ///< BNB-like gate away from the beam.
+  static constexpr int OffbeamNuMI = 4; ///< NuMI-like gate away from the beam.
+  // --- END ---- Gate type codes from the trigger hardware --------------------
+
+  /// Type of the gate the trigger fired in (one of the codes above).
+  int gateType = Unknown;
+
+
+  /// Returns whether the trigger was successfully classified.
+  bool isValid() const { return gateType != Unknown; }
+
+  /// Returns whether the gate was opened on an actual beam spill.
+  bool isBeam() const { return (gateType == BNB) || (gateType == NuMI); }
+
+  /// Returns whether the gate was opened away from the beam.
+  bool isOffbeam() const
+    { return (gateType == OffbeamBNB) || (gateType == OffbeamNuMI); }
+
+}; // struct icarus::TriggerClassification
+
+
+// -----------------------------------------------------------------------------
+
+#endif // ICARUSCODE_DECODE_DATAPRODUCTS_TRIGGERCLASSIFICATION_H
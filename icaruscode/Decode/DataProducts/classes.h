@@ -4,15 +4,25 @@
  * @date   July 10, 2019
  * 
  * Enables dictionary definitions for:
- * 
+ *
  * * `sbn::ExtraTriggerInfo`
- * 
+ * * `icarus::DecodeTimingSummary`
+ * * `icarus::ChannelOccupancyIndex`
+ * * `icarus::TriggerClassification`
+ * * `icarus::PMTFragmentIntegrity`
+ * * `icarus::LatencyStamp`
+ *
  * See also `sbnobj/Common/Trigger/classes_def.xml`.
  */
 
 // SBN libraries
 // #include "sbnobj/Common/Trigger/ExtraTriggerInfo.h"
 #include "icaruscode/Decode/DataProducts/ExtraTriggerInfo.h"
+#include "icaruscode/Decode/DataProducts/DecodeTimingSummary.h"
+#include "icaruscode/Decode/DataProducts/ChannelOccupancyIndex.h"
+#include "icaruscode/Decode/DataProducts/TriggerClassification.h"
+#include "icaruscode/Decode/DataProducts/PMTFragmentIntegrity.h"
+#include "icaruscode/Decode/DataProducts/LatencyStamp.h"
 
 // framework libraries
 #include "canvas/Persistency/Common/Ptr.h"
@@ -20,7 +30,12 @@
 
 
 namespace {
-  
+
   sbn::ExtraTriggerInfo tinfo;
-  
+  icarus::DecodeTimingSummary dtiming;
+  icarus::ChannelOccupancyIndex coccup;
+  icarus::TriggerClassification tclass;
+  icarus::PMTFragmentIntegrity pmtintegrity;
+  icarus::LatencyStamp lstamp;
+
 } // local namespace
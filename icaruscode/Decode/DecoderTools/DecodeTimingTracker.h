@@ -0,0 +1,146 @@
+/**
+ * @file   icaruscode/Decode/DecoderTools/DecodeTimingTracker.h
+ * @brief  Helpers for filling `icarus::DecodeTimingSummary` products.
+ * @see    icaruscode/Decode/DataProducts/DecodeTimingSummary.h
+ *
+ * Two pieces of instrumentation shared by the decoder modules:
+ *
+ * * `icarus::StageStopwatch`: RAII timer adding the wall clock time of its
+ *   own lifetime to one stage of a `icarus::DecodeTimingSummary`;
+ * * `icarus::DecodeTimingPercentiles`: job-level accumulator of the per-event
+ *   summaries, printing a percentile report at end of job.
+ *
+ * Neither is persisted; only `icarus::DecodeTimingSummary` goes in the event.
+ */
+
+#ifndef ICARUSCODE_DECODE_DECODERTOOLS_DECODETIMINGTRACKER_H
+#define ICARUSCODE_DECODE_DECODERTOOLS_DECODETIMINGTRACKER_H
+
+// ICARUS libraries
+#include "icaruscode/Decode/DataProducts/DecodeTimingSummary.h"
+
+// framework libraries
+#include "messagefacility/MessageLogger/MessageLogger.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::sort()
+#include <chrono>
+#include <map>
+#include <string>
+#include <vector>
+
+
+// -----------------------------------------------------------------------------
+namespace icarus {
+  class StageStopwatch;
+  class DecodeTimingPercentiles;
+}
+
+/**
+ * @brief Adds the wall clock time of its own lifetime to a summary stage.
+ *
+ * Example:
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+ * {
+ *   icarus::StageStopwatch timer{ summary, "noiseFilter" };
+ *   runNoiseFilter();
+ * } // time charged to the "noiseFilter" stage here
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ */
+class icarus::StageStopwatch {
+
+  using Clock_t = std::chrono::steady_clock;
+
+  DecodeTimingSummary& fSummary; ///< Where the time ends up.
+  std::string fStageName;        ///< Which stage to charge it to.
+  Clock_t::time_point fStart;    ///< When this object was created.
+
+    public:
+
+  StageStopwatch(DecodeTimingSummary& summary, std::string stageName)
+    : fSummary(summary)
+    , fStageName(std::move(stageName))
+    , fStart(Clock_t::now())
+    {}
+
+  // not copiable nor movable: one timed interval per object
+  StageStopwatch(StageStopwatch const&) = delete;
+  StageStopwatch& operator= (StageStopwatch const&) = delete;
+
+  ~StageStopwatch()
+    {
+      std::chrono::duration<double> const elapsed = Clock_t::now() - fStart;
+      fSummary.addTime(fStageName, elapsed.count());
+    }
+
+}; // class icarus::StageStopwatch
+
+
+/**
+ * @brief Accumulates per-event timing summaries and reports percentiles.
+ *
+ * Decoder modules feed every event summary via `add()` and call `report()`
+ * from their end-of-job method; the report lists, stage by stage, the median,
+ * 90% and 99% percentiles and the maximum of the per-event times, which is
+ * the information needed to judge keep-up processing margins (the tail
+ * events, not the average, are what make a stream fall behind).
+ */
+class icarus::DecodeTimingPercentiles {
+
+  /// Per-event times collected so far, stage by stage [s]
+  std::map<std::string, std::vector<double>> fStageTimes;
+
+    public:
+
+  /// Adds the content of an event summary to the accumulated statistics.
+  void add(DecodeTimingSummary const& summary)
+    {
+      for (DecodeTimingSummary::StageTime const& stage: summary.stages)
+        fStageTimes[stage.name].push_back(stage.seconds);
+    }
+
+  /// Prints the percentile report under the specified message category.
+  void report(std::string const& category)
+    {
+      mf::LogInfo log { category };
+
+      log << "Decoding stage times over " << nEvents() << " events [s]:";
+
+      for (auto& [ name, times ]: fStageTimes) {
+        if (times.empty()) continue;
+
+        std::sort(times.begin(), times.end());
+
+        log << "\n  " << name
+          << ": median=" << percentile(times, 0.50)
+          << "  p90=" << percentile(times, 0.90)
+          << "  p99=" << percentile(times, 0.99)
+          << "  max=" << times.back();
+      } // for stages
+    }
+
+  /// Returns the largest number of entries collected for a single stage.
+  std::size_t nEvents() const
+    {
+      std::size_t n = 0U;
+      for (auto const& [ name, times ]: fStageTimes)
+        if (times.size() > n) n = times.size();
+      return n;
+    }
+
+    private:
+
+  /// Returns the requested percentile of a sorted, non-empty time list.
+  static double percentile(std::vector<double> const& sortedTimes, double f)
+    {
+      std::size_t index = static_cast<std::size_t>(f * sortedTimes.size());
+      if (index >= sortedTimes.size()) index = sortedTimes.size() - 1U;
+      return sortedTimes[index];
+    }
+
+}; // class icarus::DecodeTimingPercentiles
+
+
+// -----------------------------------------------------------------------------
+
+#endif // ICARUSCODE_DECODE_DECODERTOOLS_DECODETIMINGTRACKER_H
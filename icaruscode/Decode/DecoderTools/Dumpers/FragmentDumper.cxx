@@ -15,19 +15,24 @@
 
 // C/C++ standard libraries
 #include <ostream>
+#include <string>
+#include <algorithm> // std::min()
 #include <cstddef> // std::size_t
 #include <cassert>
 
 
 // -----------------------------------------------------------------------------
 // forward declarations
-namespace { void dumpFragmentImpl(std::ostream&, artdaq::Fragment const&); }
+namespace {
+  void dumpFragmentImpl
+    (std::ostream&, artdaq::Fragment const&, std::size_t maxBytes);
+}
 
 
 // -----------------------------------------------------------------------------
 std::ostream& sbndaq::details::operator<<
   (std::ostream& out, DumpFragWrap const& wrap)
-  { ::dumpFragmentImpl(out, wrap.frag); return out; }
+  { ::dumpFragmentImpl(out, wrap.frag, wrap.maxBytes); return out; }
 
 
 // -----------------------------------------------------------------------------
@@ -35,13 +40,40 @@ sbndaq::details::DumpFragWrap sbndaq::dumpFragment(artdaq::Fragment const& frag)
   { return details::DumpFragWrap{ frag }; }
 
 
+// -----------------------------------------------------------------------------
+sbndaq::details::DumpFragWrap sbndaq::dumpFragment
+  (artdaq::Fragment const& frag, std::size_t maxBytes)
+  { return details::DumpFragWrap{ frag, maxBytes }; }
+
+
 // -----------------------------------------------------------------------------
 namespace {
-  
-  void dumpFragmentImpl(std::ostream& out, artdaq::Fragment const& frag) {
-    
+
+  /// Dumps one block of the fragment, at most `maxBytes` bytes of it.
+  void dumpBlock(
+    std::ostream& out, std::string const& name,
+    artdaq::Fragment::byte_t const* data, std::size_t size,
+    std::size_t maxBytes
+  ) {
+
+    std::size_t const dumpSize = std::min(size, maxBytes);
+
+    out << " - " << name << " (" << size << " bytes";
+    if (dumpSize < size) out << ", first " << dumpSize << " dumped";
+    out << "):";
+    if (data)
+      out << icarus::ns::util::hexdump(data, dumpSize);
+    else out << " n/a" << "\n";
+
+  } // dumpBlock()
+
+
+  void dumpFragmentImpl
+    (std::ostream& out, artdaq::Fragment const& frag, std::size_t maxBytes)
+  {
+
     out << "Fragment summary: " << frag; // ends with <CR>
-    
+
     artdaq::Fragment::byte_t const* headerData = frag.headerBeginBytes();
     std::size_t const headerSize = frag.headerSizeBytes();
     assert(headerData); // this is the pointer to the begin of everything
@@ -50,22 +82,13 @@ namespace {
     artdaq::Fragment::byte_t const* metaData
       = frag.metadata<artdaq::Fragment::byte_t>();
     std::size_t const metadataSize = metaData? (payloadData - metaData): 0;
-    
-    out << " - header (" << headerSize << " bytes):";
-    if (headerData)
-      out << icarus::ns::util::hexdump(headerData, headerSize);
-    else out << " n/a" << "\n";
-    out << " - metadata (" << metadataSize << " bytes):";
-    if (metaData)
-      out << icarus::ns::util::hexdump(metaData, metadataSize);
-    else out << " n/a" << "\n";
-    out << " - data (" << payloadSize << " bytes):";
-    if (payloadData)
-      out << icarus::ns::util::hexdump(payloadData, payloadSize);
-    else out << " n/a" << "\n";
-    
+
+    dumpBlock(out, "header",   headerData,  headerSize,   maxBytes);
+    dumpBlock(out, "metadata", metaData,    metadataSize, maxBytes);
+    dumpBlock(out, "data",     payloadData, payloadSize,  maxBytes);
+
   } // dumpFragmentImpl()
-  
+
 } // local namespace
 
 
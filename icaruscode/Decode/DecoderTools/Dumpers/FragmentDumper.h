@@ -16,15 +16,26 @@
 
 // C/C++ standard libraries
 #include <iosfwd>
+#include <limits>
+#include <cstddef> // std::size_t
 
 
 // -----------------------------------------------------------------------------
 namespace sbndaq::details {
-  
-  struct DumpFragWrap { artdaq::Fragment const& frag; };
-  
+
+  struct DumpFragWrap {
+
+    /// Special `maxBytes` value: no limit on the dump size.
+    static constexpr std::size_t NoLimit
+      = std::numeric_limits<std::size_t>::max();
+
+    artdaq::Fragment const& frag;
+    std::size_t maxBytes = NoLimit; ///< Cap on bytes dumped per data block.
+
+  }; // struct DumpFragWrap
+
   std::ostream& operator<< (std::ostream& out, DumpFragWrap const& wrap);
-  
+
 } // namespace sbndaq::details
 // -----------------------------------------------------------------------------
 
@@ -51,8 +62,22 @@ namespace sbndaq {
    * This is actually a helper function that just passes the task.
    */
   details::DumpFragWrap dumpFragment(artdaq::Fragment const& frag);
-  
-  
+
+  /**
+   * @brief Like `dumpFragment(artdaq::Fragment const&)`, with a size cap.
+   * @param frag fragment to be dumped
+   * @param maxBytes maximum number of bytes dumped out of each data block
+   * @return an object that can be inserted in an output stream
+   *
+   * Each block of the fragment (header, metadata, payload) is dumped only up
+   * to `maxBytes` bytes, and the dump notes how much was left out. This keeps
+   * both the output and the memory spent formatting it bounded even for
+   * pathologically large fragments.
+   */
+  details::DumpFragWrap dumpFragment
+    (artdaq::Fragment const& frag, std::size_t maxBytes);
+
+
   // ---------------------------------------------------------------------------
   
 } // namespace sbndaq
@@ -58,6 +58,26 @@ public:
                                   const icarus_signal_processing::ArrayFloat&,
                                   const size_t&) = 0;
 
+    /**
+     *  @brief Zero-copy variant of the above where the caller owns the buffers:
+     *         the input array is pedestal corrected in place (so on return it
+     *         holds the pedestal corrected waveforms) and the noise filtered
+     *         waveforms are written to the caller provided output array. This
+     *         avoids the staging copies into the tool's own containers, so
+     *         note that getPedCorWaveforms() and getWaveLessCoherent() do NOT
+     *         reflect this call; the scalar outputs (pedestals, rms, ROIs...)
+     *         are filled as usual
+     *
+     *  @param ChannelVec           list of channels associated to input data array
+     *  @param ArrayFloat           array by channel of the waveforms, pedestal corrected in place
+     *  @param ArrayFloat           output array for the noise filtered waveforms
+     */
+    virtual void process_fragment(detinfo::DetectorClocksData const&,
+                                  const daq::INoiseFilter::ChannelPlaneVec&,
+                                  icarus_signal_processing::ArrayFloat&,
+                                  icarus_signal_processing::ArrayFloat&,
+                                  const size_t&) = 0;
+
     /**
      *  @brief Recover the channels for the processed fragment
      */
@@ -46,6 +46,7 @@
 #include "icaruscode/Decode/DecoderTools/details/PMTDecoderUtils.h"
 #include "icaruscode/Decode/DecoderTools/IDecoder.h"
 #include "icaruscode/Decode/ChannelMapping/IICARUSChannelMap.h"
+#include "icaruscode/Utilities/ProductSizeAdvisor.h"
 #include "icarusalg/Utilities/FHiCLutils.h" // util::fhicl::getOptionalValue()
 #include "icarusalg/Utilities/BinaryDumpUtils.h" // icarus::ns::util::bin()
 #include "sbnobj/Common/PMT/Data/PMTconfiguration.h" // sbn::PMTconfiguration
@@ -441,7 +442,25 @@ private:
       nanoseconds preTriggerTime;
       nanoseconds PMTtriggerDelay;
     };
-    
+
+    /// All board information needed during decoding, resolved once per run.
+    struct BoardDecodeRecord_t {
+
+      /// Number of channels in a V1730 readout board.
+      static constexpr std::size_t NChannelsPerBoard = 16U;
+
+      /// Name and timing information of the board (empty if board is unknown).
+      std::optional<NeededBoardInfo_t> info;
+
+      /// Number of valid entries in `channels`.
+      std::size_t nChannels = 0U;
+
+      /// Digitizer channel to channel ID pairs, in channel mapping order.
+      std::array<icarusDB::DigitizerChannelChannelIDPair, NChannelsPerBoard>
+        channels;
+
+    }; // BoardDecodeRecord_t
+
     // --- BEGIN -- Configuration parameters -----------------------------------
     bool const        fDiagnosticOutput; ///< If true will spew endless messages to output.
     
@@ -489,8 +508,14 @@ private:
     
     /// Find the information on a readout boards by fragment ID.
     std::optional<details::BoardInfoLookup> fBoardInfoLookup;
-    
-    
+
+    /// Decoding records indexed by effective fragment ID (`setupBoardRecords()`).
+    std::vector<BoardDecodeRecord_t> fBoardRecords;
+
+    /// Key of this tool's waveform size statistics in the reservation advisor.
+    static constexpr char const* WaveformCountKey = "PMTDecoder/OpDetWaveform";
+
+
     /// Trigger timestamp for the current event.
     SplitTimestamp_t fTriggerTimestamp;
     
@@ -525,6 +550,19 @@ private:
     NeededBoardInfo_t fetchNeededBoardInfo
       (details::BoardInfoLookup::BoardInfo_t const* boardInfo, unsigned int fragmentID) const;
 
+    /**
+     * @brief Rebuilds the per-board decoding records (`fBoardRecords`).
+     *
+     * The records condense the board information from `fBoardInfoLookup` and
+     * the channel mapping database into a vector indexed by effective fragment
+     * ID, so that the decoding of each fragment requires no lookup at all.
+     * Boards with no entry in `fBoardInfoLookup` have no record either, and
+     * fall back to the full lookup (and to the pertaining error handling).
+     *
+     * Requires `fBoardInfoLookup` to be up to date.
+     */
+    void setupBoardRecords();
+
 
     /**
      * @brief Returns the count of set bits for each set bit.
@@ -762,6 +800,7 @@ void daq::PMTDecoder::setupRun(art::Run const& run)
       ? run.getHandle<sbn::PMTconfiguration>(*fPMTconfigTag).product(): nullptr;
     
     UpdatePMTConfiguration(PMTconfig);
+    setupBoardRecords();
 }
 
 
@@ -798,6 +837,11 @@ void daq::PMTDecoder::setupEvent(art::Event const& event)
 void daq::PMTDecoder::initializeDataProducts()
 {
     fOpDetWaveformCollection = OpDetWaveformCollectionPtr(new OpDetWaveformCollection);
+    // events tend to be alike: the sizes of the previous ones are a good hint
+    fOpDetWaveformCollection->reserve(
+      art::ServiceHandle<icarus::ns::util::ProductSizeAdvisor>()
+        ->recommendedCapacity(WaveformCountKey)
+      );
 }
 
 
@@ -877,23 +921,35 @@ void daq::PMTDecoder::process_fragment(const artdaq::Fragment &artdaqFragment)
          * starts. Oh, and the delay from the global trigger time to when
          * the readout board receives and processes the trigger signal.
          */
-        details::BoardInfoLookup::BoardInfo_t const* boardInfo = fBoardInfoLookup->findBoardInfo(fragment_id);
-        if (!boardInfo) {
-            if (fRequireKnownBoards) {
-                cet::exception e("PMTDecoder");
-                e << "Input fragment has ID " << fragment_id
-                  << " which has no associated board information (`BoardSetup`";
-                if (!hasPMTconfiguration()) e << " + `.FragmentID`";
-                throw e << ").\n";
+        // boards known to the database have a record resolved once per run;
+        // the others go through the full search (and its error handling)
+        BoardDecodeRecord_t const* record
+          = ((eff_fragment_id < fBoardRecords.size())
+            && fBoardRecords[eff_fragment_id].info)
+          ? &(fBoardRecords[eff_fragment_id]): nullptr;
+
+        std::optional<NeededBoardInfo_t> fallbackInfo;
+        if (!record) {
+            details::BoardInfoLookup::BoardInfo_t const* boardInfo = fBoardInfoLookup->findBoardInfo(fragment_id);
+            if (!boardInfo) {
+                if (fRequireKnownBoards) {
+                    cet::exception e("PMTDecoder");
+                    e << "Input fragment has ID " << fragment_id
+                      << " which has no associated board information (`BoardSetup`";
+                    if (!hasPMTconfiguration()) e << " + `.FragmentID`";
+                    throw e << ").\n";
+                }
             }
+            else {
+                assert(boardInfo->fragmentID == fragment_id);
+                assert(boardInfo->setup);
+            }
+
+            fallbackInfo.emplace(fetchNeededBoardInfo(boardInfo, fragment_id));
         }
-        else {
-            assert(boardInfo->fragmentID == fragment_id);
-            assert(boardInfo->setup);
-        }
-        
-        NeededBoardInfo_t const info = fetchNeededBoardInfo(boardInfo, fragment_id);
-        
+
+        NeededBoardInfo_t const& info = record? *(record->info): *fallbackInfo;
+
         nanoseconds const preTriggerTime = info.preTriggerTime;
         nanoseconds const PMTtriggerDelay = info.PMTtriggerDelay;
         auto const timeStamp
@@ -904,14 +960,24 @@ void daq::PMTDecoder::process_fragment(const artdaq::Fragment &artdaqFragment)
           << " - " << PMTtriggerDelay << " - " << preTriggerTime
           ;
 
-        const icarusDB::DigitizerChannelChannelIDPairVec& digitizerChannelVec
-          = fChannelMap.getChannelIDPairVec(eff_fragment_id);
-        
+        icarusDB::DigitizerChannelChannelIDPair const* chBegin;
+        icarusDB::DigitizerChannelChannelIDPair const* chEnd;
+        if (record) {
+            chBegin = record->channels.data();
+            chEnd   = chBegin + record->nChannels;
+        }
+        else {
+            const icarusDB::DigitizerChannelChannelIDPairVec& digitizerChannelVec
+              = fChannelMap.getChannelIDPairVec(eff_fragment_id);
+            chBegin = digitizerChannelVec.data();
+            chEnd   = chBegin + digitizerChannelVec.size();
+        }
+
         std::optional<mf::LogVerbatim> diagOut;
         if (fDiagnosticOutput) {
           diagOut.emplace(fLogCategory);
           (*diagOut)
-            << "      " << digitizerChannelVec.size() << " channels:";
+            << "      " << (chEnd - chBegin) << " channels:";
         }
         // Allocate the vector outside the loop just since we'll reuse it over and over... 
         std::vector<uint16_t> wvfm(nSamplesPerChannel);
@@ -919,8 +985,10 @@ void daq::PMTDecoder::process_fragment(const artdaq::Fragment &artdaqFragment)
         // track what we do and what we want to
         uint16_t attemptedChannels = 0;
         
-        for(auto const [ digitizerChannel, channelID ]: digitizerChannelVec)
+        for(auto const* chPair = chBegin; chPair != chEnd; ++chPair)
         {
+            auto const [ digitizerChannel, channelID ] = *chPair;
+
             if (diagOut)
               (*diagOut) << " " << digitizerChannel << " [=> " << channelID << "];";
             
@@ -989,6 +1057,10 @@ void daq::PMTDecoder::process_fragment(const artdaq::Fragment &artdaqFragment)
 
 void daq::PMTDecoder::outputDataProducts(art::Event& event)
 {
+    // remember how much space the next event is likely to need
+    art::ServiceHandle<icarus::ns::util::ProductSizeAdvisor>()
+      ->reportSize(WaveformCountKey, fOpDetWaveformCollection->size());
+
     // Want the RawDigits to be sorted in channel order... has to be done somewhere so why not now?
     std::sort(fOpDetWaveformCollection->begin(),fOpDetWaveformCollection->end(),[](const auto& left,const auto&right){return left.ChannelNumber() < right.ChannelNumber();});
 
@@ -1148,6 +1220,40 @@ auto daq::PMTDecoder::fetchNeededBoardInfo
 } // daq::PMTDecoder::fetchNeededBoardInfo()
 
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+void daq::PMTDecoder::setupBoardRecords() {
+
+    assert(fBoardInfoLookup);
+
+    fBoardRecords.clear();
+    for (details::BoardInfoLookup::BoardInfo_t const& boardInfo
+      : fBoardInfoLookup->allBoardInfo())
+    {
+        if (boardInfo.fragmentID == details::BoardSetup_t::NoFragmentID)
+            continue;
+        unsigned int const effFragmentID = boardInfo.fragmentID & 0x0fff;
+        if (!fChannelMap.hasPMTDigitizerID(effFragmentID)) continue;
+
+        if (effFragmentID >= fBoardRecords.size())
+            fBoardRecords.resize(effFragmentID + 1U);
+        BoardDecodeRecord_t& record = fBoardRecords[effFragmentID];
+        record.info.emplace
+          (fetchNeededBoardInfo(&boardInfo, boardInfo.fragmentID));
+
+        icarusDB::DigitizerChannelChannelIDPairVec const& digitizerChannelVec
+          = fChannelMap.getChannelIDPairVec(effFragmentID);
+        record.nChannels = std::min
+          (digitizerChannelVec.size(), BoardDecodeRecord_t::NChannelsPerBoard);
+        std::copy_n
+          (digitizerChannelVec.begin(), record.nChannels, record.channels.begin());
+    } // for boards
+
+    mf::LogDebug(fLogCategory)
+      << "Cached decoding records for " << fBoardRecords.size() << " boards.";
+
+} // daq::PMTDecoder::setupBoardRecords()
+
+
 //------------------------------------------------------------------------------------------------------------------------------------------
 /*template <std::size_t NBits, typename T>
 constexpr std::pair<std::array<std::size_t, NBits>, std::size_t>
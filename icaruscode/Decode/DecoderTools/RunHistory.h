@@ -0,0 +1,49 @@
+/**
+ * @file   icaruscode/Decode/DecoderTools/RunHistory.h
+ * @brief  Wrapper service for `icarusDB::RunHistoryProvider`.
+ * @author Gianluca Petrillo (petrillo@slac.stanford.edu)
+ * @see    icaruscode/Decode/DecoderTools/RunHistory_service.cc
+ */
+
+#ifndef ICARUSCODE_DECODE_DECODERTOOLS_RUNHISTORY_H
+#define ICARUSCODE_DECODE_DECODERTOOLS_RUNHISTORY_H
+
+
+// ICARUS libraries
+#include "icaruscode/Decode/DecoderTools/RunHistoryProvider.h"
+
+// framework libraries
+#include "art/Framework/Services/Registry/ServiceDeclarationMacros.h"
+
+
+// -----------------------------------------------------------------------------
+// forward declarations
+namespace art { class ActivityRegistry; class Run; }
+
+// -----------------------------------------------------------------------------
+namespace icarusDB { class RunHistory; }
+/**
+ * @brief Service interface to `icarusDB::RunHistoryProvider`.
+ *
+ * On each run transition the service checks that the snapshot covers the
+ * incoming run and reloads it synchronously if it does not (the reload is a
+ * local file read, well out of the event loop); if the run is still missing
+ * afterwards a warning is emitted and the lookups for that run will return
+ * no value, leaving the fallback to the caller.
+ */
+class icarusDB::RunHistory: public RunHistoryProvider {
+
+    public:
+
+  RunHistory(fhicl::ParameterSet const& pset, art::ActivityRegistry& reg);
+
+  /// Makes sure the snapshot covers the incoming run.
+  void preBeginRun(art::Run const& run);
+
+}; // class icarusDB::RunHistory
+
+
+DECLARE_ART_SERVICE(icarusDB::RunHistory, SHARED)
+
+
+#endif // ICARUSCODE_DECODE_DECODERTOOLS_RUNHISTORY_H
@@ -0,0 +1,183 @@
+/**
+ * @file   icaruscode/Decode/DecoderTools/RunHistoryProvider.cxx
+ * @brief  Provider of run history information (implementation file).
+ * @author Gianluca Petrillo (petrillo@slac.stanford.edu)
+ * @see    icaruscode/Decode/DecoderTools/RunHistoryProvider.h
+ */
+
+// library header
+#include "icaruscode/Decode/DecoderTools/RunHistoryProvider.h"
+
+// framework libraries
+#include "messagefacility/MessageLogger/MessageLogger.h"
+#include "cetlib_except/exception.h"
+
+// C/C++ standard libraries
+#include <chrono>
+#include <fstream>
+#include <sstream>
+#include <utility> // std::move()
+
+// POSIX libraries (for the snapshot modification time)
+#include <sys/stat.h>
+
+
+// -----------------------------------------------------------------------------
+namespace {
+
+  /// Returns the modification time of `path` in seconds, `-1` if unavailable.
+  std::int64_t fileModificationTime(std::string const& path) {
+    struct stat fileInfo;
+    if (::stat(path.c_str(), &fileInfo) != 0) return -1;
+    return static_cast<std::int64_t>(fileInfo.st_mtime);
+  } // fileModificationTime()
+
+} // local namespace
+
+
+// -----------------------------------------------------------------------------
+icarusDB::RunHistoryProvider::RunHistoryProvider
+  (fhicl::ParameterSet const& pset)
+  : fSnapshotFile(pset.get<std::string>("SnapshotFile"))
+  , fRefreshPeriod(pset.get<double>("RefreshPeriod", 0.0))
+  , fLogCategory(pset.get<std::string>("LogCategory", "RunHistory"))
+{
+
+  // first load is synchronous: a missing or unreadable snapshot is a
+  // configuration error and the job should not start without one
+  fLastSnapshotTime = fileModificationTime(fSnapshotFile);
+  std::atomic_store(&fRunMap, parseSnapshot(fSnapshotFile, fLogCategory));
+
+  if (fRefreshPeriod > 0.0)
+    fRefreshThread = std::thread{ &RunHistoryProvider::refreshLoop, this };
+
+} // icarusDB::RunHistoryProvider::RunHistoryProvider()
+
+
+// -----------------------------------------------------------------------------
+icarusDB::RunHistoryProvider::~RunHistoryProvider() {
+
+  if (fRefreshThread.joinable()) {
+    {
+      std::lock_guard lock { fRefreshMutex };
+      fStopRefresh = true;
+    }
+    fRefreshCV.notify_all();
+    fRefreshThread.join();
+  }
+
+} // icarusDB::RunHistoryProvider::~RunHistoryProvider()
+
+
+// -----------------------------------------------------------------------------
+auto icarusDB::RunHistoryProvider::runRecord(unsigned int run) const
+  -> std::optional<RunRecord>
+{
+  std::shared_ptr<RunMap_t const> const runMap = std::atomic_load(&fRunMap);
+  auto const it = runMap->find(run);
+  if (it == runMap->end()) return std::nullopt;
+  return it->second;
+} // icarusDB::RunHistoryProvider::runRecord()
+
+
+// -----------------------------------------------------------------------------
+bool icarusDB::RunHistoryProvider::hasRun(unsigned int run) const {
+  std::shared_ptr<RunMap_t const> const runMap = std::atomic_load(&fRunMap);
+  return runMap->count(run) > 0U;
+} // icarusDB::RunHistoryProvider::hasRun()
+
+
+// -----------------------------------------------------------------------------
+void icarusDB::RunHistoryProvider::refreshNow() {
+
+  fLastSnapshotTime = fileModificationTime(fSnapshotFile);
+  std::atomic_store(&fRunMap, parseSnapshot(fSnapshotFile, fLogCategory));
+
+} // icarusDB::RunHistoryProvider::refreshNow()
+
+
+// -----------------------------------------------------------------------------
+void icarusDB::RunHistoryProvider::refreshLoop() {
+
+  auto const period = std::chrono::duration<double>{ fRefreshPeriod };
+
+  std::unique_lock lock { fRefreshMutex };
+  while (!fStopRefresh) {
+    if (fRefreshCV.wait_for(lock, period, [this](){ return fStopRefresh; }))
+      break;
+    // the snapshot parse happens without holding the lock: a shutdown request
+    // during the parse is honoured on the next loop
+    lock.unlock();
+    try {
+      loadIfChanged();
+    }
+    catch (cet::exception const& e) {
+      // the snapshot may be being rewritten right now: keep the current
+      // table and try again on the next period
+      mf::LogWarning(fLogCategory)
+        << "Background refresh of '" << fSnapshotFile
+        << "' failed (will retry): " << e.what();
+    }
+    lock.lock();
+  } // while
+
+} // icarusDB::RunHistoryProvider::refreshLoop()
+
+
+// -----------------------------------------------------------------------------
+bool icarusDB::RunHistoryProvider::loadIfChanged() {
+
+  std::int64_t const snapshotTime = fileModificationTime(fSnapshotFile);
+  if (snapshotTime < 0 || snapshotTime == fLastSnapshotTime) return false;
+
+  fLastSnapshotTime = snapshotTime;
+  std::atomic_store(&fRunMap, parseSnapshot(fSnapshotFile, fLogCategory));
+  return true;
+
+} // icarusDB::RunHistoryProvider::loadIfChanged()
+
+
+// -----------------------------------------------------------------------------
+auto icarusDB::RunHistoryProvider::parseSnapshot
+  (std::string const& path, std::string const& logCategory)
+  -> std::shared_ptr<RunMap_t const>
+{
+
+  std::ifstream in { path };
+  if (!in) {
+    throw cet::exception("RunHistoryProvider")
+      << "Can't open the run history snapshot file '" << path << "'.\n";
+  }
+
+  auto runMap = std::make_shared<RunMap_t>();
+
+  std::string line;
+  unsigned int lineNo = 0U;
+  while (std::getline(in, line)) {
+    ++lineNo;
+    if (line.empty() || (line.front() == '#')) continue;
+
+    RunRecord record;
+    std::istringstream parser { line };
+    if (!(
+      parser >> record.run >> record.startTime >> record.stopTime
+        >> record.bnbGateWidth >> record.numiGateWidth
+        >> record.configurationName
+    )) {
+      throw cet::exception("RunHistoryProvider")
+        << "Format error on line " << lineNo
+        << " of the run history snapshot file '" << path << "':\n==>|"
+        << line << "|<==\n";
+    }
+
+    (*runMap)[record.run] = std::move(record);
+  } // while lines
+
+  mf::LogDebug(logCategory)
+    << "Loaded " << runMap->size() << " run records from '" << path << "'.";
+
+  return runMap;
+} // icarusDB::RunHistoryProvider::parseSnapshot()
+
+
+// -----------------------------------------------------------------------------
@@ -0,0 +1,161 @@
+/**
+ * @file   icaruscode/Decode/DecoderTools/RunHistoryProvider.h
+ * @brief  Provider of run history information from a local snapshot file.
+ * @author Gianluca Petrillo (petrillo@slac.stanford.edu)
+ * @see    icaruscode/Decode/DecoderTools/RunHistoryProvider.cxx
+ */
+
+#ifndef ICARUSCODE_DECODE_DECODERTOOLS_RUNHISTORYPROVIDER_H
+#define ICARUSCODE_DECODE_DECODERTOOLS_RUNHISTORYPROVIDER_H
+
+
+// framework libraries
+#include "fhiclcpp/ParameterSet.h"
+
+// C/C++ standard libraries
+#include <condition_variable>
+#include <map>
+#include <memory> // std::shared_ptr
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <cstdint>
+
+
+// -----------------------------------------------------------------------------
+namespace icarusDB {
+  struct RunRecord;
+  class RunHistoryProvider;
+} // namespace icarusDB
+
+/// Run history information for a single run.
+struct icarusDB::RunRecord {
+
+  unsigned int run = 0; ///< Run number.
+
+  std::uint64_t startTime = 0U; ///< Run start (seconds from UTC epoch).
+
+  std::uint64_t stopTime = 0U; ///< Run stop (seconds; `0`: still running).
+
+  std::string configurationName; ///< Name of the DAQ configuration.
+
+  double bnbGateWidth = 0.0; ///< BNB beam gate width [ns] (`0`: unknown).
+
+  double numiGateWidth = 0.0; ///< NuMI beam gate width [ns] (`0`: unknown).
+
+}; // struct icarusDB::RunRecord
+
+
+/**
+ * @brief Run history information served from a local snapshot, with
+ *        asynchronous refresh.
+ *
+ * The run configuration database lives on a remote postgres server, and a
+ * synchronous query from within the event loop exposes the decoding to the
+ * network tail latency (an issue actually observed in keep-up processing).
+ * This provider never talks to the network: it reads a local snapshot of the
+ * run history (a plain text file, typically kept up to date by a cron job
+ * querying the database) into memory, and serves lookups from that.
+ *
+ * The lookup (`runRecord()`) is wait-free: the run table is an immutable map
+ * swapped atomically when a new snapshot content is loaded. The snapshot is
+ * loaded at construction and can be reloaded:
+ *
+ * * synchronously via `refreshNow()` (intended for run boundaries, e.g. when
+ *   a record for the incoming run is missing);
+ * * asynchronously by a background thread which checks the file modification
+ *   time every `RefreshPeriod` seconds and reloads the file when it changed,
+ *   so that a long keep-up job picks up newly appended runs without ever
+ *   blocking the event loop.
+ *
+ * Snapshot file format: one run per line, blank lines and lines starting
+ * with `#` ignored, whitespace separated columns:
+ *
+ *     run  start_s  stop_s  bnb_gate_ns  numi_gate_ns  configuration
+ *
+ * Configuration parameters:
+ *
+ * * `SnapshotFile` (string, mandatory): path of the run history snapshot
+ * * `RefreshPeriod` (real, default: `0`): seconds between checks of the
+ *   snapshot file by the background refresh thread; `0` disables the thread
+ * * `LogCategory` (string, default: `RunHistory`): message facility category
+ */
+class icarusDB::RunHistoryProvider {
+
+    public:
+
+  explicit RunHistoryProvider(fhicl::ParameterSet const& pset);
+
+  ~RunHistoryProvider();
+
+  // not copiable nor movable (owns a thread)
+  RunHistoryProvider(RunHistoryProvider const&) = delete;
+  RunHistoryProvider& operator= (RunHistoryProvider const&) = delete;
+
+  /// Returns the record for `run`, or no value if the run is not in the
+  /// snapshot. Never blocks.
+  std::optional<RunRecord> runRecord(unsigned int run) const;
+
+  /// Returns whether the snapshot has a record for `run`. Never blocks.
+  bool hasRun(unsigned int run) const;
+
+  /// Reloads the snapshot file synchronously (e.g. at a run boundary when
+  /// the incoming run is not covered yet).
+  void refreshNow();
+
+
+    private:
+
+  /// Type of the (immutable) run table.
+  using RunMap_t = std::map<unsigned int, RunRecord>;
+
+
+  // --- BEGIN Configuration variables -----------------------------------------
+
+  std::string const fSnapshotFile; ///< Path of the run history snapshot.
+
+  double const fRefreshPeriod; ///< Refresh check period [s] (`0`: disabled).
+
+  std::string const fLogCategory; ///< Message facility category.
+
+  // --- END Configuration variables -------------------------------------------
+
+
+  /// The current run table; read with `std::atomic_load()`, replaced with
+  /// `std::atomic_store()` (the pointed map is never modified after the swap).
+  std::shared_ptr<RunMap_t const> fRunMap;
+
+  // --- BEGIN Background refresh machinery ------------------------------------
+
+  std::thread fRefreshThread; ///< The background refresh thread.
+
+  std::mutex fRefreshMutex; ///< Protects `fStopRefresh`.
+
+  std::condition_variable fRefreshCV; ///< Wakes the refresh thread up.
+
+  bool fStopRefresh = false; ///< Tells the refresh thread to terminate.
+
+  std::int64_t fLastSnapshotTime = -1; ///< Modification time last loaded.
+
+  // --- END Background refresh machinery --------------------------------------
+
+
+  /// Body of the background refresh thread.
+  void refreshLoop();
+
+  /// Loads the snapshot file if its modification time changed;
+  /// returns whether a new table was installed.
+  bool loadIfChanged();
+
+  /// Parses the snapshot file into a new run table.
+  /// @throw cet::exception if the file can't be read
+  static std::shared_ptr<RunMap_t const> parseSnapshot
+    (std::string const& path, std::string const& logCategory);
+
+}; // class icarusDB::RunHistoryProvider
+
+
+// -----------------------------------------------------------------------------
+
+#endif // ICARUSCODE_DECODE_DECODERTOOLS_RUNHISTORYPROVIDER_H
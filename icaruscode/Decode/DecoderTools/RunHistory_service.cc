@@ -0,0 +1,46 @@
+/**
+ * @file   icaruscode/Decode/DecoderTools/RunHistory_service.cc
+ * @brief  Wrapper service for `icarusDB::RunHistoryProvider` (implementation).
+ * @author Gianluca Petrillo (petrillo@slac.stanford.edu)
+ * @see    icaruscode/Decode/DecoderTools/RunHistory.h
+ */
+
+// library header
+#include "icaruscode/Decode/DecoderTools/RunHistory.h"
+
+// framework libraries
+#include "art/Framework/Services/Registry/ActivityRegistry.h"
+#include "art/Framework/Services/Registry/ServiceDefinitionMacros.h"
+#include "art/Framework/Principal/Run.h"
+#include "messagefacility/MessageLogger/MessageLogger.h"
+#include "fhiclcpp/ParameterSet.h"
+
+
+// -----------------------------------------------------------------------------
+icarusDB::RunHistory::RunHistory
+  (fhicl::ParameterSet const& pset, art::ActivityRegistry& reg)
+  : RunHistoryProvider(pset)
+  { reg.sPreBeginRun.watch(this, &RunHistory::preBeginRun); }
+
+
+// -----------------------------------------------------------------------------
+void icarusDB::RunHistory::preBeginRun(art::Run const& run) {
+
+  if (hasRun(run.run())) return;
+
+  refreshNow();
+
+  if (!hasRun(run.run())) {
+    mf::LogWarning("RunHistory")
+      << "The run history snapshot has no record for run " << run.run()
+      << " (the snapshot may be out of date).";
+  }
+
+} // icarusDB::RunHistory::preBeginRun()
+
+
+// -----------------------------------------------------------------------------
+DEFINE_ART_SERVICE(icarusDB::RunHistory)
+
+
+// -----------------------------------------------------------------------------
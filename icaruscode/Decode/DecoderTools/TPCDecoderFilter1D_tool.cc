@@ -74,67 +74,69 @@ public:
     /**
      *  @brief Recover the channels for the processed fragment
      */
-    const icarus_signal_processing::VectorInt  getChannelIDs()       const override {return fChannelIDVec;}
+    const icarus_signal_processing::VectorInt&  getChannelIDs()       const override {return fChannelIDVec;}
 
     /**
      *  @brief Recover the selection values
      */
-    const icarus_signal_processing::ArrayBool  getSelectionVals()    const override {return fSelectVals;};
+    const icarus_signal_processing::ArrayBool&  getSelectionVals()    const override {return fSelectVals;};
 
     /**
      *  @brief Recover the ROI values
      */
-    const icarus_signal_processing::ArrayBool  getROIVals()          const override {return fROIVals;};
+    const icarus_signal_processing::ArrayBool&  getROIVals()          const override {return fROIVals;};
 
     /**
      *  @brief Recover the pedestal subtracted waveforms
+     *         Note: empty when running with ZeroCopyDecode since the raw ADC
+     *         array is never materialized in that mode
      */
-    const icarus_signal_processing::ArrayFloat getRawWaveforms()     const override {return fRawWaveforms;};
+    const icarus_signal_processing::ArrayFloat& getRawWaveforms()     const override {return fRawWaveforms;};
 
     /**
      *  @brief Recover the pedestal subtracted waveforms
      */
-    const icarus_signal_processing::ArrayFloat getPedCorWaveforms()  const override {return fPedCorWaveforms;};
+    const icarus_signal_processing::ArrayFloat& getPedCorWaveforms()  const override {return fPedCorWaveforms;};
 
     /**
      *  @brief Recover the "intrinsic" RMS
      */
-    const icarus_signal_processing::ArrayFloat getIntrinsicRMS()     const override {return fIntrinsicRMS;};
+    const icarus_signal_processing::ArrayFloat& getIntrinsicRMS()     const override {return fIntrinsicRMS;};
 
     /**
      *  @brief Recover the correction median values
      */
-    const icarus_signal_processing::ArrayFloat getCorrectedMedians()  const override {return fCorrectedMedians;};
+    const icarus_signal_processing::ArrayFloat& getCorrectedMedians()  const override {return fCorrectedMedians;};
 
     /**
      *  @brief Recover the waveforms less coherent noise
      */
-    const icarus_signal_processing::ArrayFloat getWaveLessCoherent()  const override {return fWaveLessCoherent;};
+    const icarus_signal_processing::ArrayFloat& getWaveLessCoherent()  const override {return fWaveLessCoherent;};
 
     /**
      *  @brief Recover the morphological filter waveforms
      */
-    const icarus_signal_processing::ArrayFloat getMorphedWaveforms()  const override {return fMorphedWaveforms;};
+    const icarus_signal_processing::ArrayFloat& getMorphedWaveforms()  const override {return fMorphedWaveforms;};
 
     /**
      *  @brief Recover the pedestals for each channel
      */
-    const icarus_signal_processing::VectorFloat getPedestalVals()     const override {return fPedestalVals;};
+    const icarus_signal_processing::VectorFloat& getPedestalVals()     const override {return fPedestalVals;};
 
     /**
      *  @brief Recover the full RMS before coherent noise
      */
-    const icarus_signal_processing::VectorFloat getFullRMSVals()      const override {return fFullRMSVals;};
+    const icarus_signal_processing::VectorFloat& getFullRMSVals()      const override {return fFullRMSVals;};
 
     /**
      *  @brief Recover the truncated RMS noise
      */
-    const icarus_signal_processing::VectorFloat getTruncRMSVals()     const override {return fTruncRMSVals;};
+    const icarus_signal_processing::VectorFloat& getTruncRMSVals()     const override {return fTruncRMSVals;};
 
     /**
      *  @brief Recover the number of bins after truncation
      */
-    const icarus_signal_processing::VectorInt   getNumTruncBins()     const override {return fNumTruncBins;};
+    const icarus_signal_processing::VectorInt&   getNumTruncBins()     const override {return fNumTruncBins;};
 
 private:
 
@@ -148,6 +150,7 @@ private:
     size_t                                         fMorphWindow;            //< Window for filter
     std::vector<float>                             fThreshold;              //< Threshold to apply for saving signal
     bool                                           fUseFFTFilter;           //< Turn on/off the use of the FFT filter
+    bool                                           fZeroCopyDecode;         //< Decode from a view over the fragment payload, materialize only corrected ADCs
     bool                                           fDiagnosticOutput;       //< If true will spew endless messages to output
     FloatPairVec                                   fFFTSigmaValsVec;        //< Gives the sigmas for the filter function
     FloatPairVec                                   fFFTCutoffValsVec;       //< Gives the cutoffs for the filter function
@@ -179,6 +182,10 @@ private:
 
     icarus_signal_processing::VectorFloat          fThresholdVec;
 
+    // Scratch tile for ZeroCopyDecode mode: one channel's worth of samples
+    // streamed out of the fragment payload and immediately consumed
+    icarus_signal_processing::VectorFloat          fDecodeScratch;
+
     icarus_signal_processing::FilterFunctionVec    fFilterFunctionVec;
     
     const geo::Geometry*                           fGeometry;              //< pointer to the Geometry service
@@ -228,6 +235,7 @@ void TPCDecoderFilter1D::configure(fhicl::ParameterSet const &pset)
     fMorphWindow           = pset.get<size_t                  >("FilterWindow",         10);
     fThreshold             = pset.get<std::vector<float>      >("Threshold",           std::vector<float>()={5.0,3.5,3.5});
     fUseFFTFilter          = pset.get<bool                    >("UseFFTFilter",        true);
+    fZeroCopyDecode        = pset.get<bool                    >("ZeroCopyDecode",      false);
     fDiagnosticOutput      = pset.get<bool                    >("DiagnosticOutput",    false);
     fFilterModeVec         = pset.get<std::vector<std::string>>("FilterModeVec",       std::vector<std::string>()={"e","g","d"});
 
@@ -340,7 +348,12 @@ void TPCDecoderFilter1D::process_fragment(detinfo::DetectorClocksData const&,
 
     if (fSelectVals.empty())        fSelectVals       = icarus_signal_processing::ArrayBool(maxChannelsPerFragment,  icarus_signal_processing::VectorBool(nSamplesPerChannel));
     if (fROIVals.empty())           fROIVals          = icarus_signal_processing::ArrayBool(maxChannelsPerFragment,  icarus_signal_processing::VectorBool(nSamplesPerChannel));
-    if (fRawWaveforms.empty())      fRawWaveforms     = icarus_signal_processing::ArrayFloat(maxChannelsPerFragment, icarus_signal_processing::VectorFloat(nSamplesPerChannel));
+    // In zero-copy mode the raw ADC array (~9 MB per tool instance) is never
+    // allocated: the payload is staged one channel tile at a time instead
+    if (!fZeroCopyDecode && fRawWaveforms.empty())
+                                    fRawWaveforms     = icarus_signal_processing::ArrayFloat(maxChannelsPerFragment, icarus_signal_processing::VectorFloat(nSamplesPerChannel));
+    if (fZeroCopyDecode && fDecodeScratch.size() != nSamplesPerChannel)
+                                    fDecodeScratch    = icarus_signal_processing::VectorFloat(nSamplesPerChannel);
     if (fPedCorWaveforms.empty())   fPedCorWaveforms  = icarus_signal_processing::ArrayFloat(maxChannelsPerFragment, icarus_signal_processing::VectorFloat(nSamplesPerChannel));
     if (fIntrinsicRMS.empty())      fIntrinsicRMS     = icarus_signal_processing::ArrayFloat(maxChannelsPerFragment, icarus_signal_processing::VectorFloat(nSamplesPerChannel));
     if (fCorrectedMedians.empty())  fCorrectedMedians = icarus_signal_processing::ArrayFloat(maxChannelsPerFragment, icarus_signal_processing::VectorFloat(nSamplesPerChannel));
@@ -400,7 +413,10 @@ void TPCDecoderFilter1D::process_fragment(detinfo::DetectorClocksData const&,
             // Get the channel number on the Fragment
             size_t channelOnBoard = boardOffset + chanIdx;
 
-            icarus_signal_processing::VectorFloat& rawDataVec = fRawWaveforms[channelOnBoard];
+            // The fragment payload itself is the source of truth here: in zero-copy
+            // mode the samples are streamed through a single reused scratch tile so
+            // only the pedestal corrected waveform is ever materialized
+            icarus_signal_processing::VectorFloat& rawDataVec = fZeroCopyDecode ? fDecodeScratch : fRawWaveforms[channelOnBoard];
 
             for(size_t tick = 0; tick < nSamplesPerChannel; tick++)
                 rawDataVec[tick] = -dataBlock[chanIdx + tick * nChannelsPerBoard];
@@ -23,6 +23,8 @@
 #include "sbndaq-artdaq-core/Overlays/ICARUS/PhysCrateFragment.hh"
 
 #include "icaruscode/Decode/DecoderTools/IDecoder.h"
+#include "icaruscode/Decode/DecoderTools/details/ADCBlockTranspose.h"
+#include "icaruscode/Utilities/ProductSizeAdvisor.h"
 
 // std includes
 #include <string>
@@ -126,6 +128,9 @@ void TPCDecoder::initializeDataProducts()
 {
     fRawDigitCollection = RawDigitCollectionPtr(new std::vector<raw::RawDigit>);
 
+    // Events tend to be alike: reserve based on the sizes of the previous ones
+    fRawDigitCollection->reserve(art::ServiceHandle<icarus::ns::util::ProductSizeAdvisor>()->recommendedCapacity("TPCDecoder/RawDigit"));
+
     return;
 }
 
@@ -151,18 +156,19 @@ void TPCDecoder::process_fragment(const artdaq::Fragment &fragment)
         const icarus::A2795DataBlock::data_t* dataBlock = physCrateFragment.BoardData(board);
 
         //A2795DataBlock const& block_data = *(crate_data.BoardDataBlock(i_b));
+        // It seems that the data is read from each channel for each tick, so the whole
+        // board block is transposed to channel order in one cache-blocked pass rather
+        // than gathering one strided channel at a time
+        std::vector<raw::RawDigit::ADCvector_t> wvfms(nChannelsPerBoard, raw::RawDigit::ADCvector_t(physCrateFragment.nSamplesPerChannel()));
+
+        daq::details::transposeADCBlockRaw(dataBlock, nChannelsPerBoard, physCrateFragment.nSamplesPerChannel(), wvfms);
+
         for(size_t channel = 0; channel < physCrateFragment.nChannelsPerBoard(); channel++)
         {
             //raw::ChannelID_t channel_num = (i_ch & 0xff ) + (i_b << 8);
-            raw::ChannelID_t           channel_num = boardId + channel;
-            raw::RawDigit::ADCvector_t wvfm(physCrateFragment.nSamplesPerChannel());
-
-            // It seems that the data is read from each channel for each tick so the 
-            // loop indices below are chosen to pick out the "right" ticks for a given channel
-            for(size_t tick = 0; tick < physCrateFragment.nSamplesPerChannel(); tick++)
-                wvfm[tick] = dataBlock[channel + tick * physCrateFragment.nChannelsPerBoard()];
-        
-            fRawDigitCollection->emplace_back(channel_num,physCrateFragment.nSamplesPerChannel(),wvfm);
+            raw::ChannelID_t channel_num = boardId + channel;
+
+            fRawDigitCollection->emplace_back(channel_num,physCrateFragment.nSamplesPerChannel(),std::move(wvfms[channel]));
         }//loop over channels
     }//loop over boards
 
@@ -174,6 +180,9 @@ void TPCDecoder::outputDataProducts(art::Event& event)
     // Want the RawDigits to be sorted in channel order... has to be done somewhere so why not now?
     std::sort(fRawDigitCollection->begin(),fRawDigitCollection->end(),[](const auto& left,const auto&right){return left.Channel() < right.Channel();});
 
+    // Let the advisor know how big this event came out so the next reservation can match
+    art::ServiceHandle<icarus::ns::util::ProductSizeAdvisor>()->reportSize("TPCDecoder/RawDigit", fRawDigitCollection->size());
+
     // Now transfer ownership to the event store
     event.put(std::move(fRawDigitCollection));
 
@@ -0,0 +1,277 @@
+/**
+ *  @file   TPCDenoiserGPU.cu
+ *
+ *  @brief  CUDA implementation of the coherent group denoising and threshold
+ *          ROI selection, see TPCDenoiserGPU.h. Compiled only when the build
+ *          enables ICARUS_GPU_DENOISER.
+ */
+
+#include "icaruscode/Decode/DecoderTools/TPCDenoiserGPU.h"
+
+#include "cetlib_except/exception.h"
+
+#include <cuda_runtime.h>
+
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+namespace daq {
+
+namespace {
+
+// Maximum channels per coherent noise group the kernel can hold locally
+constexpr unsigned int MAX_GROUPING = 64;
+
+void checkCuda(cudaError_t status, const char* what)
+{
+    if (status != cudaSuccess)
+        throw cet::exception("TPCDenoiserGPU") << what << " failed: " << cudaGetErrorString(status);
+}
+
+// One thread per tick of one coherent noise group: recover the group median,
+// a truncated RMS from the central half of the group, then subtract the
+// median from every channel and flag the ticks above threshold
+__global__ void coherentDenoiseKernel(const float*   input,
+                                      float*         output,
+                                      unsigned char* roi,
+                                      unsigned int   grouping,
+                                      unsigned int   numTicks,
+                                      float          thresholdFactor)
+{
+    unsigned int tick = blockIdx.x * blockDim.x + threadIdx.x;
+
+    if (tick >= numTicks) return;
+
+    float vals[MAX_GROUPING];
+
+    for(unsigned int chan = 0; chan < grouping; chan++) vals[chan] = input[chan * numTicks + tick];
+
+    // insertion sort - the group is small and resident in local memory
+    for(unsigned int idx = 1; idx < grouping; idx++)
+    {
+        float        val = vals[idx];
+        unsigned int jdx = idx;
+
+        while(jdx > 0 && vals[jdx - 1] > val)
+        {
+            vals[jdx] = vals[jdx - 1];
+            jdx--;
+        }
+
+        vals[jdx] = val;
+    }
+
+    float median = 0.5f * (vals[(grouping - 1) / 2] + vals[grouping / 2]);
+
+    // truncated RMS about the median from the central half of the group
+    unsigned int lowBin  = grouping / 4;
+    unsigned int hiBin   = grouping - lowBin;
+    float        sumSq   = 0.f;
+
+    for(unsigned int idx = lowBin; idx < hiBin; idx++)
+    {
+        float diff = vals[idx] - median;
+        sumSq += diff * diff;
+    }
+
+    float rms = sqrtf(sumSq / float(hiBin - lowBin));
+
+    float threshold = thresholdFactor * rms;
+
+    for(unsigned int chan = 0; chan < grouping; chan++)
+    {
+        float corrected = input[chan * numTicks + tick] - median;
+
+        output[chan * numTicks + tick] = corrected;
+        roi[chan * numTicks + tick]    = fabsf(corrected) > threshold ? 1 : 0;
+    }
+}
+
+} // local namespace
+
+struct TPCDenoiserGPU::Implementation
+{
+    unsigned int   fGrouping;
+    float          fThresholdFactor;
+
+    // double buffered: stream/buffer pair g%2 handles group g so the upload
+    // of one group overlaps the kernel and download of the previous one
+    cudaStream_t   fStreams[2]       = {};
+    float*         fHostStaging[2]   = {};
+    float*         fDeviceInput[2]   = {};
+    float*         fDeviceOutput[2]  = {};
+    unsigned char* fDeviceROI[2]     = {};
+    float*         fHostOutput[2]    = {};
+    unsigned char* fHostROI[2]       = {};
+    size_t         fGroupTicks       = 0;
+
+    Implementation(unsigned int grouping, float thresholdFactor) :
+        fGrouping(grouping), fThresholdFactor(thresholdFactor)
+    {
+        if (grouping < 2 || grouping > MAX_GROUPING)
+            throw cet::exception("TPCDenoiserGPU") << "coherent noise grouping " << grouping
+                                                   << " outside the supported range [2," << MAX_GROUPING << "]";
+
+        for(int idx = 0; idx < 2; idx++) checkCuda(cudaStreamCreate(&fStreams[idx]), "cudaStreamCreate");
+    }
+
+    ~Implementation()
+    {
+        freeBuffers();
+
+        for(int idx = 0; idx < 2; idx++) cudaStreamDestroy(fStreams[idx]);
+    }
+
+    void freeBuffers()
+    {
+        for(int idx = 0; idx < 2; idx++)
+        {
+            if (fHostStaging[idx])  cudaFreeHost(fHostStaging[idx]);
+            if (fHostOutput[idx])   cudaFreeHost(fHostOutput[idx]);
+            if (fHostROI[idx])      cudaFreeHost(fHostROI[idx]);
+            if (fDeviceInput[idx])  cudaFree(fDeviceInput[idx]);
+            if (fDeviceOutput[idx]) cudaFree(fDeviceOutput[idx]);
+            if (fDeviceROI[idx])    cudaFree(fDeviceROI[idx]);
+
+            fHostStaging[idx]  = nullptr;
+            fHostOutput[idx]   = nullptr;
+            fHostROI[idx]      = nullptr;
+            fDeviceInput[idx]  = nullptr;
+            fDeviceOutput[idx] = nullptr;
+            fDeviceROI[idx]    = nullptr;
+        }
+
+        fGroupTicks = 0;
+    }
+
+    void ensureBuffers(size_t numTicks)
+    {
+        size_t groupTicks = size_t(fGrouping) * numTicks;
+
+        if (groupTicks <= fGroupTicks) return;
+
+        freeBuffers();
+
+        for(int idx = 0; idx < 2; idx++)
+        {
+            checkCuda(cudaMallocHost(&fHostStaging[idx],  groupTicks * sizeof(float)),         "cudaMallocHost");
+            checkCuda(cudaMallocHost(&fHostOutput[idx],   groupTicks * sizeof(float)),         "cudaMallocHost");
+            checkCuda(cudaMallocHost(&fHostROI[idx],      groupTicks * sizeof(unsigned char)), "cudaMallocHost");
+            checkCuda(cudaMalloc(    &fDeviceInput[idx],  groupTicks * sizeof(float)),         "cudaMalloc");
+            checkCuda(cudaMalloc(    &fDeviceOutput[idx], groupTicks * sizeof(float)),         "cudaMalloc");
+            checkCuda(cudaMalloc(    &fDeviceROI[idx],    groupTicks * sizeof(unsigned char)), "cudaMalloc");
+        }
+
+        fGroupTicks = groupTicks;
+    }
+
+    // unload the finished pipeline slot back into the caller's containers
+    void drainSlot(int slot, size_t firstChannel, size_t numTicks,
+                   icarus_signal_processing::ArrayFloat& outputArray,
+                   icarus_signal_processing::ArrayBool&  roiVals)
+    {
+        checkCuda(cudaStreamSynchronize(fStreams[slot]), "cudaStreamSynchronize");
+
+        for(unsigned int chan = 0; chan < fGrouping; chan++)
+        {
+            const float*         outRow = fHostOutput[slot] + size_t(chan) * numTicks;
+            const unsigned char* roiRow = fHostROI[slot]    + size_t(chan) * numTicks;
+
+            icarus_signal_processing::VectorFloat& outputVec = outputArray[firstChannel + chan];
+            icarus_signal_processing::VectorBool&  roiVec    = roiVals[firstChannel + chan];
+
+            std::memcpy(outputVec.data(), outRow, numTicks * sizeof(float));
+
+            for(size_t tick = 0; tick < numTicks; tick++) roiVec[tick] = roiRow[tick] != 0;
+        }
+    }
+};
+
+TPCDenoiserGPU::TPCDenoiserGPU(unsigned int coherentNoiseGrouping, float coherentThresholdFactor) :
+    fImplementation(std::make_unique<Implementation>(coherentNoiseGrouping, coherentThresholdFactor))
+{
+}
+
+TPCDenoiserGPU::~TPCDenoiserGPU()
+{
+}
+
+void TPCDenoiserGPU::denoise(const icarus_signal_processing::ArrayFloat& dataArray,
+                             icarus_signal_processing::ArrayFloat&       outputArray,
+                             icarus_signal_processing::ArrayBool&        roiVals)
+{
+    Implementation& impl = *fImplementation;
+
+    size_t numChannels = dataArray.size();
+    size_t numTicks    = dataArray[0].size();
+    size_t numGroups   = numChannels / impl.fGrouping;
+
+    if (outputArray.size() < numChannels) outputArray.resize(numChannels, icarus_signal_processing::VectorFloat(numTicks));
+    if (roiVals.size()     < numChannels) roiVals.resize(numChannels, icarus_signal_processing::VectorBool(numTicks));
+
+    impl.ensureBuffers(numTicks);
+
+    const unsigned int blockSize = 256;
+    const unsigned int numBlocks = (numTicks + blockSize - 1) / blockSize;
+
+    std::vector<bool> slotBusy(2, false);
+
+    for(size_t group = 0; group < numGroups; group++)
+    {
+        int    slot         = group % 2;
+        size_t firstChannel = group * impl.fGrouping;
+
+        // wait for the work two groups back before reusing its buffers
+        if (slotBusy[slot])
+        {
+            impl.drainSlot(slot, firstChannel - 2 * impl.fGrouping, numTicks, outputArray, roiVals);
+            slotBusy[slot] = false;
+        }
+
+        // stage this group into pinned memory and queue the pipeline: the
+        // copies and the kernel on this stream overlap the other stream's work
+        for(unsigned int chan = 0; chan < impl.fGrouping; chan++)
+            std::memcpy(impl.fHostStaging[slot] + size_t(chan) * numTicks,
+                        dataArray[firstChannel + chan].data(),
+                        numTicks * sizeof(float));
+
+        checkCuda(cudaMemcpyAsync(impl.fDeviceInput[slot], impl.fHostStaging[slot],
+                                  impl.fGroupTicks * sizeof(float),
+                                  cudaMemcpyHostToDevice, impl.fStreams[slot]),
+                  "cudaMemcpyAsync H2D");
+
+        coherentDenoiseKernel<<<numBlocks, blockSize, 0, impl.fStreams[slot]>>>(
+            impl.fDeviceInput[slot], impl.fDeviceOutput[slot], impl.fDeviceROI[slot],
+            impl.fGrouping, numTicks, impl.fThresholdFactor);
+
+        checkCuda(cudaGetLastError(), "coherentDenoiseKernel launch");
+
+        checkCuda(cudaMemcpyAsync(impl.fHostOutput[slot], impl.fDeviceOutput[slot],
+                                  impl.fGroupTicks * sizeof(float),
+                                  cudaMemcpyDeviceToHost, impl.fStreams[slot]),
+                  "cudaMemcpyAsync D2H");
+
+        checkCuda(cudaMemcpyAsync(impl.fHostROI[slot], impl.fDeviceROI[slot],
+                                  impl.fGroupTicks * sizeof(unsigned char),
+                                  cudaMemcpyDeviceToHost, impl.fStreams[slot]),
+                  "cudaMemcpyAsync D2H");
+
+        slotBusy[slot] = true;
+    }
+
+    // drain whatever is still in flight
+    for(size_t group = numGroups >= 2 ? numGroups - 2 : 0; group < numGroups; group++)
+    {
+        int slot = group % 2;
+
+        if (!slotBusy[slot]) continue;
+
+        impl.drainSlot(slot, group * impl.fGrouping, numTicks, outputArray, roiVals);
+        slotBusy[slot] = false;
+    }
+
+    return;
+}
+
+} // namespace daq
@@ -0,0 +1,58 @@
+/**
+ *  @file   TPCDenoiserGPU.h
+ *
+ *  @brief  CUDA offload backend for the dense 2D stage of the TPC noise
+ *          filtering tools: coherent group denoising plus threshold based
+ *          ROI selection over the channel x tick plane.
+ *
+ *          The implementation lives in TPCDenoiserGPU.cu and is compiled only
+ *          when the build enables ICARUS_GPU_DENOISER; this header keeps all
+ *          CUDA types behind an opaque implementation pointer so the tools
+ *          including it need no CUDA headers.
+ */
+#ifndef TPCDenoiserGPU_H
+#define TPCDenoiserGPU_H
+
+#include "icarus_signal_processing/ICARUSSigProcDefs.h"
+
+#include <memory>
+
+namespace daq {
+
+class TPCDenoiserGPU
+{
+public:
+    /**
+     *  @brief Constructor, sets up the device context
+     *
+     *  @param coherentNoiseGrouping  number of consecutive channels per coherent noise group (64 max)
+     *  @param coherentThresholdFactor  threshold, in units of the group RMS, for the ROI selection
+     */
+    TPCDenoiserGPU(unsigned int coherentNoiseGrouping, float coherentThresholdFactor);
+
+    ~TPCDenoiserGPU();
+
+    /**
+     *  @brief Run the denoising on the device
+     *
+     *  The input is processed one coherent noise group at a time with the
+     *  host to device transfer of the next group overlapping the kernel of
+     *  the current one (two CUDA streams, pinned staging buffers).
+     *
+     *  @param dataArray    pedestal corrected input waveforms (channel x tick)
+     *  @param outputArray  denoised waveforms, resized as needed
+     *  @param roiVals      per tick ROI selection, resized as needed
+     */
+    void denoise(const icarus_signal_processing::ArrayFloat& dataArray,
+                 icarus_signal_processing::ArrayFloat&       outputArray,
+                 icarus_signal_processing::ArrayBool&        roiVals);
+
+private:
+    struct Implementation;
+
+    std::unique_ptr<Implementation> fImplementation;
+};
+
+} // namespace daq
+
+#endif
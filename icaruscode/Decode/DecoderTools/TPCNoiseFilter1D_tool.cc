@@ -72,6 +72,16 @@ public:
                                   const icarus_signal_processing::ArrayFloat&,
                                   const size_t&) override;
 
+    /**
+     *  @brief Zero-copy version, pedestal corrects the input array in place
+     *         and writes the denoised waveforms to the caller's output array
+     */
+    virtual void process_fragment(detinfo::DetectorClocksData const&,
+                                  const daq::INoiseFilter::ChannelPlaneVec&,
+                                  icarus_signal_processing::ArrayFloat&,
+                                  icarus_signal_processing::ArrayFloat&,
+                                  const size_t&) override;
+
     /**
      *  @brief Recover the channels for the processed fragment
      */
@@ -171,9 +181,10 @@ private:
     icarus_signal_processing::VectorInt            fRangeBins;
 
     icarus_signal_processing::VectorFloat          fThresholdVec;
+    icarus_signal_processing::VectorFloat          fPedCorScratch;         //< Scratch row for the in place pedestal correction
 
     icarus_signal_processing::FilterFunctionVec    fFilterFunctionVec;
-    
+
     const geo::Geometry*                           fGeometry;              //< pointer to the Geometry service
 
     // Keep track of the FFT 
@@ -239,10 +250,31 @@ void TPCNoiseFilter1DMC::configure(fhicl::ParameterSet const &pset)
     return;
 }
 
-void TPCNoiseFilter1DMC::process_fragment(detinfo::DetectorClocksData const&,
+void TPCNoiseFilter1DMC::process_fragment(detinfo::DetectorClocksData const&          clockData,
                                           const daq::INoiseFilter::ChannelPlaneVec&   channelPlaneVec,
                                           const icarus_signal_processing::ArrayFloat& dataArray,
                                           const size_t&                               coherentNoiseGrouping)
+{
+    // Recover the number of channels and ticks
+    unsigned int numChannels = dataArray.size();
+    unsigned int numTicks    = dataArray[0].size();
+
+    // Legacy interface: stage a copy of the input into our own containers and
+    // run the zero-copy version on them so the accessors remain valid
+    if (fPedCorWaveforms.size()  < numChannels)  fPedCorWaveforms.resize(numChannels,  icarus_signal_processing::VectorFloat(numTicks));
+
+    for(size_t idx = 0; idx < numChannels; idx++) fPedCorWaveforms[idx] = dataArray[idx];
+
+    process_fragment(clockData, channelPlaneVec, fPedCorWaveforms, fWaveLessCoherent, coherentNoiseGrouping);
+
+    return;
+}
+
+void TPCNoiseFilter1DMC::process_fragment(detinfo::DetectorClocksData const&,
+                                          const daq::INoiseFilter::ChannelPlaneVec&   channelPlaneVec,
+                                          icarus_signal_processing::ArrayFloat&       dataArray,
+                                          icarus_signal_processing::ArrayFloat&       outputArray,
+                                          const size_t&                               coherentNoiseGrouping)
 {
     cet::cpu_timer theClockTotal;
 
@@ -254,13 +286,13 @@ void TPCNoiseFilter1DMC::process_fragment(detinfo::DetectorClocksData const&,
 
     if (fSelectVals.size()       < numChannels)  fSelectVals.resize(numChannels,       icarus_signal_processing::VectorBool(numTicks));
     if (fROIVals.size()          < numChannels)  fROIVals.resize(numChannels,          icarus_signal_processing::VectorBool(numTicks));
-    if (fRawWaveforms.size()     < numChannels)  fRawWaveforms.resize(numChannels,     icarus_signal_processing::VectorFloat(numTicks));
-    if (fPedCorWaveforms.size()  < numChannels)  fPedCorWaveforms.resize(numChannels,  icarus_signal_processing::VectorFloat(numTicks));
     if (fIntrinsicRMS.size()     < numChannels)  fIntrinsicRMS.resize(numChannels,     icarus_signal_processing::VectorFloat(numTicks));
     if (fCorrectedMedians.size() < numChannels)  fCorrectedMedians.resize(numChannels, icarus_signal_processing::VectorFloat(numTicks));
-    if (fWaveLessCoherent.size() < numChannels)  fWaveLessCoherent.resize(numChannels, icarus_signal_processing::VectorFloat(numTicks));
     if (fMorphedWaveforms.size() < numChannels)  fMorphedWaveforms.resize(numChannels, icarus_signal_processing::VectorFloat(numTicks));
 
+    // The caller owns the output array, just make sure it can hold the result
+    if (outputArray.size()       < numChannels)  outputArray.resize(numChannels,       icarus_signal_processing::VectorFloat(numTicks));
+
     if (fChannelIDVec.size()     < numChannels)  fChannelIDVec.resize(numChannels);
     if (fPedestalVals.size()     < numChannels)  fPedestalVals.resize(numChannels);
     if (fFullRMSVals.size()      < numChannels)  fFullRMSVals.resize(numChannels);
@@ -272,13 +304,15 @@ void TPCNoiseFilter1DMC::process_fragment(detinfo::DetectorClocksData const&,
 
     if (fFilterFunctionVec.size() < numChannels) fFilterFunctionVec.resize(numChannels);
 
+    if (fPedCorScratch.size()    < numTicks)     fPedCorScratch.resize(numTicks);
+
     icarus_signal_processing::Denoiser1D           denoiser;
     icarus_signal_processing::WaveformTools<float> waveformTools;
 
     // Make a pass throught to do pedestal corrections and get raw waveform information
     for(size_t idx = 0; idx < numChannels; idx++)
     {
-        icarus_signal_processing::VectorFloat& pedCorDataVec = fPedCorWaveforms[idx];
+        icarus_signal_processing::VectorFloat& pedCorDataVec = dataArray[idx];
 
         // Keep track of the channel
         fChannelIDVec[idx] = channelPlaneVec[idx].first;
@@ -315,9 +349,11 @@ void TPCNoiseFilter1DMC::process_fragment(detinfo::DetectorClocksData const&,
                 break;
         }
 
-        // Now determine the pedestal and correct for it
+        // Now determine the pedestal and correct for it. The correction is "in
+        // place": go through a scratch row and swap it with the input row (the
+        // rows are the same length so the swap just exchanges the buffers)
         waveformTools.getPedestalCorrectedWaveform(dataArray[idx],
-                                                   pedCorDataVec,
+                                                   fPedCorScratch,
                                                    fSigmaForTruncation,
                                                    fPedestalVals[idx],
                                                    fFullRMSVals[idx],
@@ -325,6 +361,8 @@ void TPCNoiseFilter1DMC::process_fragment(detinfo::DetectorClocksData const&,
                                                    fNumTruncBins[idx],
                                                    fRangeBins[idx]);
 
+        std::swap(pedCorDataVec, fPedCorScratch);
+
         // Convolve with a filter function
         if (fUseFFTFilter) (*fFFTFilterFunctionVec[plane])(pedCorDataVec);
 
@@ -332,8 +370,8 @@ void TPCNoiseFilter1DMC::process_fragment(detinfo::DetectorClocksData const&,
         std::fill(fSelectVals[idx].begin(),fSelectVals[idx].end(),false);
     }
 
-    denoiser(fWaveLessCoherent.begin(),
-             fPedCorWaveforms.begin(),
+    denoiser(outputArray.begin(),
+             dataArray.begin(),
              fMorphedWaveforms.begin(),
              fIntrinsicRMS.begin(),
              fSelectVals.begin(),
@@ -14,6 +14,7 @@
 #include "art/Utilities/ToolMacros.h"
 #include "art/Utilities/make_tool.h"
 #include "cetlib/cpu_timer.h"
+#include "cetlib_except/exception.h"
 #include "fhiclcpp/ParameterSet.h"
 #include "messagefacility/MessageLogger/MessageLogger.h"
 
@@ -24,6 +25,10 @@
 
 #include "icaruscode/Decode/DecoderTools/INoiseFilter.h"
 
+#ifdef ICARUS_GPU_DENOISER
+#include "icaruscode/Decode/DecoderTools/TPCDenoiserGPU.h"
+#endif
+
 #include "icarus_signal_processing/ICARUSSigProcDefs.h"
 #include "icarus_signal_processing/WaveformTools.h"
 #include "icarus_signal_processing/Filters/FFTFilterFunctions.h"
@@ -77,6 +82,16 @@ public:
                                   const icarus_signal_processing::ArrayFloat&,
                                   const size_t&) override;
 
+    /**
+     *  @brief Zero-copy version, pedestal corrects the input array in place
+     *         and writes the filtered waveforms to the caller's output array
+     */
+    virtual void process_fragment(detinfo::DetectorClocksData const&,
+                                  const daq::INoiseFilter::ChannelPlaneVec&,
+                                  icarus_signal_processing::ArrayFloat&,
+                                  icarus_signal_processing::ArrayFloat&,
+                                  const size_t&) override;
+
     /**
      *  @brief Recover the channels for the processed fragment
      */
@@ -148,6 +163,7 @@ private:
 
     float                                          fSigmaForTruncation;         //< Selection cut for truncated rms calculation
     bool                                           fUseFFTFilter;               //< Turn on/off the use of the FFT filter
+    bool                                           fUseGPU;                     //< Offload the 2D denoising to the GPU backend
     bool                                           fDiagnosticOutput;           //< If true will spew endless messages to output
     FloatPairVec                                   fFFTSigmaValsVec;            //< Gives the sigmas for the filter function
     FloatPairVec                                   fFFTCutoffValsVec;           //< Gives the cutoffs for the filter function
@@ -202,9 +218,10 @@ private:
     icarus_signal_processing::VectorInt            fRangeBins;
 
     icarus_signal_processing::VectorFloat          fThresholdVec;
+    icarus_signal_processing::VectorFloat          fPedCorScratch;         //< Scratch row for the in place pedestal correction
 
     icarus_signal_processing::FilterFunctionVec    fFilterFunctionVec;
-    
+
     const geo::Geometry*                           fGeometry;              //< pointer to the Geometry service
 
     // Keep track of the FFT 
@@ -218,6 +235,10 @@ private:
     std::unique_ptr<icarus_signal_processing::EdgeDetection>             fEdgeDetection;
     std::unique_ptr<icarus_signal_processing::IROIFinder2D>              fROIFinder2D;
 
+#ifdef ICARUS_GPU_DENOISER
+    std::unique_ptr<TPCDenoiserGPU>                                      fGPUDenoiser;
+#endif
+
 };
 
 TPCNoiseFilterCannyMC::TPCNoiseFilterCannyMC(fhicl::ParameterSet const &pset)
@@ -279,6 +300,18 @@ void TPCNoiseFilterCannyMC::configure(fhicl::ParameterSet const &pset)
     fMorphologicalWindow        = pset.get<unsigned int            >("MorphologicalWindow",      10);
     fCoherentThresholdFactor    = pset.get<float                   >("CoherentThresholdFactor", 2.5);
 
+    // Optionally offload the dense 2D work to the accelerator backend; only
+    // available when the build enables ICARUS_GPU_DENOISER
+    fUseGPU                     = pset.get<bool                    >("UseGPU",               false);
+
+#ifdef ICARUS_GPU_DENOISER
+    if (fUseGPU) fGPUDenoiser = std::make_unique<TPCDenoiserGPU>(fCoherentNoiseGrouping, fCoherentThresholdFactor);
+#else
+    if (fUseGPU)
+        throw cet::exception("TPCNoiseFilterCannyMC") << "UseGPU requested but icaruscode was built "
+                                                      << "without the GPU denoiser backend (ICARUS_GPU_DENOISER)";
+#endif
+
     fThresholdVec.resize(6560/fCoherentNoiseGrouping,fCoherentThresholdFactor);
 
     //fDenoiser2D = std::make_unique<icarus_signal_processing::Denoiser2D_Hough>(fMorphologicalFilter.get(), fThresholdVec, fCoherentNoiseGrouping, fCoherentNoiseOffset, fMorphologicalWindow);
@@ -329,10 +362,31 @@ void TPCNoiseFilterCannyMC::configure(fhicl::ParameterSet const &pset)
     return;
 }
 
-void TPCNoiseFilterCannyMC::process_fragment(detinfo::DetectorClocksData const&,
+void TPCNoiseFilterCannyMC::process_fragment(detinfo::DetectorClocksData const&          clockData,
                                                const daq::INoiseFilter::ChannelPlaneVec&   channelPlaneVec,
                                                const icarus_signal_processing::ArrayFloat& dataArray,
                                                const size_t&                               coherentNoiseGrouping)
+{
+    // Recover the number of channels and ticks
+    unsigned int numChannels = dataArray.size();
+    unsigned int numTicks    = dataArray[0].size();
+
+    // Legacy interface: stage a copy of the input into our own containers and
+    // run the zero-copy version on them so the accessors remain valid
+    if (fPedCorWaveforms.size()  < numChannels)  fPedCorWaveforms.resize(numChannels, icarus_signal_processing::VectorFloat(numTicks));
+
+    for(size_t idx = 0; idx < numChannels; idx++) fPedCorWaveforms[idx] = dataArray[idx];
+
+    process_fragment(clockData, channelPlaneVec, fPedCorWaveforms, fRawWaveforms, coherentNoiseGrouping);
+
+    return;
+}
+
+void TPCNoiseFilterCannyMC::process_fragment(detinfo::DetectorClocksData const&,
+                                               const daq::INoiseFilter::ChannelPlaneVec&   channelPlaneVec,
+                                               icarus_signal_processing::ArrayFloat&       dataArray,
+                                               icarus_signal_processing::ArrayFloat&       outputArray,
+                                               const size_t&                               coherentNoiseGrouping)
 {
     cet::cpu_timer theClockTotal;
 
@@ -344,13 +398,14 @@ void TPCNoiseFilterCannyMC::process_fragment(detinfo::DetectorClocksData const&,
 
     if (fSelectVals.size()       < numChannels)  fSelectVals.resize(numChannels, icarus_signal_processing::VectorBool(numTicks));
     if (fROIVals.size()          < numChannels)  fROIVals.resize(numChannels,  icarus_signal_processing::VectorBool(numTicks));
-    if (fRawWaveforms.size()     < numChannels)  fRawWaveforms.resize(numChannels, icarus_signal_processing::VectorFloat(numTicks));
-    if (fPedCorWaveforms.size()  < numChannels)  fPedCorWaveforms.resize(numChannels, icarus_signal_processing::VectorFloat(numTicks));
     if (fIntrinsicRMS.size()     < numChannels)  fIntrinsicRMS.resize(numChannels, icarus_signal_processing::VectorFloat(numTicks));
     if (fCorrectedMedians.size() < numChannels)  fCorrectedMedians.resize(numChannels, icarus_signal_processing::VectorFloat(numTicks));
     if (fWaveLessCoherent.size() < numChannels)  fWaveLessCoherent.resize(numChannels, icarus_signal_processing::VectorFloat(numTicks));
     if (fMorphedWaveforms.size() < numChannels)  fMorphedWaveforms.resize(numChannels, icarus_signal_processing::VectorFloat(numTicks));
 
+    // The caller owns the output array, just make sure it can hold the result
+    if (outputArray.size()       < numChannels)  outputArray.resize(numChannels, icarus_signal_processing::VectorFloat(numTicks));
+
     if (fChannelIDVec.size()     < numChannels)  fChannelIDVec.resize(numChannels);
     if (fPedestalVals.size()     < numChannels)  fPedestalVals.resize(numChannels);
     if (fFullRMSVals.size()      < numChannels)  fFullRMSVals.resize(numChannels);
@@ -362,6 +417,8 @@ void TPCNoiseFilterCannyMC::process_fragment(detinfo::DetectorClocksData const&,
 
     if (fFilterFunctionVec.size() < numChannels) fFilterFunctionVec.resize(numChannels);
 
+    if (fPedCorScratch.size()    < numTicks)     fPedCorScratch.resize(numTicks);
+
     std::cout <<"  -->process_fragment with " << numChannels << " channels and " << numTicks << " ticks, array sizes: " << fCorrectedMedians.size() << ", " << fCorrectedMedians[1].size() <<  std::endl;
 
     icarus_signal_processing::Denoiser1D           denoiser;
@@ -370,45 +427,49 @@ void TPCNoiseFilterCannyMC::process_fragment(detinfo::DetectorClocksData const&,
     // Make a pass throught to do pedestal corrections and get raw waveform information
     for(size_t idx = 0; idx < numChannels; idx++)
     {
-        icarus_signal_processing::VectorFloat& pedCorDataVec = fPedCorWaveforms[idx];
+        icarus_signal_processing::VectorFloat& pedCorDataVec = dataArray[idx];
 
         // Keep track of the channel
         fChannelIDVec[idx] = channelPlaneVec[idx].first;
 
-        // We need to recover info on which plane we have
-        std::vector<geo::WireID> widVec = fGeometry->ChannelToWire(fChannelIDVec[idx]);
-
         // Handle the filter function to use for this channel
-        unsigned int plane = widVec[0].Plane;
+        // (the plane is already in the channel/plane pair, no need for a geometry lookup)
+        unsigned int plane = channelPlaneVec[idx].second % 3;
 
         // Set the threshold which toggles between planes
         fThresholdVec[idx / coherentNoiseGrouping] = fThreshold[plane];
 
-        switch(fFilterModeVec[plane][0])
+        // The filter function depends only on configuration, create it once for this channel slot
+        if (!fFilterFunctionVec[idx])
         {
-            case 'd' :
-                fFilterFunctionVec[idx] = std::make_unique<icarus_signal_processing::Dilation1D>(fStructuringElement[1]);
-                break;
-            case 'e' :
-                fFilterFunctionVec[idx] = std::make_unique<icarus_signal_processing::Erosion1D>(fStructuringElement[1]);
-                break;
-            case 'g' :
-                fFilterFunctionVec[idx] = std::make_unique<icarus_signal_processing::Gradient1D>(fStructuringElement[1]);
-                break;
-            case 'a' :
-                fFilterFunctionVec[idx] = std::make_unique<icarus_signal_processing::Average1D>(fStructuringElement[1]);
-                break;
-            case 'm' :
-                fFilterFunctionVec[idx] = std::make_unique<icarus_signal_processing::Median1D>(fStructuringElement[1]);
-                break;
-            default:
-                std::cout << "***** FOUND NO MATCH FOR TYPE: " << fFilterModeVec[plane] << ", plane " << plane << " DURING INITIALIZATION OF FILTER FUNCTIONS IN TPCNoiseFilterCannyMC" << std::endl;
-                break;
+            switch(fFilterModeVec[plane][0])
+            {
+                case 'd' :
+                    fFilterFunctionVec[idx] = std::make_unique<icarus_signal_processing::Dilation1D>(fStructuringElement[1]);
+                    break;
+                case 'e' :
+                    fFilterFunctionVec[idx] = std::make_unique<icarus_signal_processing::Erosion1D>(fStructuringElement[1]);
+                    break;
+                case 'g' :
+                    fFilterFunctionVec[idx] = std::make_unique<icarus_signal_processing::Gradient1D>(fStructuringElement[1]);
+                    break;
+                case 'a' :
+                    fFilterFunctionVec[idx] = std::make_unique<icarus_signal_processing::Average1D>(fStructuringElement[1]);
+                    break;
+                case 'm' :
+                    fFilterFunctionVec[idx] = std::make_unique<icarus_signal_processing::Median1D>(fStructuringElement[1]);
+                    break;
+                default:
+                    std::cout << "***** FOUND NO MATCH FOR TYPE: " << fFilterModeVec[plane] << ", plane " << plane << " DURING INITIALIZATION OF FILTER FUNCTIONS IN TPCNoiseFilterCannyMC" << std::endl;
+                    break;
+            }
         }
 
-        // Now determine the pedestal and correct for it
+        // Now determine the pedestal and correct for it. The correction is "in
+        // place": go through a scratch row and swap it with the input row (the
+        // rows are the same length so the swap just exchanges the buffers)
         waveformTools.getPedestalCorrectedWaveform(dataArray[idx],
-                                                   pedCorDataVec,
+                                                   fPedCorScratch,
                                                    fSigmaForTruncation,
                                                    fPedestalVals[idx],
                                                    fFullRMSVals[idx],
@@ -416,16 +477,22 @@ void TPCNoiseFilterCannyMC::process_fragment(detinfo::DetectorClocksData const&,
                                                    fNumTruncBins[idx],
                                                    fRangeBins[idx]);
 
+        std::swap(pedCorDataVec, fPedCorScratch);
+
         // Convolve with a filter function
         if (fUseFFTFilter) (*fFFTFilterFunctionVec[plane])(pedCorDataVec);
     }
 
-    icarus_signal_processing::ArrayFloat finalErosion(numChannels,icarus_signal_processing::VectorFloat(numTicks,0.));
-
     std::cout << "  --> calling icarus_signal_processing code" << std::endl;
 
+#ifdef ICARUS_GPU_DENOISER
+    // The GPU backend covers the coherent denoising and the threshold ROI
+    // selection; the copies to/from the device overlap the kernels
+    if (fUseGPU) fGPUDenoiser->denoise(dataArray, outputArray, fROIVals);
+    else
+#endif
     // Now pass the entire data array to the denoisercoherent
-    (*fROIFinder2D)(fPedCorWaveforms,fRawWaveforms,fROIVals); //,fWaveLessCoherent,fCorrectedMedians,fIntrinsicRMS,fMorphedWaveforms,finalErosion);
+    (*fROIFinder2D)(dataArray,outputArray,fROIVals); //,fWaveLessCoherent,fCorrectedMedians,fIntrinsicRMS,fMorphedWaveforms,finalErosion);
 
     std::cout << "  --> have returned from denoising" << std::endl;
 
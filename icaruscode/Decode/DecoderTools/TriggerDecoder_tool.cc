@@ -10,6 +10,7 @@
 
 #include "art/Framework/Core/EDProducer.h"
 #include "art/Framework/Principal/Event.h"
+#include "art/Framework/Principal/Run.h"
 #include "art/Framework/Principal/Handle.h"
 #include "art/Framework/Services/Registry/ServiceHandle.h"
 #include "art/Persistency/Common/PtrMaker.h"
@@ -29,7 +30,9 @@
 
 // #include "sbnobj/Common/Trigger/ExtraTriggerInfo.h" // maybe future location of:
 #include "icaruscode/Decode/DataProducts/ExtraTriggerInfo.h"
+#include "icaruscode/Decode/DataProducts/TriggerClassification.h"
 #include "icaruscode/Decode/DecoderTools/IDecoder.h"
+#include "icaruscode/Decode/DecoderTools/RunHistory.h"
 // #include "sbnobj/Common/Trigger/BeamBits.h" // maybe future location of:
 #include "icaruscode/Decode/BeamBits.h" // sbn::triggerSource
 #include "icaruscode/Decode/DecoderTools/Dumpers/FragmentDumper.h" // dumpFragment()
@@ -124,7 +127,13 @@ namespace daq
    *         match the event number.
    *     * `gateID`: the count of gates since the beginning of the run, as
    *         reported by the trigger hardware.
-   * 
+   * * `icarus::TriggerClassification`: a minimal summary of the trigger (just
+   *     the hardware gate type code so far), intended for job topologies where
+   *     the trigger decoder is scheduled _before_ the heavy TPC and PMT
+   *     decoders so that they can reduce their work on the gates (e.g.
+   *     offbeam) that do not need their full output. Like
+   *     `sbn::ExtraTriggerInfo` this is a single object, not a collection.
+   *
    * Besides the main data product (empty instance name) an additional
    * `std::vector<raw::ExternalTrigger>` data product with instance name
    * `"previous"` is also produced, which relays the same kind of information
@@ -142,6 +151,7 @@ namespace daq
     
     virtual void produces(art::ProducesCollector&) override;
     virtual void configure(const fhicl::ParameterSet&) override;
+    virtual void setupRun(art::Run const& run) override;
     virtual void initializeDataProducts() override;
     virtual void process_fragment(const artdaq::Fragment &fragment) override;
     virtual void outputDataProducts(art::Event &event) override;
@@ -153,14 +163,19 @@ namespace daq
     using BeamGateInfoCollection = std::vector<sim::BeamGateInfo>;
     using BeamGateInfoPtr = std::unique_ptr<BeamGateInfoCollection>;
     using ExtraInfoPtr = std::unique_ptr<sbn::ExtraTriggerInfo>;
+    using ClassificationPtr = std::unique_ptr<icarus::TriggerClassification>;
     TriggerPtr fTrigger;
     TriggerPtr fPrevTrigger;
     std::unique_ptr<RelativeTriggerCollection> fRelTrigger;
     ExtraInfoPtr fTriggerExtra;
-    BeamGateInfoPtr fBeamGateInfo; 
+    ClassificationPtr fClassification;
+    BeamGateInfoPtr fBeamGateInfo;
     bool fDiagnosticOutput; //< Produces large number of diagnostic messages, use with caution!
     bool fDebug; //< Use this for debugging this tool
     int fOffset; //< Use this to determine additional correction needed for TAI->UTC conversion from White Rabbit timestamps. Needs to be changed if White Rabbit firmware is changed and the number of leap seconds changes! 
+    bool fUseRunHistory; //< Take the beam gate widths from the run history service when it has a record for the run (never blocks: the service is fed from a local snapshot)
+    nanoseconds fBNBgateWidth = BNBgateDuration; //< Beam gate width used for BNB (nominal, or from run history)
+    nanoseconds fNuMIgateWidth = NuMIgateDuration; //< Beam gate width used for NuMI (nominal, or from run history)
     //Add in trigger data member information once it is selected, current LArSoft object likely not enough as is
     
     // uint64_t fLastTimeStamp = 0;
@@ -168,7 +183,12 @@ namespace daq
     long fLastEvent = 0;
     
     detinfo::DetectorTimings const fDetTimings; ///< Detector clocks and timings.
-    
+
+    /// Parser for the content of the trigger data packet, set up once for the
+    /// whole job (the packet is self-describing text, so the format is
+    /// discovered while parsing rather than from a fixed offset table).
+    icarus::details::KeyedCSVparser const fPacketParser;
+
     /// Creates a `ICARUSTriggerInfo` from a generic fragment.
     icarus::ICARUSTriggerUDPFragment makeTriggerFragment
       (artdaq::Fragment const& fragment) const;
@@ -227,6 +247,7 @@ namespace daq
     collector.produces<RelativeTriggerCollection>(CurrentTriggerInstanceName);
     collector.produces<BeamGateInfoCollection>(CurrentTriggerInstanceName);
     collector.produces<sbn::ExtraTriggerInfo>(CurrentTriggerInstanceName);
+    collector.produces<icarus::TriggerClassification>(CurrentTriggerInstanceName);
   }
     
 
@@ -235,6 +256,34 @@ namespace daq
     fDiagnosticOutput = pset.get<bool>("DiagnosticOutput", false);
     fDebug = pset.get<bool>("Debug", false);
     fOffset = pset.get<long long int>("TAIOffset", 2000000000);
+    fUseRunHistory = pset.get<bool>("UseRunHistory", false);
+    return;
+  }
+  
+  void TriggerDecoder::setupRun(art::Run const& run)
+  {
+    // start each run from the nominal widths
+    fBNBgateWidth = BNBgateDuration;
+    fNuMIgateWidth = NuMIgateDuration;
+    if(!fUseRunHistory) return;
+    
+    // the run history lookup is wait-free: the service serves it from a
+    // prefetched local snapshot, so the decoding never blocks on network I/O
+    art::ServiceHandle<icarusDB::RunHistory> runHistory;
+    if(auto record = runHistory->runRecord(run.run()); record)
+    {
+      if(record->bnbGateWidth > 0.) fBNBgateWidth = nanoseconds{ record->bnbGateWidth };
+      if(record->numiGateWidth > 0.) fNuMIgateWidth = nanoseconds{ record->numiGateWidth };
+      mf::LogDebug("TriggerDecoder")
+        << "Run " << run.run() << " ('" << record->configurationName
+        << "'): gate widths BNB " << fBNBgateWidth << ", NuMI " << fNuMIgateWidth;
+    }
+    else
+    {
+      mf::LogWarning("TriggerDecoder")
+        << "No run history record for run " << run.run()
+        << ": using the nominal beam gate widths";
+    }
     return;
   }
   
@@ -247,6 +296,7 @@ namespace daq
     fRelTrigger = std::make_unique<RelativeTriggerCollection>();
     fBeamGateInfo = BeamGateInfoPtr(new BeamGateInfoCollection);
     fTriggerExtra = std::make_unique<sbn::ExtraTriggerInfo>();
+    fClassification = std::make_unique<icarus::TriggerClassification>();
     return;
   }
   
@@ -320,7 +370,18 @@ namespace daq
     // remove this part when the beam gate timestamp is available via fragment
     // or via the parser; the beam gate (`beamgate_ts`) is supposed to undergo
     // the same correction as the trigger time (`wr_ts`)
-    auto const parsedData = icarus::details::KeyedCSVparser{}(firstLine(data));
+    std::string_view const dataLine = firstLine(data);
+    icarus::details::KeyedCSVparser::ParsedData_t parsedData;
+    try {
+      fPacketParser.parse(dataLine, parsedData);
+    }
+    catch(icarus::details::KeyedCSVparser::Error const& e) {
+      mf::LogError("TriggerDecoder")
+        << "Error parsing " << dataLine.length()
+        << "-char long trigger string:\n==>|" << dataLine
+        << "|<==\nError message: " << e.what() << std::endl;
+      throw;
+    }
     unsigned int beamgate_count { std::numeric_limits<unsigned int>::max() };
     std::uint64_t beamgate_ts { wr_ts }; // we cheat
     /* [20210717, petrillo@slac.stanford.edu] `(pBeamGateInfo->nValues() == 3)`:
@@ -360,21 +421,10 @@ namespace daq
         << " s (" << timestampDiff(beamgate_ts, wr_ts)
         << " ns relative to trigger)" << std::endl;
       
-      // note that this parsing is independent from the one used above
-      std::string_view const dataLine = firstLine(data);
-      try {
-        auto const parsedData = icarus::details::KeyedCSVparser{}(dataLine);
-        std::cout << "Parsed data (from " << dataLine.size() << " characters): "
-          << parsedData << std::endl;
-      }
-      catch(icarus::details::KeyedCSVparser::Error const& e) {
-        mf::LogError("TriggerDecoder")
-          << "Error parsing " << dataLine.length()
-          << "-char long trigger string:\n==>|" << dataLine
-          << "|<==\nError message: " << e.what() << std::endl;
-        throw;
-      }
-      
+      // this is the same parsing result as extracted above
+      std::cout << "Parsed data (from " << dataLine.size() << " characters): "
+        << parsedData << std::endl;
+
       if (fDebug) { // this grows tiresome quickly when processing many events
         std::cout << "Trigger packet content:\n" << dataLine
           << "\nFull trigger fragment dump:"
@@ -399,6 +449,13 @@ namespace daq
     fTriggerExtra->beamGateTimestamp = beamgate_ts;
     fTriggerExtra->triggerID = datastream_info.wr_event_no;
     fTriggerExtra->gateID = datastream_info.gate_id;
+
+    // the classification shares the hardware codes of `TriggerGateTypes`;
+    // an unsupported code falls back to `Unknown` so the downstream decoders
+    // do not take any shortcut on a trigger we could not classify
+    fClassification->gateType
+      = (beamGateBit == sbn::triggerSource::Unknown)
+      ? icarus::TriggerClassification::Unknown: gate_type;
     /* TODO:
     fTriggerExtra->triggerCount
     fTriggerExtra->gateCount
@@ -445,19 +502,19 @@ namespace daq
     switch (gate_type) {
       case TriggerGateTypes::BNB:
         fBeamGateInfo->emplace_back
-          (simGateStart.value(), BNBgateDuration.value(), sim::kBNB);
+          (simGateStart.value(), fBNBgateWidth.value(), sim::kBNB);
         break;
       case TriggerGateTypes::NuMI:
         fBeamGateInfo->emplace_back
-          (simGateStart.value(), NuMIgateDuration.value(), sim::kNuMI);
+          (simGateStart.value(), fNuMIgateWidth.value(), sim::kNuMI);
         break;
       case TriggerGateTypes::OffbeamBNB:
         fBeamGateInfo->emplace_back
-          (simGateStart.value(), BNBgateDuration.value(), sim::kBNB);
+          (simGateStart.value(), fBNBgateWidth.value(), sim::kBNB);
         break;
       case TriggerGateTypes::OffbeamNuMI:
         fBeamGateInfo->emplace_back
-          (simGateStart.value(), NuMIgateDuration.value(), sim::kNuMI);
+          (simGateStart.value(), fNuMIgateWidth.value(), sim::kNuMI);
         break;
       default:
         mf::LogWarning("TriggerDecoder") << "Unsupported gate type #" << gate_type;
@@ -485,6 +542,7 @@ namespace daq
     event.put(std::move(fPrevTrigger), PreviousTriggerInstanceName);
     event.put(std::move(fBeamGateInfo), CurrentTriggerInstanceName);
     event.put(std::move(fTriggerExtra));
+    event.put(std::move(fClassification), CurrentTriggerInstanceName);
     return;
   }
 
@@ -10,7 +10,6 @@
 
 // LArSoft libraries
 #include "larcorealg/CoreUtils/zip.h"
-#include "larcorealg/CoreUtils/enumerate.h"
 
 // framework libraries
 #include "art/Framework/Principal/Event.h"
@@ -20,14 +19,18 @@
 #include "canvas/Persistency/Provenance/ProductToken.h"
 #include "canvas/Persistency/Provenance/EventID.h"
 #include "canvas/Utilities/InputTag.h"
+#include "canvas/Utilities/Exception.h"
 #include "messagefacility/MessageLogger/MessageLogger.h"
 #include "fhiclcpp/types/Sequence.h"
 #include "fhiclcpp/types/Atom.h"
 
 // C/C++ standard libraries
-#include <algorithm> // std::transform()
+#include <algorithm> // std::transform(), std::min()
+#include <fstream>
+#include <limits>
 #include <vector>
 #include <string>
+#include <cstddef> // std::size_t
 
 
 //------------------------------------------------------------------------------
@@ -55,9 +58,24 @@ namespace sbn { class DumpArtDAQfragments; }
  * 
  * * `FragmentTags` (list of data product input tags): the tags identifying the
  *     data products to dump.
+ * * `FirstFragment` (integer, default: `0`): index of the first fragment of
+ *     each collection to be dumped; the ones before it are skipped.
+ * * `MaxFragments` (integer, default: unlimited): dump at most this many
+ *     fragments out of each collection.
+ * * `MaxBytesPerFragment` (integer, default: unlimited): dump at most this
+ *     many bytes out of each data block (header, metadata, payload) of each
+ *     fragment; the dump reports how much was left out.
+ * * `BinaryDumpFile` (string, default: empty): when not empty, instead of the
+ *     hexadecimal text dump the raw bytes of the selected fragments are
+ *     appended to the file with this name, and only one line per fragment,
+ *     with its offset and size in that file, goes to the output stream.
  * * `OutputCategory` (string, default: `DumpArtDAQfragments`): name of the
  *     message facility output stream to dump the information into
- * 
+ *
+ * Each fragment is sent out as its own message, so that at any time at most
+ * one fragment dump is being formatted in memory: with a cap on the bytes per
+ * fragment, the memory needed by the dump is bounded no matter how large the
+ * event is.
  */
 class sbn::DumpArtDAQfragments: public art::EDAnalyzer {
   
@@ -74,6 +92,31 @@ class sbn::DumpArtDAQfragments: public art::EDAnalyzer {
       Comment("tag of fragment collection data products to be dumped")
       };
 
+    fhicl::Atom<std::size_t> FirstFragment {
+      Name("FirstFragment"),
+      Comment("index of the first fragment of each collection to be dumped"),
+      0U
+      };
+
+    fhicl::Atom<std::size_t> MaxFragments {
+      Name("MaxFragments"),
+      Comment("maximum number of fragments dumped out of each collection"),
+      std::numeric_limits<std::size_t>::max()
+      };
+
+    fhicl::Atom<std::size_t> MaxBytesPerFragment {
+      Name("MaxBytesPerFragment"),
+      Comment("maximum number of bytes dumped out of each fragment data block"),
+      std::numeric_limits<std::size_t>::max()
+      };
+
+    fhicl::Atom<std::string> BinaryDumpFile {
+      Name("BinaryDumpFile"),
+      Comment
+        ("append the raw bytes of the fragments to this file instead of text"),
+      ""
+      };
+
     fhicl::Atom<std::string> OutputCategory {
       Name("OutputCategory"),
       Comment("name of the category used for the output"),
@@ -109,13 +152,29 @@ class sbn::DumpArtDAQfragments: public art::EDAnalyzer {
   
   /// Input data tokens.
   std::vector<art::ProductToken<artdaq::Fragments>> const fInputTokens;
-  
+
+  /// Index of the first fragment of each collection to be dumped.
+  std::size_t const fFirstFragment;
+
+  /// Maximum number of fragments dumped out of each collection.
+  std::size_t const fMaxFragments;
+
+  /// Maximum number of bytes dumped out of each fragment data block.
+  std::size_t const fMaxBytesPerFragment;
+
+  /// Name of the raw binary dump file (empty: text dump).
+  std::string const fBinaryDumpFileName;
+
   /// Category used for message facility stream.
   std::string const fOutputCategory;
-  
+
   // --- END Configuration variables -------------------------------------------
-  
-  
+
+
+  /// Raw binary dump stream (open only when configured).
+  std::ofstream fBinaryDumpFile;
+
+
   /// Get art tokens for specified input data products.
   std::vector<art::ProductToken<artdaq::Fragments>> getFragmentTokens
     (std::vector<art::InputTag> const& tags);
@@ -125,8 +184,12 @@ class sbn::DumpArtDAQfragments: public art::EDAnalyzer {
     art::Event const& event,
     art::InputTag const& inputTag,
     art::ProductToken<artdaq::Fragments> const& inputToken
-    ) const;
-  
+    );
+
+  /// Appends the raw bytes of `fragment` to the binary dump file.
+  void dumpFragmentBinary
+    (std::size_t iFragment, artdaq::Fragment const& fragment);
+
 }; // sbn::DumpArtDAQfragments
 
 
@@ -139,11 +202,25 @@ sbn::DumpArtDAQfragments::DumpArtDAQfragments
   (Parameters const& config)
   : art::EDAnalyzer(config)
   // configuration
-  , fInputTags     (config().FragmentTags())
-  , fInputTokens   (getFragmentTokens(fInputTags))
-  , fOutputCategory(config().OutputCategory())
+  , fInputTags          (config().FragmentTags())
+  , fInputTokens        (getFragmentTokens(fInputTags))
+  , fFirstFragment      (config().FirstFragment())
+  , fMaxFragments       (config().MaxFragments())
+  , fMaxBytesPerFragment(config().MaxBytesPerFragment())
+  , fBinaryDumpFileName (config().BinaryDumpFile())
+  , fOutputCategory     (config().OutputCategory())
 {
   assert(fInputTags.size() == fInputTokens.size());
+
+  if (!fBinaryDumpFileName.empty()) {
+    fBinaryDumpFile.open
+      (fBinaryDumpFileName, std::ios::binary | std::ios::app);
+    if (!fBinaryDumpFile) {
+      throw art::Exception{ art::errors::FileOpenError }
+        << "Can't open binary dump file '" << fBinaryDumpFileName << "'.\n";
+    }
+  } // if binary dump
+
 } // sbn::DumpArtDAQfragments::DumpArtDAQfragments()
 
 
@@ -163,29 +240,71 @@ void sbn::DumpArtDAQfragments::dumpFragments(
   art::Event const& event,
   art::InputTag const& inputTag,
   art::ProductToken<artdaq::Fragments> const& inputToken
-) const {
-  
+) {
+
   art::Handle<artdaq::Fragments> fragmentHandle;
   //bool found = event.getByToken(inputToken, fragmentHandle);
-  
+
   if ( !(fragmentHandle = event.getHandle<artdaq::Fragments>(inputToken)) ) {
     mf::LogVerbatim(fOutputCategory)
       << "No fragment collection found as '" << inputTag.encode() << "'.";
     return;
   }
-  
+
   artdaq::Fragments const& fragments = *fragmentHandle;
-  mf::LogVerbatim log { fOutputCategory };
-  log << "Data product '" << inputTag.encode() << "' has " << fragments.size()
-    << " fragments.";
-  for (auto const& [ iFragment, fragment ]: util::enumerate(fragments)) {
-    // TODO special case for artdaq::ContainerFragment?
-    log << "\n[#" << iFragment << "] " << sbndaq::dumpFragment(fragment);
+
+  std::size_t const firstFragment = std::min(fFirstFragment, fragments.size());
+  std::size_t const endFragment = firstFragment
+    + std::min(fMaxFragments, fragments.size() - firstFragment);
+
+  {
+    mf::LogVerbatim log { fOutputCategory };
+    log << "Data product '" << inputTag.encode() << "' has "
+      << fragments.size() << " fragments";
+    if ((firstFragment > 0U) || (endFragment < fragments.size())) {
+      log << " (dumping #" << firstFragment << " to #" << (endFragment - 1U)
+        << ")";
+    }
+    log << ".";
+  }
+
+  // one message per fragment: at most one fragment dump at a time is being
+  // formatted in memory, no matter how many fragments the event carries
+  for (std::size_t iFragment = firstFragment; iFragment < endFragment;
+    ++iFragment
+  ) {
+    artdaq::Fragment const& fragment = fragments[iFragment];
+    if (fBinaryDumpFile.is_open())
+      dumpFragmentBinary(iFragment, fragment);
+    else {
+      // TODO special case for artdaq::ContainerFragment?
+      mf::LogVerbatim { fOutputCategory } << "[#" << iFragment << "] "
+        << sbndaq::dumpFragment(fragment, fMaxBytesPerFragment);
+    }
   } // for
-  
+
 } // sbn::DumpArtDAQfragments::dumpFragments()
 
 
+//------------------------------------------------------------------------------
+void sbn::DumpArtDAQfragments::dumpFragmentBinary
+  (std::size_t iFragment, artdaq::Fragment const& fragment)
+{
+
+  auto const offset = fBinaryDumpFile.tellp();
+  std::size_t const size = fragment.sizeBytes();
+
+  fBinaryDumpFile.write
+    (reinterpret_cast<char const*>(fragment.headerBeginBytes()), size);
+  fBinaryDumpFile.flush();
+
+  mf::LogVerbatim(fOutputCategory)
+    << "[#" << iFragment << "] " << size << " bytes written into '"
+    << fBinaryDumpFileName << "' at offset " << offset << ".";
+
+} // sbn::DumpArtDAQfragments::dumpFragmentBinary()
+
+
 //------------------------------------------------------------------------------
 std::vector<art::ProductToken<artdaq::Fragments>>
 sbn::DumpArtDAQfragments::getFragmentTokens
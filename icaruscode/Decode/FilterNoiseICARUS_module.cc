@@ -35,6 +35,7 @@
 
 #include "tbb/parallel_for.h"
 #include "tbb/blocked_range.h"
+#include "tbb/pipeline.h"
 #include "tbb/task_arena.h"
 #include "tbb/spin_mutex.h"
 #include "tbb/concurrent_vector.h"
@@ -126,6 +127,7 @@ private:
     std::string                                  fOutputPedCorPath;    ///< Path to assign to the output if asked for
     std::string                                  fOutputCoherentPath;  ///< Path to assign to the output if asked for
     unsigned int                                 fPlaneToSimulate;     ///< Use to get fragment offset
+    size_t                                       fDecodeAheadDepth;    ///< If nonzero, stream fragments through a bounded pipeline of this depth
 
     // Statistics.
     int                                          fNumEvent;             ///< Number of events seen.
@@ -228,6 +230,7 @@ void FilterNoiseICARUS::configure(fhicl::ParameterSet const & pset)
     fOutputPedCorPath   = pset.get<std::string  >("OutputPedCorPath",                "RAW");
     fOutputCoherentPath = pset.get<std::string  >("OutputCoherentPath",              "Cor");
     fPlaneToSimulate    = pset.get<unsigned int >("PlaneToSimulate",                     2);
+    fDecodeAheadDepth   = pset.get<size_t       >("DecodeAheadDepth",                    0);
 }
 
 //----------------------------------------------------------------------------
@@ -270,14 +273,41 @@ void FilterNoiseICARUS::produce(art::Event & event, art::ProcessingFrame const&)
 
     // ... Launch multiple threads with TBB to do the deconvolution and find ROIs in parallel
     auto const clockData = art::ServiceHandle<detinfo::DetectorClocksService>()->DataFor(event);
-    multiThreadFragmentProcessing fragmentProcessing(*this,
-                                                     clockData,
-                                                     daq_handle,
-                                                     concurrentRawDigits,
-                                                     concurrentRawRawDigits,
-                                                     coherentRawDigits);
-
-    tbb::parallel_for(tbb::blocked_range<size_t>(0, daq_handle->size()), fragmentProcessing);
+
+    if (fDecodeAheadDepth > 0)
+    {
+        // Stream the fragments through a bounded pipeline: the serial input stage stays
+        // ahead handing out the next fragment while the fragments already in flight are
+        // being filtered, with the token count capping the queue. The blocked range below
+        // can group several fragments into a single task which leaves threads idle when
+        // running with low concurrency (e.g. the online monitor), this keeps them fed
+        // one fragment at a time
+        size_t fragmentIdx(0);
+
+        tbb::parallel_pipeline(fDecodeAheadDepth,
+            tbb::make_filter<void,size_t>(tbb::filter::serial_in_order,
+                [&](tbb::flow_control& flowControl) -> size_t
+                {
+                    if (fragmentIdx >= daq_handle->size()) flowControl.stop();
+                    return fragmentIdx++;
+                }) &
+            tbb::make_filter<size_t,void>(tbb::filter::parallel,
+                [&](size_t idx)
+                {
+                    processSingleFragment(idx, clockData, daq_handle, concurrentRawDigits, concurrentRawRawDigits, coherentRawDigits);
+                }));
+    }
+    else
+    {
+        multiThreadFragmentProcessing fragmentProcessing(*this,
+                                                         clockData,
+                                                         daq_handle,
+                                                         concurrentRawDigits,
+                                                         concurrentRawRawDigits,
+                                                         coherentRawDigits);
+
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, daq_handle->size()), fragmentProcessing);
+    }
 
     // Copy the raw digits from the concurrent vector to our output vector
     RawDigitCollectionPtr rawDigitCollection = std::make_unique<std::vector<raw::RawDigit>>(std::move_iterator(concurrentRawDigits.begin()), 
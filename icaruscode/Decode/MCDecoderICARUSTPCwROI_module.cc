@@ -44,6 +44,8 @@
 #include "lardataobj/RawData/RawDigit.h"
 #include "lardataobj/RawData/raw.h"
 #include "lardataobj/RecoBase/Wire.h"         // This for outputting the ROIs
+
+#include "icaruscode/Decode/DataProducts/ChannelOccupancyIndex.h"
 #include "lardata/ArtDataHelper/WireCreator.h"
 
 #include "icaruscode/Decode/ChannelMapping/IICARUSChannelMap.h"
@@ -89,27 +91,35 @@ public:
     using ChannelArrayPair      = std::pair<daq::INoiseFilter::ChannelPlaneVec,icarus_signal_processing::ArrayFloat>;
     using ChannelArrayPairVec   = std::vector<ChannelArrayPair>;
 
+    // Scatter-gather assembly of the output products: each channel's outputs
+    // are written into a preallocated slot given by the rank of the channel in
+    // channel order, so the collections come out already sorted (no post-hoc
+    // sort) and different workers never touch the same slot (no locking)
+    struct ChannelSlotOutputs
+    {
+        std::map<raw::ChannelID_t,size_t> channelToSlotMap;    ///< channel --> output slot index
+        RawDigitCollection                rawDigits;           ///< the denoised RawDigits
+        RawDigitCollection                rawRawDigits;        ///< pedestal corrected only (if requested)
+        RawDigitCollection                coherentDigits;      ///< coherent corrections (if requested)
+        WireCollection                    rois;                ///< the candidate ROIs
+        std::vector<char>                 slotFilledVec;       ///< was this slot actually filled?
+    };
+
     // Function to do the work
     void processSingleImage(const detinfo::DetectorClocksData&,
                             const ChannelArrayPair&,
                             size_t,
-                            ConcurrentRawDigitCol&,
-                            ConcurrentRawDigitCol&,
-                            ConcurrentRawDigitCol&,
-                            ConcurrentWireCol&) const;
+                            ChannelSlotOutputs&) const;
 
 private:
 
     // Function to grab the input data and package
     void processSingleLabel(art::Event&,
-                            const art::InputTag&, 
+                            const art::InputTag&,
                             detinfo::DetectorClocksData const&,
                             ChannelArrayPairVec const&,
                             size_t const&,
-                            ConcurrentRawDigitCol&,
-                            ConcurrentRawDigitCol&,
-                            ConcurrentRawDigitCol&,
-                            ConcurrentWireCol&) const;
+                            ChannelSlotOutputs&) const;
 
     class multiThreadImageProcessing
     {
@@ -118,18 +128,12 @@ private:
                                    detinfo::DetectorClocksData const& clockData,
                                    ChannelArrayPairVec         const& channelArrayPairVec,
                                    size_t                      const& coherentNoiseGrouping,
-                                   ConcurrentRawDigitCol&             concurrentRawDigits,
-                                   ConcurrentRawDigitCol&             concurrentRawRawDigits,
-                                   ConcurrentRawDigitCol&             coherentRawDigits,
-                                   ConcurrentWireCol&                 concurrentROIs)
+                                   ChannelSlotOutputs&                channelSlotOutputs)
             : fMCDecoderICARUSTPCwROI(parent),
               fClockData{clockData},
               fChannelArrayPairVec(channelArrayPairVec),
               fCoherentNoiseGrouping(coherentNoiseGrouping),
-              fConcurrentRawDigits(concurrentRawDigits),
-              fConcurrentRawRawDigits(concurrentRawRawDigits),
-              fCoherentRawDigits(coherentRawDigits),
-              fConcurrentROIs(concurrentROIs)
+              fChannelSlotOutputs(channelSlotOutputs)
         {}
 
         void operator()(const tbb::blocked_range<size_t>& range) const
@@ -138,7 +142,7 @@ private:
             {
                 const ChannelArrayPair& channelArrayPair = fChannelArrayPairVec[idx];
 
-                fMCDecoderICARUSTPCwROI.processSingleImage(fClockData, channelArrayPair, fCoherentNoiseGrouping, fConcurrentRawDigits, fConcurrentRawRawDigits, fCoherentRawDigits, fConcurrentROIs);
+                fMCDecoderICARUSTPCwROI.processSingleImage(fClockData, channelArrayPair, fCoherentNoiseGrouping, fChannelSlotOutputs);
             }
         }
     private:
@@ -146,10 +150,7 @@ private:
         const detinfo::DetectorClocksData& fClockData;
         const ChannelArrayPairVec&         fChannelArrayPairVec;
         size_t                             fCoherentNoiseGrouping;
-        ConcurrentRawDigitCol&             fConcurrentRawDigits;
-        ConcurrentRawDigitCol&             fConcurrentRawRawDigits;
-        ConcurrentRawDigitCol&             fCoherentRawDigits;
-        ConcurrentWireCol&                 fConcurrentROIs;
+        ChannelSlotOutputs&                fChannelSlotOutputs;
     };
 
     // Function to save our RawDigits
@@ -239,6 +240,7 @@ MCDecoderICARUSTPCwROI::MCDecoderICARUSTPCwROI(fhicl::ParameterSet const & pset,
     {
         produces<std::vector<raw::RawDigit>>(instanceLabel);
         produces<std::vector<recob::Wire>>(instanceLabel);
+        produces<icarus::ChannelOccupancyIndex>(instanceLabel);
 
         if (fOutputRawWaveform)
             produces<std::vector<raw::RawDigit>>(instanceLabel + fOutputRawWavePath);
@@ -380,10 +382,7 @@ void MCDecoderICARUSTPCwROI::produce(art::Event & event, art::ProcessingFrame co
         art::Handle<artdaq::Fragments> daq_handle;
         event.getByLabel(rawDigitLabel, daq_handle);
 
-        ConcurrentRawDigitCol concurrentRawDigits;
-        ConcurrentRawDigitCol concurrentRawRawDigits;
-        ConcurrentRawDigitCol coherentRawDigits;
-        ConcurrentWireCol     concurrentROIs;
+        ChannelSlotOutputs   channelSlotOutputs;
 
         PlaneIdxToImageMap   planeIdxToImageMap;
         PlaneIdxToChannelMap planeIdxToChannelMap;
@@ -407,18 +406,24 @@ void MCDecoderICARUSTPCwROI::produce(art::Event & event, art::ProcessingFrame co
         auto const clockData = art::ServiceHandle<detinfo::DetectorClocksService>()->DataFor(event);
     
         // ... repackage the input MC data to format suitable for noise processing
-        processSingleLabel(event, rawDigitLabel, clockData, channelArrayPairVec, fCoherentNoiseGrouping, concurrentRawDigits, concurrentRawRawDigits, coherentRawDigits, concurrentROIs);
+        processSingleLabel(event, rawDigitLabel, clockData, channelArrayPairVec, fCoherentNoiseGrouping, channelSlotOutputs);
 
-//        multiThreadImageProcessing imageProcessing(*this, clockData, channelArrayPairVec, fCoherentNoiseGrouping, concurrentRawDigits, concurrentRawRawDigits, coherentRawDigits, concurrentROIs);
+//        multiThreadImageProcessing imageProcessing(*this, clockData, channelArrayPairVec, fCoherentNoiseGrouping, channelSlotOutputs);
 //
 //        tbb::parallel_for(tbb::blocked_range<size_t>(0, fNumROPs), imageProcessing);
-    
-        // Copy the raw digits from the concurrent vector to our output vector
-        RawDigitCollectionPtr rawDigitCollection = std::make_unique<std::vector<raw::RawDigit>>(std::move_iterator(concurrentRawDigits.begin()), 
-                                                                                                std::move_iterator(concurrentRawDigits.end()));
-    
-        // Want the RawDigits to be sorted in channel order... has to be done somewhere so why not now?
-        std::sort(rawDigitCollection->begin(),rawDigitCollection->end(),[](const auto& left,const auto&right){return left.Channel() < right.Channel();});
+
+        // Gather phase: the slots are already in channel order so no sorting here,
+        // just drop the slots which never got filled (unknown or wrong plane channels)
+        size_t numSlots(channelSlotOutputs.slotFilledVec.size());
+
+        RawDigitCollectionPtr rawDigitCollection = std::make_unique<std::vector<raw::RawDigit>>();
+
+        rawDigitCollection->reserve(numSlots);
+
+        for(size_t slotIdx = 0; slotIdx < numSlots; slotIdx++)
+        {
+            if (channelSlotOutputs.slotFilledVec[slotIdx]) rawDigitCollection->emplace_back(std::move(channelSlotOutputs.rawDigits[slotIdx]));
+        }
 
         // What did we get back?
         mf::LogDebug("MCDecoderICARUSTPCwROI") << "****> Total size of map: " << planeIdxToImageMap.size() << std::endl;
@@ -431,35 +436,65 @@ void MCDecoderICARUSTPCwROI::produce(art::Event & event, art::ProcessingFrame co
         event.put(std::move(rawDigitCollection), fOutInstanceLabelVec[instanceIdx]);
 
         // Do the same to output the candidate ROIs
-        WireCollectionPtr wireCollection = std::make_unique<std::vector<recob::Wire>>(std::move_iterator(concurrentROIs.begin()),
-                                                                                      std::move_iterator(concurrentROIs.end()));
+        WireCollectionPtr wireCollection = std::make_unique<std::vector<recob::Wire>>();
 
-        std::sort(wireCollection->begin(),wireCollection->end(),[](const auto& left, const auto& right){return left.Channel() < right.Channel();});
+        wireCollection->reserve(numSlots);
+
+        for(size_t slotIdx = 0; slotIdx < numSlots; slotIdx++)
+        {
+            if (channelSlotOutputs.slotFilledVec[slotIdx]) wireCollection->emplace_back(std::move(channelSlotOutputs.rois[slotIdx]));
+        }
+
+        // Distill the compact occupancy index from the candidate ROIs so that
+        // downstream consumers can skip the channels with no activity at all
+        std::unique_ptr<icarus::ChannelOccupancyIndex> occupancyIndex = std::make_unique<icarus::ChannelOccupancyIndex>();
+
+        for(const recob::Wire& wire : *wireCollection)
+        {
+            const recob::Wire::RegionsOfInterest_t& signalROI = wire.SignalROI();
+
+            if (signalROI.n_ranges() == 0) continue;
+
+            const auto& ranges = signalROI.get_ranges();
+
+            occupancyIndex->addChannel(wire.Channel(),
+                                       signalROI.n_ranges(),
+                                       ranges.front().begin_index(),
+                                       ranges.back().end_index());
+        }
 
         event.put(std::move(wireCollection), fOutInstanceLabelVec[instanceIdx]);
+
+        event.put(std::move(occupancyIndex), fOutInstanceLabelVec[instanceIdx]);
     
         if (fOutputRawWaveform)
         {
-            // Copy the raw digits from the concurrent vector to our output vector
-            RawDigitCollectionPtr rawRawDigitCollection = std::make_unique<std::vector<raw::RawDigit>>(std::move_iterator(concurrentRawRawDigits.begin()), 
-                                                                                                       std::move_iterator(concurrentRawRawDigits.end()));
-    
-            // Want the RawDigits to be sorted in channel order... has to be done somewhere so why not now?
-            std::sort(rawRawDigitCollection->begin(),rawRawDigitCollection->end(),[](const auto& left,const auto&right){return left.Channel() < right.Channel();});
-    
+            // Gather the pedestal corrected raw digits, again already in channel order
+            RawDigitCollectionPtr rawRawDigitCollection = std::make_unique<std::vector<raw::RawDigit>>();
+
+            rawRawDigitCollection->reserve(numSlots);
+
+            for(size_t slotIdx = 0; slotIdx < numSlots; slotIdx++)
+            {
+                if (channelSlotOutputs.slotFilledVec[slotIdx]) rawRawDigitCollection->emplace_back(std::move(channelSlotOutputs.rawRawDigits[slotIdx]));
+            }
+
             // Now transfer ownership to the event store
             event.put(std::move(rawRawDigitCollection),fOutInstanceLabelVec[instanceIdx] + fOutputRawWavePath);
         }
-    
+
         if (fOutputCorrection)
         {
-            // Copy the raw digits from the concurrent vector to our output vector
-            RawDigitCollectionPtr coherentCollection = std::make_unique<std::vector<raw::RawDigit>>(std::move_iterator(coherentRawDigits.begin()), 
-                                                                                                    std::move_iterator(coherentRawDigits.end()));
-    
-            // Want the RawDigits to be sorted in channel order... has to be done somewhere so why not now?
-            std::sort(coherentCollection->begin(),coherentCollection->end(),[](const auto& left,const auto&right){return left.Channel() < right.Channel();});
-    
+            // Gather the coherent correction vectors, again already in channel order
+            RawDigitCollectionPtr coherentCollection = std::make_unique<std::vector<raw::RawDigit>>();
+
+            coherentCollection->reserve(numSlots);
+
+            for(size_t slotIdx = 0; slotIdx < numSlots; slotIdx++)
+            {
+                if (channelSlotOutputs.slotFilledVec[slotIdx]) coherentCollection->emplace_back(std::move(channelSlotOutputs.coherentDigits[slotIdx]));
+            }
+
             // Now transfer ownership to the event store
             event.put(std::move(coherentCollection),fOutInstanceLabelVec[instanceIdx] + fOutputCoherentPath);
         }
@@ -481,10 +516,7 @@ void MCDecoderICARUSTPCwROI::processSingleLabel(art::Event&
                                                 detinfo::DetectorClocksData const& clockData,
                                                 ChannelArrayPairVec         const& channelArrayPairVec,
                                                 size_t                      const& coherentNoiseGrouping,
-                                                ConcurrentRawDigitCol&             concurrentRawDigits,
-                                                ConcurrentRawDigitCol&             concurrentRawRawDigits,
-                                                ConcurrentRawDigitCol&             coherentRawDigits,
-                                                ConcurrentWireCol&                 concurrentROIs) const
+                                                ChannelSlotOutputs&                outputs) const
 {
     cet::cpu_timer theClockProcess;
 
@@ -507,6 +539,19 @@ void MCDecoderICARUSTPCwROI::processSingleLabel(art::Event&
         // Sort (use a lambda to sort by channel id)
         std::sort(rawDigitVec.begin(),rawDigitVec.end(),[](const raw::RawDigit* left, const raw::RawDigit* right) {return left->Channel() < right->Channel();});
 
+        // Scatter index: the rank of each channel in the input (just sorted above)
+        // defines its output slot, so preallocate all the output collections now
+        outputs.channelToSlotMap.clear();
+
+        for(size_t idx = 0; idx < rawDigitVec.size(); idx++) outputs.channelToSlotMap[rawDigitVec[idx]->Channel()] = idx;
+
+        outputs.rawDigits.resize(rawDigitVec.size());
+        outputs.rois.resize(rawDigitVec.size());
+        outputs.slotFilledVec.assign(rawDigitVec.size(), 0);
+
+        if (fOutputRawWaveform) outputs.rawRawDigits.resize(rawDigitVec.size());
+        if (fOutputCorrection)  outputs.coherentDigits.resize(rawDigitVec.size());
+
         // Declare a temporary digit holder and resize it if downsizing the waveform
         unsigned int               dataSize = art::Ptr<raw::RawDigit>(digitVecHandle,0)->Samples(); //size of raw data vectors
         raw::RawDigit::ADCvector_t rawDataVec(dataSize);
@@ -565,7 +610,7 @@ void MCDecoderICARUSTPCwROI::processSingleLabel(art::Event&
 
             if (++boardWireCountMap[readoutBoardID] == MAXCHANNELS)
             {
-                processSingleImage(clockData, boardMapItr->second, coherentNoiseGrouping, concurrentRawDigits, concurrentRawRawDigits, coherentRawDigits, concurrentROIs);
+                processSingleImage(clockData, boardMapItr->second, coherentNoiseGrouping, outputs);
 
                 boardToChannelArrayPairMap.erase(boardMapItr);
 
@@ -598,7 +643,7 @@ void MCDecoderICARUSTPCwROI::processSingleLabel(art::Event&
         {
             if (boardWireCountMap[boardInfo.first] < 64)
             {
-                processSingleImage(clockData, boardInfo.second, boardWireCountMap[boardInfo.first], concurrentRawDigits, concurrentRawRawDigits, coherentRawDigits, concurrentROIs);
+                processSingleImage(clockData, boardInfo.second, boardWireCountMap[boardInfo.first], outputs);
             }
         }
 
@@ -616,10 +661,7 @@ void MCDecoderICARUSTPCwROI::processSingleLabel(art::Event&
 void MCDecoderICARUSTPCwROI::processSingleImage(const detinfo::DetectorClocksData& clockData,
                                                 const ChannelArrayPair&            channelArrayPair,
                                                 size_t                             coherentNoiseGrouping,
-                                                ConcurrentRawDigitCol&             concurrentRawDigitCol,
-                                                ConcurrentRawDigitCol&             concurrentRawRawDigitCol,
-                                                ConcurrentRawDigitCol&             coherentRawDigitCol,
-                                                ConcurrentWireCol&                 concurrentROIs) const
+                                                ChannelSlotOutputs&                outputs) const
 {
     // Let's go through and fill the output vector
     const daq::INoiseFilter::ChannelPlaneVec&   channelVec = channelArrayPair.first;
@@ -642,19 +684,27 @@ void MCDecoderICARUSTPCwROI::processSingleImage(const detinfo::DetectorClocksDat
     {
         // Skip if no channel data (plane is wrong)
         if (channelVec[chanIdx].second > 2) continue;
-        
+
         raw::ChannelID_t channel = channelVec[chanIdx].first;
 
+        // Scatter: recover the preallocated output slot for this channel
+        std::map<raw::ChannelID_t,size_t>::const_iterator slotItr = outputs.channelToSlotMap.find(channel);
+
+        if (slotItr == outputs.channelToSlotMap.end()) continue;
+
+        size_t slotIdx = slotItr->second;
+
         if (fOutputRawWaveform)
         {
             const icarus_signal_processing::VectorFloat& waveform = decoderTool->getPedCorWaveforms()[chanIdx];
 
             // Need to convert from float to short int
             std::transform(waveform.begin(),waveform.end(),wvfm.begin(),[](const auto& val){return short(std::round(val));});
- 
-            ConcurrentRawDigitCol::iterator newRawObjItr = concurrentRawRawDigitCol.emplace_back(channel,wvfm.size(),wvfm); 
 
-            newRawObjItr->SetPedestal(decoderTool->getPedestalVals()[chanIdx],decoderTool->getFullRMSVals()[chanIdx]);
+            raw::RawDigit& rawRawDigit = outputs.rawRawDigits[slotIdx];
+
+            rawRawDigit = raw::RawDigit(channel,wvfm.size(),wvfm);
+            rawRawDigit.SetPedestal(decoderTool->getPedestalVals()[chanIdx],decoderTool->getFullRMSVals()[chanIdx]);
         }
 
         if (fOutputCorrection)
@@ -664,10 +714,10 @@ void MCDecoderICARUSTPCwROI::processSingleImage(const detinfo::DetectorClocksDat
             // Need to convert from float to short int
             std::transform(corrections.begin(),corrections.end(),wvfm.begin(),[](const auto& val){return short(std::round(val));});
 
-            //ConcurrentRawDigitCol::iterator newRawObjItr = coherentRawDigitCol.emplace_back(channel,wvfm.size(),wvfm); 
-            ConcurrentRawDigitCol::iterator newRawObjItr = coherentRawDigitCol.push_back(raw::RawDigit(channel,wvfm.size(),wvfm)); 
+            raw::RawDigit& coherentDigit = outputs.coherentDigits[slotIdx];
 
-            newRawObjItr->SetPedestal(0.,0.);
+            coherentDigit = raw::RawDigit(channel,wvfm.size(),wvfm);
+            coherentDigit.SetPedestal(0.,0.);
         }
 
         // Recover the denoised waveform
@@ -676,9 +726,10 @@ void MCDecoderICARUSTPCwROI::processSingleImage(const detinfo::DetectorClocksDat
         // Need to convert from float to short int
         std::transform(denoised.begin(),denoised.end(),wvfm.begin(),[](const auto& val){return short(std::round(val));});
 
-        ConcurrentRawDigitCol::iterator newObjItr = concurrentRawDigitCol.emplace_back(channel,wvfm.size(),wvfm); 
+        raw::RawDigit& rawDigit = outputs.rawDigits[slotIdx];
 
-        newObjItr->SetPedestal(0.,decoderTool->getTruncRMSVals()[chanIdx]);
+        rawDigit = raw::RawDigit(channel,wvfm.size(),wvfm);
+        rawDigit.SetPedestal(0.,decoderTool->getTruncRMSVals()[chanIdx]);
 
         // And, finally, the ROIs 
         const icarus_signal_processing::VectorBool& chanROIs = decoderTool->getROIVals()[chanIdx];
@@ -703,7 +754,9 @@ void MCDecoderICARUSTPCwROI::processSingleImage(const detinfo::DetectorClocksDat
             roiIdx++;
         }
 
-        concurrentROIs.push_back(recob::WireCreator(std::move(ROIVec),channel,fGeometry->View(channel)).move());
+        outputs.rois[slotIdx] = recob::WireCreator(std::move(ROIVec),channel,fGeometry->View(channel)).move();
+
+        outputs.slotFilledVec[slotIdx] = 1;
     }//loop over channel indices
 
     return;
@@ -259,7 +259,12 @@ class icarus::simfilter::FilterNeutrinosActiveVolume: public art::EDFilter {
     
     /// Volumes for qualifying interactions.
     std::vector<geo::BoxBoundedGeo> fVolumes;
-    
+
+    /// Bounds of `fVolumes` flattened into coordinate arrays for batch tests.
+    struct {
+      std::vector<double> minX, maxX, minY, maxY, minZ, maxZ;
+    } fVolumeBounds;
+
     /// List of qualifying interaction types.
     std::vector<int> const fInteractions;
     
@@ -286,9 +291,13 @@ class icarus::simfilter::FilterNeutrinosActiveVolume: public art::EDFilter {
     
     /// Adds all `volName` from geometry into the qualifying volume list.
     unsigned addVolumeByName(std::string const& volumeName);
-    
-    
-    /// Returns whether the interaction described in `truth` qualifies.
+
+    /// Flattens the bounds of `fVolumes` into `fVolumeBounds`.
+    void flattenVolumes();
+
+
+    /// Returns whether the interaction described in `truth` qualifies
+    /// (all requirements except the location one).
     bool qualifying(simb::MCTruth const& truth) const;
     
     /// Returns whether the interaction type is qualifying.
@@ -297,8 +306,10 @@ class icarus::simfilter::FilterNeutrinosActiveVolume: public art::EDFilter {
     /// Returns whether the weak current type is qualifying.
     bool qualifyingWeakCurrent(int const CCNC) const;
     
-    /// Returns whether the location is among the accepted ones.
-    bool qualifyingLocation(geo::Point_t const& location) const;
+    /// Returns the index of the first of `locations` inside an accepted
+    /// volume, or the size of `locations` if none is.
+    std::size_t firstQualifyingLocation
+      (std::vector<geo::Point_t> const& locations) const;
     
     
     /// Returns a sorted copy of the specified collection.
@@ -348,7 +359,9 @@ icarus::simfilter::FilterNeutrinosActiveVolume::FilterNeutrinosActiveVolume
   
   for (std::string const& volName: config().volumeNames())
     addVolumeByName(volName);
-  
+
+  flattenVolumes();
+
   //
   // check that we are doing at least something
   //
@@ -387,26 +400,42 @@ bool icarus::simfilter::FilterNeutrinosActiveVolume::filter(art::Event& event) {
   mf::LogDebug(fLogCategory)
     << "Event " << event.id() << " (#" << fNObserved << ") has "
     << allTruth.size() << " truth data products.";
-  
+
+  /*
+   * Records are screened on interaction and current type as they are read;
+   * the vertices of the surviving ones are collected and then tested against
+   * all the qualifying volumes in a single batch at the end.
+   */
+  std::vector<geo::Point_t> vertices;
+  std::vector<std::pair<art::InputTag, std::size_t>> vertexSources; // parallel
+
   for (auto const& handle: allTruth) {
-    
+
     art::InputTag const& tag [[gnu::unused]] = handle.provenance()->inputTag();
-    
+
     std::vector<simb::MCTruth> const& truths = *handle;
     if (truths.empty()) {
       mf::LogTrace(fLogCategory)
         << "No truth records from " << tag.encode() << ": skipped.";
       continue;
     } // if no truth
-    
+
     for (auto const& [ iTruth, truth ]: util::enumerate(truths)) {
-      
+
       mf::LogTrace(fLogCategory)
         << "Processing record [" << (iTruth + 1U) << "/" << truths.size()
         << "] from " << tag.encode();
-      
+
       if (!qualifying(truth)) continue; // neeext!
-      
+
+      if (!fVolumes.empty()) {
+        // the location requirement is still pending: queued for the batch test
+        simb::MCParticle const& nu = truth.GetNeutrino().Nu();
+        vertices.push_back({ nu.Vx(), nu.Vy(), nu.Vz() });
+        vertexSources.emplace_back(tag, iTruth);
+        continue;
+      }
+
       ++fNPassed;
       mf::LogTrace(fLogCategory) << "Event " << event.id()
         << " (#" << fNObserved << ") passes the filter in virtue of "
@@ -414,15 +443,29 @@ bool icarus::simfilter::FilterNeutrinosActiveVolume::filter(art::Event& event) {
         << " (" << fNPassed << "/" << fNObserved << " passed so far)."
         ;
       return true;
-      
+
     } // for truth record
-    
+
   } // for truth data product
-  
+
+  if (std::size_t const iVertex = firstQualifyingLocation(vertices);
+    iVertex < vertices.size()
+  ) {
+    auto const& [ tag, iTruth ] = vertexSources[iVertex];
+    ++fNPassed;
+    mf::LogTrace(fLogCategory) << "Event " << event.id()
+      << " (#" << fNObserved << ") passes the filter in virtue of "
+      << tag.encode() << " record " << (iTruth + 1U)
+      << " at " << vertices[iVertex] << " cm"
+      << " (" << fNPassed << "/" << fNObserved << " passed so far)."
+      ;
+    return true;
+  }
+
   mf::LogTrace(fLogCategory) << "Event " << event.id() << " (#" << fNObserved
     << ")  does not pass the filter (" << fNPassed << "/" << fNObserved
     << " passed so far).";
-  
+
   return false;
   
 } // icarus::simfilter::FilterNeutrinosActiveVolume::filter()
@@ -580,10 +623,11 @@ bool icarus::simfilter::FilterNeutrinosActiveVolume::qualifying
    * Apply all the needed cuts:
    * * interaction type
    * * current type
-   * * location
-   * 
+   *
+   * The location cut is applied separately (`firstQualifyingLocation()`),
+   * batched over all the records of the event at once.
    */
-  
+
   //
   // only neutrino record types may qualify:
   //
@@ -592,28 +636,21 @@ bool icarus::simfilter::FilterNeutrinosActiveVolume::qualifying
       << "Interaction does not qualify because it is not tagged as neutrino.";
     return false;
   }
-  
+
   simb::MCNeutrino const& nuInfo = truth.GetNeutrino();
-  simb::MCParticle const& nu = nuInfo.Nu();
-  
+
   //
   // interaction type
   //
   if (!fInteractions.empty() && !qualifyingInteractionType(nuInfo.InteractionType()))
     return false;
-  
+
   //
   // current type
   //
   if ((fWeakCurrentType != icarus::AnyWeakCurrentType) && !qualifyingWeakCurrent(nuInfo.CCNC()))
     return false;
-  
-  //
-  // location
-  //
-  if (!fVolumes.empty() && !qualifyingLocation({ nu.Vx(), nu.Vy(), nu.Vz() }))
-    return false;
-  
+
   // success, after all
   return true;
   
@@ -662,26 +699,57 @@ bool icarus::simfilter::FilterNeutrinosActiveVolume::qualifyingWeakCurrent
 
 
 // -----------------------------------------------------------------------------
-bool icarus::simfilter::FilterNeutrinosActiveVolume::qualifyingLocation
-  (geo::Point_t const& location) const
+void icarus::simfilter::FilterNeutrinosActiveVolume::flattenVolumes() {
+
+  fVolumeBounds.minX.reserve(fVolumes.size());
+  fVolumeBounds.maxX.reserve(fVolumes.size());
+  fVolumeBounds.minY.reserve(fVolumes.size());
+  fVolumeBounds.maxY.reserve(fVolumes.size());
+  fVolumeBounds.minZ.reserve(fVolumes.size());
+  fVolumeBounds.maxZ.reserve(fVolumes.size());
+
+  for (geo::BoxBoundedGeo const& box: fVolumes) {
+    fVolumeBounds.minX.push_back(box.MinX());
+    fVolumeBounds.maxX.push_back(box.MaxX());
+    fVolumeBounds.minY.push_back(box.MinY());
+    fVolumeBounds.maxY.push_back(box.MaxY());
+    fVolumeBounds.minZ.push_back(box.MinZ());
+    fVolumeBounds.maxZ.push_back(box.MaxZ());
+  } // for volumes
+
+} // icarus::simfilter::FilterNeutrinosActiveVolume::flattenVolumes()
+
+
+// -----------------------------------------------------------------------------
+std::size_t
+icarus::simfilter::FilterNeutrinosActiveVolume::firstQualifyingLocation
+  (std::vector<geo::Point_t> const& locations) const
 {
-  
-  mf::LogTrace log(fLogCategory);
-  log << "Interaction location: " << location << " cm";
-  
-  for (auto const& [ iBox, box ]: util::enumerate(fVolumes)) {
-    if (!box.ContainsPosition(location)) continue;
-    
-    log << " => in volume #" << iBox
-      << " [ " << box.Min() << " -- " << box.Max() << " ] => :-)";
-    
-    return true;
-  } // for
-  
-  log << " => :-(";
-  return false;
-  
-} // icarus::simfilter::FilterNeutrinosActiveVolume::qualifyingLocation()
+
+  auto const& bounds = fVolumeBounds;
+  std::size_t first = locations.size();
+
+  /*
+   * Volume-major sweep: the six bounds of one volume stay in registers while
+   * the locations stream through as plain coordinate comparisons; only the
+   * locations before the best match so far need to be looked at.
+   * The event passes on any match, so `first` only decides which record is
+   * credited in the trace output (the earliest, as before).
+   */
+  for (std::size_t iVol = 0U; iVol < bounds.minX.size(); ++iVol) {
+    for (std::size_t i = 0U; i < first; ++i) {
+      geo::Point_t const& p = locations[i];
+      if ((p.X() < bounds.minX[iVol]) || (p.X() > bounds.maxX[iVol])) continue;
+      if ((p.Y() < bounds.minY[iVol]) || (p.Y() > bounds.maxY[iVol])) continue;
+      if ((p.Z() < bounds.minZ[iVol]) || (p.Z() > bounds.maxZ[iVol])) continue;
+      first = i;
+      break;
+    } // for locations
+  } // for volumes
+
+  return first;
+
+} // icarus::simfilter::FilterNeutrinosActiveVolume::firstQualifyingLocation()
 
 
 // -----------------------------------------------------------------------------
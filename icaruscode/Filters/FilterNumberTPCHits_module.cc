@@ -14,6 +14,8 @@
 #include "messagefacility/MessageLogger/MessageLogger.h"
 #include "lardataobj/RecoBase/Hit.h"
 
+#include "icaruscode/IcarusObj/CollectionSizeSummary.h"
+
 ///filters for events, etc
 namespace filter
 {
@@ -29,6 +31,7 @@ namespace filter
     private:
         std::vector<art::InputTag> fHitDataLabelVec;
         unsigned int               fMaximumHits;
+        art::InputTag              fSizeSummaryLabel;     ///< if set, try counts from this summary before reading hits
 
     }; //class FilterNumberTPCHits
 }
@@ -38,8 +41,9 @@ namespace filter
 filter::FilterNumberTPCHits::FilterNumberTPCHits(fhicl::ParameterSet const &pset)
     : EDFilter{pset}
 {
-    fHitDataLabelVec = pset.get<std::vector<art::InputTag>>("HitDataLabelVec",    {""});
-    fMaximumHits     = pset.get<unsigned int              >("MaximumHits",     800000u);
+    fHitDataLabelVec  = pset.get<std::vector<art::InputTag>>("HitDataLabelVec",    {""});
+    fMaximumHits      = pset.get<unsigned int              >("MaximumHits",     800000u);
+    fSizeSummaryLabel = pset.get<art::InputTag             >("SizeSummaryLabel",     "");
 
     return;
 }
@@ -48,17 +52,32 @@ bool filter::FilterNumberTPCHits::filter(art::Event &event)
 {
     bool filterPass = true;
 
+    // If a size summary was produced upstream it gives us the hit counts for
+    // the price of a few bytes of I/O, sparing the read of the hit collections
+    const icarus::CollectionSizeSummary* sizeSummary(nullptr);
+
+    if (!fSizeSummaryLabel.empty())
+    {
+        art::Handle<icarus::CollectionSizeSummary> summaryHandle;
+
+        if (event.getByLabel(fSizeSummaryLabel, summaryHandle)) sizeSummary = summaryHandle.product();
+    }
+
     for(auto const& hitDataLabel : fHitDataLabelVec)
     {
-       auto const& hitData = event.getProduct<std::vector<recob::Hit>>(hitDataLabel);
+        long long int numHits = sizeSummary ? sizeSummary->entriesFor(hitDataLabel.encode()) : icarus::CollectionSizeSummary::Unknown;
+
+        // Fall back to reading the collection when the summary does not cover it
+        if (numHits == icarus::CollectionSizeSummary::Unknown)
+            numHits = event.getProduct<std::vector<recob::Hit>>(hitDataLabel).size();
 
-//       std::cout << "FilterNumberTPCHits: label: " << hitDataLabel << " has " << hitData.size() << " hits (rejection is " << fMaximumHits << ")" << std::endl;
+//       std::cout << "FilterNumberTPCHits: label: " << hitDataLabel << " has " << numHits << " hits (rejection is " << fMaximumHits << ")" << std::endl;
 
-        if (hitData.size() > fMaximumHits)
+        if (numHits > fMaximumHits)
         {
             mf::LogInfo log("FilterNumberTPCHits");
-            log << "******************************************************\n" << "Rejecting event for " 
-                << "***** " << hitDataLabel << " with " << hitData.size() << " hits ******\n"
+            log << "******************************************************\n" << "Rejecting event for "
+                << "***** " << hitDataLabel << " with " << numHits << " hits ******\n"
                 << "******************************************************";
 
             filterPass = false;
@@ -17,6 +17,7 @@
 #include "fhiclcpp/ParameterSet.h"
 #include "messagefacility/MessageLogger/MessageLogger.h"
 #include "lardataobj/RecoBase/OpFlash.h"
+#include "icaruscode/IcarusObj/CollectionSizeSummary.h"
 #include <memory>
 
 class FilterOpFlash;
@@ -34,6 +35,7 @@ public:
 
 private:
   std::vector<std::string> _flash_producer_v;
+  art::InputTag _size_summary_label; ///< if set, empty flash collections are skipped without being read
   double _time_start;
   double _time_end;
   double _pe_threshold;
@@ -44,6 +46,7 @@ FilterOpFlash::FilterOpFlash(fhicl::ParameterSet const& p)
   : EDFilter{p}
 {
   _flash_producer_v = p.get<std::vector<std::string> >("OpFlashProducerList");
+  _size_summary_label = p.get<art::InputTag>("SizeSummaryLabel","");
   _time_start = p.get<double>("WindowStartTime");
   _time_end   = p.get<double>("WindowEndTime");
   _pe_threshold = p.get<double>("FlashPEThreshold",-1);
@@ -54,8 +57,21 @@ bool FilterOpFlash::filter(art::Event& e)
 {
 
   bool pass = false;
+
+  // The flash selection needs PE and time of each flash, so the collections
+  // must be read; but a size summary produced upstream lets us skip the ones
+  // that are empty without paying for their deserialization
+  const icarus::CollectionSizeSummary* size_summary(nullptr);
+
+  if(!_size_summary_label.empty()) {
+    art::Handle<icarus::CollectionSizeSummary> summary_handle;
+    if(e.getByLabel(_size_summary_label, summary_handle)) size_summary = summary_handle.product();
+  }
+
   for(auto const& producer : _flash_producer_v) {
-    
+
+    if(size_summary && size_summary->entriesFor(art::InputTag(producer).encode()) == 0) continue;
+
     art::Handle<std::vector<recob::OpFlash> > flash_handle;
     e.getByLabel(producer, flash_handle);
     if(!flash_handle.isValid()) {
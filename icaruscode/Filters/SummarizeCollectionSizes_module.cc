@@ -0,0 +1,77 @@
+////////////////////////////////////////////////////////////////////////
+//
+// SummarizeCollectionSizes class
+//
+// Records the entry counts of selected hit and flash collections into a
+// tiny icarus::CollectionSizeSummary data product. Run at production
+// time, when the collections are in memory anyway, it lets downstream
+// skimming filters (FilterNumberTPCHits, FilterOpFlash) threshold on
+// the counts without ever deserializing the collections themselves.
+//
+////////////////////////////////////////////////////////////////////////
+
+/// Framework includes
+#include "art/Framework/Core/ModuleMacros.h"
+#include "art/Framework/Core/EDProducer.h"
+#include "art/Framework/Principal/Event.h"
+#include "canvas/Utilities/InputTag.h"
+#include "fhiclcpp/ParameterSet.h"
+#include "lardataobj/RecoBase/Hit.h"
+#include "lardataobj/RecoBase/OpFlash.h"
+
+#include "icaruscode/IcarusObj/CollectionSizeSummary.h"
+
+#include <memory>
+
+namespace filter
+{
+
+    class SummarizeCollectionSizes : public art::EDProducer
+    {
+
+    public:
+        explicit SummarizeCollectionSizes(fhicl::ParameterSet const &);
+
+        void produce(art::Event &evt) override;
+
+    private:
+        std::vector<art::InputTag> fHitLabelVec;
+        std::vector<art::InputTag> fFlashLabelVec;
+
+    }; //class SummarizeCollectionSizes
+}
+
+///////////////////////////////////////////////////////
+
+filter::SummarizeCollectionSizes::SummarizeCollectionSizes(fhicl::ParameterSet const &pset)
+    : EDProducer{pset}
+{
+    fHitLabelVec   = pset.get<std::vector<art::InputTag>>("HitLabelVec",   {});
+    fFlashLabelVec = pset.get<std::vector<art::InputTag>>("FlashLabelVec", {});
+
+    produces<icarus::CollectionSizeSummary>();
+
+    return;
+}
+
+void filter::SummarizeCollectionSizes::produce(art::Event &event)
+{
+    auto summary = std::make_unique<icarus::CollectionSizeSummary>();
+
+    for(auto const& hitLabel : fHitLabelVec)
+        summary->add(hitLabel.encode(), event.getProduct<std::vector<recob::Hit>>(hitLabel).size());
+
+    for(auto const& flashLabel : fFlashLabelVec)
+        summary->add(flashLabel.encode(), event.getProduct<std::vector<recob::OpFlash>>(flashLabel).size());
+
+    event.put(std::move(summary));
+
+    return;
+}
+
+namespace filter
+{
+
+    DEFINE_ART_MODULE(SummarizeCollectionSizes)
+
+} //namespace filter
@@ -14,6 +14,7 @@
 #include "messagefacility/MessageLogger/MessageLogger.h"
 #include "lardataobj/RawData/TriggerData.h" // raw::Trigger
 #include "icaruscode/Decode/BeamBits.h"
+#include "icaruscode/Decode/DataProducts/TriggerClassification.h"
 
 ///filters for events, etc
 namespace filter
@@ -31,6 +32,7 @@ namespace filter
         art::InputTag fTriggerDataLabel;
         std::string   fTriggerType;
         unsigned int  fTriggerBits;
+        int           fGateType;
 
     }; //class TriggerTypeFilter
 }
@@ -45,12 +47,19 @@ filter::TriggerTypeFilter::TriggerTypeFilter(fhicl::ParameterSet const &pset)
 
     std::cout << "****> Initializing trigger type " << fTriggerType << std::endl;
 
+    fGateType = icarus::TriggerClassification::Unknown;
+
     if (fTriggerType == "BNB")            fTriggerBits = value(sbn::triggerSource::BNB);
     if (fTriggerType == "NuMI")           fTriggerBits = value(sbn::triggerSource::NuMI);
     if (fTriggerType == "OffbeamBNB")     fTriggerBits = value(sbn::triggerSource::OffbeamBNB);
     if (fTriggerType == "OffbeamNuMI")    fTriggerBits = value(sbn::triggerSource::OffbeamNuMI);
     if (fTriggerType == "Unknown")        fTriggerBits = value(sbn::triggerSource::Unknown);
 
+    if (fTriggerType == "BNB")            fGateType = icarus::TriggerClassification::BNB;
+    if (fTriggerType == "NuMI")           fGateType = icarus::TriggerClassification::NuMI;
+    if (fTriggerType == "OffbeamBNB")     fGateType = icarus::TriggerClassification::OffbeamBNB;
+    if (fTriggerType == "OffbeamNuMI")    fGateType = icarus::TriggerClassification::OffbeamNuMI;
+
     return;
 }
 
@@ -58,6 +67,22 @@ bool filter::TriggerTypeFilter::filter(art::Event &event)
 {
     bool filterPass = false;
 
+    // the one-word trigger type tag from the trigger decoder is enough to
+    // decide: reading it spares deserializing the full trigger record
+    auto tagHandle = event.getHandle<icarus::TriggerClassification>(fTriggerDataLabel);
+
+    if (tagHandle.isValid() && tagHandle->isValid())
+    {
+        if (tagHandle->gateType == fGateType)
+        {
+            std::cout << "***> Trigger type matched, type is " << fTriggerType << ", " << fGateType << std::endl;
+            filterPass = true;
+        }
+
+        return filterPass;
+    }
+
+    // no (valid) tag available: fall back to the full trigger record
     auto const& triggerVec = event.getProduct<std::vector<raw::Trigger>>(fTriggerDataLabel);
 
     if (!triggerVec.empty())
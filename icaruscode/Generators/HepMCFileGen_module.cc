@@ -107,11 +107,16 @@ public:
   void endSubRun(art::SubRun& sr)     override;
 private:
   std::ifstream open_file();
+  void skipToEvent(long long iEvent);
   std::string fInputFilePath; ///< Path to the HEPMC input file, relative to `FW_SEARCH_PATH`.
+  std::string fFullFileName;  ///< Resolved path of the opened input file.
   std::ifstream* fInputFile;
-  
+
   double         fEventsPerPOT;     ///< Number of events per POT (to be set)
   int            fEventsPerSubRun;  ///< Keeps track of the number of processed events per subrun
+  long long      fFirstEvent;       ///< Number of events at the start of the file to skip over
+  std::vector<long long> fEventOffsets; ///< Byte offset of each event record in the input file
+  std::vector<char> fReadBuffer;    ///< Large block buffer for the input stream
   // ifdh_ns::ifdh* fIFDH;             ///< (optional) flux file handling
 };
 //------------------------------------------------------------------------------
@@ -121,6 +126,7 @@ evgen::HepMCFileGen::HepMCFileGen(fhicl::ParameterSet const & p)
   , fInputFile(nullptr)
   , fEventsPerPOT{p.get<double>("EventsPerPOT", -1.)}
   , fEventsPerSubRun(0)
+  , fFirstEvent{p.get<long long>("FirstEvent", 0)}
 {
   produces< std::vector<simb::MCTruth>   >();
   produces< sumdata::RunData, art::InRun >();
@@ -159,12 +165,20 @@ std::ifstream evgen::HepMCFileGen::open_file()
   }
   
   //
-  // attempt to open
+  // attempt to open; a large block buffer is attached first, so that the
+  // parsing reads the text file a megabyte at a time instead of in the tiny
+  // default chunks
   //
   mf::LogDebug("HepMCFileGen")
     << "Reading input file '" << fInputFilePath << "' as:\n" << fullFileName;
-  std::ifstream inputFile(fullFileName);
-  if (inputFile) return inputFile;
+  if (fReadBuffer.empty()) fReadBuffer.resize(1048576);
+  std::ifstream inputFile;
+  inputFile.rdbuf()->pubsetbuf(fReadBuffer.data(), fReadBuffer.size());
+  inputFile.open(fullFileName);
+  if (inputFile) {
+    fFullFileName = fullFileName;
+    return inputFile;
+  }
   
   // all attempts failed, give up:
   throw cet::exception("HepMCFileGen")
@@ -178,7 +192,71 @@ std::ifstream evgen::HepMCFileGen::open_file()
 void evgen::HepMCFileGen::beginJob()
 {
   fInputFile = new std::ifstream(open_file());
-  
+
+  // jump straight to the first assigned event, via the offset index sidecar
+  if (fFirstEvent > 0) skipToEvent(fFirstEvent);
+
+}
+//------------------------------------------------------------------------------
+void evgen::HepMCFileGen::skipToEvent(long long iEvent)
+{
+  /*
+   * The byte offset of each event record is kept in a sidecar file next to
+   * the input file (`<input>.idx`, one offset per line). If the sidecar is
+   * there, seeking to any event is a single read and a seek; if it is not,
+   * the input file is scanned once (buffered, without parsing the particle
+   * lines) to build the index, and the sidecar is left behind for the next
+   * job if the input area is writable.
+   */
+  std::string const indexFileName = fFullFileName + ".idx";
+
+  std::ifstream indexFile(indexFileName);
+  if (indexFile) {
+    long long offset;
+    while (indexFile >> offset) fEventOffsets.push_back(offset);
+    mf::LogDebug("HepMCFileGen") << "Read offsets of " << fEventOffsets.size()
+      << " events from '" << indexFileName << "'";
+  }
+  else {
+    mf::LogInfo("HepMCFileGen") << "No index sidecar for '" << fFullFileName
+      << "': scanning the input file to build one.";
+
+    std::string oneLine;
+    while (true) {
+      long long const offset = fInputFile->tellg();
+      if (!std::getline(*fInputFile, oneLine)) break;
+      int event = 0;
+      unsigned long nParticles = 0;
+      std::istringstream header(oneLine);
+      header >> event >> nParticles;
+      fEventOffsets.push_back(offset);
+      // the particle lines are skipped, not parsed
+      for (unsigned long i = 0; i < nParticles; ++i)
+        std::getline(*fInputFile, oneLine);
+    }
+    fInputFile->clear(); // recover from the end-of-file state
+
+    // best effort: the input area may be read only
+    std::ofstream indexOut(indexFileName);
+    if (indexOut) {
+      for (long long const offset : fEventOffsets) indexOut << offset << "\n";
+      mf::LogInfo("HepMCFileGen") << "Wrote offsets of " << fEventOffsets.size()
+        << " events into '" << indexFileName << "'";
+    }
+    else {
+      mf::LogDebug("HepMCFileGen")
+        << "Could not write the index sidecar '" << indexFileName << "'";
+    }
+  }
+
+  if (iEvent >= (long long) fEventOffsets.size()) {
+    throw cet::exception("HepMCFileGen")
+      << "FirstEvent (" << iEvent << ") is beyond the " << fEventOffsets.size()
+      << " events of input file '" << fFullFileName << "'.\n";
+  }
+
+  fInputFile->seekg(fEventOffsets[iEvent]);
+
 }
 //------------------------------------------------------------------------------
 void evgen::HepMCFileGen::beginRun(art::Run& run)
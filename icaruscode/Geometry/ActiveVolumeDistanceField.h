@@ -0,0 +1,160 @@
+/**
+ * @file   icaruscode/Geometry/ActiveVolumeDistanceField.h
+ * @brief  Service with a precomputed signed distance field of the TPC active
+ *         volumes.
+ * @see    icaruscode/Geometry/ActiveVolumeDistanceField_service.cc
+ */
+
+#ifndef ICARUSCODE_GEOMETRY_ACTIVEVOLUMEDISTANCEFIELD_H
+#define ICARUSCODE_GEOMETRY_ACTIVEVOLUMEDISTANCEFIELD_H
+
+
+// LArSoft libraries
+#include "larcoreobj/SimpleTypesAndConstants/geo_vectors.h" // geo::Point_t
+
+// framework libraries
+#include "art/Framework/Services/Registry/ServiceDeclarationMacros.h"
+
+// C/C++ standard libraries
+#include <array>
+#include <cstddef> // std::size_t
+#include <string>
+#include <vector>
+
+
+// -----------------------------------------------------------------------------
+// forward declarations
+namespace art { class ActivityRegistry; }
+namespace fhicl { class ParameterSet; }
+
+// -----------------------------------------------------------------------------
+namespace icarus { class ActiveVolumeDistanceField; }
+/**
+ * @brief Fast containment and distance-to-boundary queries on active volumes.
+ *
+ * Several modules repeatedly test simulated trajectory points for containment
+ * in the TPC active volumes, each of them navigating the ROOT geometry point
+ * by point (or rebuilding the active volume boxes over and over). This service
+ * samples, once per job, the signed distance to the boundary of the union of
+ * all the TPC active volumes on a coarse regular grid; queries then reduce to
+ * a trilinear interpolation, falling back to the exact (and still cheap)
+ * axis-aligned box computation only within one voxel of a boundary, so that
+ * `isContained()` answers are exact.
+ *
+ * The distance is in centimeters, positive inside an active volume and
+ * negative outside; points outside the sampled grid are evaluated exactly.
+ *
+ * If a cache file is configured, the sampled field is written there the first
+ * time and memory-mapped read-only afterwards, so concurrent jobs on the same
+ * node share a single physical copy of the grid. A cache not matching the
+ * current geometry and voxel size is transparently rebuilt.
+ *
+ * Configuration parameters
+ * -------------------------
+ *
+ * * `VoxelSize` (real, default: `10.0`): grid spacing, in centimeters;
+ * * `CacheFile` (string, default: empty): path of the field cache; if empty,
+ *     the field is kept in private memory and rebuilt by each job;
+ * * `LogCategory` (string, default: `ActiveVolumeDistanceField`): name of the
+ *     message stream.
+ */
+class icarus::ActiveVolumeDistanceField {
+
+    public:
+
+  ActiveVolumeDistanceField
+    (fhicl::ParameterSet const& pset, art::ActivityRegistry& reg);
+
+  ~ActiveVolumeDistanceField();
+
+  // not copyable nor movable (may own a memory mapping)
+  ActiveVolumeDistanceField(ActiveVolumeDistanceField const&) = delete;
+  ActiveVolumeDistanceField& operator= (ActiveVolumeDistanceField const&)
+    = delete;
+
+
+  // --- BEGIN -- Queries ------------------------------------------------------
+  /// @name Queries
+  /// @{
+
+  /// Returns the signed distance [cm] of `point` from the closest active
+  /// volume boundary: positive inside, negative outside.
+  double distance(geo::Point_t const& point) const;
+
+  /// Fills `dist` with the signed distance of each of the `points` (batched
+  /// version of `distance()`).
+  void distances
+    (std::vector<geo::Point_t> const& points, std::vector<float>& dist) const;
+
+  //@{
+  /// Returns whether `point` is inside any TPC active volume (exact).
+  bool isContained(geo::Point_t const& point) const;
+  bool isContained(double x, double y, double z) const
+    { return isContained(geo::Point_t{ x, y, z }); }
+  //@}
+
+  /// @}
+  // --- END -- Queries --------------------------------------------------------
+
+
+    private:
+
+  /// An axis-aligned box (one TPC active volume).
+  struct Box_t {
+    std::array<double, 3U> min;
+    std::array<double, 3U> max;
+  }; // struct Box_t
+
+  // --- BEGIN -- Configuration ------------------------------------------------
+
+  double const fVoxelSize; ///< Grid spacing [cm].
+
+  std::string const fCacheFile; ///< Path of the field cache (empty: no cache).
+
+  std::string const fLogCategory; ///< Category for messages.
+
+  // --- END -- Configuration --------------------------------------------------
+
+  std::vector<Box_t> fBoxes; ///< Active volume boxes, for exact evaluation.
+
+  std::array<double, 3U> fOrigin; ///< Position of grid node (0,0,0) [cm].
+
+  std::array<std::size_t, 3U> fNodes; ///< Number of grid nodes per axis.
+
+  std::vector<float> fStorage; ///< Field samples (when not memory-mapped).
+
+  float const* fField = nullptr; ///< Field samples being used for queries.
+
+  void* fMapped = nullptr; ///< Memory-mapped cache region (if any).
+  std::size_t fMappedSize = 0U; ///< Size of the mapped region.
+
+
+  /// Collects the active volume boxes and sets the grid extent.
+  void buildGrid();
+
+  /// Points `fField` to the cached field, sampling it first if needed.
+  void acquireField();
+
+  /// Samples the distance field on all the grid nodes.
+  std::vector<float> sampleField() const;
+
+  /// Maps `fCacheFile` read-only; returns whether the cache was usable.
+  bool mapCacheFile();
+
+  /// Writes the sampled `field` into `fCacheFile` (best effort).
+  void writeCacheFile(std::vector<float> const& field) const;
+
+  /// Exact signed distance of `point` from the closest active volume boundary.
+  double exactDistance(geo::Point_t const& point) const;
+
+  /// Returns the field sample on the grid node (`ix`, `iy`, `iz`).
+  float node(std::size_t ix, std::size_t iy, std::size_t iz) const
+    { return fField[(ix * fNodes[1] + iy) * fNodes[2] + iz]; }
+
+}; // class icarus::ActiveVolumeDistanceField
+
+
+DECLARE_ART_SERVICE(icarus::ActiveVolumeDistanceField, SHARED)
+
+
+#endif // ICARUSCODE_GEOMETRY_ACTIVEVOLUMEDISTANCEFIELD_H
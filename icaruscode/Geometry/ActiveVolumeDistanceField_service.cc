@@ -0,0 +1,331 @@
+/**
+ * @file   icaruscode/Geometry/ActiveVolumeDistanceField_service.cc
+ * @brief  Precomputed active volume distance field (implementation file).
+ * @see    icaruscode/Geometry/ActiveVolumeDistanceField.h
+ */
+
+// library header
+#include "icaruscode/Geometry/ActiveVolumeDistanceField.h"
+
+// LArSoft libraries
+#include "larcore/Geometry/Geometry.h"
+#include "larcorealg/Geometry/TPCGeo.h"
+#include "larcorealg/Geometry/BoxBoundedGeo.h"
+
+// framework libraries
+#include "art/Framework/Services/Registry/ServiceDefinitionMacros.h"
+#include "art/Framework/Services/Registry/ServiceHandle.h"
+#include "messagefacility/MessageLogger/MessageLogger.h"
+#include "fhiclcpp/ParameterSet.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::min(), std::max(), std::clamp()
+#include <cmath> // std::sqrt(), std::floor(), std::ceil(), std::abs()
+#include <cstdint> // std::uint64_t
+#include <cstring> // std::memcpy()
+#include <fstream>
+#include <limits>
+
+// POSIX libraries (for the memory-mapped cache)
+#include <fcntl.h> // open()
+#include <sys/mman.h> // mmap(), munmap()
+#include <sys/stat.h> // fstat()
+#include <unistd.h> // close()
+
+
+// -----------------------------------------------------------------------------
+namespace {
+
+  /// Header of the field cache file; the grid parameters are derived from the
+  /// geometry, so a match guarantees the cached samples are current.
+  struct CacheHeader_t {
+    char magic[8]; // cache format tag
+    std::uint64_t nodes[3]; // grid nodes per axis
+    double origin[3]; // position of grid node (0,0,0) [cm]
+    double voxelSize; // grid spacing [cm]
+  }; // struct CacheHeader_t
+
+  constexpr char CacheMagic[8] = { 'I','C','S','D','F','0','1','\0' };
+
+} // local namespace
+
+
+// -----------------------------------------------------------------------------
+icarus::ActiveVolumeDistanceField::ActiveVolumeDistanceField
+  (fhicl::ParameterSet const& pset, art::ActivityRegistry&)
+  : fVoxelSize(pset.get<double>("VoxelSize", 10.0))
+  , fCacheFile(pset.get<std::string>("CacheFile", ""))
+  , fLogCategory
+    (pset.get<std::string>("LogCategory", "ActiveVolumeDistanceField"))
+{
+
+  buildGrid();
+  acquireField();
+
+  mf::LogInfo(fLogCategory)
+    << "Distance field over " << fBoxes.size() << " active volumes: "
+    << fNodes[0] << " x " << fNodes[1] << " x " << fNodes[2] << " nodes ("
+    << fVoxelSize << " cm voxels, "
+    << ((fNodes[0] * fNodes[1] * fNodes[2] * sizeof(float)) / (1024U * 1024U))
+    << " MiB"
+    << (fMapped? ", memory-mapped from '" + fCacheFile + "'": "") << ").";
+
+} // icarus::ActiveVolumeDistanceField::ActiveVolumeDistanceField()
+
+
+// -----------------------------------------------------------------------------
+icarus::ActiveVolumeDistanceField::~ActiveVolumeDistanceField() {
+
+  if (fMapped) munmap(fMapped, fMappedSize);
+
+} // icarus::ActiveVolumeDistanceField::~ActiveVolumeDistanceField()
+
+
+// -----------------------------------------------------------------------------
+void icarus::ActiveVolumeDistanceField::buildGrid() {
+
+  art::ServiceHandle<geo::Geometry const> geom;
+
+  std::array<double, 3U> low, high;
+  low.fill(std::numeric_limits<double>::max());
+  high.fill(std::numeric_limits<double>::lowest());
+
+  for (geo::TPCGeo const& TPC: geom->IterateTPCs()) {
+    geo::BoxBoundedGeo const& box = TPC.ActiveBoundingBox();
+    fBoxes.push_back({
+      { box.MinX(), box.MinY(), box.MinZ() },
+      { box.MaxX(), box.MaxY(), box.MaxZ() }
+      });
+    low[0] = std::min(low[0], box.MinX());
+    low[1] = std::min(low[1], box.MinY());
+    low[2] = std::min(low[2], box.MinZ());
+    high[0] = std::max(high[0], box.MaxX());
+    high[1] = std::max(high[1], box.MaxY());
+    high[2] = std::max(high[2], box.MaxZ());
+  } // for TPCs
+
+  // two voxels of padding, so that the margin band around the outer
+  // boundaries is still covered by interpolation
+  for (std::size_t i = 0U; i < 3U; ++i) {
+    fOrigin[i] = low[i] - 2.0 * fVoxelSize;
+    fNodes[i] = static_cast<std::size_t>
+      (std::ceil((high[i] + 2.0 * fVoxelSize - fOrigin[i]) / fVoxelSize)) + 1U;
+  } // for axes
+
+} // icarus::ActiveVolumeDistanceField::buildGrid()
+
+
+// -----------------------------------------------------------------------------
+void icarus::ActiveVolumeDistanceField::acquireField() {
+
+  if (!fCacheFile.empty() && mapCacheFile()) return;
+
+  fStorage = sampleField();
+  fField = fStorage.data();
+
+  if (fCacheFile.empty()) return;
+
+  // write the cache and try to switch to it, so this job too shares pages
+  // with any other job mapping the same file
+  writeCacheFile(fStorage);
+  if (mapCacheFile()) {
+    fStorage = std::vector<float>{}; // release the private copy
+  }
+
+} // icarus::ActiveVolumeDistanceField::acquireField()
+
+
+// -----------------------------------------------------------------------------
+auto icarus::ActiveVolumeDistanceField::sampleField() const
+  -> std::vector<float>
+{
+  std::vector<float> field;
+  field.reserve(fNodes[0] * fNodes[1] * fNodes[2]);
+
+  for (std::size_t ix = 0U; ix < fNodes[0]; ++ix) {
+    double const x = fOrigin[0] + ix * fVoxelSize;
+    for (std::size_t iy = 0U; iy < fNodes[1]; ++iy) {
+      double const y = fOrigin[1] + iy * fVoxelSize;
+      for (std::size_t iz = 0U; iz < fNodes[2]; ++iz) {
+        double const z = fOrigin[2] + iz * fVoxelSize;
+        field.push_back
+          (static_cast<float>(exactDistance(geo::Point_t{ x, y, z })));
+      } // for z
+    } // for y
+  } // for x
+
+  return field;
+} // icarus::ActiveVolumeDistanceField::sampleField()
+
+
+// -----------------------------------------------------------------------------
+bool icarus::ActiveVolumeDistanceField::mapCacheFile() {
+
+  int const fd = open(fCacheFile.c_str(), O_RDONLY);
+  if (fd < 0) return false;
+
+  struct stat info;
+  if (fstat(fd, &info) != 0) { close(fd); return false; }
+  std::size_t const fileSize = static_cast<std::size_t>(info.st_size);
+
+  std::size_t const expectedSize = sizeof(CacheHeader_t)
+    + fNodes[0] * fNodes[1] * fNodes[2] * sizeof(float);
+
+  void* const mapped = (fileSize == expectedSize)
+    ? mmap(nullptr, fileSize, PROT_READ, MAP_SHARED, fd, 0): MAP_FAILED;
+  close(fd); // the mapping survives the file descriptor
+
+  if (mapped == MAP_FAILED) {
+    mf::LogWarning(fLogCategory)
+      << "Stale or unreadable field cache '" << fCacheFile
+      << "': rebuilding it.";
+    return false;
+  }
+
+  CacheHeader_t header;
+  std::memcpy(&header, mapped, sizeof(header));
+  bool matches = (std::memcmp(header.magic, CacheMagic, sizeof(CacheMagic)) == 0)
+    && (header.voxelSize == fVoxelSize);
+  for (std::size_t i = 0U; i < 3U; ++i) {
+    matches = matches && (header.nodes[i] == fNodes[i])
+      && (header.origin[i] == fOrigin[i]);
+  } // for axes
+
+  if (!matches) {
+    munmap(mapped, fileSize);
+    mf::LogWarning(fLogCategory)
+      << "Field cache '" << fCacheFile
+      << "' does not match the current geometry: rebuilding it.";
+    return false;
+  }
+
+  fMapped = mapped;
+  fMappedSize = fileSize;
+  fField = reinterpret_cast<float const*>
+    (static_cast<char const*>(mapped) + sizeof(CacheHeader_t));
+  return true;
+
+} // icarus::ActiveVolumeDistanceField::mapCacheFile()
+
+
+// -----------------------------------------------------------------------------
+void icarus::ActiveVolumeDistanceField::writeCacheFile
+  (std::vector<float> const& field) const
+{
+  CacheHeader_t header;
+  std::memcpy(header.magic, CacheMagic, sizeof(CacheMagic));
+  for (std::size_t i = 0U; i < 3U; ++i) {
+    header.nodes[i] = fNodes[i];
+    header.origin[i] = fOrigin[i];
+  } // for axes
+  header.voxelSize = fVoxelSize;
+
+  std::ofstream out(fCacheFile, std::ios::binary | std::ios::trunc);
+  out.write(reinterpret_cast<char const*>(&header), sizeof(header));
+  out.write(
+    reinterpret_cast<char const*>(field.data()),
+    field.size() * sizeof(float)
+    );
+
+  if (!out) {
+    // the cache is an optimization: failing to write it is not an error
+    mf::LogWarning(fLogCategory)
+      << "Could not write the field cache into '" << fCacheFile << "'.";
+  }
+
+} // icarus::ActiveVolumeDistanceField::writeCacheFile()
+
+
+// -----------------------------------------------------------------------------
+double icarus::ActiveVolumeDistanceField::distance
+  (geo::Point_t const& point) const
+{
+  double const gx = (point.X() - fOrigin[0]) / fVoxelSize;
+  double const gy = (point.Y() - fOrigin[1]) / fVoxelSize;
+  double const gz = (point.Z() - fOrigin[2]) / fVoxelSize;
+
+  // outside the sampled grid (far from any active volume): evaluate exactly
+  if ((gx < 0.0) || (gx >= fNodes[0] - 1U)
+    || (gy < 0.0) || (gy >= fNodes[1] - 1U)
+    || (gz < 0.0) || (gz >= fNodes[2] - 1U))
+  {
+    return exactDistance(point);
+  }
+
+  std::size_t const ix = static_cast<std::size_t>(gx);
+  std::size_t const iy = static_cast<std::size_t>(gy);
+  std::size_t const iz = static_cast<std::size_t>(gz);
+  double const fx = gx - ix;
+  double const fy = gy - iy;
+  double const fz = gz - iz;
+
+  double const c00
+    = node(ix, iy, iz) * (1.0 - fx) + node(ix + 1U, iy, iz) * fx;
+  double const c01
+    = node(ix, iy, iz + 1U) * (1.0 - fx) + node(ix + 1U, iy, iz + 1U) * fx;
+  double const c10
+    = node(ix, iy + 1U, iz) * (1.0 - fx) + node(ix + 1U, iy + 1U, iz) * fx;
+  double const c11 = node(ix, iy + 1U, iz + 1U) * (1.0 - fx)
+    + node(ix + 1U, iy + 1U, iz + 1U) * fx;
+
+  double const c0 = c00 * (1.0 - fy) + c10 * fy;
+  double const c1 = c01 * (1.0 - fy) + c11 * fy;
+
+  return c0 * (1.0 - fz) + c1 * fz;
+} // icarus::ActiveVolumeDistanceField::distance()
+
+
+// -----------------------------------------------------------------------------
+void icarus::ActiveVolumeDistanceField::distances
+  (std::vector<geo::Point_t> const& points, std::vector<float>& dist) const
+{
+  dist.clear();
+  dist.reserve(points.size());
+  for (geo::Point_t const& point: points)
+    dist.push_back(static_cast<float>(distance(point)));
+} // icarus::ActiveVolumeDistanceField::distances()
+
+
+// -----------------------------------------------------------------------------
+bool icarus::ActiveVolumeDistanceField::isContained
+  (geo::Point_t const& point) const
+{
+  double const d = distance(point);
+
+  // the field is 1-Lipschitz, so the interpolation is accurate to better than
+  // one voxel; within that band of a boundary, defer to the exact boxes
+  if (std::abs(d) > fVoxelSize) return d > 0.0;
+  return exactDistance(point) > 0.0;
+} // icarus::ActiveVolumeDistanceField::isContained()
+
+
+// -----------------------------------------------------------------------------
+double icarus::ActiveVolumeDistanceField::exactDistance
+  (geo::Point_t const& point) const
+{
+  std::array<double, 3U> const p { point.X(), point.Y(), point.Z() };
+
+  // distance to a union of boxes: the largest of the signed distances to each
+  double best = std::numeric_limits<double>::lowest();
+  for (Box_t const& box: fBoxes) {
+    double maxExcess = std::numeric_limits<double>::lowest();
+    double excess2 = 0.0;
+    for (std::size_t i = 0U; i < 3U; ++i) {
+      // positive when outside the box along this axis, negative slack inside
+      double const excess = std::max(box.min[i] - p[i], p[i] - box.max[i]);
+      maxExcess = std::max(maxExcess, excess);
+      if (excess > 0.0) excess2 += excess * excess;
+    } // for axes
+    double const d = (maxExcess <= 0.0)? -maxExcess: -std::sqrt(excess2);
+    best = std::max(best, d);
+  } // for boxes
+
+  return best;
+} // icarus::ActiveVolumeDistanceField::exactDistance()
+
+
+// -----------------------------------------------------------------------------
+DEFINE_ART_SERVICE(icarus::ActiveVolumeDistanceField)
+
+
+// -----------------------------------------------------------------------------
@@ -28,9 +28,16 @@ namespace icarus {
 
 /**
  * @brief Interface for a tool creating the standard ICARUS channel mapper.
- * 
+ *
  * This tool creates a `icarus::ICARUSChannelMapAlg` mapper.
- * 
+ *
+ * @note This tool only constructs the mapper and hands it to the geometry
+ *       service: it performs no translation itself. The wire/channel
+ *       translation tables for the split induction planes (including the
+ *       channel-to-wire-segments direction) are built and frozen inside
+ *       `icarus::ICARUSChannelMapAlg` (from `icarusalg`) when the geometry
+ *       is loaded; making those lookups table-driven or batched is work for
+ *       that algorithm, not for this factory.
  */
 class icarus::ICARUSsplitInductionChannelMapSetupTool
   : public geo::ChannelMapSetupTool
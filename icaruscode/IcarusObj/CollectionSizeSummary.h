@@ -0,0 +1,55 @@
+/**
+ * @file   icaruscode/IcarusObj/CollectionSizeSummary.h
+ * @brief  Object storing the entry counts of selected data products.
+ * @date   August 31, 2026
+ * @see    icaruscode/IcarusObj/SimEnergyDepositSummary.h
+ *
+ * Reading a collection data product just to learn how many entries it has
+ * costs the full deserialization of that collection. This tiny object records
+ * the entry counts of a configurable set of collections at production time,
+ * when those collections are in memory anyway, so that downstream skimming
+ * filters can threshold on the counts without touching the collections
+ * themselves.
+ */
+
+#ifndef ICARUSCODE_ICARUSOBJ_COLLECTIONSIZESUMMARY_H
+#define ICARUSCODE_ICARUSOBJ_COLLECTIONSIZESUMMARY_H
+
+// C/C++ standard libraries
+#include <string>
+#include <vector>
+#include <cstddef> // std::size_t
+
+// -----------------------------------------------------------------------------
+namespace icarus { struct CollectionSizeSummary; }
+
+/// Data structure listing the entry counts of summarized collections.
+struct icarus::CollectionSizeSummary {
+
+  /// Special count value denoting a collection not in the summary.
+  static constexpr long long int Unknown = -1;
+
+  /// Encoded input tags (`art::InputTag::encode()`) of the collections.
+  std::vector<std::string> labels;
+
+  /// Number of entries of each collection, parallel to `labels`.
+  std::vector<unsigned int> entries;
+
+  /// Appends the count of one collection to the summary.
+  void add(std::string label, unsigned int count)
+    { labels.push_back(std::move(label)); entries.push_back(count); }
+
+  /// Returns the entry count recorded for `label`, `Unknown` if none is.
+  long long int entriesFor(std::string const& label) const
+    {
+      for (std::size_t i = 0; i < labels.size(); ++i)
+        if (labels[i] == label) return entries[i];
+      return Unknown;
+    }
+
+}; // icarus::CollectionSizeSummary
+
+
+// -----------------------------------------------------------------------------
+
+#endif // ICARUSCODE_ICARUSOBJ_COLLECTIONSIZESUMMARY_H
@@ -0,0 +1,95 @@
+/**
+ * @file icaruscode/IcarusObj/GateOrderingAttestation.h
+ * @brief Attestation of the channel ordering of a trigger gate collection.
+ * @date August 31, 2026
+ */
+
+#ifndef ICARUSCODE_ICARUSOBJ_GATEORDERINGATTESTATION_H
+#define ICARUSCODE_ICARUSOBJ_GATEORDERINGATTESTATION_H
+
+
+// C/C++ standard libraries
+#include <algorithm> // std::is_sorted()
+#include <iterator> // std::begin(), std::end()
+#include <cstddef> // std::size_t
+
+
+// -----------------------------------------------------------------------------
+namespace icarus::trigger {
+
+  struct GateOrderingAttestation;
+
+  /// Returns the attestation earned by the gates in `gates`.
+  template <typename GateColl>
+  GateOrderingAttestation attestGateOrdering(GateColl const& gates);
+
+} // namespace icarus::trigger
+
+/**
+ * @brief Ordering contract for a trigger gate collection data product.
+ *
+ * A producer of trigger gates can publish this tiny product, with the same
+ * instance name as the gate collection, to attest the ordering of that
+ * collection: consumers that find a matching attestation can skip their
+ * defensive per-event validation and re-sorting and use merge-based
+ * algorithms directly. Consumers must keep the defensive path as fallback
+ * for inputs that carry no attestation.
+ *
+ * The attestation is computed from the gates themselves (a single linear
+ * scan, see `attestGateOrdering()`), not assumed: an input violating the
+ * ordering simply earns no attestation.
+ */
+struct icarus::trigger::GateOrderingAttestation {
+
+  /// Number of gates in the collection this attestation covers.
+  unsigned int nGates = 0U;
+
+  /// Within each gate, the channel list is sorted in increasing order.
+  bool channelsSorted = false;
+
+  /// The gates are sorted by their first (lowest) channel.
+  bool gatesSorted = false;
+
+  /// Returns whether this attests both orderings of a `n`-gate collection.
+  bool covers(std::size_t n) const
+    { return channelsSorted && gatesSorted && (nGates == n); }
+
+}; // icarus::trigger::GateOrderingAttestation
+
+
+// -----------------------------------------------------------------------------
+// ---  template implementation
+// -----------------------------------------------------------------------------
+template <typename GateColl>
+icarus::trigger::GateOrderingAttestation
+icarus::trigger::attestGateOrdering(GateColl const& gates) {
+
+  GateOrderingAttestation attestation;
+  attestation.nGates = gates.size();
+  attestation.channelsSorted = true;
+  attestation.gatesSorted = true;
+
+  bool hasPrevious = false;
+  auto previousFirst = decltype(std::begin(gates)->channels().front()){};
+
+  for (auto const& gate: gates) {
+    auto const& channels = gate.channels();
+    if (!std::is_sorted(std::begin(channels), std::end(channels)))
+      attestation.channelsSorted = false;
+    if (std::begin(channels) == std::end(channels)) {
+      attestation.gatesSorted = false; // no first channel to order by
+      continue;
+    }
+    auto const first = *std::begin(channels);
+    if (hasPrevious && (first < previousFirst)) attestation.gatesSorted = false;
+    previousFirst = first;
+    hasPrevious = true;
+  } // for
+
+  return attestation;
+} // icarus::trigger::attestGateOrdering()
+
+
+// -----------------------------------------------------------------------------
+
+#endif // ICARUSCODE_ICARUSOBJ_GATEORDERINGATTESTATION_H
@@ -0,0 +1,131 @@
+/**
+ * @file  icaruscode/IcarusObj/OpDetWaveformMetaIndex.h
+ * @brief Channel-indexed directory of `sbn::OpDetWaveformMeta` time coverage.
+ * @author Gianluca Petrillo (petrillo@slac.stanford.edu)
+ * @date August 31, 2026
+ *
+ */
+
+#ifndef ICARUSCODE_ICARUSOBJ_OPDETWAVEFORMMETAINDEX_H
+#define ICARUSCODE_ICARUSOBJ_OPDETWAVEFORMMETAINDEX_H
+
+
+// LArSoft libraries
+#include "lardataobj/RawData/OpDetWaveform.h" // raw::Channel_t
+
+// C/C++ standard libraries
+#include <algorithm> // std::upper_bound()
+#include <limits>
+#include <vector>
+
+
+// -----------------------------------------------------------------------------
+namespace icarus { struct OpDetWaveformMetaIndex; }
+/**
+ * @brief Directory of the time coverage of a `sbn::OpDetWaveformMeta`
+ *        collection, indexed by channel.
+ *
+ * For each optical detector channel, this object lists the time ranges covered
+ * by the waveforms on that channel, each range pointing back to the position of
+ * its summary object (`sbn::OpDetWaveformMeta`) in the original collection.
+ * The ranges of each channel are sorted by their start time, so that the
+ * waveform covering a given time can be found with a binary search
+ * (`findWaveform()`) instead of a scan of the whole collection.
+ *
+ * The object is expected to be produced together with the summary collection
+ * it refers to (see `OpDetWaveformMetaMaker` module), sparing each consumer
+ * the construction of an equivalent map of its own.
+ *
+ * Times are in the same scale as in `sbn::OpDetWaveformMeta`, i.e. the
+ * @ref DetectorClocksElectronicsStartTime "electronics time scale [us]".
+ */
+struct icarus::OpDetWaveformMetaIndex {
+
+  /// Magic value denoting the absence of a waveform.
+  static constexpr std::size_t NoIndex = std::numeric_limits<std::size_t>::max();
+
+  /// Time coverage of a single waveform on a channel.
+  struct Range {
+
+    double startTime; ///< Time of the first sample in the waveform [us]
+    double endTime;   ///< Time at the end of the last sample in the waveform [us]
+
+    /// Position of the waveform in the `sbn::OpDetWaveformMeta` collection.
+    std::size_t metaIndex = NoIndex;
+
+    /// Returns whether `time` is covered by this range (end excluded).
+    bool covers(double time) const
+      { return (time >= startTime) && (time < endTime); }
+
+  }; // Range
+
+
+  // --- BEGIN -- Data members -------------------------------------------------
+
+  /// For each channel, the covered time ranges, sorted by their start time.
+  std::vector<std::vector<Range>> channelRanges;
+
+  // --- END ---- Data members -------------------------------------------------
+
+
+  // --- BEGIN -- Queries ------------------------------------------------------
+  /// @name Queries
+  /// @{
+
+  /// Returns the number of channels the index extends over.
+  std::size_t nChannels() const { return channelRanges.size(); }
+
+  /// Returns all the ranges covered on `channel` (empty if none).
+  std::vector<Range> const& rangesFor(raw::Channel_t channel) const; // inline
+
+  /**
+   * @brief Returns the waveform on `channel` covering the specified `time`.
+   * @param channel the optical detector channel to be queried
+   * @param time the time to be covered, in electronics time scale [us]
+   * @return the index of the matched waveform in the original
+   *         `sbn::OpDetWaveformMeta` collection, or `NoIndex` if none
+   *
+   * If the waveforms on the channel overlap, the one starting latest is
+   * returned.
+   */
+  std::size_t findWaveform(raw::Channel_t channel, double time) const; // inline
+
+  /// @}
+  // --- END ---- Queries ------------------------------------------------------
+
+}; // icarus::OpDetWaveformMetaIndex
+
+
+// -----------------------------------------------------------------------------
+// ---  inline implementation
+// -----------------------------------------------------------------------------
+inline auto icarus::OpDetWaveformMetaIndex::rangesFor
+  (raw::Channel_t channel) const -> std::vector<Range> const&
+{
+  static std::vector<Range> const EmptyRanges;
+  return (static_cast<std::size_t>(channel) < channelRanges.size())
+    ? channelRanges[channel]: EmptyRanges;
+} // icarus::OpDetWaveformMetaIndex::rangesFor()
+
+
+// -----------------------------------------------------------------------------
+inline std::size_t icarus::OpDetWaveformMetaIndex::findWaveform
+  (raw::Channel_t channel, double time) const
+{
+  std::vector<Range> const& ranges = rangesFor(channel);
+
+  // first range starting after `time`: the match, if any, is just before it
+  auto const itAfter = std::upper_bound(
+    ranges.begin(), ranges.end(), time,
+    [](double t, Range const& range){ return t < range.startTime; }
+    );
+  if (itAfter == ranges.begin()) return NoIndex;
+
+  Range const& range = *std::prev(itAfter);
+  return range.covers(time)? range.metaIndex: NoIndex;
+} // icarus::OpDetWaveformMetaIndex::findWaveform()
+
+
+// -----------------------------------------------------------------------------
+
+#endif // ICARUSCODE_ICARUSOBJ_OPDETWAVEFORMMETAINDEX_H
@@ -0,0 +1,168 @@
+/**
+ * @file icaruscode/IcarusObj/PackedOpDetWaveform.h
+ * @brief Bit-packed counterpart of `raw::OpDetWaveform` data.
+ * @date August 31, 2026
+ * @see  icaruscode/IcarusObj/OpDetWaveformMeta.h
+ */
+
+#ifndef ICARUSCODE_ICARUSOBJ_PACKEDOPDETWAVEFORM_H
+#define ICARUSCODE_ICARUSOBJ_PACKEDOPDETWAVEFORM_H
+
+
+// LArSoft libraries
+#include "lardataobj/RawData/OpDetWaveform.h"
+
+// C/C++ standard libraries
+#include <vector>
+#include <limits>
+#include <cstdint>
+#include <cstddef> // std::size_t
+
+
+// -----------------------------------------------------------------------------
+namespace icarus { class PackedOpDetWaveform; }
+/**
+ * @brief A `raw::OpDetWaveform` with its samples packed at their native width.
+ *
+ * The V1730 digitizers produce 14-bit samples which `raw::OpDetWaveform`
+ * stores as 16-bit integers, wasting one byte every eight. This class stores
+ * the same samples back to back at a fixed bit width (14 bits by default),
+ * together with the channel number and timestamp of the original waveform,
+ * and unpacks them on demand.
+ *
+ * Packing is lossless as long as every sample fits the chosen width; the
+ * packing constructor verifies that and falls back to 16 bits (i.e. no
+ * saving, but still lossless) for waveforms with out-of-range samples, e.g.
+ * from saturated or misconfigured channels.
+ *
+ * Access is transparent via `sample()` or via `unpack()`, which returns a
+ * full `raw::OpDetWaveform` equivalent to the original one.
+ */
+class icarus::PackedOpDetWaveform {
+
+    public:
+
+  /// Number of bits of a V1730 sample.
+  static constexpr unsigned int V1730bits = 14U;
+
+
+  // --- BEGIN -- Constructors -------------------------------------------------
+
+  PackedOpDetWaveform() = default;
+
+  /**
+   * @brief Packs the samples of `waveform` at the specified width.
+   * @param waveform the waveform to be packed
+   * @param bitsPerSample number of bits each sample is stored with
+   *
+   * If any sample of `waveform` does not fit in `bitsPerSample` bits, the
+   * whole waveform is stored at 16 bits per sample instead.
+   */
+  PackedOpDetWaveform
+    (raw::OpDetWaveform const& waveform, unsigned int bitsPerSample = V1730bits);
+
+  // --- END ---- Constructors -------------------------------------------------
+
+
+  // --- BEGIN -- Access to packed information ---------------------------------
+
+  /// Returns the channel of the original waveform.
+  raw::Channel_t ChannelNumber() const { return fChannel; }
+
+  /// Returns the timestamp of the original waveform.
+  raw::TimeStamp_t TimeStamp() const { return fTimeStamp; }
+
+  /// Returns the number of samples in the waveform.
+  std::size_t size() const { return fNSamples; }
+
+  /// Returns the number of bits each sample is stored with.
+  unsigned int bitsPerSample() const { return fBitsPerSample; }
+
+  /// Returns the `index`-th sample of the waveform (unpacked on the fly).
+  /// @note No boundary check is performed.
+  std::uint16_t sample(std::size_t index) const;
+
+  /// Returns a `raw::OpDetWaveform` equivalent to the packed original.
+  raw::OpDetWaveform unpack() const;
+
+  // --- END ---- Access to packed information ---------------------------------
+
+
+    private:
+
+  raw::Channel_t fChannel = std::numeric_limits<raw::Channel_t>::max();
+  raw::TimeStamp_t fTimeStamp {}; ///< Timestamp of the first sample.
+  std::uint32_t fNSamples = 0U; ///< Number of samples in the waveform.
+  std::uint8_t fBitsPerSample = 0U; ///< Stored width of each sample.
+  std::vector<std::uint8_t> fData; ///< Packed sample stream.
+
+}; // class icarus::PackedOpDetWaveform
+
+
+// -----------------------------------------------------------------------------
+// --- inline implementation
+// -----------------------------------------------------------------------------
+inline icarus::PackedOpDetWaveform::PackedOpDetWaveform
+  (raw::OpDetWaveform const& waveform, unsigned int bitsPerSample /* = V1730bits */)
+  : fChannel{ waveform.ChannelNumber() }
+  , fTimeStamp{ waveform.TimeStamp() }
+  , fNSamples{ static_cast<std::uint32_t>(waveform.size()) }
+  , fBitsPerSample{ static_cast<std::uint8_t>(bitsPerSample) }
+{
+  // samples exceeding the requested width force a lossless 16-bit fallback
+  std::uint16_t const maxValue = (1U << bitsPerSample) - 1U;
+  for (auto const sample: waveform) {
+    if (static_cast<std::uint16_t>(sample) <= maxValue) continue;
+    fBitsPerSample = 16U;
+    break;
+  } // for
+
+  fData.assign((fNSamples * fBitsPerSample + 7U) / 8U, 0U);
+
+  // little-endian bit stream: sample `i` starts at bit `i * fBitsPerSample`,
+  // least significant bits first
+  std::size_t bitPos = 0U;
+  for (auto const sample: waveform) {
+    std::uint32_t bits = static_cast<std::uint16_t>(sample);
+    fData[bitPos / 8U] |= static_cast<std::uint8_t>(bits << (bitPos % 8U));
+    bits >>= 8U - (bitPos % 8U);
+    for (std::size_t byte = bitPos / 8U + 1U;
+      byte <= (bitPos + fBitsPerSample - 1U) / 8U; ++byte)
+    {
+      fData[byte] |= static_cast<std::uint8_t>(bits);
+      bits >>= 8U;
+    } // for bytes
+    bitPos += fBitsPerSample;
+  } // for samples
+
+} // icarus::PackedOpDetWaveform::PackedOpDetWaveform()
+
+
+// -----------------------------------------------------------------------------
+inline std::uint16_t icarus::PackedOpDetWaveform::sample
+  (std::size_t index) const
+{
+  std::size_t const bitPos = index * fBitsPerSample;
+  std::uint32_t bits = fData[bitPos / 8U] >> (bitPos % 8U);
+  unsigned int gotBits = 8U - (bitPos % 8U);
+  for (std::size_t byte = bitPos / 8U + 1U; gotBits < fBitsPerSample; ++byte) {
+    bits |= static_cast<std::uint32_t>(fData[byte]) << gotBits;
+    gotBits += 8U;
+  } // for bytes
+  return static_cast<std::uint16_t>(bits & ((1U << fBitsPerSample) - 1U));
+} // icarus::PackedOpDetWaveform::sample()
+
+
+// -----------------------------------------------------------------------------
+inline raw::OpDetWaveform icarus::PackedOpDetWaveform::unpack() const {
+  raw::OpDetWaveform waveform{ fTimeStamp, fChannel, fNSamples };
+  for (std::size_t index = 0U; index < fNSamples; ++index)
+    waveform.push_back(static_cast<raw::ADC_Count_t>(sample(index)));
+  return waveform;
+} // icarus::PackedOpDetWaveform::unpack()
+
+
+// -----------------------------------------------------------------------------
+
+
+#endif // ICARUSCODE_ICARUSOBJ_PACKEDOPDETWAVEFORM_H
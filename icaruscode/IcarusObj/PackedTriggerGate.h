@@ -0,0 +1,221 @@
+/**
+ * @file icaruscode/IcarusObj/PackedTriggerGate.h
+ * @brief Delta-encoded, varint-packed counterpart of trigger gate data.
+ * @date August 31, 2026
+ * @see  icaruscode/IcarusObj/PackedOpDetWaveform.h
+ */
+
+#ifndef ICARUSCODE_ICARUSOBJ_PACKEDTRIGGERGATE_H
+#define ICARUSCODE_ICARUSOBJ_PACKEDTRIGGERGATE_H
+
+
+// SBN libraries
+#include "sbnobj/ICARUS/PMT/Trigger/Data/OpticalTriggerGate.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::min()
+#include <utility> // std::move()
+#include <vector>
+#include <cstdint>
+#include <cstddef> // std::size_t
+
+
+// -----------------------------------------------------------------------------
+namespace icarus::trigger { class PackedTriggerGate; }
+/**
+ * @brief A trigger gate stored as a delta-encoded, varint-packed byte stream.
+ *
+ * `icarus::trigger::OpticalTriggerGateData_t` persists each opening level
+ * change as a full (tick, count) record, although consecutive changes are
+ * ticks apart and the counts small. This class stores the same information
+ * as byte-level varints: the channel list delta-encoded, the opening count
+ * at the beginning of time, and then one (tick delta, count delta) pair per
+ * level change, zig-zag encoded. A typical LVDS or sliding window gate with
+ * a handful of transitions packs into a few bytes.
+ *
+ * Packing is exact: `unpack()` returns a gate equal to the original one.
+ * The verbose class belongs to `sbnobj` and cannot be evolved from here, so
+ * this is a parallel compact product (see `PackTriggerGates` module) rather
+ * than a new schema version of the original one; files written with the
+ * verbose product remain readable as before.
+ */
+class icarus::trigger::PackedTriggerGate {
+
+    public:
+
+  using GateData_t = icarus::trigger::OpticalTriggerGateData_t;
+  using ClockTick_t = GateData_t::ClockTick_t;
+  using OpeningCount_t = GateData_t::OpeningCount_t;
+
+
+  // --- BEGIN -- Constructors -------------------------------------------------
+
+  PackedTriggerGate() = default;
+
+  /// Packs the channels and level changes of `gate`.
+  PackedTriggerGate(GateData_t const& gate);
+
+  /// Rebuilds a packed gate from its raw parts (e.g. read back from a
+  /// snapshot file); `data` must be a stream produced by this same class.
+  PackedTriggerGate(
+    std::uint32_t nChannels, std::uint32_t nTransitions,
+    std::vector<std::uint8_t> data
+    )
+    : fNChannels(nChannels), fNTransitions(nTransitions)
+    , fData(std::move(data))
+    {}
+
+  // --- END ---- Constructors -------------------------------------------------
+
+
+  // --- BEGIN -- Access to packed information ---------------------------------
+
+  /// Returns the number of channels of the original gate.
+  std::size_t nChannels() const { return fNChannels; }
+
+  /// Returns the number of opening level changes of the original gate.
+  std::size_t nTransitions() const { return fNTransitions; }
+
+  /// Returns the size of the packed byte stream.
+  std::size_t packedSize() const { return fData.size(); }
+
+  /// Returns the packed byte stream itself (for external serialization).
+  std::vector<std::uint8_t> const& packedData() const { return fData; }
+
+  /// Returns a gate equal to the packed original.
+  GateData_t unpack() const;
+
+  // --- END ---- Access to packed information ---------------------------------
+
+
+    private:
+
+  std::uint32_t fNChannels = 0U; ///< Number of channels in the stream.
+  std::uint32_t fNTransitions = 0U; ///< Number of level changes in the stream.
+  std::vector<std::uint8_t> fData; ///< Varint-packed byte stream.
+
+  /// Appends `value` to `data` as a base-128 varint, low bits first.
+  static void appendVarint(std::vector<std::uint8_t>& data, std::uint64_t value);
+
+  /// Reads the varint starting at `data[pos]`, advancing `pos` past it.
+  static std::uint64_t readVarint
+    (std::vector<std::uint8_t> const& data, std::size_t& pos);
+
+  /// Folds a signed value into an unsigned one with small absolute values
+  /// mapped to small encodings (zig-zag).
+  static std::uint64_t zigzag(std::int64_t value)
+    {
+      return (static_cast<std::uint64_t>(value) << 1)
+        ^ static_cast<std::uint64_t>(value >> 63);
+    }
+
+  /// Inverse of `zigzag()`.
+  static std::int64_t unzigzag(std::uint64_t value)
+    {
+      return static_cast<std::int64_t>(value >> 1)
+        ^ -static_cast<std::int64_t>(value & 1U);
+    }
+
+}; // class icarus::trigger::PackedTriggerGate
+
+
+// -----------------------------------------------------------------------------
+// --- inline implementation
+// -----------------------------------------------------------------------------
+inline void icarus::trigger::PackedTriggerGate::appendVarint
+  (std::vector<std::uint8_t>& data, std::uint64_t value)
+{
+  while (value >= 0x80U) {
+    data.push_back(static_cast<std::uint8_t>(value) | 0x80U);
+    value >>= 7U;
+  } // while
+  data.push_back(static_cast<std::uint8_t>(value));
+} // icarus::trigger::PackedTriggerGate::appendVarint()
+
+
+// -----------------------------------------------------------------------------
+inline std::uint64_t icarus::trigger::PackedTriggerGate::readVarint
+  (std::vector<std::uint8_t> const& data, std::size_t& pos)
+{
+  std::uint64_t value = 0U;
+  unsigned int shift = 0U;
+  while (data[pos] & 0x80U) {
+    value |= static_cast<std::uint64_t>(data[pos++] & 0x7FU) << shift;
+    shift += 7U;
+  } // while
+  value |= static_cast<std::uint64_t>(data[pos++]) << shift;
+  return value;
+} // icarus::trigger::PackedTriggerGate::readVarint()
+
+
+// -----------------------------------------------------------------------------
+inline icarus::trigger::PackedTriggerGate::PackedTriggerGate
+  (GateData_t const& gate)
+{
+  // channel list, delta encoded (the gate keeps it sorted)
+  auto const& channels = gate.channels();
+  fNChannels = static_cast<std::uint32_t>(channels.size());
+  std::uint64_t prevChannel = 0U;
+  for (auto const channel: channels) {
+    appendVarint(fData, static_cast<std::uint64_t>(channel) - prevChannel);
+    prevChannel = channel;
+  } // for channels
+
+  // level changes, walked through the public search interface: from a tick
+  // with opening count `count` the next change is the first tick where the
+  // count either reaches `count + 1` or drops below `count`
+  ClockTick_t tick = GateData_t::MinTick;
+  OpeningCount_t count = gate.openingCount(tick);
+  appendVarint(fData, count);
+  std::int64_t prevTick = 0;
+  while (true) {
+    ClockTick_t const up   = gate.findOpen(count + 1U, tick + 1);
+    ClockTick_t const down = gate.findClose(count, tick + 1);
+    ClockTick_t const next = std::min(up, down);
+    if (next == GateData_t::MaxTick) break;
+    OpeningCount_t const newCount = gate.openingCount(next);
+    appendVarint(fData, zigzag(static_cast<std::int64_t>(next) - prevTick));
+    appendVarint(fData, zigzag(
+      static_cast<std::int64_t>(newCount) - static_cast<std::int64_t>(count)
+      ));
+    prevTick = next;
+    tick = next;
+    count = newCount;
+    ++fNTransitions;
+  } // while
+
+} // icarus::trigger::PackedTriggerGate::PackedTriggerGate()
+
+
+// -----------------------------------------------------------------------------
+inline auto icarus::trigger::PackedTriggerGate::unpack() const -> GateData_t {
+
+  GateData_t gate;
+  std::size_t pos = 0U;
+
+  std::uint64_t channel = 0U;
+  for (std::uint32_t i = 0U; i < fNChannels; ++i) {
+    channel += readVarint(fData, pos);
+    gate.addChannel(static_cast<raw::Channel_t>(channel));
+  } // for channels
+
+  OpeningCount_t count = static_cast<OpeningCount_t>(readVarint(fData, pos));
+  if (count != 0U) gate.setOpeningAt(GateData_t::MinTick, count);
+
+  std::int64_t tick = 0;
+  for (std::uint32_t i = 0U; i < fNTransitions; ++i) {
+    tick += unzigzag(readVarint(fData, pos));
+    count = static_cast<OpeningCount_t>(
+      static_cast<std::int64_t>(count) + unzigzag(readVarint(fData, pos))
+      );
+    gate.setOpeningAt(static_cast<ClockTick_t>(tick), count);
+  } // for transitions
+
+  return gate;
+} // icarus::trigger::PackedTriggerGate::unpack()
+
+
+// -----------------------------------------------------------------------------
+
+
+#endif // ICARUSCODE_ICARUSOBJ_PACKEDTRIGGERGATE_H
@@ -0,0 +1,63 @@
+/**
+ * @file   icaruscode/IcarusObj/PurityRecordBatch.h
+ * @brief  Batched (structure-of-arrays) purity fit records of one event.
+ * @date   August 31, 2026
+ * @see    icaruscode/IcarusObj/ROICensus.h
+ *
+ * The purity monitor emits one `anab::TPCPurityInfo` per fitted track, and the
+ * downstream consumers re-marshal those records one at a time into their tree
+ * branches. This product carries the same quantities as parallel contiguous
+ * arrays, one entry per fitted track, so that a consumer can bind its branches
+ * to the arrays and fill with a handful of bulk vector copies per event.
+ */
+
+#ifndef ICARUSCODE_ICARUSOBJ_PURITYRECORDBATCH_H
+#define ICARUSCODE_ICARUSOBJ_PURITYRECORDBATCH_H
+
+// C/C++ standard libraries
+#include <vector>
+#include <cstddef> // std::size_t
+
+// -----------------------------------------------------------------------------
+namespace icarus { struct PurityRecordBatch; }
+
+/// Purity fit records of one event, as parallel arrays (one entry per track).
+struct icarus::PurityRecordBatch {
+
+  std::vector<int> cryostat;        ///< Cryostat of the fitted track.
+  std::vector<int> tpc;             ///< TPC of the fitted track.
+  std::vector<int> trackIdx;        ///< Index of the track in its collection.
+  std::vector<int> wireRange;       ///< Last minus first wire number.
+  std::vector<int> wires;           ///< Number of wires spanned.
+  std::vector<int> ticks;           ///< Number of ticks spanned.
+  std::vector<double> attenuation;  ///< Attenuation from the charge fit.
+  std::vector<double> fracError;    ///< Fractional error of the fit.
+
+  /// Returns the number of records in the batch.
+  std::size_t size() const { return cryostat.size(); }
+
+  /// Returns whether the batch holds no record at all.
+  bool empty() const { return cryostat.empty(); }
+
+  /// Appends one record (all the arrays grow by one entry).
+  void addRecord(
+    int cryo, int TPC, int track, int wireRangeSpan,
+    int nWires, int nTicks, double att, double err
+    )
+    {
+      cryostat.push_back(cryo);
+      tpc.push_back(TPC);
+      trackIdx.push_back(track);
+      wireRange.push_back(wireRangeSpan);
+      wires.push_back(nWires);
+      ticks.push_back(nTicks);
+      attenuation.push_back(att);
+      fracError.push_back(err);
+    }
+
+}; // icarus::PurityRecordBatch
+
+
+// -----------------------------------------------------------------------------
+
+#endif // ICARUSCODE_ICARUSOBJ_PURITYRECORDBATCH_H
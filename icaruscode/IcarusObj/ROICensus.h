@@ -0,0 +1,78 @@
+/**
+ * @file   icaruscode/IcarusObj/ROICensus.h
+ * @brief  Per-plane census of the regions of interest found in an event.
+ * @date   August 31, 2026
+ * @see    icaruscode/IcarusObj/CollectionSizeSummary.h
+ *
+ * A single pathological event (e.g. beam splash) can carry orders of magnitude
+ * more regions of interest than a typical one, and the reconstruction cost of
+ * some downstream algorithms grows combinatorially with that count. This tiny
+ * product, written by the ROI finder while the regions are in memory anyway,
+ * lets those downstream modules measure the complexity of the event before
+ * committing to the full treatment, and switch to a degraded but bounded
+ * strategy when a configured budget is exceeded.
+ */
+
+#ifndef ICARUSCODE_ICARUSOBJ_ROICENSUS_H
+#define ICARUSCODE_ICARUSOBJ_ROICENSUS_H
+
+// C/C++ standard libraries
+#include <vector>
+#include <cstddef> // std::size_t
+
+// -----------------------------------------------------------------------------
+namespace icarus { struct ROICensus; }
+
+/// Counts and extents of the regions of interest of an event, plane by plane.
+struct icarus::ROICensus {
+
+  /// Census of the regions of interest on one wire plane.
+  struct PlaneCount {
+    unsigned int nWires = 0U;         ///< Wires with at least one region.
+    unsigned int nROIs = 0U;          ///< Number of regions on the plane.
+    unsigned long long nTicks = 0ULL; ///< Summed region lengths [ticks]
+    unsigned int maxTicks = 0U;       ///< Length of the longest region [ticks]
+  };
+
+  /// Census of each plane, indexed by plane number within the TPC.
+  std::vector<PlaneCount> planes;
+
+  /// Records one region of `length` ticks on plane `plane`.
+  void tally(std::size_t plane, unsigned int length)
+    {
+      if (plane >= planes.size()) planes.resize(plane + 1U);
+      PlaneCount& count = planes[plane];
+      ++count.nROIs;
+      count.nTicks += length;
+      if (length > count.maxTicks) count.maxTicks = length;
+    }
+
+  /// Records one wire with at least one region on plane `plane`.
+  void tallyWire(std::size_t plane)
+    {
+      if (plane >= planes.size()) planes.resize(plane + 1U);
+      ++planes[plane].nWires;
+    }
+
+  /// Returns the number of regions summed over all the planes.
+  unsigned int nROIs() const
+    {
+      unsigned int total = 0U;
+      for (PlaneCount const& count: planes) total += count.nROIs;
+      return total;
+    }
+
+  /// Returns the summed region lengths over all the planes [ticks]
+  unsigned long long nTicks() const
+    {
+      unsigned long long total = 0ULL;
+      for (PlaneCount const& count: planes) total += count.nTicks;
+      return total;
+    }
+
+}; // icarus::ROICensus
+
+
+// -----------------------------------------------------------------------------
+
+#endif // ICARUSCODE_ICARUSOBJ_ROICENSUS_H
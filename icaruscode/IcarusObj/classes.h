@@ -1,7 +1,14 @@
 #include "canvas/Persistency/Common/Wrapper.h"
 #include "canvas/Persistency/Common/Assns.h"
+#include "icaruscode/IcarusObj/CollectionSizeSummary.h"
 #include "icaruscode/IcarusObj/SimEnergyDepositSummary.h"
 #include "icaruscode/IcarusObj/OpDetWaveformMeta.h"
+#include "icaruscode/IcarusObj/OpDetWaveformMetaIndex.h"
+#include "icaruscode/IcarusObj/PackedOpDetWaveform.h"
+#include "icaruscode/IcarusObj/PackedTriggerGate.h"
+#include "icaruscode/IcarusObj/GateOrderingAttestation.h"
+#include "icaruscode/IcarusObj/ROICensus.h"
+#include "icaruscode/IcarusObj/PurityRecordBatch.h"
 #include "sbnobj/ICARUS/PMT/Trigger/Data/OpticalTriggerGate.h"
 #include "sbnobj/ICARUS/PMT/Trigger/Data/TriggerGateData.h"
 #include "lardataobj/RawData/OpDetWaveform.h"
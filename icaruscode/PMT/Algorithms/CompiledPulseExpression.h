@@ -0,0 +1,365 @@
+/**
+ * @file   icaruscode/PMT/Algorithms/CompiledPulseExpression.h
+ * @brief  Expression compiled to bytecode for fast repeated evaluation.
+ * @author Gianluca Petrillo (petrillo@slac.stanford.edu)
+ * @see    icaruscode/PMT/Algorithms/CustomPulseFunction.h
+ *
+ * This library is header only.
+ *
+ * The single photoelectron response tabulation evaluates the configured pulse
+ * shape once per sample of the discretization grid, and again whenever a
+ * re-tabulation is needed. Going through `TFormula::Eval()` for each sample
+ * carries a large per-call overhead; this class compiles the expression once
+ * into a flat bytecode program (reverse Polish order) which is then run by a
+ * tight stack machine loop, with the parameter values baked in as constants.
+ *
+ * The supported grammar covers the expressions used for pulse shapes: the
+ * variable `x`, literal numbers, named parameters in square brackets
+ * (`[mu]`), the operators `+`, `-`, `*`, `/`, `^` and `**`, parentheses, and
+ * the usual one- and two-argument mathematical functions (`exp`, `log`,
+ * `sqrt`, `sin`, `pow`...). Compilation of an unsupported expression fails
+ * gracefully: the object becomes invalid and the caller is expected to keep
+ * evaluating through its fallback (e.g. the original `TFormula`).
+ */
+
+#ifndef ICARUSCODE_PMT_ALGORITHMS_COMPILEDPULSEEXPRESSION_H
+#define ICARUSCODE_PMT_ALGORITHMS_COMPILEDPULSEEXPRESSION_H
+
+// C++ standard library
+#include <cmath>
+#include <cctype> // std::isdigit(), std::isalpha()...
+#include <string>
+#include <utility> // std::pair, std::move()
+#include <vector>
+
+
+// -----------------------------------------------------------------------------
+namespace icarus::opdet { class CompiledPulseExpression; }
+
+/**
+ * @brief A mathematical expression of `x` compiled into stack machine code.
+ *
+ * Usage:
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * CompiledPulseExpression expr("[A] * exp(-(x - [mu])**2)", parameters);
+ * if (expr.isValid()) double y = expr.eval(2.5);
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ */
+class icarus::opdet::CompiledPulseExpression {
+
+    public:
+
+  /// Type of list of named parameter values.
+  using Parameters_t = std::vector<std::pair<std::string, double>>;
+
+  /// Default constructor: an invalid expression.
+  CompiledPulseExpression() = default;
+
+  /// Constructor: compiles `expression` with the specified parameter values.
+  CompiledPulseExpression
+    (std::string const& expression, Parameters_t const& parameters)
+    { fValid = compile(expression, parameters); }
+
+  /// Whether the compilation succeeded and `eval()` can be used.
+  bool isValid() const { return fValid; }
+
+  /// Evaluates the expression at the specified point.
+  double eval(double x) const
+    {
+      double stack[MaxStackDepth];
+      unsigned int top = 0U;
+      for (Instruction_t const& code: fProgram) {
+        switch (code.op) {
+          case Op_t::pushConst: stack[top++] = code.value; break;
+          case Op_t::pushVar:   stack[top++] = x; break;
+          case Op_t::add: --top; stack[top - 1U] += stack[top]; break;
+          case Op_t::sub: --top; stack[top - 1U] -= stack[top]; break;
+          case Op_t::mul: --top; stack[top - 1U] *= stack[top]; break;
+          case Op_t::div: --top; stack[top - 1U] /= stack[top]; break;
+          case Op_t::pow:
+            --top;
+            stack[top - 1U] = std::pow(stack[top - 1U], stack[top]);
+            break;
+          case Op_t::neg: stack[top - 1U] = -stack[top - 1U]; break;
+          case Op_t::call1:
+            stack[top - 1U] = code.fn1(stack[top - 1U]);
+            break;
+          case Op_t::call2:
+            --top;
+            stack[top - 1U] = code.fn2(stack[top - 1U], stack[top]);
+            break;
+        } // switch
+      } // for
+      return stack[0];
+    } // eval()
+
+
+    private:
+
+  /// Maximum depth of the evaluation stack (checked at compile time).
+  static constexpr unsigned int MaxStackDepth = 64U;
+
+  using Function1_t = double (*)(double);
+  using Function2_t = double (*)(double, double);
+
+  /// The operations of the stack machine.
+  enum class Op_t
+    { pushConst, pushVar, add, sub, mul, div, pow, neg, call1, call2 };
+
+  /// One instruction of the compiled program.
+  struct Instruction_t {
+    Op_t op;
+    double value = 0.0;       ///< Constant for `pushConst`.
+    Function1_t fn1 = nullptr; ///< Function for `call1`.
+    Function2_t fn2 = nullptr; ///< Function for `call2`.
+  }; // Instruction_t
+
+  std::vector<Instruction_t> fProgram; ///< The compiled program.
+
+  bool fValid = false; ///< Whether the program can be evaluated.
+
+  /// Returns the one-argument function named `name` (`nullptr` if unknown).
+  static Function1_t findFunction1(std::string const& name)
+    {
+      if (name == "exp")   return [](double v){ return std::exp(v); };
+      if (name == "log")   return [](double v){ return std::log(v); };
+      if (name == "log10") return [](double v){ return std::log10(v); };
+      if (name == "sqrt")  return [](double v){ return std::sqrt(v); };
+      if (name == "abs")   return [](double v){ return std::abs(v); };
+      if (name == "fabs")  return [](double v){ return std::abs(v); };
+      if (name == "sin")   return [](double v){ return std::sin(v); };
+      if (name == "cos")   return [](double v){ return std::cos(v); };
+      if (name == "tan")   return [](double v){ return std::tan(v); };
+      if (name == "asin")  return [](double v){ return std::asin(v); };
+      if (name == "acos")  return [](double v){ return std::acos(v); };
+      if (name == "atan")  return [](double v){ return std::atan(v); };
+      if (name == "sinh")  return [](double v){ return std::sinh(v); };
+      if (name == "cosh")  return [](double v){ return std::cosh(v); };
+      if (name == "tanh")  return [](double v){ return std::tanh(v); };
+      return nullptr;
+    } // findFunction1()
+
+  /// Returns the two-argument function named `name` (`nullptr` if unknown).
+  static Function2_t findFunction2(std::string const& name)
+    {
+      if (name == "pow")
+        return [](double a, double b){ return std::pow(a, b); };
+      if (name == "atan2")
+        return [](double a, double b){ return std::atan2(a, b); };
+      if (name == "min")
+        return [](double a, double b){ return (a < b)? a: b; };
+      if (name == "max")
+        return [](double a, double b){ return (a > b)? a: b; };
+      return nullptr;
+    } // findFunction2()
+
+  /**
+   * @brief Compiles `expression` into `fProgram` (shunting yard algorithm).
+   * @return whether the compilation succeeded
+   *
+   * Parameter references are replaced by their (constant) value, so the
+   * compiled program depends only on `x`.
+   */
+  bool compile(std::string const& expression, Parameters_t const& parameters)
+    {
+      fProgram.clear();
+
+      // one entry of the operator stack: either an operator, a function call
+      // pending its closing parenthesis, or an open parenthesis marker
+      struct OpEntry_t {
+        char symbol;               // '+','-','*','/','^','(','f','~' (unary -)
+        Function1_t fn1 = nullptr;
+        Function2_t fn2 = nullptr;
+      };
+
+      auto const precedence = [](char symbol) -> int
+        {
+          switch (symbol) {
+            case '^': return 4;
+            case '~': return 3; // unary minus: -x**2 must parse as -(x**2)
+            case '*': case '/': return 2;
+            case '+': case '-': return 1;
+            default:  return 0; // '(' and functions: never popped by operators
+          }
+        };
+
+      auto const rightAssociative
+        = [](char symbol){ return (symbol == '^') || (symbol == '~'); };
+
+      std::vector<OpEntry_t> opStack;
+
+      auto const popToProgram = [this, &opStack]()
+        {
+          OpEntry_t const entry = opStack.back();
+          opStack.pop_back();
+          switch (entry.symbol) {
+            case '+': fProgram.push_back({ Op_t::add }); break;
+            case '-': fProgram.push_back({ Op_t::sub }); break;
+            case '*': fProgram.push_back({ Op_t::mul }); break;
+            case '/': fProgram.push_back({ Op_t::div }); break;
+            case '^': fProgram.push_back({ Op_t::pow }); break;
+            case '~': fProgram.push_back({ Op_t::neg }); break;
+            case 'f':
+              if (entry.fn1)
+                fProgram.push_back({ Op_t::call1, 0.0, entry.fn1 });
+              else
+                fProgram.push_back({ Op_t::call2, 0.0, nullptr, entry.fn2 });
+              break;
+            default: break; // '(': nothing emitted
+          } // switch
+        };
+
+      std::size_t pos = 0U;
+      bool expectOperand = true; // whether the next token starts an operand
+
+      while (pos < expression.size()) {
+
+        char const c = expression[pos];
+
+        if (std::isspace(static_cast<unsigned char>(c))) { ++pos; continue; }
+
+        if (expectOperand) {
+
+          // --- operand position: number, parameter, variable, function, '(',
+          //     or a unary sign
+          if (std::isdigit(static_cast<unsigned char>(c)) || (c == '.')) {
+            std::size_t length = 0U;
+            double value;
+            try { value = std::stod(expression.substr(pos), &length); }
+            catch (...) { return false; }
+            fProgram.push_back({ Op_t::pushConst, value });
+            pos += length;
+            expectOperand = false;
+          }
+          else if (c == '[') { // parameter reference: bake in the value
+            std::size_t const close = expression.find(']', pos);
+            if (close == std::string::npos) return false;
+            std::string const name = expression.substr(pos + 1U, close - pos - 1U);
+            bool found = false;
+            for (auto const& [ parName, parValue ]: parameters) {
+              if (parName != name) continue;
+              fProgram.push_back({ Op_t::pushConst, parValue });
+              found = true;
+              break;
+            } // for
+            if (!found) return false;
+            pos = close + 1U;
+            expectOperand = false;
+          }
+          else if (std::isalpha(static_cast<unsigned char>(c)) || (c == '_')) {
+            std::size_t end = pos;
+            while ((end < expression.size())
+              && (std::isalnum(static_cast<unsigned char>(expression[end]))
+                || (expression[end] == '_'))
+              )
+              ++end;
+            std::string const name = expression.substr(pos, end - pos);
+            pos = end;
+            if ((end < expression.size()) && (expression[end] == '(')) {
+              // function call: push it, the '(' is consumed with it
+              OpEntry_t entry { 'f', findFunction1(name), findFunction2(name) };
+              if (!entry.fn1 && !entry.fn2) return false; // unknown function
+              opStack.push_back(entry);
+              opStack.push_back({ '(' });
+              ++pos;
+              // still expecting an operand (the function argument)
+            }
+            else if ((name == "x") || (name == "t")) {
+              fProgram.push_back({ Op_t::pushVar });
+              expectOperand = false;
+            }
+            else if (name == "pi") {
+              fProgram.push_back({ Op_t::pushConst, M_PI });
+              expectOperand = false;
+            }
+            else return false; // unknown identifier (e.g. TMath::...)
+          }
+          else if (c == '(') {
+            opStack.push_back({ '(' });
+            ++pos;
+          }
+          else if (c == '-') { // unary minus
+            opStack.push_back({ '~' });
+            ++pos;
+          }
+          else if (c == '+') { ++pos; } // unary plus: no effect
+          else return false;
+
+        }
+        else {
+
+          // --- operator position: binary operator, ')' or ','
+          if (c == ')') {
+            while (!opStack.empty() && (opStack.back().symbol != '('))
+              popToProgram();
+            if (opStack.empty()) return false; // unbalanced
+            opStack.pop_back(); // the '('
+            // a function call waiting right below gets emitted now
+            if (!opStack.empty() && (opStack.back().symbol == 'f'))
+              popToProgram();
+            ++pos;
+          }
+          else if (c == ',') { // argument separator of a two-argument function
+            while (!opStack.empty() && (opStack.back().symbol != '('))
+              popToProgram();
+            if (opStack.empty()) return false; // ',' outside a call
+            ++pos;
+            expectOperand = true;
+          }
+          else {
+            char symbol = c;
+            if ((c == '*') && (pos + 1U < expression.size())
+              && (expression[pos + 1U] == '*'))
+            {
+              symbol = '^'; // "**" is a power like in TFormula
+              ++pos;
+            }
+            if (precedence(symbol) == 0) return false; // not an operator
+            while (!opStack.empty()
+              && (precedence(opStack.back().symbol) > precedence(symbol)
+                || (precedence(opStack.back().symbol) == precedence(symbol)
+                  && !rightAssociative(symbol))
+                )
+              )
+              popToProgram();
+            opStack.push_back({ symbol });
+            ++pos;
+            expectOperand = true;
+          }
+
+        } // if operand/operator
+
+      } // while
+
+      if (expectOperand) return false; // dangling operator
+      while (!opStack.empty()) {
+        if (opStack.back().symbol == '(') return false; // unbalanced
+        popToProgram();
+      } // while
+
+      // verify the stack discipline (and the depth) once, so `eval()` doesn't
+      // have to
+      int depth = 0;
+      for (Instruction_t const& code: fProgram) {
+        switch (code.op) {
+          case Op_t::pushConst: case Op_t::pushVar: ++depth; break;
+          case Op_t::neg: case Op_t::call1:
+            if (depth < 1) return false;
+            break;
+          default: // all the binary operations
+            if (depth < 2) return false;
+            --depth;
+            break;
+        } // switch
+        if (depth > static_cast<int>(MaxStackDepth)) return false;
+      } // for
+      return depth == 1;
+
+    } // compile()
+
+}; // class icarus::opdet::CompiledPulseExpression
+
+
+// -----------------------------------------------------------------------------
+
+#endif // ICARUSCODE_PMT_ALGORITHMS_COMPILEDPULSEEXPRESSION_H
@@ -13,6 +13,7 @@
 
 // library header
 #include "icaruscode/PMT/Algorithms/PhotoelectronPulseFunction.h"
+#include "icaruscode/PMT/Algorithms/CompiledPulseExpression.h"
 
 // LArSoft libraries
 #include "lardataalg/Utilities/quantities/electronics.h" // counts_f
@@ -127,7 +128,11 @@ class icarus::opdet::CustomPulseFunction
 
 
   TFormula fFormula; ///< Formula of the shape.
-  
+
+  /// Expression compiled for fast evaluation; falls back to `fFormula` when
+  /// the expression uses syntax the compiler does not support.
+  CompiledPulseExpression fCompiled;
+
   PulseStats_t fStats; ///< Collected information about the pulse.
 
 
@@ -147,7 +152,11 @@ class icarus::opdet::CustomPulseFunction
    * at construction.
    */
   virtual ADCcount doEvaluateAt(Time time) const override
-    { return ADCcount::castFrom(fFormula.Eval(static_cast<double>(time))); }
+    {
+      double const t = static_cast<double>(time);
+      return ADCcount::castFrom
+        (fCompiled.isValid()? fCompiled.eval(t): fFormula.Eval(t));
+    }
 
   /// Returns the time at which the first peak is found.
   virtual Time doPeakTime() const override { return fStats.peakTime; }
@@ -243,6 +252,10 @@ icarus::opdet::CustomPulseFunction<T>::CustomPulseFunction(
   if (!msg.empty()) throw std::runtime_error("CustomPulseFunction:" + msg);
 
   setParameters(fFormula, parameters);
+
+  // compile the expression for fast evaluation during the sampling; on
+  // failure `fCompiled` stays invalid and evaluation goes through `fFormula`
+  fCompiled = CompiledPulseExpression{ expression, parameters };
 } // icarus::opdet::CustomPulseFunction<>::CustomPulseFunction(impl)
 
 
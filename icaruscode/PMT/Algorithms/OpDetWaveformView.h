@@ -0,0 +1,130 @@
+/**
+ * @file   icaruscode/PMT/Algorithms/OpDetWaveformView.h
+ * @brief  Non-owning view over a (sub)range of `raw::OpDetWaveform` samples.
+ */
+
+#ifndef ICARUSCODE_PMT_ALGORITHMS_OPDETWAVEFORMVIEW_H
+#define ICARUSCODE_PMT_ALGORITHMS_OPDETWAVEFORMVIEW_H
+
+// LArSoft libraries
+#include "lardataobj/RawData/OpDetWaveform.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::min()
+#include <cstddef> // std::size_t
+#include <limits>
+
+
+// -----------------------------------------------------------------------------
+namespace icarus { class OpDetWaveformView; }
+/**
+ * @brief Lightweight view of a contiguous range of optical waveform samples.
+ *
+ * The view carries the channel number, the timestamp of the original waveform
+ * and the offset of its first sample within it, plus a pointer and a size
+ * over the original samples: carving a sub-window out of a waveform (or out
+ * of another view) is plain pointer arithmetic, with no copy of the samples.
+ *
+ * A view never owns the data: the original `raw::OpDetWaveform` must outlive
+ * it. Ownership belongs at the data product boundary only, where
+ * `makeWaveform()` materializes the viewed samples into a new waveform.
+ *
+ * Example, processing the tail of each waveform without copying it:
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+ * icarus::OpDetWaveformView const view { waveform };
+ * auto const tail = view.subView(view.size() / 2U);
+ * auto const total = std::accumulate(tail.begin(), tail.end(), 0);
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ */
+class icarus::OpDetWaveformView {
+
+    public:
+
+  using Sample_t = raw::ADC_Count_t; ///< Type of one waveform sample.
+
+  /// Mnemonic for an invalid optical detector channel.
+  static constexpr raw::Channel_t InvalidChannel
+    = std::numeric_limits<raw::Channel_t>::max();
+
+  /// Default constructor: an empty view over an invalid channel.
+  OpDetWaveformView() = default;
+
+  /// Constructor: a view over all the samples of `waveform`.
+  OpDetWaveformView(raw::OpDetWaveform const& waveform)
+    : fChannel(waveform.ChannelNumber())
+    , fTimeStamp(waveform.TimeStamp())
+    , fData(waveform.data())
+    , fSize(waveform.size())
+    {}
+
+  /**
+   * @brief Returns a view over a sub-window of this one.
+   * @param offset index of the first sample of the window within this view
+   * @param span maximum number of samples in the window
+   * @return a view over the selected samples (empty if `offset` is past them)
+   *
+   * The window is clipped to the available samples; the offset of the
+   * returned view is measured from the start of the original waveform.
+   */
+  OpDetWaveformView subView
+    (std::size_t offset, std::size_t span = NoLimit) const
+    {
+      OpDetWaveformView window { *this };
+      window.fOffset += std::min(offset, fSize);
+      window.fData += (window.fOffset - fOffset);
+      window.fSize = std::min(fSize - (window.fOffset - fOffset), span);
+      return window;
+    }
+
+  // --- BEGIN -- Waveform information -----------------------------------------
+
+  /// Returns the optical detector channel of the viewed waveform.
+  raw::Channel_t channel() const { return fChannel; }
+
+  /// Returns the timestamp of the _original_ waveform (not of the window).
+  raw::TimeStamp_t timeStamp() const { return fTimeStamp; }
+
+  /// Returns the offset of the first viewed sample in the original waveform.
+  std::size_t offset() const { return fOffset; }
+
+  // --- END ---- Waveform information -----------------------------------------
+
+  // --- BEGIN -- Sample access ------------------------------------------------
+
+  std::size_t size() const { return fSize; }
+  bool empty() const { return fSize == 0U; }
+
+  Sample_t const* data() const { return fData; }
+  Sample_t const* begin() const { return fData; }
+  Sample_t const* end() const { return fData + fSize; }
+
+  Sample_t operator[] (std::size_t index) const { return fData[index]; }
+
+  // --- END ---- Sample access ------------------------------------------------
+
+  /// Returns a new waveform owning a copy of the viewed samples
+  /// (for the data product boundary only).
+  raw::OpDetWaveform makeWaveform() const
+    {
+      raw::OpDetWaveform waveform { fTimeStamp, fChannel, fSize };
+      waveform.assign(begin(), end());
+      return waveform;
+    }
+
+    private:
+
+  /// Special span value for "all the remaining samples".
+  static constexpr std::size_t NoLimit = ~std::size_t{ 0 };
+
+  raw::Channel_t fChannel = InvalidChannel; ///< Channel number.
+  raw::TimeStamp_t fTimeStamp {}; ///< Timestamp of the original waveform.
+  std::size_t fOffset = 0U; ///< First viewed sample in the original waveform.
+  Sample_t const* fData = nullptr; ///< Pointer to the first viewed sample.
+  std::size_t fSize = 0U; ///< Number of viewed samples.
+
+}; // class icarus::OpDetWaveformView
+
+
+// -----------------------------------------------------------------------------
+
+#endif // ICARUSCODE_PMT_ALGORITHMS_OPDETWAVEFORMVIEW_H
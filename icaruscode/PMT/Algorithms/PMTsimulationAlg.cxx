@@ -104,12 +104,17 @@ icarus::opdet::PMTsimulationAlg::PMTsimulationAlg
   , fQE(fParams.QEbase / fParams.larProp->ScintPreScale())
   , fSampling(fParams.clockData->OpticalClock().Frequency())
   , fNsamples(fParams.readoutEnablePeriod * fSampling) // us * MHz cancels out
-  , wsp( // NOTE: wsp amplitude already includes sign from polarity
-    *(fParams.pulseFunction),
-    fSampling,
-    fParams.pulseSubsamples, // tick subsampling
-    1.0e-4_ADCf // stop sampling when ADC counts are below this value
+  , fSampledPulse(fParams.sampledPulse
+    ? fParams.sampledPulse
+    : std::make_shared<DiscretePhotoelectronPulse const>(
+      // NOTE: wsp amplitude already includes sign from polarity
+      *(fParams.pulseFunction),
+      fSampling,
+      fParams.pulseSubsamples, // tick subsampling
+      1.0e-4_ADCf // stop sampling when ADC counts are below this value
+      )
     )
+  , wsp(*fSampledPulse)
   , fNoiseAdder(fParams.useFastElectronicsNoise
       ? &icarus::opdet::PMTsimulationAlg::AddNoise_faster
       : &icarus::opdet::PMTsimulationAlg::AddNoise
@@ -152,16 +157,68 @@ std::tuple<std::vector<raw::OpDetWaveform>, std::optional<sim::SimPhotons>>
 {
   std::optional<sim::SimPhotons> photons_used;
 
-  Waveform_t const waveform = CreateFullWaveform(photons, photons_used);
+  if (fParams.useSparseWaveforms) {
+    return {
+      CreateSparseWaveforms(photons.OpChannel(), photons, photons_used),
+      std::move(photons_used)
+      };
+  }
 
-  return {
-    CreateFixedSizeOpDetWaveforms(photons.OpChannel(), waveform),
-    std::move(photons_used)
-    };
-  
+  Waveform_t waveform = CreateFullWaveform(photons, photons_used);
+
+  std::tuple<std::vector<raw::OpDetWaveform>, std::optional<sim::SimPhotons>>
+    result {
+      CreateFixedSizeOpDetWaveforms(photons.OpChannel(), waveform),
+      std::move(photons_used)
+      };
+
+  stashWaveform(std::move(waveform)); // content committed: recycle the buffer
+
+  return result;
 } // icarus::opdet::PMTsimulationAlg::simulate()
 
 
+//------------------------------------------------------------------------------
+void icarus::opdet::PMTsimulationAlg::setRandomEngines(
+  CLHEP::HepRandomEngine* mainEngine,
+  CLHEP::HepRandomEngine* darkNoiseEngine,
+  CLHEP::HepRandomEngine* elecNoiseEngine
+) {
+  fParams.randomEngine = mainEngine;
+  fParams.gainRandomEngine = mainEngine;
+  fParams.darkNoiseRandomEngine = darkNoiseEngine;
+  fParams.elecNoiseRandomEngine = elecNoiseEngine;
+} // icarus::opdet::PMTsimulationAlg::setRandomEngines()
+
+
+//------------------------------------------------------------------------------
+void icarus::opdet::PMTsimulationAlg::setBufferStash
+  (WaveformBufferStash_t* stash)
+  { fBufferStash = stash; }
+
+
+//------------------------------------------------------------------------------
+auto icarus::opdet::PMTsimulationAlg::acquireWaveform
+  (std::size_t samples, ADCcount value) const -> Waveform_t
+{
+  if (fBufferStash && !fBufferStash->empty()) {
+    Waveform_t waveform = std::move(fBufferStash->back());
+    fBufferStash->pop_back();
+    waveform.assign(samples, value);
+    return waveform;
+  }
+  return Waveform_t(samples, value);
+} // icarus::opdet::PMTsimulationAlg::acquireWaveform()
+
+
+//------------------------------------------------------------------------------
+void icarus::opdet::PMTsimulationAlg::stashWaveform(Waveform_t&& waveform) const
+{
+  if (!fBufferStash) return;
+  fBufferStash->push_back(std::move(waveform));
+} // icarus::opdet::PMTsimulationAlg::stashWaveform()
+
+
 //------------------------------------------------------------------------------
 auto icarus::opdet::PMTsimulationAlg::makeGainFluctuator() const {
 
@@ -178,14 +235,12 @@ auto icarus::opdet::PMTsimulationAlg::makeGainFluctuator() const {
 
 
 //------------------------------------------------------------------------------
-auto icarus::opdet::PMTsimulationAlg::CreateFullWaveform
+auto icarus::opdet::PMTsimulationAlg::CollectPhotoelectrons
   (sim::SimPhotons const& photons, std::optional<sim::SimPhotons>& photons_used)
-  const -> Waveform_t
+  const -> PhotoelectronMaps_t
 {
 
     using namespace util::quantities::time_literals;
-    using namespace util::quantities::frequency_literals;
-    using namespace util::quantities::electronics_literals;
     using namespace detinfo::timescales;
 
     detinfo::DetectorTimings const& timings
@@ -201,14 +256,13 @@ auto icarus::opdet::PMTsimulationAlg::CreateFullWaveform
     // storage is by subtick group (vector index is the subtick), then by
     // tick (unordered map index is the tick number).
     //
-    std::vector<std::unordered_map<tick, unsigned int>> peMaps
-      (wsp.nSubsamples());
+    PhotoelectronMaps_t peMaps(wsp.nSubsamples());
 
     // returns tick and relative subtick number
     TimeToTickAndSubtickConverter const toTickAndSubtick(peMaps.size());
 
 //     auto start = std::chrono::high_resolution_clock::now();
-    
+
     if (photons_used) {
       photons_used->clear();
       photons_used->SetChannel(photons.OpChannel());
@@ -242,12 +296,29 @@ auto icarus::opdet::PMTsimulationAlg::CreateFullWaveform
 //     auto end = std::chrono::high_resolution_clock::now();
 //     std::chrono::duration<double> diff = end-start;
 //     std::cout << "\tcollected pes... " << photons.OpChannel() << " " << diff.count() << std::endl;
-//     start=std::chrono::high_resolution_clock::now();
+
+    return peMaps;
+  } // CollectPhotoelectrons()
+
+
+//------------------------------------------------------------------------------
+auto icarus::opdet::PMTsimulationAlg::CreateFullWaveform
+  (sim::SimPhotons const& photons, std::optional<sim::SimPhotons>& photons_used)
+  const -> Waveform_t
+{
+
+    using namespace util::quantities::frequency_literals;
+    using namespace util::quantities::electronics_literals;
+
+    PhotoelectronMaps_t const peMaps
+      = CollectPhotoelectrons(photons, photons_used);
+
+//     auto start = std::chrono::high_resolution_clock::now();
 
     //
     // add the collected photoelectrons to the waveform
     //
-    Waveform_t waveform(fNsamples, fParams.baseline);
+    Waveform_t waveform = acquireWaveform(fNsamples, fParams.baseline);
     
     unsigned int nTotalPE [[gnu::unused]] = 0U; // unused if not in `debug` mode
     double nTotalEffectivePE [[gnu::unused]] = 0U; // unused if not in `debug` mode
@@ -476,6 +547,252 @@ icarus::opdet::PMTsimulationAlg::CreateFixedSizeOpDetWaveforms
 } // icarus::opdet::PMTsimulationAlg::CreateFixedSizeOpDetWaveforms()
 
 
+//------------------------------------------------------------------------------
+std::vector<raw::OpDetWaveform>
+icarus::opdet::PMTsimulationAlg::CreateSparseWaveforms(
+  raw::Channel_t opChannel,
+  sim::SimPhotons const& photons,
+  std::optional<sim::SimPhotons>& photons_used
+) const {
+  /*
+   * Plan:
+   *
+   * 1. collect the photoelectrons as in the full waveform case
+   * 2. mark the stretches of the readout with activity on them, padded by a
+   *    full readout buffer, and merge them into disjoint segments
+   * 3. simulate each segment as a short waveform of its own (photoelectrons,
+   *    noise, saturation); the gaps in between stay pure pedestal and are
+   *    never stored
+   * 4. find the triggers segment by segment and cut the readout buffers as
+   *    in `CreateFixedSizeOpDetWaveforms()`, synthesizing pedestal for the
+   *    (rare) parts of a buffer reaching outside all segments
+   *
+   */
+
+  using namespace util::quantities::frequency_literals;
+  using namespace util::quantities::electronics_literals;
+  using namespace detinfo::timescales;
+
+  detinfo::DetectorTimings const& timings
+    = detinfo::makeDetectorTimings(fParams.clockData);
+
+  PhotoelectronMaps_t const peMaps
+    = CollectPhotoelectrons(photons, photons_used);
+
+  std::size_t const pretrigSize = fParams.pretrigSize();
+  std::size_t const posttrigSize = fParams.posttrigSize();
+
+  //
+  // active stretches: each photoelectron covers its pulse plus one full
+  // readout buffer of margin on either side, so that any self-trigger it can
+  // cause finds simulated samples for its whole buffer
+  //
+  using TickRange_t = std::pair<std::size_t, std::size_t>;
+  std::vector<TickRange_t> ranges;
+  for (auto const& [ iSubsample, peMap ]: util::enumerate(peMaps)) {
+    std::size_t const pulseSize = wsp.subsample(iSubsample).size();
+    for (auto const& [ startTick, nPE ]: peMap) {
+      std::size_t const start = startTick.value();
+      ranges.emplace_back(
+        (start > pretrigSize)? (start - pretrigSize): 0U,
+        std::min(start + pulseSize + posttrigSize, fNsamples)
+        );
+    } // for sample
+  } // for subsamples
+
+  // the beam gate readout is unconditional: keep those stretches alive too,
+  // so that their buffers carry electronics noise like in the full waveform
+  if (fParams.createBeamGateTriggers) {
+    for (optical_tick const trigTick: CreateBeamGateTriggers()) {
+      std::size_t const trig = static_cast<std::size_t>(trigTick.value());
+      ranges.emplace_back(
+        (trig > pretrigSize)? (trig - pretrigSize): 0U,
+        std::min(trig + posttrigSize, fNsamples)
+        );
+    } // for beam gate triggers
+  }
+
+  std::vector<raw::OpDetWaveform> output_opdets;
+  if (ranges.empty()) return output_opdets;
+
+  // merge overlapping stretches into disjoint segments, in time order
+  std::sort(ranges.begin(), ranges.end());
+  std::vector<TickRange_t> segmentRanges;
+  segmentRanges.push_back(ranges.front());
+  for (TickRange_t const& range: ranges) {
+    if (range.first <= segmentRanges.back().second) {
+      segmentRanges.back().second
+        = std::max(segmentRanges.back().second, range.second);
+    }
+    else segmentRanges.push_back(range);
+  } // for ranges
+
+  //
+  // simulate each segment independently; this is the only waveform data ever
+  // allocated, so memory scales with the activity instead of `fNsamples`
+  //
+  auto const ADCrange = fParams.ADCrange();
+
+  auto gainFluctuation = makeGainFluctuator();
+
+  std::vector<Waveform_t> segments;
+  segments.reserve(segmentRanges.size());
+
+  for (auto const& [ segStart, segEnd ]: segmentRanges) {
+
+    Waveform_t& segment
+      = segments.emplace_back(acquireWaveform(segEnd - segStart, fParams.baseline));
+
+    // add the photoelectrons landing on this segment; their full pulse is
+    // contained in it by construction of the margins above
+    for (auto const& [ iSubsample, peMap ]: util::enumerate(peMaps)) {
+      auto const& subsample = wsp.subsample(iSubsample);
+      for (auto const& [ startTick, nPE ]: peMap) {
+        std::size_t const start = startTick.value();
+        if ((start < segStart) || (start >= segEnd)) continue;
+        double const nEffectivePE = gainFluctuation(nPE);
+        AddPhotoelectrons(
+          subsample, segment, tick::castFrom(start - segStart),
+          static_cast<WaveformValue_t>(nEffectivePE)
+          );
+      } // for sample
+    } // for subsamples
+
+    if (fParams.ampNoise > 0.0_ADCf) (this->*fNoiseAdder)(segment);
+    if (fParams.darkNoiseRate > 0.0_Hz) AddDarkNoise(segment);
+
+    ApplySaturation(segment, ADCrange);
+    ClipWaveform(segment, ADCrange.first, ADCrange.second);
+
+  } // for segments
+
+  //
+  // find the triggers; the gaps are pedestal by construction, so scanning
+  // only the segments gives the same result as scanning the full waveform
+  // (except for triggers from noise alone, which this mode forgoes)
+  //
+  std::vector<optical_tick> trigger_locations;
+  for (auto const& [ iSegment, segment ]: util::enumerate(segments)) {
+    std::size_t const segStart = segmentRanges[iSegment].first;
+    bool above_thresh = false;
+    for (std::size_t i_t = 0; i_t < segment.size(); ++i_t) {
+
+      auto const val { fParams.pulsePolarity* (segment[i_t]-fParams.baseline) };
+
+      if (!above_thresh && val >= fParams.thresholdADC) {
+        above_thresh = true;
+        trigger_locations.push_back(optical_tick::castFrom(segStart + i_t));
+      }
+      else if (above_thresh && val < fParams.thresholdADC) {
+        above_thresh = false;
+      }
+
+    } // for ticks in segment
+  } // for segments
+
+  // next, add the triggers injected at beam gate time
+  if (fParams.createBeamGateTriggers) {
+    auto beamGateTriggers = CreateBeamGateTriggers();
+
+    // insert the new triggers and sort them
+    trigger_locations.insert(trigger_locations.end(),
+      beamGateTriggers.begin(), beamGateTriggers.end());
+    std::inplace_merge(
+      trigger_locations.begin(),
+      trigger_locations.end() - beamGateTriggers.size(),
+      trigger_locations.end()
+      );
+  }
+
+  //
+  // collect all buffer ranges and merge them
+  // (same algorithm as in `CreateFixedSizeOpDetWaveforms()`)
+  //
+  auto const pretrigTicks = optical_time_ticks::castFrom(pretrigSize);
+  auto const posttrigTicks = optical_time_ticks::castFrom(posttrigSize);
+
+  optical_tick const firstTick { 0 };
+
+  auto const tend = trigger_locations.end();
+
+  auto tooEarlyTrigger = [earliest = firstTick + pretrigTicks](optical_tick t)
+    { return t < earliest; };
+  auto iNextTrigger
+    = std::find_if_not(trigger_locations.begin(), tend, tooEarlyTrigger);
+
+  using BufferRange_t = OpDetWaveformMaker_t::BufferRange_t;
+  auto makeBuffer
+    = [pretrigTicks, posttrigTicks](optical_tick triggerTime) -> BufferRange_t
+    { return { triggerTime - pretrigTicks, triggerTime + posttrigTicks }; }
+    ;
+
+  std::vector<BufferRange_t> buffers;
+  buffers.reserve(std::distance(iNextTrigger, tend)); // worst case
+
+  auto earliestBufferStart { firstTick };
+  while (iNextTrigger != tend) {
+
+    BufferRange_t const buffer = makeBuffer(*iNextTrigger);
+
+    if (buffer.first < earliestBufferStart) { // extend the previous buffer
+      assert(!buffers.empty()); // guaranteed because we skipped early triggers
+      buffers.back().second = buffer.second;
+    }
+    else buffers.emplace_back(buffer);
+
+    earliestBufferStart = buffer.second;
+
+    ++iNextTrigger;
+  } // while
+
+  //
+  // turn each buffer into a waveform, stitching the segments it covers and
+  // synthesizing pedestal for any stretch outside all of them
+  //
+  MF_LOG_TRACE("PMTsimulationAlg")
+    << "Channel #" << opChannel << ": " << buffers.size() << " waveforms for "
+    << trigger_locations.size() << " triggers on " << segments.size()
+    << " sparse segments";
+
+  // use hardware trigger time plus the configured offset as waveform start time
+  electronics_time const PMTstartTime
+    = timings.TriggerTime() + time_interval{ fParams.triggerOffsetPMT };
+  util::quantities::nanosecond const samplingPeriod { 1.0 / fSampling };
+
+  auto const pedestal = raw::ADC_Count_t(fParams.baseline.value());
+
+  for (BufferRange_t const& buffer: buffers) {
+
+    std::size_t const start
+      = std::min(std::size_t(buffer.first.value()), fNsamples);
+    std::size_t const end
+      = std::min(std::size_t(buffer.second.value()), fNsamples);
+    assert(start <= end);
+
+    raw::TimeStamp_t const timeStamp { PMTstartTime + start * samplingPeriod };
+
+    raw::OpDetWaveform outputWaveform(timeStamp, opChannel, end - start);
+    outputWaveform.resize(end - start, pedestal);
+
+    for (auto const& [ iSegment, segment ]: util::enumerate(segments)) {
+      auto const [ segStart, segEnd ] = segmentRanges[iSegment];
+      std::size_t const from = std::max(start, segStart);
+      std::size_t const to = std::min(end, segEnd);
+      for (std::size_t i = from; i < to; ++i)
+        outputWaveform[i - start] = segment[i - segStart].value();
+    } // for segments
+
+    output_opdets.push_back(std::move(outputWaveform));
+
+  } // for buffers
+
+  // the segment content is committed to the output: recycle the buffers
+  for (Waveform_t& segment: segments) stashWaveform(std::move(segment));
+
+  return output_opdets;
+} // icarus::opdet::PMTsimulationAlg::CreateSparseWaveforms()
+
+
 // -----------------------------------------------------------------------------
 bool icarus::opdet::PMTsimulationAlg::KicksPhotoelectron() const
   { return CLHEP::RandFlat::shoot(fParams.randomEngine) < fQE; }
@@ -489,39 +806,31 @@ void icarus::opdet::PMTsimulationAlg::AddPhotoelectrons(
 
   if (n == 0.0) return;
 
+  std::size_t const min = time_bin.value();
+  std::size_t const max = std::min(min + pulse.size(), wave.size());
+  if (min >= max) return;
+
+  std::size_t const nSamples = max - min;
+
+  // both sequences are contiguous arrays of plain floating point samples;
+  // indexing bare pointers with the scaling factor hoisted out of the loop
+  // lets the optimizer turn the accumulation into packed additions, which
+  // matters when a flash piles thousands of photoelectrons on one channel
+  ADCcount*       const destPtr  = wave.data() + min;
+  ADCcount const* const pulsePtr = pulse.data();
+
   if (n == 1.0) {
     // simple addition
-    AddPulseShape(pulse, wave, time_bin, std::plus<ADCcount>());
+    for (std::size_t i = 0U; i < nSamples; ++i) destPtr[i] += pulsePtr[i];
   }
   else {
     // multiply each `pulse` sample by `n`:
-    AddPulseShape(pulse, wave, time_bin, [n](auto a, auto b) { return a+n*b; });
+    for (std::size_t i = 0U; i < nSamples; ++i) destPtr[i] += n * pulsePtr[i];
   }
 
 } // icarus::opdet::PMTsimulationAlg::AddPhotoelectrons()
 
 
-// -----------------------------------------------------------------------------
-template <typename Combine>
-void icarus::opdet::PMTsimulationAlg::AddPulseShape(
-  PulseSampling_t const& pulse, Waveform_t& wave, tick const time_bin,
-  Combine combination
-  ) const
-{
-  std::size_t const min = time_bin.value();
-  std::size_t const max = std::min(min + pulse.size(), fNsamples);
-  if (min >= max) return;
-
-  std::transform(
-    wave.begin() + min, wave.begin() + max,
-    pulse.begin(),
-    wave.begin() + min,
-    combination
-    );
-
-} // icarus::opdet::PMTsimulationAlg::AddPulseShape()
-
-
 // -----------------------------------------------------------------------------
 void icarus::opdet::PMTsimulationAlg::AddNoise(Waveform_t& wave) const {
 
@@ -761,6 +1070,11 @@ icarus::opdet::PMTsimulationAlgMaker::PMTsimulationAlgMaker
   fBaseConfig.ampNoise                 = ADCcount(config.AmpNoise());
   fBaseConfig.useFastElectronicsNoise  = config.FastElectronicsNoise();
 
+  //
+  // waveform memory handling
+  //
+  fBaseConfig.useSparseWaveforms       = config.SparseWaveforms();
+
   //
   // trigger
   //
@@ -844,6 +1158,10 @@ auto icarus::opdet::PMTsimulationAlgMaker::makeParams(
   params.clockData = &clockData;
 
   params.pulseFunction = &SPRfunction;
+  params.sampledPulse = sampledPulse(
+    SPRfunction,
+    util::quantities::megahertz{ clockData.OpticalClock().Frequency() }
+    );
 
   params.randomEngine = &mainRandomEngine;
   params.gainRandomEngine = params.randomEngine;
@@ -868,8 +1186,37 @@ auto icarus::opdet::PMTsimulationAlgMaker::makeParams(
   } // check polarity consistency
 
   return params;
-  
+
 } // icarus::opdet::PMTsimulationAlgMaker::create()
 
 
+//-----------------------------------------------------------------------------
+auto icarus::opdet::PMTsimulationAlgMaker::sampledPulse(
+  SinglePhotonResponseFunc_t const& SPRfunction,
+  util::quantities::megahertz samplingFreq
+  ) const -> std::shared_ptr<DiscretePhotoelectronPulse const>
+{
+  std::lock_guard lock { fSampledPulseMutex };
+
+  // the sampling is repeated only if the response function or the sampling
+  // frequency are not the ones the cached pulse was sampled with
+  if (!fSampledPulse
+    || (fSampledPulseFunc != &SPRfunction)
+    || (fSampledPulseFreq != samplingFreq)
+    )
+  {
+    fSampledPulse = std::make_shared<DiscretePhotoelectronPulse const>(
+      SPRfunction,
+      samplingFreq,
+      fBaseConfig.pulseSubsamples, // tick subsampling
+      1.0e-4_ADCf // stop sampling when ADC counts are below this value
+      );
+    fSampledPulseFunc = &SPRfunction;
+    fSampledPulseFreq = samplingFreq;
+  }
+
+  return fSampledPulse;
+} // icarus::opdet::PMTsimulationAlgMaker::sampledPulse()
+
+
 //-----------------------------------------------------------------------------
@@ -47,9 +47,11 @@
 #include <string>
 #include <tuple>
 #include <optional>
+#include <unordered_map>
 #include <ios> // std::boolalpha
 #include <utility> // std::forward()
-#include <memory> // std::unique_ptr()
+#include <memory> // std::unique_ptr(), std::shared_ptr
+#include <mutex>
 #include <functional> // std::plus
 #include <cmath> // std::abs(), std::exp()
 #include <cstdlib> // std::size_t
@@ -439,6 +441,9 @@ class icarus::opdet::PMTsimulationAlg {
     float saturation; //equivalent to the number of p.e. that saturates the electronic signal
     PMTspecs_t PMTspecs; ///< PMT specifications.
     bool doGainFluctuations; ///< Whether to simulate fain fluctuations.
+    /// Whether to simulate only the active stretches of the waveform
+    /// (the gaps between them are treated as pure pedestal).
+    bool useSparseWaveforms = false;
     /// @}
 
     /// @{
@@ -452,6 +457,10 @@ class icarus::opdet::PMTsimulationAlg {
     /// Single photon response function.
     SinglePhotonResponseFunc_t const* pulseFunction;
 
+    /// Sampled single photon response, shared among algorithm instances;
+    /// if null, the algorithm samples `pulseFunction` on construction.
+    std::shared_ptr<DiscretePhotoelectronPulse const> sampledPulse = nullptr;
+
     /// Main random stream engine.
     CLHEP::HepRandomEngine* randomEngine = nullptr;
 
@@ -507,6 +516,44 @@ class icarus::opdet::PMTsimulationAlg {
   std::tuple<std::vector<raw::OpDetWaveform>, std::optional<sim::SimPhotons>>
     simulate(sim::SimPhotons const& photons);
 
+  /**
+   * @brief Replaces the random engines used by the algorithm.
+   * @param mainEngine main random engine (quantum efficiency, gain)
+   * @param darkNoiseEngine random engine for dark noise simulation
+   * @param elecNoiseEngine random engine for electronics noise simulation
+   *
+   * This allows a caller owning dedicated random engines (e.g. one set per
+   * channel) to reuse the same algorithm instance, which retains the sampled
+   * single photon response, instead of constructing a new one.
+   */
+  void setRandomEngines(
+    CLHEP::HepRandomEngine* mainEngine,
+    CLHEP::HepRandomEngine* darkNoiseEngine,
+    CLHEP::HepRandomEngine* elecNoiseEngine
+    );
+
+  /// Type of stash of reusable waveform sample buffers
+  /// (see `setBufferStash()`).
+  using WaveformBufferStash_t = std::vector<std::vector<ADCcount>>;
+
+  /**
+   * @brief Borrows a stash of sample buffers to recycle across channels.
+   * @param stash the stash to draw buffers from and return them to
+   *
+   * Waveform sample buffers are the dominant allocation of this simulation.
+   * When a stash is set, the algorithm draws its working buffers from it and
+   * returns them as soon as their content has been committed to the output:
+   * a caller keeping the stash alive across events pays the allocation cost
+   * only on the busiest event seen so far. Only the buffer memory is
+   * recycled; the stashed content is always overwritten before use.
+   * The sample buffers eventually moved into `raw::OpDetWaveform` products
+   * belong to the framework and are never recovered.
+   *
+   * The stash is accessed without protection: it must not be shared between
+   * algorithm instances running concurrently.
+   */
+  void setBufferStash(WaveformBufferStash_t* stash);
+
   /// Prints the configuration into the specified output stream.
   template <typename Stream>
   void printConfiguration(Stream&& out, std::string indent = "") const;
@@ -528,6 +575,10 @@ class icarus::opdet::PMTsimulationAlg {
   /// Type of member function to add electronics noise.
   using NoiseAdderFunc_t = void (PMTsimulationAlg::*)(Waveform_t&) const;
 
+  /// Number of photoelectrons per tick, grouped by subtick
+  /// (see `CollectPhotoelectrons()`).
+  using PhotoelectronMaps_t = std::vector<std::unordered_map<tick, unsigned int>>;
+
 
   // --- BEGIN -- Helper functors ----------------------------------------------
   /// Functor to convert tick point into a tick number and a subsample index.
@@ -579,10 +630,20 @@ class icarus::opdet::PMTsimulationAlg {
   megahertz fSampling;   ///< Wave sampling frequency [MHz].
   std::size_t fNsamples; ///< Samples per waveform.
   
-  DiscretePhotoelectronPulse wsp; /// Single photon pulse (sampled).
+  /// Keeps the sampled single photon pulse alive; the sampling is expensive
+  /// (especially for `TFormula`-based shapes) and the result depends only on
+  /// the response function and the sampling frequency, so the same sampled
+  /// pulse may be shared among many algorithm instances.
+  std::shared_ptr<DiscretePhotoelectronPulse const> fSampledPulse;
+
+  DiscretePhotoelectronPulse const& wsp; /// Single photon pulse (sampled).
 
   NoiseAdderFunc_t const fNoiseAdder; ///< Selected electronics noise method.
 
+  /// Reusable waveform sample buffers lent by the caller (optional;
+  /// see `setBufferStash()`).
+  WaveformBufferStash_t* fBufferStash = nullptr;
+
   ///< Transformation uniform to Gaussian for electronics noise.
   static util::FastAndPoorGauss<32768U, float> const fFastGauss;
 
@@ -608,7 +669,50 @@ class icarus::opdet::PMTsimulationAlg {
     sim::SimPhotons const& photons,
     std::optional<sim::SimPhotons>& photons_used
     ) const;
-  
+
+  /**
+   * @brief Collects the photoelectrons from `photons`, by tick and subtick.
+   * @param photons the simulated list of photoelectrons
+   * @param photons_used (_output_) list of used photoelectrons
+   * @return photoelectron counts indexed by subtick, then by tick
+   *
+   * Quantum efficiency is applied here, so that the same random sequence is
+   * consumed regardless of the downstream waveform representation.
+   * The returned storage is by subtick group (vector index is the subtick),
+   * then by tick (unordered map key is the tick number).
+   */
+  PhotoelectronMaps_t CollectPhotoelectrons(
+    sim::SimPhotons const& photons,
+    std::optional<sim::SimPhotons>& photons_used
+    ) const;
+
+  /**
+   * @brief Creates `raw::OpDetWaveform` objects without a full length waveform.
+   * @param opChannel number of optical detector channel the data belongs to
+   * @param photons the simulated list of photoelectrons
+   * @param photons_used (_output_) list of used photoelectrons
+   * @return a collection of digitised `raw::OpDetWaveform` objects
+   *
+   * Sparse counterpart of `CreateFullWaveform()` plus
+   * `CreateFixedSizeOpDetWaveforms()`, enabled by the `SparseWaveforms`
+   * configuration parameter: only the stretches of the readout with activity
+   * on them (each photoelectron pulse and each beam gate readout window,
+   * padded by a full readout buffer) are simulated, as a list of independent
+   * segments; the gaps in between are known to be pure pedestal, are never
+   * stored and are synthesized on demand if a readout buffer reaches into
+   * them. Memory scales with the signal actually present on the channel
+   * rather than with the readout enable period.
+   *
+   * The price is that electronics and dark noise exist only within the
+   * active segments: readout windows triggered by noise alone in otherwise
+   * quiet stretches of the waveform are not produced in this mode.
+   */
+  std::vector<raw::OpDetWaveform> CreateSparseWaveforms(
+    raw::Channel_t opChannel,
+    sim::SimPhotons const& photons,
+    std::optional<sim::SimPhotons>& photons_used
+    ) const;
+
   /**
    * @brief Creates `raw::OpDetWaveform` objects from a waveform data.
    * @param opChannel number of optical detector channel the data belongs to
@@ -667,26 +771,6 @@ class icarus::opdet::PMTsimulationAlg {
     (raw::Channel_t opChannel, Waveform_t const& waveform) const;
   
   
-  /**
-   * @brief Adds a pulse to a waveform, starting at a given tick.
-   * @tparam Combine binary operation combining two ADC counts into one
-   * @param pulse the sampling to add to the waveform
-   * @param wave the waveform the pulse will be added to
-   * @param time_bin the tick of the waveform where the pulse starts
-   * @param combination how to combine the pulse and the waveform
-   *
-   * This is the internal implementation of `AddPhotoelectrons()`.
-   *
-   * The `combination` functor behaves as a binary function taking the
-   * existing `wave` sample and the sample from the `pulse` at the same time
-   * and returning their combination as a new sample value.
-   */
-  template <typename Combine>
-  void AddPulseShape(
-    PulseSampling_t const& pulse, Waveform_t& wave, tick const time_bin,
-    Combine combination
-    ) const;
-  
   /**
    * @brief Adds a number of pulses to a waveform, starting at a given tick.
    * @param pulse the sampling to add, scaled, to the waveform
@@ -702,6 +786,11 @@ class icarus::opdet::PMTsimulationAlg {
    * photoelectron pulse shape. The waveform is also a sequence of samples
    * representing a optical detector channel digitized waveform, starting at
    * tick #0.
+   *
+   * The photoelectrons landing on the same subtick have already been merged
+   * (see `CreateFullWaveform()`), so this accumulation runs once per distinct
+   * arrival time; it is written as a single pass over the underlying sample
+   * values in a form the optimizer can vectorize.
    */
   void AddPhotoelectrons(
     PulseSampling_t const& pulse, Waveform_t& wave, tick const time_bin,
@@ -777,6 +866,13 @@ class icarus::opdet::PMTsimulationAlg {
   
   /// Forces `waveform` ADC within the `min` to `max` range (`max` included).
   static void ClipWaveform(Waveform_t& waveform, ADCcount min, ADCcount max);
+
+  /// Returns a waveform of `samples` samples set to `value`, reusing a
+  /// stashed buffer when one is available.
+  Waveform_t acquireWaveform(std::size_t samples, ADCcount value) const;
+
+  /// Returns the memory of `waveform` to the stash (if any) for later reuse.
+  void stashWaveform(Waveform_t&& waveform) const;
   
   
 }; // class PMTsimulationAlg
@@ -914,6 +1010,18 @@ class icarus::opdet::PMTsimulationAlgMaker {
       true
       };
 
+    //
+    // waveform memory handling
+    //
+    fhicl::Atom<bool> SparseWaveforms {
+      Name("SparseWaveforms"),
+      Comment(
+        "simulate and keep in memory only the stretches of waveform with"
+        " activity on them (the gaps in between are treated as pure pedestal)"
+        ),
+      false
+      };
+
     //
     // trigger
     //
@@ -989,6 +1097,12 @@ class icarus::opdet::PMTsimulationAlgMaker {
    * 
    * All random engines are required in this interface, even if the
    * configuration disabled noise simulation.
+   *
+   * The sampling of the single photon response function is performed only on
+   * the first call (and whenever `SPRfunction` or the optical clock frequency
+   * changes): all the data structures returned by this maker share the same
+   * sampled pulse. The response function must stay valid for as long as any
+   * of the created algorithms is in use.
    */
   PMTsimulationAlg::ConfigurationParameters_t makeParams(
     detinfo::LArProperties const& larProp,
@@ -1004,6 +1118,36 @@ class icarus::opdet::PMTsimulationAlgMaker {
   /// Part of the configuration learned from configuration files.
   PMTsimulationAlg::ConfigurationParameters_t fBaseConfig;
 
+  // --- BEGIN -- Sampled pulse cache ------------------------------------------
+  /// @name Sampled pulse cache
+  ///
+  /// Sampling the single photon response is expensive (seconds, for
+  /// `TFormula`-based shapes), while its result depends only on the response
+  /// function and on the optical clock frequency: the pulse is sampled on the
+  /// first request and then shared among all the created algorithm instances.
+  /// @{
+
+  /// Cached sampled single photon pulse.
+  mutable std::shared_ptr<DiscretePhotoelectronPulse const> fSampledPulse;
+
+  /// Response function the cached pulse was sampled from.
+  mutable SinglePhotonResponseFunc_t const* fSampledPulseFunc = nullptr;
+
+  /// Sampling frequency of the cached pulse.
+  mutable util::quantities::megahertz fSampledPulseFreq { 0.0 };
+
+  /// Protects the cache (`makeParams()` may be called concurrently).
+  mutable std::mutex fSampledPulseMutex;
+
+  /// @}
+  // --- END -- Sampled pulse cache --------------------------------------------
+
+  /// Returns the sampled `SPRfunction`, from the cache when possible.
+  std::shared_ptr<DiscretePhotoelectronPulse const> sampledPulse(
+    SinglePhotonResponseFunc_t const& SPRfunction,
+    util::quantities::megahertz samplingFreq
+    ) const;
+
 }; // class PMTsimulationAlgMaker
 
 
@@ -1080,6 +1224,8 @@ void icarus::opdet::PMTsimulationAlg::printConfiguration
     out << " (subsampling: x" << fParams.pulseSubsamples << ")";
   out
     << '\n' << indent << "Samples/waveform:    " << fNsamples << " ticks"
+    << '\n' << indent << "Sparse waveforms:    "
+      << std::boolalpha << fParams.useSparseWaveforms
     << '\n' << indent << "Gain at first stage: " << fParams.PMTspecs.firstStageGain()
     ;
 
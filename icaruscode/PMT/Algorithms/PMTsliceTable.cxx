@@ -0,0 +1,33 @@
+/**
+ * @file   icaruscode/PMT/Algorithms/PMTsliceTable.cxx
+ * @brief  Frozen table of PMT vertical slices (implementation file).
+ * @author Gianluca Petrillo (petrillo@slac.stanford.edu)
+ * @date   August 31, 2026
+ * @see    icaruscode/PMT/Algorithms/PMTsliceTable.h
+ */
+
+// library header
+#include "icaruscode/PMT/Algorithms/PMTsliceTable.h"
+
+
+//------------------------------------------------------------------------------
+icarus::trigger::PMTsliceTable::PMTsliceTable
+  (std::vector<std::vector<std::vector<raw::Channel_t>>> const& slices)
+{
+  for (auto const& planeSlices: slices) {
+    for (auto const& sliceChannels: planeSlices) {
+      for (raw::Channel_t const channel: sliceChannels) {
+        fChannels.push_back(channel);
+        std::size_t const index = static_cast<std::size_t>(channel);
+        if (index >= fChannelToSlice.size())
+          fChannelToSlice.resize(index + 1U, InvalidSlice);
+        fChannelToSlice[index] = nSlices(); // index of the slice being frozen
+      } // for channels
+      fSliceOffsets.push_back(fChannels.size());
+    } // for slices in plane
+    fPlaneOffsets.push_back(nSlices());
+  } // for planes
+} // icarus::trigger::PMTsliceTable::PMTsliceTable()
+
+
+//------------------------------------------------------------------------------
@@ -0,0 +1,116 @@
+/**
+ * @file   icaruscode/PMT/Algorithms/PMTsliceTable.h
+ * @brief  Frozen table of PMT vertical slices ("towers") by channel.
+ * @author Gianluca Petrillo (petrillo@slac.stanford.edu)
+ * @date   August 31, 2026
+ * @see    icaruscode/PMT/Algorithms/PMTsliceTable.cxx
+ */
+
+#ifndef ICARUSCODE_PMT_ALGORITHMS_PMTSLICETABLE_H
+#define ICARUSCODE_PMT_ALGORITHMS_PMTSLICETABLE_H
+
+// LArSoft libraries
+#include "larcorealg/CoreUtils/span.h" // util::span
+#include "lardataobj/RawData/OpDetWaveform.h" // raw::Channel_t
+
+// C/C++ standard libraries
+#include <limits>
+#include <vector>
+#include <cstddef> // std::size_t
+
+
+//------------------------------------------------------------------------------
+namespace icarus::trigger { class PMTsliceTable; }
+/**
+ * @brief Frozen result of PMT vertical slicing, in terms of readout channels.
+ *
+ * The table stores the outcome of `icarus::trigger::PMTverticalSlicingAlg`
+ * reduced to optical detector channel numbers: the channels of each slice
+ * (vertical PMT "tower") are laid out contiguously, slices are sorted plane by
+ * plane ("wall" by "wall"), and a reverse index from channel to slice is also
+ * kept. Since the slicing depends only on the detector geometry, which is
+ * frozen within a job, the table can be computed once and shared by all the
+ * algorithms needing the slices (see
+ * `icarus::trigger::PMTverticalSlicingAlg::sliceTable()`), which then perform
+ * only plain array lookups instead of repeating the geometry sorting.
+ *
+ * All accessors are simple inline lookups with no geometry involved.
+ */
+class icarus::trigger::PMTsliceTable {
+
+    public:
+
+  /// Type of the channel content of one slice: a view over the channel list.
+  using ChannelSpan_t
+    = util::span<std::vector<raw::Channel_t>::const_iterator>;
+
+  /// Special slice index denoting a channel not in any slice.
+  static constexpr unsigned int InvalidSlice
+    = std::numeric_limits<unsigned int>::max();
+
+
+  /// Default constructor: an empty table.
+  PMTsliceTable() = default;
+
+  /// Constructor: freezes the specified slices (plane by plane, each plane a
+  /// list of slices, each slice a list of channels).
+  explicit PMTsliceTable
+    (std::vector<std::vector<std::vector<raw::Channel_t>>> const& slices);
+
+
+  // --- BEGIN Queries ---------------------------------------------------------
+  /// @name Queries
+  /// @{
+
+  /// Returns the number of optical detector planes ("walls") in the table.
+  unsigned int nPlanes() const { return fPlaneOffsets.size() - 1U; }
+
+  /// Returns the total number of slices in the table, all planes included.
+  unsigned int nSlices() const { return fSliceOffsets.size() - 1U; }
+
+  /// Returns the index of the first slice of the specified `plane`
+  /// (`plane` may also be `nPlanes()`, yielding the end of the last plane).
+  unsigned int firstSliceOfPlane(unsigned int plane) const
+    { return fPlaneOffsets[plane]; }
+
+  /// Returns the channels of the slice with the specified index.
+  ChannelSpan_t sliceChannels(unsigned int slice) const
+    {
+      return {
+        fChannels.begin() + fSliceOffsets[slice],
+        fChannels.begin() + fSliceOffsets[slice + 1U]
+        };
+    }
+
+  /// Returns the index of the slice `channel` belongs to
+  /// (`InvalidSlice` if the channel is not in the table).
+  unsigned int sliceOfChannel(raw::Channel_t channel) const
+    {
+      return (static_cast<std::size_t>(channel) < fChannelToSlice.size())
+        ? fChannelToSlice[channel]: InvalidSlice;
+    }
+
+  /// @}
+  // --- END Queries -----------------------------------------------------------
+
+
+    private:
+
+  /// All the channels, slice by slice, plane by plane.
+  std::vector<raw::Channel_t> fChannels;
+
+  /// Position in `fChannels` where each slice starts (`nSlices() + 1` values).
+  std::vector<std::size_t> fSliceOffsets { 0U };
+
+  /// Index of the first slice of each plane (`nPlanes() + 1` values).
+  std::vector<std::size_t> fPlaneOffsets { 0U };
+
+  /// Slice index of each channel, indexed by channel number.
+  std::vector<unsigned int> fChannelToSlice;
+
+}; // class icarus::trigger::PMTsliceTable
+
+
+//------------------------------------------------------------------------------
+
+#endif // ICARUSCODE_PMT_ALGORITHMS_PMTSLICETABLE_H
@@ -8,9 +8,11 @@
 
 // library header
 #include "icaruscode/PMT/Algorithms/PMTverticalSlicingAlg.h"
+#include "icaruscode/PMT/Algorithms/PMTsliceTable.h"
 #include "icarusalg/Utilities/SimpleClustering.h" // util::clusterBy()
 
 // LArSoft libraries
+#include "larcorealg/Geometry/GeometryCore.h"
 #include "larcorealg/Geometry/CryostatGeo.h"
 #include "larcorealg/Geometry/OpDetGeo.h"
 #include "larcorealg/CoreUtils/counter.h"
@@ -109,6 +111,46 @@ void icarus::trigger::PMTverticalSlicingAlg::appendSlices(
 } // icarus::trigger::PMTverticalSlicingAlg::appendSlices()
 
 
+//------------------------------------------------------------------------------
+auto icarus::trigger::PMTverticalSlicingAlg::sliceTable
+  (geo::GeometryCore const& geom) -> PMTsliceTable const&
+{
+  // the geometry is frozen within a job, so the first caller freezes the table
+  // for everybody (local static initialization is also thread-safe)
+  static PMTsliceTable const table = buildSliceTable(geom);
+  return table;
+} // icarus::trigger::PMTverticalSlicingAlg::sliceTable()
+
+
+//------------------------------------------------------------------------------
+auto icarus::trigger::PMTverticalSlicingAlg::buildSliceTable
+  (geo::GeometryCore const& geom) -> PMTsliceTable
+{
+  PMTverticalSlicingAlg const slicerAlg;
+  Slices_t slices;
+  for (geo::CryostatGeo const& cryo: geom.IterateCryostats())
+    slicerAlg.appendCryoSlices(slices, cryo);
+
+  // reduce the geometry objects to their readout channel numbers
+  std::vector<std::vector<std::vector<raw::Channel_t>>> channelSlices;
+  channelSlices.reserve(slices.size());
+  for (PMTtowerOnPlane_t const& planeSlices: slices) {
+    auto& planeChannels = channelSlices.emplace_back();
+    planeChannels.reserve(planeSlices.size());
+    for (PMTtower_t const& tower: planeSlices) {
+      auto& towerChannels = planeChannels.emplace_back();
+      towerChannels.reserve(tower.size());
+      for (geo::OpDetGeo const* opDet: tower) {
+        geo::OpDetID const& id = opDet->ID();
+        towerChannels.push_back(geom.OpDetFromCryo(id.OpDet, id.Cryostat));
+      } // for PMT in tower
+    } // for towers
+  } // for planes
+
+  return PMTsliceTable{ channelSlices };
+} // icarus::trigger::PMTverticalSlicingAlg::buildSliceTable()
+
+
 //------------------------------------------------------------------------------
 auto icarus::trigger::PMTverticalSlicingAlg::clusterPMTby
   (PMTlist_t const& PMTs, geo::Vector_t const& dir) -> std::vector<PMTlist_t>
@@ -27,9 +27,12 @@
 // ---
 namespace geo {
   class CryostatGeo;
+  class GeometryCore;
   class OpDetGeo;
 } // namespace geo
 
+namespace icarus::trigger { class PMTsliceTable; }
+
 
 //------------------------------------------------------------------------------
 namespace icarus::trigger { class PMTverticalSlicingAlg; }
@@ -65,6 +68,20 @@ class icarus::trigger::PMTverticalSlicingAlg {
   /// Computes slices from all PMT in `cryo` and appends them to `slices`.
   void appendCryoSlices(Slices_t& slices, geo::CryostatGeo const& cryo) const;
 
+  /**
+   * @brief Returns the frozen slice table of the specified geometry.
+   *
+   * The table is computed by `buildSliceTable()` on the first call and then
+   * reused for the rest of the job (the detector geometry can't change within
+   * a job), so the geometry sorting is performed only once per process no
+   * matter how many algorithms need the slices.
+   */
+  static PMTsliceTable const& sliceTable(geo::GeometryCore const& geom);
+
+  /// Computes from scratch the slice table of the specified geometry,
+  /// with the slices of all cryostats reduced to readout channel numbers.
+  static PMTsliceTable buildSliceTable(geo::GeometryCore const& geom);
+
 
     private:
   std::string fLogCategory; ///< Category for message streaming.
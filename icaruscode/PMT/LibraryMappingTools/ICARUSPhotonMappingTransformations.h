@@ -54,6 +54,20 @@ namespace phot {
    * 
    * Note that the content of the library for channels 180 to 359 is always
    * ignored, and it may well be absent.
+   *
+   * @note This tool does not own nor access the visibility data itself: the
+   *       voxel &times; channel matrix is loaded and queried by the LArSoft
+   *       photon visibility service (`phot::PhotonVisibilityService`, storage
+   *       in `phot::PhotonLibrary`). The contribution of this tool to each
+   *       visibility lookup is constant time: a cryostat test on one
+   *       coordinate plus references to tables precomputed at construction.
+   *       Improvements to the layout or compression of the visibility storage
+   *       belong to the library classes upstream. The same holds for the
+   *       numeric precision of the stored visibilities: a reduced-precision
+   *       (e.g. half-float) in-memory representation, widened only when the
+   *       values are consumed, would have to be implemented in
+   *       `phot::PhotonLibrary`, since no visibility value ever flows through
+   *       this mapping.
    */
   class ICARUSPhotonMappingTransformations
     : public phot::IPhotonMappingTransformations
@@ -8,6 +8,7 @@
 
 // ICARUS libraries
 #include "icaruscode/IcarusObj/OpDetWaveformMeta.h"
+#include "icaruscode/IcarusObj/OpDetWaveformMetaIndex.h"
 #include "icaruscode/PMT/Algorithms/OpDetWaveformMetaUtils.h" // OpDetWaveformMetaMaker
 
 // LArSoft libraries
@@ -31,6 +32,7 @@
 
 // C/C++ standard libraries
 #include <vector>
+#include <algorithm> // std::sort()
 #include <string>
 #include <memory> // std::make_unique()
 #include <utility> // std::move()
@@ -72,7 +74,11 @@ namespace icarus::trigger { class OpDetWaveformMetaMaker; }
  *   The times in these objects are on the same scale as the ones in the source
  *   data product, which is expected to be
  *   @ref DetectorClocksElectronicsStartTime "electronics time scale [us]".
- * 
+ * * `icarus::OpDetWaveformMetaIndex`: directory of the summary collection
+ *   above, with the covered time ranges of each channel sorted by start time;
+ *   consumers can binary-search the waveform covering a given time on a given
+ *   channel instead of building their own map from the associations.
+ *
  * 
  * Configuration parameters
  * =========================
@@ -176,6 +182,7 @@ icarus::trigger::OpDetWaveformMetaMaker::OpDetWaveformMetaMaker
   // output data declaration
   //
   produces<std::vector<sbn::OpDetWaveformMeta>>();
+  produces<icarus::OpDetWaveformMetaIndex>();
   produces<art::Assns<sbn::OpDetWaveformMeta, raw::OpDetWaveform>>();
   
   //
@@ -223,6 +230,7 @@ void icarus::trigger::OpDetWaveformMetaMaker::produce
   sbn::OpDetWaveformMetaMaker makeOpDetWaveformMeta{ detTimings };
   
   std::vector<sbn::OpDetWaveformMeta> PMTinfo;
+  icarus::OpDetWaveformMetaIndex PMTinfoIndex;
   art::Assns<sbn::OpDetWaveformMeta, raw::OpDetWaveform> infoToWaveform;
   
   art::PtrMaker<sbn::OpDetWaveformMeta> const makeInfoPtr { event };
@@ -235,7 +243,14 @@ void icarus::trigger::OpDetWaveformMetaMaker::produce
     PMTinfo.push_back(makeOpDetWaveformMeta(waveform));
     infoToWaveform.addSingle
       (makeInfoPtr(iWaveform), makeWaveformPtr(iWaveform));
-    
+
+    {
+      sbn::OpDetWaveformMeta const& info = PMTinfo.back();
+      auto& ranges = PMTinfoIndex.channelRanges;
+      if (info.channel >= ranges.size()) ranges.resize(info.channel + 1U);
+      ranges[info.channel].push_back({ info.startTime, info.endTime, iWaveform });
+    }
+
     {
       sbn::OpDetWaveformMeta const& info = PMTinfo.back();
       mf::LogTrace log{ fLogCategory };
@@ -247,11 +262,19 @@ void icarus::trigger::OpDetWaveformMetaMaker::produce
     }
     
   } // for
-  
+
+  // waveforms usually come time-ordered already, but the index interface
+  // requires the ranges of each channel sorted by start time
+  for (auto& ranges: PMTinfoIndex.channelRanges) {
+    std::sort(ranges.begin(), ranges.end(),
+      [](auto const& a, auto const& b){ return a.startTime < b.startTime; });
+  } // for channels
+
   //
   // store output
   //
   event.put(moveToUniquePtr(PMTinfo));
+  event.put(moveToUniquePtr(PMTinfoIndex));
   event.put(moveToUniquePtr(infoToWaveform));
   
 } // icarus::trigger::OpDetWaveformMetaMaker::produce()
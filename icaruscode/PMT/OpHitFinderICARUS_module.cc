@@ -45,6 +45,8 @@
 
 #include "icaruscode/PMT/OpticalTools/IOpHitFinder.h"
 
+#include "tbb/parallel_for.h"
+
 //ROOT includes
 #include "TF1.h"
 #include "TGraph.h"
@@ -55,6 +57,8 @@
 
 #include <memory>
 #include <vector>
+#include <algorithm>
+#include <iterator>
 #include <cmath>
 #include <string>
 #include <map>
@@ -86,8 +90,12 @@ private:
     size_t fEvNumber;
 
     std::string fInputModuleName;
-    
-    std::unique_ptr<light::IOpHitFinder> fOpHitFinder;
+
+    size_t fNumPartitions;
+
+    // One tool instance per partition so the workers never share state; each
+    // instance is configured from the same parameter set
+    std::vector<std::unique_ptr<light::IOpHitFinder>> fOpHitFinderVec;
 };
 
 OpHitFinderICARUS::OpHitFinderICARUS(fhicl::ParameterSet const & p) : EDProducer{p}
@@ -95,8 +103,15 @@ OpHitFinderICARUS::OpHitFinderICARUS(fhicl::ParameterSet const & p) : EDProducer
     produces<std::vector<recob::OpHit>>();
 
     fInputModuleName = p.get< std::string >("InputModule" );
-    
-    fOpHitFinder = art::make_tool<light::IOpHitFinder> (p.get<fhicl::ParameterSet>("OpHitFinder"));
+
+    // Default is one partition per cryostat (east/west PMTs are independent);
+    // finer channel partitioning can be requested for more concurrency
+    fNumPartitions   = p.get< size_t      >("NumPartitions", 2);
+
+    const fhicl::ParameterSet& opHitFinderParams = p.get<fhicl::ParameterSet>("OpHitFinder");
+
+    for(size_t partIdx = 0; partIdx < std::max(fNumPartitions,size_t(1)); partIdx++)
+        fOpHitFinderVec.push_back(art::make_tool<light::IOpHitFinder>(opHitFinderParams));
 }
 
 void OpHitFinderICARUS::produce(art::Event & e)
@@ -116,18 +131,55 @@ void OpHitFinderICARUS::produce(art::Event & e)
       std::cout <<Form("Did not find any G4 photons from a producer: %s", "largeant") << std::endl;
     }
 
-    std::cout << "Dimensione primo " << wfHandle->size() << std::endl; 
+    std::cout << "Dimensione primo " << wfHandle->size() << std::endl;
+
+    size_t nPartitions = fOpHitFinderVec.size();
+
+    if (nPartitions > 1)
+    {
+        // Partition the waveforms by channel number; the east and west cryostat
+        // PMTs are fully independent so the partitions can be processed
+        // concurrently, each worker with its own tool instance and output vector
+        size_t nOpChannels = art::ServiceHandle<geo::Geometry const>{}->NOpChannels();
+
+        std::vector<std::vector<const raw::OpDetWaveform*>> partitionedWaveforms(nPartitions);
 
-//    for(size_t wftime; wftime< wfHandle.size(); wftime++)
-    for(auto const& wvf : (*wfHandle))
+        for(const auto& waveform : *wfHandle)
+        {
+            size_t partIdx = std::min(size_t(waveform.ChannelNumber()) * nPartitions / std::max(nOpChannels,size_t(1)), nPartitions - 1);
+
+            partitionedWaveforms[partIdx].push_back(&waveform);
+        }
+
+        std::vector<light::OpHitVec> partitionedOpHits(nPartitions);
+
+        tbb::parallel_for(size_t(0), nPartitions,
+            [&](size_t partIdx)
+            {
+                const light::IOpHitFinder& opHitFinder = *fOpHitFinderVec[partIdx];
+
+                for(const raw::OpDetWaveform* waveform : partitionedWaveforms[partIdx])
+                    opHitFinder.FindOpHits(*waveform, partitionedOpHits[partIdx]);
+            });
+
+        // Concatenate the per-partition output in partition order so the result
+        // does not depend on the scheduling
+        size_t totalOpHits(0);
+
+        for(const auto& opHits : partitionedOpHits) totalOpHits += opHits.size();
+
+        pulseVecPtr->reserve(totalOpHits);
+
+        for(auto& opHits : partitionedOpHits)
+            pulseVecPtr->insert(pulseVecPtr->end(), std::make_move_iterator(opHits.begin()), std::make_move_iterator(opHits.end()));
+    }
+    else
     {
-        light::OpHitVec opHitVec;
-        
-        fOpHitFinder->FindOpHits(wvf, opHitVec);
-        
-        for(auto& opHit : opHitVec)
-            pulseVecPtr->emplace_back(opHit);
+        // One batch call for the whole collection: tools overriding the batch
+        // entry point process the waveforms without per-waveform dispatch
+        fOpHitFinderVec.front()->FindOpHits(*wfHandle, *pulseVecPtr);
     }
+
     // Store results into the event
     e.put(std::move(pulseVecPtr));
 }
@@ -39,6 +39,8 @@
 #include "lardataobj/Simulation/BeamGateInfo.h"
 #include "lardataobj/RawData/TriggerData.h"
 #include "icaruscode/Decode/DataProducts/ExtraTriggerInfo.h"
+#include "icaruscode/PMT/Algorithms/OpDetWaveformView.h"
+#include "icaruscode/Utilities/ColumnarTreeExport.h"
 
 #include "TTree.h"
 
@@ -98,6 +100,12 @@ class opana::ICARUSFlashAssAna : public art::EDAnalyzer {
         false
       };
 
+      fhicl::Atom<std::string> ColumnarExportDir {
+        Name("ColumnarExportDir"),
+        Comment("if not empty, export the trees as NumPy columns into this directory at end of job"),
+        ""
+      };
+
     };
 
     using Parameters = art::EDAnalyzer::Table<Config>;
@@ -114,7 +122,7 @@ class opana::ICARUSFlashAssAna : public art::EDAnalyzer {
     void beginJob() override;
     void endJob() override;
 
-    template<typename T> T Median( std::vector<T> data ) const;
+    template<typename T> T Median( std::vector<T> &data ) const;
 
     geo::CryostatID::CryostatID_t getCryostatByChannel( int channel );
 
@@ -138,6 +146,7 @@ class opana::ICARUSFlashAssAna : public art::EDAnalyzer {
     std::vector<art::InputTag> fFlashLabels;
     float fPEOpHitThreshold;
     bool fDebug;
+    std::string fColumnarExportDir;
 
 
     TTree *fEventTree;
@@ -154,6 +163,7 @@ class opana::ICARUSFlashAssAna : public art::EDAnalyzer {
     short m_baseline;
     short m_chargesum;
     int m_nticks;
+    std::vector<short> m_wave_buffer; // scratch for Median(), reused across waveforms
     float m_beam_gate_start=-99999;
     float m_beam_gate_width=-99999;
     int m_beam_type=-1;
@@ -191,6 +201,13 @@ class opana::ICARUSFlashAssAna : public art::EDAnalyzer {
     std::vector<float> m_pmt_y;
     std::vector<float> m_pmt_z;
 
+    // channel-to-cryostat lookup filled once at the beginning of the job
+    std::vector<geo::CryostatID::CryostatID_t> fChannelCryostat;
+
+    // per-channel PE accumulators reused across flashes (see processOpHitsFlash)
+    std::vector<float> fChannelPE;
+    std::vector<char> fChannelHasHit;
+
     geo::GeometryCore const* fGeom;
 
 };
@@ -205,6 +222,7 @@ opana::ICARUSFlashAssAna::ICARUSFlashAssAna(Parameters const& config)
   , fFlashLabels( config().FlashLabels() )
   , fPEOpHitThreshold( config().PEOpHitThreshold() )
   , fDebug( config().Debug() )
+  , fColumnarExportDir( config().ColumnarExportDir() )
   , fGeom( lar::providerFrom<geo::Geometry>() )
 { }
 
@@ -229,8 +247,13 @@ void opana::ICARUSFlashAssAna::beginJob() {
     m_pmt_y.push_back(PMTxyz[1]);
     m_pmt_z.push_back(PMTxyz[2]);
 
+    fChannelCryostat.push_back( fGeom->OpDetGeoFromOpChannel(opch).ID().Cryostat );
+
   }
 
+  fChannelPE.resize( fGeom->NOpChannels(), 0.0 );
+  fChannelHasHit.resize( fGeom->NOpChannels(), 0 );
+
   fGeoTree->Fill();
 
   fEventTree = tfs->make<TTree>("eventstree", "higher level information on the event" );
@@ -356,7 +379,7 @@ void opana::ICARUSFlashAssAna::beginJob() {
 
     
 template<typename T>
-  T opana::ICARUSFlashAssAna::Median( std::vector<T> data ) const {
+  T opana::ICARUSFlashAssAna::Median( std::vector<T> &data ) const {
 
     std::nth_element( data.begin(), data.begin() + data.size()/2, data.end() );
     
@@ -367,9 +390,14 @@ template<typename T>
 
 geo::CryostatID::CryostatID_t opana::ICARUSFlashAssAna::getCryostatByChannel( int channel ) {
 
+  // the lookup table is filled once in beginJob(); the geometry query below
+  // only remains as a fallback for channels outside of it
+  if( channel >= 0 && (size_t)channel < fChannelCryostat.size() ){
+    return fChannelCryostat[channel];
+  }
 
   const geo::OpDetGeo& opdetgeo = fGeom->OpDetGeoFromOpChannel(channel);
-  geo::CryostatID::CryostatID_t cid = opdetgeo.ID().Cryostat ; 
+  geo::CryostatID::CryostatID_t cid = opdetgeo.ID().Cryostat ;
 
   return cid;
 
@@ -459,16 +487,21 @@ void opana::ICARUSFlashAssAna::processOpHitsFlash( std::vector<art::Ptr<recob::O
                                               float *xyz, TTree *ophittree  ) {
 
 
-  std::unordered_map<int, float > sumpe_map;
-
   // We caluclate the total charge clustered in the flash per channel taking part to the flash
+  // The sums are kept in a contiguous per-channel array reused across flashes
+  if( fChannelPE.size() < fGeom->NOpChannels() ) {
+    fChannelPE.resize( fGeom->NOpChannels(), 0.0 );
+    fChannelHasHit.resize( fGeom->NOpChannels(), 0 );
+  }
+
   for( auto const ophit : ophits ) {
 
     if ( ophit->PE() < fPEOpHitThreshold ) { continue; }
 
-    const int channel_id = ophit->OpChannel(); 
+    const int channel_id = ophit->OpChannel();
 
-    sumpe_map[ channel_id ]+=ophit->PE() ;
+    fChannelPE[ channel_id ]+=ophit->PE() ;
+    fChannelHasHit[ channel_id ] = 1;
 
     //xyz[0] += m_pmt_x[channel_id]*ophit->PE();
     //xyz[1] += m_pmt_y[channel_id]*ophit->PE();
@@ -487,33 +520,47 @@ void opana::ICARUSFlashAssAna::processOpHitsFlash( std::vector<art::Ptr<recob::O
 
   }
 
-  m_multiplicity_left = std::accumulate( sumpe_map.begin(), sumpe_map.end(), 0,
-           [&](int value, const std::map<int, float>::value_type& p) {
-             return getSideByChannel(p.first)==0 ? ++value : value ;
-           });
+  // One scan of the contiguous arrays gets multiplicity and sum of PE on
+  // both sides, zeroing the accumulators for the next flash along the way
+  multiplicity_left = 0;
+  multiplicity_right = 0;
+  sum_pe_left = 0.0;
+  sum_pe_right = 0.0;
 
-  m_multiplicity_right =std::accumulate( sumpe_map.begin(), sumpe_map.end(), 0,
-           [&](int value, const std::map<int, float>::value_type& p) {
-             return getSideByChannel(p.first)==1 ? ++value : value ;
-           });
+  for( size_t channel=0; channel<fChannelPE.size(); channel++ ) {
 
-  m_sum_pe_left = std::accumulate( sumpe_map.begin(), sumpe_map.end(), 0.0, 
-           [&](float value, const std::map<int, float>::value_type& p) {
-             return getSideByChannel(p.first)==0 ? value+p.second : value ; 
-           });
-  
-  m_sum_pe_right = std::accumulate( sumpe_map.begin(), sumpe_map.end(), 0.0,
-            [&](float value, const std::map<int, float>::value_type& p) {
-              return getSideByChannel(p.first)==1 ? value+p.second : value ;
-            }); 
+    if( !fChannelHasHit[channel] ) { continue; }
+
+    if( getSideByChannel(channel)==0 ) {
+      multiplicity_left++;
+      sum_pe_left += fChannelPE[channel];
+    }
+    else {
+      multiplicity_right++;
+      sum_pe_right += fChannelPE[channel];
+    }
+
+    fChannelPE[channel] = 0.0;
+    fChannelHasHit[channel] = 0;
+
+  }
 
   //for( int i=0; i<3; i++ ){ xyz[i] /= (m_sum_pe_left+ m_sum_pe_right); }
-  
+
 }
 
 
 void opana::ICARUSFlashAssAna::endJob() {
 
+  if ( !fColumnarExportDir.empty() ) {
+    icarus::ns::util::ColumnarTreeExport exporter { fColumnarExportDir };
+    if ( fEventTree ) exporter.exportTree( *fEventTree, fEventTree->GetName() );
+    for ( TTree* ttree : fOpDetWaveformTrees ) exporter.exportTree( *ttree, ttree->GetName() );
+    for ( TTree* ttree : fOpFlashTrees ) exporter.exportTree( *ttree, ttree->GetName() );
+    for ( TTree* ttree : fOpHitTrees ) exporter.exportTree( *ttree, ttree->GetName() );
+    for ( TTree* ttree : fOpHitFlashTrees ) exporter.exportTree( *ttree, ttree->GetName() );
+  }
+
 }
 
 
@@ -596,10 +643,15 @@ void opana::ICARUSFlashAssAna::analyze(art::Event const& e) {
 
           for( auto const & wave : *wfm_handle ){
 
-            m_channel_id = wave.ChannelNumber();
-            m_nticks = wave.Waveform().size();
-            m_baseline = Median( wave.Waveform() ); 
-            m_chargesum = std::accumulate( wave.Waveform().begin(), wave.Waveform().end(), 0, 
+            // view over the original samples: no copy of the waveform,
+            // only the median scratch buffer is (re)filled
+            icarus::OpDetWaveformView const waveView { wave };
+
+            m_channel_id = waveView.channel();
+            m_nticks = waveView.size();
+            m_wave_buffer.assign( waveView.begin(), waveView.end() );
+            m_baseline = Median( m_wave_buffer );
+            m_chargesum = std::accumulate( waveView.begin(), waveView.end(), 0,
              [ & ](short x, short y){ return ((m_baseline-x) + (m_baseline-y)) ; } );
 
             fOpDetWaveformTrees[i]->Fill();
@@ -35,6 +35,15 @@ namespace light
         
         // Find the baseline
         virtual void FindOpHits(const raw::OpDetWaveform&, OpHitVec&)     const = 0;
+
+        // Find the hits of a whole waveform collection with a single call.
+        // Tools can override this batch entry point to work on the raw sample
+        // arrays directly and avoid the per-waveform virtual dispatch;
+        // by default it just loops over the single waveform version
+        virtual void FindOpHits(const std::vector<raw::OpDetWaveform>& waveformVec, OpHitVec& opHitVec) const
+        {
+            for(const auto& waveform : waveformVec) FindOpHits(waveform, opHitVec);
+        }
     };
 }
 
@@ -31,7 +31,10 @@ public:
     void outputHistograms(art::TFileDirectory&)                const override;
     
     void FindOpHits(const raw::OpDetWaveform&, OpHitVec&)      const override;
-    
+
+    void FindOpHits(const std::vector<raw::OpDetWaveform>&,
+                    OpHitVec&)                                 const override;
+
 private:
     double fSPEArea;         //conversion between phe and Adc*ns
     double fHitThreshold;
@@ -183,6 +186,92 @@ void OpHitFinderStandard::FindOpHits(const raw::OpDetWaveform& opDetWaveform,
     return;
 }
     
+void OpHitFinderStandard::FindOpHits(const std::vector<raw::OpDetWaveform>& waveformVec,
+                                     OpHitVec&                              opHitVec) const
+{
+    // Batch fast path: same selection and pulse characterization as the
+    // single waveform version above, but working directly on the sample
+    // array, with the gaussian parameters estimated from the half maximum
+    // crossings of the pulse instead of fitted through TGraph/TF1 objects
+    opHitVec.reserve(opHitVec.size() + waveformVec.size());
+
+    // conversion from half width at half maximum to a gaussian sigma
+    static const double hwhmToSigma = 1.0/sqrt(2.0*log(2.0));
+
+    std::vector<double> adcVec;
+
+    for(const auto& opDetWaveform : waveformVec)
+    {
+        int chNumber = opDetWaveform.ChannelNumber();
+        int grsize   = opDetWaveform.size();
+
+        unsigned short frame;
+        double         Area;
+        double         fasttotal;
+        double         time_abs;
+        double         FWHM;
+        double         phelec;
+
+        double baseline=0;
+
+        for (int btime =0; btime< fBaselineSample && btime< grsize; btime++)
+        {
+            baseline = baseline+ opDetWaveform[btime];
+        }
+
+        baseline = baseline/fBaselineSample;
+
+        adcVec.resize(grsize);
+        for (int wtime=0; wtime< grsize; wtime++)
+            adcVec[wtime] = -(opDetWaveform[wtime]-baseline);
+
+        int    min_time        = std::distance(adcVec.begin(), std::max_element(adcVec.begin(),adcVec.end()));
+        double min_time_to_put = min_time;
+        double min             = adcVec.empty()? 0.: adcVec[min_time];
+        double min_to_put      = min;
+
+        if (min>fHitThreshold)
+        {
+            // half maximum crossings on the two sides of the peak estimate
+            // the rise and fall widths that the fits above would return
+            double halfMax = 0.5*min;
+
+            int left = min_time;
+            while (left > 0 && adcVec[left] > halfMax) left--;
+
+            int right = min_time;
+            while (right < grsize-1 && adcVec[right] > halfMax) right++;
+
+            double Constant1 = min;
+            double Sigma1    = (min_time-left)*hwhmToSigma;
+            double Constant2 = min;
+            double Sigma2    = (right-min_time)*hwhmToSigma;
+
+            frame     = 1;
+            Area      =  ((Constant1*Sigma1)/2 + (Constant2*Sigma2)/2)*sqrt(2*3.14159);
+            fasttotal = 3/4;
+            time_abs  = sqrt(min_time_to_put);
+            FWHM      = 2.35*((Sigma1+Sigma2)/2);
+            phelec    = Area/fSPEArea;
+        }
+        else
+        {
+            min_time_to_put=0;
+            min_to_put=0;
+            Area=0;
+            frame=0;
+            fasttotal=0;
+            time_abs=0;
+            FWHM=0;
+            phelec=0;
+        }
+
+        opHitVec.emplace_back(chNumber, min_time_to_put, time_abs, frame, FWHM, Area, min_to_put, phelec, fasttotal);
+    }
+
+    return;
+}
+
 void OpHitFinderStandard::outputHistograms(art::TFileDirectory& histDir) const
 {
     // It is assumed that the input TFileDirectory has been set up to group histograms into a common
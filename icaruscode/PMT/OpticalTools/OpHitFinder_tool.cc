@@ -30,7 +30,10 @@ public:
     void outputHistograms(art::TFileDirectory&)               const override;
     
     void FindOpHits(const raw::OpDetWaveform&, OpHitVec&)     const override;
-    
+
+    void FindOpHits(const std::vector<raw::OpDetWaveform>&,
+                    OpHitVec&)                                const override;
+
 private:
     // fhicl parameters
     float          fSPEArea;         //< conversion between phe and Adc*ns
@@ -108,8 +111,9 @@ void OpHitFinder::FindOpHits(const raw::OpDetWaveform& opDetWaveform,
         
     if (notSaturated)
     {
-        std::vector<float> tempVec = locWaveform;
-        recob::Wire::RegionsOfInterest_t::datarange_t rangeData(size_t(0),std::move(tempVec));
+        // the corrected waveform is not needed anymore after the hit finding,
+        // so it can be moved into the range rather than duplicated
+        recob::Wire::RegionsOfInterest_t::datarange_t rangeData(size_t(0),std::move(locWaveform));
         
         fHitFinderTool->findHitCandidates(rangeData, 0, 0, fEventCount, hitCandidateVec);
         fHitFinderTool->MergeHitCandidates(rangeData, hitCandidateVec, mergedCandidateHitVec);
@@ -163,6 +167,19 @@ void OpHitFinder::FindOpHits(const raw::OpDetWaveform& opDetWaveform,
     return;
 }
 
+void OpHitFinder::FindOpHits(const std::vector<raw::OpDetWaveform>& waveformVec,
+                             OpHitVec&                              opHitVec) const
+{
+    // This tool has no per-waveform ROOT setup to share, so the batch entry
+    // point simply loops through the concrete (non virtual) implementation
+    opHitVec.reserve(opHitVec.size() + waveformVec.size());
+
+    for(const auto& opDetWaveform : waveformVec)
+        OpHitFinder::FindOpHits(opDetWaveform, opHitVec);
+
+    return;
+}
+
 float OpHitFinder::getBaseline(const raw::OpDetWaveform& locWaveform) const
 {
     // Fill a map to determine the most probable value
@@ -108,9 +108,13 @@ namespace icarus { class PMTWaveformBaselines; }
  *   configuration;
  * * `PlotBaselines` (flag, default: `true`): whether to produce distributions
  *   of the extracted baselines.
+ * * `ShortWaveformSamples` (integral, default: `0`): if non-zero, waveforms
+ *   with fewer samples than this reuse the baseline last estimated on the same
+ *   channel (thus tracking its drift) instead of being estimated on their own;
+ *   the first waveform on each channel is always estimated in full;
  * * `BaselineTimeAverage` (real number, default: `600.0`): binning of the
  *   baseline profile vs. time, in seconds. Requires `PlotBaselines` to be set.
- * 
+ *
  */
 class icarus::PMTWaveformBaselines: public art::EDProducer {
   
@@ -138,7 +142,16 @@ class icarus::PMTWaveformBaselines: public art::EDProducer {
       Comment("produce plots on the extracted baseline"),
       true
       };
-    
+
+    fhicl::Atom<unsigned int> ShortWaveformSamples {
+      Name("ShortWaveformSamples"),
+      Comment(
+        "waveforms with fewer samples than this reuse the baseline last"
+        " estimated on their channel (0: always estimate)"
+        ),
+      0U
+      };
+
     fhicl::Atom<double> BaselineTimeAverage {
       Name("BaselineTimeAverage"),
       Comment("binning of the baseline profile vs. time [s]"),
@@ -179,7 +192,10 @@ class icarus::PMTWaveformBaselines: public art::EDProducer {
   art::InputTag const fOpDetWaveformTag; ///< Input optical waveform tag.
   
   bool fPlotBaselines; ///< Whether to produce plots.
-  
+
+  /// Waveforms with fewer samples reuse the last channel baseline (`0`: never).
+  unsigned int const fShortWaveformSamples;
+
   /// Width of baseline time profile binning [s]
   double const fBaselineTimeAverage { 0.0 };
   
@@ -194,7 +210,18 @@ class icarus::PMTWaveformBaselines: public art::EDProducer {
   
   
   // --- BEGIN Algorithms ------------------------------------------------------
-  
+
+  /// Number of possible sample values from the 14-bit V1730 digitizer.
+  static constexpr std::size_t NADCvalues = 16384U;
+
+  /// Frequency of each ADC value, reused across waveforms
+  /// (see `baselineFromMedian()`).
+  std::vector<unsigned int> fADCcounts
+    = std::vector<unsigned int>(NADCvalues, 0U);
+
+  /// Baseline last estimated on each channel (`0` if none yet).
+  std::vector<float> fLastBaseline;
+
   // --- END Algorithms --------------------------------------------------------
   
   std::size_t fNPlotChannels = 0U; ///< Number of plotted channels
@@ -212,7 +239,7 @@ class icarus::PMTWaveformBaselines: public art::EDProducer {
   
   /// Extracts a baseline as median from a single waveform.
   icarus::WaveformBaseline baselineFromMedian
-    (raw::OpDetWaveform const& waveform) const;
+    (raw::OpDetWaveform const& waveform);
   
 }; // icarus::PMTWaveformBaselines
 
@@ -221,27 +248,6 @@ class icarus::PMTWaveformBaselines: public art::EDProducer {
 //------------------------------------------------------------------------------
 //--- Implementation
 //------------------------------------------------------------------------------
-namespace {
-  
-  /// Extracts the median of the collection between the specified iterators.
-  template <typename BIter, typename EIter>
-  auto median(BIter begin, EIter end) {
-    
-    using value_type = typename BIter::value_type;
-    
-    std::vector<value_type> data{ begin, end };
-    assert(!data.empty());
-    
-    auto const middle = data.begin() + data.size() / 2;
-    std::nth_element(data.begin(), middle, data.end());
-    
-    return *middle;
-    
-  } // median()
-  
-} // local namespace
-
-
 //------------------------------------------------------------------------------
 //--- icarus::PMTWaveformBaselines
 //------------------------------------------------------------------------------
@@ -251,20 +257,26 @@ icarus::PMTWaveformBaselines::PMTWaveformBaselines
   // configuration
   , fOpDetWaveformTag(config().OpticalWaveforms())
   , fPlotBaselines(config().PlotBaselines())
+  , fShortWaveformSamples(config().ShortWaveformSamples())
   , fBaselineTimeAverage(config().BaselineTimeAverage())
   , fLogCategory(config().OutputCategory())
 {
   //
   // optional configuration parameters
   //
-  
+
   //
   // configuration report (currently, more like a placeholder)
   //
   mf::LogInfo(fLogCategory)
     << "Using the standard (median) algorithm, waveform by waveform, on '"
     << fOpDetWaveformTag.encode() << "'.";
-  
+  if (fShortWaveformSamples > 0U) {
+    mf::LogInfo(fLogCategory)
+      << "Waveforms shorter than " << fShortWaveformSamples
+      << " samples will reuse the baseline last estimated on their channel.";
+  }
+
   //
   // declaration of input
   //
@@ -474,12 +486,63 @@ void icarus::PMTWaveformBaselines::buildBaselineGraphs() {
 
 //------------------------------------------------------------------------------
 icarus::WaveformBaseline icarus::PMTWaveformBaselines::baselineFromMedian
-  (raw::OpDetWaveform const& waveform) const
+  (raw::OpDetWaveform const& waveform)
 {
-  
-  return icarus::WaveformBaseline
-    { waveform.empty()? 0.0f: median(waveform.begin(), waveform.end()) };
-  
+
+  if (waveform.empty()) return icarus::WaveformBaseline{ 0.0f };
+
+  std::size_t const channel = waveform.ChannelNumber();
+
+  // short waveforms carry too few samples for a solid estimation of their own:
+  // borrow the baseline last estimated on the same channel, if any
+  if ((waveform.size() < fShortWaveformSamples)
+    && (channel < fLastBaseline.size()) && (fLastBaseline[channel] > 0.0f))
+  {
+    return icarus::WaveformBaseline{ fLastBaseline[channel] };
+  }
+
+  /*
+   * Median from a frequency count of the samples: with the digitizer emitting
+   * 14-bit samples the histogram is small enough to stay in cache, and the
+   * counting and scanning loops have no branches for the compiler to trip on
+   * (unlike `std::nth_element()` on a copy of the waveform).
+   */
+  auto const [ minIt, maxIt ]
+    = std::minmax_element(waveform.begin(), waveform.end());
+  std::size_t const minValue
+    = static_cast<std::size_t>(std::clamp<raw::ADC_Count_t>(*minIt, 0, NADCvalues - 1U));
+  std::size_t const maxValue
+    = static_cast<std::size_t>(std::clamp<raw::ADC_Count_t>(*maxIt, 0, NADCvalues - 1U));
+
+  for (auto const sample: waveform) {
+    ++fADCcounts
+      [static_cast<std::size_t>(std::clamp<raw::ADC_Count_t>(sample, 0, NADCvalues - 1U))];
+  }
+
+  // the median is the value of the sample with index `size() / 2` in a sorted
+  // waveform, i.e. the smallest value with more than `size() / 2` samples
+  // not larger than it (same convention as `std::nth_element()`)
+  std::size_t const middle = waveform.size() / 2U;
+  std::size_t nBelow = 0U;
+  std::size_t medianValue = maxValue;
+  for (std::size_t value = minValue; value <= maxValue; ++value) {
+    nBelow += fADCcounts[value];
+    if (nBelow > middle) { medianValue = value; break; }
+  } // for
+
+  // reset only the touched bins for the next waveform
+  std::fill(
+    fADCcounts.begin() + minValue, fADCcounts.begin() + maxValue + 1U, 0U
+    );
+
+  float const baseline = static_cast<float>(medianValue);
+
+  // remember the estimation to track the baseline drift of this channel
+  if (channel >= fLastBaseline.size()) fLastBaseline.resize(channel + 1U, 0.0f);
+  fLastBaseline[channel] = baseline;
+
+  return icarus::WaveformBaseline{ baseline };
+
 } // icarus::PMTWaveformBaselines::baselineFromMedian()
 
 
@@ -77,7 +77,25 @@ private:
     
     /// We don't keep more than this number of photons per `sim::SimPhoton`.
     static constexpr unsigned int MaxPhotons = 10000000U;
-    
+
+    // Distance-binned timing parameter table, precomputed at begin job:
+    // the mean and the width of the delay distribution are evaluated once per
+    // distance bin and linearly interpolated in the sampling loop, instead of
+    // being recomputed from the parameterization for every photon.
+    double fTimingTableStep    =   25.0;  ///< Distance bin size [cm]
+    double fTimingTableMaxDist = 2500.0;  ///< Largest tabulated distance [cm]
+    std::vector<double> fDelayMeanTable;  ///< Delay distribution mean per bin [ns]
+    std::vector<double> fDelaySigmaTable; ///< Delay distribution width per bin [ns]
+
+    /// Fills the distance-binned timing parameter tables.
+    void buildTimingTables();
+
+    /// Batch lookup: interpolates the mean and the width of the delay
+    /// distribution for each distance in `distances`.
+    void timingParameters(const std::vector<double>& distances,
+                          std::vector<double>&       means,
+                          std::vector<double>&       sigmas) const;
+
 }; // class PhotonPropagationICARUS
 
 DEFINE_ART_MODULE(PhotonPropogationICARUS)
@@ -112,6 +130,8 @@ PhotonPropogationICARUS::PhotonPropogationICARUS(fhicl::ParameterSet const & pse
 void PhotonPropogationICARUS::configure(fhicl::ParameterSet const & pset)
 {
     fSimPhotonModuleLabel = pset.get<art::InputTag>("SimPhotonsModuleLabel");
+    fTimingTableStep      = pset.get<double>       ("TimingTableStep",          25.0);
+    fTimingTableMaxDist   = pset.get<double>       ("TimingTableMaxDistance", 2500.0);
 }
 
 //----------------------------------------------------------------------------
@@ -124,9 +144,64 @@ void PhotonPropogationICARUS::beginJob()
     
 //    art::TFileDirectory dir = tfs->mkdir(Form("PhotonPropogation"));
 
+    buildTimingTables();
+
     return;
 }
 
+//----------------------------------------------------------------------------
+/// Precompute the timing parameter table.
+///
+/// The arrival time delay is parametrized as a function of the distance
+/// between the scintillation point and the PMT (see
+/// photon_propogation_timing_icarus.fcl for the full parameterization this
+/// mirrors). The parameters are evaluated here once per distance bin; the
+/// sampling loop in produce() only interpolates between neighbouring bins.
+void PhotonPropogationICARUS::buildTimingTables()
+{
+    const std::size_t nBins = static_cast<std::size_t>(fTimingTableMaxDist / fTimingTableStep) + 2;
+
+    fDelayMeanTable.resize(nBins);
+    fDelaySigmaTable.resize(nBins);
+
+    for(std::size_t iBin = 0; iBin < nBins; ++iBin)
+    {
+        const double dis = iBin * fTimingTableStep;
+
+        fDelayMeanTable[iBin]  = 0.18*dis; // TODO
+        fDelaySigmaTable[iBin] = 0.75*dis; // TODO
+    }
+} // PhotonPropogationICARUS::buildTimingTables()
+
+//----------------------------------------------------------------------------
+/// Batch lookup of the timing parameters for a set of distances.
+void PhotonPropogationICARUS::timingParameters(const std::vector<double>& distances,
+                                               std::vector<double>&       means,
+                                               std::vector<double>&       sigmas) const
+{
+    means.resize(distances.size());
+    sigmas.resize(distances.size());
+
+    const std::size_t lastBin = fDelayMeanTable.size() - 1;
+
+    for(std::size_t idx = 0; idx < distances.size(); ++idx)
+    {
+        double binPos = distances[idx] / fTimingTableStep;
+        if (binPos < 0.) binPos = 0.;
+        std::size_t iBin = static_cast<std::size_t>(binPos);
+        if (iBin >= lastBin)
+        {
+            // beyond the tabulated range: hold the last value
+            means[idx]  = fDelayMeanTable[lastBin];
+            sigmas[idx] = fDelaySigmaTable[lastBin];
+            continue;
+        }
+        const double frac = binPos - iBin;
+        means[idx]  = fDelayMeanTable[iBin]  + frac * (fDelayMeanTable[iBin+1]  - fDelayMeanTable[iBin]);
+        sigmas[idx] = fDelaySigmaTable[iBin] + frac * (fDelaySigmaTable[iBin+1] - fDelaySigmaTable[iBin]);
+    }
+} // PhotonPropogationICARUS::timingParameters()
+
 //----------------------------------------------------------------------------
 /// Produce method.
 ///
@@ -167,6 +242,13 @@ void PhotonPropogationICARUS::produce(art::Event & event)
 //    auto const& pvs = *(art::ServiceHandle<phot::PhotonVisibilityService>());
     CLHEP::RandLandau landauGen(fPhotonEngine);
 
+    // scratch buffers for the per-channel batched sampling below;
+    // allocated once and recycled from one channel to the next
+    std::vector<double> photonDistances;
+    std::vector<double> delayMeans;
+    std::vector<double> delaySigmas;
+    std::vector<double> landauDeviates;
+
     // Loop through the input photons (this might need to be more complicated...)
     for(const auto& simPhoton : srcSimPhotons)
     {
@@ -184,49 +266,66 @@ void PhotonPropogationICARUS::produce(art::Event & event)
         // fix the arrival time
         //
         sim::SimPhotons localPhoton = simPhoton; // modify a copy of the original photon
-        unsigned int photonNo = 0;
-        for (auto& onePhoton: localPhoton) 
-        {
-             //
-             // sanity check: if there are too many photons we are in trouble
-             // (like in: not enough computing resources)
-             //
-             if (photonNo++ >= MaxPhotons) {
-               mf::LogError("LightPropagationICARUS")
-                 << "Too many photons to handle! only " << (photonNo - 1) << " saved.";
-               break;
-             }
-               
-             geo::Point_t const position = geo::vect::toPoint(onePhoton.InitialPosition);
-             double const dis = (position - PMTcenter).R();
-
-             double mean  = 0.18*dis; // TODO
-             double sigma = 0.75*dis; // TODO
-             
-             //double time_plus = -1;
-
-	     //while (time_plus<dis/21.74){time_plus=mean + landauGen.fire() * sigma; }// TODO
-
-	    const double minPropTime = dis / 21.74; // d / (c/n) in [ns]
-	    //const double maxPropTime = 2000 / 21.74; // dimension / (c/n) in [ns]
-     	    double time_plus;
-            do {
+
+        //
+        // sanity check: if there are too many photons we are in trouble
+        // (like in: not enough computing resources)
+        //
+        std::size_t nPhotons = localPhoton.size();
+        if (nPhotons > MaxPhotons) {
+          mf::LogError("LightPropagationICARUS")
+            << "Too many photons to handle! only " << MaxPhotons << " saved.";
+          nPhotons = MaxPhotons;
+        }
+
+        //
+        // batched sampling: first collect the distance of every photon of this
+        // channel from the PMT, then draw all the standard Landau deviates in
+        // a single call, and finally write the corrected times back; only the
+        // (rare) draws below the straight propagation time are redrawn one by
+        // one. The mean and width of the delay and the minimum accepted value
+        // are all proportional to the distance.
+        //
+        photonDistances.resize(nPhotons);
+        for (std::size_t iPhoton = 0; iPhoton < nPhotons; ++iPhoton) {
+          geo::Point_t const position
+            = geo::vect::toPoint(localPhoton[iPhoton].InitialPosition);
+          photonDistances[iPhoton] = (position - PMTcenter).R();
+        }
+
+        // interpolate the delay distribution parameters from the table
+        // built at begin job, all the photons of the channel at once
+        timingParameters(photonDistances, delayMeans, delaySigmas);
+
+        landauDeviates.resize(nPhotons);
+        landauGen.fireArray
+          (static_cast<int>(nPhotons), landauDeviates.data());
+
+        for (std::size_t iPhoton = 0; iPhoton < nPhotons; ++iPhoton) {
+          double const dis = photonDistances[iPhoton];
+
+          double mean  = delayMeans[iPhoton];
+          double sigma = delaySigmas[iPhoton];
+
+          const double minPropTime = dis / 21.74; // d / (c/n) in [ns]
+          //const double maxPropTime = 2000 / 21.74; // dimension / (c/n) in [ns]
+          double time_plus = mean + landauDeviates[iPhoton] * sigma; // TODO
+          while (time_plus < minPropTime) {
             time_plus = mean + landauGen.fire() * sigma; // TODO
-		//time_plus = landauGen.fire(mean,sigma); // TODO
-            } while (time_plus < minPropTime);
-             
-             // TODO restore the "MF_LOG_TRACE" line for normal operations
-             MF_LOG_TRACE("LightPropagationICARUS");
-//             mf::LogVerbatim("LightPropagationICARUS")
-//               << "Photon #" << photonNo
-//               << " (at " << position << ", " << dis << " cm far from PMT) given offset "
-//               << time_plus;
-             //double time_plus = dis/21.74; 
-             //TRandom r;
-		
-             onePhoton.Time += time_plus;
-		//onePhoton.Time = time_plus;
-             
+            //time_plus = landauGen.fire(mean,sigma); // TODO
+          }
+
+          // TODO restore the "MF_LOG_TRACE" line for normal operations
+          MF_LOG_TRACE("LightPropagationICARUS");
+//          mf::LogVerbatim("LightPropagationICARUS")
+//            << "Photon #" << iPhoton
+//            << " (" << dis << " cm far from PMT) given offset " << time_plus;
+          //double time_plus = dis/21.74;
+          //TRandom r;
+
+          localPhoton[iPhoton].Time += time_plus;
+          //localPhoton[iPhoton].Time = time_plus;
+
         } // for photons in simPhoton
         // move the photon with the new arrival time into the new output collection
         simPhotonVec->push_back(std::move(localPhoton));
@@ -10,6 +10,7 @@
 #include "icaruscode/PMT/SinglePhotonPulseFunctionTool.h"
 #include "icaruscode/PMT/Algorithms/PMTsimulationAlg.h"
 #include "icaruscode/PMT/Algorithms/PhotoelectronPulseFunction.h"
+#include "icaruscode/Utilities/CounterBasedEngine.h"
 
 // LArSoft libraries
 #include "larcore/CoreUtils/ServiceUtil.h"
@@ -38,10 +39,17 @@
 // CLHEP libraries
 #include "CLHEP/Random/RandEngine.h" // CLHEP::HepRandomEngine
 
+// TBB libraries
+#include "tbb/parallel_for.h"
+#include "tbb/blocked_range.h"
+#include "tbb/enumerable_thread_specific.h"
+
 // C/C++ standard library
 #include <vector>
+#include <array>
 #include <atomic> // std::atomic_flag
 #include <iterator> // std::back_inserter()
+#include <algorithm> // std::max()
 #include <memory> // std::make_unique()
 #include <utility> // std::move()
 #include <optional>
@@ -79,6 +87,13 @@ namespace icarus::opdet {
    *   `sim::SimPhotons` collection the photons effectively contributing to
    *   the waveforms; currently, no selection ever happens and all photons are
    *   contributing, making this collection the same as the input one.
+   * * **ParallelChannels** (boolean, default: `false`): simulates the optical
+   *   channels in parallel over the TBB worker threads; each channel draws
+   *   from counter-based random streams
+   *   (`icarus::ns::util::CounterBasedEngine`) keyed on the module seeds and
+   *   indexed by event and channel, so the result is bit-identical for any
+   *   number of threads and any scheduling (it does differ from the one of
+   *   the serial loop, though).
    * 
    * See the @ref ICARUS_PMTSimulationAlg_RandomEngines "documentation" of
    * `icarus::PMTsimulationAlg` for the purpose of the three random number
@@ -170,7 +185,16 @@ namespace icarus::opdet {
             ("writes the scintillation photon contributing to the waveforms"),
           false
       };
-      
+
+      fhicl::Atom<bool> parallelChannels {
+          Name("ParallelChannels"),
+          Comment(
+            "simulate the optical channels in parallel over the TBB threads,"
+            " with per-channel random engines"
+            ),
+          false
+      };
+
       rndm::SeedAtom EfficiencySeed {
         Name("EfficiencySeed"),
         Comment("fix the seed for stochastic photon detection efficiency")
@@ -224,7 +248,10 @@ namespace icarus::opdet {
     art::InputTag fInputModuleName;
     
     bool fWritePhotons { false }; ///< Whether to save contributing photons.
-    
+
+    /// Whether to simulate the channels in parallel.
+    bool fParallelChannels { false };
+
     /// Single photoelectron response function.
     std::unique_ptr<SinglePhotonResponseFunc_t> const fSinglePhotonResponseFunc;
     
@@ -236,6 +263,16 @@ namespace icarus::opdet {
     CLHEP::HepRandomEngine&  fElectronicsNoiseEngine;
     
     
+    /// Recycled waveform sample buffers, one stash per thread; the stashes
+    /// persist across events, so once the busiest event has been processed
+    /// the simulation stops allocating waveform data (see
+    /// `PMTsimulationAlg::setBufferStash()`).
+    tbb::enumerable_thread_specific
+      <icarus::opdet::PMTsimulationAlg::WaveformBufferStash_t> fBufferStashes;
+
+    /// Rolling high-water mark of stash occupancy, used to trim the stashes.
+    std::size_t fStashHighWater = 0U;
+
     /// True if `firstTime()` has already been called.
     std::atomic_flag fNotFirstTime;
     
@@ -252,6 +289,7 @@ SimPMTIcarus::SimPMTIcarus(Parameters const& config)
     : EDProducer{config}
     , fInputModuleName(config().inputModuleLabel())
     , fWritePhotons(config().writePhotons())
+    , fParallelChannels(config().parallelChannels())
     , fSinglePhotonResponseFunc{
         art::make_tool<icarus::opdet::SinglePhotonPulseFunctionTool>
           (config().SinglePhotonResponse.get<fhicl::ParameterSet>())
@@ -304,11 +342,12 @@ SimPMTIcarus::SimPMTIcarus(Parameters const& config)
     
     auto const clockData =
       art::ServiceHandle<detinfo::DetectorClocksService const>()->DataFor(e);
+    auto const& larProp = *(lar::providerFrom<detinfo::LArPropertiesService>());
     //
     // prepare the algorithm
     //
     auto PMTsimulator = makePMTsimulator(
-      *(lar::providerFrom<detinfo::LArPropertiesService>()),
+      larProp,
       clockData,
       *fSinglePhotonResponseFunc,
       fEfficiencyEngine,
@@ -316,18 +355,88 @@ SimPMTIcarus::SimPMTIcarus(Parameters const& config)
       fElectronicsNoiseEngine,
       fWritePhotons
       );
-    
+
     if (firstTime()) {
       mf::LogDebug log { "SimPMTIcarus" };
       log << "PMT simulation configuration (first event):\n";
       PMTsimulator->printConfiguration(log);
     } // if first time
-    
+
+    // sample buffers are recycled across channels and across events
+    PMTsimulator->setBufferStash(&fBufferStashes.local());
+
     //
     // run the algorithm
     //
-    for(auto const& photons : pmtVector) {
-      
+    if (fParallelChannels) {
+
+      std::size_t const nChannels = pmtVector.size();
+
+      // counter-based engines: the stream of each draw is a pure function of
+      // (module seed, purpose, event, channel), so any schedule across any
+      // number of threads produces bit-identical output
+      std::uint32_t const eventIndex = e.id().event();
+
+      // one algorithm instance per thread (it retains the sampled single
+      // photon response); per-channel engines are plugged in before each use
+      tbb::enumerable_thread_specific
+        <std::unique_ptr<icarus::opdet::PMTsimulationAlg>> threadSimulators;
+
+      std::vector<std::vector<raw::OpDetWaveform>> channelWaveforms(nChannels);
+      std::vector<std::optional<sim::SimPhotons>> channelPhotons(nChannels);
+
+      tbb::parallel_for(
+        tbb::blocked_range<std::size_t>(0U, nChannels),
+        [&](tbb::blocked_range<std::size_t> const& range)
+        {
+          auto& simulator = threadSimulators.local();
+          if (!simulator) {
+            simulator = makePMTsimulator(
+              larProp, clockData, *fSinglePhotonResponseFunc,
+              fEfficiencyEngine, fDarkNoiseEngine, fElectronicsNoiseEngine,
+              fWritePhotons
+              );
+          }
+
+          // engines local to this range, keyed on the module seeds, with one
+          // purpose tag per stream; re-keyed on each channel below
+          icarus::ns::util::CounterBasedEngine mainEngine
+            { fEfficiencyEngine.getSeed(), 1U };
+          icarus::ns::util::CounterBasedEngine darkNoiseEngine
+            { fDarkNoiseEngine.getSeed(), 2U };
+          icarus::ns::util::CounterBasedEngine elecNoiseEngine
+            { fElectronicsNoiseEngine.getSeed(), 3U };
+
+          simulator->setRandomEngines
+            (&mainEngine, &darkNoiseEngine, &elecNoiseEngine);
+          simulator->setBufferStash(&fBufferStashes.local());
+
+          for (std::size_t iChannel = range.begin(); iChannel < range.end();
+            ++iChannel)
+          {
+            mainEngine.setEventChannel(eventIndex, iChannel);
+            darkNoiseEngine.setEventChannel(eventIndex, iChannel);
+            elecNoiseEngine.setEventChannel(eventIndex, iChannel);
+
+            std::tie(channelWaveforms[iChannel], channelPhotons[iChannel])
+              = simulator->simulate(pmtVector[iChannel]);
+          } // for channels in range
+        }
+        );
+
+      // collect the results in channel order, as the serial loop would
+      for (std::size_t iChannel = 0U; iChannel < nChannels; ++iChannel) {
+        std::move(
+          channelWaveforms[iChannel].begin(), channelWaveforms[iChannel].end(),
+          std::back_inserter(*pulseVecPtr)
+          );
+        if (simphVecPtr && channelPhotons[iChannel])
+          simphVecPtr->emplace_back(std::move(channelPhotons[iChannel].value()));
+      } // for channels
+
+    }
+    else for(auto const& photons : pmtVector) {
+
       auto const& [ channelWaveforms, photons_used ]
         = PMTsimulator->simulate(photons);
       std::move(
@@ -336,9 +445,21 @@ SimPMTIcarus::SimPMTIcarus(Parameters const& config)
         );
       if (simphVecPtr && photons_used)
         simphVecPtr->emplace_back(std::move(photons_used.value()));
-      
+
     } // for
 
+    //
+    // trim the buffer stashes toward typical usage: the retained capacity
+    // follows a decaying high-water mark of the per-thread stash occupancy,
+    // so one anomalously busy event does not pin its memory forever
+    //
+    std::size_t largestStash = 0U;
+    for (auto const& stash: fBufferStashes)
+      largestStash = std::max(largestStash, stash.size());
+    fStashHighWater = std::max(largestStash, (3U * fStashHighWater) / 4U);
+    for (auto& stash: fBufferStashes)
+      if (stash.size() > fStashHighWater) stash.resize(fStashHighWater);
+
     mf::LogInfo("SimPMTIcarus") << "Generated " << pulseVecPtr->size()
       << " waveforms out of " << pmtVector.size() << " optical channels.";
     
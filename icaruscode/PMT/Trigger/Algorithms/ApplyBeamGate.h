@@ -13,6 +13,7 @@
 // #include "icaruscode/PMT/Trigger/Algorithms/BeamGateMaker.h"
 #include "icaruscode/PMT/Trigger/Algorithms/BeamGateStruct.h"
 #include "icaruscode/PMT/Trigger/Utilities/TriggerGateOperations.h"
+#include "icaruscode/PMT/Trigger/Utilities/TrackedTriggerGate.h" // gateDataIn()
 #include "sbnobj/ICARUS/PMT/Trigger/Data/OpticalTriggerGate.h"
 #include "icarusalg/Utilities/mfLoggingClass.h"
 
@@ -24,7 +25,9 @@
 
 // // C/C++ standard libraries
 // #include <utility> // std::pair<>
+#include <algorithm> // std::min()
 #include <ostream>
+#include <type_traits> // std::decay_t
 #include <vector>
 #include <string>
 
@@ -91,9 +94,10 @@ class icarus::trigger::ApplyBeamGateClass
   Gate gateAs() const { return { gate() }; }
   
   /// Returns a copy of `gate` in AND with this beam gate.
+  /// Only the opening level changes within the beam gate are ever visited:
+  /// the (many) transitions outside of it are not copied nor processed.
   template <typename Gate>
-  Gate apply(Gate gate) const
-    { return icarus::trigger::mulGates(gate, this->gate()); }
+  Gate apply(Gate const& gate) const;
   
   /// Returns a collection of copies of the specified `gates` each in AND with
   /// this beam gate.
@@ -170,6 +174,50 @@ std::ostream& icarus::trigger::operator<<
 
 // -----------------------------------------------------------------------------
 // --- template implementation
+// -----------------------------------------------------------------------------
+template <typename Gate>
+Gate icarus::trigger::ApplyBeamGateClass::apply(Gate const& gate) const
+{
+  using GateData_t = std::decay_t<decltype(gateDataIn(gate))>;
+  using ClockTick_t = typename GateData_t::ClockTick_t;
+
+  auto const& srcData = gateDataIn(gate);
+  auto const range = tickRange();
+  ClockTick_t const start = static_cast<ClockTick_t>(range.start().value());
+  ClockTick_t const stop = static_cast<ClockTick_t>(range.end().value());
+
+  // the result starts as a closed gate on the same channels (and tracking)
+  Gate gated;
+  auto& dstData = gateDataIn(gated);
+  for (auto const channel: srcData.channels()) dstData.addChannel(channel);
+  if constexpr (icarus::trigger::isTrackedTriggerGate_v<Gate>)
+    gated.tracking().add(gate.tracking());
+
+  // replay the opening level changes of the source within the beam gate only;
+  // the result is the same as the product with the beam gate (level 1 inside)
+  auto count = srcData.openingCount(start);
+  if (count > 0U) dstData.openAt(start, count);
+  ClockTick_t tick = start;
+  while (true) {
+    // the next change is the first tick where the opening level leaves the
+    // current one, in either direction
+    ClockTick_t const up = srcData.findOpen(count + 1U, tick);
+    ClockTick_t const down
+      = (count > 0U)? srcData.findClose(count, tick): GateData_t::MaxTick;
+    ClockTick_t const next = std::min(up, down);
+    if (next >= stop) break;
+    auto const newCount = srcData.openingCount(next);
+    if (newCount > count) dstData.openAt(next, newCount - count);
+    else dstData.closeAt(next, count - newCount);
+    count = newCount;
+    tick = next;
+  } // while
+  if (count > 0U) dstData.closeAt(stop, count);
+
+  return gated;
+} // icarus::trigger::ApplyBeamGateClass::apply()
+
+
 // -----------------------------------------------------------------------------
 template
   <typename GateColl, typename GateObj /* = typename GateColl::value_type */>
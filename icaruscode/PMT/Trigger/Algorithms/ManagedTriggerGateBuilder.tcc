@@ -35,7 +35,6 @@
 // C/C++ standard libraries
 #include <optional>
 #include <iterator> // std::next(), std::prev()
-#include <cmath> // std::round()
 #include <cstddef> // std::ptrdiff_t
 
 
@@ -133,22 +132,38 @@ void icarus::trigger::ManagedTriggerGateBuilder::buildChannelGates(
    * close operations directly, a fixed gate duration algorithm may perform
    * both opening and closing at open time, and nothing at all at closing time.
    */
+  //
+  // the integer comparisons against the rounded baseline-subtracted sample are
+  // replaced by floating point comparisons against equivalent boundaries, so
+  // that baseline subtraction, threshold comparison and transition extraction
+  // are fused in a single pass over the raw samples, with no rounding and no
+  // intermediate baseline-subtracted buffer:
+  // `round(d) >= thr` (with `round()` rounding half away from zero) is
+  // equivalent to `d >= thr - 0.5` when `thr` is positive,
+  // and to `d > thr - 0.5` otherwise
+  //
+  std::vector<float> thresholdBoundaries;
+  thresholdBoundaries.reserve(channelThresholds().size());
+  for (ADCCounts_t const threshold: channelThresholds())
+    thresholdBoundaries.push_back(static_cast<float>(threshold.value()) - 0.5f);
+
+  auto const atOrAboveThreshold
+    = [this, &thresholdBoundaries]
+      (float diff, std::vector<ADCCounts_t>::const_iterator it)
+      {
+        float const boundary
+          = thresholdBoundaries[it - channelThresholds().begin()];
+        return (*it > ADCCounts_t{ 0 })? (diff >= boundary): (diff > boundary);
+      };
+
   unsigned int nWaveforms = 0U;
   for (auto const& waveformData: channelWaveforms) {
 
     raw::OpDetWaveform const& waveform = waveformData.waveform();
-    
+
     ops const waveOps { waveformData.baseline().baseline() };
-    
-    // baseline subtraction is performed in floating point,
-    // but then rounding is applied again
-    auto subtractBaseline = [waveOps](float sample) -> ADCCounts_t
-      {
-        return
-          ADCCounts_t::castFrom(std::round(waveOps.subtractBaseline(sample)));
-      };
-    
-    
+
+
     ++nWaveforms;
     assert(waveform.ChannelNumber() == channel);
     
@@ -173,7 +188,56 @@ void icarus::trigger::ManagedTriggerGateBuilder::buildChannelGates(
     
     // register this waveform with the gates (this feature is unused here)
     for (auto& gateInfo: channelGates) gateInfo.addTrackingInfo(waveform);
-    
+
+    //
+    // single-threshold fast scan: the threshold tracking machinery in the
+    // generic loop below is pure overhead when there is only one threshold
+    // (e.g. `DiscriminatePMTwaveformsByChannel` discriminates each channel
+    // against exactly one threshold); the whole waveform is scanned comparing
+    // the baseline-subtracted samples directly against the equivalent
+    // floating point boundary, sparing a `std::round()` call per sample, and
+    // the gate transitions are emitted directly at the crossings
+    //
+    if (channelThresholds().size() == 1U) {
+
+      ADCCounts_t const threshold = *tbegin;
+      // `round(d) >= thr` (with `round()` rounding half away from zero) is
+      // equivalent to `d >= thr - 0.5` when `thr` is positive,
+      // and to `d > thr - 0.5` otherwise
+      float const boundary = static_cast<float>(threshold.value()) - 0.5f;
+      bool const positiveThreshold = threshold > ADCCounts_t{ 0 };
+
+      auto& gateInfo = channelGates.front();
+      bool aboveThreshold = false;
+
+      for (auto iSample: util::counter<std::ptrdiff_t>(waveform.size())) {
+
+        float const diff = waveOps.subtractBaseline(waveform[iSample]);
+        bool const above
+          = positiveThreshold? (diff >= boundary): (diff > boundary);
+        if (above == aboveThreshold) continue;
+        aboveThreshold = above;
+
+        MF_LOG_TRACE(details::TriggerGateDebugLog)
+          << "Sample " << waveform[iSample] << " (" << diff << " on "
+          << waveOps.baseline() << ") " << (above? "passing": "leaving")
+          << " threshold " << threshold << " at "
+          << waveformTickStart << " + " << optical_time_ticks{ iSample };
+
+        if (above) {
+          gateInfo.aboveThresholdAt
+            (waveformTickStart + optical_time_ticks{ iSample });
+        }
+        else {
+          gateInfo.belowThresholdAt
+            (waveformTickStart + optical_time_ticks{ iSample });
+        }
+
+      } // for all samples
+
+      continue; // on to the next waveform
+    } // if single threshold
+
     // all gates start closed; this gate is not necessarily closed, but the
     // waveform is not above the gate threshold any more.
     auto nextGateToOpen = channelGates.begin();
@@ -216,11 +280,11 @@ void icarus::trigger::ManagedTriggerGateBuilder::buildChannelGates(
       // baseline subtraction is always a subtraction (as in "A minus B"),
       // regardless the polarity of the waveform
       auto const sample = waveform[iSample];
-      ADCCounts_t const relSample = subtractBaseline(sample);
-      
+      float const diff = waveOps.subtractBaseline(sample);
+
       /* // this is too much also for regular debugging...
       MF_LOG_TRACE(details::TriggerGateDebugLog)
-        << "Sample #" << iSample << ": " << sample << " [=> " << relSample
+        << "Sample #" << iSample << ": " << sample << " [=> " << diff
         << "]; thresholds lower: "
           << (ppLowerThreshold? util::to_string(**ppLowerThreshold): "none")
         << ", upper: "
@@ -232,10 +296,10 @@ void icarus::trigger::ManagedTriggerGateBuilder::buildChannelGates(
       // if this sample is lower than the current lower threshold,
       // we are just tracking the thresholds: gate closing has already happened
       //
-      if (ppLowerThreshold && (relSample < **ppLowerThreshold)) {
-        
+      if (ppLowerThreshold && !atOrAboveThreshold(diff, *ppLowerThreshold)) {
+
         MF_LOG_TRACE(details::TriggerGateDebugLog)
-          << "Sample " << sample << " (" << relSample << " on "
+          << "Sample " << sample << " (" << diff << " on "
           << waveOps.baseline() << ") leaving thresholds at "
           << waveformTickStart << " + " << optical_time_ticks{ iSample };
         
@@ -257,7 +321,7 @@ void icarus::trigger::ManagedTriggerGateBuilder::buildChannelGates(
           }
           --*ppLowerThreshold; // point to previous threshold
           
-        } while (relSample < **ppLowerThreshold);
+        } while (!atOrAboveThreshold(diff, *ppLowerThreshold));
         
         // we can't be at the top since we just closed a gate
         ppUpperThreshold
@@ -269,10 +333,10 @@ void icarus::trigger::ManagedTriggerGateBuilder::buildChannelGates(
       // if this sample is greater or matching the next threshold,
       // we *are* opening gate(s)
       //
-      else if (ppUpperThreshold && (relSample >= **ppUpperThreshold)) {
-        
+      else if (ppUpperThreshold && atOrAboveThreshold(diff, *ppUpperThreshold)) {
+
         MF_LOG_TRACE(details::TriggerGateDebugLog)
-          << "Sample " << sample << " (" << relSample << " on "
+          << "Sample " << sample << " (" << diff << " on "
           << waveOps.baseline() << ") passing thresholds at "
           << waveformTickStart << " + " << optical_time_ticks{ iSample };
         
@@ -295,7 +359,7 @@ void icarus::trigger::ManagedTriggerGateBuilder::buildChannelGates(
             break;
           }
           
-        } while (relSample >= **ppUpperThreshold);
+        } while (atOrAboveThreshold(diff, *ppUpperThreshold));
         
         // we can't be at the bottom since we just opened a gate
         ppLowerThreshold = std::prev(ppUpperThreshold? *ppUpperThreshold: tend);
@@ -24,6 +24,7 @@ icarus::trigger::SlidingWindowCombinerAlg::SlidingWindowCombinerAlg(
   )
   : fWindowChannels(sortedWindowChannels(windows))
   , fMissingChannels(sortChannels(std::move(missingChannels)))
+  , fPresentChannels(removeMissingChannels(fWindowChannels, fMissingChannels))
   , fRequireFullCoverage(requireFullCoverage)
   , fLogCategory(std::move(logCategory))
   {}
@@ -40,8 +41,9 @@ auto icarus::trigger::SlidingWindowCombinerAlg::combine
   checkInput(gateIndex);
 
   std::vector<TrackedTriggerGate_t> combinedGates;
-  for (std::vector<raw::Channel_t> const& channels: fWindowChannels) {
-    assert(!channels.empty());
+  // iterates the channel lists precomputed with missing channels removed:
+  // the loop below performs no per-channel lookup at all
+  for (std::vector<raw::Channel_t> const& channels: fPresentChannels) {
 
     combinedGates.push_back(combineChannels(gateIndex, channels));
 
@@ -165,9 +167,8 @@ auto icarus::trigger::SlidingWindowCombinerAlg::combineChannels
   (TriggerGateIndex_t const& gates, WindowChannels_t const& channels) const
   -> TrackedTriggerGate_t
 {
-  assert(!channels.empty());
-
-  auto iChannel = firstChannelPresent(channels);
+  // `channels` has the missing channels already removed (`fPresentChannels`)
+  auto iChannel = channels.begin();
   auto const cend = channels.end();
   if (iChannel == cend) return {}; // empty gate, no channels inside
 
@@ -178,7 +179,6 @@ auto icarus::trigger::SlidingWindowCombinerAlg::combineChannels
 
   mf::LogTrace(fLogCategory) << "Input:  " << firstGate;
   while (++iChannel != cend) {
-    if (isMissingChannel(*iChannel)) continue;
 
     TrackedTriggerGate_t const& inputGate = gates[*iChannel];
 
@@ -193,17 +193,6 @@ auto icarus::trigger::SlidingWindowCombinerAlg::combineChannels
 } // icarus::trigger::SlidingWindowCombinerAlg::combineChannel()
 
 
-// -----------------------------------------------------------------------------
-auto icarus::trigger::SlidingWindowCombinerAlg::firstChannelPresent
-  (WindowChannels_t const& channels) const -> WindowChannels_t::const_iterator
-{
-  auto iChannel = channels.begin();
-  auto const cend = channels.end();
-  while (iChannel != cend) if (!isMissingChannel(*iChannel)) return iChannel;
-  return cend;
-} // icarus::trigger::SlidingWindowCombinerAlg::firstChannelPresent()
-
-
 //------------------------------------------------------------------------------
 bool icarus::trigger::SlidingWindowCombinerAlg::mergeGateInto
   (TrackedTriggerGate_t& dest, TrackedTriggerGate_t const& input)
@@ -239,4 +228,21 @@ auto icarus::trigger::SlidingWindowCombinerAlg::sortChannels
 } // icarus::trigger::SlidingWindowCombinerAlg::sortChannels
 
 
+// -----------------------------------------------------------------------------
+auto icarus::trigger::SlidingWindowCombinerAlg::removeMissingChannels
+  (Windows_t windows, std::vector<raw::Channel_t> const& missing) -> Windows_t
+{
+  // both the window channels and the missing channel list are sorted
+  for (auto& window: windows) {
+    auto const wend = std::remove_if(
+      window.begin(), window.end(),
+      [&missing](raw::Channel_t channel)
+        { return std::binary_search(missing.begin(), missing.end(), channel); }
+      );
+    window.erase(wend, window.end());
+  } // for
+  return windows;
+} // icarus::trigger::SlidingWindowCombinerAlg::removeMissingChannels()
+
+
 // -----------------------------------------------------------------------------
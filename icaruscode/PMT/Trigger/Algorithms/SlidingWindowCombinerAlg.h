@@ -80,6 +80,11 @@ class icarus::trigger::SlidingWindowCombinerAlg {
   /// Channels known (and required) to be missing (sorted).
   std::vector<raw::Channel_t> fMissingChannels;
 
+  /// Content of channels of each window, with the missing channels already
+  /// removed: precomputed once, so that the per-event combination iterates a
+  /// flat channel list with no lookup at all.
+  Windows_t const fPresentChannels;
+
   /// Whether to require all channels to be used.
   bool const fRequireFullCoverage;
   
@@ -88,14 +93,11 @@ class icarus::trigger::SlidingWindowCombinerAlg {
   /// Throws an exception if the gates are not suitable for input.
   void checkInput(TriggerGateIndex_t const& gates) const;
 
-  /// Returns the combination of the `channels` selected from the `gates`.
+  /// Returns the combination of the `channels` selected from the `gates`;
+  /// the `channels` are expected to have no missing channel among them.
   TrackedTriggerGate_t combineChannels
     (TriggerGateIndex_t const& gates, WindowChannels_t const& channels) const;
 
-  /// Returns an iterator to the first of the `channels` which is not missing.
-  WindowChannels_t::const_iterator firstChannelPresent
-    (WindowChannels_t const& channels) const;
-
 
   /// Adds the gate data of `input` to `dest`, unless it's already included.
   /// @return whether the addition happened
@@ -109,6 +111,10 @@ class icarus::trigger::SlidingWindowCombinerAlg {
   static std::vector<raw::Channel_t> sortChannels
     (std::vector<raw::Channel_t> channels);
 
+  /// Returns `windows` with the (sorted) `missing` channels removed.
+  static Windows_t removeMissingChannels
+    (Windows_t windows, std::vector<raw::Channel_t> const& missing);
+
   /// Returns whether the container `c` has `value`.
   template <typename Cont, typename T>
   static bool inList(Cont const& c, T const& value)
@@ -124,8 +130,9 @@ class icarus::trigger::SlidingWindowCombinerAlg {
 inline bool icarus::trigger::SlidingWindowCombinerAlg::isMissingChannel
   (raw::Channel_t channel) const
 {
-  return std::find(fMissingChannels.begin(), fMissingChannels.end(), channel)
-    != fMissingChannels.end();
+  // the list of missing channels is kept sorted
+  return std::binary_search
+    (fMissingChannels.begin(), fMissingChannels.end(), channel);
 } // icarus::trigger::SlidingWindowCombinerAlg::isMissingChannel()
 
 
@@ -13,12 +13,11 @@
 
 // ICARUS libraries
 #include "icaruscode/PMT/Algorithms/PMTverticalSlicingAlg.h"
+#include "icaruscode/PMT/Algorithms/PMTsliceTable.h"
 
 // LArSoft libraries
 #include "larcorealg/Geometry/GeometryCore.h"
-#include "larcorealg/Geometry/CryostatGeo.h"
-#include "larcorealg/Geometry/OpDetGeo.h"
-#include "larcorealg/CoreUtils/enumerate.h"
+#include "larcorealg/CoreUtils/counter.h"
 
 // framework libraries
 #include "messagefacility/MessageLogger/MessageLogger.h"
@@ -38,45 +37,43 @@ auto icarus::trigger::SlidingWindowDefinitionAlg::makeWindows
   -> WindowDefs_t
 {
   /*
-   * 1. compute the vertical PMT towers in each separate optical detector plane
+   * 1. fetch the vertical PMT towers of each separate optical detector plane
    * 2. fill the windows by counting channels (i.e. op. det.)
    */
   using icarus::trigger::PMTverticalSlicingAlg;
 
   //
-  // 1. compute the vertical PMT towers in each separate optical detector plane
+  // 1. fetch the vertical PMT towers in each separate optical detector plane
+  //    (the table is frozen once per job, not recomputed here)
   //
-  PMTverticalSlicingAlg slicerAlg(fLogCategory);
-  PMTverticalSlicingAlg::Slices_t slices;
-  for (geo::CryostatGeo const& cryo: fGeom.IterateCryostats())
-    slicerAlg.appendCryoSlices(slices, cryo);
+  PMTsliceTable const& slices = PMTverticalSlicingAlg::sliceTable(fGeom);
 
   //
   // 2. fill the windows by counting channels (i.e. optical detectors)
   //
   WindowDefs_t windows;
 
-  for (PMTverticalSlicingAlg::PMTtowerOnPlane_t const& planeSlices: slices) {
+  for (unsigned int const plane: util::counter(slices.nPlanes())) {
 
-    auto itSlice = planeSlices.begin();
-    auto const send = planeSlices.end();
-    while (itSlice != send) {
+    unsigned int iSlice = slices.firstSliceOfPlane(plane);
+    unsigned int const sliceEnd = slices.firstSliceOfPlane(plane + 1U);
+    while (iSlice != sliceEnd) {
 
       mf::LogTrace(fLogCategory) << "Assembling window #" << windows.size();
 
       WindowDefs_t::value_type window;
       window.reserve(windowSize);
 
-      std::optional<decltype(itSlice)> nextStart;
+      std::optional<unsigned int> nextStart;
       unsigned int nChannels = 0U;
       while (nChannels < windowSize) {
-        if (itSlice == send) break;
+        if (iSlice == sliceEnd) break;
 
         // aside: check if this is the right place to start the next window
         if (nChannels == windowStride) {
           mf::LogTrace(fLogCategory)
             << "  (next window will start from this slice)";
-          nextStart = itSlice;
+          nextStart = iSlice;
         }
         else if ((nChannels > windowStride) && !nextStart) {
           throw cet::exception("SlidingWindowDefinitionAlg")
@@ -85,20 +82,18 @@ auto icarus::trigger::SlidingWindowDefinitionAlg::makeWindows
             << " (next slice starts " << nChannels << " channels after)\n";
         }
 
+        auto const sliceChannels = slices.sliceChannels(iSlice);
         mf::LogTrace(fLogCategory)
-          << "  adding " << itSlice->size() << " channels to existing "
+          << "  adding " << sliceChannels.size() << " channels to existing "
           << nChannels;
-        for (geo::OpDetGeo const* opDet: *itSlice) {
-          geo::OpDetID const& id = opDet->ID();
-          raw::Channel_t const channel
-            = fGeom.OpDetFromCryo(id.OpDet, id.Cryostat);
-          mf::LogTrace(fLogCategory)
-            << "   * " << id << " (channel " << channel << ")";
+        for (raw::Channel_t const channel: sliceChannels) {
+          mf::LogTrace(fLogCategory) << "   * channel " << channel;
           window.push_back(channel);
         } // for channels in slice
-        nChannels += (itSlice++)->size();
+        nChannels += sliceChannels.size();
+        ++iSlice;
       } // while
-      if (nChannels == windowStride) nextStart = itSlice;
+      if (nChannels == windowStride) nextStart = iSlice;
       assert(nextStart);
 
       if (nChannels < windowSize) {
@@ -119,7 +114,7 @@ auto icarus::trigger::SlidingWindowDefinitionAlg::makeWindows
 
       windows.push_back(std::move(window));
 
-      itSlice = nextStart.value();
+      iSlice = nextStart.value();
     } // for all slices
   } // for all windows
   mf::LogTrace(fLogCategory)
@@ -60,26 +60,41 @@ icarus::trigger::SlidingWindowPatternAlg::SlidingWindowPatternAlg(
 auto icarus::trigger::SlidingWindowPatternAlg::simulateResponse
   (TriggerGates_t const& gates) const -> AllTriggerInfo_t
 {
-  
+  // discriminated gates are cached here and shared across all the main
+  // windows: each window belongs to several neighbourhoods, and its gate needs
+  // to be discriminated against each requirement level only once
+  DiscriminatedGateCache_t discrCache;
+  return simulateResponse(gates, discrCache);
+} // icarus::trigger::SlidingWindowPatternAlg::simulateResponse()
+
+
+//------------------------------------------------------------------------------
+auto icarus::trigger::SlidingWindowPatternAlg::simulateResponse
+  (TriggerGates_t const& gates, DiscriminatedGateCache_t& cache) const
+  -> AllTriggerInfo_t
+{
+
   // ensures input gates are in the same order as the configured windows
   verifyInputTopology(gates);
-  
+
   auto const& inBeamGates = fBeamGate? fBeamGate->applyToAll(gates): gates;
-  
+
   //
   // 2.   apply pattern:
   //
   std::size_t const nWindows = fWindowTopology.nWindows();
-    
+
+  if (cache.size() < nWindows) cache.resize(nWindows);
+
   //
   // 2.1.   for each main window, apply the pattern
   //
   WindowTriggerInfo_t triggerInfo; // start empty
   for (std::size_t const iWindow: util::counter(nWindows)) {
-    
-    TriggerInfo_t const windowResponse
-      = applyWindowPattern(fWindowPattern, iWindow, inBeamGates);
-    
+
+    TriggerInfo_t const windowResponse = applyWindowPattern
+      (fWindowTopology.info(iWindow), fWindowPattern, inBeamGates, cache);
+
     if (!windowResponse) continue;
     
     assert(windowResponse.hasLocation());
@@ -208,7 +223,21 @@ auto icarus::trigger::SlidingWindowPatternAlg::applyWindowPattern(
   TriggerGates_t const& gates
   ) const -> TriggerInfo_t
 {
-  
+  // transient cache: discriminated gates are not reused across calls
+  DiscriminatedGateCache_t cache{ gates.size() };
+  return applyWindowPattern(windowInfo, pattern, gates, cache);
+} // icarus::trigger::SlidingWindowPatternAlg::applyWindowPattern()
+
+
+//------------------------------------------------------------------------------
+auto icarus::trigger::SlidingWindowPatternAlg::applyWindowPattern(
+  WindowTopology_t::WindowInfo_t const& windowInfo,
+  WindowPattern_t const& pattern,
+  TriggerGates_t const& gates,
+  DiscriminatedGateCache_t& cache
+  ) const -> TriggerInfo_t
+{
+
   /*
    * 1. check that the pattern can be applied; if not, return no trigger
    * 2. discriminate all the relevant gates against their required minimum count
@@ -262,8 +291,8 @@ auto icarus::trigger::SlidingWindowPatternAlg::applyWindowPattern(
   
   // main window
   if (pattern.minInMainWindow > 0U) {
-    trigPrimitive.Mul
-      (discriminate(gateAt(windowInfo.index), pattern.minInMainWindow));
+    trigPrimitive.Mul(discriminatedGate
+      (cache, gates, windowInfo.index, pattern.minInMainWindow));
     mfLogTrace()
       << "  main >= " << pattern.minInMainWindow << ": "
       << compactdump(trigPrimitive);
@@ -271,8 +300,8 @@ auto icarus::trigger::SlidingWindowPatternAlg::applyWindowPattern(
   
   // add opposite window requirement (if any)
   if ((pattern.minInOppositeWindow > 0U) && windowInfo.hasOppositeWindow()) {
-    trigPrimitive.Mul
-      (discriminate(gateAt(windowInfo.opposite), pattern.minInOppositeWindow));
+    trigPrimitive.Mul(discriminatedGate
+      (cache, gates, windowInfo.opposite, pattern.minInOppositeWindow));
     mfLogTrace() << "  opposite [#" << windowInfo.opposite << "]: "
       << compactdump(gateAt(windowInfo.opposite))
       << "\n  => " << compactdump(trigPrimitive);
@@ -291,16 +320,15 @@ auto icarus::trigger::SlidingWindowPatternAlg::applyWindowPattern(
   
   // add upstream window requirement (if any)
   if ((pattern.minInUpstreamWindow > 0U) && windowInfo.hasUpstreamWindow()) {
-    trigPrimitive.Mul
-      (discriminate(gateAt(windowInfo.upstream), pattern.minInUpstreamWindow));
+    trigPrimitive.Mul(discriminatedGate
+      (cache, gates, windowInfo.upstream, pattern.minInUpstreamWindow));
   } // if
   
   // add downstream window requirement (if any)
   if ((pattern.minInDownstreamWindow > 0U) && windowInfo.hasDownstreamWindow())
   {
-    trigPrimitive.Mul(
-      discriminate(gateAt(windowInfo.downstream), pattern.minInDownstreamWindow)
-      );
+    trigPrimitive.Mul(discriminatedGate
+      (cache, gates, windowInfo.downstream, pattern.minInDownstreamWindow));
   } // if
   
   mfLogTrace() << "  final: " << compactdump(trigPrimitive);
@@ -324,6 +352,21 @@ auto icarus::trigger::SlidingWindowPatternAlg::applyWindowPattern(
 } // icarus::trigger::SlidingWindowTriggerEfficiencyPlots::applyWindowPattern()
 
 
+//------------------------------------------------------------------------------
+auto icarus::trigger::SlidingWindowPatternAlg::discriminatedGate(
+  DiscriminatedGateCache_t& cache, TriggerGates_t const& gates,
+  std::size_t iWindow, unsigned int level
+  ) const -> TriggerGateData_t const&
+{
+  assert(iWindow < cache.size());
+
+  auto const [ itGate, bNew ] = cache[iWindow].try_emplace(level);
+  if (bNew) itGate->second = discriminate(gateIn(gates[iWindow]), level);
+  return itGate->second;
+
+} // icarus::trigger::SlidingWindowPatternAlg::discriminatedGate()
+
+
 //------------------------------------------------------------------------------
 auto icarus::trigger::SlidingWindowPatternAlg::applyWindowPattern(
   WindowPattern_t const& pattern,
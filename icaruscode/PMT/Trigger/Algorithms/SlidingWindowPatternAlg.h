@@ -24,6 +24,7 @@
 
 // C/C++ standard libraries
 #include <vector>
+#include <map>
 #include <optional>
 #include <string>
 #include <limits> // std::numeric_limits<>
@@ -72,7 +73,12 @@ class icarus::trigger::SlidingWindowPatternAlg
   
   /// Type representing the requirement pattern for a window.
   using WindowPattern_t = icarus::trigger::WindowPattern;
-  
+
+  /// Cache of discriminated gates: one map per window, from requirement level
+  /// to the gate of that window discriminated against that level.
+  using DiscriminatedGateCache_t
+    = std::vector<std::map<unsigned int, TriggerGateData_t>>;
+
   /// Additional information on the trigger.
   struct MoreInfo_t {
     
@@ -148,7 +154,28 @@ class icarus::trigger::SlidingWindowPatternAlg
    * 
    */
   AllTriggerInfo_t simulateResponse(TriggerGates_t const& gates) const;
-  
+
+  /**
+   * @brief Returns the trigger response from the specified `gates`.
+   * @param gates the trigger gates to be used as input, one per window
+   * @param cache cache of discriminated gates, updated as needed
+   * @return the response to the configured pattern
+   * @see `simulateResponse(TriggerGates_t const&)`
+   *
+   * This version of `simulateResponse()` allows several algorithm instances,
+   * each applying a different pattern to the same input, to share the
+   * discriminated window gates: the requirement levels appearing in more than
+   * one pattern are discriminated only once.
+   *
+   * The `cache` is resized as needed; an empty cache must be passed the first
+   * time each new input is processed. All the algorithms sharing a cache must
+   * be configured with the same window topology and must not apply a beam
+   * gate (or apply the same one), since the cached gates would otherwise not
+   * match the input.
+   */
+  AllTriggerInfo_t simulateResponse
+    (TriggerGates_t const& gates, DiscriminatedGateCache_t& cache) const;
+
 
   /// Returns a new collection of gates, set each in coincidence with beam gate.
   TriggerGates_t applyBeamGate(TriggerGates_t const& gates) const;
@@ -210,8 +237,8 @@ class icarus::trigger::SlidingWindowPatternAlg
       { windowIndex = index; this->info = std::move(info); }
     
   }; // WindowTriggerInfo_t
-  
-  
+
+
   /// Definition of the neighborhood of each window in terms of window indices.
   WindowTopology_t const fWindowTopology;
   
@@ -239,7 +266,37 @@ class icarus::trigger::SlidingWindowPatternAlg
     WindowPattern_t const& pattern, std::size_t iWindow,
     TriggerGates_t const& gates
     ) const;
-  
+
+  /**
+   * @brief Returns the trigger response for the specified window pattern.
+   * @param windowInfo the topology of the window being tested
+   * @param pattern the trigger requirement pattern
+   * @param gates trigger gates, one per window
+   * @param cache cache of discriminated gates, updated as needed
+   * @return a `TriggerInfo_t` record with the response of the pattern
+   *
+   * Implementation of the public `applyWindowPattern()` with the addition of
+   * a cache of discriminated gates: when the pattern is rebased on each of the
+   * windows in turn (as in `simulateResponse()`), each window appears in
+   * several neighbourhoods, and this cache grants that its gate is
+   * discriminated against each requirement level only once per event rather
+   * than once per neighbourhood it belongs to.
+   */
+  TriggerInfo_t applyWindowPattern(
+    WindowTopology_t::WindowInfo_t const& windowInfo,
+    WindowPattern_t const& pattern,
+    TriggerGates_t const& gates,
+    DiscriminatedGateCache_t& cache
+    ) const;
+
+  /// Returns the gate of window `iWindow` discriminated against `level`,
+  /// computing it and storing it into `cache` on the first request.
+  TriggerGateData_t const& discriminatedGate(
+    DiscriminatedGateCache_t& cache, TriggerGates_t const& gates,
+    std::size_t iWindow, unsigned int level
+    ) const;
+
+
   /**
    * @brief Checks `gates` are compatible with the current window configuration.
    * @param gates the combined sliding window trigger gates, per cryostat
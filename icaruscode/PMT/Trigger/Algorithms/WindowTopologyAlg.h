@@ -24,6 +24,7 @@
 #include <optional>
 #include <vector>
 #include <string>
+#include <utility> // std::move()
 
 
 // -----------------------------------------------------------------------------
@@ -380,6 +381,13 @@ class icarus::trigger::WindowTopologyManager
   template <typename Gates>
   bool operator() (Gates const& gates);
 
+  /// Returns whether a topology has been set or extracted already.
+  bool hasTopology() const;
+
+  /// Directly sets the topology (e.g. from a job-wide cache);
+  /// the following calls will verify the gates against it.
+  void setTopology(WindowChannelMap topology);
+
   /// Access to the stored topology.
   /// @throw std::bad_optional_access if no topology has been set
   WindowChannelMap const& operator* () const;
@@ -468,6 +476,17 @@ inline icarus::trigger::WindowTopologyManager::WindowTopologyManager(
 {}
 
 
+//------------------------------------------------------------------------------
+inline bool icarus::trigger::WindowTopologyManager::hasTopology() const
+  { return fVerify.hasTopology(); }
+
+
+//------------------------------------------------------------------------------
+inline void icarus::trigger::WindowTopologyManager::setTopology
+  (WindowChannelMap topology)
+  { fVerify.setTopology(std::move(topology)); }
+
+
 //------------------------------------------------------------------------------
 inline auto icarus::trigger::WindowTopologyManager::operator* () const
   -> WindowChannelMap const&
@@ -40,14 +40,17 @@
 
 
 // C/C++ standard libraries
+#include <algorithm> // std::fill()
 #include <map>
 #include <set>
 #include <vector>
 #include <string>
 #include <memory> // std::unique_ptr
-#include <utility> // std::move()
+#include <optional>
+#include <utility> // std::move(), std::pair
 #include <cassert>
 #include <cstddef> // std::size_t
+#include <cstdint> // std::uint64_t
 
 
 //------------------------------------------------------------------------------
@@ -279,7 +282,19 @@ class icarus::trigger::LVDSgates: public art::EDProducer {
   /// Reconstituted trigger gate type internally used.
   using TrackedTriggerGate_t
     = icarus::trigger::TrackedOpticalTriggerGate<sbn::OpDetWaveformMeta>;
-  
+
+  /// Type of a tick in the input gates.
+  using ClockTick_t = OpticalTriggerGateData_t::ClockTick_t;
+
+  /// An open interval of a binary gate: [ `first`, `second` [.
+  using GateInterval_t = std::pair<ClockTick_t, ClockTick_t>;
+
+  /// Word of the packed binary gate rendering: one bit per tick.
+  using GateWord_t = std::uint64_t;
+
+  /// Number of ticks covered by each word of the packed gate rendering.
+  static constexpr std::size_t TicksPerWord = 64U;
+
   
   // --- BEGIN Configuration variables -----------------------------------------
   
@@ -346,7 +361,51 @@ class icarus::trigger::LVDSgates: public art::EDProducer {
     std::vector<raw::Channel_t> const& pairing,
     Op combine
     ) const;
-  
+
+  /**
+   * @brief Collects the open intervals of a binary gate.
+   * @param gate the gate to be parsed
+   * @param[out] intervals where to store the [ open, close [ tick intervals
+   * @return whether the gate could be fully parsed
+   *
+   * Returns `false`, leaving `intervals` in an unspecified state, if `gate`
+   * reaches an opening count of 2 or more (i.e. it is not binary) or if it
+   * opens and never closes again; such gates are combined via the generic
+   * `binaryCombineChannel()` path instead.
+   */
+  static bool collectOpenIntervals(
+    OpticalTriggerGateData_t const& gate,
+    std::vector<GateInterval_t>& intervals
+    );
+
+  /// Sets the bits of the ticks in `interval` into the packed gate `words`;
+  /// `offset` is the tick represented by the first bit of the first word.
+  static void setIntervalBits(
+    std::vector<GateWord_t>& words, ClockTick_t offset,
+    GateInterval_t const& interval
+    );
+
+  /**
+   * @brief Combines the binary gates of the `pairing` channels bit by bit.
+   * @param gates all the gates, indexed by channel number
+   * @param pairing channel numbers of the gates to be combined
+   * @param isOR `true` to combine with _OR_, `false` to combine with _AND_
+   * @return the combined gate, or no value if packed combination can't be used
+   *
+   * Each input gate is rendered as a bit mask with one bit per tick, packed
+   * into 64-tick words, and the combination is performed word by word with a
+   * bitwise OR or AND; the result is then converted back into a standard gate.
+   * For binary gates this is equivalent to the generic `GateOps::Max` or
+   * `GateOps::Min` combination; if any of the gates turns out not to be binary
+   * no value is returned and the caller is expected to fall back to
+   * `binaryCombineChannel()`.
+   */
+  std::optional<TrackedTriggerGate_t> packedCombineChannel(
+    std::vector<TrackedTriggerGate_t> const& gates,
+    std::vector<raw::Channel_t> const& pairing,
+    bool isOR
+    ) const;
+
   /// Performs the combination of a group of channels.
   TrackedTriggerGate_t combineChannels(
     std::vector<TrackedTriggerGate_t> const& gates,
@@ -574,8 +633,13 @@ auto icarus::trigger::LVDSgates::combineChannels(
     case ComboMode::disable:
       return discardChannels(gates, pairing);
     case ComboMode::AND:
+      // packed bit-per-tick fast path, equivalent for binary gates
+      if (auto gate = packedCombineChannel(gates, pairing, false); gate)
+        return std::move(*gate);
       return binaryCombineChannel(gates, pairing, GateOps::Min);
     case ComboMode::OR:
+      if (auto gate = packedCombineChannel(gates, pairing, true); gate)
+        return std::move(*gate);
       return binaryCombineChannel(gates, pairing, GateOps::Max);
     case ComboMode::Input1:
       return selectChannel(gates, pairing, 0U);
@@ -687,6 +751,165 @@ auto icarus::trigger::LVDSgates::binaryCombineChannel(
 } // icarus::trigger::LVDSgates::binaryCombineChannel()
 
 
+//------------------------------------------------------------------------------
+bool icarus::trigger::LVDSgates::collectOpenIntervals(
+  OpticalTriggerGateData_t const& gate,
+  std::vector<GateInterval_t>& intervals
+) {
+  intervals.clear();
+
+  // a gate reaching opening level 2 is not binary: not our business
+  if (gate.findOpen(2U, OpticalTriggerGateData_t::MinTick)
+    != OpticalTriggerGateData_t::MaxTick)
+  {
+    return false;
+  }
+
+  ClockTick_t tick = OpticalTriggerGateData_t::MinTick;
+  while (true) {
+    ClockTick_t const open = gate.findOpen(1U, tick);
+    if (open == OpticalTriggerGateData_t::MaxTick) break;
+    ClockTick_t const close = gate.findClose(1U, open);
+    if (close == OpticalTriggerGateData_t::MaxTick) return false; // never closes
+    intervals.emplace_back(open, close);
+    tick = close;
+  } // while
+
+  return true;
+} // icarus::trigger::LVDSgates::collectOpenIntervals()
+
+
+//------------------------------------------------------------------------------
+void icarus::trigger::LVDSgates::setIntervalBits(
+  std::vector<GateWord_t>& words, ClockTick_t offset,
+  GateInterval_t const& interval
+) {
+  // bit positions of the first tick in the interval and of the first one past
+  std::size_t const first = static_cast<std::size_t>(interval.first - offset);
+  std::size_t const end = static_cast<std::size_t>(interval.second - offset);
+
+  std::size_t iWord = first / TicksPerWord;
+  std::size_t const endWord = end / TicksPerWord;
+
+  GateWord_t const FullWord = ~GateWord_t{ 0 };
+  GateWord_t const firstMask = FullWord << (first % TicksPerWord);
+  GateWord_t const endMask // bits strictly before the end of the interval
+    = (end % TicksPerWord)? ~(FullWord << (end % TicksPerWord)): GateWord_t{ 0 };
+
+  if (iWord == endWord) {
+    words[iWord] |= (firstMask & endMask);
+    return;
+  }
+  words[iWord++] |= firstMask;
+  while (iWord < endWord) words[iWord++] = FullWord;
+  if (endMask) words[endWord] |= endMask;
+
+} // icarus::trigger::LVDSgates::setIntervalBits()
+
+
+//------------------------------------------------------------------------------
+auto icarus::trigger::LVDSgates::packedCombineChannel(
+  std::vector<TrackedTriggerGate_t> const& gates,
+  std::vector<raw::Channel_t> const& pairing,
+  bool isOR
+) const -> std::optional<TrackedTriggerGate_t> {
+
+  if (pairing.empty()) return std::nullopt; // let the generic path deal with it
+
+  //
+  // collect the open intervals of all the gates in the group; a single gate
+  // unfit for packing sends the whole group through the generic path
+  //
+  std::vector<std::vector<GateInterval_t>> allIntervals(pairing.size());
+  for (std::size_t iGate = 0U; iGate < pairing.size(); ++iGate) {
+    // requiring that gates are at an index matching their channel number
+    if (!collectOpenIntervals(gates[pairing[iGate]].gate(), allIntervals[iGate]))
+      return std::nullopt;
+    mf::LogTrace(fLogCategory) << "Input:  " << gates[pairing[iGate]].gate();
+  } // for
+
+  // channels and tracking of the result do not depend on the gate content
+  TrackedTriggerGate_t combined;
+  for (raw::Channel_t channel: pairing) {
+    combined.gate().addChannel(channel);
+    combined.tracking().add(gates[channel].tracking());
+  }
+
+  // a _AND_ combination with any gate always closed is always closed;
+  // the check also guarantees the tick span below is not empty
+  for (auto const& intervals: allIntervals) {
+    if (intervals.empty() && !isOR) {
+      mf::LogTrace(fLogCategory) << "Output: " << combined.gate();
+      return combined;
+    }
+  } // for
+
+  //
+  // tick span covered by any of the gate openings
+  //
+  ClockTick_t spanBegin = OpticalTriggerGateData_t::MaxTick;
+  ClockTick_t spanEnd = OpticalTriggerGateData_t::MinTick;
+  for (auto const& intervals: allIntervals) {
+    if (intervals.empty()) continue;
+    spanBegin = std::min(spanBegin, intervals.front().first);
+    spanEnd = std::max(spanEnd, intervals.back().second);
+  } // for
+  if (spanBegin >= spanEnd) { // all gates always closed: so is their OR
+    mf::LogTrace(fLogCategory) << "Output: " << combined.gate();
+    return combined;
+  }
+
+  //
+  // render each gate as one bit per tick and combine the words bitwise
+  //
+  std::size_t const nWords
+    = (static_cast<std::size_t>(spanEnd - spanBegin) + TicksPerWord - 1U)
+    / TicksPerWord;
+  std::vector<GateWord_t> words(nWords, GateWord_t{ 0 });
+  if (isOR) {
+    for (auto const& intervals: allIntervals)
+      for (GateInterval_t const& interval: intervals)
+        setIntervalBits(words, spanBegin, interval);
+  }
+  else {
+    for (GateInterval_t const& interval: allIntervals.front())
+      setIntervalBits(words, spanBegin, interval);
+    std::vector<GateWord_t> mask(nWords);
+    for (std::size_t iGate = 1U; iGate < allIntervals.size(); ++iGate) {
+      std::fill(mask.begin(), mask.end(), GateWord_t{ 0 });
+      for (GateInterval_t const& interval: allIntervals[iGate])
+        setIntervalBits(mask, spanBegin, interval);
+      for (std::size_t iWord = 0U; iWord < nWords; ++iWord)
+        words[iWord] &= mask[iWord];
+    } // for gates
+  }
+
+  //
+  // convert the packed rendering back into a standard gate,
+  // skipping in one step the words with no level transition inside
+  //
+  bool open = false;
+  for (std::size_t iWord = 0U; iWord < nWords; ++iWord) {
+    GateWord_t const word = words[iWord];
+    if (word == (open? ~GateWord_t{ 0 }: GateWord_t{ 0 })) continue;
+    ClockTick_t const wordTick
+      = spanBegin + static_cast<ClockTick_t>(iWord * TicksPerWord);
+    for (std::size_t bit = 0U; bit < TicksPerWord; ++bit) {
+      bool const bitOpen = ((word >> bit) & 1) != 0;
+      if (bitOpen == open) continue;
+      ClockTick_t const tick = wordTick + static_cast<ClockTick_t>(bit);
+      if (bitOpen) combined.gate().openAt(tick, 1U);
+      else combined.gate().closeAt(tick, 1U);
+      open = bitOpen;
+    } // for bits
+  } // for words
+  assert(!open); // all the collected intervals close within the span
+
+  mf::LogTrace(fLogCategory) << "Output: " << combined.gate();
+  return combined;
+} // icarus::trigger::LVDSgates::packedCombineChannel()
+
+
 //------------------------------------------------------------------------------
 unsigned int icarus::trigger::LVDSgates::checkPairings() const {
 
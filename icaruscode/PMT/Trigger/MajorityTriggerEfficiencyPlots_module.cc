@@ -584,10 +584,14 @@ void icarus::trigger::MajorityTriggerEfficiencyPlots::analyze
 
 //------------------------------------------------------------------------------
 void icarus::trigger::MajorityTriggerEfficiencyPlots::endJob() {
-  
+
+  // create the plots which were never filled, so that they appear (empty)
+  // in the output file anyway
+  helper().materializePlots();
+
   // hook helper and framework
   helper().printSummary();
-  
+
 } // icarus::trigger::MajorityTriggerEfficiencyPlots::endJob()
 
 
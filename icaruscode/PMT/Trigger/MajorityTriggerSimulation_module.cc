@@ -13,7 +13,7 @@
 #include "icaruscode/PMT/Trigger/Algorithms/details/TriggerInfo_t.h"
 #include "sbnobj/ICARUS/PMT/Trigger/Data/OpticalTriggerGate.h"
 #include "icaruscode/PMT/Trigger/Utilities/TrackedOpticalTriggerGate.h"
-#include "icaruscode/PMT/Trigger/Utilities/TriggerDataUtils.h" // ReadTriggerGates()
+#include "icaruscode/PMT/Trigger/TriggerGateCache.h"
 #include "icaruscode/PMT/Trigger/Utilities/TriggerGateOperations.h"
 #include "icaruscode/PMT/Trigger/Utilities/PlotSandbox.h"
 #include "icaruscode/IcarusObj/OpDetWaveformMeta.h"
@@ -50,6 +50,7 @@
 #include "art/Framework/Core/EDProducer.h"
 #include "art/Framework/Core/ModuleMacros.h"
 #include "art/Framework/Principal/Event.h"
+#include "canvas/Persistency/Common/Assns.h"
 #include "canvas/Utilities/InputTag.h"
 #include "canvas/Utilities/Exception.h"
 #include "messagefacility/MessageLogger/MessageLogger.h"
@@ -74,6 +75,7 @@
 #  include <source_location>
 #endif //  __cpp_lib_source_location
 #include <utility> // std::pair<>, std::move()
+#include <type_traits> // std::decay_t
 #include <cmath> // std::ceil()
 #include <cstddef> // std::size_t
 #include <cassert>
@@ -102,11 +104,90 @@ class icarus::trigger::MajorityTriggerCombiner
   /// Combines all the gates (by cryostat) in a single majority gate.
   template <typename GateObj>
   GateObj combine(std::vector<GateObj> const& gates) const
-    { return icarus::trigger::sumGates(gates); }
+    {
+      if (gates.empty()) return {};
+      return directSum(gates);
+    }
+
 
-  
     private:
-  
+
+  /**
+   * @brief Returns the sum of all the `gates` in a single sweep.
+   *
+   * The result is the same as `icarus::trigger::sumGates()`: a gate whose
+   * opening count at each tick is the sum of the opening counts of all the
+   * input gates, covering all their channels (and, for tracked gates, their
+   * tracking information).
+   *
+   * Instead of summing the gates pairwise, though, all their opening level
+   * changes are collected first and then merged into the result in a single
+   * sorted sweep, with no intermediate combination gate ever created: with
+   * hundreds of input channels, this is where the majority simulation used
+   * to spend most of its time.
+   */
+  template <typename GateObj>
+  GateObj directSum(std::vector<GateObj> const& gates) const
+    {
+      using GateData_t = std::decay_t
+        <decltype(icarus::trigger::gateDataIn(std::declval<GateObj const&>()))>;
+      using ClockTick_t = typename GateData_t::ClockTick_t;
+
+      /// An opening level change: the tick it happens at, and its amount.
+      using LevelChange_t = std::pair<ClockTick_t, int>;
+
+      GateObj combined;
+
+      //
+      // collect all the opening level changes of all the gates;
+      // channels and tracking are merged on the way
+      //
+      std::vector<LevelChange_t> changes;
+      for (GateObj const& gate: gates) {
+        auto const& gateData = icarus::trigger::gateDataIn(gate);
+
+        for (auto const channel: gateData.channels())
+          icarus::trigger::gateDataIn(combined).addChannel(channel);
+        if constexpr (icarus::trigger::isTrackedTriggerGate_v<GateObj>)
+          combined.tracking().add(gate.tracking());
+
+        ClockTick_t tick = GateData_t::MinTick;
+        auto count = gateData.openingCount(tick);
+        if (count > 0U) changes.emplace_back(tick, static_cast<int>(count));
+        while (true) {
+          // the next change is the first tick where the opening level leaves
+          // the current one, in either direction
+          ClockTick_t const up = gateData.findOpen(count + 1U, tick);
+          ClockTick_t const down
+            = (count > 0U)? gateData.findClose(count, tick): GateData_t::MaxTick;
+          ClockTick_t const next = std::min(up, down);
+          if (next == GateData_t::MaxTick) break;
+          auto const newCount = gateData.openingCount(next);
+          changes.emplace_back
+            (next, static_cast<int>(newCount) - static_cast<int>(count));
+          count = newCount;
+          tick = next;
+        } // while
+      } // for gates
+
+      //
+      // merge the changes into the combined gate, one tick at a time
+      //
+      std::sort(changes.begin(), changes.end());
+      auto& combinedData = icarus::trigger::gateDataIn(combined);
+      auto iChange = changes.begin();
+      while (iChange != changes.end()) {
+        ClockTick_t const tick = iChange->first;
+        int change = 0;
+        do { change += iChange->second; }
+        while ((++iChange != changes.end()) && (iChange->first == tick));
+        if (change > 0) combinedData.openAt(tick, change);
+        else if (change < 0) combinedData.closeAt(tick, -change);
+      } // while
+
+      return combined;
+    } // directSum()
+
 }; // class icarus::trigger::MajorityTriggerCombiner
 
 
@@ -265,6 +346,12 @@ namespace icarus::trigger { class MajorityTriggerSimulation; }
  * An example job configuration is provided as
  * `simulatemajoritytriggers_icarus.fcl`.
  * 
+ * The input gates are fetched via the `icarus::trigger::TriggerGateCache`
+ * service; in a threshold scan campaign the service can be configured to
+ * snapshot them into a compact file on the first pass and to resume from it
+ * on the following ones, so that only the majority evaluation is re-run (see
+ * the service documentation).
+ * 
  * 
  * Output data products
  * =====================
@@ -464,6 +551,9 @@ class icarus::trigger::MajorityTriggerSimulation
   /// ROOT directory where all the plots are written.
   art::TFileDirectory fOutputDir;
 
+  /// Per-event cache of unpacked gates, shared among all trigger modules.
+  art::ServiceHandle<icarus::trigger::TriggerGateCache> fGateCache;
+
   // --- END Service variables -------------------------------------------------
 
   
@@ -793,7 +883,7 @@ auto icarus::trigger::MajorityTriggerSimulation::produceForThreshold(
   // get the input
   //
   art::InputTag const dataTag = fADCthresholds.at(thr);
-  auto const& gates = icarus::trigger::ReadTriggerGates(event, dataTag);
+  auto const& gates = fGateCache->retrieveTriggerGates(event, dataTag);
   
   //
   // simulate the trigger response
@@ -860,13 +950,15 @@ auto icarus::trigger::MajorityTriggerSimulation::simulateCryostat(
 {
   using detinfo::timescales::optical_tick;
   
-  /* 
-   * 1. combine the trigger primitives
-   * 2. apply the beam gate on the combination
+  /*
+   * 1. apply the beam gate on each trigger primitive
+   * 2. combine the gated trigger primitives
    * 3. compute the trigger response
    */
   
-  auto const combinedCount = beamGate.apply(fCombiner.combine(gates));
+  // the beam gate is applied to each input first, so that the combination
+  // only ever processes the level changes within the beam gate itself
+  auto const combinedCount = fCombiner.combine(beamGate.applyToAll(gates));
   
   TriggerInfo_t triggerInfo;
   icarus::trigger::details::GateOpeningInfoExtractor extractOpeningInfo
@@ -86,7 +86,13 @@ struct TriggerGatesInfo {
   
   /// Collection of all available trigger gates.
   std::vector<TriggerGateInfo> TriggerGates;
-  
+
+  /// Number of gates with at least one opening in the beam gate.
+  unsigned int nOpenChannels = 0U;
+
+  /// Largest number of openings of any single gate.
+  unsigned int maxOpenings = 0U;
+
 }; // struct TriggerGatesInfo
 
 std::ostream& operator<<
@@ -127,23 +133,38 @@ std::ostream& operator<< (std::ostream& out, TriggerGatesInfo const& info);
  * 
  * All branches come from a variable size vector with size the number of
  * available trigger gates.
+ *
+ * In addition, per-event summary branches are always filled:
+ *
+ * * `NOpenChannels` (from `TriggerGatesInfo::nOpenChannels`): the number of
+ *    gates that opened at least once during the beam gate;
+ * * `MaxOpenings` (from `TriggerGatesInfo::maxOpenings`): the largest number
+ *    of openings of any single gate;
+ * * `FullDetail`: whether the per-gate branches above are filled for this
+ *    entry; when the entry is thinned (see the module documentation) the
+ *    per-gate branches are left empty while `NChannels` still reports the
+ *    number of gates in the input.
  */
 struct TriggerGateTree: public icarus::trigger::details::TreeHolder {
 
   /// Constructor.
   TriggerGateTree(TTree& tree);
-  
-  /// Copies the information from the `info` record into the ROOT tree buffers.
-  void assignTriggerGatesInfo(TriggerGatesInfo const& info);
+
+  /// Copies the information from the `info` record into the ROOT tree buffers;
+  /// with `fullDetail` `false` only the summary branches are filled.
+  void assignTriggerGatesInfo(TriggerGatesInfo const& info, bool fullDetail);
 
     private:
-  
+
   UInt_t fNChannels; ///< Number of channels.
-  
+  UInt_t fNOpenChannels; ///< Number of gates that opened at all.
+  UInt_t fMaxOpenings; ///< Largest number of openings of a single gate.
+  Bool_t fFullDetail; ///< Whether the per-gate branches are filled.
+
   std::vector<geo::Point_t> fOpDetPos; ///< Coordinates of the optical detector.
   std::vector<UInt_t> fNOpenings; ///< Number of openings (`0` if never opens).
   std::vector<Double_t> fOpeningTime; ///< Time of first opening.
-  
+
   /// Internal check: all branch buffers have the same size.
   void checkSizes() const;
 
@@ -226,10 +247,18 @@ namespace icarus::trigger { class MakeTriggerSimulationTree; }
  *      pre-spill window to the start of beam gate;
  * * `EventTreeName` (string, default: "Treegger"): the name of the ROOT tree
  *     being written on disk;
+ * * `ThinningMinOpenChannels`, `ThinningMaxOpenChannels` (integral, default:
+ *     no thinning): when either is specified, full per-gate detail is written
+ *     only for the events whose number of open gates falls within the
+ *     specified range (extremes included); the other events get a
+ *     summary-only tree entry, with the per-gate branches empty and the
+ *     `FullDetail` branch unset. Threshold scans typically set the range
+ *     around the trigger thresholds under study, cutting the tree volume
+ *     while keeping the statistically relevant events complete;
  * * `LogCategory` (string, default `MakeTriggerSimulationTree`): name of
  *     category used to stream messages from this module into message facility.
- * 
- * 
+ *
+ *
  * Technical description of the module
  * ====================================
  * 
@@ -296,7 +325,23 @@ class icarus::trigger::MakeTriggerSimulationTree: public art::EDAnalyzer {
       Comment("name of the ROOT tree"),
       "Treegger" // default
       };
-    
+
+    fhicl::OptionalAtom<unsigned int> ThinningMinOpenChannels {
+      Name("ThinningMinOpenChannels"),
+      Comment(
+        "keep full per-gate detail only for events with at least this many"
+        " open gates"
+        )
+      };
+
+    fhicl::OptionalAtom<unsigned int> ThinningMaxOpenChannels {
+      Name("ThinningMaxOpenChannels"),
+      Comment(
+        "keep full per-gate detail only for events with at most this many"
+        " open gates"
+        )
+      };
+
     fhicl::Atom<std::string> LogCategory {
       Name("LogCategory"),
       Comment("name of the category used for the output"),
@@ -346,9 +391,15 @@ class icarus::trigger::MakeTriggerSimulationTree: public art::EDAnalyzer {
   /// Tag for optical trigger gate data product.
   art::InputTag const fTriggerGatesTag;
   
+  /// Keep full detail only for events with at least this many open gates.
+  std::optional<unsigned int> const fThinningMinOpenChannels;
+
+  /// Keep full detail only for events with at most this many open gates.
+  std::optional<unsigned int> const fThinningMaxOpenChannels;
+
   /// Name of output stream for message facility.
   std::string const fLogCategory;
-  
+
   // --- END Configuration variables -------------------------------------------
 
 
@@ -421,7 +472,11 @@ class icarus::trigger::MakeTriggerSimulationTree: public art::EDAnalyzer {
   /// contributing to the specified `gate`, in world coordinates [cm]
   geo::Point_t gateChannelCentroid
     (icarus::trigger::OpticalTriggerGateData_t const& gate) const;
-  
+
+  /// Returns whether full per-gate detail should be written for an event
+  /// with the specified trigger information (see `ThinningMinOpenChannels`).
+  bool keepFullDetail(TriggerGatesInfo const& info) const;
+
   
   /// Creates a `EDepTags_t` from two optional parameters.
   static icarus::trigger::details::EventInfoExtractor::EDepTags_t makeEdepTag(
@@ -469,11 +524,14 @@ TriggerGateTree::TriggerGateTree(TTree& tree)
   : TreeHolder(tree)
 {
   
-  this->tree().Branch("NChannels",   &fNChannels);
-  this->tree().Branch("OpDetPos",    &fOpDetPos);
-  this->tree().Branch("NOpenings",   &fNOpenings);
-  this->tree().Branch("OpeningTime", &fOpeningTime);
-  
+  this->tree().Branch("NChannels",     &fNChannels);
+  this->tree().Branch("NOpenChannels", &fNOpenChannels);
+  this->tree().Branch("MaxOpenings",   &fMaxOpenings);
+  this->tree().Branch("FullDetail",    &fFullDetail);
+  this->tree().Branch("OpDetPos",      &fOpDetPos);
+  this->tree().Branch("NOpenings",     &fNOpenings);
+  this->tree().Branch("OpeningTime",   &fOpeningTime);
+
 } // TriggerGateTree::TriggerGateTree()
 
 
@@ -502,12 +560,21 @@ void TriggerGateTree::checkSizes() const {
 
 
 //------------------------------------------------------------------------------
-void TriggerGateTree::assignTriggerGatesInfo(TriggerGatesInfo const& info) {
-  
+void TriggerGateTree::assignTriggerGatesInfo
+  (TriggerGatesInfo const& info, bool fullDetail)
+{
+
   fNChannels = info.TriggerGates.size();
+  fNOpenChannels = info.nOpenChannels;
+  fMaxOpenings = info.maxOpenings;
+  fFullDetail = fullDetail;
   fOpDetPos.clear();
   fNOpenings.clear();
   fOpeningTime.clear();
+
+  // summary-only record: the per-gate branches stay empty
+  if (!fullDetail) return;
+
   for
     (auto const& [ iChannel, channelInfo ]: util::enumerate(info.TriggerGates))
   {
@@ -539,6 +606,10 @@ icarus::trigger::MakeTriggerSimulationTree::MakeTriggerSimulationTree
   , fPreSpillStart
       (fBeamGateStart - config().PreSpillWindowGap() - fPreSpillWindow)
   , fTriggerGatesTag(config().TriggerGatesTag())
+  , fThinningMinOpenChannels
+      (util::fhicl::getOptionalValue(config().ThinningMinOpenChannels))
+  , fThinningMaxOpenChannels
+      (util::fhicl::getOptionalValue(config().ThinningMaxOpenChannels))
   , fLogCategory(config().LogCategory())
   // setup
   , fGeom(*lar::providerFrom<geo::Geometry>())
@@ -599,8 +670,11 @@ void icarus::trigger::MakeTriggerSimulationTree::analyze
   
   fIDTree.assignID(event.id());
   if (fEventTree) fEventTree->assignEvent(eventInfo);
-  if (fTriggerGateTree) fTriggerGateTree->assignTriggerGatesInfo(triggerInfo);
-  
+  if (fTriggerGateTree) {
+    fTriggerGateTree->assignTriggerGatesInfo
+      (triggerInfo, keepFullDetail(triggerInfo));
+  }
+
   fIDTree.tree().Fill();
   
 } // icarus::trigger::MakeTriggerSimulationTree::analyze()
@@ -667,7 +741,8 @@ TriggerGatesInfo icarus::trigger::MakeTriggerSimulationTree::extractTriggerInfo
       openTick = beamAndGate.findOpen(1U, openTick);
     } // while
     if (nOpenings > 0) ++nOpenChannels;
-    
+    if (nOpenings > info.maxOpenings) info.maxOpenings = nOpenings;
+
     //
     // 2.4. fill the information
     //
@@ -684,7 +759,9 @@ TriggerGatesInfo icarus::trigger::MakeTriggerSimulationTree::extractTriggerInfo
       });
     
   } // for all gates
-  
+
+  info.nOpenChannels = nOpenChannels;
+
   mf::LogTrace(fLogCategory)
     << "Information from '" << fTriggerGatesTag.encode() << "' ("
     << gates.size() << " trigger gates, " << nOpenChannels
@@ -720,6 +797,26 @@ geo::Point_t icarus::trigger::MakeTriggerSimulationTree::gateChannelCentroid
 } // icarus::trigger::MakeTriggerSimulationTree::gateChannelCentroid()
 
 
+//------------------------------------------------------------------------------
+bool icarus::trigger::MakeTriggerSimulationTree::keepFullDetail
+  (TriggerGatesInfo const& info) const
+{
+
+  if (fThinningMinOpenChannels
+    && (info.nOpenChannels < *fThinningMinOpenChannels))
+  {
+    return false;
+  }
+  if (fThinningMaxOpenChannels
+    && (info.nOpenChannels > *fThinningMaxOpenChannels))
+  {
+    return false;
+  }
+  return true;
+
+} // icarus::trigger::MakeTriggerSimulationTree::keepFullDetail()
+
+
 //------------------------------------------------------------------------------
 icarus::trigger::details::EventInfoExtractor::EDepTags_t
 icarus::trigger::MakeTriggerSimulationTree::makeEdepTag(
@@ -0,0 +1,176 @@
+/**
+ * @file   PackTriggerGates_module.cc
+ * @brief  Rewrites trigger gates into a compact persistent representation.
+ * @date   August 31, 2026
+ * @see    icaruscode/IcarusObj/PackedTriggerGate.h
+ */
+
+// ICARUS libraries
+#include "icaruscode/IcarusObj/PackedTriggerGate.h"
+#include "sbnobj/ICARUS/PMT/Trigger/Data/OpticalTriggerGate.h"
+
+// framework libraries
+#include "art/Framework/Core/EDProducer.h"
+#include "art/Framework/Core/ModuleMacros.h"
+#include "art/Framework/Principal/Event.h"
+#include "canvas/Utilities/InputTag.h"
+#include "fhiclcpp/types/Atom.h"
+#include "messagefacility/MessageLogger/MessageLogger.h"
+
+// C/C++ standard libraries
+#include <memory> // std::make_unique()
+#include <vector>
+#include <string>
+#include <cstdint>
+
+
+// -----------------------------------------------------------------------------
+namespace icarus::trigger { class PackTriggerGates; }
+/**
+ * @brief Produces a compact copy of a trigger gate collection.
+ *
+ * For each gate in the input collection a
+ * `icarus::trigger::PackedTriggerGate` is produced, holding the same
+ * channels and opening level changes delta-encoded into a varint byte
+ * stream. Dropping the verbose collection from the output in favour of the
+ * packed one cuts the size of the trigger emulation products by roughly an
+ * order of magnitude; `icarus::trigger::PackedTriggerGate::unpack()`
+ * restores gates equal to the originals.
+ *
+ * Input
+ * ------
+ *
+ * * `std::vector<icarus::trigger::OpticalTriggerGateData_t>` (tag from
+ *   `TriggerGatesTag`): the gates to be packed
+ *
+ * Output
+ * -------
+ *
+ * * `std::vector<icarus::trigger::PackedTriggerGate>`: packed gates, in the
+ *   same order as the input collection
+ *
+ * Configuration parameters
+ * -------------------------
+ *
+ * * `TriggerGatesTag` (input tag, mandatory): the data product with the
+ *   gates to be packed
+ * * `LogCategory` (string, default: `PackTriggerGates`): name of the
+ *   category used for the output
+ */
+class icarus::trigger::PackTriggerGates: public art::EDProducer {
+
+    public:
+
+  struct Config {
+
+    using Name = fhicl::Name;
+    using Comment = fhicl::Comment;
+
+    fhicl::Atom<art::InputTag> TriggerGatesTag {
+      Name("TriggerGatesTag"),
+      Comment("data product with the trigger gates to be packed")
+      };
+
+    fhicl::Atom<std::string> LogCategory {
+      Name("LogCategory"),
+      Comment("name of the category used for the output"),
+      "PackTriggerGates" // default
+      };
+
+  }; // struct Config
+
+  using Parameters = art::EDProducer::Table<Config>;
+
+  explicit PackTriggerGates(Parameters const& config);
+
+  // Plugins should not be copied or assigned.
+  PackTriggerGates(PackTriggerGates const&) = delete;
+  PackTriggerGates(PackTriggerGates&&) = delete;
+  PackTriggerGates& operator= (PackTriggerGates const&) = delete;
+  PackTriggerGates& operator= (PackTriggerGates&&) = delete;
+
+  virtual void produce(art::Event& event) override;
+
+  /// Prints a summary of the achieved packing.
+  virtual void endJob() override;
+
+    private:
+
+  // --- BEGIN Configuration variables -----------------------------------------
+
+  art::InputTag const fTriggerGatesTag; ///< Input gate collection tag.
+  std::string const fLogCategory; ///< Message facility stream category.
+
+  // --- END Configuration variables -------------------------------------------
+
+
+  // --- BEGIN Per-job counters ------------------------------------------------
+
+  unsigned int fNGates = 0U; ///< Number of gates packed in the job.
+  std::uint64_t fPackedBytes = 0U; ///< Total size of the packed streams.
+
+  // --- END Per-job counters --------------------------------------------------
+
+}; // class icarus::trigger::PackTriggerGates
+
+
+// -----------------------------------------------------------------------------
+// --- implementation
+// -----------------------------------------------------------------------------
+icarus::trigger::PackTriggerGates::PackTriggerGates(Parameters const& config)
+  : art::EDProducer(config)
+  // configuration
+  , fTriggerGatesTag(config().TriggerGatesTag())
+  , fLogCategory(config().LogCategory())
+{
+
+  consumes<std::vector<OpticalTriggerGateData_t>>(fTriggerGatesTag);
+
+  produces<std::vector<icarus::trigger::PackedTriggerGate>>();
+
+} // icarus::trigger::PackTriggerGates::PackTriggerGates()
+
+
+// -----------------------------------------------------------------------------
+void icarus::trigger::PackTriggerGates::produce(art::Event& event) {
+
+  auto const& gates = *(
+    event.getValidHandle<std::vector<OpticalTriggerGateData_t>>
+      (fTriggerGatesTag)
+    );
+
+  auto packedGates
+    = std::make_unique<std::vector<icarus::trigger::PackedTriggerGate>>();
+  packedGates->reserve(gates.size());
+
+  for (OpticalTriggerGateData_t const& gate: gates) {
+    packedGates->emplace_back(gate);
+    fPackedBytes += packedGates->back().packedSize();
+  } // for gates
+
+  fNGates += gates.size();
+
+  mf::LogTrace(fLogCategory)
+    << "Packed " << gates.size() << " gates from '"
+    << fTriggerGatesTag.encode() << "'";
+
+  event.put(std::move(packedGates));
+
+} // icarus::trigger::PackTriggerGates::produce()
+
+
+// -----------------------------------------------------------------------------
+void icarus::trigger::PackTriggerGates::endJob() {
+
+  mf::LogInfo(fLogCategory)
+    << "Packed " << fNGates << " gates from '" << fTriggerGatesTag.encode()
+    << "' into " << fPackedBytes << " bytes of transition data";
+
+} // icarus::trigger::PackTriggerGates::endJob()
+
+
+// -----------------------------------------------------------------------------
+DEFINE_ART_MODULE(icarus::trigger::PackTriggerGates)
+
+
+// -----------------------------------------------------------------------------
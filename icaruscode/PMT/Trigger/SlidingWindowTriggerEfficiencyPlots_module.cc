@@ -11,6 +11,7 @@
 #include "icaruscode/PMT/Trigger/TriggerEfficiencyPlotsBase.h"
 #include "icaruscode/PMT/Trigger/Algorithms/SlidingWindowPatternAlg.h"
 #include "icaruscode/PMT/Trigger/Algorithms/WindowTopologyAlg.h" // WindowTopologyManager
+#include "icaruscode/PMT/Trigger/WindowTopologyCache.h"
 #include "icaruscode/PMT/Trigger/Algorithms/WindowPatternConfig.h"
 #include "icaruscode/PMT/Trigger/Algorithms/WindowPattern.h"
 #include "icaruscode/PMT/Trigger/Utilities/PlotSandbox.h"
@@ -395,10 +396,13 @@ class icarus::trigger::SlidingWindowTriggerEfficiencyPlots
 
   // --- BEGIN Internal variables ----------------------------------------------
   
+  /// Job-wide cache of window topology, shared among all trigger modules.
+  art::ServiceHandle<icarus::trigger::WindowTopologyCache> fTopologyCache;
+
   /// Mapping of each sliding window with location and topological information.
   // mutable = not thread-safe; optional to allow delayed construction
   mutable icarus::trigger::WindowTopologyManager fWindowMapMan;
-  
+
   /// All algorithm instances, one per pattern.
   std::vector<icarus::trigger::SlidingWindowPatternAlg> fPatternAlgs;
   
@@ -744,8 +748,19 @@ void icarus::trigger::SlidingWindowTriggerEfficiencyPlots::simulateAndPlot(
   //
   
   // throws exception on verification failure;
-  // pattern algorithms are constructed here because they require window mapping
-  if (fWindowMapMan(gates)) initializePatternAlgorithms();
+  // pattern algorithms are constructed here because they require window mapping;
+  // the topology extraction happens once per job, shared through the cache
+  if (!fWindowMapMan.hasTopology()) {
+    fWindowMapMan.setTopology
+      (fTopologyCache->topologyFor(gates, helper().geometry()));
+    initializePatternAlgorithms();
+  }
+  else if (!helper().gateInputAttested(thresholdIndex)) {
+    // inputs published with an ordering attestation were already laid out by
+    // their producer in the order the topology was extracted from: only the
+    // ones without it need the defensive per-event verification
+    fWindowMapMan(gates);
+  }
 
   
   auto const& beamGate = helper().makeMyBeamGate(clockData);
@@ -783,12 +798,18 @@ void icarus::trigger::SlidingWindowTriggerEfficiencyPlots::simulateAndPlot(
   //
   // 2. for each pattern:
   //
+  // discriminated window gates are shared across all the patterns: all the
+  // pattern algorithms work on the same input, and each requirement level
+  // appearing in multiple patterns needs to be discriminated only once
+  icarus::trigger::SlidingWindowPatternAlg::DiscriminatedGateCache_t
+    discrGateCache;
+
   for (auto const& [ iPattern, pattern ]: util::enumerate(fPatterns)) {
 
     auto& patternAlg = fPatternAlgs[iPattern];
-    
+
     WindowTriggerInfo_t const triggerInfo
-      = patternAlg.simulateResponse(inBeamGates);
+      = patternAlg.simulateResponse(inBeamGates, discrGateCache);
     
     registerTriggerResult(thresholdIndex, iPattern, triggerInfo.info);
 
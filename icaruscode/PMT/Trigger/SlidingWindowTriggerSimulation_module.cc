@@ -9,6 +9,7 @@
 // ICARUS libraries
 #include "icaruscode/PMT/Trigger/Algorithms/SlidingWindowPatternAlg.h"
 #include "icaruscode/PMT/Trigger/Algorithms/WindowTopologyAlg.h" // WindowTopologyManager
+#include "icaruscode/PMT/Trigger/WindowTopologyCache.h"
 #include "icaruscode/PMT/Trigger/Algorithms/WindowPatternConfig.h"
 #include "icaruscode/PMT/Trigger/Algorithms/WindowPattern.h"
 #include "icaruscode/PMT/Trigger/Algorithms/ApplyBeamGate.h"
@@ -16,7 +17,7 @@
 #include "icaruscode/PMT/Trigger/Algorithms/TriggerTypes.h" // ADCCounts_t
 #include "icaruscode/PMT/Trigger/Algorithms/details/TriggerInfo_t.h"
 #include "sbnobj/ICARUS/PMT/Trigger/Data/OpticalTriggerGate.h"
-#include "icaruscode/PMT/Trigger/Utilities/TriggerDataUtils.h" // FillTriggerGates()
+#include "icaruscode/PMT/Trigger/TriggerGateCache.h"
 #include "icaruscode/PMT/Trigger/Utilities/PlotSandbox.h"
 #include "icaruscode/IcarusObj/OpDetWaveformMeta.h" // sbn::OpDetWaveformMeta
 #include "icarusalg/Utilities/ROOTutils.h" // util::ROOT
@@ -53,6 +54,7 @@
 #include "art/Framework/Core/EDProducer.h"
 #include "art/Framework/Core/ModuleMacros.h"
 #include "art/Framework/Principal/Event.h"
+#include "canvas/Persistency/Common/Assns.h"
 #include "canvas/Utilities/InputTag.h"
 #include "canvas/Utilities/Exception.h"
 #include "messagefacility/MessageLogger/MessageLogger.h"
@@ -149,6 +151,12 @@ namespace icarus::trigger { class SlidingWindowTriggerSimulation; }
  * An example job configuration is provided as
  * `simulate_sliding_window_trigger_icarus.fcl`.
  * 
+ * The input gates are fetched via the `icarus::trigger::TriggerGateCache`
+ * service; in a threshold scan campaign the service can be configured to
+ * snapshot them into a compact file on the first pass and to resume from it
+ * on the following ones, so that only the pattern evaluation is re-run (see
+ * the service documentation).
+ * 
  * 
  * Output data products
  * =====================
@@ -380,6 +388,12 @@ class icarus::trigger::SlidingWindowTriggerSimulation
   /// ROOT directory where all the plots are written.
   art::TFileDirectory fOutputDir;
 
+  /// Job-wide cache of window topology, shared among all trigger modules.
+  art::ServiceHandle<icarus::trigger::WindowTopologyCache> fTopologyCache;
+
+  /// Per-event cache of unpacked gates, shared among all trigger modules.
+  art::ServiceHandle<icarus::trigger::TriggerGateCache> fGateCache;
+
   // --- END Service variables -------------------------------------------------
 
   
@@ -497,11 +511,6 @@ class icarus::trigger::SlidingWindowTriggerSimulation
   //@}
   
   
-  /// Reads a set of input gates from the `event`
-  /// @return trigger gates, converted into `InputTriggerGate_t`
-  static TriggerGates_t readTriggerGates
-    (art::Event const& event, art::InputTag const& dataTag);
-  
   //@{
   /// Returns the time of the event in seconds from The Epoch.
   static double eventTimestampInSeconds(art::Timestamp const& time);
@@ -796,12 +805,17 @@ auto icarus::trigger::SlidingWindowTriggerSimulation::produceForThreshold(
   // get the input
   //
   art::InputTag const& dataTag = fADCthresholds.at(thrTag);
-  auto const& gates = readTriggerGates(event, dataTag);
+  auto const& gates = fGateCache->retrieveTriggerGates(event, dataTag);
   
   
-  // extract or verify the topology of the trigger windows
-  if (fWindowMapMan(gates))
+  // learn or verify the topology of the trigger windows; the extraction is
+  // performed once per job and shared among trigger modules via the cache
+  if (!fWindowMapMan.hasTopology()) {
+    fWindowMapMan.setTopology(fTopologyCache->topologyFor
+      (gates, *lar::providerFrom<geo::Geometry>()));
     fPatternAlg.emplace(*fWindowMapMan, fPattern, fLogCategory);
+  }
+  else fWindowMapMan(gates);
   assert(fPatternAlg);
   
   //
@@ -905,32 +919,6 @@ icarus::trigger::SlidingWindowTriggerSimulation::triggerInfoToTriggerData
 } // icarus::trigger::SlidingWindowTriggerSimulation::triggerInfoToTriggerData()
 
 
-//------------------------------------------------------------------------------
-auto icarus::trigger::SlidingWindowTriggerSimulation::readTriggerGates
-  (art::Event const& event, art::InputTag const& dataTag)
-  -> TriggerGates_t
-{
-
-  using icarus::trigger::OpticalTriggerGateData_t; // for convenience
-
-  // currently the associations are a waste of time memory...
-  auto const& gates
-    = event.getProduct<std::vector<OpticalTriggerGateData_t>>(dataTag);
-  auto const& gateToWaveforms = event.getProduct
-    <art::Assns<OpticalTriggerGateData_t, sbn::OpDetWaveformMeta>>(dataTag);
-  
-  try {
-    return icarus::trigger::FillTriggerGates(gates, gateToWaveforms);
-  }
-  catch (cet::exception const& e) {
-    throw cet::exception("SlidingWindowTriggerSimulation", "", e)
-      << "Error encountered while reading data products from '"
-      << dataTag.encode() << "'\n";
-  }
-
-} // icarus::trigger::SlidingWindowTriggerSimulation::readTriggerGates()
-
-
 //------------------------------------------------------------------------------
 double icarus::trigger::SlidingWindowTriggerSimulation::eventTimestampInSeconds
   (art::Timestamp const& time)
@@ -16,6 +16,7 @@
 #include "icaruscode/PMT/Trigger/Utilities/TriggerDataUtils.h"
 #include "icaruscode/PMT/Algorithms/PMTverticalSlicingAlg.h"
 #include "icaruscode/IcarusObj/OpDetWaveformMeta.h" // sbn::OpDetWaveformMeta
+#include "icaruscode/IcarusObj/GateOrderingAttestation.h"
 #include "icarusalg/Utilities/FHiCLutils.h" // util::fhicl::getOptionalValue()
 
 // LArSoft libraries
@@ -470,6 +471,7 @@ icarus::trigger::SlidingWindowTrigger::SlidingWindowTrigger
     produces<std::vector<OpticalTriggerGateData_t>>(inputDataTag.instance());
     produces<art::Assns<OpticalTriggerGateData_t, sbn::OpDetWaveformMeta>>
       (inputDataTag.instance());
+    produces<icarus::trigger::GateOrderingAttestation>(inputDataTag.instance());
     if (fProduceWaveformAssns) {
       produces<art::Assns<OpticalTriggerGateData_t, raw::OpDetWaveform>>
         (inputDataTag.instance());
@@ -563,6 +565,14 @@ void icarus::trigger::SlidingWindowTrigger::produceThreshold(
       );
   } // if fProduceWaveformAssns
   
+  // attest the ordering of the output gates (one linear scan), so that
+  // downstream consumers can skip their defensive per-event validation
+  event.put(
+    std::make_unique<icarus::trigger::GateOrderingAttestation>
+      (icarus::trigger::attestGateOrdering(outputGates)),
+    dataTag.instance()
+    );
+
   event.put(
     std::make_unique<std::vector<OpticalTriggerGateData_t>>
       (std::move(outputGates)),
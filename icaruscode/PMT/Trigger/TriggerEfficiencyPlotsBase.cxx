@@ -13,6 +13,7 @@
 // ICARUS libraries
 #include "icaruscode/PMT/Trigger/Algorithms/BeamGateMaker.h"
 #include "icaruscode/PMT/Trigger/Utilities/TriggerDataUtils.h" // FillTriggerGates()
+#include "icaruscode/IcarusObj/GateOrderingAttestation.h"
 #include "icaruscode/PMT/Trigger/Utilities/PlotSandbox.h"
 #include "icaruscode/Utilities/DetectorClocksHelpers.h" // makeDetTimings()
 #include "icarusalg/Utilities/ROOTutils.h" // util::ROOT
@@ -555,6 +556,7 @@ icarus::trigger::TriggerEfficiencyPlotsBase::TriggerEfficiencyPlotsBase
     consumer.consumes<std::vector<OpticalTriggerGateData_t>>(inputDataTag);
     consumer.consumes<art::Assns<OpticalTriggerGateData_t, raw::OpDetWaveform>>
       (inputDataTag);
+    consumer.mayConsume<icarus::trigger::GateOrderingAttestation>(inputDataTag);
   } // for
 
   {
@@ -585,10 +587,10 @@ void icarus::trigger::TriggerEfficiencyPlotsBase::process
 
   /*
    * 1. find out the features of the event and the categories it belongs to
-   * 2. for each threshold:
-   *   1. read the trigger primitives
-   *   2. pick the plots to be filled
-   *   3. combine the trigger primitives, apply the beam gate,
+   * 2. for each threshold: read the trigger primitives
+   * 3. for each threshold (serialized across concurrent events):
+   *   1. pick the plots to be filled
+   *   2. combine the trigger primitives, apply the beam gate,
    *      generate the trigger response, add the response to all the plots
    *      (delegated)
    *
@@ -614,11 +616,7 @@ void icarus::trigger::TriggerEfficiencyPlotsBase::process
   
   bool const bPlot = shouldPlotEvent(eventInfo);
   if (bPlot) ++nPlottedEvents;
-  
-  if (fIDTree) fIDTree->assignID(event.id());
-  if (fPlotTree) fPlotTree->assign(bPlot);
-  if (fEventTree) fEventTree->assignEvent(eventInfo);
-  
+
   std::vector<std::string> selectedPlotCategories
     = selectPlotCategories(eventInfo, fPlotCategories);
   {
@@ -637,35 +635,60 @@ void icarus::trigger::TriggerEfficiencyPlotsBase::process
   }
 
   //
-  // 2. for each PMT threshold:
+  // 2. for each PMT threshold: read the trigger primitives
   //
   auto const clockData
    = art::ServiceHandle<detinfo::DetectorClocksService const>()->DataFor(event);
+
+  std::vector<TriggerGatesPerCryostat_t> cryoGatesPerThreshold;
+  cryoGatesPerThreshold.reserve(fADCthresholds.size());
+  std::vector<bool> gateInputAttested;
+  gateInputAttested.reserve(fADCthresholds.size());
+  for (art::InputTag const& dataTag: util::const_values(fADCthresholds)) {
+    TriggerGates_t gates = readTriggerGates(event, dataTag);
+    // a valid ordering attestation from the gate producer entitles the
+    // derived classes to skip their defensive per-event input validation
+    auto const attestation
+      = event.getHandle<icarus::trigger::GateOrderingAttestation>(dataTag);
+    gateInputAttested.push_back
+      (attestation.isValid() && attestation->covers(gates.size()));
+    cryoGatesPerThreshold.push_back(splitByCryostat(std::move(gates)));
+  }
+
+  //
+  // 3. simulate the trigger response and fill the plots; plots, trees and
+  //    counters are shared across events, so from here on the processing of
+  //    concurrent events is serialized
+  //
+  auto const lock = lockFill();
+
+  // published under the fill lock, as `simulateAndPlot()` reads it there
+  fGateInputAttested = std::move(gateInputAttested);
+
+  if (fIDTree) fIDTree->assignID(event.id());
+  if (fPlotTree) fPlotTree->assign(bPlot);
+  if (fEventTree) fEventTree->assignEvent(eventInfo);
+
   for (auto&& [ iThr, thrPair, thrPlots ]
     : util::enumerate(fADCthresholds, fThresholdPlots)
   ) {
 
     auto const& [ thresholdTag, dataTag ] = thrPair;
 
+    TriggerGatesPerCryostat_t const& cryoGates = cryoGatesPerThreshold[iThr];
+
     //
-    // 2.1. read the trigger primitives
-    //
-    
-    TriggerGatesPerCryostat_t const& cryoGates
-      = splitByCryostat(readTriggerGates(event, dataTag));
-    
-    //
-    // 2.2. pick the plots to be filled
+    // 3.1. pick the plots to be filled
     //
     PlotSandboxRefs_t selectedPlots;
-    
+
     if (bPlot) {
       for (std::string const& name: selectedPlotCategories)
         selectedPlots.emplace_back(*(thrPlots.findSandbox(name)));
     }
-    
+
     //
-    // 2.3. combine the trigger primitives, apply the beam gate,
+    // 3.2. combine the trigger primitives, apply the beam gate,
     //      generate the trigger response, add the response to all the plots
     //
     simulateAndPlot(
@@ -836,7 +859,7 @@ icarus::trigger::TriggerEfficiencyPlotsBase::initializeEfficiencyPerTriggerPlots
   // Triggering efficiency vs. something else
   //
   if (useEDep()) {
-    plots.make<TEfficiency>(
+    plots.makeDeferred<TEfficiency>(
       "EffVsEnergyInSpill",
       "Efficiency of triggering vs. energy deposited in spill"
         ";energy deposited in spill  [ GeV ]"
@@ -844,7 +867,7 @@ icarus::trigger::TriggerEfficiencyPlotsBase::initializeEfficiencyPerTriggerPlots
       120, 0.0, 6.0 // 6 GeV should be enough for a MIP crossing 20 m of detector
       );
     
-    plots.make<TEfficiency>(
+    plots.makeDeferred<TEfficiency>(
       "EffVsEnergyInSpillActive",
       "Efficiency of triggering vs. energy deposited in active volume"
         ";energy deposited in active volume in spill  [ GeV ]"
@@ -852,7 +875,7 @@ icarus::trigger::TriggerEfficiencyPlotsBase::initializeEfficiencyPerTriggerPlots
       120, 0.0, 6.0 // 6 GeV should be enough for a MIP crossing 20 m of detector
       );
     
-    plots.make<TEfficiency>(
+    plots.makeDeferred<TEfficiency>(
       "EffVsEnergyInPreSpill",
       (
         "Efficiency of triggering vs. energy deposited in pre-spill ("
@@ -863,7 +886,7 @@ icarus::trigger::TriggerEfficiencyPlotsBase::initializeEfficiencyPerTriggerPlots
       120, 0.0, 12.0
       );
     
-    plots.make<TEfficiency>(
+    plots.makeDeferred<TEfficiency>(
       "EffVsEnergyInPreSpillActive",
       (
         "Efficiency of triggering vs. energy deposited in active volume"
@@ -876,7 +899,7 @@ icarus::trigger::TriggerEfficiencyPlotsBase::initializeEfficiencyPerTriggerPlots
   } // if plots with deposited energy
   
   if (useGen()) {
-    plots.make<TEfficiency>(
+    plots.makeDeferred<TEfficiency>(
       "EffVsNeutrinoEnergy",
       "Efficiency of triggering vs. neutrino energy"
         ";neutrino true energy  [ GeV ]"
@@ -884,7 +907,7 @@ icarus::trigger::TriggerEfficiencyPlotsBase::initializeEfficiencyPerTriggerPlots
       120, 0.0, 6.0 // 6 GeV is not that much for NuMI, but we should be ok
       );
     
-    plots.make<TEfficiency>(
+    plots.makeDeferred<TEfficiency>(
       "EffVsLeptonEnergy",
       "Efficiency of triggering vs. outgoing lepton energy"
         ";final state lepton true energy  [ GeV ]"
@@ -894,7 +917,7 @@ icarus::trigger::TriggerEfficiencyPlotsBase::initializeEfficiencyPerTriggerPlots
   } // if plots with generated info
   
   auto const& beamGateOpt = beamGate.asOptTickRange();
-  plots.make<TH1F>(
+  plots.makeDeferred<TH1F>(
     "TriggerTick",
     "Trigger time tick"
       ";optical time tick [ /" + util::to_string(triggerResolutionTicks) + " ]",
@@ -911,7 +934,7 @@ icarus::trigger::TriggerEfficiencyPlotsBase::initializeEfficiencyPerTriggerPlots
     preSpillWindow.asElectronicsTimeRange().end()
     );
   
-  plots.make<TH1F>(
+  plots.makeDeferred<TH1F>(
     "OpeningTimes",
     "Times at which trigger logic was satisfied"
       ";trigger time (relative to nominal beam gate time)  [ us ]"
@@ -919,7 +942,7 @@ icarus::trigger::TriggerEfficiencyPlotsBase::initializeEfficiencyPerTriggerPlots
     10000, startTime.value(), endTime.value()
     );
   
-  plots.make<TH1F>(
+  plots.makeDeferred<TH1F>(
     "TriggerTime",
     "Time of the trigger"
       ";trigger time (relative to nominal beam gate time)  [ us ]"
@@ -948,7 +971,7 @@ void icarus::trigger::TriggerEfficiencyPlotsBase::initializeEventPlots
   // Selection-related plots
   //
   if (useGen()) {
-    plots.make<TH1F>(
+    plots.makeDeferred<TH1F>(
       "NeutrinoEnergy",
       "True Neutrino Energy"
         ";neutrino energy [GeV]"
@@ -958,14 +981,14 @@ void icarus::trigger::TriggerEfficiencyPlotsBase::initializeEventPlots
   }
   
   if (useEDep()) {
-    plots.make<TH1F>(
+    plots.makeDeferred<TH1F>(
       "EnergyInSpill",
       "Energy deposited during the beam gate opening"
         ";energy deposited in spill [ GeV ]"
         ";events  [ / 50 MeV ]",
       120, 0.0, 6.0 // 6 GeV should be enough for a MIP crossing 20 m of detector
       );
-    plots.make<TH1F>(
+    plots.makeDeferred<TH1F>(
       "EnergyInPreSpill",
       (
         "Energy deposited during the pre-spill window ("
@@ -975,14 +998,14 @@ void icarus::trigger::TriggerEfficiencyPlotsBase::initializeEventPlots
       ).c_str(),
       120, 0.0, 12.0
       );
-    plots.make<TH1F>(
+    plots.makeDeferred<TH1F>(
       "EnergyInSpillActive",
       "Energy deposited during the beam gate opening in active volume"
         ";energy deposited in active volume in spill [ GeV ]"
         ";events  [ / 50 MeV ]",
       120, 0.0, 6.0 // 6 GeV should be enough for a MIP crossing 20 m of detector
       );
-    plots.make<TH1F>(
+    plots.makeDeferred<TH1F>(
       "EnergyInPreSpillActive",
       (
         "Energy deposited in active volume during the pre-spill window ("
@@ -992,7 +1015,7 @@ void icarus::trigger::TriggerEfficiencyPlotsBase::initializeEventPlots
       ).c_str(),
       120, 0.0, 12.0
       );
-    plots.make<TH2F>(
+    plots.makeDeferred<TH2F>(
       "EnergyInPreSpillVsSpillActive",
       (
         "Energy deposited in active volume" 
@@ -1005,21 +1028,21 @@ void icarus::trigger::TriggerEfficiencyPlotsBase::initializeEventPlots
   } // if use energy deposition
   
   if (useGen()) {
-    plots.make<TH1I>(
+    plots.makeDeferred<TH1I>(
       "InteractionType",
       "Interaction type"
         ";Interaction Type"
         ";events",
       200, 999.5, 1199.5
       );
-    plots.make<TH1F>(
+    plots.makeDeferred<TH1F>(
       "LeptonEnergy",
       "Energy of outgoing lepton"
         ";deposited energy  [ GeV ]"
         ";events  [ / 50 MeV ]",
       120, 0.0, 6.0
       );
-    plots.make<TH2F>(
+    plots.makeDeferred<TH2F>(
       "InteractionVertexYZ",
       "Vertex of triggered interaction"
         ";beam direction (z)  [ / 20 cm ]"
@@ -1028,7 +1051,7 @@ void icarus::trigger::TriggerEfficiencyPlotsBase::initializeEventPlots
       100,  -250.,  +250.
       );
 
-    plots.make<TH2F>(
+    plots.makeDeferred<TH2F>(
       "InteractionTypeNeutrinoEnergy",
       "Interaction Type vs Neutrino Energy"
       ";InteractionType"
@@ -1052,7 +1075,7 @@ void icarus::trigger::TriggerEfficiencyPlotsBase::initializePMTplots
   //
   // plots independent of the trigger primitive requirements
   //
-  plots.make<TH1I>(
+  plots.makeDeferred<TH1I>(
     "ActivePMT",
     "PMT channels contributing to the trigger"
     ";channel with opened trigger gate"
@@ -1220,12 +1243,25 @@ void icarus::trigger::TriggerEfficiencyPlotsBase::fillAllEfficiencyPlots(
 //------------------------------------------------------------------------------
 void icarus::trigger::TriggerEfficiencyPlotsBase::deleteEmptyPlots()
 {
-  
+
+  // flush the buffered fills first, lest a filled plot appear empty
+  for (auto& thrPlots: fThresholdPlots) thrPlots.mergeBufferedFills();
+
   for (auto& thrPlots: fThresholdPlots) deleteEmptyPlots(thrPlots);
-  
+
 } // icarus::trigger::TriggerEfficiencyPlotsBase::deleteEmptyPlots()
 
 
+//------------------------------------------------------------------------------
+void icarus::trigger::TriggerEfficiencyPlotsBase::materializePlots()
+{
+
+  for (auto& thrPlots: fThresholdPlots) thrPlots.mergeBufferedFills();
+  for (auto& thrPlots: fThresholdPlots) thrPlots.materialize();
+
+} // icarus::trigger::TriggerEfficiencyPlotsBase::materializePlots()
+
+
 //------------------------------------------------------------------------------
 auto icarus::trigger::TriggerEfficiencyPlotsBase::createCountersForPattern
   (std::string const& patternName) -> std::size_t
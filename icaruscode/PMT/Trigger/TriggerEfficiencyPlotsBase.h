@@ -68,6 +68,7 @@
 #include <optional>
 #include <functional> // std::function<>, std::reference_wrapper<>
 #include <memory> // std::unique_ptr
+#include <mutex>
 #include <utility> // std::forward(), std::pair<>, std::move()
 #include <limits> // std::numeric_limits
 #include <cstddef> // std::size_t
@@ -941,10 +942,26 @@ struct icarus::trigger::details::PlotInfoTree: public TreeHolder {
  *       adding a _-N_ uniform level, flooring on level 0 and (if needed) maxing
  *       on level 1.
  *
- * 
+ *
+ * Multi-threading
+ * ================
+ *
+ * @anchor TriggerEfficiencyPlotsBase_MultiThreading
+ *
+ * The helper is designed so that `process()` can be called concurrently for
+ * different events (e.g. from a _art_ shared analyzer module processing events
+ * asynchronously). The extraction of the event information and the reading of
+ * the trigger primitives happen concurrently; the simulation of the trigger
+ * response and the filling of plots, trees and counters, which all write into
+ * objects shared across events, are serialized through an internal lock.
+ * Code in the derived classes that touches shared state outside of
+ * `simulateAndPlot()` (which is always called with the lock held) must
+ * acquire the same lock via `lockFill()`.
+ *
+ *
  * Code style: quantities with units
  * ==================================
- * 
+ *
  * To avoid issues with missing or wrong conversions, this code often uses
  * LArSoft quantities library. A variable with a `Quantity` type is represented
  * with a specific unit (e.g. microseconds) and can undergo only limited
@@ -1142,7 +1159,14 @@ class icarus::trigger::TriggerEfficiencyPlotsBase {
   
   /// Returns the resolution of trigger timing clock [ns]
   nanoseconds triggerTimeResolution() const { return fTriggerTimeResolution; }
-  
+
+  /// Returns whether the gate input for threshold index `iThr` carried a
+  /// valid ordering attestation in the event being plotted: if so, derived
+  /// classes may skip their defensive per-event validation of that input
+  /// (only meaningful from within `simulateAndPlot()`).
+  bool gateInputAttested(std::size_t iThr) const
+    { return (iThr < fGateInputAttested.size()) && fGateInputAttested[iThr]; }
+
   // --- END Helper interface --------------------------------------------------
   
   
@@ -1206,7 +1230,15 @@ class icarus::trigger::TriggerEfficiencyPlotsBase {
     TH2& Hist2D(std::string const& name) const { return plots.demand<TH2>(name); }
     TEfficiency& Eff(std::string const& name) const
       { return plots.demand<TEfficiency>(name); }
-    
+
+    /// Fills `name` via the thread-local buffers of the sandbox
+    /// (see `PlotSandbox::fillBuffered()`); no fill lock needed.
+    void FillHist(std::string const& name, double x, double weight = 1.0) const
+      { plots.fillBuffered(name, x, weight); }
+    void FillHist2D
+      (std::string const& name, double x, double y, double weight = 1.0) const
+      { plots.fillBuffered2D(name, x, y, weight); }
+
   }; // class HistGetter
   
   //----------------------------------------------------------------------------
@@ -1377,7 +1409,12 @@ class icarus::trigger::TriggerEfficiencyPlotsBase {
   
   /// Deletes plots with no entries, and directories which became empty.
   void deleteEmptyPlots();
-  
+
+  /// Creates all the plots whose creation was deferred and which were never
+  /// filled (see `PlotSandbox::makeDeferred()`), so that they appear in the
+  /// output as empty; to be called at the end of the job.
+  void materializePlots();
+
   /**
    * @brief Creates counters for all the thresholds of the specified trigger.
    * @param patternName an identified for the pattern
@@ -1440,8 +1477,21 @@ class icarus::trigger::TriggerEfficiencyPlotsBase {
    */
   static std::vector<ChannelID_t> extractActiveChannels
     (TriggerGatesPerCryostat_t const& cryoGates);
-  
-  
+
+
+  /**
+   * @brief Acquires the lock serializing the filling of shared objects.
+   * @return the lock, released on destruction
+   *
+   * Plots, output trees and pass counters are shared across events: when
+   * events are processed concurrently, any access to them outside of
+   * `simulateAndPlot()` (which is always called with this lock already held)
+   * must happen while holding this lock.
+   */
+  [[nodiscard]] std::unique_lock<std::mutex> lockFill() const
+    { return std::unique_lock{ fFillMutex }; }
+
+
   // --- END Additional helper utilities ---------------------------------------
   
   
@@ -1518,6 +1568,13 @@ class icarus::trigger::TriggerEfficiencyPlotsBase {
 
   details::TriggerPassCounters fPassCounters; ///< Counters for all triggers.
 
+  /// Per threshold: whether the gate input of the event being plotted came
+  /// with a valid ordering attestation (updated under the fill lock).
+  std::vector<bool> fGateInputAttested;
+
+  /// Serializes the filling of plots, trees and counters (see `lockFill()`).
+  mutable std::mutex fFillMutex;
+
   // --- END Internal variables ------------------------------------------------
 
 
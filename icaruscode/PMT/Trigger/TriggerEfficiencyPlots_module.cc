@@ -1695,11 +1695,18 @@ void icarus::trigger::TriggerEfficiencyPlots::analyze(art::Event const& event) {
 
 //------------------------------------------------------------------------------
 void icarus::trigger::TriggerEfficiencyPlots::endJob() {
-  
+
+  // flush any buffered fills into the plots
+  for (auto& thrPlots: fThresholdPlots) thrPlots.mergeBufferedFills();
+
+  // create the plots which were never filled, so that they appear (empty)
+  // in the output file anyway
+  for (auto const& thrPlots: fThresholdPlots) thrPlots.materialize();
+
   mf::LogInfo(fLogCategory)
     << nPlottedEvents << "/" << nEvents << " events plotted."
     ;
-  
+
 } // icarus::trigger::TriggerEfficiencyPlots::endJob()
 
 
@@ -1805,7 +1812,7 @@ void icarus::trigger::TriggerEfficiencyPlots::initializePlotSet
   //
   // plots independent of the trigger primitive requirements
   //
-  plots.make<TH1F>(
+  plots.makeDeferred<TH1F>(
     "NPrimitives",
     "Number of trigger primitives (\"channels firing at once\")"
     ";maximum trigger primitives at the same time"
@@ -1850,28 +1857,28 @@ void icarus::trigger::TriggerEfficiencyPlots::initializePlotSet
   //
   // No trigger related plots
   //
-  plots.make<TH1F>(
+  plots.makeDeferred<TH1F>(
     "NeutrinoEnergy_NoTrig",
     "True Neutrino Energy of Non-Triggered Event"
       ";neutrino energy [GeV]"
       ";events",
     120,0.0,6.0 // GeV
   );
-  plots.make<TH1F>(
+  plots.makeDeferred<TH1F>(
     "EnergyInSpill_NoTrig",
     "Energy eposited during the beam gate opening of Non-Triggered Event"
       ";deposited energy  [ GeV ]"
       ";events  [ / 50 MeV ]",
     120, 0.0, 6.0 // 6 GeV should be enough for a MIP crossing 20 m of detector
     );
-  plots.make<TH1I>(
+  plots.makeDeferred<TH1I>(
     "InteractionType_NoTrig",
     "Interaction type of Non-Triggered Event"
       ";Interaction Type"
       ";events  [ / 50 MeV ]",
     200, 999.5, 1199.5 
     );
-  plots.make<TH1F>(
+  plots.makeDeferred<TH1F>(
     "LeptonEnergy_NoTrig",
     "Energy of outgoing lepton of Non-Triggered Event"
       ";lepton generated energy  [ GeV ]"
@@ -1895,7 +1902,7 @@ void icarus::trigger::TriggerEfficiencyPlots::initializeEfficiencyPerTriggerPlot
   //
   // Triggering efficiency vs. something else
   //
-  plots.make<TEfficiency>(
+  plots.makeDeferred<TEfficiency>(
     "EffVsEnergyInSpill",
     "Efficiency of triggering vs. energy deposited in spill"
       ";energy deposited in spill  [ GeV ]"
@@ -1903,7 +1910,7 @@ void icarus::trigger::TriggerEfficiencyPlots::initializeEfficiencyPerTriggerPlot
     120, 0.0, 6.0 // 6 GeV should be enough for a MIP crossing 20 m of detector
     );
   
-  plots.make<TEfficiency>(
+  plots.makeDeferred<TEfficiency>(
     "EffVsEnergyInSpillActive",
     "Efficiency of triggering vs. energy deposited in active volume"
       ";energy deposited in active volume in spill  [ GeV ]"
@@ -1911,7 +1918,7 @@ void icarus::trigger::TriggerEfficiencyPlots::initializeEfficiencyPerTriggerPlot
     120, 0.0, 6.0 // 6 GeV should be enough for a MIP crossing 20 m of detector
     );
   
-  plots.make<TEfficiency>(
+  plots.makeDeferred<TEfficiency>(
     "EffVsNeutrinoEnergy",
     "Efficiency of triggering vs. neutrino energy"
       ";neutrino true energy  [ GeV ]"
@@ -1919,7 +1926,7 @@ void icarus::trigger::TriggerEfficiencyPlots::initializeEfficiencyPerTriggerPlot
     120, 0.0, 6.0 // 6 GeV is not that much for NuMI, but we should be ok
     );
   
-  plots.make<TEfficiency>(
+  plots.makeDeferred<TEfficiency>(
     "EffVsLeptonEnergy",
     "Efficiency of triggering vs. outgoing lepton energy"
       ";final state lepton true energy  [ GeV ]"
@@ -1927,7 +1934,7 @@ void icarus::trigger::TriggerEfficiencyPlots::initializeEfficiencyPerTriggerPlot
     120, 0.0, 6.0
     );
   
-  plots.make<TH1F>(
+  plots.makeDeferred<TH1F>(
     "TriggerTick",
     "Trigger time tick"
       ";optical time tick [ /" + util::to_string(triggerResolutionTicks) + " ]",
@@ -1966,42 +1973,42 @@ void icarus::trigger::TriggerEfficiencyPlots::initializeEventPlots
   //
   // Selection-related plots
   //
-  plots.make<TH1F>(
+  plots.makeDeferred<TH1F>(
     "NeutrinoEnergy",
     "True Neutrino Energy"
       ";neutrino energy [GeV]"
       ";events",
     120, 0.0, 6.0 // GeV
   );
-  plots.make<TH1F>(
+  plots.makeDeferred<TH1F>(
     "EnergyInSpill",
     "Energy deposited during the beam gate opening"
       ";energy deposited in spill [ GeV ]"
       ";events  [ / 50 MeV ]",
     120, 0.0, 6.0 // 6 GeV should be enough for a MIP crossing 20 m of detector
     );
-  plots.make<TH1F>(
+  plots.makeDeferred<TH1F>(
     "EnergyInSpillActive",
     "Energy deposited during the beam gate opening in active volume"
       ";energy deposited in active volume in spill [ GeV ]"
       ";events  [ / 50 MeV ]",
     120, 0.0, 6.0 // 6 GeV should be enough for a MIP crossing 20 m of detector
     );
-  plots.make<TH1I>(
+  plots.makeDeferred<TH1I>(
     "InteractionType",
     "Interaction type"
       ";Interaction Type"
       ";events",
     200, 999.5, 1199.5
     );
-  plots.make<TH1F>(
+  plots.makeDeferred<TH1F>(
     "LeptonEnergy",
     "Energy of outgoing lepton"
       ";deposited energy  [ GeV ]"
       ";events  [ / 50 MeV ]",
     120, 0.0, 6.0
     );
-  plots.make<TH2F>(
+  plots.makeDeferred<TH2F>(
     "InteractionVertexYZ",
     "Vertex of triggered interaction"
       ";Z [ / 20 cm ]"
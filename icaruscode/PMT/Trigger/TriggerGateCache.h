@@ -0,0 +1,171 @@
+/**
+ * @file   icaruscode/PMT/Trigger/TriggerGateCache.h
+ * @brief  Service sharing unpacked trigger gates across trigger modules.
+ * @author Gianluca Petrillo (petrillo@slac.stanford.edu)
+ * @date   August 31, 2026
+ * @see    icaruscode/PMT/Trigger/TriggerGateCache_service.cc
+ */
+
+#ifndef ICARUSCODE_PMT_TRIGGER_TRIGGERGATECACHE_H
+#define ICARUSCODE_PMT_TRIGGER_TRIGGERGATECACHE_H
+
+
+// ICARUS libraries
+#include "icaruscode/PMT/Trigger/Utilities/TrackedOpticalTriggerGate.h"
+#include "icaruscode/IcarusObj/PackedTriggerGate.h"
+#include "icaruscode/IcarusObj/OpDetWaveformMeta.h" // sbn::OpDetWaveformMeta
+
+// framework libraries
+#include "art/Framework/Services/Registry/ServiceDeclarationMacros.h"
+#include "canvas/Persistency/Provenance/EventID.h"
+#include "canvas/Utilities/InputTag.h"
+
+// C/C++ standard libraries
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility> // std::pair
+#include <vector>
+
+
+// -----------------------------------------------------------------------------
+// forward declarations
+namespace art { class ActivityRegistry; class Event; }
+namespace fhicl { class ParameterSet; }
+
+// -----------------------------------------------------------------------------
+namespace icarus::trigger { class TriggerGateCache; }
+/**
+ * @brief Per-event cache of unpacked trigger gates, shared across modules.
+ *
+ * A trigger emulation chain typically has several modules reading the same
+ * discriminated gate data products (e.g. `MajorityTriggerSimulation` and
+ * `SlidingWindowTriggerSimulation` on the same thresholds): each of them
+ * independently fetches the serialized gates and their waveform associations
+ * from the event and unpacks them with `icarus::trigger::FillTriggerGates()`.
+ * This service performs that unpacking once per data product per event: the
+ * first module asking for a given input tag reads and unpacks the gates, and
+ * every following request for the same tag within the same event is served
+ * from the cache without touching the event store again.
+ *
+ * The cached gates hold pointers to the `sbn::OpDetWaveformMeta` objects owned
+ * by the event, so the returned reference (and the gates within) is valid only
+ * until the end of the current event; the cache is flushed as soon as a
+ * request for a different event comes in.
+ *
+ * The service is shared and the cache is protected by a lock, held for the
+ * duration of the read when a tag is requested for the first time.
+ *
+ *
+ * Snapshot and resume for threshold scan campaigns
+ * -------------------------------------------------
+ *
+ * A threshold scan re-runs the trigger simulation modules many times with
+ * different patterns, while the discriminated gates they consume are the same
+ * every time. The service can snapshot the gate state so that the
+ * discrimination chain needs to run only once:
+ *
+ * * with `SnapshotFile` set and `ResumeFromSnapshot` `false` (snapshot pass),
+ *   gates are read from the event as usual and, in addition, appended to the
+ *   snapshot file in the compact `icarus::trigger::PackedTriggerGate`
+ *   encoding, once per data product per event;
+ * * with `SnapshotFile` set and `ResumeFromSnapshot` `true` (resume pass),
+ *   gates are unpacked from the snapshot file instead, and the gate data
+ *   products are never fetched from the event: the input file does not need
+ *   to contain them, and modules like `SlidingWindowTriggerSimulation` and
+ *   `MajorityTriggerSimulation` can evaluate new patterns against a slim
+ *   input file holding little more than the event structure.
+ *
+ * Gates served from a snapshot carry no tracking information (there are no
+ * waveform metadata objects to point to), which the pattern evaluation does
+ * not use. The snapshot file is a plain binary stream in native byte order,
+ * intended as scratch space for a scan campaign rather than as an archival
+ * format.
+ *
+ * Additional configuration parameters:
+ *
+ * * `SnapshotFile` (string, default: empty): path of the snapshot file;
+ *   if empty, no snapshot is written nor read
+ * * `ResumeFromSnapshot` (boolean, default: `false`): if set, serve the gates
+ *   from `SnapshotFile` instead of from the event
+ */
+class icarus::trigger::TriggerGateCache {
+
+    public:
+
+  /// Type of unpacked trigger gates, as returned by
+  /// `icarus::trigger::ReadTriggerGates()`.
+  using CachedGates_t
+    = std::vector<icarus::trigger::TrackedOpticalTriggerGate<sbn::OpDetWaveformMeta>>;
+
+
+  TriggerGateCache(fhicl::ParameterSet const& pset, art::ActivityRegistry& reg);
+
+  /**
+   * @brief Returns the trigger gates with tag `dataTag` from `event`.
+   * @param event the event to read the gates from
+   * @param dataTag tag of the gate data product (and its associations)
+   * @return the unpacked gates, valid until the end of the current event
+   * @throw cet::exception if the reading of the gates fails
+   *
+   * If the gates with `dataTag` have already been read during the current
+   * event, the cached ones are returned; otherwise they are read from `event`
+   * (`icarus::trigger::ReadTriggerGates()`) and cached.
+   * The caller is expected to have declared the consumed data products
+   * (e.g. via `icarus::trigger::TriggerGateReader`).
+   */
+  CachedGates_t const& retrieveTriggerGates
+    (art::Event const& event, art::InputTag const& dataTag);
+
+
+    private:
+
+  /// Type of the packed gates of one data product in the snapshot.
+  using PackedGates_t = std::vector<icarus::trigger::PackedTriggerGate>;
+
+  /// Key of a snapshot record: event and encoded input tag.
+  using SnapshotKey_t = std::pair<art::EventID, std::string>;
+
+
+  std::string fLogCategory; ///< Message facility category for output.
+
+  std::string fSnapshotFile; ///< Path of the snapshot file (empty: none).
+
+  bool fResumeFromSnapshot; ///< Serve gates from the snapshot file.
+
+  std::mutex fCacheMutex; ///< Protects `fCachedEvent` and `fCache`.
+
+  art::EventID fCachedEvent; ///< The event the cached gates belong to.
+
+  /// All gates unpacked so far in the current event, by input tag
+  /// (`std::map` nodes are never relocated, so the references handed out stay
+  /// valid until the cache is flushed on the next event).
+  std::map<std::string, CachedGates_t> fCache;
+
+  /// Output stream of the snapshot file (open only in the snapshot pass).
+  std::ofstream fSnapshotOut;
+
+  /// The whole snapshot file content (filled only in the resume pass).
+  std::map<SnapshotKey_t, PackedGates_t> fSnapshot;
+
+
+  /// Reads the whole snapshot file into `fSnapshot`.
+  void loadSnapshot();
+
+  /// Appends the packed version of `gates` to the snapshot file.
+  void appendSnapshotRecord
+    (art::EventID const& event, std::string const& key, CachedGates_t const& gates);
+
+  /// Returns the gates of the snapshot record, unpacked (no tracking).
+  /// @throw cet::exception if the snapshot has no record for the request
+  CachedGates_t unpackSnapshotGates
+    (art::EventID const& event, std::string const& key) const;
+
+}; // class icarus::trigger::TriggerGateCache
+
+
+DECLARE_ART_SERVICE(icarus::trigger::TriggerGateCache, SHARED)
+
+
+#endif // ICARUSCODE_PMT_TRIGGER_TRIGGERGATECACHE_H
@@ -0,0 +1,242 @@
+/**
+ * @file   icaruscode/PMT/Trigger/TriggerGateCache_service.cc
+ * @brief  Service sharing unpacked trigger gates (implementation file).
+ * @author Gianluca Petrillo (petrillo@slac.stanford.edu)
+ * @date   August 31, 2026
+ * @see    icaruscode/PMT/Trigger/TriggerGateCache.h
+ */
+
+// library header
+#include "icaruscode/PMT/Trigger/TriggerGateCache.h"
+
+// ICARUS libraries
+#include "icaruscode/PMT/Trigger/Utilities/TriggerDataUtils.h"
+  // icarus::trigger::ReadTriggerGates()
+
+// framework libraries
+#include "art/Framework/Services/Registry/ServiceDefinitionMacros.h"
+#include "art/Framework/Principal/Event.h"
+#include "messagefacility/MessageLogger/MessageLogger.h"
+#include "fhiclcpp/ParameterSet.h"
+#include "cetlib_except/exception.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::equal()
+#include <istream>
+#include <ostream>
+#include <utility> // std::move()
+#include <cstdint>
+
+
+//------------------------------------------------------------------------------
+namespace {
+
+  /// Eight-byte magic number opening a gate snapshot file.
+  constexpr char SnapshotMagic[8U]
+    = { 'I', 'C', 'R', 'G', 'A', 'T', 'E', '1' };
+
+  template <typename T>
+  void writeRaw(std::ostream& out, T const& value)
+    { out.write(reinterpret_cast<char const*>(&value), sizeof(value)); }
+
+  template <typename T>
+  void readRaw(std::istream& in, T& value)
+    { in.read(reinterpret_cast<char*>(&value), sizeof(value)); }
+
+} // local namespace
+
+
+//------------------------------------------------------------------------------
+icarus::trigger::TriggerGateCache::TriggerGateCache
+  (fhicl::ParameterSet const& pset, art::ActivityRegistry&)
+  : fLogCategory(pset.get<std::string>("LogCategory", "TriggerGateCache"))
+  , fSnapshotFile(pset.get<std::string>("SnapshotFile", ""))
+  , fResumeFromSnapshot(pset.get<bool>("ResumeFromSnapshot", false))
+{
+
+  if (fSnapshotFile.empty()) {
+    if (fResumeFromSnapshot) {
+      throw cet::exception("TriggerGateCache")
+        << "ResumeFromSnapshot requires a SnapshotFile to resume from.\n";
+    }
+    return;
+  }
+
+  if (fResumeFromSnapshot) loadSnapshot();
+  else {
+    fSnapshotOut.open
+      (fSnapshotFile, std::ios::binary | std::ios::out | std::ios::trunc);
+    if (!fSnapshotOut) {
+      throw cet::exception("TriggerGateCache")
+        << "Can't create the gate snapshot file '" << fSnapshotFile << "'.\n";
+    }
+    fSnapshotOut.write(SnapshotMagic, sizeof(SnapshotMagic));
+    mf::LogInfo(fLogCategory)
+      << "Writing a gate snapshot into '" << fSnapshotFile << "'.";
+  }
+
+} // icarus::trigger::TriggerGateCache::TriggerGateCache()
+
+
+//------------------------------------------------------------------------------
+auto icarus::trigger::TriggerGateCache::retrieveTriggerGates
+  (art::Event const& event, art::InputTag const& dataTag)
+  -> CachedGates_t const&
+{
+  std::lock_guard lock { fCacheMutex };
+
+  if (event.id() != fCachedEvent) {
+    // gates in the cache point into products of the previous event: flush them
+    fCache.clear();
+    fCachedEvent = event.id();
+  }
+
+  std::string const key = dataTag.encode();
+  auto const it = fCache.find(key);
+  if (it != fCache.end()) {
+    mf::LogTrace(fLogCategory)
+      << "Serving " << it->second.size() << " gates '" << key
+      << "' of " << fCachedEvent << " from the cache.";
+    return it->second;
+  }
+
+  if (fResumeFromSnapshot) {
+    auto const [ newIt, inserted ]
+      = fCache.emplace(key, unpackSnapshotGates(fCachedEvent, key));
+    mf::LogTrace(fLogCategory)
+      << "Unpacked " << newIt->second.size() << " gates '" << key
+      << "' of " << fCachedEvent << " from the snapshot.";
+    return newIt->second;
+  }
+
+  auto const [ newIt, inserted ] = fCache.emplace
+    (key, icarus::trigger::ReadTriggerGates(event, dataTag));
+  mf::LogTrace(fLogCategory)
+    << "Read and cached " << newIt->second.size() << " gates '" << key
+    << "' of " << fCachedEvent << " (" << fCache.size() << " in cache).";
+
+  if (fSnapshotOut.is_open())
+    appendSnapshotRecord(fCachedEvent, key, newIt->second);
+
+  return newIt->second;
+} // icarus::trigger::TriggerGateCache::retrieveTriggerGates()
+
+
+//------------------------------------------------------------------------------
+void icarus::trigger::TriggerGateCache::loadSnapshot() {
+
+  std::ifstream in { fSnapshotFile, std::ios::binary | std::ios::in };
+  if (!in) {
+    throw cet::exception("TriggerGateCache")
+      << "Can't open the gate snapshot file '" << fSnapshotFile << "'.\n";
+  }
+
+  char magic[sizeof(SnapshotMagic)];
+  in.read(magic, sizeof(magic));
+  if (!in || !std::equal(std::begin(magic), std::end(magic), SnapshotMagic)) {
+    throw cet::exception("TriggerGateCache")
+      << "'" << fSnapshotFile << "' is not a gate snapshot file.\n";
+  }
+
+  while (true) {
+
+    std::uint32_t run, subRun, eventNo;
+    readRaw(in, run);
+    if (in.eof()) break; // a record boundary is the only valid end of file
+    readRaw(in, subRun);
+    readRaw(in, eventNo);
+
+    std::uint32_t keyLength;
+    readRaw(in, keyLength);
+    std::string key(keyLength, '\0');
+    in.read(key.data(), keyLength);
+
+    std::uint32_t nGates;
+    readRaw(in, nGates);
+
+    PackedGates_t gates;
+    gates.reserve(nGates);
+    for (std::uint32_t iGate = 0U; iGate < nGates; ++iGate) {
+      std::uint32_t nChannels, nTransitions;
+      std::uint64_t nBytes;
+      readRaw(in, nChannels);
+      readRaw(in, nTransitions);
+      readRaw(in, nBytes);
+      std::vector<std::uint8_t> data(nBytes);
+      in.read(reinterpret_cast<char*>(data.data()), nBytes);
+      gates.emplace_back(nChannels, nTransitions, std::move(data));
+    } // for gates
+
+    if (!in) {
+      throw cet::exception("TriggerGateCache")
+        << "The gate snapshot file '" << fSnapshotFile
+        << "' is truncated or corrupted.\n";
+    }
+
+    art::EventID const eventID { run, subRun, eventNo };
+    fSnapshot[{ eventID, key }] = std::move(gates);
+
+  } // while records
+
+  mf::LogInfo(fLogCategory)
+    << "Resuming from '" << fSnapshotFile << "': " << fSnapshot.size()
+    << " gate snapshot records loaded.";
+
+} // icarus::trigger::TriggerGateCache::loadSnapshot()
+
+
+//------------------------------------------------------------------------------
+void icarus::trigger::TriggerGateCache::appendSnapshotRecord(
+  art::EventID const& event, std::string const& key, CachedGates_t const& gates
+) {
+
+  writeRaw(fSnapshotOut, static_cast<std::uint32_t>(event.run()));
+  writeRaw(fSnapshotOut, static_cast<std::uint32_t>(event.subRun()));
+  writeRaw(fSnapshotOut, static_cast<std::uint32_t>(event.event()));
+
+  writeRaw(fSnapshotOut, static_cast<std::uint32_t>(key.size()));
+  fSnapshotOut.write(key.data(), key.size());
+
+  writeRaw(fSnapshotOut, static_cast<std::uint32_t>(gates.size()));
+  for (auto const& trackedGate: gates) {
+    icarus::trigger::PackedTriggerGate const packed { trackedGate.gate() };
+    writeRaw(fSnapshotOut, static_cast<std::uint32_t>(packed.nChannels()));
+    writeRaw(fSnapshotOut, static_cast<std::uint32_t>(packed.nTransitions()));
+    writeRaw(fSnapshotOut, static_cast<std::uint64_t>(packed.packedSize()));
+    auto const& data = packed.packedData();
+    fSnapshotOut.write
+      (reinterpret_cast<char const*>(data.data()), data.size());
+  } // for gates
+
+  // one record per data product per event: a crash loses at most the last one
+  fSnapshotOut.flush();
+
+} // icarus::trigger::TriggerGateCache::appendSnapshotRecord()
+
+
+//------------------------------------------------------------------------------
+auto icarus::trigger::TriggerGateCache::unpackSnapshotGates
+  (art::EventID const& event, std::string const& key) const -> CachedGates_t
+{
+
+  auto const it = fSnapshot.find({ event, key });
+  if (it == fSnapshot.end()) {
+    throw cet::exception("TriggerGateCache")
+      << "The gate snapshot file '" << fSnapshotFile
+      << "' has no record for gates '" << key << "' of " << event << ".\n";
+  }
+
+  CachedGates_t gates;
+  gates.reserve(it->second.size());
+  for (icarus::trigger::PackedTriggerGate const& packed: it->second)
+    gates.emplace_back(packed.unpack());
+
+  return gates;
+} // icarus::trigger::TriggerGateCache::unpackSnapshotGates()
+
+
+//------------------------------------------------------------------------------
+DEFINE_ART_SERVICE(icarus::trigger::TriggerGateCache)
+
+
+//------------------------------------------------------------------------------
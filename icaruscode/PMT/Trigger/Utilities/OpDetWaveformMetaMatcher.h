@@ -24,8 +24,9 @@
 #include "canvas/Persistency/Provenance/ProductID.h"
 
 // C/C++ standard libraries
-#include <algorithm> // std::lower_bound()
 #include <unordered_map>
+#include <vector>
+#include <cstddef> // std::size_t
 // #include <utility> // std::move()
 
 
@@ -57,7 +58,14 @@ namespace icarus::trigger {
  * gate/metadata association in `metaAssns`.
  * Note that, in this simple example, if no waveform pointer is matched to a
  * metadata item, a null pointer to waveform is stored in the association.
- * 
+ *
+ * Matching is constant time after the first query into each association
+ * collection: when the trivial one-to-one correspondence does not hold, a
+ * key index of that collection is built once and then shared by all the
+ * following queries within the event.
+ * Whole collections can be matched at once with
+ * `fetchAssociatedWaveforms()`.
+ *
  */
 template <typename Event>
 class icarus::trigger::OpDetWaveformMetaMatcher {
@@ -67,52 +75,40 @@ class icarus::trigger::OpDetWaveformMetaMatcher {
   /// Type of associations used in this algorithm,
   using WaveformMetaAssns_t
     = art::Assns<sbn::OpDetWaveformMeta, raw::OpDetWaveform>;
-  
-  /// Compares a sbn::OpDetWaveformMeta` and an element of `WaveformMetaAssns_t`
-  struct CmpFirst {
-    
-    using Assn_t = typename WaveformMetaAssns_t::assn_t; // a pair
-    using MetaPtr_t = typename Assn_t::first_type; // an art pointer
-    
-    template <typename A, typename B>
-    bool operator() (A const& a, B const& b) const { return cmp(a, b); }
-    
-    static bool cmp(Assn_t const& a, Assn_t const& b)
-      { return cmp(a.first, b.first); }
-    
-    static bool cmp(Assn_t const& a, MetaPtr_t const& b)
-      { return cmp(a.first, b); }
-    
-    static bool cmp(MetaPtr_t const& a, Assn_t const& b)
-      { return cmp(a, b.first); }
-    
-    static bool cmp(MetaPtr_t const& a, MetaPtr_t const& b)
-      { return a.key() < b.key(); }
-    
-  }; // struct CmpFirst
-  
-  
+
+  /// Type of one-shot index: metadata key to associated waveform.
+  using WaveformKeyIndex_t
+    = std::unordered_map<std::size_t, art::Ptr<raw::OpDetWaveform>>;
+
+
   Event_t const& fEvent; ///< Event to read associations from.
-  
+
   /// All associations discovered so far.
   std::unordered_map<art::ProductID, WaveformMetaAssns_t const*> fAssns;
-  
-  
+
+  /// Key indices built so far (only for collections which needed one).
+  std::unordered_map<art::ProductID, WaveformKeyIndex_t> fIndices;
+
+
   /// Loads the association including `pid`.
   /// @return pointer to the associations containing `pid`, `nullptr` if n/a.
   WaveformMetaAssns_t const* loadAssociations(art::ProductID const& pid);
-  
+
+  /// Returns the key index of the associations `pid`, building it on first use.
+  WaveformKeyIndex_t const& waveformKeyIndex
+    (art::ProductID const& pid, WaveformMetaAssns_t const& assns);
+
   /// Returns the waveform associated to `meta` if in `assns` or a null pointer.
   art::Ptr<raw::OpDetWaveform> findAssociatedWaveform(
     art::Ptr<sbn::OpDetWaveformMeta> const& meta,
     WaveformMetaAssns_t const& assns
-    ) const;
-  
+    );
+
     public:
-  
+
   /// Constructor: associates to the specified art event.
   OpDetWaveformMetaMatcher(Event const& event);
-  
+
   // @{
   /// Returns the waveform associated to `meta`, or a null pointer if not found.
   art::Ptr<raw::OpDetWaveform> fetchAssociatedWaveform
@@ -121,8 +117,13 @@ class icarus::trigger::OpDetWaveformMetaMatcher {
     (art::Ptr<sbn::OpDetWaveformMeta> const& meta)
     { return fetchAssociatedWaveform(meta); }
   // @}
-  
-  
+
+  /// Returns the waveforms associated to each of `metas`, in the same order;
+  /// entries with no associated waveform get a null pointer.
+  std::vector<art::Ptr<raw::OpDetWaveform>> fetchAssociatedWaveforms
+    (std::vector<art::Ptr<sbn::OpDetWaveformMeta>> const& metas);
+
+
 }; // class icarus::trigger::OpDetWaveformMetaMatcher
 
 
@@ -151,6 +152,22 @@ icarus::trigger::OpDetWaveformMetaMatcher<Event>::fetchAssociatedWaveform
 } // icarus::trigger::OpDetWaveformMetaMatcher<>::fetchAssociatedWaveform()
 
 
+//------------------------------------------------------------------------------
+template <typename Event>
+std::vector<art::Ptr<raw::OpDetWaveform>>
+icarus::trigger::OpDetWaveformMetaMatcher<Event>::fetchAssociatedWaveforms
+  (std::vector<art::Ptr<sbn::OpDetWaveformMeta>> const& metas)
+{
+
+  std::vector<art::Ptr<raw::OpDetWaveform>> waveforms;
+  waveforms.reserve(metas.size());
+  for (art::Ptr<sbn::OpDetWaveformMeta> const& meta: metas)
+    waveforms.push_back(fetchAssociatedWaveform(meta));
+  return waveforms;
+
+} // icarus::trigger::OpDetWaveformMetaMatcher<>::fetchAssociatedWaveforms()
+
+
 //------------------------------------------------------------------------------
 template <typename Event>
 auto icarus::trigger::OpDetWaveformMetaMatcher<Event>::loadAssociations
@@ -180,33 +197,50 @@ auto icarus::trigger::OpDetWaveformMetaMatcher<Event>::loadAssociations
 } // icarus::trigger::OpDetWaveformMetaMatcher<>::loadAssociations()
 
 
+//------------------------------------------------------------------------------
+template <typename Event>
+auto icarus::trigger::OpDetWaveformMetaMatcher<Event>::waveformKeyIndex
+  (art::ProductID const& pid, WaveformMetaAssns_t const& assns)
+  -> WaveformKeyIndex_t const&
+{
+
+  // if already there, the better
+  if (auto const itIndex = fIndices.find(pid); itIndex != fIndices.end())
+    return itIndex->second;
+
+  // one sweep through the associations, then never again for this collection
+  WaveformKeyIndex_t& index = fIndices[pid];
+  index.reserve(assns.size());
+  for (auto const& assn: assns) index[assn.first.key()] = assn.second;
+  return index;
+
+} // icarus::trigger::OpDetWaveformMetaMatcher<>::waveformKeyIndex()
+
+
 //------------------------------------------------------------------------------
 template <typename Event>
 art::Ptr<raw::OpDetWaveform>
 icarus::trigger::OpDetWaveformMetaMatcher<Event>::findAssociatedWaveform(
   art::Ptr<sbn::OpDetWaveformMeta> const& meta,
   WaveformMetaAssns_t const& assns
-) const {
-  
+) {
+
   auto const key = meta.key();
-  
+
   // try our luck: 1-1 association?
   if ((assns.size() > key) && (assns.at(key).first == meta))
     return assns[key].second;
-  
-  // nope, go binary search
-  if (auto itAssn = std::lower_bound(assns.begin(), assns.end(), meta, CmpFirst{});
-      itAssn != assns.end()
-  ) {
-    if (itAssn->first == meta) return itAssn->second;
-  }
-  
-  // still nope, go linear search
-  for (auto const& assn: assns) if (assn.first == meta) return assn.second;
-  
+
+  // nope: use the one-shot key index of this collection, so that every
+  // following query on it costs constant time rather than a scan
+  WaveformKeyIndex_t const& index = waveformKeyIndex(meta.id(), assns);
+
+  auto const itIndex = index.find(key);
+  if (itIndex != index.end()) return itIndex->second;
+
   // still nope, not found!
   return {};
-  
+
 } // icarus::trigger::OpDetWaveformMetaMatcher::fetchAssociatedWaveform()
 
 
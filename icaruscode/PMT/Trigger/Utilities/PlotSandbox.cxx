@@ -18,11 +18,24 @@
 #include "messagefacility/MessageLogger/MessageLogger.h" // MF_XXX() macros
 
 // ROOT libraries
+#include "TH1.h"
 
 // C/C++ standard libraries
+#include <mutex>
 #include <string_view>
 #include <utility> // std::forward()
 #include <type_traits> // std::add_const_t<>
+#include <cstddef> // std::size_t
+
+
+//------------------------------------------------------------------------------
+namespace {
+
+  /// Protects the creation of new fill buffers: the histogram lookup they
+  /// require is a ROOT directory operation, which is not thread-safe.
+  std::mutex BufferCreationMutex;
+
+} // local namespace
 
 
 //------------------------------------------------------------------------------
@@ -92,6 +105,7 @@ icarus::trigger::PlotSandbox::PlotSandbox(
 //------------------------------------------------------------------------------
 icarus::trigger::PlotSandbox::PlotSandbox(PlotSandbox&& from)
   : fData(std::move(from.fData))
+  , fFillBuffers(std::move(from.fFillBuffers))
 {
   fData.resetSubboxParents(this); // adjust the parent pointers of the subboxes
 } // PlotSandbox::PlotSandbox(PlotSandbox&&)
@@ -150,6 +164,147 @@ bool icarus::trigger::PlotSandbox::empty() const {
 } // icarus::trigger::PlotSandbox::empty()
 
 
+//------------------------------------------------------------------------------
+void icarus::trigger::PlotSandbox::materialize() const {
+
+  for (auto& factory: util::values(fData.deferredObjs)) factory();
+  fData.deferredObjs.clear();
+
+  for (auto const& subbox: subSandboxes()) subbox.materialize();
+
+} // icarus::trigger::PlotSandbox::materialize()
+
+
+//------------------------------------------------------------------------------
+TObject* icarus::trigger::PlotSandbox::materializeDeferred
+  (std::string const& key) const
+{
+  auto const itDeferred = fData.deferredObjs.find(key);
+  if (itDeferred == fData.deferredObjs.end()) return nullptr;
+
+  TObject* obj = (itDeferred->second)();
+  fData.deferredObjs.erase(itDeferred);
+  return obj;
+
+} // icarus::trigger::PlotSandbox::materializeDeferred()
+
+
+//------------------------------------------------------------------------------
+void icarus::trigger::PlotSandbox::fillBuffered
+  (std::string const& name, double x, double weight /* = 1.0 */) const
+  { bufferFor(name).fill(x, weight); }
+
+
+//------------------------------------------------------------------------------
+void icarus::trigger::PlotSandbox::fillBuffered2D
+  (std::string const& name, double x, double y, double weight /* = 1.0 */)
+  const
+  { bufferFor(name).fill2D(x, y, weight); }
+
+
+//------------------------------------------------------------------------------
+void icarus::trigger::PlotSandbox::mergeBufferedFills() {
+
+  for (BufferSet_t& buffers: *fFillBuffers)
+    for (auto& [ name, buffer ]: buffers) buffer.mergeAndReset();
+
+  for (auto& subbox: util::values(fData.subBoxes))
+    subbox->mergeBufferedFills();
+
+} // icarus::trigger::PlotSandbox::mergeBufferedFills()
+
+
+//------------------------------------------------------------------------------
+auto icarus::trigger::PlotSandbox::bufferFor(std::string const& name) const
+  -> HistogramBuffer&
+{
+  BufferSet_t& buffers = fFillBuffers->local();
+  auto const itBuffer = buffers.find(name);
+  if (itBuffer != buffers.end()) return itBuffer->second;
+
+  // first fill of this histogram from this thread: the histogram lookup is
+  // a ROOT directory operation and must not run concurrently
+  std::lock_guard lock { BufferCreationMutex };
+  return buffers.try_emplace(name, demand<TH1>(name)).first->second;
+
+} // icarus::trigger::PlotSandbox::bufferFor()
+
+
+//------------------------------------------------------------------------------
+//--- icarus::trigger::PlotSandbox::HistogramBuffer
+//------------------------------------------------------------------------------
+icarus::trigger::PlotSandbox::HistogramBuffer::HistogramBuffer(TH1& target)
+  : fTarget(&target)
+  , fCells(target.GetNcells(), 0.0)
+{
+  fStats.fill(0.0);
+} // PlotSandbox::HistogramBuffer::HistogramBuffer()
+
+
+//------------------------------------------------------------------------------
+void icarus::trigger::PlotSandbox::HistogramBuffer::fill
+  (double x, double weight)
+{
+  int const bin = fTarget->GetXaxis()->FindFixBin(x); // read-only, thread-safe
+  fCells[bin] += weight;
+  ++fEntries;
+
+  // like `TH1::Fill()`, statistics do not cover under/overflow entries
+  if ((bin < 1) || (bin > fTarget->GetNbinsX())) return;
+  fStats[0] += weight;
+  fStats[1] += weight * weight;
+  fStats[2] += weight * x;
+  fStats[3] += weight * x * x;
+
+} // icarus::trigger::PlotSandbox::HistogramBuffer::fill()
+
+
+//------------------------------------------------------------------------------
+void icarus::trigger::PlotSandbox::HistogramBuffer::fill2D
+  (double x, double y, double weight)
+{
+  int const binX = fTarget->GetXaxis()->FindFixBin(x);
+  int const binY = fTarget->GetYaxis()->FindFixBin(y);
+  fCells[fTarget->GetBin(binX, binY)] += weight;
+  ++fEntries;
+
+  // like `TH2::Fill()`, statistics do not cover under/overflow entries
+  if ((binX < 1) || (binX > fTarget->GetNbinsX())) return;
+  if ((binY < 1) || (binY > fTarget->GetNbinsY())) return;
+  fStats[0] += weight;
+  fStats[1] += weight * weight;
+  fStats[2] += weight * x;
+  fStats[3] += weight * x * x;
+  fStats[4] += weight * y;
+  fStats[5] += weight * y * y;
+  fStats[6] += weight * x * y;
+
+} // icarus::trigger::PlotSandbox::HistogramBuffer::fill2D()
+
+
+//------------------------------------------------------------------------------
+void icarus::trigger::PlotSandbox::HistogramBuffer::mergeAndReset() {
+
+  for (std::size_t cell = 0U; cell < fCells.size(); ++cell) {
+    if (fCells[cell] == 0.0) continue;
+    // unlike `Fill()`, `AddBinContent()` does not alter the entry count
+    fTarget->AddBinContent(static_cast<int>(cell), fCells[cell]);
+    fCells[cell] = 0.0;
+  } // for
+
+  std::array<double, 11U> stats; // covers up to three dimensions
+  stats.fill(0.0);
+  fTarget->GetStats(stats.data());
+  for (std::size_t i = 0U; i < stats.size(); ++i) stats[i] += fStats[i];
+  fTarget->PutStats(stats.data());
+  fTarget->SetEntries(fTarget->GetEntries() + fEntries);
+
+  fStats.fill(0.0);
+  fEntries = 0U;
+
+} // icarus::trigger::PlotSandbox::HistogramBuffer::mergeAndReset()
+
+
 //------------------------------------------------------------------------------
 auto icarus::trigger::PlotSandbox::findSandbox(std::string const& name)
   -> PlotSandbox*
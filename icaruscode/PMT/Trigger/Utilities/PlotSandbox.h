@@ -24,16 +24,27 @@
 #include "TClass.h"
 #include "TObject.h"
 
+// TBB libraries
+#include "tbb/enumerable_thread_specific.h"
+
 // C/C++ standard libraries
 #include <string>
 #include <map>
+#include <array>
+#include <vector>
 #include <iterator> // std::prev()
+#include <tuple> // std::make_tuple(), std::apply()
 #include <utility> // std::pair<>
-#include <functional> // std::hash<>
+#include <functional> // std::hash<>, std::function<>
 #include <initializer_list>
 #include <memory> // std::unique_ptr<>
 
 
+// -----------------------------------------------------------------------------
+// forward declarations
+class TH1;
+
+
 //------------------------------------------------------------------------------
 namespace icarus::trigger::details {
   
@@ -124,7 +135,12 @@ class icarus::trigger::PlotSandbox {
     
     /// Contained sand boxes.
     std::map<std::string, std::unique_ptr<PlotSandbox>> subBoxes;
-    
+
+    /// Objects with deferred creation (`makeDeferred()`), by processed name
+    /// and path; each entry creates and registers its object when called.
+    /// Mutable: entries are consumed on first access, even from `use() const`.
+    mutable std::map<std::string, std::function<TObject*()>> deferredObjs;
+
     TFileDirectoryHelper outputDir; ///< Output ROOT directory of the sandbox.
     
     Data_t() = default;
@@ -144,6 +160,41 @@ class icarus::trigger::PlotSandbox {
   } fData;
   
   
+  /// Thread-local fixed-bin accumulator for one histogram (see `fillBuffered()`).
+  class HistogramBuffer {
+
+    TH1* fTarget = nullptr; ///< The histogram the entries are accumulated for.
+    std::vector<double> fCells; ///< Weight sums per cell (with under/overflow).
+    std::array<double, 11U> fStats; ///< Statistics sums (see `TH1::PutStats()`).
+    unsigned long long fEntries = 0U; ///< Number of entries accumulated.
+
+      public:
+    explicit HistogramBuffer(TH1& target);
+
+    /// Accumulates one entry, like `TH1::Fill()` would.
+    void fill(double x, double weight);
+
+    /// Accumulates one 2D entry, like `TH2::Fill()` would.
+    void fill2D(double x, double y, double weight);
+
+    /// Adds the accumulated content into the histogram and empties the buffer.
+    void mergeAndReset();
+
+  }; // class HistogramBuffer
+
+  /// All the buffers of one thread, keyed by unprocessed histogram name.
+  using BufferSet_t = std::map<std::string, HistogramBuffer>;
+
+  /// Per-thread fill buffer sets (held by pointer to keep the sandbox movable).
+  mutable std::unique_ptr<tbb::enumerable_thread_specific<BufferSet_t>>
+    fFillBuffers
+    = std::make_unique<tbb::enumerable_thread_specific<BufferSet_t>>();
+
+  /// Returns this thread's buffer for the histogram `name`, creating it (with
+  /// a serialized histogram lookup) on the first fill from this thread.
+  HistogramBuffer& bufferFor(std::string const& name) const;
+
+
   /// Helper function for `findSandbox()` implementations.
   template <typename SandboxType>
   static auto* findSandbox(SandboxType& sandbox, std::string const& name);
@@ -302,10 +353,75 @@ class icarus::trigger::PlotSandbox {
    */
   template <typename Obj, typename... Args>
   Obj* make(std::string const& name, std::string const& title, Args&&... args);
-  
+
+  /**
+   * @brief Schedules the creation of a ROOT object, to happen on first access.
+   * @tparam Obj type of ROOT object to be created
+   * @tparam Args types of the argumenst to be forwarded to the constructor
+   * @param name unprocessed name of the new object
+   * @param title unprocessed title of the new object
+   * @param args additional arguments forwarded to the constructor
+   * @see `make()`, `materialize()`
+   *
+   * This method is equivalent to `make()`, except that the object is not
+   * created immediately: its constructor arguments are stored, and the object
+   * is created and registered on the first access to it (`get()`, `use()`,
+   * `demand()`) or when `materialize()` is called.
+   * Objects that are never accessed nor materialized are never created at all.
+   * This saves both job start time and output space when many of the objects
+   * are expected to stay empty (e.g. plots of rare event categories).
+   *
+   * The name and title are processed immediately, like in `make()`; the
+   * constructor arguments are stored by value.
+   */
+  template <typename Obj, typename... Args>
+  void makeDeferred
+    (std::string const& name, std::string const& title, Args&&... args);
+
+  /// Creates all the objects scheduled by `makeDeferred()` and not created
+  /// yet, in this sandbox and, recursively, in all the contained ones.
+  void materialize() const;
+
   /// @}
   // --- END -- ROOT object management -----------------------------------------
-  
+
+
+  // --- BEGIN -- Buffered histogram filling -----------------------------------
+  /**
+   * @name Buffered histogram filling
+   *
+   * Filling a ROOT histogram is not thread-safe, which forces modules running
+   * replicated to serialize every fill with a lock. The methods in this
+   * section offer an alternative: each thread accumulates its entries into a
+   * private fixed-bin buffer (one per histogram, created on the first fill
+   * from that thread), and the buffers are added into the ROOT objects in a
+   * single pass by `mergeBufferedFills()`, typically at the end of the job.
+   * No synchronization is needed on the fill path after the first fill of
+   * each histogram from each thread.
+   *
+   * Until `mergeBufferedFills()` is called, the ROOT histograms do not
+   * reflect the buffered entries: code inspecting them mid-job (including
+   * `empty()`) must merge first.
+   */
+  /// @{
+
+  /// Accumulates an entry for the histogram `name` into this thread's buffer.
+  void fillBuffered
+    (std::string const& name, double x, double weight = 1.0) const;
+
+  /// Accumulates an entry for the 2D histogram `name` into this thread's
+  /// buffer.
+  void fillBuffered2D
+    (std::string const& name, double x, double y, double weight = 1.0) const;
+
+  /// Adds the content of all the thread buffers of this sandbox and of all
+  /// the contained ones into their ROOT histograms, and empties the buffers.
+  /// Not thread-safe: call it outside the event loop (e.g. `endJob()`).
+  void mergeBufferedFills();
+
+  /// @}
+  // --- END -- Buffered histogram filling -------------------------------------
+
   
   // --- BEGIN -- Contained sandboxes ------------------------------------------
   /// @name Contained sandboxes
@@ -427,6 +543,11 @@ class icarus::trigger::PlotSandbox {
     (Stream&& out, std::string indent, std::string firstIndent) const;
   
   
+  /// Creates and registers the object scheduled under the specified processed
+  /// name and path, if any; returns it, or `nullptr` if none is pending.
+  TObject* materializeDeferred(std::string const& key) const;
+
+
   /// Retrieves or, if not present, creates a ROOT subdirectory in the sandbox.
   /// Returns a pair with the directory and the name part of `path`.
   /// The directory part may be empty.
@@ -492,15 +613,20 @@ Obj const* icarus::trigger::PlotSandbox::get(std::string const& name) const
 //------------------------------------------------------------------------------
 template <typename Obj /* = TObject */>
 Obj* icarus::trigger::PlotSandbox::use(std::string const& name) const {
-  
+
   auto [ objDir, objName ] = splitPath(name);
-  
-  TDirectory* dir = getDirectory(objDir);
-  if (!dir) return nullptr;
-  
+
   std::string const processedName = processName(objName);
-  return dir->Get<Obj>(processedName.c_str());
-  
+
+  if (TDirectory* dir = getDirectory(objDir)) {
+    if (Obj* obj = dir->Get<Obj>(processedName.c_str())) return obj;
+  }
+
+  // not in the output directory (possibly not even the directory itself):
+  // the object creation may have been deferred (`makeDeferred()`)
+  TObject* obj = materializeDeferred(joinPath({ objDir, processedName }));
+  return obj? dynamic_cast<Obj*>(obj): nullptr;
+
 } // icarus::trigger::PlotSandbox::use()
 
 
@@ -558,6 +684,44 @@ Obj* icarus::trigger::PlotSandbox::make
 } // icarus::trigger::PlotSandbox::make()
 
 
+//------------------------------------------------------------------------------
+template <typename Obj, typename... Args>
+void icarus::trigger::PlotSandbox::makeDeferred
+  (std::string const& name, std::string const& title, Args&&... args)
+{
+  auto [ objDir, objName ] = splitPath(name);
+
+  std::string const processedName = processName(objName);
+  std::string const processedTitle = processPlotTitle(title);
+
+  // `mkdir()` is lazy and does not create the ROOT directory just yet
+  art::TFileDirectory destDir
+    = objDir.empty()? fData.outputDir.fDir: fData.outputDir.fDir.mkdir(objDir);
+
+  // everything needed for the creation is stored, by value, in the factory;
+  // the creation itself follows the same pattern as in `make()`
+  fData.deferredObjs[joinPath({ objDir, processedName })] =
+    [
+      destDir, processedName, processedTitle,
+      argsTuple = std::make_tuple(std::forward<Args>(args)...)
+    ]() mutable -> TObject*
+    {
+      auto maker = [&destDir, &processedName, &processedTitle]
+        (auto&&... args)
+        {
+          // see Redmine issue #23075
+          return destDir.makeAndRegister<Obj>(
+            processedName.c_str(), processedTitle.c_str(),
+            processedName.c_str(), processedTitle.c_str(),
+            std::forward<decltype(args)>(args)...
+            );
+        };
+      return std::apply(maker, std::move(argsTuple));
+    };
+
+} // icarus::trigger::PlotSandbox::makeDeferred()
+
+
 //------------------------------------------------------------------------------
 template
   <typename SandboxType /* = icarus::trigger::PlotSandbox */, typename... Args>
@@ -667,7 +831,13 @@ void icarus::trigger::PlotSandbox::dumpContent
         ;
     } // for
   } // if has keys
-  
+  if (!fData.deferredObjs.empty()) {
+    out << "\n" << indent << fData.deferredObjs.size()
+      << " objects scheduled for deferred creation:";
+    for (auto const& deferred: fData.deferredObjs)
+      out << "\n" << indent << "  '" << deferred.first << "'  [not created yet]";
+  } // if deferred objects
+
 } // icarus::trigger::PlotSandbox::dumpContent()
 
 
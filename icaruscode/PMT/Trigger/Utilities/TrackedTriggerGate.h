@@ -18,10 +18,14 @@
 
 // C/C++ standard libraries
 #include <iosfwd>
-#include <set>
+#include <algorithm> // std::lower_bound(), std::move_backward()
+#include <array>
+#include <iterator> // std::move_iterator
+#include <vector>
 #include <functional> // std::mem_fn()
 #include <utility> // std::in_place_t, std::forward(), ...
 #include <type_traits> // std::true_type...
+#include <cstddef> // std::size_t
 
 
 
@@ -68,6 +72,69 @@ namespace icarus::trigger {
   
 } // namespace icarus::trigger
 
+
+// -----------------------------------------------------------------------------
+namespace icarus::trigger::details {
+
+  /**
+   * @brief Sorted collection of unique values with inline small-buffer storage.
+   * @tparam T type of the stored values (strictly comparable, cheap to move)
+   * @tparam InlineCapacity values stored without touching the heap
+   *
+   * The values are kept sorted and unique, like in a `std::set`, but they live
+   * in a contiguous buffer: the first `InlineCapacity` of them directly inside
+   * the object, the rest (if ever needed) in a single heap block.
+   * Merging two of these sets therefore allocates at most once, and not at all
+   * in the typical case where the result still fits inline: this is the
+   * container backing `TrackedTriggerGate` tracking, where gates from a few
+   * waveforms at a time are combined over and over in the trigger simulation.
+   *
+   * Values can only be added (`insert()`, `merge()`), never removed, which is
+   * all the tracking needs. The value type must be default-constructible
+   * (the inline buffer is default-initialized), which pointers and handles,
+   * the recommended tracking currencies, are.
+   */
+  template <typename T, std::size_t InlineCapacity = 8U>
+  class SmallSortedSet {
+
+    static_assert(InlineCapacity > 0U, "Inline capacity must not be zero.");
+
+    std::array<T, InlineCapacity> fInline; ///< Storage while the set is small.
+    std::vector<T> fSpilled; ///< Storage after inline capacity is exceeded.
+    std::size_t fInlineSize = 0U; ///< Number of values stored in `fInline`.
+    bool fInlined = true; ///< Whether the values currently live in `fInline`.
+
+      public:
+
+    using value_type = T;
+    using const_iterator = T const*;
+
+    /// Returns the number of values in the set.
+    std::size_t size() const
+      { return fInlined? fInlineSize: fSpilled.size(); }
+
+    /// Returns whether the set contains no value at all.
+    bool empty() const { return size() == 0U; }
+
+    // @{
+    /// Iterates through the values, in sorted order.
+    const_iterator begin() const
+      { return fInlined? fInline.data(): fSpilled.data(); }
+    const_iterator end() const { return begin() + size(); }
+    // @}
+
+    /// Inserts `value` in the set, unless an equivalent one is already there.
+    void insert(T value);
+
+    /// Inserts all the values from `other` not present in this set yet.
+    void merge(SmallSortedSet const& other)
+      { for (T const& value: other) insert(value); }
+
+  }; // class SmallSortedSet
+
+} // namespace icarus::trigger::details
+
+
 // -----------------------------------------------------------------------------
 /**
   * @brief A wrapper to trigger gate objects tracking the input of operations.
@@ -106,9 +173,10 @@ class icarus::trigger::TrackedTriggerGate {
   
   /// Tracked information. Interface is pretty minimal so far.
   class TrackingInfo {
-    
-    std::set<Tracked_t> fTracked; ///< All tracked objects.
-    
+
+    /// All tracked objects, sorted; no allocation for the typical few of them.
+    details::SmallSortedSet<Tracked_t> fTracked;
+
       public:
     
     /// Add an object to the list of tracked objects, if it's not present yet.
@@ -124,7 +192,7 @@ class icarus::trigger::TrackedTriggerGate {
     bool hasTracked() const;
     
     /// Returns an iterable of all tracked objects.
-    auto getTracked() const;
+    auto const& getTracked() const;
     
   }; // class TrackingInfo
   
@@ -191,6 +259,41 @@ namespace icarus::trigger {
 } // namespace icarus::trigger
 
 
+// -----------------------------------------------------------------------------
+// ---  icarus::trigger::details::SmallSortedSet<>
+// -----------------------------------------------------------------------------
+template <typename T, std::size_t InlineCapacity>
+void icarus::trigger::details::SmallSortedSet<T, InlineCapacity>::insert
+  (T value)
+{
+  T* const b = fInlined? fInline.data(): fSpilled.data();
+  T* const e = b + size();
+  T* const it = std::lower_bound(b, e, value);
+  if ((it != e) && !(value < *it)) return; // equivalent value already there
+
+  if (!fInlined) { // already on the heap: plain sorted vector insertion
+    fSpilled.insert(fSpilled.begin() + (it - b), std::move(value));
+    return;
+  }
+
+  if (fInlineSize < InlineCapacity) { // shift the tail up and wedge it in
+    std::move_backward(it, e, e + 1);
+    *it = std::move(value);
+    ++fInlineSize;
+    return;
+  }
+
+  // inline buffer full: the whole content spills to the heap, once
+  fSpilled.reserve(InlineCapacity * 2U);
+  fSpilled.assign(
+    std::move_iterator{ fInline.begin() }, std::move_iterator{ fInline.end() }
+    );
+  fSpilled.insert(fSpilled.begin() + (it - b), std::move(value));
+  fInlined = false;
+
+} // icarus::trigger::details::SmallSortedSet<>::insert()
+
+
 // -----------------------------------------------------------------------------
 // ---  icarus::trigger::TrackedTriggerGate<>
 // -----------------------------------------------------------------------------
@@ -204,7 +307,7 @@ void icarus::trigger::TrackedTriggerGate<Gate, TrackedType>::TrackingInfo::add
 template <typename Gate, typename TrackedType>
 void icarus::trigger::TrackedTriggerGate<Gate, TrackedType>::TrackingInfo::add
   (TrackingInfo const& tracked)
-  { fTracked.insert(begin(tracked.fTracked), end(tracked.fTracked)); }
+  { fTracked.merge(tracked.fTracked); }
 
 
 // -----------------------------------------------------------------------------
@@ -225,7 +328,8 @@ icarus::trigger::TrackedTriggerGate<Gate, TrackedType>::TrackingInfo::hasTracked
 
 // -----------------------------------------------------------------------------
 template <typename Gate, typename TrackedType>
-auto icarus::trigger::TrackedTriggerGate<Gate, TrackedType>::TrackingInfo::getTracked()
+auto const&
+icarus::trigger::TrackedTriggerGate<Gate, TrackedType>::TrackingInfo::getTracked()
   const
   { return fTracked; }
 
@@ -16,7 +16,9 @@
 #include "sbnobj/ICARUS/PMT/Trigger/Data/OpticalTriggerGate.h"
 
 // C/C++ standard libraries
-#include <iterator> // std::iterator_traits
+#include <iterator> // std::iterator_traits, std::distance()
+#include <utility> // std::move()
+#include <vector>
 
 
 namespace icarus::trigger {
@@ -361,8 +363,13 @@ namespace icarus::trigger {
    * @return a new gate result of `op` on all the `gates`
    * @see `OpGates()`, `OpGateColl()`
    * 
-   * This is the sequential application of `op` to all gates from `begin` to
-   * `end` via `OpGates()`, following their order in the collection.
+   * This is the application of `op` to all gates from `begin` to `end` via
+   * `OpGates()`, grouped as a balanced pairwise reduction: each transition
+   * list is merged into a combined gate only a logarithmic number of times,
+   * rather than the combined gate being rewalked for each new operand as a
+   * linear left fold would do. The operation `op` is therefore required to be
+   * associative (all the operations in `GateOps` are); tracking information,
+   * being a set, is insensitive to the combination order.
    * The returned gate has the same type as the one pointed by the begin
    * iterator (`BIter::value_type` for standard iterators).
    */
@@ -496,19 +503,38 @@ auto icarus::trigger::OpGateColl(Op op, GateColl const& gates)
 template <typename Op, typename BIter, typename EIter>
 auto icarus::trigger::OpGatesSequence(Op op, BIter const begin, EIter const end)
 {
-  
+
   using Gate_t = typename std::iterator_traits<BIter>::value_type;
-  
+
   // if `gates` is empty return a default-constructed gate
   if (begin == end) return Gate_t{};
-  
-  BIter iGate = begin;
-  Gate_t resGate = *iGate;
-  while (++iGate != end)
-    resGate = OpGates(std::move(op), std::move(resGate), *iGate);
-  
-  return resGate;
-  
+
+  // balanced pairwise reduction (see documentation above): the first round
+  // combines the input gates two by two, the following rounds combine the
+  // partial results two by two until a single gate is left;
+  // the operation is assumed to be associative, so the result is the same as
+  // from a linear fold, but each transition list is walked only O(log N) times
+  std::vector<Gate_t> combined;
+  combined.reserve((std::distance(begin, end) + 1) / 2);
+  for (BIter iGate = begin; iGate != end; ) {
+    Gate_t A = *iGate++;
+    if (iGate == end) combined.push_back(std::move(A));
+    else combined.push_back(OpGates(op, std::move(A), *iGate++));
+  } // for
+
+  while (combined.size() > 1U) {
+    auto iDest = combined.begin();
+    auto iSrc = combined.begin();
+    while (iSrc != combined.end()) {
+      Gate_t A = std::move(*iSrc++);
+      if (iSrc == combined.end()) *iDest++ = std::move(A);
+      else *iDest++ = OpGates(op, std::move(A), std::move(*iSrc++));
+    } // while (pairs)
+    combined.erase(iDest, combined.end());
+  } // while (rounds)
+
+  return std::move(combined.front());
+
 } // icarus::trigger::OpGatesSequence()
 
 
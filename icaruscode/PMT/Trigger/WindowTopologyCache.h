@@ -0,0 +1,122 @@
+/**
+ * @file   icaruscode/PMT/Trigger/WindowTopologyCache.h
+ * @brief  Service sharing sliding window topology across trigger modules.
+ * @author Gianluca Petrillo (petrillo@slac.stanford.edu)
+ * @date   August 31, 2026
+ * @see    icaruscode/PMT/Trigger/WindowTopologyCache_service.cc
+ */
+
+#ifndef ICARUSCODE_PMT_TRIGGER_WINDOWTOPOLOGYCACHE_H
+#define ICARUSCODE_PMT_TRIGGER_WINDOWTOPOLOGYCACHE_H
+
+
+// ICARUS libraries
+#include "icaruscode/PMT/Trigger/Algorithms/WindowTopologyAlg.h"
+#include "icaruscode/PMT/Trigger/Algorithms/WindowChannelMap.h"
+
+// LArSoft libraries
+#include "lardataobj/RawData/OpDetWaveform.h" // raw::Channel_t
+
+// framework libraries
+#include "art/Framework/Services/Registry/ServiceDeclarationMacros.h"
+
+// C/C++ standard libraries
+#include <map>
+#include <mutex>
+#include <vector>
+#include <string>
+
+
+// -----------------------------------------------------------------------------
+// forward declarations
+namespace art { class ActivityRegistry; }
+namespace fhicl { class ParameterSet; }
+namespace geo { class GeometryCore; }
+
+// -----------------------------------------------------------------------------
+namespace icarus::trigger { class WindowTopologyCache; }
+/**
+ * @brief Process-wide cache of sliding window topology information.
+ *
+ * Each trigger emulation module independently extracts the composition and
+ * topology of its windows (`icarus::trigger::WindowTopologyAlg`) from the
+ * trigger gates of its first event, traversing the detector geometry in the
+ * process. Within one job all modules reading the same gate configuration end
+ * up with identical `icarus::trigger::WindowChannelMap` objects, so this
+ * service computes the topology once per distinct window composition and hands
+ * the frozen result out to every caller with that composition.
+ *
+ * The cache key is the channel content of the windows (which, with the
+ * geometry fixed within the job, fully determines the topology), so gate sets
+ * with different window arrangements coexist in the same job.
+ *
+ * The service is shared and the cache is protected by a lock; the lock is hit
+ * only when a module (re)learns its topology, not during pattern evaluation.
+ */
+class icarus::trigger::WindowTopologyCache {
+
+    public:
+
+  /// Type of sets of trigger gates.
+  using TriggerGates_t = icarus::trigger::WindowTopologyAlg::TriggerGates_t;
+
+  /// Type of sets of trigger gates, grouped by cryostat.
+  using TriggerGatesPerCryostat_t
+    = icarus::trigger::WindowTopologyAlg::TriggerGatesPerCryostat_t;
+
+
+  WindowTopologyCache
+    (fhicl::ParameterSet const& pset, art::ActivityRegistry& reg);
+
+  //@{
+  /**
+   * @brief Returns the topology of the windows described by the gates.
+   * @param gates the set of gates to extract the topology from
+   * @param geom geometry service provider
+   * @return topology of the windows described by the gates
+   *
+   * If a topology with the same window composition as `gates` has already been
+   * extracted during this job, that one is returned; otherwise it is created
+   * with `icarus::trigger::WindowTopologyAlg::createFromGates()` and cached.
+   * The returned topology stays valid for the rest of the job.
+   */
+  WindowChannelMap const& topologyFor
+    (TriggerGatesPerCryostat_t const& gates, geo::GeometryCore const& geom);
+  WindowChannelMap const& topologyFor
+    (TriggerGates_t const& gates, geo::GeometryCore const& geom);
+  //@}
+
+
+    private:
+
+  /// Type of cache key: the channel content of each window, in window order.
+  using Key_t = std::vector<std::vector<raw::Channel_t>>;
+
+  /// Returns the cache key for the specified `gates`.
+  static Key_t makeKey(TriggerGates_t const& gates);
+
+  /// Returns the cache key for the specified `gates` (grouped by cryostat).
+  static Key_t makeKey(TriggerGatesPerCryostat_t const& gates);
+
+  /// Returns the cached topology for `key`, extracting it from `gates` first
+  /// if this is the first time `key` is seen.
+  template <typename Gates>
+  WindowChannelMap const& findOrCreate
+    (Key_t&& key, Gates const& gates, geo::GeometryCore const& geom);
+
+
+  std::string fLogCategory; ///< Message facility category for output.
+
+  std::mutex fCacheMutex; ///< Protects `fCache`.
+
+  /// All topologies extracted so far (`std::map` nodes are never relocated,
+  /// so the references handed out stay valid as the cache grows).
+  std::map<Key_t, WindowChannelMap> fCache;
+
+}; // class icarus::trigger::WindowTopologyCache
+
+
+DECLARE_ART_SERVICE(icarus::trigger::WindowTopologyCache, SHARED)
+
+
+#endif // ICARUSCODE_PMT_TRIGGER_WINDOWTOPOLOGYCACHE_H
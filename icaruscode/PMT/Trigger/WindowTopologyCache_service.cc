@@ -0,0 +1,112 @@
+/**
+ * @file   icaruscode/PMT/Trigger/WindowTopologyCache_service.cc
+ * @brief  Service sharing sliding window topology (implementation file).
+ * @author Gianluca Petrillo (petrillo@slac.stanford.edu)
+ * @date   August 31, 2026
+ * @see    icaruscode/PMT/Trigger/WindowTopologyCache.h
+ */
+
+// library header
+#include "icaruscode/PMT/Trigger/WindowTopologyCache.h"
+
+// framework libraries
+#include "art/Framework/Services/Registry/ServiceDefinitionMacros.h"
+#include "messagefacility/MessageLogger/MessageLogger.h"
+#include "fhiclcpp/ParameterSet.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::sort()
+#include <utility> // std::move()
+
+
+//------------------------------------------------------------------------------
+icarus::trigger::WindowTopologyCache::WindowTopologyCache
+  (fhicl::ParameterSet const& pset, art::ActivityRegistry&)
+  : fLogCategory(pset.get<std::string>("LogCategory", "WindowTopologyCache"))
+{}
+
+
+//------------------------------------------------------------------------------
+auto icarus::trigger::WindowTopologyCache::topologyFor
+  (TriggerGatesPerCryostat_t const& gates, geo::GeometryCore const& geom)
+  -> WindowChannelMap const&
+{
+  return findOrCreate(makeKey(gates), gates, geom);
+} // icarus::trigger::WindowTopologyCache::topologyFor(per cryostat)
+
+
+//------------------------------------------------------------------------------
+auto icarus::trigger::WindowTopologyCache::topologyFor
+  (TriggerGates_t const& gates, geo::GeometryCore const& geom)
+  -> WindowChannelMap const&
+{
+  return findOrCreate(makeKey(gates), gates, geom);
+} // icarus::trigger::WindowTopologyCache::topologyFor()
+
+
+//------------------------------------------------------------------------------
+auto icarus::trigger::WindowTopologyCache::makeKey
+  (TriggerGates_t const& gates) -> Key_t
+{
+  Key_t key;
+  key.reserve(gates.size());
+  for (auto const& gate: gates) {
+    auto const& gateChannels = gate.channels();
+    std::vector<raw::Channel_t> channels
+      { gateChannels.begin(), gateChannels.end() };
+    std::sort(channels.begin(), channels.end());
+    key.push_back(std::move(channels));
+  } // for
+  return key;
+} // icarus::trigger::WindowTopologyCache::makeKey()
+
+
+//------------------------------------------------------------------------------
+auto icarus::trigger::WindowTopologyCache::makeKey
+  (TriggerGatesPerCryostat_t const& gates) -> Key_t
+{
+  Key_t key;
+  for (TriggerGates_t const& cryoGates: gates) {
+    Key_t cryoKey = makeKey(cryoGates);
+    key.insert(key.end(),
+      std::make_move_iterator(cryoKey.begin()),
+      std::make_move_iterator(cryoKey.end())
+      );
+  } // for
+  return key;
+} // icarus::trigger::WindowTopologyCache::makeKey(per cryostat)
+
+
+//------------------------------------------------------------------------------
+template <typename Gates>
+auto icarus::trigger::WindowTopologyCache::findOrCreate
+  (Key_t&& key, Gates const& gates, geo::GeometryCore const& geom)
+  -> WindowChannelMap const&
+{
+  std::lock_guard lock { fCacheMutex };
+
+  auto const it = fCache.find(key);
+  if (it != fCache.end()) {
+    mf::LogDebug(fLogCategory)
+      << "Reusing cached window topology (" << it->second.nWindows()
+      << " windows).";
+    return it->second;
+  }
+
+  icarus::trigger::WindowTopologyAlg const topoMaker
+    { geom, fLogCategory + "_Extractor" };
+  auto const [ newIt, inserted ]
+    = fCache.emplace(std::move(key), topoMaker.createFromGates(gates));
+  mf::LogDebug(fLogCategory)
+    << "Extracted and cached a new window topology ("
+    << newIt->second.nWindows() << " windows, " << fCache.size()
+    << " in cache).";
+  return newIt->second;
+} // icarus::trigger::WindowTopologyCache::findOrCreate()
+
+
+//------------------------------------------------------------------------------
+DEFINE_ART_SERVICE(icarus::trigger::WindowTopologyCache)
+
+
+//------------------------------------------------------------------------------
@@ -62,6 +62,16 @@ public:
 
 private:
 
+  // Payload for one waveform histogram, buffered so the event loop does not
+  // touch ROOT; everything is flushed to the TFileService in one go at endJob()
+  struct WaveformPayload {
+    size_t evNumber;
+    size_t chNumber;
+    double startTime;
+    double endTime;
+    std::vector<raw::ADC_Count_t> adcs;
+  };
+
   size_t fEvNumber;
   size_t fChNumber;
   double fSampling;
@@ -73,6 +83,10 @@ private:
   std::string fInputModuleName;
   std::stringstream histname;
 
+  size_t fMaxBufferedWaveforms;               // bound of the deferred-write buffer
+  std::vector<WaveformPayload> fWaveformBuffer; // waveforms waiting to be written
+  size_t fNumDropped;                         // waveforms dropped when the buffer was full
+
 };
 
 
@@ -83,6 +97,8 @@ wvfAnaicarus::wvfAnaicarus(fhicl::ParameterSet const & p)
 {
   fInputModuleName = p.get< std::string >("InputModule" );
   fSampling = p.get< double >("Sampling" );
+  fMaxBufferedWaveforms = p.get< size_t >("MaxBufferedWaveforms", 10000 );
+  fNumDropped = 0;
 
 }
 
@@ -102,7 +118,6 @@ void wvfAnaicarus::analyze(art::Event const & e)
   // Implementation of required member function here.
   std::cout << "My module on event #" << e.id().event() << std::endl;
 
-  art::ServiceHandle<art::TFileService> tfs;
   fEvNumber = e.id().event();
   
   art::Handle< std::vector< raw::OpDetWaveform > > waveHandle;
@@ -118,31 +133,49 @@ void wvfAnaicarus::analyze(art::Event const & e)
   for(auto const& wvf : (*waveHandle)){
 	fChNumber = wvf.ChannelNumber();
   	std::cout << "Photon channel: " << fChNumber << std::endl;
-//	std::stringstream histName;
-	histname.str(std::string());
-	histname << "event_" << fEvNumber 
-      		 << "_opchannel_" <<fChNumber;
-	
+
 	fStartTime = wvf.TimeStamp()/1000; //in us
 	fEndTime = double(wvf.size())/fSampling + fStartTime;
 	fEndTime = fEndTime/1000; //in us
 
-	//Create a new histogram
-	TH1D *wvfHist = tfs->make< TH1D >(histname.str().c_str(), TString::Format(";t - %f (#mus);",fStartTime), wvf.size(), fStartTime, fEndTime);
-	//if(fChNumber==0){
-//	  std::copy(wvf.begin(),wvf.end(),fAmp);
- 	for(unsigned int i=0; i<wvf.size();i++){
-	  wvfHist->SetBinContent(i+1,(double)wvf[i]);
-//	  fAmp = (double)wvf[i];
-	//  std::cout << fAmp << fTime << std::endl;
-//	  fWaveformTree->Fill();
-	  	//std::cout << wvf[i] << std::endl;
-	}	
+	// Buffer the waveform instead of making the histogram here, so the event
+	// loop never blocks on ROOT; if the buffer bound is hit the waveform is
+	// dropped (and counted) rather than stalling processing
+	if(fWaveformBuffer.size() < fMaxBufferedWaveforms){
+	  WaveformPayload payload;
+	  payload.evNumber  = fEvNumber;
+	  payload.chNumber  = fChNumber;
+	  payload.startTime = fStartTime;
+	  payload.endTime   = fEndTime;
+	  payload.adcs.assign(wvf.begin(), wvf.end());
+	  fWaveformBuffer.push_back(std::move(payload));
+	}
+	else fNumDropped++;
   }
 }
 
 
 void wvfAnaicarus::endJob(){
+
+  // Flush the buffered waveforms into histograms in one pass
+  art::ServiceHandle<art::TFileService> tfs;
+
+  for(auto const& payload : fWaveformBuffer){
+	histname.str(std::string());
+	histname << "event_" << payload.evNumber
+      		 << "_opchannel_" << payload.chNumber;
+
+	//Create a new histogram
+	TH1D *wvfHist = tfs->make< TH1D >(histname.str().c_str(), TString::Format(";t - %f (#mus);",payload.startTime), payload.adcs.size(), payload.startTime, payload.endTime);
+ 	for(unsigned int i=0; i<payload.adcs.size();i++){
+	  wvfHist->SetBinContent(i+1,(double)payload.adcs[i]);
+	}
+  }
+
+  // Backpressure accounting: report how the buffer fared
+  std::cout << "wvfAnaicarus: wrote " << fWaveformBuffer.size() << " waveform histograms, "
+            << fNumDropped << " waveforms dropped on full buffer (bound: "
+            << fMaxBufferedWaveforms << ")" << std::endl;
 }
 
 DEFINE_ART_MODULE(wvfAnaicarus)
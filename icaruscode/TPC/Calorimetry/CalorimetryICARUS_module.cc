@@ -12,6 +12,8 @@
 #include <string>
 #include <optional>
 #include <cmath>
+#include <map>
+#include <unordered_map>
 #include <limits> // std::numeric_limits<>
 
 #include "icaruscode/TPC/Calorimetry/Algorithms/CalorimetryIcarusAlg.h"
@@ -174,6 +176,25 @@ void calo::CalorimetryICARUS::produce(art::Event &evt)
   std::unique_ptr<std::vector<anab::Calorimetry>> calorimetrycol(new std::vector<anab::Calorimetry>);
   std::unique_ptr<art::Assns<recob::Track, anab::Calorimetry>> assn(new art::Assns<recob::Track, anab::Calorimetry>);
 
+  // geometry constants hoisted out of the hit loops: one flat entry per plane,
+  // filled lazily the first time a hit from that plane is seen in this event
+  struct PlaneConsts { double angleToVert; double wirePitch; };
+  std::map<geo::PlaneID, PlaneConsts> planeConstsMap;
+
+  auto planeConstsFor = [&geom, &planeConstsMap](recob::Hit const& hit) -> PlaneConsts const&
+  {
+    geo::PlaneID const planeid = hit.WireID().planeID();
+    auto it = planeConstsMap.find(planeid);
+    if (it == planeConstsMap.end())
+    {
+      PlaneConsts consts;
+      consts.angleToVert = geom->WireAngleToVertical(hit.View(), planeid.TPC, planeid.Cryostat) - 0.5 * ::util::pi<>();
+      consts.wirePitch = geom->WirePitch(hit.View());
+      it = planeConstsMap.emplace(planeid, consts).first;
+    }
+    return it->second;
+  };
+
   //art::FindManyP<recob::SpacePoint> fmsp(trackListHandle, evt, fTrackModuleLabel);
   art::FindManyP<recob::Hit> fmht(trackListHandle, evt, fTrackModuleLabel);
   art::FindManyP<recob::Hit, recob::TrackHitMeta> fmthm(trackListHandle, evt, fTrackModuleLabel); //this has more information about hit-track association, only available in PMA for now
@@ -205,6 +226,16 @@ void calo::CalorimetryICARUS::produce(art::Event &evt)
       TickT0 = T0 / sampling_rate(clockData);
     }
 
+    // index the track's hit/metadata association by hit key once per track;
+    // previously the association vectors were copied and scanned for every hit
+    std::unordered_map<size_t, size_t> hitKeyToMetaIdx;
+    if (fmthm.isValid())
+    {
+      auto const &vhit = fmthm.at(trkIter);
+      for (size_t ii = 0; ii < vhit.size(); ++ii)
+        hitKeyToMetaIdx.emplace(vhit[ii].key(), ii);
+    }
+
     std::vector<std::vector<unsigned int>> hits(nplanes);
 
     art::FindManyP<recob::SpacePoint> fmspts(allHits, evt, fSpacePointModuleLabel);
@@ -385,27 +416,26 @@ void calo::CalorimetryICARUS::produce(art::Event &evt)
         bool fBadhit = false;
         if (fmthm.isValid())
         {
-          auto vhit = fmthm.at(trkIter);
-          auto vmeta = fmthm.data(trkIter);
-          for (size_t ii = 0; ii < vhit.size(); ++ii)
+          auto const &vhit = fmthm.at(trkIter);
+          auto const &vmeta = fmthm.data(trkIter);
+          auto const keyItr = hitKeyToMetaIdx.find(allHits[hits[ipl][ihit]].key());
+          if (keyItr != hitKeyToMetaIdx.end())
           {
-            if (vhit[ii].key() == allHits[hits[ipl][ihit]].key())
+            size_t const ii = keyItr->second;
+            if (vmeta[ii]->Index() == std::numeric_limits<unsigned int>::max())
+            {
+              fBadhit = true;
+            }
+            else if (vmeta[ii]->Index() >= tracklist[trkIter]->NumberTrajectoryPoints())
+            {
+              throw cet::exception("Calorimetry_module.cc") << "Requested track trajectory index " << vmeta[ii]->Index() << " exceeds the total number of trajectory points " << tracklist[trkIter]->NumberTrajectoryPoints() << " for track index " << trkIter << ". Something is wrong with the track reconstruction. Please contact tjyang@fnal.gov";
+            }
+            else if (!tracklist[trkIter]->HasValidPoint(vmeta[ii]->Index()))
+            {
+              fBadhit = true;
+            }
+            else
             {
-              if (vmeta[ii]->Index() == std::numeric_limits<unsigned int>::max())
-              {
-                fBadhit = true;
-                continue;
-              }
-              if (vmeta[ii]->Index() >= tracklist[trkIter]->NumberTrajectoryPoints())
-              {
-                throw cet::exception("Calorimetry_module.cc") << "Requested track trajectory index " << vmeta[ii]->Index() << " exceeds the total number of trajectory points " << tracklist[trkIter]->NumberTrajectoryPoints() << " for track index " << trkIter << ". Something is wrong with the track reconstruction. Please contact tjyang@fnal.gov";
-              }
-              if (!tracklist[trkIter]->HasValidPoint(vmeta[ii]->Index()))
-              {
-                fBadhit = true;
-                continue;
-              }
-
               //Correct location for SCE
               geo::Point_t const loc = tracklist[trkIter]->LocationAtPoint(vmeta[ii]->Index());
               geo::Vector_t locOffsets = {
@@ -419,12 +449,13 @@ void calo::CalorimetryICARUS::produce(art::Event &evt)
               xyz3d[1] = loc.Y() + locOffsets.Y();
               xyz3d[2] = loc.Z() + locOffsets.Z();
 
-              double angleToVert = geom->WireAngleToVertical(vhit[ii]->View(), vhit[ii]->WireID().TPC, vhit[ii]->WireID().Cryostat) - 0.5 * ::util::pi<>();
+              const PlaneConsts &planeConsts = planeConstsFor(*vhit[ii]);
+              double angleToVert = planeConsts.angleToVert;
               const geo::Vector_t &dir = tracklist[trkIter]->DirectionAtPoint(vmeta[ii]->Index());
               double cosgamma = std::abs(std::sin(angleToVert) * dir.Y() + std::cos(angleToVert) * dir.Z());
               if (cosgamma)
               {
-                pitch = geom->WirePitch(vhit[ii]->View()) / cosgamma;
+                pitch = planeConsts.wirePitch / cosgamma;
               }
               else
               {
@@ -438,8 +469,6 @@ void calo::CalorimetryICARUS::produce(art::Event &evt)
               const TVector3 &dir_corr = {pitch * dir.X() - dirOffsets.X() + locOffsets.X(), pitch * dir.Y() + dirOffsets.Y() - locOffsets.Y(), pitch * dir.Z() + dirOffsets.Z() - locOffsets.Z()};
 
               pitch = dir_corr.Mag();
-
-              break;
             }
           }
         }
@@ -11,6 +11,7 @@
 #include "cetlib_except/exception.h"
 #include "larcore/Geometry/Geometry.h"
 
+#include <algorithm>
 #include <cmath>
 #include <fstream>
 
@@ -168,7 +169,30 @@ void CandHitICARUS::findHitCandidates(const recob::Wire::RegionsOfInterest_t::da
     else if(plane == 1) width=fInd2Width;
     else if(plane == 2) width=fColWidth;
 
-    for( i=0;i<4096;i++)
+    // The scan runs in two stages. First a branch-free pass marks the ticks over threshold; the
+    // comparison loop has no dependencies so the compiler vectorizes it, checking many ticks per
+    // instruction. The branchy hit shaping state machine below then runs only over the runs of
+    // ticks over threshold (plus the one tick following each run, which is where a hit gets
+    // closed out); the quiet stretches making up most of the wire are skipped entirely. The
+    // state carries across runs so the emitted candidates match the old tick-by-tick scan
+    size_t nTicks = std::min(waveform.size(),size_t(4096));
+
+    // local so concurrent calls from the parallel hit finder do not share it
+    std::vector<unsigned char> aboveThresholdVec(nTicks);
+
+    for(size_t tick = 0; tick < nTicks; tick++) aboveThresholdVec[tick] = waveform[tick] > threshold;
+
+    std::vector<unsigned char>::iterator aboveItr = std::find(aboveThresholdVec.begin(),aboveThresholdVec.end(),1);
+
+    while(aboveItr != aboveThresholdVec.end())
+    { //runs
+    size_t runStart = std::distance(aboveThresholdVec.begin(),aboveItr);
+    size_t runStop  = std::distance(aboveThresholdVec.begin(),std::find(aboveItr,aboveThresholdVec.end(),0));
+
+    // Include the tick ending the run so the hit gets closed out
+    if (runStop < nTicks) runStop++;
+
+    for( i=runStart;i<runStop;i++)
     { //2
         //std::cout << " i " << i << " waveform " << waveform[i] << std::endl;
         // skip sharp peaks
@@ -218,7 +242,7 @@ void CandHitICARUS::findHitCandidates(const recob::Wire::RegionsOfInterest_t::da
                 rising=0;
                 for(int l=0;l<rise;l++)
                 {
-                    if(i+l<4096) {
+                    if(i+l+1<nTicks) {
                         if(waveform[i+l+1]-waveform[i+l]>0) rising++;
                         else if(waveform[i+l+1]-waveform[i+l]<0) rising--;
                     }
@@ -300,7 +324,12 @@ void CandHitICARUS::findHitCandidates(const recob::Wire::RegionsOfInterest_t::da
                 //        else negpeakwidth=0;
             }
         }
-    } //end loop on samples
+    } //end loop on samples in this run
+
+    aboveItr = std::find(aboveThresholdVec.begin()+runStop,aboveThresholdVec.end(),1);
+    } //end loop on runs
+
+    i = nTicks;
 
     //if we were within a hit while reaching last sample, keep it
     if(iflag==1 && h.hitHeight) //just getting out of the latest hit
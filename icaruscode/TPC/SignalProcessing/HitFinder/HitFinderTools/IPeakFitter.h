@@ -50,6 +50,23 @@ namespace reco_tool
                                         PeakParamsVec&,
                                         double&,
                                         int&) const = 0;
+
+        // Fit all candidate groups from one wire in a single invocation. The
+        // default simply loops over the single group interface above, concrete
+        // tools may override it to share scratch space between the groups
+        virtual void findPeakParametersBatch(const std::vector<float>&                               roiSignalVec,
+                                             const std::vector<ICandidateHitFinder::HitCandidateVec>& hitCandidateGroupVec,
+                                             std::vector<PeakParamsVec>&                              peakParamsGroupVec,
+                                             std::vector<double>&                                     chi2PerNDFVec,
+                                             std::vector<int>&                                        NDFVec) const
+        {
+            peakParamsGroupVec.resize(hitCandidateGroupVec.size());
+            chi2PerNDFVec.resize(hitCandidateGroupVec.size());
+            NDFVec.resize(hitCandidateGroupVec.size());
+
+            for(size_t groupIdx = 0; groupIdx < hitCandidateGroupVec.size(); groupIdx++)
+                findPeakParameters(roiSignalVec, hitCandidateGroupVec[groupIdx], peakParamsGroupVec[groupIdx], chi2PerNDFVec[groupIdx], NDFVec[groupIdx]);
+        }
     };
 }
 
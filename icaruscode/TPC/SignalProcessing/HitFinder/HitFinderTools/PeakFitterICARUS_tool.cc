@@ -16,6 +16,7 @@
 #include <fstream>
 #include "TH1F.h"
 #include "TF1.h"
+#include "TVirtualFitter.h"
 
 namespace reco_tool
 {
@@ -32,16 +33,37 @@ public:
                             PeakParamsVec&,
                             double&,
                             int&) const override;
-    
+
+    void findPeakParametersBatch(const std::vector<float>&,
+                                 const std::vector<ICandidateHitFinder::HitCandidateVec>&,
+                                 std::vector<PeakParamsVec>&,
+                                 std::vector<double>&,
+                                 std::vector<int>&) const override;
+
      static Double_t fitf(Double_t *x, Double_t *par);
-    
+
 private:
+    // Fit one candidate group, assumes fHistogram is already large enough
+    void fitCandidateGroup(const std::vector<float>&,
+                           const ICandidateHitFinder::HitCandidateVec&,
+                           PeakParamsVec&,
+                           double&,
+                           int&) const;
+
+    // Fallback for fits which fail or exhaust the budget: analytic moments
+    // of the candidate windows in place of fitted parameters
+    void setMomentEstimates(const std::vector<float>&,
+                            const ICandidateHitFinder::HitCandidateVec&,
+                            PeakParamsVec&) const;
+
     // Member variables from the fhicl file
     double                   fMinWidth;     ///< minimum initial width for ICARUS fit
     double                   fMaxWidthMult; ///< multiplier for max width for ICARUS fit
     double                   fPeakRange;    ///< set range limits for peak center
     double                   fAmpRange;     ///< set range limit for peak amplitude
-    
+    int                      fMaxFitIterations; ///< iteration budget per candidate group
+    double                   fChi2NDFMax;   ///< fall back to moment estimates above this
+
     mutable TH1F             fHistogram;
     mutable TF1              fFit;          ///< Cache of fit functions (one so far).
     
@@ -59,10 +81,12 @@ PeakFitterICARUS::PeakFitterICARUS(const fhicl::ParameterSet& pset)
 void PeakFitterICARUS::configure(const fhicl::ParameterSet& pset)
 {
     // Start by recovering the parameters
-    fMinWidth     = pset.get<double>("MinWidth",      0.5);
-    fMaxWidthMult = pset.get<double>("MaxWidthMult",  3.);
-    fPeakRange    = pset.get<double>("PeakRangeFact", 2.);
-    fAmpRange     = pset.get<double>("PeakAmpRange",  2.);
+    fMinWidth         = pset.get<double>("MinWidth",         0.5);
+    fMaxWidthMult     = pset.get<double>("MaxWidthMult",     3.);
+    fPeakRange        = pset.get<double>("PeakRangeFact",    2.);
+    fAmpRange         = pset.get<double>("PeakAmpRange",     2.);
+    fMaxFitIterations = pset.get<int>   ("MaxFitIterations", 500);
+    fChi2NDFMax       = pset.get<double>("Chi2NDFMax",       200.);
     
     fHistogram    = TH1F("PeakFitterHitSignal","",500,0.,500.);
     
@@ -85,14 +109,9 @@ void PeakFitterICARUS::findPeakParameters(const std::vector<float>&
     //           the first tick of the input waveform (ie 0)
     //
     if (hitCandidateVec.empty()) return;
-    
-    // in case of a fit failure, set the chi-square to infinity
-    chi2PerNDF = std::numeric_limits<double>::infinity();
-    
-    int startTime = hitCandidateVec.front().startTick;
-    int endTime   = hitCandidateVec.back().stopTick;
-    int roiSize   = endTime - startTime;
-    
+
+    int roiSize = hitCandidateVec.back().stopTick - hitCandidateVec.front().startTick;
+
     // Check to see if we need a bigger histogram for fitting
     if (roiSize > fHistogram.GetNbinsX())
     {
@@ -100,7 +119,65 @@ void PeakFitterICARUS::findPeakParameters(const std::vector<float>&
         fHistogram = TH1F(histName.c_str(),"",roiSize,0.,roiSize);
         fHistogram.Sumw2();
     }
-    
+
+    fitCandidateGroup(roiSignalVec, hitCandidateVec, peakParamsVec, chi2PerNDF, NDF);
+
+    return;
+}
+
+// --------------------------------------------------------------------------------------------
+void PeakFitterICARUS::findPeakParametersBatch(const std::vector<float>&                               roiSignalVec,
+                                               const std::vector<ICandidateHitFinder::HitCandidateVec>& hitCandidateGroupVec,
+                                               std::vector<PeakParamsVec>&                              peakParamsGroupVec,
+                                               std::vector<double>&                                     chi2PerNDFVec,
+                                               std::vector<int>&                                        NDFVec) const
+{
+    peakParamsGroupVec.resize(hitCandidateGroupVec.size());
+    chi2PerNDFVec.resize(hitCandidateGroupVec.size());
+    NDFVec.resize(hitCandidateGroupVec.size());
+
+    // Size the scratch histogram once for the largest group so the groups
+    // of this wire share it without further reallocation
+    int maxRoiSize(0);
+
+    for(const auto& hitCandidateVec : hitCandidateGroupVec)
+    {
+        if (hitCandidateVec.empty()) continue;
+
+        maxRoiSize = std::max(maxRoiSize, int(hitCandidateVec.back().stopTick - hitCandidateVec.front().startTick));
+    }
+
+    if (maxRoiSize > fHistogram.GetNbinsX())
+    {
+        std::string histName = "PeakFitterHitSignal_" + std::to_string(maxRoiSize);
+        fHistogram = TH1F(histName.c_str(),"",maxRoiSize,0.,maxRoiSize);
+        fHistogram.Sumw2();
+    }
+
+    for(size_t groupIdx = 0; groupIdx < hitCandidateGroupVec.size(); groupIdx++)
+    {
+        if (hitCandidateGroupVec[groupIdx].empty()) continue;
+
+        fitCandidateGroup(roiSignalVec, hitCandidateGroupVec[groupIdx], peakParamsGroupVec[groupIdx], chi2PerNDFVec[groupIdx], NDFVec[groupIdx]);
+    }
+
+    return;
+}
+
+// --------------------------------------------------------------------------------------------
+void PeakFitterICARUS::fitCandidateGroup(const std::vector<float>&                   roiSignalVec,
+                                         const ICandidateHitFinder::HitCandidateVec& hitCandidateVec,
+                                         PeakParamsVec&                              peakParamsVec,
+                                         double&                                     chi2PerNDF,
+                                         int&                                        NDF) const
+{
+    // in case of a fit failure, set the chi-square to infinity
+    chi2PerNDF = std::numeric_limits<double>::infinity();
+
+    int startTime = hitCandidateVec.front().startTick;
+    int endTime   = hitCandidateVec.back().stopTick;
+    int roiSize   = endTime - startTime;
+
     for(int idx = 0; idx < roiSize; idx++) fHistogram.SetBinContent(idx+1,roiSignalVec.at(startTime+idx));
     
    // for(int idx = 0; idx < roiSize; idx++)
@@ -141,47 +218,106 @@ void PeakFitterICARUS::findPeakParameters(const std::vector<float>&
     }
     
     int fitResult(-1);
-    
+
+    // bound the time spent on hard fits, the fallback below picks them up
+    TVirtualFitter::SetMaxIterations(fMaxFitIterations);
+
     // the range of the fit does not matter since we specify the fitting range
     // explicitly (we do NOT use option "R")
     try
     { fitResult = fHistogram.Fit(&fFit,"QNWB","", 0., roiSize);}
     catch(...)
     {mf::LogWarning("GausHitFinder") << "Fitter failed finding a hit";}
-    
-   if(fitResult!=0)
-//       std::cout << " fit cannot converge " << std::endl;
-        // ##################################################
-        // ### Getting the fitted parameters from the fit ###
-        // ##################################################
-     NDF        = roiSize-5;
-        chi2PerNDF = (fFit.GetChisquare() / NDF);
-    
- //   std::cout << " chi2 " << fFit.GetChisquare() << std::endl;
-  //  std::cout << " ndf " << NDF << std::endl;
 
-    //      std::cout << " chi2ndf " << chi2PerNDF<< std::endl;
-        //parIdx = 0;
-        for(size_t idx = 0; idx < hitCandidateVec.size(); idx++)
+    NDF        = roiSize-5;
+    chi2PerNDF = (fFit.GetChisquare() / NDF);
+
+    // ##################################################
+    // ### Getting the fitted parameters from the fit ###
+    // ##################################################
+    // A failed or budget limited fit falls back to analytic moment estimates
+    // of the candidate windows so the time per wire stays bounded
+    if (fitResult != 0 || !(chi2PerNDF < fChi2NDFMax))
+    {
+        setMomentEstimates(roiSignalVec, hitCandidateVec, peakParamsVec);
+
+        return;
+    }
+
+    for(size_t idx = 0; idx < hitCandidateVec.size(); idx++)
+    {
+        PeakFitParams_t peakParams;
+
+        peakParams.peakAmplitude      = fFit.GetParameter(1);
+        peakParams.peakAmplitudeError = fFit.GetParError(1);
+        peakParams.peakCenter         = fFit.GetParameter(2) + float(startTime);
+        peakParams.peakCenterError    = fFit.GetParError(2);
+        peakParams.peakTauLeft        = fFit.GetParameter(3);
+        peakParams.peakTauLeftError   = fFit.GetParError(3);
+        peakParams.peakTauRight       = fFit.GetParameter(4);
+        peakParams.peakTauRightError  = fFit.GetParError(4);
+        peakParams.peakBaseline       = fFit.GetParameter(0);
+        peakParams.peakBaselineError  = fFit.GetParError(0);
+
+        peakParamsVec.emplace_back(peakParams);
+    }
+
+    return;
+}
+
+// --------------------------------------------------------------------------------------------
+void PeakFitterICARUS::setMomentEstimates(const std::vector<float>&                   roiSignalVec,
+                                          const ICandidateHitFinder::HitCandidateVec& hitCandidateVec,
+                                          PeakParamsVec&                              peakParamsVec) const
+{
+    for(const auto& candidateHit : hitCandidateVec)
+    {
+        // Zeroth/first/second moments of the candidate window, negative
+        // excursions get no weight
+        double sumWeight(0.);
+        double sumTick(0.);
+        double sumTick2(0.);
+        double peakValue(0.);
+
+        size_t stopTick = std::min(size_t(candidateHit.stopTick), roiSignalVec.size());
+
+        for(size_t tick = candidateHit.startTick; tick < stopTick; tick++)
         {
-            PeakFitParams_t peakParams;
-            
-            peakParams.peakAmplitude      = fFit.GetParameter(1);
-            peakParams.peakAmplitudeError = fFit.GetParError(1);
-            peakParams.peakCenter         = fFit.GetParameter(2) + float(startTime);
-            peakParams.peakCenterError    = fFit.GetParError(2);
-    //std::cout << " rising time " << fFit.GetParameter(3) << " falling time " <<fFit.GetParameter(4) << std::endl;
-            peakParams.peakTauLeft        = fFit.GetParameter(3);
-            peakParams.peakTauLeftError   = fFit.GetParError(3);
-            peakParams.peakTauRight       = fFit.GetParameter(4);
-            peakParams.peakTauRightError  = fFit.GetParError(4);
-            peakParams.peakBaseline       = fFit.GetParameter(0);
-            peakParams.peakBaselineError  = fFit.GetParError(0);
-            
-            peakParamsVec.emplace_back(peakParams);
-            
+            double weight = std::max(double(roiSignalVec[tick]), 0.);
+
+            sumWeight += weight;
+            sumTick   += weight * tick;
+            sumTick2  += weight * tick * tick;
+            peakValue  = std::max(peakValue, weight);
+        }
+
+        double centroid = candidateHit.hitCenter;
+        double rms      = candidateHit.hitSigma;
+
+        if (sumWeight > 0.)
+        {
+            centroid = sumTick / sumWeight;
+            rms      = std::sqrt(std::max(sumTick2 / sumWeight - centroid * centroid, fMinWidth * fMinWidth));
+        }
+        else peakValue = candidateHit.hitHeight;
+
+        PeakFitParams_t peakParams;
+
+        peakParams.peakAmplitude      = peakValue;
+        peakParams.peakAmplitudeError = 0.1 * peakValue;
+        peakParams.peakCenter         = centroid;
+        peakParams.peakCenterError    = sumWeight > 0. ? rms / std::sqrt(sumWeight) : rms;
+        peakParams.peakTauLeft        = rms / 2.;
+        peakParams.peakTauLeftError   = 0.1 * rms;
+        peakParams.peakTauRight       = rms / 2.;
+        peakParams.peakTauRightError  = 0.1 * rms;
+        peakParams.peakBaseline       = 0.;
+        peakParams.peakBaselineError  = 0.;
+
+        peakParamsVec.emplace_back(peakParams);
     }
-    
+
+    return;
 }
 
 Double_t PeakFitterICARUS::fitf(Double_t *x, Double_t *par)
@@ -50,18 +50,16 @@ public:
     virtual void endJob();
     
 private:
-    using RecobHitToPtrMap = std::unordered_map<const recob::Hit*, art::Ptr<recob::Hit>>;
-    
     /**
      *  @brief Create recob::Wire to recob::Hit associations
      */
-    void makeWireAssns(const art::Event&, art::Assns<recob::Wire, recob::Hit>&, RecobHitToPtrMap&) const;
-    
+    void makeWireAssns(const art::Event&, art::Assns<recob::Wire, recob::Hit>&, const std::vector<recob::Hit>&, const art::PtrMaker<recob::Hit>&) const;
+
     /**
      *  @brief Create raw::RawDigit to recob::Hit associations
      */
-    
-    void makeRawDigitAssns(const art::Event&, art::Assns<raw::RawDigit, recob::Hit>&, RecobHitToPtrMap&) const;
+
+    void makeRawDigitAssns(const art::Event&, art::Assns<raw::RawDigit, recob::Hit>&, const std::vector<recob::Hit>&, const art::PtrMaker<recob::Hit>&) const;
     // define vector for hits to make sure of uniform use
     using HitPtrVector = std::vector<art::Ptr<recob::Hit>>;
     
@@ -137,39 +135,63 @@ void HitMerger::produce(art::Event & evt)
     /// Associations with raw digits.
     std::unique_ptr<art::Assns<raw::RawDigit, recob::Hit>> rawDigitAssns(new art::Assns<raw::RawDigit, recob::Hit>);
 
-    RecobHitToPtrMap recobHitToPtrMap;
-    
     // Use this handy art utility to make art::Ptr objects to the new recob::Hits for use in the output phase
     art::PtrMaker<recob::Hit> ptrMaker(evt);
-    
-    // Outside loop over the input hit producers
+
+    // Recover the input collections up front so the output can be preallocated
+    // and the collections merged rather than concatenated
+    std::vector<art::Handle<std::vector<recob::Hit>>> hitHandleVec;
+
+    size_t totalHits(0);
+
     for(const auto& inputTag : HitMergerfHitProducerLabelVec)
     {
-        // Start by looking up the original hits
         art::Handle< std::vector<recob::Hit> > hitHandle;
         evt.getByLabel(inputTag, hitHandle);
-        
-        for(size_t hitIdx = 0; hitIdx < hitHandle->size(); hitIdx++)
+
+        totalHits += hitHandle->size();
+
+        hitHandleVec.emplace_back(std::move(hitHandle));
+    }
+
+    outputHitPtrVec->reserve(totalHits);
+
+    // Each input collection comes out of its hit finder already in channel/time
+    // order, so the merge is a k-way merge over sorted runs: keep a cursor per
+    // input and repeatedly take the lowest (channel, start tick) hit. The number
+    // of producers is small so a linear scan over the cursors beats a heap
+    std::vector<size_t> cursorVec(hitHandleVec.size(), 0);
+
+    while(outputHitPtrVec->size() < totalHits)
+    {
+        int              bestInput(-1);
+        const recob::Hit* bestHit(nullptr);
+
+        for(size_t inputIdx = 0; inputIdx < hitHandleVec.size(); inputIdx++)
         {
-            art::Ptr<recob::Hit> hitPtr(hitHandle,hitIdx);
-            
-            const recob::Hit* hit2D = hitPtr.get();
-            
-            // Create and save the new recob::Hit with the correct WireID
-            outputHitPtrVec->emplace_back(recob::HitCreator(*hit2D, hit2D->WireID()).copy());
-            
-            // Recover a pointer to it...
-            recob::Hit* newHit = &outputHitPtrVec->back();
-            
-            // Create a mapping from this hit to an art Ptr representing it
-            recobHitToPtrMap[newHit] = ptrMaker(outputHitPtrVec->size()-1);
+            if (cursorVec[inputIdx] >= hitHandleVec[inputIdx]->size()) continue;
+
+            const recob::Hit& candidate = (*hitHandleVec[inputIdx])[cursorVec[inputIdx]];
+
+            if (!bestHit || candidate.Channel() < bestHit->Channel() ||
+                (candidate.Channel() == bestHit->Channel() && candidate.StartTick() < bestHit->StartTick()))
+            {
+                bestInput = inputIdx;
+                bestHit   = &candidate;
+            }
         }
+
+        // Create and save the new recob::Hit with the correct WireID
+        outputHitPtrVec->emplace_back(recob::HitCreator(*bestHit, bestHit->WireID()).copy());
+
+        cursorVec[bestInput]++;
     }
-    
-    // Set up to make the associations (if desired)
-    makeWireAssns(evt, *wireAssns, recobHitToPtrMap);
-    
-    makeRawDigitAssns(evt, *rawDigitAssns, recobHitToPtrMap);
+
+    // Set up to make the associations (if desired); the output hits are matched
+    // to wires and raw digits by position index, no pointer lookups involved
+    makeWireAssns(evt, *wireAssns, *outputHitPtrVec, ptrMaker);
+
+    makeRawDigitAssns(evt, *rawDigitAssns, *outputHitPtrVec, ptrMaker);
     
     // Move everything into the event
     evt.put(std::move(outputHitPtrVec));
@@ -179,7 +201,7 @@ void HitMerger::produce(art::Event & evt)
     return;
 }
     
-void HitMerger::makeWireAssns(const art::Event& evt, art::Assns<recob::Wire, recob::Hit>& wireAssns, RecobHitToPtrMap& recobHitPtrMap) const
+void HitMerger::makeWireAssns(const art::Event& evt, art::Assns<recob::Wire, recob::Hit>& wireAssns, const std::vector<recob::Hit>& outputHits, const art::PtrMaker<recob::Hit>& ptrMaker) const
 {
     // Let's make sure the input associations container is empty
     wireAssns = art::Assns<recob::Wire, recob::Hit>();
@@ -206,22 +228,22 @@ void HitMerger::makeWireAssns(const art::Event& evt, art::Assns<recob::Wire, rec
         }
     }
     
-    // Now fill the container
-    for(const auto& hitPtrPair : recobHitPtrMap)
+    // Now fill the container, walking the output hits by index
+    for(size_t hitIdx = 0; hitIdx < outputHits.size(); hitIdx++)
     {
-        raw::ChannelID_t channel = hitPtrPair.first->Channel();
-        
+        raw::ChannelID_t channel = outputHits[hitIdx].Channel();
+
         std::unordered_map<raw::ChannelID_t, art::Ptr<recob::Wire>>::iterator chanWireItr = channelToWireMap.find(channel);
-        
+
         if (!(chanWireItr != channelToWireMap.end())) continue;
-        
-        wireAssns.addSingle(chanWireItr->second, hitPtrPair.second);
+
+        wireAssns.addSingle(chanWireItr->second, ptrMaker(hitIdx));
     }
-    
+
     return;
 }
     
-void HitMerger::makeRawDigitAssns(const art::Event& evt, art::Assns<raw::RawDigit, recob::Hit>& rawDigitAssns, RecobHitToPtrMap& recobHitPtrMap) const
+void HitMerger::makeRawDigitAssns(const art::Event& evt, art::Assns<raw::RawDigit, recob::Hit>& rawDigitAssns, const std::vector<recob::Hit>& outputHits, const art::PtrMaker<recob::Hit>& ptrMaker) const
 {
     // Let's make sure the input associations container is empty
     rawDigitAssns = art::Assns<raw::RawDigit, recob::Hit>();
@@ -248,18 +270,18 @@ void HitMerger::makeRawDigitAssns(const art::Event& evt, art::Assns<raw::RawDigi
         }
     }
     
-    // Now fill the container
-    for(const auto& hitPtrPair : recobHitPtrMap)
+    // Now fill the container, walking the output hits by index
+    for(size_t hitIdx = 0; hitIdx < outputHits.size(); hitIdx++)
     {
-        raw::ChannelID_t channel = hitPtrPair.first->Channel();
-        
+        raw::ChannelID_t channel = outputHits[hitIdx].Channel();
+
         std::unordered_map<raw::ChannelID_t, art::Ptr<raw::RawDigit>>::iterator chanRawDigitItr = channelToRawDigitMap.find(channel);
-        
+
         if (!(chanRawDigitItr != channelToRawDigitMap.end())) continue;
-        
-        rawDigitAssns.addSingle(chanRawDigitItr->second, hitPtrPair.second);
+
+        rawDigitAssns.addSingle(chanRawDigitItr->second, ptrMaker(hitIdx));
     }
-    
+
     return;
 }
     
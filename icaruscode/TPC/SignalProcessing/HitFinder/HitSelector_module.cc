@@ -33,6 +33,9 @@
 #include "lardata/DetectorInfoServices/DetectorPropertiesService.h"
 #include "lardata/DetectorInfoServices/LArPropertiesService.h"
 
+#include "tbb/parallel_for.h"
+#include "tbb/blocked_range.h"
+
 class HitSelector : public art::EDProducer
 {
 public:
@@ -50,7 +53,16 @@ public:
 private:
     // define vector for hits to make sure of uniform use
     using HitPtrVector = std::vector<art::Ptr<recob::Hit>>;
-    
+
+    // index range of hits sharing a snippet - a view into the input collection
+    using SnippetRange    = std::pair<size_t,size_t>;
+    using SnippetRangeVec = std::vector<SnippetRange>;
+
+    // Evaluate the selection for one snippet, setting the per-hit keep flags
+    void selectSnippetHits(const HitPtrVector&   hitPtrVec,
+                           const SnippetRange&   snippetRange,
+                           std::vector<char>&    keepFlagVec) const;
+
     // Fcl parameters.
     art::InputTag      fHitProducerLabel;         ///< The full collection of hits
     std::vector<float> fMinMaxPulseHeighMulti;    ///< Max pulse height of a pulse train must be this large
@@ -154,85 +166,125 @@ void HitSelector::produce(art::Event & evt)
     if (hitHandle.isValid())
     {
         HitPtrVector hitPtrVec;
-        HitPtrVector hitSnippetVec;
-        
+
         art::fill_ptr_vector(hitPtrVec, hitHandle);
 
-        int lastHitIndex = 0;
-        
-        // Loop the hits and make some plots
-        for(const auto& curHitPtr : hitPtrVec)
+        // First pass: recover the snippet boundaries as index ranges into the
+        // input collection - no hits are touched beyond the local index
+        SnippetRangeVec snippetRangeVec;
+
+        size_t snippetStart = 0;
+        int    lastHitIndex = 0;
+
+        for(size_t hitIdx = 0; hitIdx < hitPtrVec.size(); hitIdx++)
         {
-            // Have we collected all of the hits on the same snippet?
-            if (!hitSnippetVec.empty() && lastHitIndex >= curHitPtr->LocalIndex())
+            if (hitIdx > snippetStart && lastHitIndex >= hitPtrVec[hitIdx]->LocalIndex())
             {
-                // Recover plane
-                int plane = hitSnippetVec.front()->WireID().Plane;
-
-                // Only worried about multi hit snippets
-                if (hitSnippetVec.size() > 1)
-                {
-                    // Sort in order of largest to smallest pulse height
-                    std::sort(hitSnippetVec.begin(),hitSnippetVec.end(),[](const auto& left, const auto& right){return left->PeakAmplitude() > right->PeakAmplitude();});
-                    
-                    float maxPulseHeight = hitSnippetVec.front()->PeakAmplitude();
-                    
-                    // Require the largest pulse in the train to be above threshold
-                    if (maxPulseHeight > fMinMaxPulseHeighMulti[plane])
-                    {
-                        // Loop over all hits...
-                        for(size_t idx = 0; idx < hitSnippetVec.size(); idx++)
-                        {
-                            art::Ptr<recob::Hit> hitPtr = hitSnippetVec[idx];
-                            
-                            float pulseHeight = hitPtr->PeakAmplitude();
-                            float pulseWid    = hitPtr->RMS();
-                            int   numDOF      = hitPtr->DegreesOfFreedom();
-                            
-                            // Watch for case of long pulse trains (numDOF == 1) and keep all of these no matter
-                            // Also always keep the largest (first) pulse
-                            // Otherwise, select on minimum pulse height and width
-                            if (idx == 0 || numDOF == 1 || (pulseHeight > fMinPulseHeightMulti[plane] && pulseWid > fMinPulseWidthMulti[plane]))
-                            {
-                                art::Ptr<recob::Wire>   wire      = hitToWireAssns.at(hitPtr.key());
-                                art::Ptr<raw::RawDigit> rawdigits = hitToRawDigitAssns.at(hitPtr.key());
-                                
-                                hcol.emplace_back(*hitPtr, wire, rawdigits);
-                            }
-                        }
-                    }
-                }
-                // Here we handle the case of single hits 
-                else
-                {
-                    art::Ptr<recob::Hit> hitPtr = hitSnippetVec.front();
-                    
-                    float  pulseHeight = hitPtr->PeakAmplitude();
-                    float  pulseWid    = hitPtr->RMS();
-                    
-                    if (pulseHeight > fMinPulseHeightSingle[plane] && pulseWid > fMinPulseWidthSingle[plane])
-                    {
-                        art::Ptr<recob::Wire>   wire      = hitToWireAssns.at(hitPtr.key());
-                        art::Ptr<raw::RawDigit> rawdigits = hitToRawDigitAssns.at(hitPtr.key());
-                        
-                        hcol.emplace_back(*hitPtr, wire, rawdigits);
-                   }
-                }
-                
-                hitSnippetVec.clear();
+                snippetRangeVec.emplace_back(snippetStart, hitIdx);
+                snippetStart = hitIdx;
             }
- 
-            lastHitIndex = curHitPtr->LocalIndex();
-            hitSnippetVec.push_back(curHitPtr);
+
+            lastHitIndex = hitPtrVec[hitIdx]->LocalIndex();
+        }
+
+        if (snippetStart < hitPtrVec.size()) snippetRangeVec.emplace_back(snippetStart, hitPtrVec.size());
+
+        // Second pass: evaluate the selection over blocks of snippets in
+        // parallel, each task only setting its own slice of the keep flags
+        std::vector<char> keepFlagVec(hitPtrVec.size(), 0);
+
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, snippetRangeVec.size()),
+            [&](const tbb::blocked_range<size_t>& range)
+            {
+                for(size_t rangeIdx = range.begin(); rangeIdx < range.end(); rangeIdx++)
+                    selectSnippetHits(hitPtrVec, snippetRangeVec[rangeIdx], keepFlagVec);
+            }
+        );
+
+        // Final pass: commit the selected hits, the only point where the
+        // recob::Hit objects themselves get copied
+        for(size_t hitIdx = 0; hitIdx < hitPtrVec.size(); hitIdx++)
+        {
+            if (!keepFlagVec[hitIdx]) continue;
+
+            const art::Ptr<recob::Hit>& hitPtr = hitPtrVec[hitIdx];
+
+            art::Ptr<recob::Wire>   wire      = hitToWireAssns.at(hitPtr.key());
+            art::Ptr<raw::RawDigit> rawdigits = hitToRawDigitAssns.at(hitPtr.key());
+
+            hcol.emplace_back(*hitPtr, wire, rawdigits);
         }
     }
-    
+
     // put the hit collection and associations into the event
     hcol.put_into(evt);
-    
+
     return;
 }
 
+//----------------------------------------------------------------------------
+/// Evaluate the selection for the hits of one snippet.
+///
+/// Arguments:
+///
+/// hitPtrVec    - the full input hit collection
+/// snippetRange - the index range of the hits sharing this snippet
+/// keepFlagVec  - per-hit keep flags, set for the hits passing the selection
+///
+void HitSelector::selectSnippetHits(const HitPtrVector& hitPtrVec,
+                                    const SnippetRange& snippetRange,
+                                    std::vector<char>&  keepFlagVec) const
+{
+    size_t snippetSize = snippetRange.second - snippetRange.first;
+
+    // Recover plane
+    int plane = hitPtrVec[snippetRange.first]->WireID().Plane;
+
+    // Only worried about multi hit snippets
+    if (snippetSize > 1)
+    {
+        // Find the largest pulse in the train (replaces the by-height sort,
+        // which was only used to recover the largest pulse)
+        size_t maxIdx = snippetRange.first;
+
+        for(size_t idx = snippetRange.first + 1; idx < snippetRange.second; idx++)
+            if (hitPtrVec[idx]->PeakAmplitude() > hitPtrVec[maxIdx]->PeakAmplitude()) maxIdx = idx;
+
+        float maxPulseHeight = hitPtrVec[maxIdx]->PeakAmplitude();
+
+        // Require the largest pulse in the train to be above threshold
+        if (maxPulseHeight > fMinMaxPulseHeighMulti[plane])
+        {
+            // Loop over all hits...
+            for(size_t idx = snippetRange.first; idx < snippetRange.second; idx++)
+            {
+                const art::Ptr<recob::Hit>& hitPtr = hitPtrVec[idx];
+
+                float pulseHeight = hitPtr->PeakAmplitude();
+                float pulseWid    = hitPtr->RMS();
+                int   numDOF      = hitPtr->DegreesOfFreedom();
+
+                // Watch for case of long pulse trains (numDOF == 1) and keep all of these no matter
+                // Also always keep the largest pulse
+                // Otherwise, select on minimum pulse height and width
+                if (idx == maxIdx || numDOF == 1 || (pulseHeight > fMinPulseHeightMulti[plane] && pulseWid > fMinPulseWidthMulti[plane]))
+                    keepFlagVec[idx] = 1;
+            }
+        }
+    }
+    // Here we handle the case of single hits
+    else
+    {
+        const art::Ptr<recob::Hit>& hitPtr = hitPtrVec[snippetRange.first];
+
+        float  pulseHeight = hitPtr->PeakAmplitude();
+        float  pulseWid    = hitPtr->RMS();
+
+        if (pulseHeight > fMinPulseHeightSingle[plane] && pulseWid > fMinPulseWidthSingle[plane])
+            keepFlagVec[snippetRange.first] = 1;
+    }
+}
+
 //----------------------------------------------------------------------------
 /// End job method.
 void HitSelector::endJob()
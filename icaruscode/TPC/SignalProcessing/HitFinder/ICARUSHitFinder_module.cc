@@ -48,8 +48,10 @@
 #include "larcorealg/Geometry/PlaneGeo.h"
 
 #include "larreco/RecoAlg/GausFitCache.h" // hit::GausFitCache
+#include "icaruscode/IcarusObj/ROICensus.h"
 #include "larreco/HitFinder/HitFinderTools/ICandidateHitFinder.h"
 //#include "icaruscode/HitFinder/PeakFitterICARUS.h"
+#include "icaruscode/Utilities/TimeProfiler.h"
 
 //ROOT from CalData
 #include "TComplex.h"
@@ -61,6 +63,13 @@
 #include "TH1D.h"
 #include "TDecompSVD.h"
 #include "TMath.h"
+#include "TROOT.h"
+#include "Math/MinimizerOptions.h"
+
+//TBB, same infrastructure as mtRawDigitFilterICARUS
+#include "tbb/parallel_for.h"
+#include "tbb/blocked_range.h"
+#include "tbb/enumerable_thread_specific.h"
 
 namespace hit {
   /// Customized function cache for ICARUS hit shape.
@@ -130,9 +139,56 @@ namespace hit {
       void endJob(); 
       void reconfigure(fhicl::ParameterSet const& p);
      
-      void expandHit(reco_tool::ICandidateHitFinder::HitCandidate& h, std::vector<float> holder, std::vector<reco_tool::ICandidateHitFinder::HitCandidate> how );
-      void computeBestLocalMean(std::vector<reco_tool::ICandidateHitFinder::HitCandidate> h, std::vector<float> holder, reco_tool::ICandidateHitFinder::MergeHitCandidateVec how, float& localmean);
-      
+      void expandHit(reco_tool::ICandidateHitFinder::HitCandidate& h, std::vector<float> holder, std::vector<reco_tool::ICandidateHitFinder::HitCandidate> how ) const;
+      void computeBestLocalMean(std::vector<reco_tool::ICandidateHitFinder::HitCandidate> h, std::vector<float> holder, reco_tool::ICandidateHitFinder::MergeHitCandidateVec how, float& localmean) const;
+
+      //Everything needed to create and book one hit, staged by the parallel
+      //wire processing and replayed serially into the hit collection
+      struct PendingHit
+      {
+          int    startTick;
+          int    stopTick;
+          float  rms;
+          float  peakTime;
+          float  sigmaPeakTime;
+          float  peakAmplitude;
+          float  sigmaPeakAmplitude;
+          float  hitIntegral;
+          float  hitSigmaIntegral;
+          float  summedADC;
+          int    multiplicity;
+          int    localIndex;
+          float  goodnessOfFit;
+          int    ndf;
+          float  localmean;
+      };
+
+      //Per wire results of the parallel stage, one slot per wire so no
+      //synchronization beyond the parallel_for join is needed
+      struct WireResults
+      {
+          bool                    processed = false; //false for bad channels
+          raw::ChannelID_t        channel;
+          geo::WireID             wid;
+          size_t                  plane;
+          size_t                  cryostat;
+          size_t                  tpc;
+          size_t                  iwire;
+          double                  chi2null;
+          std::vector<float>      widthFillVec;     //entries for fWidthC
+          std::vector<float>      firstChi2FillVec; //entries for fFirstChi2
+          std::vector<float>      chi2FillVec;      //entries for fChi2
+          std::vector<PendingHit> pendingHits;
+      };
+
+      //Candidate finding, merging and fitting for one wire
+      void processWire(size_t wireIter,
+                       art::Handle<std::vector<recob::Wire>> const& wireVecHandle,
+                       art::FindOneP<raw::RawDigit> const& RawDigits,
+                       std::vector<char> const& BadChannelFlags,
+                       WireResults& results) const;
+
+
       using ICARUSPeakFitParams_t = struct ICARUSPeakFitParams
       {
           float peakCenter;
@@ -172,8 +228,6 @@ namespace hit {
        //   std::cout << " setting iwire " << iWire << std::endl;
       } ;
     private:
-      std::vector<double> localmeans;
-      unsigned int  fDataSize;                  //SIZE OF RAW DATA ON ONE WIRE.
       art::InputTag fDigitModuleLabel;          //MODULE THAT MADE DIGITS.
       std::string   fSpillName;                 //NOMINAL SPILL IS AN EMPTY STRING.
 
@@ -183,12 +237,17 @@ namespace hit {
       
       int              fThetaAngle;
        bool                fUncompressWithPed;   //OPTION TO UNCOMPRESS WITH PEDESTAL.
+      bool             fParallelWires;           ///< dispatch the wires over the TBB worker threads
       
       std::unique_ptr<reco_tool::ICandidateHitFinder> fHitFinderTool;  ///< For finding candidate hits
    //  PeakFitterICARUS*         fPeakFitterTool; ///< Perform fit to candidate peaks
       
       size_t              fMaxMultiHit;              ///<maximum hits for multi fit
 double                fChi2NDF;                  ///maximum Chisquared / NDF allowed for a hit to be saved
+      art::InputTag       fROICensusLabel;           ///<ROI census used for admission control (empty: disabled)
+      unsigned int        fMaxROIsForFullFit;        ///<census ROI count above which the fits are skipped
+      unsigned long long  fMaxROITicksForFullFit;    ///<census ROI tick sum above which the fits are skipped
+      bool                fDegradedFit = false;      ///<set per event before the parallel stage, read only inside
       std::vector<int>    fLongMaxHitsVec;           ///<Maximum number hits on a really long pulse train
       std::vector<int>    fLongPulseWidthVec;        ///<Sets width of hits used to describe long pulses
       
@@ -224,13 +283,45 @@ double                fChi2NDF;                  ///maximum Chisquared / NDF all
 
       int iWire;
       
-      mutable ICARUShitFitCache fFitCache; ///< Cached functions for multi-peak fits.
-      mutable ICARUSlongHitFitCache fLongFitCache; ///< Cached functions for long hits.
+      ///< Cached functions for multi-peak fits, one cache per worker thread
+      ///< since a TF1 cannot be shared between concurrent fits
+      mutable tbb::enumerable_thread_specific<ICARUShitFitCache>     fFitCache;
+      mutable tbb::enumerable_thread_specific<ICARUSlongHitFitCache> fLongFitCache; ///< Cached functions for long hits.
       
       const geo::GeometryCore* fGeometry = lar::providerFrom<geo::Geometry>();
      
   }; // class ICARUSHitFinder
 
+  //-------------------------------------------------
+  // TBB functor dispatching the per wire work, same pattern as the
+  // lartbb_* helpers of mtRawDigitFilterICARUS
+  class lartbb_WireProcessing {
+    public:
+      lartbb_WireProcessing(ICARUSHitFinder const& prod,
+                            art::Handle<std::vector<recob::Wire>> const& wireVecHandle,
+                            art::FindOneP<raw::RawDigit> const& rawDigits,
+                            std::vector<char> const& badChannelFlags,
+                            std::vector<ICARUSHitFinder::WireResults>& wireResultsVec)
+        : fProd(prod),
+          fWireVecHandle(wireVecHandle),
+          fRawDigits(rawDigits),
+          fBadChannelFlags(badChannelFlags),
+          fWireResultsVec(wireResultsVec)
+      {}
+
+      void operator()(const tbb::blocked_range<size_t>& range) const
+      {
+          for(size_t wireIter = range.begin(); wireIter < range.end(); wireIter++)
+              fProd.processWire(wireIter, fWireVecHandle, fRawDigits, fBadChannelFlags, fWireResultsVec[wireIter]);
+      }
+
+    private:
+      ICARUSHitFinder const&                               fProd;
+      art::Handle<std::vector<recob::Wire>> const&         fWireVecHandle;
+      art::FindOneP<raw::RawDigit> const&                  fRawDigits;
+      std::vector<char> const&                             fBadChannelFlags;
+      std::vector<ICARUSHitFinder::WireResults>&           fWireResultsVec;
+  };
 
   //-------------------------------------------------
   ICARUSHitFinder::ICARUSHitFinder(fhicl::ParameterSet const& pset) : EDProducer{pset}
@@ -254,7 +345,11 @@ double                fChi2NDF;                  ///maximum Chisquared / NDF all
       fChi2NDF           = p.get< double          >("Chi2NDF");
     fLongPulseWidthVec = p.get< std::vector<int>>("LongPulseWidth", std::vector<int>() = {16,16,16});
           fLongMaxHitsVec    = p.get< std::vector<int>>("LongMaxHits",    std::vector<int>() = {25,25,25});
+      fROICensusLabel        = p.get< art::InputTag      >("ROICensusLabel", art::InputTag());
+      fMaxROIsForFullFit     = p.get< unsigned int       >("MaxROIsForFullFit",     1000000);
+      fMaxROITicksForFullFit = p.get< unsigned long long >("MaxROITicksForFullFit", 1000000000);
       fThetaAngle=p.get< double  >("ThetaAngle");
+      fParallelWires=p.get< bool >("ParallelWires", false);
       fMinWidth=p.get< double  >("MinWidth");
       fMaxWidthMult=p.get< double  >("MaxWidthMult");
       fFittingRange=p.get< int >("FittingRange");
@@ -270,6 +365,14 @@ double                fChi2NDF;                  ///maximum Chisquared / NDF all
   //-------------------------------------------------
   void ICARUSHitFinder::beginJob()
   {
+      if (fParallelWires)
+      {
+          // concurrent TH1::Fit needs the thread safe ROOT state and the
+          // re-entrant Minuit2 minimizer (TMinuit keeps global state)
+          ROOT::EnableThreadSafety();
+          ROOT::Math::MinimizerOptions::SetDefaultMinimizer("Minuit2");
+      }
+
       // get access to the TFile service
       art::ServiceHandle<art::TFileService> tfs;
       
@@ -320,17 +423,12 @@ double                fChi2NDF;                  ///maximum Chisquared / NDF all
   //-------------------------------------------------
   void ICARUSHitFinder::produce(art::Event& evt)
     {
-      
-      //0
-      //return;
-      
+      // Scoped timing probe, inert unless the TimeProfiler service is enabled
+      auto& profiler = *art::ServiceHandle<icarus::ns::util::TimeProfiler>();
+      auto produceProbe = profiler.probe("ICARUSHitFinder:produce");
+
       std::ofstream output("areaFit.out");
 
-  //    std::cout << " ICARUSHitFinder produce " << std::endl;
-      
-    //GET THE GEOMETRY.
-    art::ServiceHandle<geo::Geometry> geom;
-      
       // ###############################################
       // ### Making a ptr vector to put on the event ###
       // ###############################################
@@ -340,8 +438,6 @@ double                fChi2NDF;                  ///maximum Chisquared / NDF all
       // Handle the filtered hits collection...
       recob::HitCollectionCreator  hcol(evt);
 
-      //    if (fAllHitsInstanceName != "") filteredHitCol = &hcol;
-      
       // ##########################################
       // ### Reading in the Wire List object(s) ###
       // ##########################################
@@ -353,24 +449,30 @@ double                fChi2NDF;                  ///maximum Chisquared / NDF all
       // #################################################################
       art::FindOneP<raw::RawDigit> RawDigits
       (wireVecHandle, evt, fCalDataModuleLabel);
-      
-      // Channel Number
-      raw::ChannelID_t channel = raw::InvalidChannelID;
-      
-      
-      std::vector<float> holder;      //HOLDS SIGNAL DATA.
-      std::vector<short> rawadc;      //UNCOMPRESSED ADC VALUES.
-      
-      std::vector<float> startTimes;  //STORES TIME OF WINDOW START.
-      std::vector<float> maxTimes;    //STORES TIME OF LOCAL MAXIMUM.
-      std::vector<float> endTimes;    //STORES TIME OF WINDOW END.
-      std::vector<float> peakHeight;  //STORES ADC COUNT AT THE MAXIMUM.
-      std::vector<float> hitrms;    	 //STORES CHARGE WEIGHTED RMS OF TIME ACROSS THE HIT.
-      std::vector<double> charge;     //STORES THE TOTAL CHARGE ASSOCIATED WITH THE HIT.
-      
-      // geo::SigType_t sigType = geo::kInduction;
-      std::stringstream numConv;
-      
+
+      // ### Admission control: the ROI census written upstream measures   ###
+      // ### the complexity of this event before any fitting is attempted. ###
+      // ### A pathological event (beam splash) above the configured       ###
+      // ### budget gets the bounded degraded treatment instead of         ###
+      // ### stalling the batch on the fits                                ###
+      fDegradedFit = false;
+
+      if (!fROICensusLabel.empty())
+      {
+          art::Handle<icarus::ROICensus> censusHandle;
+
+          if (evt.getByLabel(fROICensusLabel, censusHandle))
+          {
+              if (censusHandle->nROIs() > fMaxROIsForFullFit || censusHandle->nTicks() > fMaxROITicksForFullFit)
+              {
+                  mf::LogWarning("ICARUSHitFinder") << "Event exceeds the complexity budget (" << censusHandle->nROIs()
+                      << " ROIs, " << censusHandle->nTicks() << " ticks): skipping the hit fits for this event";
+
+                  fDegradedFit = true;
+              }
+          }
+      }
+
       unsigned int hwC(0),lwC(5728); //lowest and highest wire with physical deposition in Collection
       unsigned int hwI2(0),lwI2(5728); //same for Induction
       unsigned int hwI1(0),lwI1(2112);
@@ -407,53 +509,219 @@ double                fChi2NDF;                  ///maximum Chisquared / NDF all
 
       lariov::ChannelStatusProvider::ChannelSet_t const BadChannels
         = channelStatus.BadChannels();
- 
+
+      //FLATTEN THE STATUSES INTO A PER CHANNEL ARRAY, ONCE PER EVENT:
+      //THE WIRE LOOP THEN TESTS A CHANNEL WITH A SINGLE INDEXED LOAD
+      //INSTEAD OF SCANNING THE BAD CHANNEL SET
+      std::vector<char> BadChannelFlags(fGeometry->Nchannels(), 0);
+      for(raw::ChannelID_t badChannel : BadChannels)
+          if(badChannel < BadChannelFlags.size()) BadChannelFlags[badChannel] = 1;
+
       unsigned int minWireI2=2539; //empirical
       unsigned int maxWireI2=4700;
       unsigned int minDrift=850;
       unsigned int maxDrift=1500;
       
-      //### Looping over the wires ###
-      //##############################
-      for(size_t wireIter = 0; wireIter < wireVecHandle->size(); wireIter++)
+      // ### Stage one: candidate finding, merging and fitting per wire. ###
+      // ### Each wire writes only its own slot so the wires can be      ###
+      // ### dispatched over the TBB worker threads                      ###
+      std::vector<WireResults> wireResultsVec(wireVecHandle->size());
+
+      lartbb_WireProcessing wireProcessing(*this, wireVecHandle, RawDigits, BadChannelFlags, wireResultsVec);
+
       {
-          // ####################################
-          // ### Getting this particular wire ###
-          // ####################################
+          auto probe = profiler.probe("ICARUSHitFinder:wireProcessing");
+          if (fParallelWires)
+              tbb::parallel_for(tbb::blocked_range<size_t>(0, wireVecHandle->size()), wireProcessing);
+          else
+              wireProcessing(tbb::blocked_range<size_t>(0, wireVecHandle->size()));
+      }
+
+      // ### Stage two: replay the staged results in wire order so the   ###
+      // ### output collection and the diagnostics do not depend on the  ###
+      // ### scheduling of stage one                                     ###
+      for(size_t wireIter = 0; wireIter < wireResultsVec.size(); wireIter++)
+      {
+          const WireResults& results = wireResultsVec[wireIter];
+
+          size_t plane = results.plane;
+          size_t iwire = results.iwire;
+
+          if(plane==0&&iwire<lwI1) lwI1=iwire;
+          if(plane==0&&iwire>hwI1) hwI1=iwire;
+          if(plane==1&&iwire<lwI2) lwI2=iwire;
+          if(plane==1&&iwire>hwI2) hwI2=iwire;
+          if(plane==2&&iwire<lwC) lwC=iwire;
+          if(plane==2&&iwire>hwC) hwC=iwire;
+
+          if(!results.processed) continue;
+
+          size_t cryostat=results.cryostat;
+          size_t tpc=results.tpc;
+          size_t iWire=iwire;
+
           art::Ptr<recob::Wire>   wire(wireVecHandle, wireIter);
           art::Ptr<raw::RawDigit> rawdigits = RawDigits.at(wireIter);
-          
-          // --- Setting Channel Number and Signal type ---
-          channel = wire->Channel();
-          
-          std::vector<float> signal(wire->Signal());
 
-          
-          // get the WireID for this hit
-          std::vector<geo::WireID> wids = geom->ChannelToWire(channel);
-          // for now, just take the first option returned from ChannelToWire
-          geo::WireID wid  = wids[0];
-          // We need to know the plane to look up parameters
-          geo::PlaneID::PlaneID_t plane = wid.Plane;
-          size_t cryostat=wid.Cryostat;
-          size_t tpc=wid.TPC;
-          size_t iWire=wid.Wire;
+          fNullChi2->Fill(results.chi2null);
+
+          for(const auto& width : results.widthFillVec)    fWidthC->Fill(width);
+          for(const auto& chi2 : results.firstChi2FillVec) fFirstChi2->Fill(chi2);
+          for(const auto& chi2 : results.chi2FillVec)      fChi2->Fill(chi2);
+
+          int nghC=0;
+          int nghI2=0;
+          int nghI1=0;
+
+          for(const auto& pendingHit : results.pendingHits)
+          {
+              recob::HitCreator hit(
+                  *wire,                              //RAW DIGIT REFERENCE.
+                  results.wid,                        //WIRE ID.
+                  pendingHit.startTick,               //START TICK.
+                  pendingHit.stopTick,                //END TICK.
+                  pendingHit.rms,                     //RMS.
+                  pendingHit.peakTime,                //PEAK_TIME.
+                  pendingHit.sigmaPeakTime,           //SIGMA_PEAK_TIME.
+                  pendingHit.peakAmplitude,           //PEAK_AMPLITUDE.
+                  pendingHit.sigmaPeakAmplitude,      //SIGMA_PEAK_AMPLITUDE.
+                  pendingHit.hitIntegral,             //HIT_INTEGRAL.
+                  pendingHit.hitSigmaIntegral,        //HIT_SIGMA_INTEGRAL.
+                  pendingHit.summedADC,               //SUMMED CHARGE.
+                  pendingHit.multiplicity,            //MULTIPLICITY.
+                  pendingHit.localIndex,              //LOCAL_INDEX.
+                  pendingHit.goodnessOfFit,           //WIRE ID.
+                  pendingHit.ndf                      //DEGREES OF FREEDOM.
+                  );
+
+              hcol.emplace_back(hit.move(), wire, rawdigits);
+
+              if(plane==2)
+              {
+                  fBaselineC->Fill(pendingHit.localmean);
+
+           bool wireWindowC=iWire>=minWireC&&iWire<=maxWireC;
+           bool outWireWindowC=iWire<=minWireC||iWire>=maxWireC;
+
+           if(wireWindowC) {
+           nghC++;
+           if(nghC==1) nw1hitC++;
+           nhWire[iWire]++;
+           fHeightC->Fill(pendingHit.peakAmplitude);
+           wCharge[iWire]+=pendingHit.hitIntegral;
+           wInt[iWire]+=pendingHit.summedADC;
+           }
+           
+
+          nhitsC++;
+           
+
+           if(tpc==0&&cryostat==0&&outWireWindowC) {
+           nnhitsC++; fNoiseC->Fill(pendingHit.peakAmplitude); }
+           
+           
+           
+           if(cryostat==0&&tpc==0)
+           if(wCharge[iwire]>0)
+           fAreaC->Fill(wCharge[iwire]);
+           if(cryostat==0&&tpc==0)
+           if(wInt[iwire]>0)
+           fIntegralC->Fill(wInt[iwire]);
+           if(cryostat==0&&tpc==0)
+           if(wCharge[iwire]>0)
+           output << iwire << " " <<wInt[iwire] << std::endl;
+           if(wInt[iwire]>0&&cryostat==0&&tpc==0)
+           fAreaInt->Fill(wCharge[iwire]/wInt[iwire]);
+              } //COLLECTION
+              else
+              {
+           bool driftWindow=pendingHit.peakTime>=minDrift&&pendingHit.peakTime<=maxDrift;
+           bool wireWindowI2=iWire>=minWireI2&&iWire<=maxWireI2;
+           bool outDriftWindow=pendingHit.peakTime<=minDrift||pendingHit.peakTime>=maxDrift;
+           bool outWireWindowI2=iWire<=minWireI2||iWire>=maxWireI2;
+           
+           
+           if(plane==0&&driftWindow)  {
+           nghI1++;
+           if(nghI1==1) nw1hitI1++;
+           
+           fHeightI1->Fill(pendingHit.peakAmplitude);
+           fWidthI1->Fill(pendingHit.rms);
+           }
+           if(plane==1&&wireWindowI2) {
+           nghI2++;
+           if(nghI2==1) nw1hitI2++;
+           fHeightI2->Fill(pendingHit.peakAmplitude);
+           fWidthI2->Fill(pendingHit.rms);
+           }
+
+           
+           if(plane==0) nhitsI1++;
+           if(plane==1) nhitsI2++;
+           
+           if(plane==0&&tpc==0&&cryostat==0&&outDriftWindow) {nnhitsI1++; fNoiseI1->Fill(pendingHit.peakAmplitude); }
+           if(plane==1&&tpc==0&&cryostat==0&&outWireWindowI2) { nnhitsI2++; fNoiseI2->Fill(pendingHit.peakAmplitude); }
+              } //INDUCTION
+           
+          } //loop on pending hits
+
+    } //end loop on channels
 
+      for(unsigned int jw=minWireC;jw<maxWireC;jw++)
+          fnhwC->Fill(nhWire[jw]);
+      
+      
+    hcol.put_into(evt);
+   
+      
+  } //end produce
+
+  //-------------------------------------------------
+  void ICARUSHitFinder::processWire(size_t wireIter,
+                                    art::Handle<std::vector<recob::Wire>> const& wireVecHandle,
+                                    art::FindOneP<raw::RawDigit> const& RawDigits,
+                                    std::vector<char> const& BadChannelFlags,
+                                    WireResults& results) const
+  {
+      // ####################################
+      // ### Getting this particular wire ###
+      // ####################################
+      art::Ptr<recob::Wire>   wire(wireVecHandle, wireIter);
+      art::Ptr<raw::RawDigit> rawdigits = RawDigits.at(wireIter);
+      
+      // --- Setting Channel Number and Signal type ---
+      raw::ChannelID_t channel = wire->Channel();
+      
+      std::vector<float> signal(wire->Signal());
 
-      holder.clear();
-          localmeans.clear();
+      
+      // get the WireID for this hit
+      std::vector<geo::WireID> wids = fGeometry->ChannelToWire(channel);
+      // for now, just take the first option returned from ChannelToWire
+      geo::WireID wid  = wids[0];
+      // We need to know the plane to look up parameters
+      geo::PlaneID::PlaneID_t plane = wid.Plane;
+
+      results.wid      = wid;
+      results.plane    = plane;
+      results.cryostat = wid.Cryostat;
+      results.tpc      = wid.TPC;
+      results.iwire    = wid.Wire;
+
+      size_t iwire = results.iwire;
+
+      std::vector<float>  holder;      //HOLDS SIGNAL DATA.
+      std::vector<short>  rawadc;      //UNCOMPRESSED ADC VALUES.
+      std::vector<double> localmeans;
 
       //GET THE REFERENCE TO THE CURRENT raw::RawDigit.
       channel   = rawdigits->Channel();
-      fDataSize = rawdigits->Samples();
+      unsigned int dataSize = rawdigits->Samples();
 
-        std::vector<geo::WireID> widVec = geom->ChannelToWire(channel);
-        size_t                   iwire  = widVec[0].Wire;
-     //   size_t plane = widVec[0].Plane;
+      results.channel = channel;
 
-        
-      rawadc.resize(fDataSize);
-      holder.resize(fDataSize);
+      rawadc.resize(dataSize);
+      holder.resize(dataSize);
 
       //UNCOMPRESS THE DATA.
       if (fUncompressWithPed) {
@@ -466,99 +734,45 @@ double                fChi2NDF;                  ///maximum Chisquared / NDF all
       
       mf::LogDebug("ICARUSHitFinder")  << " pedestal " <<rawdigits->GetPedestal() << std::endl;
 
-      for(unsigned int bin = 0; bin < fDataSize; ++bin){ 
-        //holder[bin]=(rawadc[bin]-rawdigits->GetPedestal());
+      for(unsigned int bin = 0; bin < dataSize; ++bin){ 
           holder[bin]=signal[bin];
           
-          //std::cout << " bin " << bin << " rawadc " << rawadc[bin]-rawdigits->GetPedestal() << " signal " << signal[bin] << std::endl;
           if(plane == 0) holder[bin]=-holder[bin];
-          //if(plane == 1) holder[bin]=-holder[bin];
-        // if(plane==2&&iwire==2600) std::cout << " wire 2600 bin " << bin << " signal " << holder[bin] << std::endl;
       }
 
-        if(plane==0&&iwire<lwI1) lwI1=iwire;
-        if(plane==0&&iwire>hwI1) hwI1=iwire;
-        if(plane==1&&iwire<lwI2) lwI2=iwire;
-        if(plane==1&&iwire>hwI2) hwI2=iwire;
-        if(plane==2&&iwire<lwC) lwC=iwire;
-        if(plane==2&&iwire>hwC) hwC=iwire;
-        
-        
-        
-     // sigType = geom->SignalType(channel);
-
-      peakHeight.clear();
-      endTimes.clear();
-      startTimes.clear();
-      maxTimes.clear();
-      charge.clear();
-      hitrms.clear();
-        
-             bool channelSwitch = false;
+      bool channelSwitch = channel < BadChannelFlags.size() && BadChannelFlags[channel];
 
-      for(auto it = BadChannels.begin(); it != BadChannels.end(); it++)
-      {
-        if(channel==*it)
-        {
-          channelSwitch = true;
-          break;
-        }
-      }
+      if(channelSwitch) return;
 
-      if(channelSwitch==false)
-      { //1
+      results.processed = true;
           
-          // Hit finding parameters
-         double  chargeErr(0);   //CHI2/NDF and error on charge.
-     // double hrms(0);
-      //double totSig;
+      // Hit finding parameters
+      double  chargeErr(0);   //CHI2/NDF and error on charge.
      
-          double chi2null=ComputeNullChiSquare(holder);
-//          std::cout << " wire " << iWire << " chi2null " << chi2null << std::endl;
-          fNullChi2->Fill(chi2null);
+      results.chi2null = ComputeNullChiSquare(holder);
 
-
-    
       reco_tool::ICandidateHitFinder::HitCandidateVec      hitCandidateVec;
 
       reco_tool::ICandidateHitFinder::MergeHitCandidateVec mergedCandidateHitVec;
           
-    std::vector<geo::WireID> wids = geom->ChannelToWire(channel);
-          
-          std::vector<float> tempVec = holder;
-          recob::Wire::RegionsOfInterest_t::datarange_t rangeData(size_t(0),std::move(tempVec));
+      std::vector<float> tempVec = holder;
+      recob::Wire::RegionsOfInterest_t::datarange_t rangeData(size_t(0),std::move(tempVec));
           
-          fHitFinderTool->findHitCandidates(rangeData, 0,channel,0,hitCandidateVec);
-          //int jc=0;
-          for(auto& hitCand : hitCandidateVec) {
-            expandHit(hitCand,holder,hitCandidateVec);
-        
-          }
-          
-          
-          
-          fHitFinderTool->MergeHitCandidates(rangeData, hitCandidateVec, mergedCandidateHitVec);
-
-      //numHits = hits.size();
-          int nghC=0;
-          int nghI2=0;
-          int nghI1=0;
-          
-   //     if(plane==0)
-      //  std::cout << " plane " << plane << " Wire " << iwire << " numhits " << hitCandidateVec.size() <<" mergedhits " << mergedCandidateHitVec.size() << std::endl;
+      fHitFinderTool->findHitCandidates(rangeData, 0,channel,0,hitCandidateVec);
+      for(auto& hitCand : hitCandidateVec) {
+        expandHit(hitCand,holder,hitCandidateVec);
+      }
           
+      fHitFinderTool->MergeHitCandidates(rangeData, hitCandidateVec, mergedCandidateHitVec);
           
      //FIT ONLY COLLECTION HITS
     if(plane==2) {
-        //std::cout << " mergedcands size " << mergedCandidateHitVec.size() << std::endl;
         
           for(auto& mergedCands : mergedCandidateHitVec)
           {
        
-
          int startT= mergedCands.front().startTick-fFittingRange;
          int endT  = mergedCands.back().stopTick+fFittingRange;
-         //std::cout << " fitting range " << fFittingRange << std::endl;
               
               float mean;
               computeBestLocalMean(mergedCands,holder,mergedCandidateHitVec,mean);
@@ -568,7 +782,7 @@ double                fChi2NDF;                  ///maximum Chisquared / NDF all
           // ### In the end, this primarily catches the case where ###
           // ### a fake pulse is at the start of the ROI           ###
           if (endT - startT < 5) continue;
-          fWidthC->Fill(endT-startT);
+          results.widthFillVec.push_back(endT-startT);
           // #######################################################
           // ### Clearing the parameter vector for the new pulse ###
           // #######################################################
@@ -587,13 +801,34 @@ double                fChi2NDF;                  ///maximum Chisquared / NDF all
           ICARUSPeakParamsVec peakParamsVec(npk);
           peakParamsVec.clear();
           int islong=0;
-          if (mergedCands.size() <= fMaxMultiHit)
+          if (fDegradedFit)
+          {
+              // Admission control tripped: the (unbounded) Minuit fits are
+              // skipped and the hits are taken directly from the candidate
+              // finder parameters. Degraded but bounded: the cost is linear
+              // in the number of candidates
+              for(const auto& candidateHit : mergedCands)
+              {
+                  ICARUSPeakFitParams_t peakParams{};
+
+                  peakParams.peakCenter         = candidateHit.hitCenter;
+                  peakParams.peakCenterError    = candidateHit.hitSigma;
+                  peakParams.peakSigma          = candidateHit.hitSigma;
+                  peakParams.peakAmplitude      = candidateHit.hitHeight;
+                  peakParams.peakAmplitudeError = candidateHit.hitHeight;
+                  peakParams.peakTauLeft        = candidateHit.hitSigma;
+                  peakParams.peakTauRight       = candidateHit.hitSigma;
+
+                  peakParamsVec.push_back(peakParams);
+              }
+
+              // Marks the hits as unfitted and keeps the long refit below off
+              chi2PerNDF = fChi2NDF;
+              NDF        = 1;
+          }
+          else if (mergedCands.size() <= fMaxMultiHit)
           {
               
-             // std::cout << "setting iwire " << iwire << std::endl;
-             // fPeakFitterTool->setWire(iwire);
-            //  std::cout << " fitting iwire " << iwire << std::endl;
-             // std::cout << " cryostat " << cryostat << " tpc " << tpc << " plane " << plane << " wire " << iwire << std::endl;
         findMultiPeakParameters(signal, mergedCands, peakParamsVec, chi2PerNDF, NDF, iwire);
 
           if (!(chi2PerNDF < std::numeric_limits<double>::infinity()))
@@ -601,40 +836,26 @@ double                fChi2NDF;                  ///maximum Chisquared / NDF all
               chi2PerNDF = 200.;
               NDF        = 2;
           }
-          fFirstChi2->Fill(chi2PerNDF);
-            //  std::cout << " wire " << iwire << " first chi2NDF " << chi2PerNDF << std::endl;
+          results.firstChi2FillVec.push_back(chi2PerNDF);
           }
 
-         // std::cout << " before longpulse chi2 " << chi2PerNDF << " threshold " << fChi2NDF << std::endl;
           if (chi2PerNDF < 10.)
-              fChi2->Fill(chi2PerNDF);
-       //   if(chi2PerNDF<0.1)      // change from 10 to reduce output
-         //     std::cout << " wire " << iwire << " SMALL chi2NDF " << chi2PerNDF << " thr chi2NDF " << fChi2NDF << std::endl;
+              results.chi2FillVec.push_back(chi2PerNDF);
           ICARUSPeakParamsVec peakParamsLong(npk);
           peakParamsLong.clear();
           if (chi2PerNDF > fChi2NDF)
           {
               islong=1;
               findLongPeakParameters(signal, mergedCands, peakParamsLong, chi2Long, NDF, iwire);
-          //    if(chi2Long<0.3) std::cout << " small chi2long " << chi2Long << std::endl;
               if(chi2Long<chi2PerNDF&&chi2Long>0.1) {
-                  fChi2->Fill(chi2Long);
+                  results.chi2FillVec.push_back(chi2Long);
                   peakParamsVec=peakParamsLong;
               }
-              else { fChi2->Fill(chi2PerNDF);
-          //    if(chi2PerNDF<0.1)      // change from 10 to reduce output
-           //       std::cout << " wire " << iwire << " SMALLSMALL chi2NDF " << chi2PerNDF << " thr chi2NDF " << fChi2NDF << std::endl;
+              else results.chi2FillVec.push_back(chi2PerNDF);
           }
-          }
-          
-         // unsigned int jhit=0;
           
-              //std::cout << " before peak loop" << std::endl;
-         // for(const auto& peakParams : peakParamsVec)
 for(unsigned int jhit=0;jhit<mergedCands.size(); jhit++) 
          {
-              //float fitCharge=chargeFunc(peakMean, peakAmp, peakWidth, fAreaNormsVec[plane],startT,endT);
-              //float fitChargeErr = std::sqrt(TMath::Pi()) * (peakAmpErr*peakWidthErr + peakWidthErr*peakAmpErr);
               unsigned int startInt=mergedCands[jhit].startTick-fIntegratingRange;
               unsigned int endInt=mergedCands[jhit].stopTick+fIntegratingRange;
  
@@ -646,8 +867,7 @@ for(unsigned int jhit=0;jhit<mergedCands.size(); jhit++)
               float peakSlope=0, peakFitWidth=0;
               float peakMeanErr, peakAmpErr;
               if(!islong) {
-                // TF1 Func("ICARUSfunc",fitf,start,end,1+5*mergedCands.size());
-                TF1& Func = *(fFitCache.Get(mergedCands.size()));
+                TF1& Func = *(fFitCache.local().Get(mergedCands.size()));
                 assert(&Func);
                 Func.SetParameter(0, mergedCands.size());
                 
@@ -658,7 +878,6 @@ for(unsigned int jhit=0;jhit<mergedCands.size(); jhit++)
               // Extract values for this FITTED peak
                peakAmp   = peakParams.peakAmplitude;
                peakMean  = peakParams.peakCenter;
-              //float peakWidth = peakParams.peakSigma;
                peakLeft   = peakParams.peakTauLeft;
                peakRight  = peakParams.peakTauRight;
                peakBaseline = peakParams.peakBaseline;
@@ -667,14 +886,12 @@ for(unsigned int jhit=0;jhit<mergedCands.size(); jhit++)
               // Place one bit of protection here
               if (std::isnan(peakAmp))
               {
-                //  std::cout << "**** hit peak amplitude is a nan! Channel: " << channel << ", start tick: " << startT << std::endl;
                   continue;
               }
               
               // Extract errors
                peakAmpErr   = peakParams.peakAmplitudeError;
               peakMeanErr  = peakParams.peakCenterError;
-            //  float peakWidthErr = peakParams.peakSigmaError;
                   Func.SetParameter(1+5*jhit,peakBaseline);
                   Func.SetParameter(2+5*jhit,peakAmp);
                   Func.SetParameter(3+5*jhit,peakMean);
@@ -694,8 +911,7 @@ for(unsigned int jhit=0;jhit<mergedCands.size(); jhit++)
                 }
               }
               else {
-                  // TF1 FuncLong("ICARUSfuncLong",fitlong,start,end,1+7*mergedCands.size());
-                  TF1& FuncLong = *(fLongFitCache.Get(mergedCands.size()));
+                  TF1& FuncLong = *(fLongFitCache.local().Get(mergedCands.size()));
                   assert(&FuncLong);
                   FuncLong.SetParameter(0, mergedCands.size());
 
@@ -707,7 +923,6 @@ for(unsigned int jhit=0;jhit<mergedCands.size(); jhit++)
               // Extract values for this FITTED peak
                peakAmp   = peakParams.peakAmplitude;
                peakMean  = peakParams.peakCenter;
-              //float peakWidth = peakParams.peakSigma;
                peakLeft   = peakParams.peakTauLeft;
                peakRight  = peakParams.peakTauRight;
                peakBaseline = peakParams.peakBaseline;
@@ -726,7 +941,6 @@ for(unsigned int jhit=0;jhit<mergedCands.size(); jhit++)
 
                   try
                   { fitCharge=FuncLong.Integral(startInt,endInt)-(endInt-startInt)*localmeans[jhit];
-                      //fitCharge=FuncLong.Integral(start-35,end+35);
                   }
                   catch(...)
                   {mf::LogWarning("ICARUSHitFinder") << "Icarus numerical integration failed";
@@ -735,164 +949,69 @@ for(unsigned int jhit=0;jhit<mergedCands.size(); jhit++)
               }
               if(isnan(fitCharge)&&!islong) fitCharge=std::accumulate(holder.begin() + (int) startInt, holder.begin() + (int) endInt, 0.);
               if(isnan(fitCharge)&&islong) fitCharge=std::accumulate(holder.begin() + (int) startInt, holder.begin() + (int) endInt, 0.);
-              //Func.Integral(start,end);
               
-             // float totSig20=std::accumulate(holder.begin() + (int) start-35, holder.begin() + (int) end+35, 0.);
-
               float totSig=std::accumulate(holder.begin()+ (int) startInt, holder.begin()+ (int) endInt, 0.)-(endInt-startInt)*localmeans[jhit];
-              fBaselineC->Fill(localmeans[jhit]);
-         //     float fitChargeErr=0;
-            //  if(plane==2&&iWire==2842)
 
-             
-
-//std::cout << " before hit creator " << std::endl;
-        recob::HitCreator hit(
-            *wire,                                                                     //RAW DIGIT REFERENCE.
-            wid,                                                                           //WIRE ID.
-            startInt,                                                                         //START TICK.
-            endInt,                                                                           //END TICK. 
-            (peakLeft+peakRight)/2.,                                                                          //RMS.
-            peakMean,                                                                      //PEAK_TIME.
-            peakMeanErr,                                                                   //SIGMA_PEAK_TIME.
-            peakAmp,                                                                     //PEAK_AMPLITUDE.
-            peakAmpErr,                                                                  //SIGMA_PEAK_AMPLITUDE.
-            fitCharge,                                                                        //HIT_INTEGRAL.
-            chargeErr,                                                                     //HIT_SIGMA_INTEGRAL.
-            totSig, //SUMMED CHARGE.
-            nGausForFit,                                                                             //MULTIPLICITY.
-            jhit,                                                                            //LOCAL_INDEX.
-            chi2PerNDF,                                                                 //WIRE ID.
-            NDF                                                               //DEGREES OF FREEDOM.
-            );
+              PendingHit pendingHit;
+
+              pendingHit.startTick          = startInt;
+              pendingHit.stopTick           = endInt;
+              pendingHit.rms                = (peakLeft+peakRight)/2.;
+              pendingHit.peakTime           = peakMean;
+              pendingHit.sigmaPeakTime      = peakMeanErr;
+              pendingHit.peakAmplitude      = peakAmp;
+              pendingHit.sigmaPeakAmplitude = peakAmpErr;
+              pendingHit.hitIntegral        = fitCharge;
+              pendingHit.hitSigmaIntegral   = chargeErr;
+              pendingHit.summedADC          = totSig;
+              pendingHit.multiplicity       = nGausForFit;
+              pendingHit.localIndex         = jhit;
+              pendingHit.goodnessOfFit      = chi2PerNDF;
+              pendingHit.ndf                = NDF;
+              pendingHit.localmean          = localmeans[jhit];
               
               mf::LogDebug("ICARUSHitFinder") << " fitcharge " << fitCharge << " totSig " << totSig << std::endl;
-              //std::cout << " summedADC " << hit.summedADC() << " integral " << hit.Integral() << std::endl;
               
-             //       filteredHitVec.push_back(hit.copy());
-              hcol.emplace_back(hit.move(), wire, rawdigits);
-           
-           bool wireWindowC=iWire>=minWireC&&iWire<=maxWireC;
-           bool outWireWindowC=iWire<=minWireC||iWire>=maxWireC;
-
-           if(wireWindowC) {
-           nghC++;
-           if(nghC==1) nw1hitC++;
-           nhWire[iWire]++;
-           fHeightC->Fill(peakAmp);
-           // fWidthC->Fill(peakWidth);
-           // fAreaC->Fill(totSig);
-           wCharge[iWire]+=fitCharge;
-           wInt[iWire]+=totSig;
-           }
-           
-
-          nhitsC++;
-           
-
-           if(tpc==0&&cryostat==0&&outWireWindowC) {
-           nnhitsC++; fNoiseC->Fill(peakAmp); }
-           
-           
-           
-           if(cryostat==0&&tpc==0)
-           if(wCharge[iwire]>0)
-           fAreaC->Fill(wCharge[iwire]);
-           if(cryostat==0&&tpc==0)
-           if(wInt[iwire]>0)
-           fIntegralC->Fill(wInt[iwire]);
-           if(cryostat==0&&tpc==0)
-           if(wCharge[iwire]>0)
-           output << iwire << " " <<wInt[iwire] << std::endl;
-           if(wInt[iwire]>0&&cryostat==0&&tpc==0)
-           fAreaInt->Fill(wCharge[iwire]/wInt[iwire]);
+              results.pendingHits.push_back(pendingHit);
    
           } // loop on peakparams vector
            
           } // loop on merged hits
    
-       // std::cout << " after coll hit " << std::endl;
       } //COLLECTION
            
          if(plane==0||plane==1) {
               for(auto& mergedCands : mergedCandidateHitVec)
               {
               for(size_t jh=0;jh<mergedCands.size();jh++) {
-               //   std::cout << " plane " << plane << " wire " << iwire << " hit " <<mergedCands[jh].hitCenter << std::endl;
               //FOR INDUCTION HITS STORE RAW INFORMATION
-              recob::HitCreator hit(
-                                    *wire,                                                                     //RAW DIGIT REFERENCE.
-                                    wid,                                                                           //WIRE ID.
-                                    mergedCands[jh].startTick,                                                                         //START TICK.
-                                    mergedCands[jh].stopTick,                                                                           //END TICK.
-                                    mergedCands[jh].hitSigma,                                                                          //RMS.
-                                    mergedCands[jh].hitCenter,                                                                      //PEAK_TIME.
-                                    0,                                                                   //SIGMA_PEAK_TIME.
-                                    mergedCands[jh].hitHeight,                                                                     //PEAK_AMPLITUDE.
-                                    0,                                                                  //SIGMA_PEAK_AMPLITUDE.
-                                    std::accumulate(holder.begin() + (int) mergedCands[jh].startTick, holder.begin() + (int) mergedCands[jh].stopTick, 0.),                                                                        //HIT_INTEGRAL.
-                                    0,                                                                     //HIT_SIGMA_INTEGRAL.
-                                    std::accumulate(holder.begin() + (int) mergedCands[jh].startTick, holder.begin() + (int) mergedCands[jh].stopTick, 0.), //SUMMED CHARGE.
-                                    1,                                                                             //MULTIPLICITY.
-                                    jh,                                                                            //LOCAL_INDEX.
-                                    0,                                                                 //WIRE ID.
-                                    int(mergedCands[jh].stopTick-mergedCands[jh].startTick+1)                                                               //DEGREES OF FREEDOM.
-                                    );
-              hcol.emplace_back(hit.move(), wire, rawdigits);
-           
-           bool driftWindow=(mergedCands[jh].hitCenter)>=minDrift&&(mergedCands[jh].hitCenter)<=maxDrift;
-           bool wireWindowI2=iWire>=minWireI2&&iWire<=maxWireI2;
-           bool outDriftWindow=(mergedCands[jh].hitCenter)<=minDrift||(mergedCands[jh].hitCenter)>=maxDrift;
-           bool outWireWindowI2=iWire<=minWireI2||iWire>=maxWireI2;
-           
-           
-           if(plane==0&&driftWindow)  {
-           //   std::cout << " wire " << hits[i].iWire << " ngh " << ngh << std::endl;
-           nghI1++;
-           if(nghI1==1) nw1hitI1++;
-           
-           //  std::cout << " wire " << hits[i].iWire << " nw1h " << nw1 << std::endl;
-           fHeightI1->Fill(mergedCands[jh].hitHeight);
-           fWidthI1->Fill(mergedCands[jh].hitSigma);
-           }
-           if(plane==1&&wireWindowI2) {
-           //   std::cout << " wire " << hits[i].iWire << " ngh " << ngh << std::endl;
-           nghI2++;
-           if(nghI2==1) nw1hitI2++;
-           // std::cout << " filling height histo wire" << hits[i].iWire << " drift " << hits[i].hitCenter << " amplitude " << amplitude << std::endl;
-           fHeightI2->Fill(mergedCands[jh].hitHeight);
-           fWidthI2->Fill(mergedCands[jh].hitSigma);
-           }
-
-           
-           if(plane==0) nhitsI1++;
-           if(plane==1) nhitsI2++;
-           
-           if(plane==0&&tpc==0&&cryostat==0&&outDriftWindow) {nnhitsI1++; fNoiseI1->Fill(mergedCands[jh].hitHeight); }
-           if(plane==1&&tpc==0&&cryostat==0&&outWireWindowI2) { nnhitsI2++; fNoiseI2->Fill(mergedCands[jh].hitHeight);           }
+              float totSig=std::accumulate(holder.begin() + (int) mergedCands[jh].startTick, holder.begin() + (int) mergedCands[jh].stopTick, 0.);
+
+              PendingHit pendingHit;
+
+              pendingHit.startTick          = mergedCands[jh].startTick;
+              pendingHit.stopTick           = mergedCands[jh].stopTick;
+              pendingHit.rms                = mergedCands[jh].hitSigma;
+              pendingHit.peakTime           = mergedCands[jh].hitCenter;
+              pendingHit.sigmaPeakTime      = 0;
+              pendingHit.peakAmplitude      = mergedCands[jh].hitHeight;
+              pendingHit.sigmaPeakAmplitude = 0;
+              pendingHit.hitIntegral        = totSig;
+              pendingHit.hitSigmaIntegral   = 0;
+              pendingHit.summedADC          = totSig;
+              pendingHit.multiplicity       = 1;
+              pendingHit.localIndex         = jh;
+              pendingHit.goodnessOfFit      = 0;
+              pendingHit.ndf                = int(mergedCands[jh].stopTick-mergedCands[jh].startTick+1);
+              pendingHit.localmean          = 0;
+
+              results.pendingHits.push_back(pendingHit);
            }} // merged loop
           } //INDUCTION
            
+  } //end processWire
 
-     
-       }     //end channel condition
-
-    } //end loop on channels
-
-//      std::cout <<  " nhitsI1 " << nhitsI1 <<" nhitsI2 " << nhitsI2 <<" nhitsC " << nhitsC << std::endl;
-
-
-      for(unsigned int jw=minWireC;jw<maxWireC;jw++)
-          fnhwC->Fill(nhWire[jw]);
-      
-      
-    hcol.put_into(evt);
-      //std::cout << " end ICARUSHitfinder " << std::endl;
-   
-      
-  } //end produce
-
-void ICARUSHitFinder::expandHit(reco_tool::ICandidateHitFinder::HitCandidate& h, std::vector<float> holder, std::vector<reco_tool::ICandidateHitFinder::HitCandidate> how)
+void ICARUSHitFinder::expandHit(reco_tool::ICandidateHitFinder::HitCandidate& h, std::vector<float> holder, std::vector<reco_tool::ICandidateHitFinder::HitCandidate> how) const
     {
         // Given a hit or hit candidate <hit> expand its limits to the closest minima
         int nsamp=50;
@@ -980,7 +1099,7 @@ void ICARUSHitFinder::expandHit(reco_tool::ICandidateHitFinder::HitCandidate& h,
         h.startTick=first;
         h.stopTick=last;
     }
-    void ICARUSHitFinder::computeBestLocalMean(std::vector<reco_tool::ICandidateHitFinder::HitCandidate> h, std::vector<float> holder, reco_tool::ICandidateHitFinder::MergeHitCandidateVec how, float& localmean)
+    void ICARUSHitFinder::computeBestLocalMean(std::vector<reco_tool::ICandidateHitFinder::HitCandidate> h, std::vector<float> holder, reco_tool::ICandidateHitFinder::MergeHitCandidateVec how, float& localmean) const
     {
         const int bigw=130;   //size of the window where to look for the minimum localmean value
         const int meanw=70;   //size of the window where the mean is calculated
@@ -1120,7 +1239,7 @@ void ICARUSHitFinder::expandHit(reco_tool::ICandidateHitFinder::HitCandidate& h,
         
         // Now define the complete function to fit
         // TF1 Func("ICARUSfunc",fitf,0,roiSize,1+5*hitCandidateVec.size());
-        TF1& Func = *(fFitCache.Get(hitCandidateVec.size()));
+        TF1& Func = *(fFitCache.local().Get(hitCandidateVec.size()));
         assert(&Func);
         
         // ### Setting the parameters for the ICARUS Fit ###
@@ -1269,7 +1388,7 @@ void ICARUSHitFinder::expandHit(reco_tool::ICandidateHitFinder::HitCandidate& h,
         
         // Now define the complete function to fit
         // TF1 Func("ICARUSfunc",fitlong,0,roiSize,1+7*hitCandidateVec.size());
-        TF1& Func = *(fLongFitCache.Get(hitCandidateVec.size()));
+        TF1& Func = *(fLongFitCache.local().Get(hitCandidateVec.size()));
         assert(&Func);
         
         // ### Setting the parameters for the ICARUS Fit ###
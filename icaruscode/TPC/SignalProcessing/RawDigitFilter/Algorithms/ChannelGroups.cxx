@@ -2,6 +2,8 @@
 #include "ChannelGroups.h"
 #include "messagefacility/MessageLogger/MessageLogger.h"
 
+#include <algorithm>
+
 namespace caldata
 {
 //----------------------------------------------------------------------------
@@ -119,6 +121,10 @@ ChannelGroups::ChannelGroups(fhicl::ParameterSet const & pset)
     }
     */
 
+    // The map above is only the declaration of the groupings, compile it
+    // into the dense structures actually used at lookup time
+    compileGroupLayout();
+
     // Report.
     mf::LogInfo("ChannelGroups") << "ChannelGroups configured\n";
 }
@@ -127,16 +133,58 @@ ChannelGroups::ChannelGroups(fhicl::ParameterSet const & pset)
 /// Destructor.
 ChannelGroups::~ChannelGroups()
 {}
-    
+
+void ChannelGroups::compileGroupLayout()
+{
+    fGroupByViewAndWire.resize(fGroupByViewAndWireMap.size());
+    fWiresByViewAndGroup.resize(fGroupByViewAndWireMap.size());
+
+    for(size_t view = 0; view < fGroupByViewAndWireMap.size(); view++)
+    {
+        // Size the dense table just large enough to cover the last wire
+        // assigned to a non-default group; everything past it is group 0
+        size_t maxWire(0);
+        size_t maxGroup(0);
+
+        for(const auto& wireGroupPair : fGroupByViewAndWireMap[view])
+        {
+            if (wireGroupPair.second == 0) continue;
+
+            maxWire  = std::max(maxWire,  wireGroupPair.first + 1);
+            maxGroup = std::max(maxGroup, wireGroupPair.second);
+        }
+
+        fGroupByViewAndWire[view].assign(maxWire, 0);
+        fWiresByViewAndGroup[view].resize(maxGroup + 1);
+
+        // std::map iterates wires in ascending order so the per group wire
+        // lists come out sorted and can be walked linearly
+        for(const auto& wireGroupPair : fGroupByViewAndWireMap[view])
+        {
+            if (wireGroupPair.first < maxWire) fGroupByViewAndWire[view][wireGroupPair.first] = wireGroupPair.second;
+
+            fWiresByViewAndGroup[view][wireGroupPair.second].push_back(wireGroupPair.first);
+        }
+    }
+
+    return;
+}
+
 size_t ChannelGroups::channelGroup(size_t view, size_t wire) const
 {
-    size_t group(0);
-    
-    std::map<size_t,size_t>::const_iterator channelGroupItr = fGroupByViewAndWireMap[view].find(wire);
-    
-    if (channelGroupItr != fGroupByViewAndWireMap[view].end()) group = channelGroupItr->second;
-    
-    return group;
+    const std::vector<size_t>& groupByWire = fGroupByViewAndWire[view];
+
+    return wire < groupByWire.size() ? groupByWire[wire] : 0;
 }
-    
+
+size_t ChannelGroups::numGroups(size_t view) const
+{
+    return fWiresByViewAndGroup[view].size();
+}
+
+const std::vector<size_t>& ChannelGroups::groupWires(size_t view, size_t group) const
+{
+    return fWiresByViewAndGroup[view][group];
+}
+
 }
@@ -1,43 +1,62 @@
-#ifndef CHANNELGROUPS_H
-#define CHANNELGROUPS_H
-////////////////////////////////////////////////////////////////////////
-//
-// Class:       ChannelGroups
-// Module Type: algorithm service
-// File:        ChannelGroups.h
-//
-//              This provides a mechanism for grouping channels in MicroBooNE
-//              that share common characteristics (e.g. correlated noise)
-//
-// Configuration parameters:
-//
-//
-// Created by Tracy Usher (usher@slac.stanford.edu) on January 7, 2016
-//
-////////////////////////////////////////////////////////////////////////
-
-#include "RawDigitNoiseFilterDefs.h"
-#include "fhiclcpp/ParameterSet.h"
-
-#include <map>
-
-namespace caldata
-{
-class ChannelGroups
-{
-public:
-
-    // Copnstructors, destructor.
-    ChannelGroups(fhicl::ParameterSet const & pset);
-    ~ChannelGroups();
-    
-    size_t channelGroup(size_t view, size_t wire) const;
-    
-private:
-    
-    std::vector<std::map<size_t,size_t>> fGroupByViewAndWireMap;
-};
-
-} // end of namespace caldata
-
-#endif
\ No newline at end of file
+#ifndef CHANNELGROUPS_H
+#define CHANNELGROUPS_H
+////////////////////////////////////////////////////////////////////////
+//
+// Class:       ChannelGroups
+// Module Type: algorithm service
+// File:        ChannelGroups.h
+//
+//              This provides a mechanism for grouping channels in MicroBooNE
+//              that share common characteristics (e.g. correlated noise)
+//
+//              The groupings are declared through a sparse map at
+//              construction time and then compiled into a dense wire to
+//              group lookup table plus contiguous per group wire lists,
+//              so clients walking the channels (e.g. the correlated noise
+//              correction) resolve membership with an array read and can
+//              iterate group-major over contiguous memory
+//
+// Configuration parameters:
+//
+//
+// Created by Tracy Usher (usher@slac.stanford.edu) on January 7, 2016
+//
+////////////////////////////////////////////////////////////////////////
+
+#include "RawDigitNoiseFilterDefs.h"
+#include "fhiclcpp/ParameterSet.h"
+
+#include <map>
+
+namespace caldata
+{
+class ChannelGroups
+{
+public:
+
+    // Copnstructors, destructor.
+    ChannelGroups(fhicl::ParameterSet const & pset);
+    ~ChannelGroups();
+
+    size_t channelGroup(size_t view, size_t wire) const;
+
+    // Group-major access to the compiled layout: the number of groups in
+    // a view and the sorted, contiguous array of wires assigned to a group
+    // (wires not listed belong to the default group 0)
+    size_t                     numGroups(size_t view)                const;
+    const std::vector<size_t>& groupWires(size_t view, size_t group) const;
+
+private:
+
+    // Compile the sparse declaration map into the dense lookup structures
+    void compileGroupLayout();
+
+    std::vector<std::map<size_t,size_t>>  fGroupByViewAndWireMap;
+
+    std::vector<std::vector<size_t>>              fGroupByViewAndWire;  // dense wire --> group, per view
+    std::vector<std::vector<std::vector<size_t>>> fWiresByViewAndGroup; // view --> group --> wire list
+};
+
+} // end of namespace caldata
+
+#endif
@@ -13,6 +13,7 @@
 #include "larcore/Geometry/Geometry.h"
 
 #include "icaruscode/TPC/SignalProcessing/RawDigitFilter/Algorithms/IRawDigitFilter.h"
+#include "icaruscode/TPC/Utilities/tools/VectorMath.h"
 #include "icarus_signal_processing/WaveformTools.h"
 
 #include "TH1F.h"
@@ -209,16 +210,13 @@ void MorphologicalFilter::smoothInputWaveform(const RawDigitVector& inputWavefor
     // Copy in the input waveform
     std::copy(inputWaveform.begin(),inputWaveform.end(),tempWaveform.begin()+halfBins);
     
-    // Now do the smoothing
-    for(size_t idx = 0; idx < inputWaveform.size(); idx++)
-    {
-        float weightedSum(0.);
-        
-        for(int wIdx = 0; wIdx < fNumBinsToAve; wIdx++) weightedSum += fAveWeightVec.at(wIdx) * tempWaveform.at(idx + wIdx);
-        
-        outputWaveform.at(idx) = weightedSum / fWeightSum;
-    }
-    
+    // Now do the smoothing with the shared convolution primitive
+    std::vector<float> weightedSumVec(inputWaveform.size() + 1);
+
+    icarusutil::convolveValid(tempWaveform.data(), tempWaveform.size(), fAveWeightVec.data(), size_t(fNumBinsToAve), weightedSumVec.data());
+
+    for(size_t idx = 0; idx < inputWaveform.size(); idx++) outputWaveform.at(idx) = weightedSumVec[idx] / fWeightSum;
+
     return;
 }
 
@@ -30,33 +30,21 @@ RawDigitBinAverageAlg::~RawDigitBinAverageAlg()
 void RawDigitBinAverageAlg::doBinAverage(RawDigitVector& dataVec,
                                         size_t          binsToAverage) const
 {
-    size_t halfBinsToAverage(binsToAverage/2);
-    
-    float runningSum(0.);
-    
-    for(size_t idx = 0; idx < halfBinsToAverage; idx++) runningSum += dataVec[idx];
-    
-    // Declare erosion vector
-    std::vector<float> meanVec;
-    
-    meanVec.resize(dataVec.size(), 0);
-    std::vector<float>::iterator meanVecItr = meanVec.begin();
-    
-    // First pass through to build the erosion vector
-    for(RawDigitVector::iterator dataItr = dataVec.begin(); dataItr != dataVec.end(); dataItr++)
-    {
-        size_t startOffset = std::distance(dataVec.begin(),dataItr);
-        size_t stopOffset  = std::distance(dataItr,dataVec.end());
-        size_t count       = std::min(2 * halfBinsToAverage, std::min(startOffset + halfBinsToAverage + 1, halfBinsToAverage + stopOffset - 1));
-        
-        if (startOffset >= halfBinsToAverage) runningSum -= *(dataItr - halfBinsToAverage);
-        if (stopOffset  >  halfBinsToAverage) runningSum += *(dataItr + halfBinsToAverage);
-        
-        *meanVecItr++ = runningSum / float(count);
-    }
-    
-    std::transform(meanVec.begin(),meanVec.end(),dataVec.begin(),[](const float& val){return std::round(val);});
-    
+    binAverageVec(dataVec, binsToAverage);
+
+    return;
+}
+
+void RawDigitBinAverageAlg::doBinAverage(std::vector<RawDigitVector*>& dataVecList,
+                                        size_t                        binsToAverage) const
+{
+    // A single waveform fits in the first level cache, so the batch is run
+    // channel after channel: what the batching buys is that adjacent channels
+    // just produced by the caller are averaged while still cache resident,
+    // rather than after the caller has streamed through the whole plane
+    for(RawDigitVector* dataVec : dataVecList)
+        if (dataVec) binAverageVec(*dataVec, binsToAverage);
+
     return;
 }
 
@@ -19,9 +19,12 @@
 #include "RawDigitNoiseFilterDefs.h"
 #include "fhiclcpp/ParameterSet.h"
 
+#include <cmath>
+#include <vector>
+
 namespace caldata
 {
-    
+
 class RawDigitBinAverageAlg
 {
 public:
@@ -29,13 +32,63 @@ public:
     // Copnstructors, destructor.
     RawDigitBinAverageAlg(fhicl::ParameterSet const & pset);
     ~RawDigitBinAverageAlg();
-    
+
     void doBinAverage(RawDigitVector&, size_t) const;
-    
+
+    // Average a batch of adjacent channels in one call (smoothing use case):
+    // the channels are processed back to back while their waveforms are still
+    // cache resident. Null entries are skipped.
+    void doBinAverage(std::vector<RawDigitVector*>&, size_t) const;
+
     void doTwoBinAverage(RawDigitVector&) const;
-    
+
 private:
+
+    // The actual averaging kernel, templated on the sample type so wider ADC
+    // words can reuse it unchanged (see implementation below)
+    template <typename ADC> static void binAverageVec(std::vector<ADC>&, size_t);
 };
 
+//----------------------------------------------------------------------------
+// Single pass sliding average with the widened running sum held in a
+// register. The means are staged in a ring buffer of halfBinsToAverage+1
+// samples and written back with that lag, once no later window can still
+// read the original value; the full size intermediate vector of the old
+// implementation, and the extra pass over it, are gone, so the kernel
+// streams the waveform once at close to memory bandwidth.
+template <typename ADC> void RawDigitBinAverageAlg::binAverageVec(std::vector<ADC>& dataVec, size_t binsToAverage)
+{
+    size_t halfBinsToAverage(binsToAverage/2);
+    size_t dataSize = dataVec.size();
+
+    if (dataSize == 0 || halfBinsToAverage == 0) return;
+
+    long long runningSum(0);
+
+    for(size_t idx = 0; idx < halfBinsToAverage; idx++) runningSum += dataVec[idx];
+
+    std::vector<ADC> pending(halfBinsToAverage + 1);
+
+    for(size_t idx = 0; idx < dataSize; idx++)
+    {
+        size_t stopOffset = dataSize - idx;
+        size_t count      = std::min(2 * halfBinsToAverage, std::min(idx + halfBinsToAverage + 1, halfBinsToAverage + stopOffset - 1));
+
+        if (idx >= halfBinsToAverage) runningSum -= dataVec[idx - halfBinsToAverage];
+        if (stopOffset > halfBinsToAverage) runningSum += dataVec[idx + halfBinsToAverage];
+
+        // .. Write back the mean which fell out of every remaining window
+        if (idx >= halfBinsToAverage) dataVec[idx - halfBinsToAverage] = pending[(idx - halfBinsToAverage) % pending.size()];
+
+        pending[idx % pending.size()] = ADC(std::round(double(runningSum) / double(count)));
+    }
+
+    // .. Flush the lagging tail
+    for(size_t idx = dataSize > halfBinsToAverage ? dataSize - halfBinsToAverage : 0; idx < dataSize; idx++)
+        dataVec[idx] = pending[idx % pending.size()];
+
+    return;
+}
+
 } // end caldata namespace
 #endif
\ No newline at end of file
@@ -1,6 +1,8 @@
 
 #include "RawDigitCharacterizationAlg.h"
 
+#include "icaruscode/TPC/SignalProcessing/RawDigitFilter/Algorithms/WaveformStatistics.h"
+
 #include "art/Framework/Core/ModuleMacros.h"
 #include "messagefacility/MessageLogger/MessageLogger.h"
 
@@ -245,6 +247,145 @@ void RawDigitCharacterizationAlg::getWaveformParams(const RawDigitVector& rawWav
     
     return;
 }
+
+// Single pass version of the above
+void RawDigitCharacterizationAlg::getWaveformParamsFast(const RawDigitVector& rawWaveform,
+                                                        unsigned int          channel,
+                                                        unsigned int          view,
+                                                        unsigned int          wire,
+                                                        float&                truncMean,
+                                                        float&                truncRms,
+                                                        short&                mean,
+                                                        short&                median,
+                                                        short&                mode,
+                                                        float&                skewness,
+                                                        float&                rms,
+                                                        short&                minMax,
+                                                        float&                neighborRatio,
+                                                        float&                pedCorVal) const
+{
+    // The strategy here is to make a single sweep through the waveform which
+    // accumulates the moments and a compact ADC frequency table, then recover
+    // everything else (median, mode, truncated mean/rms) from the table. This
+    // avoids the sorted copies and repeated passes of getWaveformParams above
+    std::pair<RawDigitVector::const_iterator,RawDigitVector::const_iterator> minMaxItrPair = std::minmax_element(rawWaveform.begin(),rawWaveform.end());
+
+    int minVal = *minMaxItrPair.first;
+    int maxVal = *minMaxItrPair.second;
+    int range  = maxVal - minVal + 1;
+
+    minMax = std::min(range, 199);  // for the purposes of histogramming
+
+    // The single sweep: moments plus the frequency table (and its max bin)
+    WaveformMoments  moments;
+    std::vector<int> frequencyVec(range, 0);
+    int              mpCount(0);
+    int              mpVal(0);
+
+    for(const auto& adcVal : rawWaveform)
+    {
+        moments.add(adcVal);
+
+        int binIdx = adcVal - minVal;
+
+        if (++frequencyVec[binIdx] > mpCount)
+        {
+            mpCount = frequencyVec[binIdx];
+            mpVal   = binIdx;
+        }
+    }
+
+    // The truncated mean is the weighted average of the neighborhood of the most populated bin
+    int meanCnt  = 0;
+    int meanSum  = 0;
+    int binRange = std::min(16, int(range/2 + 1));
+
+    for(int idx = mpVal-binRange; idx <= mpVal+binRange; idx++)
+    {
+        if (idx < 0 || idx >= range) continue;
+
+        meanSum += (idx + minVal) * frequencyVec[idx];
+        meanCnt += frequencyVec[idx];
+    }
+
+    truncMean = float(meanSum) / float(meanCnt);
+
+    // The pedCorVal will transform from the average of waveform calculated here to the expected value of the pedestal.
+    pedCorVal = 0.;
+
+    // The full rms about any reference point comes straight from the moments
+    float realMean(moments.mean());
+    float rmsTrunc(std::sqrt(std::max(0., moments.variance() + double((realMean - truncMean) * (realMean - truncMean)))));
+
+    mean = std::round(realMean);
+    rms  = std::sqrt(std::max(0., moments.variance()));
+
+    // The median falls out of the cumulative frequency counts
+    int medianTarget = int(rawWaveform.size()/2);
+    int cumulative   = 0;
+    int medianIdx    = 0;
+
+    while(medianIdx < range && cumulative + frequencyVec[medianIdx] <= medianTarget) cumulative += frequencyVec[medianIdx++];
+
+    median   = short(medianIdx + minVal);
+    skewness = 3. * float(realMean - median) / rms;
+
+    // Truncation simply drops the tails of the table beyond the cut
+    float truncCut(2.5 * rmsTrunc);
+    float truncSum(0.);
+    int   numTruncBins(0);
+
+    for(int idx = 0; idx < range; idx++)
+    {
+        float adcLessPed = float(idx + minVal) - truncMean;
+
+        if (std::abs(adcLessPed) > truncCut) continue;
+
+        truncSum     += frequencyVec[idx] * adcLessPed * adcLessPed;
+        numTruncBins += frequencyVec[idx];
+    }
+
+    truncRms = std::sqrt(std::max(0.f, truncSum / float(std::max(numTruncBins,1))));
+
+    // Finally the mode and neighbor ratio, same definitions as above
+    short leftNeighbor(mpCount);
+    short rightNeighbor(mpCount);
+
+    mode = short(mpVal + minVal);
+
+    if (mpVal - 1 >= 0    && frequencyVec[mpVal-1] > 0) leftNeighbor  = frequencyVec[mpVal-1];
+    if (mpVal + 1 < range && frequencyVec[mpVal+1] > 0) rightNeighbor = frequencyVec[mpVal+1];
+
+    neighborRatio = float(std::min(leftNeighbor,rightNeighbor)) / float(mpCount);
+
+    // Fill some histograms here
+    if (fHistsInitialized)
+    {
+        fAdcCntHist[view]->Fill(numTruncBins, 1.);
+        fAveValHist[view]->Fill(std::max(-29.9, std::min(29.9,double(truncMean))), 1.);
+        fRmsTValHist[view]->Fill(std::min(19.9, double(truncRms)), 1.);
+        fRmsFValHist[view]->Fill(std::min(19.9, double(rms)), 1.);
+        fRmsValProf[view]->Fill(wire, double(truncRms), 1.);
+        fMinMaxValProf[view]->Fill(wire, double(std::min(range-1,199)), 1.);
+        fPedValProf[view]->Fill(wire, truncMean, 1.);
+        fPedValHist[view]->Fill(truncMean, 1.);
+    }
+
+    if (wire / fNumWiresToGroup[view] == fHistsWireGroup[view])
+    {
+        size_t wireIdx = wire % fNumWiresToGroup[view];
+
+        if (fHistsInitialized)
+        {
+            fMinMaxProfiles[view]->Fill(double(wireIdx+0.5), double(minMax), 1.);
+            fSkewnessProfiles[view]->Fill(double(wireIdx+0.5), double(skewness), 1.);
+            fModeRatioProfiles[view]->Fill(double(wireIdx+0.5), double(neighborRatio), 1.);
+        }
+    }
+
+    return;
+}
+
 void RawDigitCharacterizationAlg::getTruncatedRMS(const RawDigitVector& rawWaveform,
                                                   float&                pedestal,
                                                   float&                truncRms) const
@@ -330,30 +471,19 @@ void RawDigitCharacterizationAlg::getMeanAndRms(const RawDigitVector& rawWavefor
 {
     // The strategy for finding the average for a given wire will be to
     // find the most populated bin and the average using the neighboring bins
-    // To do this we'll use a map with key the bin number and data the count in that bin
-    std::pair<RawDigitVector::const_iterator,RawDigitVector::const_iterator> minMaxValItr = std::minmax_element(rawWaveform.begin(),rawWaveform.end());
-    
-    int minVal = std::floor(*minMaxValItr.first);
-    int maxVal = std::ceil(*minMaxValItr.second);
+    // To do this we'll use the shared frequency table kernel
+    std::pair<short,short> minMaxVal = wavestats::minmax(rawWaveform.data(), rawWaveform.size());
+
+    int minVal = minMaxVal.first;
+    int maxVal = minMaxVal.second;
     int range  = maxVal - minVal + 1;
-    
+
     std::vector<int> frequencyVec(range, 0);
-    int              mpCount(0);
-    int              mpVal(0);
-    
-    for(const auto& val : rawWaveform)
-    {
-        int intVal = std::round(val) - minVal;
-        
-        frequencyVec[intVal]++;
-        
-        if (frequencyVec.at(intVal) > mpCount)
-        {
-            mpCount = frequencyVec[intVal];
-            mpVal   = intVal;
-        }
-    }
-    
+
+    wavestats::frequencyTable(rawWaveform.data(), rawWaveform.size(), minVal, frequencyVec);
+
+    int mpVal = std::distance(frequencyVec.begin(), std::max_element(frequencyVec.begin(), frequencyVec.end()));
+
     // take a weighted average of two neighbor bins
     int meanCnt  = 0;
     int meanSum  = 0;
@@ -362,23 +492,18 @@ void RawDigitCharacterizationAlg::getMeanAndRms(const RawDigitVector& rawWavefor
     for(int idx = mpVal-binRange; idx <= mpVal+binRange; idx++)
     {
         if (idx < 0 || idx >= range) continue;
-        
+
         meanSum += (idx + minVal) * frequencyVec[idx];
         meanCnt += frequencyVec[idx];
     }
-    
+
     aveVal = float(meanSum) / float(meanCnt);
-    
-    // do rms calculation - the old fashioned way and over all adc values
-    std::vector<float> adcLessPedVec(rawWaveform.size());
-    
-    std::transform(rawWaveform.begin(),rawWaveform.end(),adcLessPedVec.begin(),std::bind(std::minus<float>(),std::placeholders::_1,aveVal));
-    
-    // recalculate the rms for truncation
-    rmsVal  = std::inner_product(adcLessPedVec.begin(), adcLessPedVec.end(), adcLessPedVec.begin(), 0.);
-    rmsVal  = std::sqrt(std::max(float(0.),rmsVal / float(adcLessPedVec.size())));
+
+    // do rms calculation - single pass over all adc values
+    rmsVal  = wavestats::sumSquaredDeviations(rawWaveform.data(), rawWaveform.size(), aveVal);
+    rmsVal  = std::sqrt(std::max(float(0.),rmsVal / float(rawWaveform.size())));
     numBins = meanCnt;
-    
+
     return;
 }
 
@@ -390,61 +515,42 @@ void RawDigitCharacterizationAlg::getMeanAndTruncRms(const RawDigitVector& rawWa
 {
     // The strategy for finding the average for a given wire will be to
     // find the most populated bin and the average using the neighboring bins
-    // To do this we'll use a map with key the bin number and data the count in that bin
-    std::pair<RawDigitVector::const_iterator,RawDigitVector::const_iterator> minMaxValItr = std::minmax_element(rawWaveform.begin(),rawWaveform.end());
-    
-    int minVal = std::floor(*minMaxValItr.first);
-    int maxVal = std::ceil(*minMaxValItr.second);
+    // To do this we'll use the shared frequency table kernel
+    std::pair<short,short> minMaxVal = wavestats::minmax(rawWaveform.data(), rawWaveform.size());
+
+    int minVal = minMaxVal.first;
+    int maxVal = minMaxVal.second;
     int range  = maxVal - minVal + 1;
-    
+
     std::vector<int> frequencyVec(range, 0);
-    int              mpCount(0);
-    int              mpVal(0);
-    
-    for(const auto& val : rawWaveform)
-    {
-        int intVal = std::round(val) - minVal;
-        
-        frequencyVec[intVal]++;
-        
-        if (frequencyVec.at(intVal) > mpCount)
-        {
-            mpCount = frequencyVec[intVal];
-            mpVal   = intVal;
-        }
-    }
-    
+
+    wavestats::frequencyTable(rawWaveform.data(), rawWaveform.size(), minVal, frequencyVec);
+
+    int mpVal = std::distance(frequencyVec.begin(), std::max_element(frequencyVec.begin(), frequencyVec.end()));
+
     // take a weighted average of two neighbor bins
     int meanCnt  = 0;
     int meanSum  = 0;
     int binRange = std::min(16, int(range/2 + 1));
-    
+
     for(int idx = mpVal-binRange; idx <= mpVal+binRange; idx++)
     {
         if (idx < 0 || idx >= range) continue;
-        
+
         meanSum += (idx + minVal) * frequencyVec[idx];
         meanCnt += frequencyVec[idx];
     }
-    
+
     aveVal = float(meanSum) / float(meanCnt);
-    
-    // do rms calculation - the old fashioned way and over all adc values
-    std::vector<float> adcLessPedVec(rawWaveform.size());
-    
-    std::transform(rawWaveform.begin(),rawWaveform.end(),adcLessPedVec.begin(),std::bind(std::minus<float>(),std::placeholders::_1,aveVal));
-    
-    // recalculate the rms for truncation
-    rmsVal  = std::inner_product(adcLessPedVec.begin(), adcLessPedVec.end(), adcLessPedVec.begin(), 0.);
-    rmsVal  = std::sqrt(std::max(float(0.),rmsVal / float(adcLessPedVec.size())));
-    
-    // Drop the "large" rms values and recompute
-    std::vector<float>::iterator newEndItr = std::remove_if(adcLessPedVec.begin(),adcLessPedVec.end(),[rmsVal](const auto& val){return std::abs(val) > 2.5*rmsVal;});
-    
-    rmsTrunc = std::inner_product(adcLessPedVec.begin(), newEndItr, adcLessPedVec.begin(), 0.);
-    numBins  = std::distance(adcLessPedVec.begin(),newEndItr);
+
+    // do rms calculation - single pass over all adc values
+    rmsVal  = wavestats::sumSquaredDeviations(rawWaveform.data(), rawWaveform.size(), aveVal);
+    rmsVal  = std::sqrt(std::max(float(0.),rmsVal / float(rawWaveform.size())));
+
+    // Drop the "large" deviations and recompute
+    rmsTrunc = wavestats::sumSquaredDeviationsBelow(rawWaveform.data(), rawWaveform.size(), aveVal, 2.5*rmsVal, numBins);
     rmsTrunc = std::sqrt(std::max(float(0.),rmsTrunc / float(numBins)));
-    
+
     return;
 }
 
@@ -26,6 +26,8 @@
 #include "RawDigitNoiseFilterDefs.h"
 #include "fhiclcpp/ParameterSet.h"
 
+#include <cmath>
+
 #include "art/Framework/Services/Registry/ServiceHandle.h"
 #include "art_root_io/TFileService.h"
 #include "larcore/Geometry/Geometry.h"
@@ -97,6 +99,68 @@ public:
                            float&                neighborRatio,
                            float&                pedCorVal) const;
     
+    // Single pass accumulator for the first three moments of a waveform.
+    // The running update is the standard Welford recurrence and two partial
+    // accumulations can be combined with merge() (Chan et al.) so the engine
+    // can be used in a parallel reduction over waveform blocks
+    struct WaveformMoments
+    {
+        double fCount    = 0.;
+        double fMean     = 0.;
+        double fMoment2  = 0.;
+        double fMoment3  = 0.;
+
+        inline void add(double val)
+        {
+            double count = fCount + 1.;
+            double delta = val - fMean;
+            double deltaN = delta / count;
+
+            fMoment3 += deltaN * (delta * deltaN * fCount * (count - 2.) - 3. * fMoment2);
+            fMoment2 += delta * deltaN * fCount;
+            fMean    += deltaN;
+            fCount    = count;
+        }
+
+        inline void merge(const WaveformMoments& other)
+        {
+            if (other.fCount <= 0.) return;
+
+            double count = fCount + other.fCount;
+            double delta = other.fMean - fMean;
+            double deltaN = delta / count;
+
+            fMoment3 += other.fMoment3
+                      + delta * deltaN * deltaN * fCount * other.fCount * (fCount - other.fCount)
+                      + 3. * deltaN * (fCount * other.fMoment2 - other.fCount * fMoment2);
+            fMoment2 += other.fMoment2 + delta * deltaN * fCount * other.fCount;
+            fMean    += deltaN * other.fCount;
+            fCount    = count;
+        }
+
+        inline double mean()     const {return fMean;}
+        inline double variance() const {return fCount > 0. ? fMoment2 / fCount : 0.;}
+        inline double skewness() const {return fMoment2 > 0. ? std::sqrt(fCount) * fMoment3 / std::pow(fMoment2, 1.5) : 0.;}
+    };
+
+    // Single pass version of getWaveformParams: one moment accumulation sweep
+    // plus a compact ADC frequency table replace the sorted copies and the
+    // repeated passes over the waveform. Returns the same set of parameters
+    void getWaveformParamsFast(const RawDigitVector& rawWaveform,
+                               unsigned int          channel,
+                               unsigned int          view,
+                               unsigned int          wire,
+                               float&                truncMean,
+                               float&                truncRms,
+                               short&                mean,
+                               short&                median,
+                               short&                mode,
+                               float&                skewness,
+                               float&                rms,
+                               short&                minMax,
+                               float&                neighborRatio,
+                               float&                pedCorVal) const;
+
     bool classifyRawDigitVec(RawDigitVector&         rawWaveform,
                              unsigned int            viewIdx,
                              unsigned int            wire,
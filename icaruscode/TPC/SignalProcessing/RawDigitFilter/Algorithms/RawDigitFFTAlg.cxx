@@ -49,6 +49,7 @@ template <class T> RawDigitFFTAlg<T>::~RawDigitFFTAlg()
 template <class T> void RawDigitFFTAlg<T>::reconfigure(fhicl::ParameterSet const & pset)
 {
     fTransformViewVec = pset.get<std::vector<bool>  >("TransformViewVec", std::vector<bool>() = {true,false,false});
+    fFFTBackend       = pset.get<std::string        >("FFTBackend",                                        "eigen");
     fFillHistograms   = pset.get<bool               >("FillHistograms",                                      false);
     fHistDirName      = pset.get<std::string        >("HistDirName",                                   "FFT_hists");
     fLoWireByPlane    = pset.get<std::vector<size_t>>("LoWireByPlane",               std::vector<size_t>()={0,0,0});
@@ -293,4 +294,94 @@ template <class T> void RawDigitFFTAlg<T>::filterFFT(detinfo::DetectorClocksData
 
     return;
 }
+
+template <class T> Eigen::FFT<float>& RawDigitFFTAlg<T>::getFFTPlan(size_t fftDataSize)
+{
+    // The plan (with its twiddle factor tables) depends only on the waveform
+    // length so it can be shared by every channel we transform
+    typename std::map<size_t,std::unique_ptr<Eigen::FFT<float>>>::iterator planItr = fFFTPlanCache.find(fftDataSize);
+
+    if (planItr == fFFTPlanCache.end())
+        planItr = fFFTPlanCache.emplace(fftDataSize,std::make_unique<Eigen::FFT<float>>()).first;
+
+    return *planItr->second;
+}
+
+template <class T> void RawDigitFFTAlg<T>::filterFFT(detinfo::DetectorClocksData const& clockData,
+                                                     detinfo::DetectorPropertiesData const& detProp,
+                                                     std::vector<std::vector<short>>& rawadcBlock,
+                                                     size_t plane, size_t loWire,
+                                                     const std::vector<float>& pedestalVec)
+{
+    // Batched version of filterFFT above. If the blocked backend was not
+    // selected then simply loop the single channel version over the block
+    if (fFFTBackend != "eigenBlocked")
+    {
+        for(size_t wireIdx = 0; wireIdx < rawadcBlock.size(); wireIdx++)
+            filterFFT(clockData, detProp, rawadcBlock[wireIdx], plane, loWire + wireIdx, pedestalVec[wireIdx]);
+
+        return;
+    }
+
+    // Check there is something to do
+    if (!fTransformViewVec.at(plane) || rawadcBlock.empty()) return;
+
+    size_t const fftDataSize = rawadcBlock.front().size();
+    size_t const halfFFTDataSize(fftDataSize/2 + 1);
+
+    Eigen::FFT<float>& eigenFFT = getFFTPlan(fftDataSize);
+
+    // Make sure the filter has been correctly initialized (once per block, not per channel)
+    if (fFilterToolMap.at(plane)->getResponseVec().size() != halfFFTDataSize)
+    {
+        fFilterToolMap.at(plane)->setResponse(fftDataSize,1.,1.);
+
+        fFilterVecMap.at(plane).clear();
+        fFilterVecMap.at(plane).reserve(halfFFTDataSize);
+        for(auto& complex : fFilterToolMap.at(plane)->getResponseVec()) fFilterVecMap.at(plane).emplace_back(complex);
+    }
+
+    const std::vector<std::complex<float>>& filterVec = fFilterVecMap.at(plane);
+
+    if (fFFTInputVec.size() != fftDataSize) fFFTInputVec.resize(fftDataSize, 0.);
+
+    if (fFFTBlockOutputVec.size() < rawadcBlock.size()) fFFTBlockOutputVec.resize(rawadcBlock.size());
+
+    // Phase one: forward transform every waveform of the block with the shared plan
+    for(size_t wireIdx = 0; wireIdx < rawadcBlock.size(); wireIdx++)
+    {
+        const float pedestal = pedestalVec[wireIdx];
+
+        std::transform(rawadcBlock[wireIdx].begin(),rawadcBlock[wireIdx].end(),fFFTInputVec.begin(),[pedestal](const auto& val){return float(float(val) - pedestal);});
+
+        if (fFFTBlockOutputVec[wireIdx].size() != fftDataSize) fFFTBlockOutputVec[wireIdx].resize(fftDataSize);
+
+        eigenFFT.fwd(fFFTBlockOutputVec[wireIdx],fFFTInputVec);
+    }
+
+    // Phase two: apply the filter across the whole block in one pass. Mapping the
+    // contiguous complex storage lets Eigen run the multiply through its packet
+    // (SIMD) path instead of a scalar per-bin loop
+    for(auto& fftOutputVec : fFFTBlockOutputVec)
+    {
+        Eigen::Map<Eigen::VectorXcf>       outputMap(fftOutputVec.data(), halfFFTDataSize);
+        Eigen::Map<const Eigen::VectorXcf> filterMap(filterVec.data(),    halfFFTDataSize);
+
+        outputMap.array() *= filterMap.array();
+
+        for(size_t idx = 1; idx < fftDataSize/2; idx++) fftOutputVec[fftDataSize - idx] = fftOutputVec[idx];
+    }
+
+    // Phase three: invert back to the time domain and restore the pedestals
+    for(size_t wireIdx = 0; wireIdx < rawadcBlock.size(); wireIdx++)
+    {
+        const float pedestal = pedestalVec[wireIdx];
+
+        eigenFFT.inv(fFFTInputVec, fFFTBlockOutputVec[wireIdx]);
+
+        std::transform(fFFTInputVec.begin(), fFFTInputVec.end(), rawadcBlock[wireIdx].begin(), [pedestal](const float& adc){return std::round(adc + pedestal);});
+    }
+
+    return;
+}
 }
@@ -62,10 +62,22 @@ public:
     void filterFFT(detinfo::DetectorClocksData const& clockData,
                    detinfo::DetectorPropertiesData const& detProp,
                    std::vector<short>&, size_t, size_t, float pedestal=0.);
-    
+
+    // Batched version of the above operating on a block of waveforms from the
+    // same plane. All waveforms are transformed with a plan cached on the
+    // waveform length and the filter multiply runs over the whole block in one
+    // vectorized pass (selected by the "FFTBackend" configuration parameter)
+    void filterFFT(detinfo::DetectorClocksData const& clockData,
+                   detinfo::DetectorPropertiesData const& detProp,
+                   std::vector<std::vector<short>>&, size_t, size_t, const std::vector<float>&);
+
 private:
-    
+
+    // Recover (and, if necessary, create) the cached FFT plan for waveforms of the given length
+    Eigen::FFT<float>& getFFTPlan(size_t fftDataSize);
+
     std::vector<bool>                                      fTransformViewVec;      ///< apply FFT transform to this view
+    std::string                                            fFFTBackend;            ///< "eigen" (per channel) or "eigenBlocked" (batched)
     bool                                                   fFillHistograms;        ///< if true then will fill diagnostic hists
     std::string                                            fHistDirName;           ///< If writing histograms, the folder name
     std::vector<size_t>                                    fLoWireByPlane;         ///< Low wire for individual wire histograms
@@ -87,6 +99,13 @@ private:
     
     std::unique_ptr<Eigen::FFT<float>>                     fEigenFFT;
 
+    // Plan cache for the batched backend, keyed on waveform length so plans
+    // (and their twiddle tables) are shared across every channel of an event
+    std::map<size_t,std::unique_ptr<Eigen::FFT<float>>>    fFFTPlanCache;
+
+    // Scratch block storage for the batched backend, reused event to event
+    std::vector<std::vector<std::complex<float>>>          fFFTBlockOutputVec;
+
     // Useful services, keep copies for now (we can update during begin run periods)
 };
     
@@ -10,6 +10,7 @@
 
 #include "icaruscode/TPC/SignalProcessing/RawDigitFilter/Algorithms/IRawDigitFilter.h"
 #include "icaruscode/TPC/SignalProcessing/RawDigitFilter/Algorithms/RawDigitCharacterizationAlg.h"
+#include "icaruscode/TPC/Utilities/tools/VectorMath.h"
 #include "icaruscode/TPC/SignalProcessing/RawDigitFilter/Algorithms/RawDigitBinAverageAlg.h"
 
 #include <cmath>
@@ -136,9 +137,8 @@ void RawDigitFilterAlg::FilterWaveform(RawDigitVector& dataVec, size_t channel,
         *meanVecItr++ = adaptVal;
     }
     
-    // Now do baseline correction
-    for(size_t idx = 0; idx < dataVec.size(); idx++)
-        dataVec[idx] = dataVec[idx] - std::round(meanVec[idx]);
+    // Now do baseline correction with the shared vectorizable kernel
+    icarusutil::subtractRoundedBaseline(dataVec.data(), meanVec.data(), dataVec.size());
 
     return;
 }
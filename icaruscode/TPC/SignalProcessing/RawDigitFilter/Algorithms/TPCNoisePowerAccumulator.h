@@ -0,0 +1,81 @@
+#ifndef TPCNOISEPOWERACCUMULATOR_H
+#define TPCNOISEPOWERACCUMULATOR_H
+////////////////////////////////////////////////////////////////////////
+//
+// Class:       TPCNoisePowerAccumulator
+// File:        TPCNoisePowerAccumulator.h
+//
+//              Persistent accumulation engine for the average FFT power
+//              spectra built by the TPCNoise and TPCNoiseMC modules.
+//              One contiguous block of double precision accumulators is
+//              sized once (when the number of frequency bins is known)
+//              and per-spectrum updates reduce to a simple add loop over
+//              contiguous memory, with no allocation in the event loop.
+//              The snapshot method returns the running average without
+//              disturbing the accumulation, so it can also be used for
+//              periodic monitoring output.
+//
+////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <array>
+#include <vector>
+
+namespace caldata
+{
+class TPCNoisePowerAccumulator
+{
+public:
+    // One accumulator slot per wire plane (0: induction 1, 1: induction 2, 2: collection)
+    static constexpr size_t NPlanes = 3;
+
+    TPCNoisePowerAccumulator() : fNumBins(0) {}
+
+    // (Re)size the contiguous accumulation block once the number of frequency
+    // bins is known; resets the accumulated contents and the entry counts
+    void prepare(size_t numBins)
+    {
+        fNumBins = numBins;
+        fAccumulators.assign(NPlanes * numBins, 0.);
+        fEntries.fill(0);
+    }
+
+    bool   prepared()              const {return fNumBins > 0;}
+    size_t numBins()               const {return fNumBins;}
+    size_t entries(size_t plane)   const {return fEntries.at(plane);}
+
+    // Add one power spectrum into the given plane's accumulator. The
+    // accumulators are contiguous so this is a tight loop the compiler
+    // can vectorize
+    void add(size_t plane, const std::vector<double>& power)
+    {
+        double*       acc   = &fAccumulators[plane * fNumBins];
+        const double* data  = power.data();
+        size_t        nBins = std::min(fNumBins, power.size());
+
+        for(size_t idx = 0; idx < nBins; idx++) acc[idx] += data[idx];
+
+        fEntries[plane]++;
+    }
+
+    // Copy out the accumulated spectrum of a plane divided by the given
+    // normalization; the accumulation itself is left untouched
+    void snapshot(size_t plane, std::vector<float>& average, double normalization) const
+    {
+        const double* acc = &fAccumulators[plane * fNumBins];
+
+        if (normalization <= 0.) normalization = 1.;
+
+        average.resize(fNumBins);
+
+        for(size_t idx = 0; idx < fNumBins; idx++) average[idx] = acc[idx] / normalization;
+    }
+
+private:
+    size_t                      fNumBins;      ///< number of frequency bins per plane
+    std::vector<double>         fAccumulators; ///< contiguous block, NPlanes x fNumBins
+    std::array<size_t, NPlanes> fEntries;      ///< number of spectra added per plane
+};
+} // namespace caldata
+
+#endif
@@ -0,0 +1,138 @@
+#ifndef WAVEFORMSTATISTICS_H
+#define WAVEFORMSTATISTICS_H
+////////////////////////////////////////////////////////////////////////
+//
+// File:        WaveformStatistics.h
+//
+//              Shared statistics kernels over raw ADC (int16) spans for
+//              the monitoring and characterization code paths. Every
+//              monitoring module used to carry its own mean/RMS/min-max
+//              loops over raw digits; these free functions centralize
+//              them as tight single pass loops over contiguous memory
+//              which the compiler can vectorize. Sums over short spans
+//              are blocked so the inner loop accumulates in 32 bit
+//              integers (more lanes per vector, no overflow within a
+//              block).
+//
+////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace caldata
+{
+namespace wavestats
+{
+    // Inner accumulation block: 32768 samples of at most 12 bits keep the
+    // running 32 bit block sum far from overflow
+    static constexpr size_t BlockSize = 32768;
+
+    // Sum of the samples of the span
+    inline long long sum(const short* data, size_t numSamples)
+    {
+        long long total(0);
+        size_t    idx(0);
+
+        while(idx < numSamples)
+        {
+            size_t blockEnd = std::min(numSamples, idx + BlockSize);
+            int    blockSum(0);
+
+            for(size_t sample = idx; sample < blockEnd; sample++) blockSum += data[sample];
+
+            total += blockSum;
+            idx    = blockEnd;
+        }
+
+        return total;
+    }
+
+    // Arithmetic mean of the span
+    inline float mean(const short* data, size_t numSamples)
+    {
+        if (numSamples == 0) return 0.;
+
+        return float(sum(data, numSamples)) / float(numSamples);
+    }
+
+    // Sum of squared deviations from the given pedestal; dividing by the
+    // number of samples and taking the square root gives the RMS
+    inline double sumSquaredDeviations(const short* data, size_t numSamples, float pedestal)
+    {
+        double total(0.);
+
+        for(size_t sample = 0; sample < numSamples; sample++)
+        {
+            double diff = double(data[sample]) - pedestal;
+
+            total += diff * diff;
+        }
+
+        return total;
+    }
+
+    // Same as above but counting only deviations within the given cut, as
+    // used by the truncated RMS calculations; count returns the number of
+    // samples kept
+    inline double sumSquaredDeviationsBelow(const short* data,
+                                            size_t       numSamples,
+                                            float        pedestal,
+                                            float        cut,
+                                            int&         count)
+    {
+        double total(0.);
+
+        count = 0;
+
+        for(size_t sample = 0; sample < numSamples; sample++)
+        {
+            double diff = double(data[sample]) - pedestal;
+
+            if (std::abs(diff) > cut) continue;
+
+            total += diff * diff;
+            count++;
+        }
+
+        return total;
+    }
+
+    // Smallest and largest sample of the span
+    inline std::pair<short,short> minmax(const short* data, size_t numSamples)
+    {
+        if (numSamples == 0) return {0, 0};
+
+        short minVal(data[0]);
+        short maxVal(data[0]);
+
+        for(size_t sample = 0; sample < numSamples; sample++)
+        {
+            minVal = std::min(minVal, data[sample]);
+            maxVal = std::max(maxVal, data[sample]);
+        }
+
+        return {minVal, maxVal};
+    }
+
+    // ADC frequency table of the span: freq[adc - minVal] counts the
+    // occurrences of adc. The table is sized by the caller (typically from
+    // the minmax() range) and is not cleared here
+    inline void frequencyTable(const short* data, size_t numSamples, short minVal, std::vector<int>& freq)
+    {
+        for(size_t sample = 0; sample < numSamples; sample++) freq[data[sample] - minVal]++;
+    }
+
+    // Pedestal subtracted copy of the span into a double buffer, as fed to
+    // the FFT power calculations
+    inline void subtractPedestal(const short* data, size_t numSamples, double pedestal, double* output)
+    {
+        for(size_t sample = 0; sample < numSamples; sample++) output[sample] = double(data[sample]) - pedestal;
+    }
+
+} // namespace wavestats
+} // namespace caldata
+
+#endif
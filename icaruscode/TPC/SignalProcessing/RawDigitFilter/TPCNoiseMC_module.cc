@@ -37,6 +37,7 @@
 
 // icaruscode Includes
 #include "icaruscode/TPC/SignalProcessing/RawDigitFilter/Algorithms/RawDigitCharacterizationAlg.h"
+#include "icaruscode/TPC/SignalProcessing/RawDigitFilter/Algorithms/TPCNoisePowerAccumulator.h"
 
 // icarus_signal_processing Includes
 #include "icarus_signal_processing/Filters/ICARUSFFT.h"
@@ -93,18 +94,8 @@ std::string fHistoFileName;
   FFTPointer fFFT;
   int NumberTimeSamples;
 
-  // FFT variables.
-  std::vector< std::vector<float> > fRawPowerC;
-  std::vector< std::vector<float> > fIntrinsicPowerC;
-std::vector< std::vector<float> > fCoherentPowerC;
- // FFT variables.
-  std::vector< std::vector<float> > fRawPowerI1;
-  std::vector< std::vector<float> > fIntrinsicPowerI1;
-std::vector< std::vector<float> > fCoherentPowerI1;
- // FFT variables.
-  std::vector< std::vector<float> > fRawPowerI2;
-  std::vector< std::vector<float> > fIntrinsicPowerI2;
-std::vector< std::vector<float> > fCoherentPowerI2;
+  // FFT power accumulator (one contiguous plane slot each for I1, I2, C).
+  caldata::TPCNoisePowerAccumulator fRawPower;
 
 // average FFT histos
 TH1D* fRawPowerHistoI1;
@@ -176,60 +167,9 @@ TPCNoiseMC::TPCNoiseMC::TPCNoiseMC(fhicl::ParameterSet const& p)
 
   std::cout << "Number of time samples: " << NumberTimeSamples << std::endl;
 
-  fRawPowerC.resize(1);
-  for(auto &it : fRawPowerC)
-    {
-      it.resize(NumberTimeSamples);
-    }
-std::cout << " after resizing " << std::endl;
-  fIntrinsicPowerC.resize(1);
-  for(auto &it : fIntrinsicPowerC)
-    {
-      it.resize(NumberTimeSamples);
-    }
-std::cout << " after resizing " << std::endl;
- fCoherentPowerC.resize(1);
-  for(auto &it : fCoherentPowerC)
-    {
-      it.resize(NumberTimeSamples);
-    }
-
-std::cout << " after resizing " << std::endl;
- fRawPowerI1.resize(1);
-  for(auto &it : fRawPowerI1)
-    {
-      it.resize(NumberTimeSamples);
-    }
-std::cout << " after resizing " << std::endl;
-  fIntrinsicPowerI1.resize(1);
-  for(auto &it : fIntrinsicPowerI1)
-    {
-      it.resize(NumberTimeSamples);
-    }
-std::cout << " after resizing " << std::endl;
- fCoherentPowerI1.resize(1);
-  for(auto &it : fCoherentPowerI1)
-    {
-      it.resize(NumberTimeSamples);
-    } 
-fCoherentPowerI2.resize(1);
-  for(auto &it : fCoherentPowerI2)
-    {
-      it.resize(NumberTimeSamples);
-    }
-std::cout << " after resizing " << std::endl;
- fRawPowerI2.resize(1);
-  for(auto &it : fRawPowerI2)
-    {
-      it.resize(NumberTimeSamples);
-    }
-std::cout << " after resizing " << std::endl;
-  fIntrinsicPowerI2.resize(1);
-  for(auto &it : fIntrinsicPowerI2)
-    {
-      it.resize(NumberTimeSamples);
-    }
-std::cout << " after intrinsic i2 resizing " << std::endl;
+  // Size the contiguous power accumulator once, up front.
+  fRawPower.prepare(NumberTimeSamples);
+std::cout << " after sizing the power accumulator " << std::endl;
 
   fFFT = std::make_unique<icarus_signal_processing::ICARUSFFT<double>>(NumberTimeSamples);
   this->reconfigure(p);
@@ -294,7 +234,14 @@ std::cout << " run " << fRun << std::endl;
   std::cout << " subrun " << fSubRun << std::endl;
   std::cout << "Processing event " << NEvents+1 << " for TPC Noise Analysis " << " Run " << fRun << ", " << "Event " << fEvent << "." << std::endl;
 
-  
+  // Scratch buffers reused for every channel below, so the spectral vectors
+  // are not reallocated once per channel.
+  std::vector<short>  RawADC;
+  std::vector<short>  SortedADC;
+  std::vector<float>  ADCLessPed;
+  std::vector<double> RawLessPed;
+  std::vector<double> power;
+
   ///////////////////////////
   // "Raw" RawDigits.
   ///////////////////////////
@@ -307,12 +254,11 @@ std::cout << " run " << fRun << std::endl;
     {
       // Grab raw waveform, ensuring that the size is set appropriately.
       unsigned int DataSize = RawDigit.Samples();
-      std::vector<short> RawADC;
       RawADC.resize(DataSize);
       raw::Uncompress(RawDigit.ADCs(), RawADC, RawDigit.Compression());
 
       // We need a sorted waveform (by absolute value) for the truncated RMS and median calculation.
-      std::vector<short> SortedADC(RawADC);
+      SortedADC = RawADC;
       std::sort(SortedADC.begin(),SortedADC.end(),[](const auto& left, const auto& right){return std::fabs(left) < std::fabs(right);});
       float median(SortedADC.at(SortedADC.size()/2));
 
@@ -325,7 +271,6 @@ size_t                   tpc  = widVec[0].TPC;
 size_t                   cryostat  = widVec[0].Cryostat;
 std::cout << " cryo " << cryostat << " tpc " << tpc << " plane " << plane <<" wire " << wire << std::endl; 
       // Remove pedestal of waveform.
-      std::vector<float> ADCLessPed;
       ADCLessPed.resize(SortedADC.size());
       std::transform(SortedADC.begin(),SortedADC.end(),ADCLessPed.begin(),std::bind(std::minus<float>(),std::placeholders::_1,median));
 
@@ -343,16 +288,12 @@ std::cout << " cryo " << cryostat << " tpc " << tpc << " plane " << plane <<" wi
       float truncrms(std::sqrt(std::inner_product(ADCLessPed.begin(), ADCLessPed.begin() + MinBins, ADCLessPed.begin(), 0.) / float(MinBins)));
 
       // Calculate the power.
-      std::vector<double> power(DataSize);
-      std::vector<double> RawLessPed;
+      power.assign(DataSize, 0.);
       RawLessPed.resize(RawADC.size());
       std::transform(RawADC.begin(),RawADC.end(),RawLessPed.begin(),std::bind(std::minus<double>(),std::placeholders::_1,median));
       fFFT->getFFTPower(RawLessPed, power);
 
-if(plane==0)  { 
-std::transform(fRawPowerI1.at(0).begin(), fRawPowerI1.at(0).end(), power.begin(), fRawPowerI1.at(0).begin(), std::plus<float>());  }
-if(plane==1)  { std::transform(fRawPowerI2.at(0).begin(), fRawPowerI2.at(0).end(), power.begin(), fRawPowerI2.at(0).begin(), std::plus<float>()); }
-if(plane==2)  { std::transform(fRawPowerC.at(0).begin(), fRawPowerC.at(0).end(), power.begin(), fRawPowerC.at(0).begin(), std::plus<float>()); }  
+if(plane<3)  { fRawPower.add(plane, power); }
 
 
       fPed.push_back(median);
@@ -425,15 +366,9 @@ double freqBin=0.6103515625;
   std::cout << "Averaging power vectors..." << std::endl;
   std::vector<float> TMPVect;
   fRawPowerTree->Branch("Power", &TMPVect);
-  for(auto &it : fRawPowerC)
-    {
-      std::transform(it.begin(), it.end(), it.begin(), std::bind(std::divides<float>(), std::placeholders::_1, NEvents));
-      TMPVect = it;
-   //   fRawPowerTree->Fill();
-     std::cout << " tmpvect size " << TMPVect.size() << std::endl;
+  fRawPower.snapshot(2, TMPVect, double(NEvents));
 for(unsigned int jv=0;jv<TMPVect.size();jv++)
   fRawPowerHistoC->Fill(jv*freqBin,TMPVect[jv]);
-    }
 std::cout << " after filling raw power histo " << std::endl;
  
 
@@ -450,18 +385,9 @@ std::cout << " after filling media histo " << std::endl;
   // Average the power vectors.
   std::cout << "Averaging power vectors..." << std::endl;
   //std::vector<float> TMPVect;
-  fRawPowerTree->Branch("Power", &TMPVect);
-int count=0;
-  for(auto &it : fRawPowerI1)
-    {
-     std::cout << " i1 counter " << count++ << std::endl;
-      std::transform(it.begin(), it.end(), it.begin(), std::bind(std::divides<float>(), std::placeholders::_1, NEvents));
-      TMPVect = it;
-     // fRawPowerTree->Fill();
-    // std::cout << " tmpvect size " << TMPVect.size() << std::endl;
+  fRawPower.snapshot(0, TMPVect, double(NEvents));
 for(unsigned int jv=0;jv<TMPVect.size();jv++)
   fRawPowerHistoI1->Fill(jv*freqBin,TMPVect[jv]);
-    }
 std::cout << " after filling raw power histo " << std::endl;
   
 
@@ -490,16 +416,9 @@ std::cout << " filling coherent RMS " << fCoherentRMSI1.at(j) << std::endl;
   // Average the power vectors.
   std::cout << "Averaging power vectors..." << std::endl;
   //std::vector<float> TMPVect;
-  fRawPowerTree->Branch("Power", &TMPVect);
-  for(auto &it : fRawPowerI2)
-    {
-      std::transform(it.begin(), it.end(), it.begin(), std::bind(std::divides<float>(), std::placeholders::_1, NEvents));
-      TMPVect = it;
-     // fRawPowerTree->Fill();
-     std::cout << " tmpvect size " << TMPVect.size() << std::endl;
+  fRawPower.snapshot(1, TMPVect, double(NEvents));
 for(unsigned int jv=0;jv<TMPVect.size();jv++)
   fRawPowerHistoI2->Fill(jv*freqBin,TMPVect[jv]);
-    }
 std::cout << " after filling raw power histo " << std::endl;
   
  for(unsigned int jj=0;jj<fRawRMSI2.size();jj++)
@@ -37,6 +37,8 @@
 
 // icaruscode Includes
 #include "icaruscode/TPC/SignalProcessing/RawDigitFilter/Algorithms/RawDigitCharacterizationAlg.h"
+#include "icaruscode/TPC/SignalProcessing/RawDigitFilter/Algorithms/TPCNoisePowerAccumulator.h"
+#include "icaruscode/TPC/SignalProcessing/RawDigitFilter/Algorithms/WaveformStatistics.h"
 
 // icarus_signal_processing Includes
 #include "icarus_signal_processing/Filters/ICARUSFFT.h"
@@ -96,18 +98,10 @@ std::string fHistoFileName;
   FFTPointer fFFT;
   int NumberTimeSamples;
 
-  // FFT variables.
-  std::vector< std::vector<float> > fRawPowerC;
-  std::vector< std::vector<float> > fIntrinsicPowerC;
-std::vector< std::vector<float> > fCoherentPowerC;
- // FFT variables.
-  std::vector< std::vector<float> > fRawPowerI1;
-  std::vector< std::vector<float> > fIntrinsicPowerI1;
-std::vector< std::vector<float> > fCoherentPowerI1;
- // FFT variables.
-  std::vector< std::vector<float> > fRawPowerI2;
-  std::vector< std::vector<float> > fIntrinsicPowerI2;
-std::vector< std::vector<float> > fCoherentPowerI2;
+  // FFT power accumulators (one contiguous plane slot each for I1, I2, C).
+  caldata::TPCNoisePowerAccumulator fRawPower;
+  caldata::TPCNoisePowerAccumulator fIntrinsicPower;
+  caldata::TPCNoisePowerAccumulator fCoherentPower;
 
 int ctI1, ctI2, ctC;
 
@@ -186,60 +180,11 @@ tpcnoise::TPCNoise::TPCNoise(fhicl::ParameterSet const& p)
   std::cout << "Number of time samples: " << NumberTimeSamples << std::endl;
 ctI1=0; ctI2=0; ctC=0;
 
-  fRawPowerC.resize(1);
-  for(auto &it : fRawPowerC)
-    {
-      it.resize(NumberTimeSamples);
-    }
-std::cout << " after resizing " << std::endl;
-  fIntrinsicPowerC.resize(1);
-  for(auto &it : fIntrinsicPowerC)
-    {
-      it.resize(NumberTimeSamples);
-    }
-std::cout << " after resizing " << std::endl;
- fCoherentPowerC.resize(1);
-  for(auto &it : fCoherentPowerC)
-    {
-      it.resize(NumberTimeSamples);
-    }
-
-std::cout << " after resizing " << std::endl;
- fRawPowerI1.resize(1);
-  for(auto &it : fRawPowerI1)
-    {
-      it.resize(NumberTimeSamples);
-    }
-std::cout << " after resizing " << std::endl;
-  fIntrinsicPowerI1.resize(1);
-  for(auto &it : fIntrinsicPowerI1)
-    {
-      it.resize(NumberTimeSamples);
-    }
-std::cout << " after resizing " << std::endl;
- fCoherentPowerI1.resize(1);
-  for(auto &it : fCoherentPowerI1)
-    {
-      it.resize(NumberTimeSamples);
-    } 
-fCoherentPowerI2.resize(1);
-  for(auto &it : fCoherentPowerI2)
-    {
-      it.resize(NumberTimeSamples);
-    }
-std::cout << " after resizing " << std::endl;
- fRawPowerI2.resize(1);
-  for(auto &it : fRawPowerI2)
-    {
-      it.resize(NumberTimeSamples);
-    }
-std::cout << " after resizing " << std::endl;
-  fIntrinsicPowerI2.resize(1);
-  for(auto &it : fIntrinsicPowerI2)
-    {
-      it.resize(NumberTimeSamples);
-    }
-std::cout << " after intrinsic i2 resizing " << std::endl;
+  // Size the contiguous power accumulators once, up front.
+  fRawPower.prepare(NumberTimeSamples);
+  fIntrinsicPower.prepare(NumberTimeSamples);
+  fCoherentPower.prepare(NumberTimeSamples);
+std::cout << " after sizing the power accumulators " << std::endl;
 
   fFFT = std::make_unique<icarus_signal_processing::ICARUSFFT<double>>(NumberTimeSamples);
   this->reconfigure(p);
@@ -306,7 +251,13 @@ std::cout << " run " << fRun << std::endl;
   std::cout << " subrun " << fSubRun << std::endl;
   std::cout << "Processing event " << NEvents+1 << " for TPC Noise Analysis " << " Run " << fRun << ", " << "Event " << fEvent << "." << std::endl;
 
-  
+  // Scratch buffers reused for every channel of every handle below, so the
+  // spectral vectors are not reallocated once per channel.
+  std::vector<short>  RawADC;
+  std::vector<short>  SortedADC;
+  std::vector<double> RawLessPed;
+  std::vector<double> power;
+
   ///////////////////////////
   // "Raw" RawDigits.
   ///////////////////////////
@@ -320,54 +271,46 @@ std::cout << " run " << fRun << std::endl;
     {
       // Grab raw waveform, ensuring that the size is set appropriately.
       unsigned int DataSize = RawDigit.Samples();
-      std::vector<short> RawADC;
       RawADC.resize(DataSize);
       raw::Uncompress(RawDigit.ADCs(), RawADC, RawDigit.Compression());
 
       // We need a sorted waveform (by absolute value) for the truncated RMS and median calculation.
-      std::vector<short> SortedADC(RawADC);
+      SortedADC = RawADC;
       std::sort(SortedADC.begin(),SortedADC.end(),[](const auto& left, const auto& right){return std::fabs(left) < std::fabs(right);});
       float median(SortedADC.at(SortedADC.size()/2));
 
       // Calculate mean values.
-      float mean(float(std::accumulate(SortedADC.begin(),SortedADC.end(),0))/float(SortedADC.size()));
+      float mean(caldata::wavestats::mean(SortedADC.data(), SortedADC.size()));
 std::vector<geo::WireID> widVec = geom->ChannelToWire(RawDigit.Channel());
         size_t                   plane  = widVec[0].Plane;
  size_t                   wire  = widVec[0].Wire;
 
 
-      // Remove pedestal of waveform.
-      std::vector<float> ADCLessPed;
-      ADCLessPed.resize(SortedADC.size());
-      std::transform(SortedADC.begin(),SortedADC.end(),ADCLessPed.begin(),std::bind(std::minus<float>(),std::placeholders::_1,median));
-
-      // Calculate full RMS.
-      float rms(std::sqrt(std::inner_product(ADCLessPed.begin(), ADCLessPed.end(), ADCLessPed.begin(), 0.) / float(ADCLessPed.size())));
+      // Calculate full RMS (on the pedestal subtracted waveform).
+      float rms(std::sqrt(caldata::wavestats::sumSquaredDeviations(SortedADC.data(), SortedADC.size(), median) / float(SortedADC.size())));
 
       // Calculate the truncated RMS.
-      unsigned int MinBins((1.0 - 0.01)*ADCLessPed.size());
+      unsigned int MinBins((1.0 - 0.01)*SortedADC.size());
       //unsigned int BinsToKeep;
       //for(BinsToKeep = 0; BinsToKeep < ADCLessPed.size(); ++BinsToKeep)
       //{
       //  if(std::fabs(ADCLessPed.at(BinsToKeep)) >= 3*rms) break;
       //}
       //float truncrms(std::sqrt(std::inner_product(ADCLessPed.begin(), ADCLessPed.begin() + BinsToKeep, ADCLessPed.begin(), 0.) / float(BinsToKeep)));
-      float truncrms(std::sqrt(std::inner_product(ADCLessPed.begin(), ADCLessPed.begin() + MinBins, ADCLessPed.begin(), 0.) / float(MinBins)));
+      float truncrms(std::sqrt(caldata::wavestats::sumSquaredDeviations(SortedADC.data(), MinBins, median) / float(MinBins)));
 
       // Calculate the power.
-      std::vector<double> power(DataSize);
-      std::vector<double> RawLessPed;
+      power.assign(DataSize, 0.);
       RawLessPed.resize(RawADC.size());
-      std::transform(RawADC.begin(),RawADC.end(),RawLessPed.begin(),std::bind(std::minus<double>(),std::placeholders::_1,median));
+      caldata::wavestats::subtractPedestal(RawADC.data(), RawADC.size(), median, RawLessPed.data());
     fFFT->getFFTPower(RawLessPed, power);
 
 
     
-if(plane==0&&wire!=32&&wire<3000)  {
-std::transform(fRawPowerI1.at(0).begin(), fRawPowerI1.at(0).end(), power.begin(), fRawPowerI1.at(0).begin(), std::plus<float>());  ctI1++; }
-if(plane==1)  { std::transform(fRawPowerI2.at(0).begin(), fRawPowerI2.at(0).end(), power.begin(), fRawPowerI2.at(0).begin(), std::plus<float>()); ctI2++; }
+if(plane==0&&wire!=32&&wire<3000)  { fRawPower.add(plane, power);  ctI1++; }
+if(plane==1)  { fRawPower.add(plane, power); ctI2++; }
 
-if(plane==2)  { std::transform(fRawPowerC.at(0).begin(), fRawPowerC.at(0).end(), power.begin(), fRawPowerC.at(0).begin(), std::plus<float>()); ctC++; }  
+if(plane==2)  { fRawPower.add(plane, power); ctC++; }
 
 
       fPed.push_back(median);
@@ -383,9 +326,10 @@ if(plane==0&&wire!=32&&wire<3000) {  fRawRMSI1.push_back(rms);   }
 
     }
 float intI1=0, intI2=0, intC=0;
-std::vector<float> rpi1=fRawPowerI1.at(0);
-std::vector<float> rpi2=fRawPowerI2.at(0);
-std::vector<float> rpc=fRawPowerC.at(0);
+std::vector<float> rpi1, rpi2, rpc;
+fRawPower.snapshot(0, rpi1, 1.);
+fRawPower.snapshot(1, rpi2, 1.);
+fRawPower.snapshot(2, rpc, 1.);
 for (unsigned int j=0; j< rpi1.size(); j++) intI1+=rpi1.at(j); 
 for (unsigned int j=0; j< rpi2.size(); j++) intI2+=rpi2.at(j); 
 for (unsigned int j=0; j< rpc.size(); j++) intC+=rpc.at(j); 
@@ -404,49 +348,39 @@ std::cout << " intrinsic instance " << fIntrinsicInstance << std::endl;
     {
       // Grab raw waveform, ensuring that the size is set appropriately.
       unsigned int DataSize = RawDigit.Samples();
-      std::vector<short> RawADC;
       RawADC.resize(DataSize);
       raw::Uncompress(RawDigit.ADCs(), RawADC, RawDigit.Compression());
 
       // We need a sorted waveform (by absolute value) for the truncated RMS and median calculation.
-      std::vector<short> SortedADC(RawADC);
+      SortedADC = RawADC;
       std::sort(SortedADC.begin(),SortedADC.end(),[](const auto& left, const auto& right){return std::fabs(left) < std::fabs(right);});
       float median(SortedADC.at(SortedADC.size()/2));
 
       // Calculate mean values.
-      float mean(float(std::accumulate(SortedADC.begin(),SortedADC.end(),0))/float(SortedADC.size()));
-
-      // Remove pedestal of waveform.
-      std::vector<short> ADCLessPed;
-      ADCLessPed.resize(SortedADC.size());
-      std::transform(SortedADC.begin(),SortedADC.end(),ADCLessPed.begin(),std::bind(std::minus<float>(),std::placeholders::_1,median));
+      float mean(caldata::wavestats::mean(SortedADC.data(), SortedADC.size()));
 
-      // Calculate full RMS.
-      float rms(std::sqrt(std::inner_product(ADCLessPed.begin(), ADCLessPed.end(), ADCLessPed.begin(), 0.) / float(ADCLessPed.size())));
+      // Calculate full RMS (on the pedestal subtracted waveform).
+      float rms(std::sqrt(caldata::wavestats::sumSquaredDeviations(SortedADC.data(), SortedADC.size(), median) / float(SortedADC.size())));
 
       // Calculate the truncated RMS.
-      unsigned int MinBins((1.0 - 0.2)*ADCLessPed.size());
+      unsigned int MinBins((1.0 - 0.2)*SortedADC.size());
       //unsigned int BinsToKeep;
-      //for(BinsToKeep = 0; BinsToKeep < ADCLessPed.size(); ++BinsToKeep)
+      //for(BinsToKeep = 0; BinsToKeep < ADCLessPedS.size(); ++BinsToKeep)
       //{
-      //  if(std::fabs(ADCLessPed.at(BinsToKeep)) >= 3*rms) break;
+      //  if(std::fabs(ADCLessPedS.at(BinsToKeep)) >= 3*rms) break;
       //}
-      //float truncrms(std::sqrt(std::inner_product(ADCLessPed.begin(), ADCLessPed.begin() + BinsToKeep, ADCLessPed.begin(), 0.) / float(BinsToKeep)));
-      float truncrms(std::sqrt(std::inner_product(ADCLessPed.begin(), ADCLessPed.begin() + MinBins, ADCLessPed.begin(), 0.) / float(MinBins)));
+      //float truncrms(std::sqrt(std::inner_product(ADCLessPedS.begin(), ADCLessPedS.begin() + BinsToKeep, ADCLessPedS.begin(), 0.) / float(BinsToKeep)));
+      float truncrms(std::sqrt(caldata::wavestats::sumSquaredDeviations(SortedADC.data(), MinBins, median) / float(MinBins)));
 
       // Calculate the power.
-      std::vector<double> power(DataSize);
-      std::vector<double> RawLessPed;
+      power.assign(DataSize, 0.);
       RawLessPed.resize(RawADC.size());
-      std::transform(RawADC.begin(),RawADC.end(),RawLessPed.begin(),std::bind(std::minus<double>(),std::placeholders::_1,median));
+      caldata::wavestats::subtractPedestal(RawADC.data(), RawADC.size(), median, RawLessPed.data());
       fFFT->getFFTPower(RawLessPed, power);
 std::vector<geo::WireID> widVec = geom->ChannelToWire(RawDigit.Channel());
         size_t                   plane  = widVec[0].Plane;
 
-if(plane==0)  { std::transform(fIntrinsicPowerI1.at(0).begin(), fIntrinsicPowerI1.at(0).end(), power.begin(), fIntrinsicPowerI1.at(0).begin(), std::plus<float>());  }
-if(plane==1)  { std::transform(fIntrinsicPowerI2.at(0).begin(), fIntrinsicPowerI2.at(0).end(), power.begin(), fIntrinsicPowerI2.at(0).begin(), std::plus<float>()); }
-if(plane==2)  { std::transform(fIntrinsicPowerC.at(0).begin(), fIntrinsicPowerC.at(0).end(), power.begin(), fIntrinsicPowerC.at(0).begin(), std::plus<float>());  }   
-     // std::transform(fIntrinsicPower.at(RawDigit.Channel()).begin(), fIntrinsicPower.at(RawDigit.Channel()).end(), power.begin(), fIntrinsicPower.at(RawDigit.Channel()).begin(), std::plus<float>());
+if(plane<3)  { fIntrinsicPower.add(plane, power); }
 
       fIntrinsicMean.push_back(mean);
   if(plane==2)  {  fIntrinsicRMSC.push_back(rms);}
@@ -473,12 +407,11 @@ std::cout << " coherent instance " << fCoherentInstance << std::endl;
 
       // Grab raw waveform, ensuring that the size is set appropriately.
       unsigned int DataSize = RawDigit.Samples();
-      std::vector<short> RawADC;
       RawADC.resize(DataSize);
       raw::Uncompress(RawDigit.ADCs(), RawADC, RawDigit.Compression());
 
       // We need a sorted waveform (by absolute value) for the truncated RMS and median calculation.
-      std::vector<short> SortedADC(RawADC);
+      SortedADC = RawADC;
       std::sort(SortedADC.begin(),SortedADC.end(),[](const auto& left, const auto& right){return std::fabs(left) < std::fabs(right);});
       float median(SortedADC.at(SortedADC.size()/2));
 //for(unsigned int jadc=0;jadc<SortedADC.size();jadc++)
@@ -486,38 +419,30 @@ std::cout << " coherent instance " << fCoherentInstance << std::endl;
   //std::cout << " sorted adc " << SortedADC.at(jadc) << std::endl;
 
       // Calculate mean values.
-      float mean(float(std::accumulate(SortedADC.begin(),SortedADC.end(),0))/float(SortedADC.size()));
+      float mean(caldata::wavestats::mean(SortedADC.data(), SortedADC.size()));
 
-      // Remove pedestal of waveform.
-      std::vector<short> ADCLessPed;
-      ADCLessPed.resize(SortedADC.size());
-      std::transform(SortedADC.begin(),SortedADC.end(),ADCLessPed.begin(),std::bind(std::minus<float>(),std::placeholders::_1,median));
-
-      // Calculate full RMS.
-      float rms(std::sqrt(std::inner_product(ADCLessPed.begin(), ADCLessPed.end(), ADCLessPed.begin(), 0.) / float(ADCLessPed.size())));
+      // Calculate full RMS (on the pedestal subtracted waveform).
+      float rms(std::sqrt(caldata::wavestats::sumSquaredDeviations(SortedADC.data(), SortedADC.size(), median) / float(SortedADC.size())));
 
       // Calculate the truncated RMS.
-      unsigned int MinBins((1.0 - 0.2)*ADCLessPed.size());
+      unsigned int MinBins((1.0 - 0.2)*SortedADC.size());
       //unsigned int BinsToKeep;
-      //for(BinsToKeep = 0; BinsToKeep < ADCLessPed.size(); ++BinsToKeep)
+      //for(BinsToKeep = 0; BinsToKeep < ADCLessPedS.size(); ++BinsToKeep)
       //{
-      //  if(std::fabs(ADCLessPed.at(BinsToKeep)) >= 3*rms) break;
+      //  if(std::fabs(ADCLessPedS.at(BinsToKeep)) >= 3*rms) break;
       //}
-      //float truncrms(std::sqrt(std::inner_product(ADCLessPed.begin(), ADCLessPed.begin() + BinsToKeep, ADCLessPed.begin(), 0.) / float(BinsToKeep)));
-      float truncrms(std::sqrt(std::inner_product(ADCLessPed.begin(), ADCLessPed.begin() + MinBins, ADCLessPed.begin(), 0.) / float(MinBins)));
+      //float truncrms(std::sqrt(std::inner_product(ADCLessPedS.begin(), ADCLessPedS.begin() + BinsToKeep, ADCLessPedS.begin(), 0.) / float(BinsToKeep)));
+      float truncrms(std::sqrt(caldata::wavestats::sumSquaredDeviations(SortedADC.data(), MinBins, median) / float(MinBins)));
 
       // Calculate the power.
-      std::vector<double> power(DataSize);
-      std::vector<double> RawLessPed;
+      power.assign(DataSize, 0.);
       RawLessPed.resize(RawADC.size());
-      std::transform(RawADC.begin(),RawADC.end(),RawLessPed.begin(),std::bind(std::minus<double>(),std::placeholders::_1,median));
+      caldata::wavestats::subtractPedestal(RawADC.data(), RawADC.size(), median, RawLessPed.data());
       fFFT->getFFTPower(RawLessPed, power);
 std::vector<geo::WireID> widVec = geom->ChannelToWire(RawDigit.Channel());
         size_t                   plane  = widVec[0].Plane;
      
-if(plane==0)  { std::transform(fCoherentPowerI1.at(0).begin(), fCoherentPowerI1.at(0).end(), power.begin(), fCoherentPowerI1.at(0).begin(), std::plus<float>());  }
-if(plane==1)  { std::transform(fCoherentPowerI2.at(0).begin(), fCoherentPowerI2.at(0).end(), power.begin(), fCoherentPowerI2.at(0).begin(), std::plus<float>()); }
-if(plane==2)  { std::transform(fCoherentPowerC.at(0).begin(), fCoherentPowerC.at(0).end(), power.begin(), fCoherentPowerC.at(0).begin(), std::plus<float>());  }
+if(plane<3)  { fCoherentPower.add(plane, power); }
 
 //if(rms) std::cout << " coherent mean " << mean << " rms " << rms << std::endl;
       fCoherentMean.push_back(mean);
@@ -590,73 +515,26 @@ double freqBin=0.6103515625;
 
 std::cout << " ctI1 " << ctI1 << " ctI2 " << ctI2 << " ctC " << ctC << std::endl;
 
-for(unsigned int j=0;j<(fRawPowerI1.at(0)).size();j++) {(fRawPowerI1.at(0)).at(j)/=2110;}
-for(unsigned int j=0;j<(fCoherentPowerI1.at(0)).size();j++) {(fCoherentPowerI1.at(0)).at(j)/=2110;}
-for(unsigned int j=0;j<(fIntrinsicPowerI1.at(0)).size();j++) {(fIntrinsicPowerI1.at(0)).at(j)/=2110;}
-for(unsigned int j=0;j<(fRawPowerI2.at(0)).size();j++) {(fRawPowerI2.at(0)).at(j)/=5600;}
-for(unsigned int j=0;j<(fCoherentPowerI2.at(0)).size();j++) {(fCoherentPowerI2.at(0)).at(j)/=5600;}
-for(unsigned int j=0;j<(fIntrinsicPowerI2.at(0)).size();j++) {(fIntrinsicPowerI2.at(0)).at(j)/=5600;}
-for(unsigned int j=0;j<(fRawPowerC.at(0)).size();j++) {(fRawPowerC.at(0)).at(j)/=5600;}
-for(unsigned int j=0;j<(fCoherentPowerC.at(0)).size();j++) {(fCoherentPowerC.at(0)).at(j)/=5600;}
-for(unsigned int j=0;j<(fIntrinsicPowerC.at(0)).size();j++) {(fIntrinsicPowerC.at(0)).at(j)/=5600;}
-
-
-  // Average the power vectors.
+  // Average the power vectors: take snapshots of the running accumulators,
+  // normalized by the number of events and the historical per-plane factors.
   std::cout << "Averaging power vectors..." << std::endl;
   std::vector<float> TMPVect;
   fRawPowerTree->Branch("Power", &TMPVect);
-int count=0;
-  for(auto &it : fRawPowerC)
-    {
-count++;
-      std::transform(it.begin(), it.end(), it.begin(), std::bind(std::divides<float>(), std::placeholders::_1, NEvents));
-      TMPVect = it;
-   //   fRawPowerTree->Fill();
-     std::cout << " tmpvect size " << TMPVect.size() << std::endl;
-for(unsigned int jv=0;jv<TMPVect.size();jv++) {
- std::cout << " filling raw power " << jv*freqBin << std::endl;
-//if(jv==100)
-  fRawPowerHistoC->Fill(jv*freqBin,TMPVect[jv]);
+  fIntrinsicPowerTree->Branch("Power", &TMPVect);
+  fCoherentPowerTree->Branch("Power", &TMPVect);
 
-    }
-}
+  fRawPower.snapshot(2, TMPVect, 5600. * NEvents);
+for(unsigned int jv=0;jv<TMPVect.size();jv++)
+  fRawPowerHistoC->Fill(jv*freqBin,TMPVect[jv]);
 std::cout << " raw power entries " << fRawPowerHistoC->GetEntries() << std::endl;
-std::cout << " raw power count " << count << std::endl;
-fRawPowerHistoC->Scale(1./count);
 std::cout << " after filling raw power histo " << std::endl;
-  fIntrinsicPowerTree->Branch("Power", &TMPVect);
-count=0;
-  for(auto &it : fIntrinsicPowerC)
-    {
-count++;
-      std::transform(it.begin(), it.end(), it.begin(), std::bind(std::divides<float>(), std::placeholders::_1, NEvents));
-      TMPVect = it;
-  std::cout << " tmpvect size " << TMPVect.size() << std::endl;
-   //   fIntrinsicPowerTree->Fill();
-  std::cout << " after fill tmpvect size " << TMPVect.size() << std::endl;
-for(unsigned int jv=0;jv<TMPVect.size();jv++) {
-//std::cout << " filling jv " << jv << std::endl; 
-
- fIntrinsicPowerHistoC->Fill(jv*freqBin,TMPVect[jv]);
-}
-fIntrinsicPowerHistoC->Scale(1./count);
+  fIntrinsicPower.snapshot(2, TMPVect, 5600. * NEvents);
+for(unsigned int jv=0;jv<TMPVect.size();jv++)
+  fIntrinsicPowerHistoC->Fill(jv*freqBin,TMPVect[jv]);
 std::cout << " after filling intrinsic power histo " << std::endl;
-    }
-
-  fCoherentPowerTree->Branch("Power", &TMPVect);
-count=0;
-  for(auto &it : fCoherentPowerC)
-    {
-count++;
-      std::transform(it.begin(), it.end(), it.begin(), std::bind(std::divides<float>(), std::placeholders::_1, NEvents));
-      TMPVect = it;
-
-    //  fCoherentPowerTree->Fill();
-
+  fCoherentPower.snapshot(2, TMPVect, 5600. * NEvents);
 for(unsigned int jv=0;jv<TMPVect.size();jv++)
   fCoherentPowerHistoC->Fill(jv*freqBin,TMPVect[jv]);
-    }
-fCoherentPowerHistoC->Scale(1./count);
 std::cout << " frawrmsc size " << fRawRMSC.size() << std::endl;
  for(unsigned int jj=0;jj<fRawRMSC.size();jj++)
   fRawRMSHistoC->Fill(fRawRMSC.at(jj));
@@ -679,54 +557,17 @@ for(unsigned int j=0;j<fCoherentRMSC.size();j++) {
 
   // Average the power vectors.
   std::cout << "Averaging power vectors..." << std::endl;
-  //std::vector<float> TMPVect;
-  fRawPowerTree->Branch("Power", &TMPVect);
-count=0;
-  for(auto &it : fRawPowerI1)
-    {
-     std::cout << " i1 counter " << count++ << std::endl;
-      std::transform(it.begin(), it.end(), it.begin(), std::bind(std::divides<float>(), std::placeholders::_1, NEvents));
-      TMPVect = it;
-     // fRawPowerTree->Fill();
-    // std::cout << " tmpvect size " << TMPVect.size() << std::endl;
+  fRawPower.snapshot(0, TMPVect, 2110. * NEvents);
 for(unsigned int jv=0;jv<TMPVect.size();jv++)
-//if(jv==100)
   fRawPowerHistoI1->Fill(jv*freqBin,TMPVect[jv]);
-    }
-fRawPowerHistoI1->Scale(1./count);
 std::cout << " after filling raw power histo " << std::endl;
-  fIntrinsicPowerTree->Branch("Power", &TMPVect);
-count=0;
-  for(auto &it : fIntrinsicPowerI1)
-    {
- std::cout << " i1 counter " << count++ << std::endl;
-      std::transform(it.begin(), it.end(), it.begin(), std::bind(std::divides<float>(), std::placeholders::_1, NEvents));
-      TMPVect = it;
-  //astd::cout << " tmpvect size " << TMPVect.size() << std::endl;
-    //  fIntrinsicPowerTree->Fill();
- // std::cout << " after fill tmpvect size " << TMPVect.size() << std::endl;
-for(unsigned int jv=0;jv<TMPVect.size();jv++) {
-//std::cout << " filling jv " << jv << std::endl; 
- fIntrinsicPowerHistoI1->Fill(jv*freqBin,TMPVect[jv]);
-}
-fIntrinsicPowerHistoI1->Scale(1./count);
+  fIntrinsicPower.snapshot(0, TMPVect, 2110. * NEvents);
+for(unsigned int jv=0;jv<TMPVect.size();jv++)
+  fIntrinsicPowerHistoI1->Fill(jv*freqBin,TMPVect[jv]);
 std::cout << " after filling intrinsic power histo " << std::endl;
-    }
-
-  fCoherentPowerTree->Branch("Power", &TMPVect);
-count=0;
-  for(auto &it : fCoherentPowerI1)
-    {
- std::cout << " i1 counter " << count++ << std::endl;
-      std::transform(it.begin(), it.end(), it.begin(), std::bind(std::divides<float>(), std::placeholders::_1, NEvents));
-      TMPVect = it;
-
-     // fCoherentPowerTree->Fill();
-
+  fCoherentPower.snapshot(0, TMPVect, 2110. * NEvents);
 for(unsigned int jv=0;jv<TMPVect.size();jv++)
   fCoherentPowerHistoI1->Fill(jv*freqBin,TMPVect[jv]);
-    }
-fCoherentPowerHistoI1->Scale(1./count);
 std::cout << " rawrmsi1 size " << fRawRMSI1.size() << std::endl;
  for(unsigned int jj=0;jj<fRawRMSI1.size();jj++) {
 std::cout << " filling rawrmsi1 value " << fRawRMSI1.at(jj) << std::endl;
@@ -751,54 +592,17 @@ std::cout << " filling coherent RMS " << fCoherentRMSI1.at(j) << std::endl;
 
   // Average the power vectors.
   std::cout << "Averaging power vectors..." << std::endl;
-  //std::vector<float> TMPVect;
-  fRawPowerTree->Branch("Power", &TMPVect);
-count=0;
-  for(auto &it : fRawPowerI2)
-    {
-count++;
-      std::transform(it.begin(), it.end(), it.begin(), std::bind(std::divides<float>(), std::placeholders::_1, NEvents));
-      TMPVect = it;
-     // fRawPowerTree->Fill();
-     std::cout << " tmpvect size " << TMPVect.size() << std::endl;
+  fRawPower.snapshot(1, TMPVect, 5600. * NEvents);
 for(unsigned int jv=0;jv<TMPVect.size();jv++)
-//if(jv==100)
   fRawPowerHistoI2->Fill(jv*freqBin,TMPVect[jv]);
-    }
 std::cout << " after filling raw power histo " << std::endl;
-fRawPowerHistoI2->Scale(1./count);
-  fIntrinsicPowerTree->Branch("Power", &TMPVect);
-count=0;
-  for(auto &it : fIntrinsicPowerI2)
-    {
-count++;
-      std::transform(it.begin(), it.end(), it.begin(), std::bind(std::divides<float>(), std::placeholders::_1, NEvents));
-      TMPVect = it;
-  std::cout << " tmpvect size " << TMPVect.size() << std::endl;
-   //   fIntrinsicPowerTree->Fill();
-  std::cout << " after fill tmpvect size " << TMPVect.size() << std::endl;
-for(unsigned int jv=0;jv<TMPVect.size();jv++) {
-//std::cout << " filling jv " << jv << std::endl; 
- fIntrinsicPowerHistoI2->Fill(jv*freqBin,TMPVect[jv]);
-}
-fIntrinsicPowerHistoI2->Scale(1./count);
+  fIntrinsicPower.snapshot(1, TMPVect, 5600. * NEvents);
+for(unsigned int jv=0;jv<TMPVect.size();jv++)
+  fIntrinsicPowerHistoI2->Fill(jv*freqBin,TMPVect[jv]);
 std::cout << " after filling intrinsic power histo " << std::endl;
-    }
-
-  fCoherentPowerTree->Branch("Power", &TMPVect);
-count=0;
-  for(auto &it : fCoherentPowerI2)
-    {
-count++;
-      std::transform(it.begin(), it.end(), it.begin(), std::bind(std::divides<float>(), std::placeholders::_1, NEvents));
-      TMPVect = it;
-
-    //  fCoherentPowerTree->Fill();
-
+  fCoherentPower.snapshot(1, TMPVect, 5600. * NEvents);
 for(unsigned int jv=0;jv<TMPVect.size();jv++)
   fCoherentPowerHistoI2->Fill(jv*freqBin,TMPVect[jv]);
-    }
-fCoherentPowerHistoI2->Scale(1./count);
 std::cout << " after filling coherent power histo " << std::endl;
  for(unsigned int jj=0;jj<fRawRMSI2.size();jj++)
   fRawRMSHistoI2->Fill(fRawRMSI2.at(jj));
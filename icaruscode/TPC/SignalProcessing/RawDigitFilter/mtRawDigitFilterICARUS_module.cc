@@ -1,10 +1,12 @@
 #include <cmath>
 #include <algorithm>
 #include <vector>
-#include <numeric> // std::accumulate
+#include <numeric> // std::accumulate, std::iota
+#include <chrono>
 
 #include "tbb/parallel_for.h"
 #include "tbb/blocked_range.h"
+#include "tbb/enumerable_thread_specific.h"
 
 #include "TComplex.h"
 
@@ -103,6 +105,19 @@ private:
 
     void saveRawDigits(std::unique_ptr<std::vector<raw::RawDigit> >&, raw::ChannelID_t&, caldata::RawDigitVector&, float, float);
 
+    // .. Build the output RawDigit, compressing the waveform on the calling
+    //    (worker) thread if so configured. May consume the input vector
+    raw::RawDigit packRawDigit(raw::ChannelID_t channel, caldata::RawDigitVector& adcVec) const;
+
+public:
+    // .. Scheduler feedback: record the measured cost of one channel and account
+    //    the busy time of the calling thread (see lartbb_WaveformChar below)
+    void recordChannelCost(raw::ChannelID_t channel, double seconds) const;
+    double channelCost(raw::ChannelID_t channel) const;
+    void recordThreadBusyTime(double seconds) const;
+
+private:
+
     // Fcl parameters.
     std::string          fDigitModuleLabel;      ///< The full collection of hits
     bool                 fTruncateTicks;         ///< If true then drop ticks off ends of wires
@@ -123,10 +138,19 @@ private:
     std::vector<float>   fRmsRejectionCutLow;    ///< Minimum rms to consider channel "alive"
     std::vector<float>   fNumRmsToSmoothVec;     ///< # "sigma" to smooth correlated correction vec
     std::vector<double>  fFFTMinPowerThreshold;  ///< Threshold for trimming FFT power spectrum
+    bool                 fAdaptiveScheduling;    ///< Order channels by measured cost so TBB stealing balances the tail
+    unsigned int         fSchedulerGrainSize;    ///< # channels per stealable task when adaptive scheduling is on
+    bool                 fWorkerFirstTouch;      ///< Allocate waveform buffers on the worker threads (NUMA first touch)
+    bool                 fCompressOutput;        ///< Huffman compress the output waveforms, on the worker threads
 
     // Statistics.
     int fNumEvent;        ///< Number of events seen.
 
+    // Scheduler feedback. Each channel index is written by exactly one task per
+    // event so no synchronization beyond the parallel_for join is needed
+    mutable std::vector<float>                    fChannelCostVec;  ///< running cost estimate per channel (seconds)
+    mutable tbb::enumerable_thread_specific<double> fThreadBusyTime; ///< accumulated busy time per worker thread
+
     // Correction algorithms
     caldata::RawDigitBinAverageAlg               fBinAverageAlg;
     caldata::RawDigitCharacterizationAlg       fCharacterizationAlg;
@@ -159,7 +183,8 @@ class lartbb_WaveformChar {
       vector<vector<caldata::RawDigitVector>>& rawadcgv,
       vector<vector<WireChar>>& wgcv,
       vector<vector<vector <int>>>& wgqv,
-      std::unique_ptr<std::vector<raw::RawDigit> >& filteredrawdigit)
+      std::unique_ptr<std::vector<raw::RawDigit> >& filteredrawdigit,
+      const vector<size_t>& schedule)
       : prod(prod),
         fDataSize(fdatasize),
         fftSize(fftsize),
@@ -170,11 +195,22 @@ class lartbb_WaveformChar {
         rawadcgvec(rawadcgv),
         wgcvec(wgcv),
         wgqvec(wgqv),
-        filteredRawDigit(filteredrawdigit){}
+        filteredRawDigit(filteredrawdigit),
+        scheduleVec(schedule){}
     void operator()(const tbb::blocked_range<size_t>& range) const{
       //std::cout << " !!!!!!!!!! range.begin(): " << range.begin() << " and range.end(): " << range.end() << std::endl;
-      for (size_t i = range.begin(); i < range.end(); ++i)
-        prod.WaveformChar(i, fDataSize, fftSize, fplan, rplan, igwvec, rawDigitVec, rawadcgvec, wgcvec, wgqvec, filteredRawDigit);
+      auto rangeStart = std::chrono::steady_clock::now();
+      for (size_t i = range.begin(); i < range.end(); ++i){
+        // .. The schedule vector maps task order back to channel order so the most
+        //    expensive channels (from the previous event) are handed out first
+        size_t idx = scheduleVec[i];
+        auto chanStart = std::chrono::steady_clock::now();
+        prod.WaveformChar(idx, fDataSize, fftSize, fplan, rplan, igwvec, rawDigitVec, rawadcgvec, wgcvec, wgqvec, filteredRawDigit);
+        std::chrono::duration<double> chanTime = std::chrono::steady_clock::now() - chanStart;
+        prod.recordChannelCost(rawDigitVec.at(igwvec[idx].irawdig)->Channel(), chanTime.count());
+      }
+      std::chrono::duration<double> rangeTime = std::chrono::steady_clock::now() - rangeStart;
+      prod.recordThreadBusyTime(rangeTime.count());
     }
   private:
     RawDigitFilterICARUS const & prod;
@@ -188,6 +224,7 @@ class lartbb_WaveformChar {
     vector<vector<WireChar>>& wgcvec;
     vector<vector<vector <int>>>& wgqvec;
     std::unique_ptr<std::vector<raw::RawDigit> >& filteredRawDigit;
+    const vector<size_t>& scheduleVec;
 };
 
 //----------------------------------------------------------------------------
@@ -274,6 +311,11 @@ void RawDigitFilterICARUS::configure(fhicl::ParameterSet const & pset)
     fApplyFFTCorrection    = pset.get<bool>               ("ApplyFFTCorrection",                                       true);
     fFFTMinPowerThreshold  = pset.get<std::vector<double>>("FFTPowerThreshold",     std::vector<double>() = {100.,75.,500.});
     fApplyTopHatFilter     = pset.get<bool>               ("ApplyTopHatFilter",                                        true);
+    // .. scheduling
+    fAdaptiveScheduling    = pset.get<bool>               ("AdaptiveScheduling",                                       true);
+    fSchedulerGrainSize    = pset.get<unsigned int>       ("SchedulerGrainSize",                                         16);
+    fWorkerFirstTouch      = pset.get<bool>               ("WorkerFirstTouch",                                         true);
+    fCompressOutput        = pset.get<bool>               ("CompressOutput",                                          false);
 
     fRawDigitFilterTool = art::make_tool<caldata::IRawDigitFilter>(pset.get<fhicl::ParameterSet>("RawDigitFilterTool"));
 
@@ -390,7 +432,14 @@ void RawDigitFilterICARUS::produce(art::Event & event, art::ProcessingFrame cons
 	          << " for channel: " << channel << ", plane: " << plane << ", wire: " << wire << std::endl;
         continue;
       }
-      rawadcvec.push_back(rawadc);
+      // .. On NUMA nodes the memory pages of a buffer belong to the node of the
+      //    thread which first writes them. Pushing the pre-zeroed rawadc here
+      //    would first-touch every waveform buffer from this (main) thread and
+      //    concentrate them all on its node; instead an empty buffer is staged
+      //    and WaveformChar(), running on the worker thread which actually
+      //    processes the channel, sizes it on first use
+      if (fWorkerFirstTouch) rawadcvec.push_back({});
+      else                   rawadcvec.push_back(rawadc);
 
       unsigned int wireIdx  = wire % fNumWiresToGroup[plane];
       //std::cout << "Channel = " << channel << " wire = " << wire
@@ -458,10 +507,28 @@ void RawDigitFilterICARUS::produce(art::Event & event, art::ProcessingFrame cons
     //for (std::size_t i=0; i<igwvec.size(); i++){
     //  WaveformChar(i, fDataSize, igwvec, rawDigitVec, rawadcgvec, wgcvec, filteredRawDigit);
     //}
+    // ... Build the processing schedule. Channel cost is wildly non-uniform (dead
+    //     channels return early, noisy ones run the full FFT correction) so when
+    //     adaptive scheduling is on we hand out the channels which were most
+    //     expensive in the previous event first, in small stealable chunks, and
+    //     let TBB's work stealing fill in the tail
+    std::vector<size_t> scheduleVec(igwvec.size());
+    std::iota(scheduleVec.begin(),scheduleVec.end(),0);
+
+    if (fAdaptiveScheduling){
+      if (fChannelCostVec.size() < maxChannels) fChannelCostVec.resize(maxChannels, 0.);
+      std::stable_sort(scheduleVec.begin(),scheduleVec.end(),
+        [this,&igwvec,&rawDigitVec](const size_t& left, const size_t& right)
+        {return channelCost(rawDigitVec[igwvec[left].irawdig]->Channel()) > channelCost(rawDigitVec[igwvec[right].irawdig]->Channel());});
+    }
+
     // ... Launch multiple threads with TBB to do the waveform characterization and fft correction in parallel
     auto func = lartbb_WaveformChar(*this, fDataSize, fftSize, lfftwp.fPlan, lfftwp.rPlan, igwvec, rawDigitVec,
-                                    rawadcgvec, wgcvec, wgqvec, filteredRawDigit);
-    tbb::parallel_for(tbb::blocked_range<size_t>(0, igwvec.size()), func);
+                                    rawadcgvec, wgcvec, wgqvec, filteredRawDigit, scheduleVec);
+    if (fAdaptiveScheduling)
+      tbb::parallel_for(tbb::blocked_range<size_t>(0, igwvec.size(), fSchedulerGrainSize), func, tbb::simple_partitioner());
+    else
+      tbb::parallel_for(tbb::blocked_range<size_t>(0, igwvec.size()), func);
 
     // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
     // ... Next, we can do the correlated noise correction for each wire group
@@ -684,7 +751,7 @@ void RawDigitFilterICARUS::RemoveCorrelatedNoise(unsigned int igrp, unsigned int
     if (rmsVal < fRmsRejectionCutHi[plane]) { // && ImAGoodWire(plane,baseWireIdx + locWireIdx))
   	int irdg = wgcvec[igrp][iwdx].irawdig;
   	//saveRawDigits(filteredRawDigit, channelWireVec[locWireIdx], rawDataVec, pedestal, rmsVal);
-  	filteredRawDigit->at(irdg) = raw::RawDigit(channel, rawDataVec.size(), rawDataVec, raw::kNone);
+  	filteredRawDigit->at(irdg) = packRawDigit(channel, rawDataVec);
   	filteredRawDigit->at(irdg).SetPedestal(pedestal, rmsVal);
     } else {
   	mf::LogInfo("RawDigitFilterICARUS") <<  "--> Rejecting channel for large rms, channel: "
@@ -710,6 +777,9 @@ void RawDigitFilterICARUS::WaveformChar(unsigned int i, unsigned int& fDataSize,
 
   // .. Uncompress the RawDigit
   caldata::RawDigitVector& rawADC = rawadcgvec[igrp][iwdx];
+  // .. NUMA first touch: when the buffers were staged empty, the allocation
+  //    (and so the memory node) happens here on the processing thread
+  if (rawADC.size() < fftSize) rawADC.resize(fftSize);
   caldata::RawDigitVector tempVec(fDataSize);
   if (fTruncateTicks){
     raw::Uncompress(rawDigit->ADCs(), tempVec, rawDigit->Compression());
@@ -771,7 +841,7 @@ void RawDigitFilterICARUS::WaveformChar(unsigned int i, unsigned int& fDataSize,
     std::transform(rawADC.begin(),rawADC.end(),pedCorrectedVec.begin(),std::bind(std::minus<short>(),std::placeholders::_1,wgcvec[igrp][iwdx].pedCor));
 
     //saveRawDigits(filteredRawDigit, channel, pedCorrectedVec, truncMeanWireVec[wireIdx], truncRmsWireVec[wireIdx]);
-    filteredRawDigit->at(irdg) = raw::RawDigit(channel, pedCorrectedVec.size(), pedCorrectedVec, raw::kNone);
+    filteredRawDigit->at(irdg) = packRawDigit(channel, pedCorrectedVec);
     filteredRawDigit->at(irdg).SetPedestal(wgcvec[igrp][iwdx].truncMean,wgcvec[igrp][iwdx].truncRms);
     return;
   }
@@ -783,7 +853,7 @@ void RawDigitFilterICARUS::WaveformChar(unsigned int i, unsigned int& fDataSize,
     // Filter out the very high noise wires
     if (wgcvec[igrp][iwdx].truncRms < fRmsRejectionCutHi[plane]) {
       //saveRawDigits(filteredRawDigit, channel, rawadc, truncMeanWireVec[wireIdx], truncRmsWireVec[wireIdx]);
-      filteredRawDigit->at(irdg) = raw::RawDigit(channel, rawADC.size(), rawADC, raw::kNone);
+      filteredRawDigit->at(irdg) = packRawDigit(channel, rawADC);
       filteredRawDigit->at(irdg).SetPedestal(wgcvec[igrp][iwdx].truncMean,wgcvec[igrp][iwdx].truncRms);
     } else {
       // Eventually we'll interface to some sort of channel status communication mechanism.
@@ -930,8 +1000,62 @@ void RawDigitFilterICARUS::saveRawDigits(std::unique_ptr<std::vector<raw::RawDig
     return;
 }
 
+//----------------------------------------------------------------------------
+raw::RawDigit RawDigitFilterICARUS::packRawDigit(raw::ChannelID_t         channel,
+                                                 caldata::RawDigitVector& adcVec) const
+{
+    // .. The compression runs on whichever thread builds the output digit, so
+    //    with the parallel paths above it rides the TBB worker tasks instead
+    //    of adding a serial pass at product creation
+    size_t numSamples = adcVec.size();
+
+    if (fCompressOutput) {
+        raw::Compress(adcVec, raw::kHuffman);
+        return raw::RawDigit(channel, numSamples, adcVec, raw::kHuffman);
+    }
+
+    return raw::RawDigit(channel, numSamples, adcVec, raw::kNone);
+}
+
+//----------------------------------------------------------------------------
+void RawDigitFilterICARUS::recordChannelCost(raw::ChannelID_t channel, double seconds) const
+{
+    if (channel >= fChannelCostVec.size()) return;
+
+    // .. Exponential moving average so the estimate tracks run conditions but is
+    //    not thrown off by a single busy event
+    fChannelCostVec[channel] = 0.5 * fChannelCostVec[channel] + 0.5 * float(seconds);
+}
+
+//----------------------------------------------------------------------------
+double RawDigitFilterICARUS::channelCost(raw::ChannelID_t channel) const
+{
+    return channel < fChannelCostVec.size() ? fChannelCostVec[channel] : 0.;
+}
+
+//----------------------------------------------------------------------------
+void RawDigitFilterICARUS::recordThreadBusyTime(double seconds) const
+{
+    fThreadBusyTime.local() += seconds;
+}
+
 //----------------------------------------------------------------------------
 void RawDigitFilterICARUS::endJob(art::ProcessingFrame const&)
 {
     mf::LogInfo("RawDigitFilterICARUS") << "Looked at " << fNumEvent << " events" << std::endl;
+
+    // .. Report the per-thread utilization counters accumulated by the scheduler
+    double totalBusy = 0.;
+    double maxBusy   = 0.;
+    size_t numThreads(0);
+
+    for(const auto& busy : fThreadBusyTime){
+      mf::LogInfo("RawDigitFilterICARUS") << "  scheduler thread " << numThreads++ << " busy time: " << busy << " s";
+      totalBusy += busy;
+      maxBusy    = std::max(maxBusy, busy);
+    }
+
+    if (numThreads > 0 && maxBusy > 0.)
+      mf::LogInfo("RawDigitFilterICARUS") << "  scheduler utilization (mean busy / max busy): "
+                                          << totalBusy / double(numThreads) / maxBusy;
 }
@@ -50,6 +50,7 @@
 #include "icaruscode/TPC/SignalProcessing/RecoWire/DeconTools/IROIFinder.h"
 #include "icaruscode/TPC/SignalProcessing/RecoWire/DeconTools/IDeconvolution.h"
 #include "icaruscode/TPC/SignalProcessing/RecoWire/DeconTools/IBaseline.h"
+#include "icaruscode/Utilities/TimeProfiler.h"
 #include "icarus_signal_processing/WaveformTools.h"
 
 #include "tbb/parallel_for.h"
@@ -257,6 +258,9 @@ void Decon1DROI::endJob()
 //////////////////////////////////////////////////////
 void Decon1DROI::produce(art::Event& evt, art::ProcessingFrame const& frame)
 {
+    // Scoped timing probe, inert unless the TimeProfiler service is enabled
+    auto produceProbe = art::ServiceHandle<icarus::ns::util::TimeProfiler>()->probe("Decon1DROI:produce");
+
     // We loop over the collection of RawDigits in our input list
     // This is not done multi threaded as a way to cut down on overall job memory usage...
     for(const auto& rawDigitLabel : fRawDigitLabelVec)
@@ -13,6 +13,7 @@
 #include "lardata/DetectorInfoServices/DetectorPropertiesService.h"
 #include "larcore/Geometry/Geometry.h"
 #include "icaruscode/TPC/Utilities/SignalShapingICARUSService_service.h"
+#include "icaruscode/TPC/Utilities/DeconBufferPool.h"
 
 #include "art/Utilities/make_tool.h"
 #include "icarus_signal_processing/WaveformTools.h"
@@ -44,6 +45,7 @@ public:
 private:
     
     // Member variables from the fhicl file
+    std::string                                                  fResponseVariant;            ///< Response variant to use (empty: default)
     bool                                                         fDodQdxCalib;                ///< Do we apply wire-by-wire calibration?
     std::string                                                  fdQdxCalibFileName;          ///< Text file for constants to do wire-by-wire calibration
     std::map<unsigned int, float>                                fdQdxCalib;                  ///< Map to do wire-by-wire calibration, key is channel
@@ -54,6 +56,7 @@ private:
 
     const geo::GeometryCore*                                     fGeometry           = lar::providerFrom<geo::Geometry>();
     art::ServiceHandle<icarusutil::SignalShapingICARUSService>   fSignalShaping;
+    art::ServiceHandle<icarusutil::DeconBufferPool>              fBufferPool;
 };
     
 //----------------------------------------------------------------------
@@ -71,6 +74,7 @@ void FullWireDeconvolution::configure(const fhicl::ParameterSet& pset)
 {
     // Start by recovering the parameters
     //wire-by-wire calibration
+    fResponseVariant = pset.get< std::string >("ResponseVariant", "");
     fDodQdxCalib   = pset.get< bool >("DodQdxCalib", false);
     
     if (fDodQdxCalib)
@@ -127,8 +131,10 @@ void FullWireDeconvolution::Deconvolve(IROIFinder::Waveform const&        wavefo
     // Make sure the deconvolution size is set correctly (this will probably be a noop after first call)
     fSignalShaping->SetDecon(samplingRate, dataSize, channel);
     
-    // now make a buffer to contain the waveform which will be of the right size
-    icarusutil::TimeVec rawAdcLessPedVec(dataSize,0.);
+    // now lease a buffer to contain the waveform which will be of the right size
+    // (the pool zeroes it and recycles the capacity across channels and events)
+    icarusutil::DeconBufferPool::BufferLease rawAdcLessPedLease = fBufferPool->lease(dataSize);
+    icarusutil::TimeVec&                     rawAdcLessPedVec   = rawAdcLessPedLease.get();
     
     size_t binOffset    = 0; //transformSize > dataSize ? (transformSize - dataSize) / 2 : 0;
     float  deconNorm       = fSignalShaping->GetDeconNorm();
@@ -139,7 +145,7 @@ void FullWireDeconvolution::Deconvolve(IROIFinder::Waveform const&        wavefo
     std::copy(waveform.begin(),waveform.end(),rawAdcLessPedVec.begin()+binOffset);
     
     // Strategy is to run deconvolution on the entire channel and then pick out the ROI's we found above
-    fFFT->deconvolute(rawAdcLessPedVec, fSignalShaping->GetResponse(channel).getDeconvKernel(), fSignalShaping->ResponseTOffset(channel));
+    fFFT->deconvolute(rawAdcLessPedVec, fSignalShaping->GetResponse(channel, fResponseVariant).getDeconvKernel(), fSignalShaping->ResponseTOffset(channel));
     
     std::vector<float> holder;
 
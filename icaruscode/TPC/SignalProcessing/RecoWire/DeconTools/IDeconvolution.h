@@ -39,6 +39,27 @@ namespace icarus_tool
                                 raw::ChannelID_t,
                                 IROIFinder::CandidateROIVec const&,
                                 recob::Wire::RegionsOfInterest_t& ) const = 0;
+
+        // One channel's work unit for the plane-level batch interface below
+        struct ChannelROIGroup
+        {
+            const IROIFinder::Waveform*        waveform;
+            raw::ChannelID_t                   channel;
+            const IROIFinder::CandidateROIVec* candidateROIVec;
+            recob::Wire::RegionsOfInterest_t*  outputROIVec;
+        };
+
+        using ChannelROIGroupVec = std::vector<ChannelROIGroup>;
+
+        // Deconvolve all the ROI's of one plane in a single call. Tools which can
+        // amortize per-call setup (FFT sizing, response kernels) across a plane
+        // override this; the default simply loops the single channel interface
+        virtual void DeconvolveBatch(ChannelROIGroupVec const& groupVec,
+                                     double samplingRate) const
+        {
+            for(const auto& group : groupVec)
+                Deconvolve(*group.waveform, samplingRate, group.channel, *group.candidateROIVec, *group.outputROIVec);
+        }
     };
 }
 
@@ -13,6 +13,7 @@
 #include "lardata/DetectorInfoServices/DetectorPropertiesService.h"
 #include "larcore/Geometry/Geometry.h"
 #include "icaruscode/TPC/Utilities/SignalShapingICARUSService_service.h"
+#include "icaruscode/TPC/Utilities/DeconBufferPool.h"
 
 #include "icaruscode/TPC/SignalProcessing/RecoWire/DeconTools/IBaseline.h"
 #include "icarus_signal_processing/Filters/ICARUSFFT.h"
@@ -39,10 +40,23 @@ public:
                     raw::ChannelID_t,
                     IROIFinder::CandidateROIVec const&,
                     recob::Wire::RegionsOfInterest_t& )    const override;
-    
+
+    void DeconvolveBatch(ChannelROIGroupVec const&,
+                         double samplingRate)              const override;
+
 private:
+    // Padded transform length for an ROI of the given length
+    size_t paddedDeconSize(size_t roiLen) const;
+
+    // Deconvolve a single ROI; assumes the decon setup (SetDecon) was done by the caller
+    void deconvolveROI(const IROIFinder::Waveform&,
+                       raw::ChannelID_t,
+                       IROIFinder::CandidateROI const&,
+                       recob::Wire::RegionsOfInterest_t&) const;
+
     // Member variables from the fhicl file
     size_t                                                     fFFTSize;                    ///< FFT size for ROI deconvolution
+    std::string                                                fResponseVariant;            ///< Response variant to use (empty: default)
     bool                                                       fDodQdxCalib;                ///< Do we apply wire-by-wire calibration?
     std::string                                                fdQdxCalibFileName;          ///< Text file for constants to do wire-by-wire calibration
     std::map<unsigned int, float>                              fdQdxCalib;                  ///< Map to do wire-by-wire calibration, key is channel
@@ -52,6 +66,7 @@ private:
     
     const geo::GeometryCore*                                   fGeometry = lar::providerFrom<geo::Geometry>();
     art::ServiceHandle<icarusutil::SignalShapingICARUSService> fSignalShaping;
+    art::ServiceHandle<icarusutil::DeconBufferPool>            fBufferPool;
     std::unique_ptr<icarus_signal_processing::ICARUSFFT<double>>          fFFT;                  ///< Object to handle thread safe FFT
 };
     
@@ -70,6 +85,7 @@ void ROIDeconvolution::configure(const fhicl::ParameterSet& pset)
 {
     // Start by recovering the parameters
     fFFTSize    = pset.get< size_t >("FFTSize"                );
+    fResponseVariant = pset.get< std::string >("ResponseVariant", "");
     
     //wire-by-wire calibration
     fDodQdxCalib = pset.get< bool >("DodQdxCalib", false);
@@ -121,33 +137,83 @@ void ROIDeconvolution::Deconvolve(const IROIFinder::Waveform&        waveform,
                                   IROIFinder::CandidateROIVec const& roiVec,
                                   recob::Wire::RegionsOfInterest_t&  ROIVec) const
 {
-    double deconNorm = fSignalShaping->GetDeconNorm();
-
     // And now process them
     for(auto const& roi : roiVec)
+    {
+        // In theory, most ROI's are around the same size so this should mostly be a noop
+        fSignalShaping->SetDecon(samplingRate, paddedDeconSize(roi.second - roi.first), channel);
+
+        deconvolveROI(waveform, channel, roi, ROIVec);
+    } // loop over candidate roi's
+
+    return;
+}
+
+void ROIDeconvolution::DeconvolveBatch(ChannelROIGroupVec const& groupVec,
+                                       double const              samplingRate) const
+{
+    // Plane-level batch: most ROIs are short and the per-call decon setup
+    // dwarfs the math, so group all of the plane's ROIs by their padded
+    // transform length and run the setup once per length group
+    using GroupROIPair    = std::pair<const ChannelROIGroup*,const IROIFinder::CandidateROI*>;
+    using SizeToROIPairs  = std::map<size_t,std::vector<GroupROIPair>>;
+
+    SizeToROIPairs sizeToROIPairsMap;
+
+    for(const auto& group : groupVec)
+    {
+        for(const auto& roi : *group.candidateROIVec)
+            sizeToROIPairsMap[paddedDeconSize(roi.second - roi.first)].emplace_back(&group,&roi);
+    }
+
+    for(auto& sizeRoiPair : sizeToROIPairsMap)
+    {
+        if (sizeRoiPair.second.empty()) continue;
+
+        // One setup call per padded length; the channels of a batch share a
+        // plane so the response configuration is common too
+        fSignalShaping->SetDecon(samplingRate, sizeRoiPair.first, sizeRoiPair.second.front().first->channel);
+
+        for(const auto& groupRoiPair : sizeRoiPair.second)
+            deconvolveROI(*groupRoiPair.first->waveform, groupRoiPair.first->channel, *groupRoiPair.second, *groupRoiPair.first->outputROIVec);
+    }
+
+    return;
+}
+
+size_t ROIDeconvolution::paddedDeconSize(size_t roiLen) const
+{
+    // We want the deconvolution buffer size to be a power of 2 in length
+    // to facilitate the FFT
+    size_t deconSize = fFFTSize;
+
+    while(1)
+    {
+        if (roiLen > deconSize  ) deconSize *= 2;
+        else break;
+    }
+
+    return deconSize;
+}
+
+void ROIDeconvolution::deconvolveROI(const IROIFinder::Waveform&       waveform,
+                                     raw::ChannelID_t                  channel,
+                                     IROIFinder::CandidateROI const&   roi,
+                                     recob::Wire::RegionsOfInterest_t& ROIVec) const
+{
+    double deconNorm = fSignalShaping->GetDeconNorm();
+
     {
         // First up: copy out the relevent ADC bins into the ROI holder
         size_t roiLen = roi.second - roi.first;
-        
-        // We want the deconvolution buffer size to be a power of 2 in length
-        // to facilitate the FFT
+
         size_t deconSize = fFFTSize;
-        
-        while(1)
-        {
-            if (roiLen > deconSize  ) deconSize *= 2;
-            else break;
-        }
-        
-        // In theory, most ROI's are around the same size so this should mostly be a noop
-        fSignalShaping->SetDecon(samplingRate, deconSize, channel);
-        
-        deconSize = fFFTSize;
 
-        icarusutil::TimeVec deconVec(deconSize);
-        
-        // Pad with zeroes if the deconvolution buffer is larger than the input waveform
-        if (deconSize > waveform.size()) deconVec.resize(deconSize, 0.);
+        // Lease the scratch buffer from the process-wide pool so the capacity is
+        // recycled across ROIs, channels and events (the lease zeroes it for us,
+        // which also handles padding when the buffer is larger than the waveform)
+        icarusutil::DeconBufferPool::BufferLease deconLease = fBufferPool->lease(deconSize);
+        icarusutil::TimeVec&                     deconVec   = deconLease.get();
         
         // Watch for the case where the input ROI is long enough to want an deconvolution buffer that is
         // larger than the input waveform.
@@ -190,7 +256,7 @@ void ROIDeconvolution::Deconvolve(const IROIFinder::Waveform&        waveform,
         std::copy(waveform.begin()+firstOffset, waveform.begin()+secondOffset, deconVec.begin() + holderOffset);
         
         // Deconvolute the raw signal using the channel's nominal response
-        fFFT->deconvolute(deconVec, fSignalShaping->GetResponse(channel).getDeconvKernel(), fSignalShaping->ResponseTOffset(channel));
+        fFFT->deconvolute(deconVec, fSignalShaping->GetResponse(channel, fResponseVariant).getDeconvKernel(), fSignalShaping->ResponseTOffset(channel));
 
         std::vector<float>  holder(deconVec.size());
         
@@ -222,8 +288,8 @@ void ROIDeconvolution::Deconvolve(const IROIFinder::Waveform&        waveform,
 
         // add the range into ROIVec
         ROIVec.add_range(roi.first, std::move(holder));
-    } // loop over candidate roi's
-    
+    }
+
     return;
 }
     
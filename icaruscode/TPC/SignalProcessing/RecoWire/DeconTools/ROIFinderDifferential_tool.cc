@@ -57,8 +57,12 @@ private:
     unsigned short                              fPreROIPad;                  ///< ROI padding
     unsigned short                              fPostROIPad;                 ///< ROI padding
     float                                       fTruncRMSMinFraction;        ///< or at least this fraction of time bins
+    float                                       fScreenNumRMS;               ///< Skip the full search on wires whose max
+                                                                             ///< deviation is below this many RMS (0 disables)
     bool                                        fOutputHistograms;           ///< Output histograms?
 
+    static constexpr size_t                     fgScreenTileSize = 64;       ///< Tile size for the first-pass screen
+
     std::vector<float>                          fAveWeightVec;
     float                                       fWeightSum;
     
@@ -102,6 +106,7 @@ void ROIFinderDifferential::configure(const fhicl::ParameterSet& pset)
     fMaxTicksGap         = pset.get< size_t >                     ("MaxTicksGap",            50);
     zin                  = pset.get< std::vector<unsigned short> >("ROILeadTrailPadding"       );
     fTruncRMSMinFraction = pset.get< float >                      ("TruncRMSMinFraction",   0.6);
+    fScreenNumRMS        = pset.get< float >                      ("ScreenNumRMS",          2.5);
     fOutputHistograms    = pset.get< bool  >                      ("OutputHistograms",    false);
 
     // put the ROI pad sizes into more convenient vectors
@@ -162,6 +167,30 @@ void ROIFinderDifferential::FindROIs(const Waveform& waveform, size_t channel, s
     // consider the peak signature as a maximum followed some bins later by a mininum and those whose difference between
     // max and min is more than the threshold are kept.
     
+    // Cheap first-pass screen: most wires in a low occupancy event are quiescent and don't
+    // need the full differential/smoothing treatment. Scan the waveform in fixed-size tiles
+    // keeping the maximum absolute deviation per tile (a tight loop the compiler can
+    // vectorize); if no tile gets above a loose noise cut there can be no ROI on this wire.
+    // The 2.5 sigma default matches the loose activity cut used in RecoWireROI.
+    // When histograms are requested the screen is bypassed so every wire gets recorded.
+    if (fScreenNumRMS > 0. && !fOutputHistograms)
+    {
+        float screenThreshold = fScreenNumRMS * std::max(float(rmsNoise), float(0.25));
+        bool  overThreshold   = false;
+
+        for(size_t tileStart = 0; tileStart < waveform.size() && !overThreshold; tileStart += fgScreenTileSize)
+        {
+            size_t tileStop = std::min(tileStart + fgScreenTileSize, waveform.size());
+            float  maxAbs(0.);
+
+            for(size_t idx = tileStart; idx < tileStop; idx++) maxAbs = std::max(maxAbs, std::fabs(waveform[idx]));
+
+            overThreshold = maxAbs > screenThreshold;
+        }
+
+        if (!overThreshold) return;
+    }
+
     // First up, determine what kind of wire we have
     std::vector<geo::WireID> wids    = fGeometry->ChannelToWire(channel);
     const geo::PlaneID&      planeID = wids[0].planeID();
@@ -18,7 +18,9 @@
 #include "TH2F.h"
 #include "TProfile.h"
 
+#include <deque>
 #include <fstream>
+#include <functional>
 
 namespace icarus_tool
 {
@@ -57,7 +59,19 @@ private:
     
     // Average the input waveform
     void smoothInputWaveform(const Waveform&, Waveform&)  const;
-    
+
+    // Erosion/dilation kernel with the window size as a template parameter:
+    // the sliding window min/max is done with monotonic deques so the per tick
+    // cost is O(1) instead of O(window), and baking the window size in at
+    // compile time lets the compiler unroll the priming loop for the sizes
+    // we actually deploy. The dispatch happens once per job in configure()
+    template <int StructElemSize>
+    void erosionDilationKernel(const Waveform&, Waveform&, Waveform&, Waveform&, Waveform&) const;
+
+    // The shared sliding window implementation (also the runtime fallback for
+    // window sizes without a specialization above)
+    void morphologyWithWindow(const Waveform&, int, Waveform&, Waveform&, Waveform&, Waveform&) const;
+
     // Actual histogram initialization...
     enum HistogramType : int
     {
@@ -106,6 +120,11 @@ private:
 
     icarus_signal_processing::WaveformTools<float> fWaveformTool;
 
+    // The morphology kernel selected at configure time from the fcl window size
+    using MorphologyFunc = std::function<void(const Waveform&, Waveform&, Waveform&, Waveform&, Waveform&)>;
+
+    MorphologyFunc                              fMorphologyFunc;
+
     // Services
     const geo::GeometryCore*                    fGeometry = lar::providerFrom<geo::Geometry>();
 };
@@ -196,6 +215,91 @@ void ROIFinderMorphological::configure(const fhicl::ParameterSet& pset)
     
     fWeightSum = std::accumulate(fAveWeightVec.begin(),fAveWeightVec.end(), 0.);
 
+    // Dispatch the morphology kernel once per job: the window sizes we deploy
+    // get a compile-time specialization, anything else falls back to the
+    // runtime window version
+    switch(fStructuringElement)
+    {
+        case 16: fMorphologyFunc = [this](const Waveform& wf, Waveform& ero, Waveform& dil, Waveform& ave, Waveform& dif){erosionDilationKernel<16>(wf, ero, dil, ave, dif);}; break;
+        case 20: fMorphologyFunc = [this](const Waveform& wf, Waveform& ero, Waveform& dil, Waveform& ave, Waveform& dif){erosionDilationKernel<20>(wf, ero, dil, ave, dif);}; break;
+        default: fMorphologyFunc = [this](const Waveform& wf, Waveform& ero, Waveform& dil, Waveform& ave, Waveform& dif){morphologyWithWindow(wf, fStructuringElement, ero, dil, ave, dif);}; break;
+    }
+
+    return;
+}
+
+template <int StructElemSize>
+void ROIFinderMorphological::erosionDilationKernel(const Waveform& inputWaveform,
+                                                   Waveform&       erosionVec,
+                                                   Waveform&       dilationVec,
+                                                   Waveform&       averageVec,
+                                                   Waveform&       differenceVec) const
+{
+    morphologyWithWindow(inputWaveform, StructElemSize, erosionVec, dilationVec, averageVec, differenceVec);
+}
+
+void ROIFinderMorphological::morphologyWithWindow(const Waveform& inputWaveform,
+                                                  int             structuringElement,
+                                                  Waveform&       erosionVec,
+                                                  Waveform&       dilationVec,
+                                                  Waveform&       averageVec,
+                                                  Waveform&       differenceVec) const
+{
+    // Compute the erosion (min), dilation (max), their average and difference
+    // over a window of structuringElement ticks centered on each tick. The
+    // monotonic deques hold the indices of candidate extrema for the current
+    // window: the front is always the extremum, a new tick evicts from the
+    // back everything it dominates, and ticks falling out of the window are
+    // retired from the front. Each tick enters and leaves each deque at most
+    // once so the cost per tick is amortized constant
+    int halfWindowSize(structuringElement/2);
+    int nTicks(inputWaveform.size());
+
+    erosionVec.resize(nTicks);
+    dilationVec.resize(nTicks);
+    averageVec.resize(nTicks);
+    differenceVec.resize(nTicks);
+
+    std::deque<int> minIndices;
+    std::deque<int> maxIndices;
+
+    // Prime the deques with the leading half window
+    for(int tick = 0; tick < std::min(halfWindowSize,nTicks); tick++)
+    {
+        while(!minIndices.empty() && inputWaveform[tick] <= inputWaveform[minIndices.back()]) minIndices.pop_back();
+        minIndices.push_back(tick);
+
+        while(!maxIndices.empty() && inputWaveform[tick] >= inputWaveform[maxIndices.back()]) maxIndices.pop_back();
+        maxIndices.push_back(tick);
+    }
+
+    for(int tick = 0; tick < nTicks; tick++)
+    {
+        // Admit the tick entering the window on the right...
+        int newTick = tick + halfWindowSize;
+
+        if (newTick < nTicks)
+        {
+            while(!minIndices.empty() && inputWaveform[newTick] <= inputWaveform[minIndices.back()]) minIndices.pop_back();
+            minIndices.push_back(newTick);
+
+            while(!maxIndices.empty() && inputWaveform[newTick] >= inputWaveform[maxIndices.back()]) maxIndices.pop_back();
+            maxIndices.push_back(newTick);
+        }
+
+        // ... and retire the tick leaving it on the left
+        if (minIndices.front() < tick - halfWindowSize) minIndices.pop_front();
+        if (maxIndices.front() < tick - halfWindowSize) maxIndices.pop_front();
+
+        float minVal = inputWaveform[minIndices.front()];
+        float maxVal = inputWaveform[maxIndices.front()];
+
+        erosionVec[tick]    = minVal;
+        dilationVec[tick]   = maxVal;
+        averageVec[tick]    = 0.5 * (minVal + maxVal);
+        differenceVec[tick] = maxVal - minVal;
+    }
+
     return;
 }
 
@@ -217,8 +321,8 @@ void ROIFinderMorphological::FindROIs(const Waveform& waveform, size_t channel,
     Waveform averageVec;
     Waveform differenceVec;
     
-    // Compute the morphological filter vectors
-    fWaveformTool.getErosionDilationAverageDifference(smoothWaveform, fStructuringElement, erosionVec, dilationVec, averageVec, differenceVec);
+    // Compute the morphological filter vectors with the kernel selected at configure time
+    fMorphologyFunc(smoothWaveform, erosionVec, dilationVec, averageVec, differenceVec);
 
     // Use the average vector to find ROI's
     float fullRMS;
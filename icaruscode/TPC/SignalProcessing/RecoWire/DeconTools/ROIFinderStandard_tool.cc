@@ -42,7 +42,10 @@ private:
     std::vector<int>              fNumSigma;                   ///< "# sigma" rms noise for ROI threshold
     std::vector<unsigned short>   fPreROIPad;                  ///< ROI padding
     std::vector<unsigned short>   fPostROIPad;                 ///< ROI padding
-    
+    bool                          fAdaptivePadding;            ///< Scale padding with the channel noise level
+    float                         fMinPadFraction;             ///< Fraction of the padding kept on the quietest channels
+    float                         fMaxNoiseRatio;              ///< Noise/electronics noise ratio at which full padding applies
+
     // Services
     const geo::GeometryCore*                                   fGeometry = lar::providerFrom<geo::Geometry>();
     art::ServiceHandle<icarusutil::SignalShapingICARUSService> fSignalShaping;
@@ -72,6 +75,10 @@ void ROIFinderStandard::configure(const fhicl::ParameterSet& pset)
     uin          = pset.get< std::vector<unsigned short> >("uPlaneROIPad"  );
     vin          = pset.get< std::vector<unsigned short> >("vPlaneROIPad"  );
     zin          = pset.get< std::vector<unsigned short> >("zPlaneROIPad"  );
+
+    fAdaptivePadding = pset.get< bool  >("AdaptivePadding", false);
+    fMinPadFraction  = pset.get< float >("MinPadFraction",  0.5);
+    fMaxNoiseRatio   = pset.get< float >("MaxNoiseRatio",   2.0);
     
     if(uin.size() != 2 || vin.size() != 2 || zin.size() != 2) {
         throw art::Exception(art::errors::Configuration)
@@ -151,43 +158,44 @@ void ROIFinderStandard::FindROIs(const Waveform& waveform, size_t channel, size_
     // add the last ROI if existed
     if (roiCandStart) roiVec.push_back(CandidateROI(roiStartBin, waveform.size() - 1));
     
-    // pad the ROIs
-    for(auto& roi : roiVec)
+    // Recover the padding for this plane...
+    size_t prePad  = fPreROIPad[planeID.Plane];
+    size_t postPad = fPostROIPad[planeID.Plane];
+
+    // ... tightening it on quiet channels when adaptive padding is requested.
+    // The padding absorbs uncertainty on where the signal emerges from the noise,
+    // so channels near the electronics noise floor don't need all of it; channels
+    // at fMaxNoiseRatio times the floor (or above) keep the full padding
+    if (fAdaptivePadding && fMaxNoiseRatio > 1.)
     {
-        // low ROI end
-        roi.first  = std::max(int(roi.first - fPreROIPad[planeID.Plane]),0);
-        // high ROI end
-        roi.second = std::min(roi.second + fPostROIPad[planeID.Plane], waveform.size() - 1);
+        float noiseRatio = rawNoise / std::max(elecNoise, 1.e-3f);
+        float padScale   = fMinPadFraction + (1. - fMinPadFraction)
+                         * std::min(std::max((noiseRatio - 1.f) / (fMaxNoiseRatio - 1.f), 0.f), 1.f);
+
+        prePad  = std::max(size_t(padScale * prePad),  size_t(1));
+        postPad = std::max(size_t(padScale * postPad), size_t(1));
     }
-    
-    // merge overlapping (or touching) ROI's
-    if(roiVec.size() > 1)
+
+    // pad the ROIs and merge overlapping (or touching) ones in the same pass
+    // (the candidates come out of the search loop already ordered)
+    if (!roiVec.empty())
     {
-        // temporary vector for merged ROIs
         CandidateROIVec tempRoiVec;
-        
-        // Loop through candidate roi's
-        size_t startRoi = roiVec.front().first;
-        size_t stopRoi  = startRoi;
-        
-        for(auto& roi : roiVec)
+
+        for(const auto& roi : roiVec)
         {
-            if (roi.first <= stopRoi) stopRoi = roi.second;
+            size_t roiStart = size_t(std::max(int(roi.first) - int(prePad), 0));
+            size_t roiStop  = std::min(roi.second + postPad, waveform.size() - 1);
+
+            if (!tempRoiVec.empty() && roiStart <= tempRoiVec.back().second)
+                tempRoiVec.back().second = std::max(tempRoiVec.back().second, roiStop);
             else
-            {
-                tempRoiVec.push_back(CandidateROI(startRoi,stopRoi));
-                
-                startRoi = roi.first;
-                stopRoi  = roi.second;
-            }
+                tempRoiVec.push_back(CandidateROI(roiStart, roiStop));
         }
-        
-        // Make sure to get the last one
-        tempRoiVec.push_back(CandidateROI(startRoi,stopRoi));
-        
+
         roiVec = tempRoiVec;
     }
-    
+
     return;
 }
 
@@ -40,6 +40,7 @@
 #include "lardata/Utilities/AssociationUtil.h"
 
 #include "icaruscode/TPC/SignalProcessing/RecoWire/ROITools/IROILocator.h"
+#include "icaruscode/IcarusObj/ROICensus.h"
 
 #include "icarus_signal_processing/WaveformTools.h"
 #include "icarus_signal_processing/Denoising.h"
@@ -170,6 +171,9 @@ ROIFinder::ROIFinder(fhicl::ParameterSet const& pset) : EDProducer{pset}
     {
         produces< std::vector<recob::Wire>>(wireLabel);
 
+        // Census of the ROIs found, for downstream admission control
+        produces< icarus::ROICensus>(wireLabel);
+
         if (fOutputMorphed) produces<std::vector<recob::Wire>>(wireLabel+ "M");
     }
 }
@@ -258,8 +262,9 @@ void ROIFinder::produce(art::Event& evt)
         if (!wireVecHandle->size())
         {
             evt.put(std::move(wireCol), wireLabel.instance());
+            evt.put(std::make_unique<icarus::ROICensus>(), fOutInstanceLabelVec[labelIdx]);
             fEventCount++;
-            
+
             return;
         }
     
@@ -349,6 +354,28 @@ void ROIFinder::produce(art::Event& evt)
         // Time to stroe everything
         if(wireCol->size() == 0) mf::LogWarning("ROIFinder") << "No wires made for this event.";
 
+        // Take the census of the ROIs just found while they are in memory:
+        // downstream modules read it to decide whether this event fits their
+        // complexity budget before committing to the full reconstruction
+        std::unique_ptr<icarus::ROICensus> roiCensus(new icarus::ROICensus);
+
+        for(const auto& wire : *wireCol)
+        {
+            std::vector<geo::WireID> wireIDVec = fGeometry->ChannelToWire(wire.Channel());
+
+            if (wireIDVec.empty()) continue;
+
+            size_t plane = wireIDVec.front().Plane;
+
+            const recob::Wire::RegionsOfInterest_t& signalROI = wire.SignalROI();
+
+            if (signalROI.n_ranges() > 0) roiCensus->tallyWire(plane);
+
+            for(const auto& range : signalROI.get_ranges()) roiCensus->tally(plane, range.size());
+        }
+
+        evt.put(std::move(roiCensus), fOutInstanceLabelVec[labelIdx]);
+
         evt.put(std::move(wireCol), fOutInstanceLabelVec[labelIdx]);
 
         if (fOutputMorphed) evt.put(std::move(morphedCol), fOutInstanceLabelVec[labelIdx]+"M");
@@ -40,6 +40,10 @@
 #include "lardata/Utilities/AssociationUtil.h"
 
 #include "icarus_signal_processing/Filters/ICARUSFFT.h"
+#include "icaruscode/TPC/Utilities/DeconBufferPool.h"
+
+#include "tbb/parallel_for.h"
+#include "tbb/blocked_range.h"
 
 ///creation of calibrated signals on wires
 namespace recowire {
@@ -185,20 +189,10 @@ namespace recowire{
     // get the geometry
     art::ServiceHandle<geo::Geometry> geom;
 
-    std::vector<double> decayConsts;  
-    std::vector<int> kernMap;
-    std::vector<std::vector<std::complex<double>>> kernel; 
     //Put correct response functions and decay constants in place
-    if(evt.isRealData()) {
-      decayConsts=fDecayConstsR;
-      kernMap=fKernMapR;
-      kernel=fKernelR;
-    }
-    else {
-      decayConsts=fDecayConstsS;
-      kernMap=fKernMapS;
-      kernel=fKernelS;
-    }
+    //(references: the kernels were being deep copied into the event loop)
+    const std::vector<double>&                            decayConsts = evt.isRealData() ? fDecayConstsR : fDecayConstsS;
+    const std::vector<std::vector<std::complex<double>>>& kernel      = evt.isRealData() ? fKernelR      : fKernelS;
 
     // make a collection of Wires
     std::unique_ptr<std::vector<recob::Wire> > wirecol(new std::vector<recob::Wire>);
@@ -219,21 +213,33 @@ namespace recowire{
     unsigned int dataSize = digitVec0->Samples(); //size of raw data vectors
     
     int transformSize = dataSize;
-    raw::ChannelID_t channel(raw::InvalidChannelID); // channel number
-    unsigned int bin(0);     // time bin loop variable
+    // stage one: process all the wires in parallel. Every wire is independent
+    // of the others, so the loop is split across threads, each with its own
+    // FFT engine and scratch buffers (leased from the decon buffer pool);
+    // the result of each wire lands in its own slot so the products filled
+    // below keep the ordering of the sequential code
+    art::ServiceHandle<icarusutil::DeconBufferPool> bufferPool;
+
+    std::vector<std::vector<float>> holderVec(digitVecHandle->size());
 
-    icarus_signal_processing::ICARUSFFT<double> fft(transformSize);
-    
-    double decayConst = 0.;  // exponential decay constant of electronics shaping
-    double fitAmplitude    = 0.;  //This is the seed value for the amplitude in the exponential tail fit 
-    std::vector<float> holder;                // holds signal data
-    std::vector<float> shortADC;                // holds signal data
-    std::vector<float> longADC;                // holds signal data
-    std::vector<short> rawadc(transformSize);  // vector holding uncompressed adc values
-    std::vector<std::complex<double>> freqHolder(transformSize+1); // temporary frequency data
     wirecol->reserve(digitVecHandle->size()); 
-    // loop over all wires    
-    for(unsigned int rdIter = 0; rdIter < digitVecHandle->size(); ++rdIter){ // ++ move
+
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, digitVecHandle->size()),
+      [&](const tbb::blocked_range<size_t>& wireRange)
+    {
+      // per thread workspace
+      icarus_signal_processing::ICARUSFFT<double> fft(transformSize);
+
+      double decayConst = 0.;  // exponential decay constant of electronics shaping
+      double fitAmplitude    = 0.;  //This is the seed value for the amplitude in the exponential tail fit 
+      std::vector<float> holder;                // holds signal data
+      std::vector<float> shortADC;                // holds signal data
+      std::vector<float> longADC;                // holds signal data
+      std::vector<short> rawadc(transformSize);  // vector holding uncompressed adc values
+      raw::ChannelID_t channel(raw::InvalidChannelID); // channel number
+      unsigned int bin(0);     // time bin loop variable
+
+      for(size_t rdIter = wireRange.begin(); rdIter < wireRange.end(); ++rdIter){
       holder.clear();
       
       art::Ptr<raw::RawDigit> digitVec(digitVecHandle, rdIter);
@@ -352,7 +358,8 @@ namespace recowire{
 	  // adapt as appropriate
       
 	  // Figure out which kernel to use (0=induction, 1=collection).
-    icarus_signal_processing::ICARUSFFT<double>::TimeVec temp(holder.size());
+    auto tempLease = bufferPool->lease(holder.size());
+    icarusutil::TimeVec& temp = tempLease.get();
     std::copy(holder.begin(),holder.end(),temp.begin());
 	  fft.convolute(temp,kernel[k],0);
     std::copy(temp.begin(),temp.end(),holder.begin());
@@ -365,7 +372,14 @@ namespace recowire{
 	    for(bin = 0; bin < holder.size(); ++bin) holder[bin]-=average;
 	  }
 	}
-      wirecol->push_back(recob::WireCreator(holder,*digitVec).move());
+      holderVec[rdIter] = std::move(holder);
+      } // for raw digits in range
+    });
+
+    // stage two: make the wires and the associations, in wire order
+    for(unsigned int rdIter = 0; rdIter < digitVecHandle->size(); ++rdIter){
+      art::Ptr<raw::RawDigit> digitVec(digitVecHandle, rdIter);
+      wirecol->push_back(recob::WireCreator(holderVec[rdIter],*digitVec).move());
       // add an association between the last object in wirecol
       // (that we just inserted) and digitVec
       if (!util::CreateAssn(*this, evt, *wirecol, digitVec, *WireDigitAssn)) {
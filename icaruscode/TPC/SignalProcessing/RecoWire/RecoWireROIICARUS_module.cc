@@ -11,12 +11,17 @@
 // C/C++ standard libraries
 #include <string>
 #include <vector>
+#include <array>
 #include <utility> // std::pair<>
 #include <memory> // std::unique_ptr<>
 #include <iomanip>
 #include <fstream>
 #include <random>
 
+// TBB libraries
+#include "tbb/parallel_for.h"
+#include "tbb/blocked_range.h"
+
 // ROOT libraries
 #include "TH1D.h"
 #include "TProfile.h"
@@ -75,7 +80,10 @@ class RecoWireROIICARUS : public art::EDProducer
     float fixTheFreakingWaveform(const std::vector<float>&, raw::ChannelID_t, std::vector<float>&);
     
     float getTruncatedRMS(const std::vector<float>&) const;
-    
+
+    // Snap the deconvolved ROI values onto a per-ROI 16 bit fixed point grid
+    void quantizeROIs(recob::Wire::RegionsOfInterest_t&) const;
+
     std::string                                             fDigitModuleLabel;           ///< module that made digits
     std::string                                             fSpillName;                  ///< nominal spill is an empty string
                                                                                          ///< it is set by the DigitModuleLabel
@@ -88,7 +96,9 @@ class RecoWireROIICARUS : public art::EDProducer
     float                                                   fTruncRMSThreshold;          ///< Calculate RMS up to this threshold...
     float                                                   fTruncRMSMinFraction;        ///< or at least this fraction of time bins
     bool                                                    fOutputHistograms;           ///< Output histograms?
-    
+    bool                                                    fQuantizeROIs;               ///< Quantize ROI values for better compression?
+    bool                                                    fParallelPlanes;             ///< Process the plane batches on concurrent TBB workers?
+
     std::vector<std::unique_ptr<icarus_tool::IROIFinder>>   fROIFinderVec;               ///< ROI finders per plane
     std::unique_ptr<icarus_tool::IDeconvolution>            fDeconvolution;
 
@@ -151,7 +161,9 @@ void RecoWireROIICARUS::reconfigure(fhicl::ParameterSet const& pset)
     fTruncRMSThreshold          = pset.get< float >         ("TruncRMSThreshold",    6.);
     fTruncRMSMinFraction        = pset.get< float >         ("TruncRMSMinFraction", 0.6);
     fOutputHistograms           = pset.get< bool  >         ("OutputHistograms",   true);
-    
+    fQuantizeROIs               = pset.get< bool  >         ("QuantizeROIs",      false);
+    fParallelPlanes             = pset.get< bool  >         ("ParallelPlanes",    false);
+
     fSpillName.clear();
     
     size_t pos = fDigitModuleLabel.find(":");
@@ -227,90 +239,144 @@ void RecoWireROIICARUS::produce(art::Event& evt)
         return;
     }
     
-    raw::ChannelID_t channel = raw::InvalidChannelID; // channel number
-    
     const lariov::ChannelStatusProvider& chanFilt = art::ServiceHandle<lariov::ChannelStatusService>()->GetProvider();
-    
+
     auto const clockData = art::ServiceHandle<detinfo::DetectorClocksService const>()->DataFor(evt);
     double const samplingRate = sampling_rate(clockData);
-    // loop over all wires
-    wirecol->reserve(digitVecHandle->size());
-    for(size_t rdIter = 0; rdIter < digitVecHandle->size(); ++rdIter)
-    {
-        // vector that will be moved into the Wire object
-        recob::Wire::RegionsOfInterest_t ROIVec;
 
-        // get the reference to the current raw::RawDigit
+    size_t const numDigits = digitVecHandle->size();
+
+    // Group the channels by plane so all the wires of a plane are processed
+    // consecutively: the response kernels and filter tables of that plane
+    // stay hot in cache instead of being evicted at every plane switch
+    // (the digits arrive ordered by channel, which interleaves the planes)
+    std::array<std::vector<size_t>, 3> planeBatches;
+    std::vector<char>                  useDigit(numDigits, 0);
+
+    for(size_t rdIter = 0; rdIter < numDigits; ++rdIter)
+    {
         art::Ptr<raw::RawDigit> digitVec(digitVecHandle, rdIter);
-        channel = digitVec->Channel();
-      
+        raw::ChannelID_t        channel = digitVec->Channel();
+
         // The following test is meant to be temporary until the "correct" solution is implemented
         if (!chanFilt.IsPresent(channel)) continue;
 
         // Testing an idea about rejecting channels
         if (digitVec->GetPedestal() < 0.) continue;
 
-        float pedestal = 0.;
-        
-        // skip bad channels
-        if( chanFilt.Status(channel) >= fMinAllowedChanStatus)
+        useDigit[rdIter] = 1;
+
+        // bad channels still get an (empty) wire but no plane work
+        if( chanFilt.Status(channel) < fMinAllowedChanStatus) continue;
+
+        const geo::PlaneID& planeID = fGeometry->ChannelToWire(channel)[0].planeID();
+
+        planeBatches.at(planeID.Plane).push_back(rdIter);
+    }
+
+    // ROI vectors indexed by digit, so the output can be committed in the
+    // original digit order regardless of the processing order
+    std::vector<recob::Wire::RegionsOfInterest_t> roiVecs(numDigits);
+
+    auto processPlaneBatch = [&](size_t planeIdx)
+    {
+        // scratch buffers reused across the wires of the batch so their
+        // capacity is allocated once per batch rather than once per wire
+        std::vector<short>                       rawadc;
+        std::vector<float>                       rawAdcLessPedVec;
+        icarus_tool::IROIFinder::CandidateROIVec candRoiVec;
+
+        for(size_t rdIter : planeBatches[planeIdx])
         {
-            size_t dataSize = digitVec->Samples();
-            
-            // Recover the plane info
-            std::vector<geo::WireID> wids    = fGeometry->ChannelToWire(channel);
-            const geo::PlaneID&      planeID = wids[0].planeID();
+            art::Ptr<raw::RawDigit> digitVec(digitVecHandle, rdIter);
+            raw::ChannelID_t        channel  = digitVec->Channel();
+            size_t                  dataSize = digitVec->Samples();
+
+            recob::Wire::RegionsOfInterest_t& ROIVec = roiVecs[rdIter];
 
             // vector holding uncompressed adc values
-            std::vector<short> rawadc(dataSize);
-            
+            rawadc.resize(dataSize);
+
             // uncompress the data
             raw::Uncompress(digitVec->ADCs(), rawadc, digitVec->Compression());
-            
+
             // loop over all adc values and subtract the pedestal
             // When we have a pedestal database, can provide the digit timestamp as the third argument of GetPedestalMean
-            pedestal = pedestalRetrievalAlg.PedMean(channel);
-            
+            float pedestal = pedestalRetrievalAlg.PedMean(channel);
+
             // Get the pedestal subtracted data, centered in the deconvolution vector
-            std::vector<float> rawAdcLessPedVec(dataSize);
-            
+            // (every element is overwritten below, no need to zero the buffer)
+            rawAdcLessPedVec.resize(dataSize);
+
             std::transform(rawadc.begin(),rawadc.end(),rawAdcLessPedVec.begin(),std::bind(std::minus<short>(),std::placeholders::_1,pedestal));
-            
+
             // It seems there are deviations from the pedestal when using wirecell for noise filtering
             float raw_noise = fixTheFreakingWaveform(rawAdcLessPedVec, channel, rawAdcLessPedVec);
-            
+
             // Recover a measure of the noise on the channel for use in the ROI finder
             //float raw_noise = getTruncatedRMS(rawAdcLessPedVec);
-            
+
             // Try smoothing the input waveform
 //            std::vector<float> rawAdcSmoothVec;
 //            fWaveformTool->medianSmooth(rawAdcLessPedVec,rawAdcSmoothVec);
-            
+
             // vector of candidate ROI begin and end bins
-            icarus_tool::IROIFinder::CandidateROIVec candRoiVec;
+            // (not all the finder tools clear their output first)
+            candRoiVec.clear();
 
             // Now find the candidate ROI's
-            fROIFinderVec.at(planeID.Plane)->FindROIs(rawAdcLessPedVec, channel, fEventCount, raw_noise, candRoiVec);
-            
+            fROIFinderVec.at(planeIdx)->FindROIs(rawAdcLessPedVec, channel, fEventCount, raw_noise, candRoiVec);
+
+            // The ROI census is now final: fix the nominal size of the sparse
+            // vector up front instead of letting each add_range() extend it
+            ROIVec.resize(dataSize);
+
             // Do the deconvolution
             fDeconvolution->Deconvolve(rawAdcLessPedVec, samplingRate, channel, candRoiVec, ROIVec);
-            
+
+            // Optionally quantize the deconvolved values (see quantizeROIs)
+            if (fQuantizeROIs) quantizeROIs(ROIVec);
+
             // Make some histograms?
             if (fOutputHistograms)
             {
-                // First up, determine what kind of wire we have
-                std::vector<geo::WireID> wids    = fGeometry->ChannelToWire(channel);
-                const geo::PlaneID&      planeID = wids[0].planeID();
-                
-                fNumROIsHistVec.at(planeID.Plane)->Fill(candRoiVec.size(), 1.);
-                
+                fNumROIsHistVec.at(planeIdx)->Fill(candRoiVec.size(), 1.);
+
                 for(const auto& pair : candRoiVec)
-                    fROILenHistVec.at(planeID.Plane)->Fill(pair.second-pair.first, 1.);
+                    fROILenHistVec.at(planeIdx)->Fill(pair.second-pair.first, 1.);
             }
-        } // end if not a bad channel
+        } // end loop over the wires of the batch
+    };
+
+    // Optionally interleave the plane batches across TBB workers, each pinned
+    // to the kernels of its own plane. Note this requires the configured
+    // deconvolution tool to be re-entrant, and histogram filling is not
+    // thread safe, so with histograms on the batches stay sequential
+    if (fParallelPlanes && !fOutputHistograms)
+    {
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, planeBatches.size(), 1),
+            [&](const tbb::blocked_range<size_t>& range)
+            {
+                for(size_t planeIdx = range.begin(); planeIdx < range.end(); planeIdx++)
+                    processPlaneBatch(planeIdx);
+            });
+    }
+    else
+    {
+        for(size_t planeIdx = 0; planeIdx < planeBatches.size(); planeIdx++)
+            processPlaneBatch(planeIdx);
+    }
+
+    // commit the wires in the original digit order
+    wirecol->reserve(numDigits);
+    for(size_t rdIter = 0; rdIter < numDigits; ++rdIter)
+    {
+        if (!useDigit[rdIter]) continue;
+
+        art::Ptr<raw::RawDigit> digitVec(digitVecHandle, rdIter);
 
         // create the new wire directly in wirecol
-        wirecol->push_back(recob::WireCreator(std::move(ROIVec),*digitVec).move());
+        wirecol->push_back(recob::WireCreator(std::move(roiVecs[rdIter]),*digitVec).move());
 
         // add an association between the last object in wirecol
         // (that we just inserted) and digitVec
@@ -370,6 +436,39 @@ float RecoWireROIICARUS::getTruncatedRMS(const std::vector<float>& waveform) con
     return truncRms;
 }
     
+void RecoWireROIICARUS::quantizeROIs(recob::Wire::RegionsOfInterest_t& roiVec) const
+{
+    // The recob::Wire format (and all its consumers) wants floats, but the
+    // full float precision of the deconvolved values is noise: most consumers
+    // re-quantize anyway. Rounding each ROI onto a 16 bit fixed point grid
+    // (scale set per ROI by its largest magnitude) leaves the values as
+    // ordinary floats while making the mantissas repeat, which roughly halves
+    // the size of the wire branch once ROOT compresses it
+    recob::Wire::RegionsOfInterest_t quantizedVec(roiVec.size());
+
+    std::vector<float> quantized;
+
+    for(const auto& range : roiVec.get_ranges())
+    {
+        quantized = range.data();
+
+        float maxVal = 0.;
+        for(const auto& val : quantized) maxVal = std::max(maxVal, std::fabs(val));
+
+        if (maxVal > 0.)
+        {
+            float scale = maxVal / 32767.;
+            for(auto& val : quantized) val = std::round(val / scale) * scale;
+        }
+
+        quantizedVec.add_range(range.begin_index(), std::move(quantized));
+    }
+
+    roiVec = std::move(quantizedVec);
+
+    return;
+}
+
 float RecoWireROIICARUS::fixTheFreakingWaveform(const std::vector<float>& waveform, raw::ChannelID_t channel, std::vector<float>& fixedWaveform)
 {
     // Get the truncated mean and rms
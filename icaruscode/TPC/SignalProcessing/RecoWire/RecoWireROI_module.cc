@@ -254,17 +254,24 @@ void RecoWireROI::produce(art::Event& evt)
 
     // We'll need to set the transform size once we get the waveform and know its size
     size_t transformSize = 0;
-    
+
+    // scratch buffers reused across wires so their capacity is allocated once
+    // per event rather than once per wire
+    std::vector<short>                     rawadc;
+    icarusutil::TimeVec                    rawAdcLessPedVec;
+    std::vector<std::pair<size_t, size_t>> rois;
+    std::vector<float>                     holder;
+
     // loop over all wires
     wirecol->reserve(digitVecHandle->size());
     for(size_t rdIter = 0; rdIter < digitVecHandle->size(); ++rdIter)
     {
         // vector that will be moved into the Wire object
         recob::Wire::RegionsOfInterest_t ROIVec;
-      
+
         // vector of ROI begin and end bins
-        std::vector<std::pair<size_t, size_t>> rois;
-      
+        rois.clear();
+
         // get the reference to the current raw::RawDigit
         art::Ptr<raw::RawDigit> digitVec(digitVecHandle, rdIter);
         channel = digitVec->Channel();
@@ -287,8 +294,8 @@ void RecoWireROI::produce(art::Event& evt)
             }
             
             // vector holding uncompressed adc values
-            std::vector<short> rawadc(dataSize);
-            
+            rawadc.resize(dataSize);
+
             std::vector<geo::WireID> wids     = fGeometry.ChannelToWire(channel);
             size_t                   thePlane = wids[0].Plane;
             
@@ -303,10 +310,9 @@ void RecoWireROI::produce(art::Event& evt)
                 transformSize = dataSize;
             }
             
-            icarusutil::TimeVec rawAdcLessPedVec;
-            
-            rawAdcLessPedVec.resize(transformSize,0.);
-            
+            // no need to zero the buffer: every element is overwritten below
+            rawAdcLessPedVec.resize(transformSize);
+
             // uncompress the data
             raw::Uncompress(digitVec->ADCs(), rawadc, digitVec->Compression());
             
@@ -425,16 +431,18 @@ void RecoWireROI::produce(art::Event& evt)
                 
                 // Make sure to get the last one
                 trois.push_back(std::pair<size_t,size_t>(startRoi,stopRoi));
-	  
-                rois = trois;
+
+                rois = std::move(trois);
             }
-            
+
+            // The ROI census is now final: fix the nominal size of the sparse
+            // vector up front instead of letting each add_range() extend it
+            ROIVec.resize(dataSize);
+
             // Strategy is to run deconvolution on the entire channel and then pick out the ROI's we found above
             // Deconvolute the raw signal using the channel's nominal response
             fFFT->deconvolute(rawAdcLessPedVec, fSignalServices.GetResponse(channel).getDeconvKernel(), fSignalServices.ResponseTOffset(channel));
-            
-            std::vector<float> holder;
-            
+
             for(size_t roiIdx = 0; roiIdx < rois.size(); roiIdx++)
             {
                 const auto roi = rois[roiIdx];
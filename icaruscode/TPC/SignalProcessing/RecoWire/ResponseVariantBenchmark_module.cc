@@ -0,0 +1,233 @@
+////////////////////////////////////////////////////////////////////////
+//
+// ResponseVariantBenchmark
+//
+// Deconvolves the same wires with every response variant resident in
+// SignalShapingICARUSService (see the ResponseVariants parameter of that
+// service) and reports, at the end of the job, the deconvolution timing
+// of each variant and the size of the output differences with respect to
+// the default response set. This allows A/B comparison of response
+// function candidates in a single job instead of one full production per
+// candidate.
+//
+// Configuration parameters:
+//
+// DigitModuleLabel    - the input source of (pedestal corrected) raw digits
+// MaxChannelsPerEvent - benchmark at most this many channels per event
+//                       (0: all of them)
+//
+////////////////////////////////////////////////////////////////////////
+
+#include <cmath>
+#include <chrono>
+#include <string>
+#include <vector>
+#include <map>
+
+#include "art/Framework/Core/ModuleMacros.h"
+#include "art/Framework/Core/EDAnalyzer.h"
+#include "art/Framework/Principal/Event.h"
+#include "art/Framework/Principal/Handle.h"
+#include "art/Framework/Services/Registry/ServiceHandle.h"
+#include "canvas/Utilities/InputTag.h"
+#include "messagefacility/MessageLogger/MessageLogger.h"
+#include "fhiclcpp/ParameterSet.h"
+
+#include "lardata/DetectorInfoServices/DetectorPropertiesService.h"
+#include "lardata/DetectorInfoServices/DetectorClocksService.h"
+#include "lardataobj/RawData/RawDigit.h"
+#include "lardataobj/RawData/raw.h"
+
+#include "icaruscode/TPC/Utilities/SignalShapingICARUSService_service.h"
+#include "icaruscode/TPC/Utilities/tools/SignalProcessingDefs.h"
+
+#include "icarus_signal_processing/Filters/ICARUSFFT.h"
+
+namespace caldata
+{
+
+class ResponseVariantBenchmark : public art::EDAnalyzer
+{
+public:
+    explicit ResponseVariantBenchmark(fhicl::ParameterSet const& pset);
+    virtual ~ResponseVariantBenchmark();
+
+    void analyze(const art::Event& evt) override;
+    void beginJob()                     override;
+    void endJob()                       override;
+
+private:
+
+    // Per variant accumulators for the whole job
+    struct VariantStats
+    {
+        size_t numWires    = 0;     ///< wires deconvolved with this variant
+        double totalTime   = 0.;    ///< total deconvolution time (us)
+        double sumMaxDelta = 0.;    ///< sum over wires of max |delta| wrt default
+        double maxMaxDelta = 0.;    ///< largest |delta| seen on any wire
+        double sumSqDelta  = 0.;    ///< sum of squared deltas over all samples
+        size_t numSamples  = 0;     ///< total samples compared
+    };
+
+    art::InputTag                                                fDigitModuleLabel;    ///< input raw digits
+    size_t                                                       fMaxChannelsPerEvent; ///< cap on benchmarked channels per event
+
+    std::vector<std::string>                                     fVariantNames;        ///< the variants resident in the service
+    std::map<std::string, VariantStats>                          fVariantStats;        ///< accumulated results, by variant ("" = default)
+
+    std::unique_ptr<icarus_signal_processing::ICARUSFFT<double>> fFFT;                 ///< Object to handle thread safe FFT
+
+    art::ServiceHandle<icarusutil::SignalShapingICARUSService>   fSignalShaping;
+};
+
+DEFINE_ART_MODULE(ResponseVariantBenchmark)
+
+//----------------------------------------------------------------------
+ResponseVariantBenchmark::ResponseVariantBenchmark(fhicl::ParameterSet const& pset) :
+    EDAnalyzer(pset)
+{
+    fDigitModuleLabel    = pset.get<art::InputTag>("DigitModuleLabel");
+    fMaxChannelsPerEvent = pset.get<size_t>       ("MaxChannelsPerEvent", 0);
+}
+
+//----------------------------------------------------------------------
+ResponseVariantBenchmark::~ResponseVariantBenchmark()
+{}
+
+//----------------------------------------------------------------------
+void ResponseVariantBenchmark::beginJob()
+{
+    fSignalShaping = art::ServiceHandle<icarusutil::SignalShapingICARUSService>();
+
+    fVariantNames = fSignalShaping->GetResponseVariantNames();
+
+    if (fVariantNames.empty())
+        mf::LogWarning("ResponseVariantBenchmark") << "No response variants configured in SignalShapingICARUSService, only the default set will be timed" << std::endl;
+
+    auto const detProp = art::ServiceHandle<detinfo::DetectorPropertiesService const>()->DataForJob();
+
+    fFFT = std::make_unique<icarus_signal_processing::ICARUSFFT<double>>(detProp.NumberTimeSamples());
+
+    return;
+}
+
+//----------------------------------------------------------------------
+void ResponseVariantBenchmark::analyze(const art::Event& evt)
+{
+    art::Handle<std::vector<raw::RawDigit>> digitVecHandle;
+    evt.getByLabel(fDigitModuleLabel, digitVecHandle);
+
+    if (!digitVecHandle.isValid() || digitVecHandle->empty()) return;
+
+    auto const clockData    = art::ServiceHandle<detinfo::DetectorClocksService const>()->DataFor(evt);
+    double     samplingRate = sampling_rate(clockData);
+
+    size_t numChannels = digitVecHandle->size();
+
+    if (fMaxChannelsPerEvent > 0) numChannels = std::min(numChannels, fMaxChannelsPerEvent);
+
+    raw::RawDigit::ADCvector_t rawadc;
+    icarusutil::TimeVec        rawAdcLessPedVec;
+    icarusutil::TimeVec        deconVec;
+    icarusutil::TimeVec        referenceVec;
+
+    for(size_t digitIdx = 0; digitIdx < numChannels; digitIdx++)
+    {
+        const raw::RawDigit& digit = digitVecHandle->at(digitIdx);
+
+        size_t dataSize = digit.Samples();
+
+        if (!dataSize) continue;
+
+        raw::ChannelID_t channel = digit.Channel();
+
+        // Make sure the deconvolution kernels match the current conditions
+        fSignalShaping->SetDecon(samplingRate, dataSize, channel);
+
+        // Recover the pedestal subtracted waveform
+        rawadc.resize(dataSize);
+        rawAdcLessPedVec.resize(dataSize);
+
+        raw::Uncompress(digit.ADCs(), rawadc, digit.Compression());
+
+        float pedestal = digit.GetPedestal();
+
+        for(size_t binIdx = 0; binIdx < dataSize; binIdx++) rawAdcLessPedVec[binIdx] = rawadc[binIdx] - pedestal;
+
+        // The default set goes first and provides the reference output.
+        // The empty name selects the default set in the service
+        std::vector<std::string> variantsToRun;
+
+        variantsToRun.push_back("");
+        variantsToRun.insert(variantsToRun.end(), fVariantNames.begin(), fVariantNames.end());
+
+        for(const std::string& variantName : variantsToRun)
+        {
+            const icarusutil::FrequencyVec& deconKernel = fSignalShaping->GetResponse(channel, variantName).getDeconvKernel();
+
+            deconVec = rawAdcLessPedVec;
+
+            auto startTime = std::chrono::high_resolution_clock::now();
+
+            fFFT->deconvolute(deconVec, deconKernel, fSignalShaping->ResponseTOffset(channel));
+
+            auto stopTime = std::chrono::high_resolution_clock::now();
+
+            VariantStats& stats = fVariantStats[variantName];
+
+            stats.numWires  += 1;
+            stats.totalTime += std::chrono::duration<double, std::micro>(stopTime - startTime).count();
+
+            if (variantName.empty()) referenceVec = deconVec;
+            else
+            {
+                // Output deltas of this variant with respect to the default
+                double maxDelta = 0.;
+
+                for(size_t binIdx = 0; binIdx < dataSize; binIdx++)
+                {
+                    double delta = deconVec[binIdx] - referenceVec[binIdx];
+
+                    maxDelta          = std::max(maxDelta, std::abs(delta));
+                    stats.sumSqDelta += delta * delta;
+                }
+
+                stats.sumMaxDelta += maxDelta;
+                stats.maxMaxDelta  = std::max(stats.maxMaxDelta, maxDelta);
+                stats.numSamples  += dataSize;
+            }
+        }
+    }
+
+    return;
+}
+
+//----------------------------------------------------------------------
+void ResponseVariantBenchmark::endJob()
+{
+    mf::LogInfo log("ResponseVariantBenchmark");
+
+    log << "Response variant benchmark results (deltas are with respect to the default response set):";
+
+    for(const auto& statsPair : fVariantStats)
+    {
+        const std::string&  variantName = statsPair.first.empty() ? "<default>" : statsPair.first;
+        const VariantStats& stats       = statsPair.second;
+
+        if (!stats.numWires) continue;
+
+        log << "\n  " << variantName << ": " << stats.numWires << " wires, "
+            << stats.totalTime / double(stats.numWires) << " us/wire";
+
+        if (stats.numSamples)
+        {
+            log << ", <max|delta|>/wire: " << stats.sumMaxDelta / double(stats.numWires)
+                << ", largest |delta|: "   << stats.maxMaxDelta
+                << ", rms delta: "         << std::sqrt(stats.sumSqDelta / double(stats.numSamples));
+        }
+    }
+
+    return;
+}
+
+} // end of namespace caldata
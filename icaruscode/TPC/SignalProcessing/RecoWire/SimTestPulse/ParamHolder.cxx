@@ -15,4 +15,26 @@ namespace alternative {
 
   void ParamHolder::Clear()
   { _hit_v.clear(); }
+
+  PulseCache* PulseCache::_me = nullptr;
+
+  void PulseCache::Store(const std::string& key,
+                         const std::vector<sim::SimChannel>& simch_v,
+                         const std::vector<sim::SimEnergyDeposit>& simde_v,
+                         const std::vector<alternative::TruthHit>& hit_v,
+                         const std::vector<int>& tick_v,
+                         const std::vector<std::vector<int> >& channel_vv,
+                         const std::vector<std::vector<int> >& wire_vv,
+                         const std::vector<std::vector<std::vector<double> > >& position_vvv)
+  {
+    _key = key;
+    _simch_v = simch_v;
+    _simde_v = simde_v;
+    _hit_v = hit_v;
+    _tick_v = tick_v;
+    _channel_vv = channel_vv;
+    _wire_vv = wire_vv;
+    _position_vvv = position_vvv;
+    _valid = true;
+  }
 }
@@ -2,8 +2,12 @@
 #define __SIMTESTPULSE_PARAMHOLDER_H__
 
 #include <array>
+#include <string>
 #include <vector>
 
+#include "lardataobj/Simulation/SimChannel.h"
+#include "lardataobj/Simulation/SimEnergyDeposit.h"
+
 namespace alternative {
 
   struct TruthHit {
@@ -38,5 +42,59 @@ namespace alternative {
     static ParamHolder* _me;
     std::vector<alternative::TruthHit> _hit_v;
   };
+
+  // The test pulses are fully determined by the module configuration (and the
+  // clock settings), so every event of a job injects the same products. This
+  // singleton caches everything the first event generated, keyed by a string
+  // encoding the generating parameters, so that later events (and other module
+  // instances with the same configuration) skip the geometry searches and
+  // SimChannel construction and just copy the cached vectors into the event.
+  class PulseCache {
+  private:
+    PulseCache() : _valid(false) {}
+  public:
+    ~PulseCache() {}
+
+    static PulseCache& get()
+    { if(!_me) _me = new PulseCache;
+      return *_me;
+    }
+
+    static void destroy()
+    { if(_me) { delete _me; _me = nullptr; } }
+
+    bool Valid(const std::string& key) const
+    { return _valid && key == _key; }
+
+    void Store(const std::string& key,
+               const std::vector<sim::SimChannel>& simch_v,
+               const std::vector<sim::SimEnergyDeposit>& simde_v,
+               const std::vector<alternative::TruthHit>& hit_v,
+               const std::vector<int>& tick_v,
+               const std::vector<std::vector<int> >& channel_vv,
+               const std::vector<std::vector<int> >& wire_vv,
+               const std::vector<std::vector<std::vector<double> > >& position_vvv
+                 = std::vector<std::vector<std::vector<double> > >());
+
+    const std::vector<sim::SimChannel>&       SimChannelArray()       const { return _simch_v; }
+    const std::vector<sim::SimEnergyDeposit>& SimEnergyDepositArray() const { return _simde_v; }
+    const std::vector<alternative::TruthHit>& TruthHitArray()         const { return _hit_v;   }
+    const std::vector<int>&                   TickArray()             const { return _tick_v;  }
+    const std::vector<std::vector<int> >&     ChannelArrays()         const { return _channel_vv; }
+    const std::vector<std::vector<int> >&     WireArrays()            const { return _wire_vv; }
+    const std::vector<std::vector<std::vector<double> > >& PositionArrays() const { return _position_vvv; }
+
+  private:
+    static PulseCache* _me;
+    bool _valid;
+    std::string _key;
+    std::vector<sim::SimChannel> _simch_v;
+    std::vector<sim::SimEnergyDeposit> _simde_v;
+    std::vector<alternative::TruthHit> _hit_v;
+    std::vector<int> _tick_v;
+    std::vector<std::vector<int> > _channel_vv;
+    std::vector<std::vector<int> > _wire_vv;
+    std::vector<std::vector<std::vector<double> > > _position_vvv;
+  };
 }
 #endif
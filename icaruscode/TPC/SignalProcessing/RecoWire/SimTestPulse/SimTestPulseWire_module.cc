@@ -61,6 +61,8 @@ private:
 
     bool fVerbose; ///< verbosity
 
+    std::string fCacheKey; ///< Parameter key for the shared generate-once pulse cache
+
     using WireVec        = std::vector<int>;
     using WireVecVec     = std::vector<WireVec>;
 
@@ -117,7 +119,12 @@ SimTestPulseWire::SimTestPulseWire(fhicl::ParameterSet const & p)
     fWiresByPlaneVec[2] = p.get< WireVec             >("Plane2Wires");
     fNumElectrons_v     = p.get< std::vector<double> >("NumElectronsArray");
     fVerbose            = p.get< bool>                ("Verbose",false);
-    
+
+    // The products are fully determined by the configuration: the full
+    // parameter set keys the generate-once pulse cache shared across events
+    // and module instances
+    fCacheKey = "SimTestPulseWire;" + p.to_string();
+
     assert( fSimTime_v.size() == fWiresByPlaneVec[0].size() &&
             fSimTime_v.size() == fWiresByPlaneVec[1].size() &&
             fSimTime_v.size() == fWiresByPlaneVec[2].size() &&
@@ -151,6 +158,7 @@ void SimTestPulseWire::beginJob()
 void SimTestPulseWire::endJob()
 {
     alternative::ParamHolder::destroy();
+    alternative::PulseCache::destroy();
 }
 
 void SimTestPulseWire::beginRun(art::Run& run)
@@ -192,6 +200,41 @@ void SimTestPulseWire::produce(art::Event & e)
     auto& pholder = alternative::ParamHolder::get();
     pholder.Clear();
 
+    auto& pcache = alternative::PulseCache::get();
+
+    // Everything generated below is determined by the configuration and the
+    // clock settings: generate once, then re-inject copies on later events
+    // (and in other instances), one SimChannel copy per channel
+    const std::string cacheKey = fCacheKey
+        + ";" + std::to_string(clockData.TPCClock().TickPeriod())
+        + ";" + std::to_string(clockData.TriggerTime());
+
+    if(pcache.Valid(cacheKey)) {
+        if(fVerbose) std::cout << "[BUFFOON!] re-injecting cached test pulses" << std::endl;
+
+        *simch_v             = pcache.SimChannelArray();
+        *simDep_v            = pcache.SimEnergyDepositArray();
+        fTick_v              = pcache.TickArray();
+        fPlaneChannelVec     = pcache.ChannelArrays();
+        fPlanePositionVecVec = pcache.PositionArrays();
+
+        for(const auto& hit : pcache.TruthHitArray()) {
+            alternative::TruthHit pulse_record(hit);
+            pholder.Register(std::move(pulse_record));
+        }
+
+        _run = e.id().run();
+        _subrun = e.id().subRun();
+        _event = e.id().event();
+
+        fTupleTree->Fill();
+        e.put(std::move(simch_v));
+        e.put(std::move(simDep_v));
+        e.put(std::move(trigger_v));
+
+        return;
+    }
+
     for(size_t index=0; index < fSimTime_v.size(); ++index) {
         
         int tdc = fSimTime_v[index] / clockData.TPCClock().TickPeriod();
@@ -273,6 +316,9 @@ void SimTestPulseWire::produce(art::Event & e)
         pholder.Register(std::move(pulse_record));
     }
 
+    pcache.Store(cacheKey,*simch_v,*simDep_v,pholder.TruthHitArray(),fTick_v,
+                 fPlaneChannelVec,{},fPlanePositionVecVec);
+
     _run = e.id().run();
     _subrun = e.id().subRun();
     _event = e.id().event();
@@ -60,7 +60,9 @@ public:
 private:
 
     bool fVerbose; ///< verbosity
-    
+
+    std::string fCacheKey; ///< Parameter key for the shared generate-once pulse cache
+
     //
     // Parameters to be configured
     //
@@ -105,7 +107,12 @@ SimTestPulse::SimTestPulse(fhicl::ParameterSet const & p)
     fZ_v            = p.get< std::vector<double> >("ZArray_cm");
     fNumElectrons_v = p.get< std::vector<double> >("NumElectronsArray");
     fVerbose        = p.get< bool>                ("Verbose",false);
-    
+
+    // The products are fully determined by the configuration: the full
+    // parameter set keys the generate-once pulse cache shared across events
+    // and module instances
+    fCacheKey = "SimTestPulse;" + p.to_string();
+
     assert( fSimTime_v.size() == fY_v.size() &&
             fSimTime_v.size() == fZ_v.size() &&
             fSimTime_v.size() == fNumElectrons_v.size() );
@@ -138,6 +145,7 @@ void SimTestPulse::beginJob()
 void SimTestPulse::endJob()
 {
     alternative::ParamHolder::destroy();
+    alternative::PulseCache::destroy();
 }
 
 void SimTestPulse::beginRun(art::Run& run)
@@ -179,6 +187,45 @@ void SimTestPulse::produce(art::Event & e)
     auto& pholder = alternative::ParamHolder::get();
     pholder.Clear();
 
+    auto& pcache = alternative::PulseCache::get();
+
+    // Everything generated below is determined by the configuration and the
+    // clock settings: generate once, then re-inject copies on later events
+    // (and in other instances), one SimChannel copy per channel
+    const std::string cacheKey = fCacheKey
+        + ";" + std::to_string(clockData.TPCClock().TickPeriod())
+        + ";" + std::to_string(clockData.TriggerTime());
+
+    if(pcache.Valid(cacheKey)) {
+        if(fVerbose) std::cout << "[BUFFOON!] re-injecting cached test pulses" << std::endl;
+
+        *simch_v         = pcache.SimChannelArray();
+        *simDep_v        = pcache.SimEnergyDepositArray();
+        fTick_v          = pcache.TickArray();
+        fPlane0Channel_v = pcache.ChannelArrays()[0];
+        fPlane1Channel_v = pcache.ChannelArrays()[1];
+        fPlane2Channel_v = pcache.ChannelArrays()[2];
+        fPlane0Wire_v    = pcache.WireArrays()[0];
+        fPlane1Wire_v    = pcache.WireArrays()[1];
+        fPlane2Wire_v    = pcache.WireArrays()[2];
+
+        for(const auto& hit : pcache.TruthHitArray()) {
+            alternative::TruthHit pulse_record(hit);
+            pholder.Register(std::move(pulse_record));
+        }
+
+        _run = e.id().run();
+        _subrun = e.id().subRun();
+        _event = e.id().event();
+
+        fTupleTree->Fill();
+        e.put(std::move(simch_v));
+        e.put(std::move(simDep_v));
+        e.put(std::move(trigger_v));
+
+        return;
+    }
+
     for(size_t index=0; index < fSimTime_v.size(); ++index) {
         
         int tdc = fSimTime_v[index] / clockData.TPCClock().TickPeriod();
@@ -258,6 +305,10 @@ void SimTestPulse::produce(art::Event & e)
         pholder.Register(std::move(pulse_record));
     }
 
+    pcache.Store(cacheKey,*simch_v,*simDep_v,pholder.TruthHitArray(),fTick_v,
+                 {fPlane0Channel_v,fPlane1Channel_v,fPlane2Channel_v},
+                 {fPlane0Wire_v,fPlane1Wire_v,fPlane2Wire_v});
+
     _run = e.id().run();
     _subrun = e.id().subRun();
     _event = e.id().event();
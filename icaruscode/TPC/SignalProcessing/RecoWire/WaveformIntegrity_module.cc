@@ -16,6 +16,8 @@
 #include <iomanip>
 #include <fstream>
 #include <random>
+#include <limits>
+#include <cstring> // std::memcmp
 
 // ROOT libraries
 #include "TH1D.h"
@@ -47,6 +49,7 @@
 #include "larevt/CalibrationDBI/Interface/ChannelStatusService.h"
 #include "larevt/CalibrationDBI/Interface/ChannelStatusProvider.h"
 
+#include "icaruscode/Decode/DataProducts/ChannelOccupancyIndex.h"
 #include "icaruscode/TPC/SignalProcessing/RecoWire/DeconTools/IROIFinder.h"
 #include "icaruscode/TPC/SignalProcessing/RecoWire/DeconTools/IDeconvolution.h"
 #include "icaruscode/TPC/SignalProcessing/RecoWire/DeconTools/IBaseline.h"
@@ -76,6 +79,15 @@ class WaveformIntegrity : public art::ReplicatedProducer
     
   private:
 
+    // Summary of the ADC differences found on a single channel
+    struct ChannelDiffSummary
+    {
+        raw::ChannelID_t channel;
+        unsigned int     nDiffs;
+        short            minDiff;
+        short            maxDiff;
+    };
+
     // It seems there are pedestal shifts that need correcting
     float fixTheFreakingWaveform(const std::vector<float>&, raw::ChannelID_t, std::vector<float>&) const;
     
@@ -83,6 +95,9 @@ class WaveformIntegrity : public art::ReplicatedProducer
     
     std::vector<art::InputTag>                                 fNewRawDigitLabelVec;           ///< New Raw Digits
     std::vector<art::InputTag>                                 fOldRawDigitLabelVec;           ///< From previous run
+    bool                                                       fWindowedCompare;               ///< Compare only ROIs plus sidebands?
+    std::vector<art::InputTag>                                 fOccupancyIndexLabelVec;        ///< Source of the channel occupancy index
+    size_t                                                     fSidebandTicks;                 ///< # ticks around each ROI extent to include
 
     icarus_signal_processing::WaveformTools<float>             fWaveformTool;
 
@@ -106,7 +121,14 @@ void WaveformIntegrity::reconfigure(fhicl::ParameterSet const& pset)
     // Recover the parameters
     fNewRawDigitLabelVec = pset.get< std::vector<art::InputTag>> ("NewRawDigitLabelVec", {"daqTPC"});
     fOldRawDigitLabelVec = pset.get< std::vector<art::InputTag>> ("OldRawDigitLabelVec", {"daqTPC"});
-    
+
+    // Windowed comparison: restrict the check to the ROI extents recorded in the
+    // channel occupancy index (plus sidebands), making the module cheap enough
+    // to run inline with production decoding instead of dedicated campaigns
+    fWindowedCompare        = pset.get< bool                      > ("WindowedCompare",                     false);
+    fOccupancyIndexLabelVec = pset.get< std::vector<art::InputTag>> ("OccupancyIndexLabelVec", fNewRawDigitLabelVec);
+    fSidebandTicks          = pset.get< size_t                    > ("SidebandTicks",                         50);
+
     return;
 }
   
@@ -137,57 +159,126 @@ void WaveformIntegrity::produce(art::Event& evt, art::ProcessingFrame const& fra
             continue;
         }
 
-        for(size_t chanIdx = 0; chanIdx < newRawDigitHandle->size(); chanIdx++)
+        // If windowed comparison requested then recover the occupancy index
+        const icarus::ChannelOccupancyIndex* occupancyIndex(nullptr);
+
+        art::Handle<icarus::ChannelOccupancyIndex> occupancyHandle;
+
+        if (fWindowedCompare)
         {
-            // get the reference to the current raw::RawDigit
-            art::Ptr<raw::RawDigit> newDigitVec(newRawDigitHandle, chanIdx);
-            art::Ptr<raw::RawDigit> oldDigitVec(oldRawDigitHandle, chanIdx);
+            evt.getByLabel(fOccupancyIndexLabelVec[prodIdx],occupancyHandle);
 
-            raw::ChannelID_t newChannel = newDigitVec->Channel();
-            raw::ChannelID_t oldChannel = oldDigitVec->Channel();
+            if (occupancyHandle.isValid()) occupancyIndex = occupancyHandle.product();
+            else std::cout << "WaveformIntegrity asked for windowed compare but found no occupancy index, comparing full waveforms" << std::endl;
+        }
 
-            if (newChannel != oldChannel)
+        // The channels are compared in parallel; each task accumulates its own
+        // statistics and merges them under the mutex when done, so the checking
+        // is cheap enough to run inline with production decoding
+        tbb::spin_mutex                 resultsMutex;
+        std::vector<ChannelDiffSummary> diffSummaryVec;
+
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, newRawDigitHandle->size()),
+            [&](const tbb::blocked_range<size_t>& range)
             {
-                std::cout << "WaveformIntegrity finds channel mismatch, idx: " << chanIdx << ", new channel: " << newChannel << ", old channel: " << oldChannel << std::endl;
+                std::vector<ChannelDiffSummary> localSummaryVec;
+                std::vector<short>              newRawADC;
+                std::vector<short>              oldRawADC;
 
-                continue;
-            }
+                for(size_t chanIdx = range.begin(); chanIdx < range.end(); chanIdx++)
+                {
+                    // get the reference to the current raw::RawDigit
+                    art::Ptr<raw::RawDigit> newDigitVec(newRawDigitHandle, chanIdx);
+                    art::Ptr<raw::RawDigit> oldDigitVec(oldRawDigitHandle, chanIdx);
 
-            size_t dataSize = newDigitVec->Samples();
+                    raw::ChannelID_t newChannel = newDigitVec->Channel();
+                    raw::ChannelID_t oldChannel = oldDigitVec->Channel();
 
-            std::vector<short> newRawADC(dataSize);
-            std::vector<short> oldRawADC(dataSize);
-    
-            // uncompress the data
-            raw::Uncompress(newDigitVec->ADCs(), newRawADC, newDigitVec->Compression());
-            raw::Uncompress(oldDigitVec->ADCs(), oldRawADC, oldDigitVec->Compression());
+                    if (newChannel != oldChannel)
+                    {
+                        std::cout << "WaveformIntegrity finds channel mismatch, idx: " << chanIdx << ", new channel: " << newChannel << ", old channel: " << oldChannel << std::endl;
 
-            if (newRawADC != oldRawADC)
-            {
-                std::vector<short> diffVec;
-                std::vector<short> idxVec;
+                        continue;
+                    }
 
-                for(size_t tickIdx = 0; tickIdx < newRawADC.size(); tickIdx++)
-                {
-                    if (newRawADC[tickIdx] != oldRawADC[tickIdx])
+                    size_t dataSize = newDigitVec->Samples();
+
+                    // Comparison window: the full waveform, or the ROI extent
+                    // recorded in the occupancy index padded by the sidebands
+                    size_t compareBegin = 0;
+                    size_t compareEnd   = dataSize;
+
+                    if (occupancyIndex)
                     {
-                        diffVec.push_back(newRawADC[tickIdx] - oldRawADC[tickIdx]);
-                        idxVec.push_back(tickIdx);
+                        // No recorded activity on this channel? Then nothing to compare
+                        if (!occupancyIndex->isActive(newChannel)) continue;
+
+                        const auto& activityVec = occupancyIndex->channels;
+
+                        auto activityItr = std::lower_bound(activityVec.begin(),activityVec.end(),newChannel,[](const auto& activity, raw::ChannelID_t chan){return activity.channel < chan;});
+
+                        if (activityItr != activityVec.end() && activityItr->channel == newChannel)
+                        {
+                            compareBegin = activityItr->beginTick > fSidebandTicks ? size_t(activityItr->beginTick) - fSidebandTicks : 0;
+                            compareEnd   = std::min(dataSize, size_t(activityItr->endTick) + fSidebandTicks);
+                        }
+                    }
+
+                    newRawADC.resize(dataSize);
+                    oldRawADC.resize(dataSize);
+
+                    // uncompress the data
+                    raw::Uncompress(newDigitVec->ADCs(), newRawADC, newDigitVec->Compression());
+                    raw::Uncompress(oldDigitVec->ADCs(), oldRawADC, oldDigitVec->Compression());
+
+                    // Difference kernel: one pass over the two contiguous ADC
+                    // buffers which the compiler is able to vectorize
+                    const short* newADC = newRawADC.data();
+                    const short* oldADC = oldRawADC.data();
+
+                    // Early exit on identity: memcmp burns through the (usual) case
+                    // of bit-identical waveforms with wide vector compares
+                    if (compareEnd <= compareBegin || !std::memcmp(newADC + compareBegin, oldADC + compareBegin, (compareEnd - compareBegin) * sizeof(short))) continue;
+
+                    unsigned int nDiffs  = 0;
+                    short        minDiff = std::numeric_limits<short>::max();
+                    short        maxDiff = std::numeric_limits<short>::lowest();
+
+                    for(size_t tickIdx = compareBegin; tickIdx < compareEnd; tickIdx++)
+                    {
+                        short diff = newADC[tickIdx] - oldADC[tickIdx];
+
+                        if (diff == 0) continue;
+
+                        nDiffs++;
+                        if (diff > maxDiff) maxDiff = diff;
+                        if (diff < minDiff) minDiff = diff;
                     }
+
+                    if (nDiffs > 0) localSummaryVec.push_back(ChannelDiffSummary{newChannel,nDiffs,minDiff,maxDiff});
                 }
 
-                short maxDiff = *std::max_element(diffVec.begin(),diffVec.end());
-                short minDiff = *std::min_element(diffVec.begin(),diffVec.end());
-            
-                std::vector<geo::WireID> wireIDVec = fGeometry->ChannelToWire(newChannel);
+                if (!localSummaryVec.empty())
+                {
+                    tbb::spin_mutex::scoped_lock lock(resultsMutex);
 
-                std::cout << "==> Channel: " << newChannel << " - " << wireIDVec[0] << " - has " << diffVec.size() << " max/min: " << maxDiff << "/" << minDiff << std::endl;
-//                for(size_t idx = 0; diffVec.size(); idx++) std::cout << idxVec[idx] << "/" << diffVec[idx] << " ";
-//                std::cout << std::endl;
-            }
+                    std::copy(localSummaryVec.begin(),localSummaryVec.end(),std::back_inserter(diffSummaryVec));
+                }
+            });
 
+        // Report in channel order from the single thread we came in on
+        std::sort(diffSummaryVec.begin(),diffSummaryVec.end(),[](const auto& left,const auto& right){return left.channel < right.channel;});
+
+        for(const ChannelDiffSummary& diffSummary : diffSummaryVec)
+        {
+            std::vector<geo::WireID> wireIDVec = fGeometry->ChannelToWire(diffSummary.channel);
+
+            std::cout << "==> Channel: " << diffSummary.channel << " - " << wireIDVec[0] << " - has " << diffSummary.nDiffs << " max/min: " << diffSummary.maxDiff << "/" << diffSummary.minDiff << std::endl;
         }
 
+        if (!diffSummaryVec.empty())
+            std::cout << "==> WaveformIntegrity found " << diffSummaryVec.size() << " channels with differences out of " << newRawDigitHandle->size() << std::endl;
+
     }
 
     return;
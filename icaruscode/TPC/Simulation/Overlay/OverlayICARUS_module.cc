@@ -8,6 +8,15 @@
 // - Revised to use sim::RawDigit instead of rawdata::RawDigit, and to
 // - save the electron clusters associated with each digit.
 //
+// Note on background input: this module overlays simulated charge onto
+// background RawDigits it finds in the current event; the pairing of a
+// background event with each signal event - and all of the reading and
+// decompressing of the background files - is done upstream by the art
+// input source. Caching or pooling decoded background events across
+// events or processes therefore belongs in that source layer, not here;
+// what this module can do (and does) is avoid touching the samples of
+// background channels that receive no simulated charge at all.
+//
 ////////////////////////////////////////////////////////////////////////
 
 
@@ -204,9 +213,10 @@ void OverlayICARUS::produce(art::Event& evt)
     std::unique_ptr< std::vector<raw::RawDigit>> digcol(new std::vector<raw::RawDigit>);
     digcol->reserve(inputRawDigitHandle->size());
     
-    // vectors for working in the following for loop
+    // vectors for working in the following for loop; they are declared outside
+    // the loop so their allocations are recycled from one channel to the next
     std::vector<short>  adcvec;
-    icarusutil::TimeVec zeroCharge;
+    icarusutil::TimeVec chargeWork;
     
     //detector properties information
     auto const clockData = art::ServiceHandle<detinfo::DetectorClocksService>()->DataFor(evt);
@@ -225,19 +235,29 @@ void OverlayICARUS::produce(art::Event& evt)
         {
             size_t plane = widVec[0].Plane;    
 
+            // Check for the existence of a SimChannel for this channel
+            SimChannelMap::const_iterator simChanItr = simChannelMap.find(channel);
+
+            // Most channels in an overlay job carry no simulated charge and the
+            // background waveform passes through untouched. When the requested
+            // output compression matches the input there is nothing to gain by
+            // decompressing and recompressing it, so the input digit is copied
+            // to the output wholesale and the per-sample work skipped entirely
+            if (simChanItr == simChannelMap.end() && rawDigit.Compression() == fCompression && !(fMakeHistograms && plane == 2))
+            {
+                digcol->push_back(rawDigit);
+                continue;
+            }
+
             // Recover the ADC values and copy to local vector
             const raw::RawDigit::ADCvector_t& adcVector = rawDigit.ADCs();
 
             // Make sure local vector is correct size (and note the vector above may be compressed so can't use its size yet)
             adcvec.resize(rawDigit.Samples(),0);
-            zeroCharge.resize(rawDigit.Samples(),0);
 
-            // and do the copyh
+            // and decompress the data waveform into it, once per channel
             raw::Uncompress(adcVector, adcvec, rawDigit.Compression());
 
-            // Check for the existence of a SimChannel for this channel
-            SimChannelMap::const_iterator simChanItr = simChannelMap.find(channel);
-
             if (simChanItr != simChannelMap.end())
             {
                 // Recover the response function information for this channel
@@ -246,8 +266,9 @@ void OverlayICARUS::produce(art::Event& evt)
                 // Recover the SimChannel (if one) for this channel
                 const sim::SimChannel* simChan = simChanItr->second;
 
-                // Allocate local vector to hold the deposited charge
-                icarusutil::TimeVec chargeWork(adcvec.size(),0.);
+                // Reset the scratch vector holding the deposited charge
+                // (the underlying allocation is reused across channels)
+                chargeWork.assign(adcvec.size(),0.);
 
                 // Need the to convert from deposited number of electrons to ADC units
                 double gain = fSignalShapingService->GetASICGain(channel) * sampling_rate(clockData) * 1.e-3; // Gain returned is electrons/us, this converts to electrons/tick
@@ -297,16 +318,21 @@ void OverlayICARUS::produce(art::Event& evt)
         }
             
         // add this digit to the collection;
-        // adcvec is copied, not moved: in case of compression, adcvec will show
-        // less data: e.g. if the uncompressed adcvec has 9600 items, after
-        // compression it will have maybe 5000, but the memory of the other 4600
-        // is still there, although unused; a copy of adcvec will instead have
-        // only 5000 items. All 9600 items of adcvec will be recovered for free
-        // and used on the next loop.
-        raw::RawDigit rd(channel, adcvec.size(), adcvec, fCompression);
-        
+        // if there is no compression the mixed waveform is exactly the size of
+        // the digit, so it is moved wholesale rather than copied (the next
+        // channel allocates a fresh buffer, which is cheaper than copying this
+        // one out and halves the transient memory for the channel).
+        // In case of compression, adcvec will show less data: e.g. if the
+        // uncompressed adcvec has 9600 items, after compression it will have
+        // maybe 5000, but the memory of the other 4600 is still there, although
+        // unused; a copy of adcvec will instead have only 5000 items, and all
+        // 9600 items of adcvec will be recovered for free on the next loop.
+        raw::RawDigit rd = (fCompression == raw::kNone)?
+            raw::RawDigit(channel, adcvec.size(), std::move(adcvec), fCompression):
+            raw::RawDigit(channel, adcvec.size(), adcvec, fCompression);
+
         rd.SetPedestal(rawDigit.GetPedestal(),rawDigit.GetSigma());
-        digcol->push_back(std::move(rd)); // we do move the raw digit copy, though
+        digcol->push_back(std::move(rd)); // we do move the raw digit itself, though
     }
     
     evt.put(std::move(digcol));
@@ -316,16 +342,22 @@ void OverlayICARUS::produce(art::Event& evt)
 //-------------------------------------------------
 void OverlayICARUS::MakeADCVec(std::vector<short>& adcvec, icarusutil::TimeVec const& chargevec, float ped_mean) const
 {
+    // The clamping bounds are the same for every sample so they are hoisted
+    // out of the loop, leaving a body of pure arithmetic on contiguous data
+    // which the compiler can vectorize. The pedestal offset is folded into
+    // the bounds rather than added and removed sample by sample.
+    const float chargeMin = -ped_mean;
+    const float chargeMax = adcsaturation - ped_mean;
+
     for(unsigned int i = 0; i < adcvec.size(); ++i)
     {
-        // We offset for the channel's default pedestal
-        float adcval = chargevec[i] + ped_mean;
+        // Limit the simulated contribution to the range allowed for 12 bits
+        float adcval = std::max(chargeMin, std::min(float(chargevec[i]), chargeMax));
 
-        // Now make sure to limit the range to that allowed for 12 bits
-        adcval = std::max(float(0.), std::min(adcval, adcsaturation));
+        // Saturating add: the mixed sample cannot leave the 12 bit range either
+        float mixed = adcvec[i] + std::round(adcval);
 
-        // Remove the temporary offset while we add the signal to the existing vector. 
-        adcvec[i] += std::round(adcval - ped_mean);
+        adcvec[i] = short(std::max(float(0.), std::min(mixed, adcsaturation)));
     }// end loop over signal size
     // compress the adc vector using the desired compression scheme,
     // if raw::kNone is selected nothing happens to adcvec
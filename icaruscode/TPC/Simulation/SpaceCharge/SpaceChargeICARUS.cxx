@@ -78,6 +78,14 @@ bool spacecharge::SpaceChargeICARUS::Configure(fhicl::ParameterSet const& pset)
 		       hTrueEFieldX, hTrueEFieldY, hTrueEFieldZ};
 
 
+      //copy the maps into flat voxel grids and drop the ROOT histograms:
+      //every query below is served by trilinear interpolation on the grids
+      for(size_t i = 0; i < SCEhistograms.size(); i++){
+        SCEgrids.at(i).fillFrom(SCEhistograms.at(i));
+        delete SCEhistograms.at(i);
+        SCEhistograms.at(i) = nullptr;
+      }
+
       std::cout << "...finished loading TH3s" << std::endl;
     }
     infile->Close();
@@ -151,9 +159,9 @@ geo::Vector_t spacecharge::SpaceChargeICARUS::GetPosOffsets(geo::Point_t const&
     }
     fixCoords(&xx, &yy, &zz); //bring into AV and x = abs(x)
     double offset_x=0., offset_y=0., offset_z=0.;
-    offset_x = tpc_corr*cryo_corr*SCEhistograms.at(0)->Interpolate(xx,yy,zz);
-    offset_y = SCEhistograms.at(1)->Interpolate(xx,yy,zz);
-    offset_z = SCEhistograms.at(2)->Interpolate(xx,yy,zz);
+    offset_x = tpc_corr*cryo_corr*SCEgrids.at(0).interpolate(xx,yy,zz);
+    offset_y = SCEgrids.at(1).interpolate(xx,yy,zz);
+    offset_z = SCEgrids.at(2).interpolate(xx,yy,zz);
     thePosOffsets = {offset_x, offset_y, offset_z};
   }else{
     thePosOffsets.resize(3, 0.0);
@@ -193,9 +201,9 @@ geo::Vector_t spacecharge::SpaceChargeICARUS::GetPosOffsets(geo::Point_t const&
     if (!x_is_pos && (tpcid == 0 || tpcid == 1) && xx < 210.29 ) { xx = 210.29; }
 
     double offset_x=0., offset_y=0., offset_z=0.;
-    offset_x = corr*SCEhistograms.at(3)->Interpolate(xx,yy,zz);
-    offset_y = SCEhistograms.at(4)->Interpolate(xx,yy,zz);
-    offset_z = SCEhistograms.at(5)->Interpolate(xx,yy,zz);
+    offset_x = corr*SCEgrids.at(3).interpolate(xx,yy,zz);
+    offset_y = SCEgrids.at(4).interpolate(xx,yy,zz);
+    offset_z = SCEgrids.at(5).interpolate(xx,yy,zz);
     theCalPosOffsets = {offset_x, offset_y, offset_z};
   }else{
     theCalPosOffsets.resize(3, 0.0);
@@ -209,6 +217,15 @@ geo::Vector_t spacecharge::SpaceChargeICARUS::GetCalPosOffsets(geo::Point_t cons
   return GetCalPosOffsets(point, TPCid.TPC);
 }
 
+// Batched version of GetPosOffsets: one offset per input point
+void spacecharge::SpaceChargeICARUS::GetPosOffsets(std::vector<geo::Point_t> const& points, std::vector<geo::Vector_t>& offsets) const
+{
+  offsets.resize(points.size());
+  for(size_t i = 0; i < points.size(); i++){
+    offsets[i] = GetPosOffsets(points[i]);
+  }
+}
+
 // Primary working method of service that provides E field offsets
 geo::Vector_t spacecharge::SpaceChargeICARUS::GetEfieldOffsets(geo::Point_t const& point) const
 {
@@ -222,15 +239,70 @@ geo::Vector_t spacecharge::SpaceChargeICARUS::GetEfieldOffsets(geo::Point_t cons
     //handle OOAV by projecting edge cases
     //also only have map for positive cryostat (assume symmetry)
     fixCoords(&xx, &yy, &zz);
-    offset_x = SCEhistograms.at(6)->Interpolate(xx, yy, zz);
-    offset_y = SCEhistograms.at(7)->Interpolate(xx, yy, zz);
-    offset_z = SCEhistograms.at(8)->Interpolate(xx, yy, zz);
+    offset_x = SCEgrids.at(6).interpolate(xx, yy, zz);
+    offset_y = SCEgrids.at(7).interpolate(xx, yy, zz);
+    offset_z = SCEgrids.at(8).interpolate(xx, yy, zz);
 
     theEfieldOffsets = {offset_x, offset_y, offset_z};
   }
   return { theEfieldOffsets[0], theEfieldOffsets[1], theEfieldOffsets[2] };
 }
 
+// Flatten a (uniformly binned) TH3 into a contiguous voxel array
+void spacecharge::SpaceChargeICARUS::VoxelGrid::fillFrom(const TH3F* hist){
+  const TAxis* ax = hist->GetXaxis();
+  const TAxis* ay = hist->GetYaxis();
+  const TAxis* az = hist->GetZaxis();
+  nx = ax->GetNbins();
+  ny = ay->GetNbins();
+  nz = az->GetNbins();
+  x0 = ax->GetBinCenter(1);
+  y0 = ay->GetBinCenter(1);
+  z0 = az->GetBinCenter(1);
+  invdx = 1.0/ax->GetBinWidth(1);
+  invdy = 1.0/ay->GetBinWidth(1);
+  invdz = 1.0/az->GetBinWidth(1);
+  data.resize((size_t)nx*ny*nz);
+  for(int ix = 1; ix <= nx; ix++){
+    for(int iy = 1; iy <= ny; iy++){
+      for(int iz = 1; iz <= nz; iz++){
+        data[(((size_t)(ix-1)*ny)+(iy-1))*nz+(iz-1)] = hist->GetBinContent(ix, iy, iz);
+      }
+    }
+  }
+}
+
+// Trilinear interpolation between bin centers, same answer as TH3::Interpolate
+double spacecharge::SpaceChargeICARUS::VoxelGrid::interpolate(double xx, double yy, double zz) const{
+  //fractional voxel coordinates relative to the first bin center;
+  //queries beyond the grid of centers are projected onto its edge,
+  //in the same spirit as fixCoords() projecting onto the AV boundary
+  double fx = (xx-x0)*invdx;
+  double fy = (yy-y0)*invdy;
+  double fz = (zz-z0)*invdz;
+  if(fx<0.){fx=0.;} if(fx>nx-1.){fx=nx-1.;}
+  if(fy<0.){fy=0.;} if(fy>ny-1.){fy=ny-1.;}
+  if(fz<0.){fz=0.;} if(fz>nz-1.){fz=nz-1.;}
+  //lower corner of the 2x2x2 cell of voxels surrounding the point
+  int ix = int(fx); if(ix>nx-2){ix=nx-2;} if(ix<0){ix=0;}
+  int iy = int(fy); if(iy>ny-2){iy=ny-2;} if(iy<0){iy=0;}
+  int iz = int(fz); if(iz>nz-2){iz=nz-2;} if(iz<0){iz=0;}
+  double tx = fx-ix;
+  double ty = fy-iy;
+  double tz = fz-iz;
+  const size_t idx = ((size_t)ix*ny+iy)*nz+iz;
+  const size_t dy = nz;
+  const size_t dx = (size_t)ny*nz;
+  //blend the eight corners along z, then y, then x
+  double c00 = data[idx]*(1.-tz)       + data[idx+1]*tz;
+  double c01 = data[idx+dy]*(1.-tz)    + data[idx+dy+1]*tz;
+  double c10 = data[idx+dx]*(1.-tz)    + data[idx+dx+1]*tz;
+  double c11 = data[idx+dx+dy]*(1.-tz) + data[idx+dx+dy+1]*tz;
+  double c0 = c00*(1.-ty) + c01*ty;
+  double c1 = c10*(1.-ty) + c11*ty;
+  return c0*(1.-tx) + c1*tx;
+}
+
 void spacecharge::SpaceChargeICARUS::fixCoords(double* xx, double* yy, double* zz) const{
   //handle the edge cases by projecting SCE corrections onto boundaries
   *xx = abs(*xx);
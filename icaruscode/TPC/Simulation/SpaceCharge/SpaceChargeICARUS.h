@@ -64,6 +64,9 @@ namespace spacecharge
       geo::Vector_t GetCalPosOffsets(geo::Point_t const& point, int const& TPCid) const override;
       geo::Vector_t GetCalPosOffsets(geo::Point_t const& point, geo::TPCID const& TPCid) const;
       geo::Vector_t GetCalEfieldOffsets(geo::Point_t const& point, int const& TPCid = 1) const override { return {0.,0.,0.}; }
+      //batched query: fills one position offset per input point,
+      //amortizing the per-call overhead when reco collects many queries
+      void GetPosOffsets(std::vector<geo::Point_t> const& points, std::vector<geo::Vector_t>& offsets) const;
 
     private:
     protected:
@@ -73,6 +76,20 @@ namespace spacecharge
       ////////////////////////////
       std::vector<TH3F*> SCEhistograms = std::vector<TH3F*>(9);
 
+      //flat copy of a (uniformly binned) TH3 for fast trilinear
+      //interpolation between bin centers: gives the same answer as
+      //TH3::Interpolate without the virtual calls and axis searches
+      //ROOT performs on every query
+      struct VoxelGrid {
+        int nx = 0, ny = 0, nz = 0;                //number of bins per axis
+        double x0 = 0., y0 = 0., z0 = 0.;          //first bin center per axis
+        double invdx = 0., invdy = 0., invdz = 0.; //inverse bin widths
+        std::vector<float> data;                   //bin contents, z fastest
+        void fillFrom(const TH3F* hist);
+        double interpolate(double xx, double yy, double zz) const;
+      };
+      std::vector<VoxelGrid> SCEgrids = std::vector<VoxelGrid>(9);
+
       //////////////////////////////
       // DECLARE FHICL PARAMETERS
       /////////////////////////////
@@ -148,13 +148,16 @@ void TrajectoryMCSFitterICARUS::breakTrajInSegments(const recob::TrackTrajectory
   return;
 }
 
-const TrajectoryMCSFitterICARUS::ScanResult TrajectoryMCSFitterICARUS::doLikelihoodScan(std::vector<float>& dtheta, std::vector<float>& seg_nradlengths, std::vector<float>& cumLen, bool fwdFit, bool momDepConst, int pid) const {
+const TrajectoryMCSFitterICARUS::ScanResult TrajectoryMCSFitterICARUS::doLikelihoodScan(std::vector<float>& dtheta, std::vector<float>& seg_nradlengths, std::vector<float>& cumLen, bool /* fwdFit: direction is encoded in cumLen */, bool momDepConst, int pid) const {
   int    best_idx  = -1;
   double best_logL = std::numeric_limits<double>::max();
   double best_p    = -1.0;
   std::vector<float> vlogL;
+  //first phase: pack the momentum-independent segment quantities once,
+  //the scan below only does arithmetic on these arrays
+  const SegmentData segs = prepareSegmentData(dtheta, seg_nradlengths, cumLen);
  for (double p_test = pMin_; p_test <= pMax_; p_test+=pStep_) {
-    double logL = mcsLikelihood(p_test, angResol_, dtheta, seg_nradlengths, cumLen, fwdFit, momDepConst, pid);
+    double logL = mcsLikelihood(p_test, angResol_, segs, momDepConst, pid);
     if (logL < best_logL) {
       best_p    = p_test;
       best_logL = logL;
@@ -259,15 +262,26 @@ void TrajectoryMCSFitterICARUS::linearRegression(const recob::TrackTrajectory& t
   //
 }
 
-double TrajectoryMCSFitterICARUS::mcsLikelihood(double p, double theta0x, std::vector<float>& dthetaij, std::vector<float>& seg_nradl, std::vector<float>& cumLen, bool fwd, bool momDepConst, int pid) const {
+TrajectoryMCSFitterICARUS::SegmentData TrajectoryMCSFitterICARUS::prepareSegmentData(const std::vector<float>& dthetaij, const std::vector<float>& seg_nradl, const std::vector<float>& cumLen) const {
   //
-  const int beg  = (fwd ? 0 : (dthetaij.size()-1));
-  const int end  = (fwd ? dthetaij.size() : -1);
-  const int incr = (fwd ? +1 : -1);
-  //
-//  bool print;
-//  if(p>1.29&&p<1.32)  print = true;//(p>1.999 && p<2.001);
-//  else print=false;
+  SegmentData segs;
+  segs.dtheta.reserve(dthetaij.size());
+  segs.radlFactor.reserve(dthetaij.size());
+  segs.cumLen.reserve(dthetaij.size());
+  constexpr double HL_term2 = 0.038;
+  for (unsigned int i = 0; i<dthetaij.size(); i++) {
+    if (dthetaij[i]<0) {
+      //cout << "skip segment with too few points" << endl;
+      continue;
+    }
+    segs.dtheta.push_back(dthetaij[i]);
+    segs.radlFactor.push_back( ( 1.0 + HL_term2 * std::log( seg_nradl[i] ) ) * sqrt( seg_nradl[i] ) );
+    segs.cumLen.push_back(cumLen[i]);
+  }
+  return segs;
+}
+
+double TrajectoryMCSFitterICARUS::mcsLikelihood(double p, double theta0x, const SegmentData& segs, bool momDepConst, int pid) const {
   //
   const double m = mass(pid);
   const double m2 = m*m;
@@ -276,43 +290,35 @@ double TrajectoryMCSFitterICARUS::mcsLikelihood(double p, double theta0x, std::v
   //
   double const fixedterm = 0.5 * std::log( 2.0 * M_PI );
   double result = 0;
-  for (int i = beg; i != end; i+=incr ) {
-    if (dthetaij[i]<0) {
-      //cout << "skip segment with too few points" << endl;
-      continue;
-    }
+  for (unsigned int i = 0; i<segs.dtheta.size(); i++) {
     //
     if (eLossMode_==1) {
       // ELoss mode: MIP (constant)
       constexpr double kcal = 0.002105;
-      const double Eij = Etot - kcal*cumLen[i];//energy at this segment
+      const double Eij = Etot - kcal*segs.cumLen[i];//energy at this segment
       Eij2 = Eij*Eij;
     } else {
       // Non constant energy loss distribution
-      const double Eij = GetE(Etot,cumLen[i],m);
+      const double Eij = GetE(Etot,segs.cumLen[i],m);
       Eij2 = Eij*Eij;
     }
     //
     if ( Eij2 <= m2 ) {
-      result = std::numeric_limits<double>::max();
-      
-      break;
+      return std::numeric_limits<double>::max();
     }
     const double pij = sqrt(Eij2 - m2);//momentum at this segment
     const double beta = sqrt( 1. - ((m2)/(pij*pij + m2)) );
     constexpr double tuned_HL_term1 = 11.0038; // https://arxiv.org/abs/1703.06187
-    constexpr double HL_term2 = 0.038;
-    const double tH0 = ( (momDepConst ? MomentumDependentConstant(pij) : tuned_HL_term1) / (pij*beta) ) * ( 1.0 + HL_term2 * std::log( seg_nradl[i] ) ) * sqrt( seg_nradl[i] );
+    const double tH0 = ( (momDepConst ? MomentumDependentConstant(pij) : tuned_HL_term1) / (pij*beta) ) * segs.radlFactor[i];
     const double rms = sqrt( 2.0*( tH0 * tH0 + theta0x * theta0x ) );
     if (rms==0.0) {
       //std::cout << " Error : RMS cannot be zero ! " << std::endl;
       return std::numeric_limits<double>::max();
-    } 
-    const double arg = dthetaij[i]/rms;
+    }
+    const double arg = segs.dtheta[i]/rms;
     result += ( std::log( rms ) + 0.5 * arg * arg + fixedterm);
-//    if (print && fwd==true) cout << "TrajectoryMCSFitterICARUS pij=" << pij << " dthetaij[i]=" << dthetaij[i] << " tH0=" << tH0 << " rms=" << rms << " prob=" << ( std::log( rms ) + 0.5 * arg * arg + fixedterm) << " const=" << (momDepConst ? MomentumDependentConstant(pij) : tuned_HL_term1) << " beta=" << beta << " red_length=" << seg_nradl[i] <<  " result " << result << endl;
   }
-  //std::cout << " momentum " << p <<" likelihood " << result << std::endl; 
+  //std::cout << " momentum " << p <<" likelihood " << result << std::endl;
   return result;
 }
 
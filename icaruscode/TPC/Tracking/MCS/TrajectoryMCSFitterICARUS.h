@@ -122,7 +122,17 @@ namespace trkf {
     void breakTrajInSegments(const recob::TrackTrajectory& traj, std::vector<size_t>& breakpoints, std::vector<float>& segradlengths, std::vector<float>& cumseglens) const;
     void findSegmentBarycenter(const recob::TrackTrajectory& traj, const size_t firstPoint, const size_t lastPoint, recob::tracking::Vector_t& pcdir) const;
     void linearRegression(const recob::TrackTrajectory& traj, const size_t firstPoint, const size_t lastPoint, recob::tracking::Vector_t& pcdir) const;
-    double mcsLikelihood(double p, double theta0x, std::vector<float>& dthetaij, std::vector<float>& seg_nradl, std::vector<float>& cumLen, bool fwd, bool momDepConst, int pid) const;
+    //
+    // Momentum-independent quantities of the valid segments, packed into
+    // contiguous arrays once per scan so that each momentum hypothesis is
+    // evaluated as a simple arithmetic pass over them.
+    struct SegmentData {
+      std::vector<double> dtheta;     //scattering angle [mrad]
+      std::vector<double> radlFactor; //(1 + 0.038*log(l/X0))*sqrt(l/X0)
+      std::vector<double> cumLen;     //cumulative length upstream of segment
+    };
+    SegmentData prepareSegmentData(const std::vector<float>& dthetaij, const std::vector<float>& seg_nradl, const std::vector<float>& cumLen) const;
+    double mcsLikelihood(double p, double theta0x, const SegmentData& segs, bool momDepConst, int pid) const;
 double GetOptimalSegLen(const double guess_p, const int n_points, const int plane, const double length_travelled) const;
 double computeResidual(int i, double& alfa) const;
 void ComputeD3P()   ;
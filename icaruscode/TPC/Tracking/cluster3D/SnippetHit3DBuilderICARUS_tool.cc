@@ -32,12 +32,18 @@
 #include "larevt/CalibrationDBI/Interface/ChannelStatusProvider.h"
 #include "larreco/RecoAlg/Cluster3DAlgs/IHit3DBuilder.h"
 
+// TBB
+#include "tbb/parallel_for.h"
+
 // Eigen
 #include <Eigen/Core>
 
 // std includes
+#include <algorithm> // std::sort
+#include <cstdint>   // std::uint64_t
 #include <string>
 #include <iostream>
+#include <limits>
 #include <memory>
 #include <numeric> // std::accumulate
 
@@ -75,6 +81,10 @@ using HitVectorMap                 = std::map<size_t, HitVector>;
 using SnippetHitMapItrPair         = std::pair<SnippetHitMap::iterator,SnippetHitMap::iterator>;
 using PlaneSnippetHitMapItrPairVec = std::vector<SnippetHitMapItrPair>;
 
+// forward declarations of the pairing loop helpers defined below
+class SnippetIntervalIndex;
+class SnippetHitArrays;
+
 /**
  *  @brief  SnippetHit3DBuilderICARUS class definiton
  */
@@ -123,20 +133,32 @@ private:
      */
     void BuildHit3D(reco::HitPairList& hitPairList) const;
 
+    /**
+     *  @brief Reorder the 3D hits along a Morton curve over detector coordinates
+     *         so downstream consumers walk spatially coherent memory
+     */
+    void SpatialOrderHitPairs(reco::HitPairList& hitPairList) const;
+
+    /**
+     *  @brief Flat list of (channel, art Ptr) pairs for the new hits, accumulated while the
+     *         hits are created so the associations can be assembled in single bulk passes
+     */
+    using ChannelHitPtrPairVec = std::vector<std::pair<raw::ChannelID_t, art::Ptr<recob::Hit>>>;
+
     /**
      *  @brief Create a new 2D hit collection from hits associated to 3D space points
      */
-    void CreateNewRecobHitCollection(art::Event&, reco::HitPairList&, std::vector<recob::Hit>&, RecobHitToPtrMap&);
+    void CreateNewRecobHitCollection(art::Event&, reco::HitPairList&, std::vector<recob::Hit>&, RecobHitToPtrMap&, ChannelHitPtrPairVec&);
 
     /**
      *  @brief Create recob::Wire to recob::Hit associations
      */
-    void makeWireAssns(const art::Event&, art::Assns<recob::Wire, recob::Hit>&, RecobHitToPtrMap&) const;
+    void makeWireAssns(const art::Event&, art::Assns<recob::Wire, recob::Hit>&, const ChannelHitPtrPairVec&) const;
 
     /**
      *  @brief Create raw::RawDigit to recob::Hit associations
      */
-    void makeRawDigitAssns(const art::Event&, art::Assns<raw::RawDigit, recob::Hit>&, RecobHitToPtrMap&) const;
+    void makeRawDigitAssns(const art::Event&, art::Assns<raw::RawDigit, recob::Hit>&, const ChannelHitPtrPairVec&) const;
 
     /**
      *  @brief Given the ClusterHit2D objects, build the HitPairMap
@@ -155,7 +177,12 @@ private:
     using HitMatchTripletVec    = std::vector<HitMatchTriplet>;
     using HitMatchTripletVecMap = std::map<geo::WireID,HitMatchTripletVec>;
 
-    int findGoodHitPairs(SnippetHitMap::iterator&, SnippetHitMap::iterator&, SnippetHitMap::iterator&, HitMatchTripletVecMap&) const;
+    int findGoodHitPairs(const SnippetHitArrays& firstHitArrays,
+                         size_t                  firstSnippet,
+                         const SnippetHitArrays& secondHitArrays,
+                         size_t                  secondStart,
+                         size_t                  secondEnd,
+                         HitMatchTripletVecMap&  hitMatchMap) const;
 
     /**
      *  @brief This algorithm takes lists of hit pairs and finds good triplets
@@ -259,6 +286,8 @@ private:
     bool                                    m_saveMythicalPoints;    ///< Should we save valid 2 hit space points? 
     float                                   m_maxMythicalChiSquare;  ///< Selection cut on mythical points
     bool                                    m_useT0Offsets;          ///< If true then we will use the LArSoft interplane offsets
+    bool                                    m_parallelTPCs;          ///< If true the drift volumes are paired in concurrent tasks
+    bool                                    m_spatialOrdering;       ///< If true the 3D hits are reordered along a Morton curve
     bool                                    m_outputHistograms;      ///< Take the time to create and fill some histograms for diagnostics
    
     bool                                    m_enableMonitoring;      ///<
@@ -351,6 +380,8 @@ void SnippetHit3DBuilderICARUS::configure(fhicl::ParameterSet const &pset)
     m_saveMythicalPoints   = pset.get<bool                      >("SaveMythicalPoints",     true);
     m_maxMythicalChiSquare = pset.get<float                     >("MaxMythicalChiSquare",    10.);
     m_useT0Offsets         = pset.get<bool                      >("UseT0Offsets",           true);
+    m_parallelTPCs         = pset.get<bool                      >("ParallelTPCs",          false);
+    m_spatialOrdering      = pset.get<bool                      >("SpatialOrdering",        true);
     m_outputHistograms     = pset.get<bool                      >("OutputHistograms",      false);
 
     m_geometry = art::ServiceHandle<geo::Geometry const>{}.get();
@@ -517,6 +548,9 @@ void SnippetHit3DBuilderICARUS::Hit3DBuilder(art::Event& evt, reco::HitPairList&
     // Get a hit refiner
     std::unique_ptr<std::vector<recob::Hit>> outputHitPtrVec(new std::vector<recob::Hit>);
 
+    // Flat channel/Ptr pairs for the new hits, filled as the hits are created
+    ChannelHitPtrPairVec channelHitPtrPairVec;
+
     // Recover the 2D hits and then organize them into data structures which will be used in the
     // DBscan algorithm for building the 3D clusters
     this->CollectArtHits(evt);
@@ -527,21 +561,25 @@ void SnippetHit3DBuilderICARUS::Hit3DBuilder(art::Event& evt, reco::HitPairList&
         // Call the algorithm that builds 3D hits
         this->BuildHit3D(hitPairList);
 
+        // Reorder the 3D hits along a space filling curve so the clustering
+        // and analysis stages downstream walk spatially coherent memory
+        if (m_spatialOrdering) this->SpatialOrderHitPairs(hitPairList);
+
         // If we built 3D points then attempt to output a new hit list as well
         if (!hitPairList.empty())
-            CreateNewRecobHitCollection(evt, hitPairList, *outputHitPtrVec, clusterHitToArtPtrMap);
+            CreateNewRecobHitCollection(evt, hitPairList, *outputHitPtrVec, clusterHitToArtPtrMap, channelHitPtrPairVec);
     }
 
     // Set up to make the associations (if desired)
     /// Associations with wires.
     std::unique_ptr<art::Assns<recob::Wire, recob::Hit>> wireAssns(new art::Assns<recob::Wire, recob::Hit>);
 
-    makeWireAssns(evt, *wireAssns, clusterHitToArtPtrMap);
+    makeWireAssns(evt, *wireAssns, channelHitPtrPairVec);
 
     /// Associations with raw digits.
     std::unique_ptr<art::Assns<raw::RawDigit, recob::Hit>> rawDigitAssns(new art::Assns<raw::RawDigit, recob::Hit>);
 
-    makeRawDigitAssns(evt, *rawDigitAssns, clusterHitToArtPtrMap);
+    makeRawDigitAssns(evt, *rawDigitAssns, channelHitPtrPairVec);
 
     // Move everything into the event
     evt.put(std::move(outputHitPtrVec));
@@ -612,6 +650,244 @@ bool SetPairStartTimeOrder(const reco::ClusterHit3D& left, const reco::ClusterHi
     return left.getAvePeakTime() - left.getSigmaPeakTime() < right.getAvePeakTime() - right.getSigmaPeakTime();
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+/**
+ *  @brief A flat interval index over the snippets of one plane
+ *
+ *         The snippets are kept in start time order (the map order) with the start times mirrored into a contiguous
+ *         array and the end times into a heap-layout tree of range maxima. The two searches done per iteration of the
+ *         pairing loop - "first unconsumed snippet whose end reaches the window start" and "first snippet starting past
+ *         the window end" - then run in O(log n) each instead of walking the map linearly, while the candidates in
+ *         between are enumerated exactly as before.
+ */
+class SnippetIntervalIndex
+{
+public:
+    SnippetIntervalIndex(SnippetHitMap::iterator begin, SnippetHitMap::iterator end) : fEndItr(end)
+    {
+        for(SnippetHitMap::iterator itr = begin; itr != end; itr++)
+        {
+            fStartVec.push_back(itr->first.first);
+            fItrVec.push_back(itr);
+        }
+
+        // Keep the end iterator reachable so search results translate directly
+        fItrVec.push_back(end);
+
+        fNumSnippets = fStartVec.size();
+
+        // The max-end tree is sized to the next power of two so the leaves line up
+        fTreeSize = 1;
+
+        while(fTreeSize < std::max(fNumSnippets,size_t(1))) fTreeSize *= 2;
+
+        fMaxEndTree.assign(2 * fTreeSize, std::numeric_limits<raw::TDCtick_t>::min());
+
+        for(size_t idx = 0; idx < fNumSnippets; idx++) fMaxEndTree[fTreeSize + idx] = fItrVec[idx]->first.second;
+
+        for(size_t idx = fTreeSize - 1; idx > 0; idx--) fMaxEndTree[idx] = std::max(fMaxEndTree[2*idx],fMaxEndTree[2*idx+1]);
+    }
+
+    // Find the first snippet at or after fromPos whose end time reaches startTime
+    size_t findStartPos(size_t fromPos, raw::TDCtick_t startTime) const
+    {
+        if (fromPos >= fNumSnippets) return fNumSnippets;
+
+        size_t node = fTreeSize + fromPos;
+
+        while(true)
+        {
+            if (fMaxEndTree[node] >= startTime)
+            {
+                // Descend to the leftmost leaf in this subtree reaching startTime
+                while(node < fTreeSize)
+                {
+                    node = 2 * node;
+
+                    if (fMaxEndTree[node] < startTime) node++;
+                }
+
+                return std::min(node - fTreeSize, fNumSnippets);
+            }
+
+            // This subtree can't reach startTime so step to the next one on the right
+            while(node & 1)
+            {
+                node >>= 1;
+
+                if (node <= 1) return fNumSnippets;
+            }
+
+            node++;
+        }
+    }
+
+    // Find the first snippet at or after fromPos starting at or past endTime
+    size_t findEndPos(size_t fromPos, raw::TDCtick_t endTime) const
+    {
+        return std::lower_bound(fStartVec.begin() + std::min(fromPos,fNumSnippets), fStartVec.end(), endTime) - fStartVec.begin();
+    }
+
+    SnippetHitMap::iterator getIterator(size_t pos)   const {return fItrVec[std::min(pos,fNumSnippets)];}
+    SnippetHitMap::iterator getEndIterator()          const {return fEndItr;}
+
+private:
+    std::vector<raw::TDCtick_t>          fStartVec;     ///< snippet start times in map order
+    std::vector<raw::TDCtick_t>          fMaxEndTree;   ///< range maxima of the snippet end times
+    std::vector<SnippetHitMap::iterator> fItrVec;       ///< map iterator for each snippet (plus end)
+    SnippetHitMap::iterator              fEndItr;       ///< identifies the plane this index belongs to
+    size_t                               fNumSnippets;
+    size_t                               fTreeSize;
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+/**
+ *  @brief Structure-of-arrays staging of the snippet hits of one plane
+ *
+ *         The pairing predicates only need the peak time, the (long-hit stretched) sigma and the outcome of the pulse
+ *         height selection for each hit, so those are packed into contiguous arrays in snippet order when the TPC is
+ *         staged. The inner pairing loops then run over the arrays and the full ClusterHit2D objects are only
+ *         dereferenced for candidates surviving the coarse time window check.
+ */
+class SnippetHitArrays
+{
+public:
+    SnippetHitArrays(SnippetHitMap::iterator begin,
+                     SnippetHitMap::iterator end,
+                     float                   pulseHeightFrac,
+                     float                   PHLowSelection,
+                     float                   longHitStretchFctr)
+    {
+        fSnippetOffsetVec.push_back(0);
+
+        for(SnippetHitMap::iterator itr = begin; itr != end; itr++)
+        {
+            // The pulse height selection is relative to the largest hit on the snippet
+            float maxPulseHeight(0.);
+
+            for(const auto& hit : itr->second) maxPulseHeight = std::max(maxPulseHeight,hit->getHit()->PeakAmplitude());
+
+            float pulseHeightCut = pulseHeightFrac * maxPulseHeight;
+
+            for(const auto& hit : itr->second)
+            {
+                const recob::Hit* recobHit = hit->getHit();
+
+                float sigma = recobHit->RMS();
+
+                // "Long hits" are an issue... so we deal with these differently
+                if (recobHit->DegreesOfFreedom() < 2) sigma *= longHitStretchFctr;
+
+                fPeakTimeVec.push_back(hit->getTimeTicks());
+                fSigmaVec.push_back(sigma);
+                fSelectVec.push_back(!(recobHit->DegreesOfFreedom() > 1 && recobHit->PeakAmplitude() < pulseHeightCut && recobHit->PeakAmplitude() < PHLowSelection));
+                fHitVec.push_back(hit);
+            }
+
+            fSnippetOffsetVec.push_back(fHitVec.size());
+        }
+    }
+
+    size_t                    getHitBegin(size_t snippet) const {return fSnippetOffsetVec[snippet];}
+    size_t                    getHitEnd(size_t snippet)   const {return fSnippetOffsetVec[snippet+1];}
+    float                     getPeakTime(size_t hitIdx)  const {return fPeakTimeVec[hitIdx];}
+    float                     getSigma(size_t hitIdx)     const {return fSigmaVec[hitIdx];}
+    bool                      isSelected(size_t hitIdx)   const {return fSelectVec[hitIdx];}
+    const reco::ClusterHit2D* getHit(size_t hitIdx)       const {return fHitVec[hitIdx];}
+
+private:
+    std::vector<size_t>                    fSnippetOffsetVec; ///< first hit of each snippet (plus total)
+    std::vector<float>                     fPeakTimeVec;      ///< hit peak times in ticks
+    std::vector<float>                     fSigmaVec;         ///< hit sigmas with the long hit stretch applied
+    std::vector<char>                      fSelectVec;        ///< outcome of the pulse height selection
+    std::vector<const reco::ClusterHit2D*> fHitVec;           ///< the full hits, touched only on success
+};
+
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+namespace {
+// Spread the low 21 bits of a coordinate word so they occupy every third bit of the output
+std::uint64_t expandBits21(std::uint64_t v)
+{
+    v &= 0x1fffffULL;
+    v = (v | v << 32) & 0x001f00000000ffffULL;
+    v = (v | v << 16) & 0x001f0000ff0000ffULL;
+    v = (v | v <<  8) & 0x100f00f00f00f00fULL;
+    v = (v | v <<  4) & 0x10c30c30c30c30c3ULL;
+    v = (v | v <<  2) & 0x1249249249249249ULL;
+    return v;
+}
+}
+
+void SnippetHit3DBuilderICARUS::SpatialOrderHitPairs(reco::HitPairList& hitPairList) const
+{
+    /**
+     *  @brief Reorder the 3D hits along a Morton curve: the position of each hit is quantized
+     *         onto a 21 bits per coordinate grid spanning the bounding box of the collection
+     *         and the bits of the three coordinates interleaved into a single code. Sorting by
+     *         the code places hits which are close in space close in the list, so the DBSCAN
+     *         style neighborhood walks downstream touch nearby memory instead of jumping
+     *         through the production (plane/time) order.
+     */
+    if (hitPairList.size() < 2) return;
+
+    // Recover the bounding box of the collection
+    Eigen::Vector3f minPos( std::numeric_limits<float>::max(), std::numeric_limits<float>::max(), std::numeric_limits<float>::max());
+    Eigen::Vector3f maxPos(-std::numeric_limits<float>::max(),-std::numeric_limits<float>::max(),-std::numeric_limits<float>::max());
+
+    for(const auto& hitPair : hitPairList)
+    {
+        minPos = minPos.cwiseMin(hitPair.getPosition());
+        maxPos = maxPos.cwiseMax(hitPair.getPosition());
+    }
+
+    // Scale factors mapping each coordinate onto the full 21 bit range
+    constexpr float maxCoord(2097151.);  // 2^21 - 1
+
+    Eigen::Vector3f scaleVec;
+
+    for(int coordIdx = 0; coordIdx < 3; coordIdx++)
+    {
+        float range = maxPos[coordIdx] - minPos[coordIdx];
+
+        scaleVec[coordIdx] = range > 0. ? maxCoord / range : 0.;
+    }
+
+    // Decorate each 3D hit with its Morton code...
+    using CodeHitPair    = std::pair<std::uint64_t, reco::ClusterHit3D>;
+    using CodeHitPairVec = std::vector<CodeHitPair>;
+
+    CodeHitPairVec codeHitPairVec;
+
+    codeHitPairVec.reserve(hitPairList.size());
+
+    for(auto& hitPair : hitPairList)
+    {
+        const Eigen::Vector3f& position = hitPair.getPosition();
+
+        std::uint64_t mortonCode(0);
+
+        for(int coordIdx = 0; coordIdx < 3; coordIdx++)
+        {
+            float scaled = std::min((position[coordIdx] - minPos[coordIdx]) * scaleVec[coordIdx], maxCoord);
+
+            mortonCode |= expandBits21(std::uint64_t(scaled)) << coordIdx;
+        }
+
+        codeHitPairVec.emplace_back(mortonCode, std::move(hitPair));
+    }
+
+    // ... then sort by code. The sort is stable so hits sharing a grid cell keep their relative (time) order
+    std::stable_sort(codeHitPairVec.begin(),codeHitPairVec.end(),[](const auto& left, const auto& right){return left.first < right.first;});
+
+    // Rebuild the list in the new order
+    hitPairList.clear();
+
+    for(auto& codeHitPair : codeHitPairVec) hitPairList.emplace_back(std::move(codeHitPair.second));
+
+    return;
+}
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
@@ -632,7 +908,11 @@ size_t SnippetHit3DBuilderICARUS::BuildHitPairMap(PlaneToSnippetHitMap& planeToS
     size_t nTriplets(0);
     size_t nDeadChanHits(0);
 
-    // Set up to loop over cryostats and tpcs...
+    // Set up to loop over cryostats and tpcs... each drift volume is fully
+    // independent so we collect the per TPC work first and can then run the
+    // pairing either serially or as concurrent tasks
+    std::vector<PlaneSnippetHitMapItrPairVec> tpcTaskVec;
+
     for(size_t cryoIdx = 0; cryoIdx < m_geometry->Ncryostats(); cryoIdx++)
     {
         for(size_t tpcIdx = 0; tpcIdx < m_geometry->NTPC(); tpcIdx++)
@@ -655,13 +935,37 @@ size_t SnippetHit3DBuilderICARUS::BuildHitPairMap(PlaneToSnippetHitMap& planeToS
             SnippetHitMap& snippetHitMap1 = mapItr1->second;
             SnippetHitMap& snippetHitMap2 = mapItr2->second;
 
-            PlaneSnippetHitMapItrPairVec hitItrVec = {SnippetHitMapItrPair(snippetHitMap0.begin(),snippetHitMap0.end()),
-                                                      SnippetHitMapItrPair(snippetHitMap1.begin(),snippetHitMap1.end()),
-                                                      SnippetHitMapItrPair(snippetHitMap2.begin(),snippetHitMap2.end())};
+            tpcTaskVec.push_back({SnippetHitMapItrPair(snippetHitMap0.begin(),snippetHitMap0.end()),
+                                  SnippetHitMapItrPair(snippetHitMap1.begin(),snippetHitMap1.end()),
+                                  SnippetHitMapItrPair(snippetHitMap2.begin(),snippetHitMap2.end())});
+        }
+    }
+
+    // Note the diagnostic ntuple vectors are filled in the pairing code so we
+    // have to stay serial when histogramming is turned on
+    if (m_parallelTPCs && !m_outputHistograms && tpcTaskVec.size() > 1)
+    {
+        // Pair each drift volume in its own task, each filling its own hit
+        // pair list segment which gets spliced back in TPC order at the end
+        std::vector<reco::HitPairList> hitPairListVec(tpcTaskVec.size());
+        std::vector<size_t>            numHitsVec(tpcTaskVec.size(), 0);
+
+        tbb::parallel_for(std::size_t{0}, tpcTaskVec.size(),
+            [&, this](size_t taskIdx)
+            {
+                numHitsVec[taskIdx] = BuildHitPairMapByTPC(tpcTaskVec[taskIdx], hitPairListVec[taskIdx]);
+            });
 
-            totalNumHits += BuildHitPairMapByTPC(hitItrVec, hitPairList);
+        for(size_t taskIdx = 0; taskIdx < tpcTaskVec.size(); taskIdx++)
+        {
+            totalNumHits += numHitsVec[taskIdx];
+            hitPairList.splice(hitPairList.end(), hitPairListVec[taskIdx]);
         }
     }
+    else
+    {
+        for(auto& hitItrVec : tpcTaskVec) totalNumHits += BuildHitPairMapByTPC(hitItrVec, hitPairList);
+    }
 
     // Return the hit pair list but sorted by z and y positions (faster traversal in next steps)
     hitPairList.sort(SetPairStartTimeOrder);
@@ -686,25 +990,28 @@ size_t SnippetHit3DBuilderICARUS::BuildHitPairMapByTPC(PlaneSnippetHitMapItrPair
      *         will evaluate the situation and in some instances keep the U-W pairs in order to keep efficiency high.
      */
 
-    // Define functions to set start/end iterators in the loop below
-    auto SetStartIterator = [](SnippetHitMap::iterator startItr, SnippetHitMap::iterator endItr, float startTime)
+    // Build the flat interval indices over the snippets of each plane; the binary searches over
+    // these below replace what used to be linear walks over the maps. We keep track of how many
+    // snippets have been consumed from each plane so the searches start from the right place
+    std::vector<SnippetIntervalIndex> intervalIndexVec;
+    std::vector<SnippetHitArrays>     hitArraysVec;
+    std::vector<size_t>               consumedVec(snippetHitMapItrVec.size(), 0);
+
+    for(const auto& itrPair : snippetHitMapItrVec)
     {
-        while(startItr != endItr)
-        {
-            if (startItr->first.second < startTime) startItr++;
-            else break;
-        }
-        return startItr;
-    };
+        intervalIndexVec.emplace_back(itrPair.first, itrPair.second);
+        hitArraysVec.emplace_back(itrPair.first, itrPair.second, m_pulseHeightFrac, m_PHLowSelection, m_LongHitStretchFctr);
+    }
 
-    auto SetEndIterator = [](SnippetHitMap::iterator lastItr, SnippetHitMap::iterator endItr, float endTime)
+    // The itr pair vector gets reordered every iteration so recover the matching index by the
+    // (stable) end iterator of the plane
+    auto IndexForItrPair = [&intervalIndexVec](const SnippetHitMapItrPair& itrPair)
     {
-        while(lastItr != endItr)
-        {
-            if (lastItr->first.first < endTime) lastItr++;
-            else break;
-        }
-        return lastItr;
+        size_t idx(0);
+
+        while(idx < intervalIndexVec.size() && intervalIndexVec[idx].getEndIterator() != itrPair.second) idx++;
+
+        return idx;
     };
 
     size_t nTriplets(0);
@@ -732,19 +1039,27 @@ size_t SnippetHit3DBuilderICARUS::BuildHitPairMapByTPC(PlaneSnippetHitMapItrPair
         // This loop iteration's snippet iterator
         SnippetHitMap::iterator firstSnippetItr = snippetHitMapItrVec.front().first;
 
-        // Set iterators to insure we'll be in the overlap ranges
-        SnippetHitMap::iterator snippetHitMapItr1Start = SetStartIterator(snippetHitMapItrVec[1].first, snippetHitMapItrVec[1].second, firstSnippetItr->first.first);
-        SnippetHitMap::iterator snippetHitMapItr1End   = SetEndIterator( snippetHitMapItr1Start,        snippetHitMapItrVec[1].second, firstSnippetItr->first.second);
-        SnippetHitMap::iterator snippetHitMapItr2Start = SetStartIterator(snippetHitMapItrVec[2].first, snippetHitMapItrVec[2].second, firstSnippetItr->first.first);
-        SnippetHitMap::iterator snippetHitMapItr2End   = SetEndIterator( snippetHitMapItr2Start,        snippetHitMapItrVec[2].second, firstSnippetItr->first.second);
+        // Recover which index/hit array slot each plane currently occupies
+        size_t frontSlot = IndexForItrPair(snippetHitMapItrVec.front());
+        size_t slot1     = IndexForItrPair(snippetHitMapItrVec[1]);
+        size_t slot2     = IndexForItrPair(snippetHitMapItrVec[2]);
+
+        // Set positions to insure we'll be in the overlap ranges - binary searched via the interval indices
+        const SnippetIntervalIndex& intervalIndex1 = intervalIndexVec[slot1];
+        const SnippetIntervalIndex& intervalIndex2 = intervalIndexVec[slot2];
+
+        size_t startPos1 = intervalIndex1.findStartPos(consumedVec[slot1], firstSnippetItr->first.first);
+        size_t endPos1   = intervalIndex1.findEndPos(startPos1, firstSnippetItr->first.second);
+        size_t startPos2 = intervalIndex2.findStartPos(consumedVec[slot2], firstSnippetItr->first.first);
+        size_t endPos2   = intervalIndex2.findEndPos(startPos2, firstSnippetItr->first.second);
 
         // Since we'll use these many times in the internal loops, pre make the pairs for the second set of hits
         size_t                curHitListSize(hitPairList.size());
         HitMatchTripletVecMap pair12Map;
         HitMatchTripletVecMap pair13Map;
 
-        size_t n12Pairs = findGoodHitPairs(firstSnippetItr, snippetHitMapItr1Start, snippetHitMapItr1End, pair12Map);
-        size_t n13Pairs = findGoodHitPairs(firstSnippetItr, snippetHitMapItr2Start, snippetHitMapItr2End, pair13Map);
+        size_t n12Pairs = findGoodHitPairs(hitArraysVec[frontSlot], consumedVec[frontSlot], hitArraysVec[slot1], startPos1, endPos1, pair12Map);
+        size_t n13Pairs = findGoodHitPairs(hitArraysVec[frontSlot], consumedVec[frontSlot], hitArraysVec[slot2], startPos2, endPos2, pair13Map);
 
         nDeadChanHits  += hitPairList.size() - curHitListSize;
         curHitListSize  = hitPairList.size();
@@ -760,6 +1075,8 @@ size_t SnippetHit3DBuilderICARUS::BuildHitPairMapByTPC(PlaneSnippetHitMapItrPair
 
         nTriplets += hitPairList.size() - curHitListSize;
 
+        consumedVec[frontSlot]++;
+
         snippetHitMapItrVec.front().first++;
     }
 
@@ -768,54 +1085,50 @@ size_t SnippetHit3DBuilderICARUS::BuildHitPairMapByTPC(PlaneSnippetHitMapItrPair
     return hitPairList.size();
 }
 
-int SnippetHit3DBuilderICARUS::findGoodHitPairs(SnippetHitMap::iterator& firstSnippetItr,
-                                          SnippetHitMap::iterator& startItr,
-                                          SnippetHitMap::iterator& endItr,
-                                          HitMatchTripletVecMap&   hitMatchMap) const
+int SnippetHit3DBuilderICARUS::findGoodHitPairs(const SnippetHitArrays& firstHitArrays,
+                                          size_t                  firstSnippet,
+                                          const SnippetHitArrays& secondHitArrays,
+                                          size_t                  secondStart,
+                                          size_t                  secondEnd,
+                                          HitMatchTripletVecMap&  hitMatchMap) const
 {
     int numPairs(0);
 
-    HitVector::iterator firstMaxItr = std::max_element(firstSnippetItr->second.begin(),firstSnippetItr->second.end(),[](const auto& left, const auto& right){return left->getHit()->PeakAmplitude() < right->getHit()->PeakAmplitude();});
-    float               firstPHCut  = firstMaxItr != firstSnippetItr->second.end() ? m_pulseHeightFrac * (*firstMaxItr)->getHit()->PeakAmplitude() : 4096.;
-
     // Loop through the hits on the first snippet
-    for(const auto& hit1 : firstSnippetItr->second)
+    for(size_t hit1Idx = firstHitArrays.getHitBegin(firstSnippet); hit1Idx < firstHitArrays.getHitEnd(firstSnippet); hit1Idx++)
     {
         // Let's focus on the largest hit in the chain
-        if (hit1->getHit()->DegreesOfFreedom() > 1 && hit1->getHit()->PeakAmplitude() < firstPHCut && hit1->getHit()->PeakAmplitude() < m_PHLowSelection) continue;
+        if (!firstHitArrays.isSelected(hit1Idx)) continue;
 
-        // Inside loop iterator
-        SnippetHitMap::iterator secondHitItr = startItr;
+        float hit1Peak  = firstHitArrays.getPeakTime(hit1Idx);
+        float hit1Width = m_hitWidthSclFctr * firstHitArrays.getSigma(hit1Idx);
 
-        // Loop through the input secon hits and make pairs
-        while(secondHitItr != endItr)
+        // Loop through the input second hits and make pairs
+        for(size_t secondSnippet = secondStart; secondSnippet < secondEnd; secondSnippet++)
         {
-            HitVector::iterator secondMaxItr = std::max_element(secondHitItr->second.begin(),secondHitItr->second.end(),[](const auto& left, const auto& right){return left->getHit()->PeakAmplitude() < right->getHit()->PeakAmplitude();});
-            float               secondPHCut  = secondMaxItr != secondHitItr->second.end() ? m_pulseHeightFrac * (*secondMaxItr)->getHit()->PeakAmplitude() : 0.;
-
-            for(const auto& hit2 : secondHitItr->second)
+            for(size_t hit2Idx = secondHitArrays.getHitBegin(secondSnippet); hit2Idx < secondHitArrays.getHitEnd(secondSnippet); hit2Idx++)
             {
                 // Again, focus on the large hits
-                if (hit2->getHit()->DegreesOfFreedom() > 1 && hit2->getHit()->PeakAmplitude() < secondPHCut && hit2->getHit()->PeakAmplitude() < m_PHLowSelection) continue;
+                if (!secondHitArrays.isSelected(hit2Idx)) continue;
+
+                // Coarse check the hit times are "in range" straight off the arrays; this is the same
+                // window makeHitPair starts with so only the survivors touch the full hit objects
+                if (std::fabs(hit1Peak - secondHitArrays.getPeakTime(hit2Idx)) > hit1Width + m_hitWidthSclFctr * secondHitArrays.getSigma(hit2Idx)) continue;
+
+                const reco::ClusterHit2D* hit1 = firstHitArrays.getHit(hit1Idx);
+                const reco::ClusterHit2D* hit2 = secondHitArrays.getHit(hit2Idx);
 
                 reco::ClusterHit3D  pair;
 
                 // pair returned with a negative ave time is signal of failure
                 if (!makeHitPair(pair, hit1, hit2, m_hitWidthSclFctr)) continue;
 
-                std::vector<const recob::Hit*> recobHitVec = {nullptr,nullptr,nullptr};
-
-                recobHitVec[hit1->WireID().Plane] = hit1->getHit();
-                recobHitVec[hit2->WireID().Plane] = hit2->getHit();
-
                 geo::WireID wireID = hit2->WireID();
 
                 hitMatchMap[wireID].emplace_back(hit1,hit2,pair);
 
                 numPairs++;
             }
-
-            secondHitItr++;
         }
     }
 
@@ -1844,7 +2157,8 @@ void SnippetHit3DBuilderICARUS::CollectArtHits(const art::Event& evt) const
 void SnippetHit3DBuilderICARUS::CreateNewRecobHitCollection(art::Event&              event,
                                                       reco::HitPairList&       hitPairList,
                                                       std::vector<recob::Hit>& hitPtrVec,
-                                                      RecobHitToPtrMap&        recobHitToPtrMap)
+                                                      RecobHitToPtrMap&        recobHitToPtrMap,
+                                                      ChannelHitPtrPairVec&    channelHitPtrPairVec)
 {
     // Set up the timing
     cet::cpu_timer theClockBuildNewHits;
@@ -1863,6 +2177,8 @@ void SnippetHit3DBuilderICARUS::CreateNewRecobHitCollection(art::Event&
     // Reserve enough memory to replace every recob::Hit we have considered (this is upper limit)
     hitPtrVec.reserve(m_clusterHit2DMasterList.size());
 
+    channelHitPtrPairVec.reserve(m_clusterHit2DMasterList.size());
+
     // Scheme is to loop through all 3D hits, then through each associated ClusterHit2D object
     for(reco::ClusterHit3D& hit3D : hitPairList)
     {
@@ -1887,7 +2203,12 @@ void SnippetHit3DBuilderICARUS::CreateNewRecobHitCollection(art::Event&
                 recob::Hit* newHit = &hitPtrVec.back();
 
                 // Create a mapping from this hit to an art Ptr representing it
-                recobHitToPtrMap[newHit] = ptrMaker(hitPtrVec.size()-1);
+                art::Ptr<recob::Hit> newHitPtr = ptrMaker(hitPtrVec.size()-1);
+
+                recobHitToPtrMap[newHit] = newHitPtr;
+
+                // Accumulate the flat channel/Ptr pair for the bulk association assembly
+                channelHitPtrPairVec.emplace_back(newHit->Channel(), newHitPtr);
 
                 // And set the pointer to this hit in the ClusterHit2D object
                 const_cast<reco::ClusterHit2D*>(hit2D)->setHit(newHit);
@@ -1895,6 +2216,11 @@ void SnippetHit3DBuilderICARUS::CreateNewRecobHitCollection(art::Event&
         }
     }
 
+    // Sorting by channel groups the pairs so the association passes can reuse a single
+    // channel lookup per run of hits (and makes the association order deterministic)
+    std::sort(channelHitPtrPairVec.begin(), channelHitPtrPairVec.end(),
+              [](const auto& left, const auto& right){return left.first < right.first;});
+
     size_t numNewHits = hitPtrVec.size();
 
     if (m_enableMonitoring)
@@ -1909,7 +2235,7 @@ void SnippetHit3DBuilderICARUS::CreateNewRecobHitCollection(art::Event&
     return;
 }
 
-void SnippetHit3DBuilderICARUS::makeWireAssns(const art::Event& evt, art::Assns<recob::Wire, recob::Hit>& wireAssns, RecobHitToPtrMap& recobHitPtrMap) const
+void SnippetHit3DBuilderICARUS::makeWireAssns(const art::Event& evt, art::Assns<recob::Wire, recob::Hit>& wireAssns, const ChannelHitPtrPairVec& channelHitPtrPairVec) const
 {
     // Let's make sure the input associations container is empty
     wireAssns = art::Assns<recob::Wire, recob::Hit>();
@@ -1936,26 +2262,34 @@ void SnippetHit3DBuilderICARUS::makeWireAssns(const art::Event& evt, art::Assns<
         }
     }
 
-    // Now fill the container
-    for(const auto& hitPtrPair : recobHitPtrMap)
+    // Now fill the container in one pass over the flat channel/Ptr pairs; the pairs are
+    // sorted by channel so the wire lookup is only repeated when the channel changes
+    raw::ChannelID_t           lastChannel(raw::InvalidChannelID);
+    const art::Ptr<recob::Wire>* lastWire(nullptr);
+
+    for(const auto& channelHitPair : channelHitPtrPairVec)
     {
-        raw::ChannelID_t channel = hitPtrPair.first->Channel();
+        if (channelHitPair.first != lastChannel)
+        {
+            std::unordered_map<raw::ChannelID_t, art::Ptr<recob::Wire>>::iterator chanWireItr = channelToWireMap.find(channelHitPair.first);
 
-        std::unordered_map<raw::ChannelID_t, art::Ptr<recob::Wire>>::iterator chanWireItr = channelToWireMap.find(channel);
+            lastChannel = channelHitPair.first;
+            lastWire    = chanWireItr != channelToWireMap.end() ? &chanWireItr->second : nullptr;
+        }
 
-        if (!(chanWireItr != channelToWireMap.end()))
+        if (!lastWire)
         {
             //mf::LogDebug("Cluster3D") << "** Did not find channel to wire match! Skipping..." << std::endl;
             continue;
         }
 
-        wireAssns.addSingle(chanWireItr->second, hitPtrPair.second);
+        wireAssns.addSingle(*lastWire, channelHitPair.second);
     }
 
     return;
 }
 
-void SnippetHit3DBuilderICARUS::makeRawDigitAssns(const art::Event& evt, art::Assns<raw::RawDigit, recob::Hit>& rawDigitAssns, RecobHitToPtrMap& recobHitPtrMap) const
+void SnippetHit3DBuilderICARUS::makeRawDigitAssns(const art::Event& evt, art::Assns<raw::RawDigit, recob::Hit>& rawDigitAssns, const ChannelHitPtrPairVec& channelHitPtrPairVec) const
 {
     // Let's make sure the input associations container is empty
     rawDigitAssns = art::Assns<raw::RawDigit, recob::Hit>();
@@ -1982,20 +2316,28 @@ void SnippetHit3DBuilderICARUS::makeRawDigitAssns(const art::Event& evt, art::As
         }
     }
 
-    // Now fill the container
-    for(const auto& hitPtrPair : recobHitPtrMap)
+    // Now fill the container in one pass over the flat channel/Ptr pairs; the pairs are
+    // sorted by channel so the raw digit lookup is only repeated when the channel changes
+    raw::ChannelID_t               lastChannel(raw::InvalidChannelID);
+    const art::Ptr<raw::RawDigit>* lastRawDigit(nullptr);
+
+    for(const auto& channelHitPair : channelHitPtrPairVec)
     {
-        raw::ChannelID_t channel = hitPtrPair.first->Channel();
+        if (channelHitPair.first != lastChannel)
+        {
+            std::unordered_map<raw::ChannelID_t, art::Ptr<raw::RawDigit>>::iterator chanRawDigitItr = channelToRawDigitMap.find(channelHitPair.first);
 
-        std::unordered_map<raw::ChannelID_t, art::Ptr<raw::RawDigit>>::iterator chanRawDigitItr = channelToRawDigitMap.find(channel);
+            lastChannel  = channelHitPair.first;
+            lastRawDigit = chanRawDigitItr != channelToRawDigitMap.end() ? &chanRawDigitItr->second : nullptr;
+        }
 
-        if (chanRawDigitItr == channelToRawDigitMap.end())
+        if (!lastRawDigit)
         {
             //mf::LogDebug("Cluster3D") << "** Did not find channel to wire match! Skipping..." << std::endl;
            continue;
         }
 
-        rawDigitAssns.addSingle(chanRawDigitItr->second, hitPtrPair.second);
+        rawDigitAssns.addSingle(*lastRawDigit, channelHitPair.second);
     }
 
     return;
@@ -0,0 +1,79 @@
+///////////////////////////////////////////////////////////////////////
+///
+/// \file   DeconBufferPool.h
+///
+/// \brief  Process-wide pool of deconvolution scratch buffers
+///
+///         Deconvolution runs per ROI and, in multi-threaded jobs with
+///         replicated modules, allocating the working vectors per call
+///         fragments the heap and puts the allocator on the hot path.
+///         This service hands out icarusutil::TimeVec buffers from
+///         thread-local free lists so the capacity acquired during the
+///         first events is reused for the rest of the job.
+///
+///         Buffers are leased through an RAII handle; on destruction the
+///         storage (and its capacity) is returned to the free list of
+///         the releasing thread. No locking is involved in the lease or
+///         the return.
+///
+/// \author T. Usher
+///
+////////////////////////////////////////////////////////////////////////
+
+#ifndef DECONBUFFERPOOL_H
+#define DECONBUFFERPOOL_H
+
+#include "art/Framework/Services/Registry/ActivityRegistry.h"
+#include "art/Framework/Services/Registry/ServiceDeclarationMacros.h"
+#include "fhiclcpp/ParameterSet.h"
+
+#include "icaruscode/TPC/Utilities/tools/SignalProcessingDefs.h"
+
+#include <vector>
+
+namespace icarusutil
+{
+
+class DeconBufferPool
+{
+public:
+    DeconBufferPool(fhicl::ParameterSet const& pset, art::ActivityRegistry& reg);
+
+    /// RAII lease on a scratch buffer: behaves as a TimeVec reference and
+    /// returns the storage to the calling thread's free list when it dies
+    class BufferLease
+    {
+    public:
+        BufferLease(DeconBufferPool& pool, size_t size) : fPool(pool), fBuffer(pool.acquire(size)) {}
+        ~BufferLease() {fPool.release(std::move(fBuffer));}
+
+        BufferLease(const BufferLease&)            = delete;
+        BufferLease& operator=(const BufferLease&) = delete;
+
+        TimeVec&       get()       {return fBuffer;}
+        const TimeVec& get() const {return fBuffer;}
+
+    private:
+        DeconBufferPool& fPool;
+        TimeVec          fBuffer;
+    };
+
+    /// Lease a zeroed buffer of the requested size
+    BufferLease lease(size_t size) {return BufferLease(*this, size);}
+
+private:
+    TimeVec acquire(size_t size);
+    void    release(TimeVec&& buffer);
+
+    // Per-thread free list. thread_local storage keeps the lease/return path
+    // lock free; the lists outlive any single event so capacity is recycled
+    static thread_local std::vector<TimeVec> fFreeList;
+
+    size_t fMaxBuffersPerThread;   ///< cap on the free list depth per thread
+};
+
+} // end icarusutil namespace
+
+DECLARE_ART_SERVICE(icarusutil::DeconBufferPool, SHARED)
+
+#endif
@@ -0,0 +1,60 @@
+///////////////////////////////////////////////////////////////////////
+///
+/// \file   DeconBufferPool_service.cc
+///
+/// \brief  Implementation of the deconvolution scratch buffer pool
+///
+/// \author T. Usher
+///
+////////////////////////////////////////////////////////////////////////
+
+#include "icaruscode/TPC/Utilities/DeconBufferPool.h"
+
+#include "art/Framework/Services/Registry/ServiceDefinitionMacros.h"
+
+#include <algorithm>
+
+namespace icarusutil
+{
+
+thread_local std::vector<TimeVec> DeconBufferPool::fFreeList;
+
+//----------------------------------------------------------------------------
+DeconBufferPool::DeconBufferPool(fhicl::ParameterSet const& pset, art::ActivityRegistry&)
+{
+    fMaxBuffersPerThread = pset.get<size_t>("MaxBuffersPerThread", 8);
+}
+
+//----------------------------------------------------------------------------
+TimeVec DeconBufferPool::acquire(size_t size)
+{
+    if (!fFreeList.empty())
+    {
+        // Prefer the buffer whose capacity is already large enough; the free
+        // list is shallow so a linear scan is fine
+        std::vector<TimeVec>::iterator bufItr =
+            std::find_if(fFreeList.begin(),fFreeList.end(),[size](const TimeVec& buf){return buf.capacity() >= size;});
+
+        if (bufItr == fFreeList.end()) bufItr = fFreeList.end() - 1;
+
+        TimeVec buffer = std::move(*bufItr);
+
+        fFreeList.erase(bufItr);
+
+        buffer.assign(size, 0.);
+
+        return buffer;
+    }
+
+    return TimeVec(size, 0.);
+}
+
+//----------------------------------------------------------------------------
+void DeconBufferPool::release(TimeVec&& buffer)
+{
+    if (fFreeList.size() < fMaxBuffersPerThread) fFreeList.emplace_back(std::move(buffer));
+}
+
+} // end icarusutil namespace
+
+DEFINE_ART_SERVICE(icarusutil::DeconBufferPool)
@@ -41,10 +41,14 @@ tbb::spin_mutex signalShapingSpinMutex;
 //----------------------------------------------------------------------
 // Constructor.
 SignalShapingICARUSService::SignalShapingICARUSService(const fhicl::ParameterSet& pset,
-                                                             art::ActivityRegistry& /* reg */)
+                                                             art::ActivityRegistry& reg)
 : fInit(false)
 {
     reconfigure(pset);
+
+    // Freeze the response table once the job is set up so the per event
+    // accessors never need the initialization lock
+    reg.sPostBeginJob.watch(this, &SignalShapingICARUSService::freezeResponseTable);
 }
 
 //----------------------------------------------------------------------
@@ -66,16 +70,41 @@ void SignalShapingICARUSService::reconfigure(const fhicl::ParameterSet& pset)
         
         fPlaneToResponseMap[planeIdx].push_back(art::make_tool<icarus_tool::IResponse>(responseToolParamSet));
     }
-    
+
+    // Alternate response variants, each block configured like ResponseTools.
+    // All of them are instantiated here and stay resident for the whole job
+    fVariantResponseMaps.clear();
+
+    const fhicl::ParameterSet& responseVariants = pset.get<fhicl::ParameterSet>("ResponseVariants", fhicl::ParameterSet());
+
+    for(const std::string& variantName : responseVariants.get_pset_names())
+    {
+        const fhicl::ParameterSet& variantTools        = responseVariants.get<fhicl::ParameterSet>(variantName);
+        PlaneToResponseMap&        planeToResponseMap  = fVariantResponseMaps[variantName];
+
+        for(const std::string& responseTool : variantTools.get_pset_names())
+        {
+            const fhicl::ParameterSet& responseToolParamSet = variantTools.get<fhicl::ParameterSet>(responseTool);
+            size_t                     planeIdx             = responseToolParamSet.get<size_t>("Plane");
+
+            planeToResponseMap[planeIdx].push_back(art::make_tool<icarus_tool::IResponse>(responseToolParamSet));
+        }
+    }
+
     fPlaneForNormalization  = pset.get<size_t>(    "PlaneForNormalization");
     fPrintResponses         = pset.get<bool>(      "PrintResponses"       );
     fDeconNorm              = pset.get<double>(    "DeconNorm"            );
     fInitialFFTSize         = pset.get<size_t>(    "InitialFFTSize"       );
     fNoiseFactVec           = pset.get<DoubleVec2>("NoiseFactVec"         );
     fStoreHistograms        = pset.get<bool>(      "StoreHistograms"      );
-    
-    fInit = false;
-    
+
+    fInit                  = false;
+    fTableFrozen           = false;
+    fLastDeconSamplingRate = -1.;
+    fResponseTable.clear();
+    fVariantResponseTables.clear();
+    fChannelToPlaneVec.clear();
+
     return;
 }
 
@@ -97,16 +126,107 @@ void SignalShapingICARUSService::reconfigure(const fhicl::ParameterSet& pset)
 
 const icarus_tool::IResponse& SignalShapingICARUSService::GetResponse(size_t channel) const
 {
+    // Once the table is frozen at beginJob this path is lock free: the
+    // responses are immutable and the plane lookup is a table read
+    if (fTableFrozen) return *fResponseTable[fChannelToPlaneVec[channel]];
+
     if (!fInit) init();
-    
+
     art::ServiceHandle<geo::Geometry> geom;
-    
+
         //use channel number to set some useful numbers
     size_t planeIdx = geom->ChannelToWire(channel)[0].Plane;
 
     return *fPlaneToResponseMap.at(planeIdx).front();
 }
 
+//----------------------------------------------------------------------
+// Accessor for an alternate response variant (empty name: default set)
+const icarus_tool::IResponse& SignalShapingICARUSService::GetResponse(size_t channel, const std::string& variant) const
+{
+    if (variant.empty()) return GetResponse(channel);
+
+    if (fTableFrozen)
+    {
+        auto tableItr = fVariantResponseTables.find(variant);
+
+        if (tableItr != fVariantResponseTables.end()) return *tableItr->second[fChannelToPlaneVec[channel]];
+    }
+
+    auto variantItr = fVariantResponseMaps.find(variant);
+
+    if (variantItr == fVariantResponseMaps.end())
+        throw cet::exception("SignalShapingICARUSService") << "Unknown response variant: " << variant << std::endl;
+
+    if (!fInit) init();
+
+    return *variantItr->second.at(planeForChannel(channel)).front();
+}
+
+//----------------------------------------------------------------------
+std::vector<std::string> SignalShapingICARUSService::GetResponseVariantNames() const
+{
+    std::vector<std::string> names;
+
+    for(const auto& variantPair : fVariantResponseMaps) names.push_back(variantPair.first);
+
+    return names;
+}
+
+//----------------------------------------------------------------------
+bool SignalShapingICARUSService::HasResponseVariant(const std::string& variant) const
+{
+    return fVariantResponseMaps.find(variant) != fVariantResponseMaps.end();
+}
+
+//----------------------------------------------------------------------
+// Build the frozen response table. Called once at beginJob; after this the
+// responses are left untouched for the rest of the job so the accessors can
+// read them without synchronization.
+void SignalShapingICARUSService::freezeResponseTable()
+{
+    // Make sure the responses themselves have been sampled
+    if (!fInit) init();
+
+    art::ServiceHandle<geo::Geometry> geom;
+
+    fResponseTable.resize(geom->Nplanes(), nullptr);
+
+    for(const auto& responsePair : fPlaneToResponseMap)
+        fResponseTable[responsePair.first] = responsePair.second.front().get();
+
+    for(const auto& variantPair : fVariantResponseMaps)
+    {
+        std::vector<const icarus_tool::IResponse*>& variantTable = fVariantResponseTables[variantPair.first];
+
+        variantTable.resize(geom->Nplanes(), nullptr);
+
+        for(const auto& responsePair : variantPair.second)
+            variantTable[responsePair.first] = responsePair.second.front().get();
+    }
+
+    // Resolve each channel to its plane once so the per event accessors do
+    // not go back to the geometry service
+    fChannelToPlaneVec.resize(geom->Nchannels());
+
+    for(size_t channel = 0; channel < fChannelToPlaneVec.size(); channel++)
+        fChannelToPlaneVec[channel] = geom->ChannelToWire(channel)[0].Plane;
+
+    fTableFrozen = true;
+
+    return;
+}
+
+//----------------------------------------------------------------------
+size_t SignalShapingICARUSService::planeForChannel(size_t channel) const
+{
+    if (fTableFrozen) return fChannelToPlaneVec[channel];
+
+    art::ServiceHandle<geo::Geometry> geom;
+
+    return geom->ChannelToWire(channel)[0].Plane;
+}
+
 
 //----------------------------------------------------------------------
 // Initialization method.
@@ -133,7 +253,16 @@ void SignalShapingICARUSService::init()
         {
           fPlaneToResponseMap[planeIdx].front().get()->setResponse(samplingRate, weight);
         }
-        
+
+        // Sample the alternate variants too, each with its own normalization
+        for(auto& variantPair : fVariantResponseMaps)
+        {
+            double variantIntegral = variantPair.second.at(fPlaneForNormalization).front().get()->getFieldResponse()->getIntegral();
+            double variantWeight   = 1. / variantIntegral;
+
+            for(auto& responsePair : variantPair.second) responsePair.second.front().get()->setResponse(samplingRate, variantWeight);
+        }
+
         // Check to see if we want histogram output
         if (fStoreHistograms)
         {
@@ -160,17 +289,35 @@ void SignalShapingICARUSService::SetDecon(double const samplingRate,
                                           size_t fftsize, size_t channel)
 {
     art::ServiceHandle<geo::Geometry> geo;
-    
+
     if (!fInit) init();
-    
+
+    // The response tools keep kernel sets for recent run conditions resident,
+    // so a change of conditions here is a cache switch, not a recomputation.
+    // Serialize the switch; when the conditions did not change it is a no-op.
+    tbb::spin_mutex::scoped_lock lock(signalShapingSpinMutex);
+
+    if (samplingRate == fLastDeconSamplingRate) return;
+
     // Assume we need to reset the kernels
     double integral = fPlaneToResponseMap.at(fPlaneForNormalization).front().get()->getFieldResponse()->getIntegral();
     double weight   = 1. / integral;
-    
+
     for(size_t planeIdx = 0; planeIdx < geo->Nplanes(); planeIdx++)
     {
         fPlaneToResponseMap.at(planeIdx).front()->setResponse(samplingRate, weight);
     }
+
+    // Keep the alternate variants synchronized with the same conditions
+    for(auto& variantPair : fVariantResponseMaps)
+    {
+        double variantIntegral = variantPair.second.at(fPlaneForNormalization).front().get()->getFieldResponse()->getIntegral();
+        double variantWeight   = 1. / variantIntegral;
+
+        for(auto& responsePair : variantPair.second) responsePair.second.front().get()->setResponse(samplingRate, variantWeight);
+    }
+
+    fLastDeconSamplingRate = samplingRate;
 }
 
 //-----Give Gain Settings to SimWire-----
@@ -178,8 +325,7 @@ double SignalShapingICARUSService::GetASICGain(unsigned int channel) const
 {
     static const double fcToElectrons(6241.50975);
 
-    art::ServiceHandle<geo::Geometry> geom;
-    size_t planeIdx = geom->ChannelToWire(channel)[0].Plane;
+    size_t planeIdx = planeForChannel(channel);
     
     double gain = fPlaneToResponseMap.at(planeIdx).front()->getElectronicsResponse()->getFCperADCMicroS() * fcToElectrons;
     
@@ -196,8 +342,7 @@ double SignalShapingICARUSService::GetShapingTime(unsigned int planeIdx) const
 
 double SignalShapingICARUSService::GetRawNoise(unsigned int const channel) const
 {
-    art::ServiceHandle<geo::Geometry> geom;
-    size_t planeIdx = geom->ChannelToWire(channel)[0].Plane;
+    size_t planeIdx = planeForChannel(channel);
 
     double gain         = fPlaneToResponseMap.at(planeIdx).front()->getElectronicsResponse()->getFCperADCMicroS();
     double shaping_time = fPlaneToResponseMap.at(planeIdx).front()->getElectronicsResponse()->getASICShapingTime();
@@ -224,8 +369,7 @@ double SignalShapingICARUSService::GetRawNoise(unsigned int const channel) const
 
 double SignalShapingICARUSService::GetDeconNoise(unsigned int const channel) const
 {
-    art::ServiceHandle<geo::Geometry> geom;
-    size_t planeIdx = geom->ChannelToWire(channel)[0].Plane;
+    size_t planeIdx = planeForChannel(channel);
     
     double shaping_time = fPlaneToResponseMap.at(planeIdx).front()->getElectronicsResponse()->getASICShapingTime();
     int temp;
@@ -250,10 +394,8 @@ double SignalShapingICARUSService::GetDeconNoise(unsigned int const channel) con
 int SignalShapingICARUSService::ResponseTOffset(unsigned int const channel) const
 {
     if (!fInit) init();
-    
-    art::ServiceHandle<geo::Geometry> geom;
-    
-    size_t planeIdx = geom->ChannelToWire(channel)[0].Plane;
+
+    size_t planeIdx = planeForChannel(channel);
 
     return fPlaneToResponseMap.at(planeIdx).front()->getTOffset();
 }
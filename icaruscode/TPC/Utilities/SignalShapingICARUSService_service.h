@@ -20,6 +20,12 @@
 /// ShapeTimeConst  - Time constants for exponential shaping.
 /// FilterVec       - vector of filter function parameters, one for each view
 /// FilterParamsVec - Vector of filter function parameters.
+/// ResponseVariants - optional block of named alternate response sets, each
+///                    configured exactly like ResponseTools; all variants stay
+///                    resident and are selected by name through
+///                    GetResponse(channel, variant) (see the
+///                    ResponseVariantBenchmark module for an A/B comparison
+///                    of the variants within one job)
 ///
 /// \update notes: Leon Rochester (lsrea@slac.stanford.edu, Jan 12, 2015
 ///                many changes, need to be documented better
@@ -114,7 +120,14 @@ public:
     double                        GetDeconNoise(unsigned int const channel)          const;
     
     const icarus_tool::IResponse& GetResponse(size_t channel)                        const;
-     
+
+    // Multi-variant support: alternate response sets can be kept resident
+    // alongside the default one (see the ResponseVariants fcl parameter) and
+    // selected by name; an empty name selects the default set
+    const icarus_tool::IResponse& GetResponse(size_t channel, const std::string& variant) const;
+    std::vector<std::string>      GetResponseVariantNames()                        const;
+    bool                          HasResponseVariant(const std::string& variant)   const;
+
     int                           ResponseTOffset(unsigned int const channel)        const;
     
     void                          SetDecon(double samplingRate, size_t fftsize, size_t channel);
@@ -131,7 +144,16 @@ private:
     // Post-constructor initialization.
     void init() const{const_cast<SignalShapingICARUSService*>(this)->init();}
     void init();
-    
+
+    // Freeze the response table at beginJob; after this the responses are
+    // immutable and the accessors above take no locks on the hot path.
+    void freezeResponseTable();
+
+    // Channel to plane without going back to the geometry service once the
+    // table is frozen.
+    size_t planeForChannel(size_t channel) const;
+
+
     // Attributes.
     bool fInit;                                                 ///< Initialization flag
     
@@ -145,6 +167,24 @@ private:
     
     // Field response tools
     PlaneToResponseMap fPlaneToResponseMap;
+
+    // Alternate response sets, by variant name ("ResponseVariants" in the fcl,
+    // each variant configured exactly like "ResponseTools"). All variants stay
+    // resident so one job can run several of them side by side
+    std::map<std::string, PlaneToResponseMap> fVariantResponseMaps;
+
+    // Sampling rate the deconvolution kernels are currently set for, so
+    // SetDecon only touches the response tools at a change of conditions
+    double             fLastDeconSamplingRate = -1.;
+
+    // Frozen at beginJob: per plane response pointers and per channel plane
+    // indices so GetResponse needs no locks and no geometry queries
+    std::vector<const icarus_tool::IResponse*> fResponseTable;
+    std::vector<unsigned char>                 fChannelToPlaneVec;
+    bool                                       fTableFrozen = false;
+
+    // Frozen per-variant response tables, same layout as fResponseTable
+    std::map<std::string, std::vector<const icarus_tool::IResponse*>> fVariantResponseTables;
 };
 
 } // end of namespace
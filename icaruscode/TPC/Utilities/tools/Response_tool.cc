@@ -20,6 +20,7 @@
 #include "IFieldResponse.h"
 #include "IElectronicsResponse.h"
 #include "IFilter.h"
+#include "VectorMath.h"
 
 #include "TProfile.h"
 
@@ -27,6 +28,8 @@
 
 #include <fstream>
 #include <iomanip>
+#include <list>
+#include <utility>
 
 namespace icarus_tool
 {
@@ -62,9 +65,27 @@ private:
     // Utility routine for converting numbers to strings
     std::string                             numberToString(int number);
 
+    // One fully sampled set of response functions for given run conditions
+    struct ResponseSet
+    {
+        icarusutil::TimeVec      response;
+        icarusutil::FrequencyVec convolutionKernel;
+        icarusutil::FrequencyVec deconvolutionKernel;
+        double                   t0Offset;
+    };
+
+    // Run conditions the kernels depend on: sampling rate and normalization
+    using ResponseKey = std::pair<double,double>;
+
     // Keep track of our status
     bool                                              fResponseHasBeenSet;
-    
+    ResponseKey                                       fCurrentKey;
+
+    // Cache of kernel sets for recently seen run conditions, most recently
+    // used first, so switching back at a run boundary needs no recomputation
+    std::list<std::pair<ResponseKey,ResponseSet>>     fResponseCache;
+    size_t                                            fMaxCachedResponses;
+
     // Member variables from the fhicl file
     size_t                                            fThisPlane;
     double                                            f3DCorrection;
@@ -103,8 +124,10 @@ void Response::configure(const fhicl::ParameterSet& pset)
     fThisPlane           = pset.get<size_t>("Plane");
     f3DCorrection        = pset.get<size_t>("Correction3D");
     fTimeScaleFactor     = pset.get<size_t>("TimeScaleFactor");
+    fMaxCachedResponses  = pset.get<size_t>("MaxCachedResponses", 4);
 
     fResponseHasBeenSet  = false;
+    fResponseCache.clear();
 
     // Build out the underlying tools we'll be using
     fFieldResponse       = art::make_tool<icarus_tool::IFieldResponse>(pset.get<fhicl::ParameterSet>("FieldResponse"));
@@ -122,8 +145,30 @@ void Response::configure(const fhicl::ParameterSet& pset)
 
   void Response::setResponse(double sampling_rate, double weight)
 {
-    // If we have already done the setup then can return
-    if (fResponseHasBeenSet) return;
+    ResponseKey key(sampling_rate, weight);
+
+    // If we have already done the setup for these conditions then can return
+    if (fResponseHasBeenSet && key == fCurrentKey) return;
+
+    // Check whether a previous run with the same conditions left us a kernel
+    // set in the cache: if so switch to it, no recomputation needed
+    for(auto cacheItr = fResponseCache.begin(); cacheItr != fResponseCache.end(); cacheItr++)
+    {
+        if (cacheItr->first != key) continue;
+
+        // Move to the front of the cache (most recently used)
+        fResponseCache.splice(fResponseCache.begin(), fResponseCache, cacheItr);
+
+        fResponse            = cacheItr->second.response;
+        fConvolutionKernel   = cacheItr->second.convolutionKernel;
+        fDeconvolutionKernel = cacheItr->second.deconvolutionKernel;
+        fT0Offset            = cacheItr->second.t0Offset;
+
+        fCurrentKey          = key;
+        fResponseHasBeenSet  = true;
+
+        return;
+    }
 
     // Calculate the combined field and electronics shaping response
     calculateResponse(sampling_rate, weight);
@@ -173,6 +218,13 @@ void Response::configure(const fhicl::ParameterSet& pset)
 //
 //    mf::LogInfo("Response_tool") << "Checking recovery of the filter, # differences: " << diffCount << ", max diff seen: " << maxRhoDiff << std::endl;
 
+    // Remember this kernel set so coming back to these conditions is instant;
+    // the cache is bounded, dropping the least recently used set
+    fResponseCache.emplace_front(key, ResponseSet{fResponse, fConvolutionKernel, fDeconvolutionKernel, fT0Offset});
+
+    while(fResponseCache.size() > fMaxCachedResponses) fResponseCache.pop_back();
+
+    fCurrentKey         = key;
     fResponseHasBeenSet = true;
 
     return;
@@ -248,15 +300,11 @@ void Response::calculateResponse(double sampling_rate,
             if (responseHiIdx == responseLowIdx) responseHiIdx += 1;
             
             if (responseHiIdx >= curResponseVec.size()) break;
-            
-            icarusutil::TimeVec::const_iterator curResponseItr = curResponseVec.begin();
-            
-            std::advance(curResponseItr,responseLowIdx);
-            
+
             int nBins = responseHiIdx - responseLowIdx;
-            
-            // Obtain the average of these bins
-            double aveResponse = std::accumulate(curResponseItr,curResponseItr+nBins,0.)/double(nBins);
+
+            // Obtain the average of these bins using the shared kernel
+            double aveResponse = icarusutil::blockAverage(curResponseVec.data() + responseLowIdx, nBins);
             
             // Now interpolate between the two bins to get the sampling response for this bin
 //            double responseSlope = (curResponseVec.at(responseHiIdx) - curResponseVec.at(responseLowIdx)) / (responseHiIdx - responseLowIdx);
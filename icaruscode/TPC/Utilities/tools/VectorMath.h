@@ -0,0 +1,101 @@
+///////////////////////////////////////////////////////////////////////
+///
+/// \file   VectorMath.h
+///
+/// \brief  Shared vector-math kernels for the waveform manipulation
+///         tools. Every tool used to hand-roll its own inner loops;
+///         the primitives here are written so the compiler turns them
+///         into fused multiply-add and wide vector instructions for
+///         whatever instruction set the build targets, giving new
+///         signal-processing tools a fast baseline for free.
+///
+/// \author T. Usher
+///
+////////////////////////////////////////////////////////////////////////
+
+#ifndef VectorMath_H
+#define VectorMath_H
+
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+namespace icarusutil
+{
+    /// A lightweight view over a contiguous run of values. The kernels
+    /// below take raw pointers; this is the convenience wrapper for
+    /// callers holding vectors (std::span arrives with C++20)
+    template <typename T>
+    struct Span
+    {
+        const T*    dataPtr;
+        std::size_t numElems;
+
+        const T*    data()                       const {return dataPtr;}
+        std::size_t size()                       const {return numElems;}
+        const T&    operator[](std::size_t idx)  const {return dataPtr[idx];}
+    };
+
+    template <typename T>
+    Span<T> makeSpan(const std::vector<T>& vec) {return Span<T>{vec.data(), vec.size()};}
+
+    /// Multiply-accumulate reduction: sum over kernel[idx] * data[idx].
+    /// The independent accumulation per element lets the compiler emit
+    /// fused multiply-adds over vector registers
+    template <typename W, typename T>
+    inline double fmaDot(const W* kernel, const T* data, std::size_t numElems)
+    {
+        double sum(0.);
+
+        for(std::size_t idx = 0; idx < numElems; idx++) sum += double(kernel[idx]) * double(data[idx]);
+
+        return sum;
+    }
+
+    /// Average of a contiguous block of values
+    template <typename T>
+    inline double blockAverage(const T* data, std::size_t numElems)
+    {
+        if (!numElems) return 0.;
+
+        double sum(0.);
+
+        for(std::size_t idx = 0; idx < numElems; idx++) sum += double(data[idx]);
+
+        return sum / double(numElems);
+    }
+
+    /// "Valid" convolution primitive: output[idx] = dot(kernel, input + idx)
+    /// for every position where the kernel fits entirely inside the input.
+    /// The output is processed in cache-sized blocks so the input window
+    /// stays resident while the kernel sweeps over it
+    template <typename TIn, typename W, typename TOut>
+    inline void convolveValid(const TIn* input, std::size_t inputSize, const W* kernel, std::size_t kernelSize, TOut* output)
+    {
+        if (inputSize < kernelSize) return;
+
+        const std::size_t numOutput(inputSize - kernelSize + 1);
+        const std::size_t blockSize(1024);
+
+        for(std::size_t blockIdx = 0; blockIdx < numOutput; blockIdx += blockSize)
+        {
+            std::size_t blockEnd = std::min(numOutput, blockIdx + blockSize);
+
+            for(std::size_t idx = blockIdx; idx < blockEnd; idx++) output[idx] = TOut(fmaDot(kernel, input + idx, kernelSize));
+        }
+
+        return;
+    }
+
+    /// Subtract a (float) baseline from an integer waveform with rounding,
+    /// the common final step of the baseline-removing filters
+    template <typename T, typename B>
+    inline void subtractRoundedBaseline(T* data, const B* baseline, std::size_t numElems)
+    {
+        for(std::size_t idx = 0; idx < numElems; idx++) data[idx] = data[idx] - T(std::round(baseline[idx]));
+
+        return;
+    }
+}
+
+#endif
@@ -0,0 +1,208 @@
+/**
+ * @file   icaruscode/Utilities/AssnsPrefetch.h
+ * @brief  Bulk resolution of a `art::Assns` data product into flat arrays.
+ * @see    icaruscode/Utilities/DataProductPointerMap.h
+ *
+ * This library is header only.
+ */
+
+#ifndef ICARUSCODE_UTILITIES_ASSNSPREFETCH_H
+#define ICARUSCODE_UTILITIES_ASSNSPREFETCH_H
+
+
+// LArSoft libraries
+#include "larcorealg/CoreUtils/span.h" // util::span
+
+// framework libraries
+#include "art/Framework/Principal/Event.h"
+#include "canvas/Persistency/Common/Assns.h"
+#include "canvas/Persistency/Common/Ptr.h"
+#include "canvas/Utilities/InputTag.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::copy()
+#include <numeric> // std::partial_sum()
+#include <stdexcept> // std::out_of_range
+#include <string> // std::to_string()
+#include <vector>
+#include <cstddef> // std::size_t
+
+
+namespace util {
+
+  // ---------------------------------------------------------------------------
+  /**
+   * @brief Flattened, index-addressed copy of a one-to-many association set.
+   * @tparam Left type of the element the associations are queried by
+   * @tparam Right type of the associated elements
+   *
+   * `art::FindManyP` answers the same question, but each `at()` call returns
+   * a freshly allocated vector of _art_ pointers, and each construction of
+   * the object resolves the whole association data product again. When an
+   * analyzer queries associations element by element in nested loops, that
+   * resolution dominates its profile.
+   *
+   * This object reads the `art::Assns<Left, Right>` data product once and
+   * stores all the _art_ pointers of the right side in a single array,
+   * grouped by the index of the left-side element, with an offset table next
+   * to it. A query is then two array lookups and returns a light-weight span
+   * over the stored pointers, with no allocation and no copy.
+   *
+   * Example, with `flashHandle` a handle to `std::vector<recob::OpFlash>`
+   * produced with the label `flashTag` together with its hit associations:
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+   * util::AssnsPrefetch<recob::OpFlash, recob::OpHit> const flashToHits
+   *   { event, flashTag, flashHandle->size() };
+   *
+   * for (std::size_t iFlash = 0U; iFlash < flashHandle->size(); ++iFlash) {
+   *   for (art::Ptr<recob::OpHit> const& hit: flashToHits.at(iFlash)) {
+   *     // ...
+   *   }
+   * } // for
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+   *
+   * The left-side indices are the keys of the _art_ pointers in the
+   * association data product, i.e. the indices in the original left-side
+   * data product: the same convention as `art::FindManyP` constructed from
+   * a handle to that product. Within each group, the associated pointers
+   * keep the order they have in the association data product.
+   *
+   * The object is self-contained: it can outlive the handles it was built
+   * from, and it is freely copiable and movable.
+   */
+  template <typename Left, typename Right>
+  class AssnsPrefetch {
+
+      public:
+
+    /// Type of _art_ pointer to an associated (right side) element.
+    using RightPtr_t = art::Ptr<Right>;
+
+    /// Type of the sequence of pointers associated to one left-side element.
+    using RightSpan_t
+      = util::span<typename std::vector<RightPtr_t>::const_iterator>;
+
+
+    /// Default constructor: an empty association set.
+    AssnsPrefetch() = default;
+
+    /**
+     * @brief Constructor: resolves the whole association data product.
+     * @param event the _art_ event to read the associations from
+     * @param assnsTag input tag of the `art::Assns<Left, Right>` data product
+     * @param leftSize number of elements in the left-side data product
+     *
+     * All associations in the data product are resolved here, once.
+     * The prefetched set always covers at least `leftSize` left-side
+     * indices (with empty groups where no association is present), so that
+     * a loop over the left-side data product can query every index safely.
+     */
+    AssnsPrefetch(
+      art::Event const& event, art::InputTag const& assnsTag,
+      std::size_t leftSize = 0U
+      );
+
+
+    // --- BEGIN -- Queries ------------------------------------------------------
+
+    /// Returns the number of left-side indices covered by the prefetched set.
+    std::size_t size() const { return fOffsets.size() - 1U; }
+
+    /// Returns whether no left-side index is covered at all.
+    bool empty() const { return size() == 0U; }
+
+    /// Returns the total number of associations in the prefetched set.
+    std::size_t totalAssociated() const { return fPointers.size(); }
+
+    /// Returns the pointers associated to the element `leftIndex` (unchecked).
+    RightSpan_t operator[] (std::size_t leftIndex) const
+      {
+        return {
+          fPointers.begin() + fOffsets[leftIndex],
+          fPointers.begin() + fOffsets[leftIndex + 1U]
+          };
+      }
+
+    /// Returns the pointers associated to the element `leftIndex`;
+    /// throws `std::out_of_range` if that index is not covered.
+    RightSpan_t at(std::size_t leftIndex) const
+      {
+        if (leftIndex >= size()) {
+          throw std::out_of_range(
+            "util::AssnsPrefetch::at(): index " + std::to_string(leftIndex)
+            + " out of the " + std::to_string(size()) + " covered ones"
+            );
+        }
+        return operator[] (leftIndex);
+      }
+
+    // --- END ---- Queries ------------------------------------------------------
+
+      private:
+
+    /// All associated pointers, grouped by left-side index.
+    std::vector<RightPtr_t> fPointers;
+
+    /// Index in `fPointers` of the first pointer of each group
+    /// (one extra entry at the end closing the last group).
+    std::vector<std::size_t> fOffsets { 0U };
+
+  }; // class util::AssnsPrefetch
+
+
+  // ---------------------------------------------------------------------------
+  /// Deduction-friendly helper: prefetches the associations from the elements
+  /// in `leftHandle` (a handle to a STL vector data product) to `Right` ones.
+  template <typename Right, typename Handle>
+  auto prefetchAssns
+    (art::Event const& event, Handle const& leftHandle, art::InputTag const& assnsTag)
+    {
+      using Left_t = typename Handle::element_type::value_type;
+      return AssnsPrefetch<Left_t, Right>
+        { event, assnsTag, leftHandle.isValid()? leftHandle->size(): 0U };
+    }
+
+  // ---------------------------------------------------------------------------
+
+} // namespace util
+
+
+// -----------------------------------------------------------------------------
+// ---  template implementation
+// -----------------------------------------------------------------------------
+template <typename Left, typename Right>
+util::AssnsPrefetch<Left, Right>::AssnsPrefetch(
+  art::Event const& event, art::InputTag const& assnsTag,
+  std::size_t leftSize /* = 0U */
+) {
+
+  auto const& assns = event.getProduct<art::Assns<Left, Right>>(assnsTag);
+
+  // how far the offset table must reach: the declared size of the left-side
+  // data product, or one past the largest key actually found, if larger
+  std::size_t nLeft = leftSize;
+  for (auto const& assn: assns) {
+    std::size_t const key = assn.first.key();
+    if (key >= nLeft) nLeft = key + 1U;
+  } // for (sizing)
+
+  std::vector<std::size_t> counts(nLeft, 0U);
+  for (auto const& assn: assns) ++counts[assn.first.key()];
+
+  fOffsets.resize(nLeft + 1U);
+  fOffsets[0U] = 0U;
+  std::partial_sum(counts.begin(), counts.end(), fOffsets.begin() + 1);
+
+  // drop each pointer into its slot, preserving the data product order
+  // within each group; `counts` is recycled as the per-group write cursor
+  std::copy(fOffsets.begin(), fOffsets.begin() + nLeft, counts.begin());
+  fPointers.resize(assns.size());
+  for (auto const& assn: assns)
+    fPointers[counts[assn.first.key()]++] = assn.second;
+
+} // util::AssnsPrefetch<>::AssnsPrefetch()
+
+
+// -----------------------------------------------------------------------------
+
+#endif // ICARUSCODE_UTILITIES_ASSNSPREFETCH_H
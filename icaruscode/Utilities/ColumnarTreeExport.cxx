@@ -0,0 +1,268 @@
+/**
+ * @file   icaruscode/Utilities/ColumnarTreeExport.cxx
+ * @brief  Columnar (NumPy format) export of ROOT ntuples: implementation.
+ * @date   August 31, 2026
+ * @see    icaruscode/Utilities/ColumnarTreeExport.h
+ */
+
+// library header
+#include "icaruscode/Utilities/ColumnarTreeExport.h"
+
+// framework libraries
+#include "messagefacility/MessageLogger/MessageLogger.h"
+
+// ROOT libraries
+#include "TTree.h"
+#include "TBranch.h"
+#include "TLeaf.h"
+#include "TObjArray.h"
+
+// C/C++ standard libraries
+#include <cstring> // std::memcpy()
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <utility> // std::move()
+
+
+// -----------------------------------------------------------------------------
+namespace {
+
+  /// NumPy `descr` string and value size for each basic ROOT leaf type
+  /// (host byte order is assumed little-endian, as everywhere else we run).
+  std::map<std::string, std::pair<std::string, std::size_t>> const NpyTypes {
+    { "Char_t",    { "<i1", 1U } },
+    { "UChar_t",   { "<u1", 1U } },
+    { "Short_t",   { "<i2", 2U } },
+    { "UShort_t",  { "<u2", 2U } },
+    { "Int_t",     { "<i4", 4U } },
+    { "UInt_t",    { "<u4", 4U } },
+    { "Long64_t",  { "<i8", 8U } },
+    { "ULong64_t", { "<u8", 8U } },
+    { "Float_t",   { "<f4", 4U } },
+    { "Double_t",  { "<f8", 8U } },
+    { "Bool_t",    { "|b1", 1U } }
+  }; // NpyTypes
+
+  /// Copies the numeric `value` into `data` as `valueSize` raw bytes of the
+  /// type described by `descr`.
+  template <typename T>
+  void appendValue(std::vector<char>& data, T value, std::size_t valueSize)
+    {
+      std::size_t const offset = data.size();
+      data.resize(offset + valueSize);
+      std::memcpy(data.data() + offset, &value, valueSize);
+    }
+
+  /// Converts the `index`-th value of `leaf` into raw bytes of its own type.
+  void appendLeafValue(std::vector<char>& data,
+    TLeaf const& leaf, std::size_t index,
+    std::string const& descr, std::size_t valueSize
+    )
+    {
+      if (descr[1] == 'f') {
+        if (valueSize == 4U)
+          appendValue(data, static_cast<float>(leaf.GetValue(index)), valueSize);
+        else
+          appendValue(data, leaf.GetValue(index), valueSize);
+      }
+      else {
+        // all the integral types (including booleans) go through Long64_t,
+        // which preserves every value a leaf can hold
+        Long64_t const value = leaf.GetValueLong64(index);
+        appendValue(data, value, valueSize);
+      }
+    } // appendLeafValue()
+
+} // local namespace
+
+
+// -----------------------------------------------------------------------------
+icarus::ns::util::ColumnarTreeExport::ColumnarTreeExport(std::string outputDir)
+  : fOutputDir(std::move(outputDir))
+  , fWorker(&ColumnarTreeExport::writeLoop, this)
+{}
+
+
+// -----------------------------------------------------------------------------
+icarus::ns::util::ColumnarTreeExport::~ColumnarTreeExport()
+  { finish(); }
+
+
+// -----------------------------------------------------------------------------
+void icarus::ns::util::ColumnarTreeExport::exportTree
+  (TTree& tree, std::string const& exportName)
+{
+  std::filesystem::create_directories
+    (std::filesystem::path{ fOutputDir } / exportName);
+
+  TObjArray const* branches = tree.GetListOfBranches();
+  std::size_t const nBranches
+    = branches? static_cast<std::size_t>(branches->GetEntriesFast()): 0U;
+
+  unsigned int nExported = 0U, nSkipped = 0U;
+  for (std::size_t iBranch = 0U; iBranch < nBranches; ++iBranch) {
+    if (extractBranch(tree, exportName, iBranch)) ++nExported;
+    else ++nSkipped;
+  } // for branches
+
+  mf::LogInfo("ColumnarTreeExport")
+    << "Scheduled " << nExported << " columns of tree '" << tree.GetName()
+    << "' for export into '" << fOutputDir << "/" << exportName << "'"
+    << ((nSkipped > 0U)
+      ? (" (" + std::to_string(nSkipped) + " unsupported branches skipped)")
+      : "")
+    ;
+
+} // icarus::ns::util::ColumnarTreeExport::exportTree()
+
+
+// -----------------------------------------------------------------------------
+void icarus::ns::util::ColumnarTreeExport::finish() {
+
+  {
+    std::lock_guard lock { fQueueMutex };
+    if (fDone) return; // already finished
+    fDone = true;
+  }
+  fQueueCV.notify_all();
+  if (fWorker.joinable()) fWorker.join();
+
+} // icarus::ns::util::ColumnarTreeExport::finish()
+
+
+// -----------------------------------------------------------------------------
+bool icarus::ns::util::ColumnarTreeExport::extractBranch
+  (TTree& tree, std::string const& exportName, std::size_t iBranch)
+{
+  TBranch* branch
+    = static_cast<TBranch*>(tree.GetListOfBranches()->At(iBranch));
+  if (!branch) return false;
+
+  // only plain branches with a single basic-type leaf are supported
+  if (branch->GetNleaves() != 1) return false;
+  TLeaf* leaf = static_cast<TLeaf*>(branch->GetListOfLeaves()->At(0));
+  if (!leaf) return false;
+
+  auto const itType = NpyTypes.find(leaf->GetTypeName());
+  if (itType == NpyTypes.end()) {
+    MF_LOG_DEBUG("ColumnarTreeExport")
+      << "Branch '" << branch->GetName() << "' of tree '" << tree.GetName()
+      << "' has unsupported type '" << leaf->GetTypeName() << "': skipped";
+    return false;
+  }
+  auto const& [ descr, valueSize ] = itType->second;
+
+  bool const counted = (leaf->GetLeafCount() != nullptr);
+  std::size_t const staticLength
+    = counted? 1U: static_cast<std::size_t>(leaf->GetLenStatic());
+
+  std::filesystem::path const dir
+    = std::filesystem::path{ fOutputDir } / exportName;
+
+  Column_t column;
+  column.path = (dir / (std::string{ branch->GetName() } + ".npy")).string();
+  column.descr = descr;
+  column.valueSize = valueSize;
+  column.rowLength = counted? 1U: staticLength;
+
+  Column_t lengths; // filled only for counted arrays
+  lengths.path
+    = (dir / (std::string{ branch->GetName() } + ".lengths.npy")).string();
+  lengths.descr = "<u8";
+  lengths.valueSize = 8U;
+
+  Long64_t const nEntries = tree.GetEntries();
+  for (Long64_t iEntry = 0; iEntry < nEntries; ++iEntry) {
+    branch->GetEntry(iEntry);
+    std::size_t const len = static_cast<std::size_t>(leaf->GetLen());
+    for (std::size_t i = 0U; i < len; ++i)
+      appendLeafValue(column.data, *leaf, i, descr, valueSize);
+    if (counted) {
+      appendValue(lengths.data, static_cast<std::uint64_t>(len), 8U);
+      column.nRows += len;
+      ++lengths.nRows;
+    }
+    else ++column.nRows;
+  } // for entries
+
+  schedule(std::move(column));
+  if (counted) schedule(std::move(lengths));
+  return true;
+
+} // icarus::ns::util::ColumnarTreeExport::extractBranch()
+
+
+// -----------------------------------------------------------------------------
+void icarus::ns::util::ColumnarTreeExport::schedule(Column_t&& column) {
+
+  {
+    std::lock_guard lock { fQueueMutex };
+    fQueue.push_back(std::move(column));
+  }
+  fQueueCV.notify_one();
+
+} // icarus::ns::util::ColumnarTreeExport::schedule()
+
+
+// -----------------------------------------------------------------------------
+void icarus::ns::util::ColumnarTreeExport::writeLoop() {
+
+  while (true) {
+    Column_t column;
+    {
+      std::unique_lock lock { fQueueMutex };
+      fQueueCV.wait(lock, [this](){ return fDone || !fQueue.empty(); });
+      if (fQueue.empty()) break; // done, and nothing left to write
+      column = std::move(fQueue.front());
+      fQueue.pop_front();
+    }
+    writeNpyFile(column);
+  } // while
+
+} // icarus::ns::util::ColumnarTreeExport::writeLoop()
+
+
+// -----------------------------------------------------------------------------
+void icarus::ns::util::ColumnarTreeExport::writeNpyFile(Column_t const& column)
+{
+
+  // NumPy format version 1.0 header: magic string, version, then a Python
+  // dictionary padded with spaces so that the data starts 64-byte aligned
+  std::string dict = "{'descr': '" + column.descr
+    + "', 'fortran_order': False, 'shape': (" + std::to_string(column.nRows);
+  if (column.rowLength > 1U)
+    dict += ", " + std::to_string(column.rowLength);
+  dict += "), }";
+
+  constexpr std::size_t PreambleSize = 10U; // magic + version + header length
+  std::size_t const headerSize
+    = ((PreambleSize + dict.size() + 1U + 63U) / 64U) * 64U - PreambleSize;
+  dict.resize(headerSize - 1U, ' ');
+  dict += '\n';
+
+  std::ofstream out { column.path, std::ios::binary | std::ios::trunc };
+  if (!out) {
+    mf::LogWarning("ColumnarTreeExport")
+      << "Could not open '" << column.path << "' for writing: column lost";
+    return;
+  }
+
+  out.write("\x93NUMPY\x01\x00", 8);
+  char const lenBytes[2] = {
+    static_cast<char>(headerSize & 0xFFU),
+    static_cast<char>((headerSize >> 8U) & 0xFFU)
+  };
+  out.write(lenBytes, 2);
+  out.write(dict.data(), dict.size());
+  out.write(column.data.data(), column.data.size());
+
+  if (!out) {
+    mf::LogWarning("ColumnarTreeExport")
+      << "Error while writing '" << column.path << "': column may be corrupt";
+  }
+
+} // icarus::ns::util::ColumnarTreeExport::writeNpyFile()
+
+
+// -----------------------------------------------------------------------------
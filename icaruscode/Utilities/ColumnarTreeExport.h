@@ -0,0 +1,120 @@
+/**
+ * @file   icaruscode/Utilities/ColumnarTreeExport.h
+ * @brief  Columnar (NumPy format) export of ROOT ntuples.
+ * @date   August 31, 2026
+ * @see    icaruscode/Utilities/ColumnarTreeExport.cxx
+ *
+ * Calibration workflows post-process our ntuples in Python, and the
+ * ROOT-to-dataframe conversion of large trees can take longer than the
+ * analysis itself. This helper dumps, branch by branch, the content of a
+ * `TTree` into plain NumPy format (`.npy`) files, one file per column, which
+ * NumPy and pandas load (and even memory-map) natively, with no ROOT
+ * dependency on the Python side.
+ *
+ * The tree is read on the calling thread; the files are written by a single
+ * background worker thread, so the export overlaps the rest of the job
+ * shutdown. `finish()` (also implied by the destructor) waits for all the
+ * scheduled files to be on disk.
+ *
+ * Supported content
+ * ------------------
+ *
+ * Branches whose leaves are basic numeric types are exported:
+ * * a scalar leaf becomes a one-dimensional column of one entry per tree
+ *   entry;
+ * * a fixed-size array leaf (e.g. `xyz[3]/F`) becomes a two-dimensional
+ *   column of shape (entries, size);
+ * * a counted array leaf (e.g. `trkke[ntracks]/F`) becomes a one-dimensional
+ *   column of the concatenated values plus a companion `<branch>.lengths.npy`
+ *   column of the per-entry counts.
+ *
+ * Branches of other kinds (objects, `std::vector`, strings) are skipped with
+ * a message. The files are not compressed: the absence of a codec keeps this
+ * helper free of dependencies, and the columns remain memory-mappable.
+ */
+
+#ifndef ICARUSCODE_UTILITIES_COLUMNARTREEEXPORT_H
+#define ICARUSCODE_UTILITIES_COLUMNARTREEEXPORT_H
+
+
+// C/C++ standard libraries
+#include <condition_variable>
+#include <cstdint> // std::uint64_t
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+
+// -----------------------------------------------------------------------------
+// forward declarations
+class TTree;
+
+// -----------------------------------------------------------------------------
+namespace icarus::ns::util { class ColumnarTreeExport; }
+
+/// Writes the columns of ROOT trees into NumPy format files.
+class icarus::ns::util::ColumnarTreeExport {
+
+    public:
+
+  /// Constructor: the files will be written under `outputDir`
+  /// (created if needed), one subdirectory per exported tree.
+  explicit ColumnarTreeExport(std::string outputDir);
+
+  // not copyable nor movable (owns a worker thread)
+  ColumnarTreeExport(ColumnarTreeExport const&) = delete;
+  ColumnarTreeExport& operator= (ColumnarTreeExport const&) = delete;
+
+  /// Destructor: waits for all the scheduled files to be written.
+  ~ColumnarTreeExport();
+
+  /// Schedules the export of all the supported branches of `tree` into
+  /// `outputDir/exportName/<branch>.npy` files. The tree is read here,
+  /// synchronously; the file writing happens on the background worker.
+  void exportTree(TTree& tree, std::string const& exportName);
+
+  /// Waits until all the scheduled files have been written.
+  void finish();
+
+
+    private:
+
+  /// One column extracted from a tree, ready to be written.
+  struct Column_t {
+    std::string path;          ///< Destination file path.
+    std::string descr;         ///< NumPy `descr` type string (e.g. `<f4`).
+    std::size_t valueSize;     ///< Size of one value [bytes]
+    std::uint64_t nRows = 0U;  ///< First dimension of the column shape.
+    std::uint64_t rowLength = 1U; ///< Second dimension (`1`: one-dimensional).
+    std::vector<char> data;    ///< Raw column content, host byte order.
+  }; // struct Column_t
+
+  std::string const fOutputDir; ///< Destination directory of the export.
+
+  std::mutex fQueueMutex; ///< Protects the queue and the `fDone` flag.
+  std::condition_variable fQueueCV; ///< Signals queue insertions and `fDone`.
+  std::deque<Column_t> fQueue; ///< Columns waiting to be written.
+  bool fDone = false; ///< Set when no more columns will be scheduled.
+
+  std::thread fWorker; ///< The background thread writing the files.
+
+  /// Extracts one branch into a column (plus the lengths column for counted
+  /// arrays); returns whether the branch was supported.
+  bool extractBranch
+    (TTree& tree, std::string const& exportName, std::size_t iBranch);
+
+  /// Adds `column` to the writing queue.
+  void schedule(Column_t&& column);
+
+  /// Worker thread: writes queued columns until `fDone` and the queue drains.
+  void writeLoop();
+
+  /// Writes `column` as a NumPy format (version 1.0) file.
+  static void writeNpyFile(Column_t const& column);
+
+}; // class icarus::ns::util::ColumnarTreeExport
+
+
+#endif // ICARUSCODE_UTILITIES_COLUMNARTREEEXPORT_H
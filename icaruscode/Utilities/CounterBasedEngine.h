@@ -0,0 +1,274 @@
+/**
+ * @file   icaruscode/Utilities/CounterBasedEngine.h
+ * @brief  Counter-based random engine with reproducible per-object streams.
+ * @date   August 31, 2026
+ *
+ * This library is header-only.
+ */
+
+#ifndef ICARUSCODE_UTILITIES_COUNTERBASEDENGINE_H
+#define ICARUSCODE_UTILITIES_COUNTERBASEDENGINE_H
+
+
+// CLHEP libraries
+#include "CLHEP/Random/RandomEngine.h" // CLHEP::HepRandomEngine
+
+// C/C++ standard libraries
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <cstdint>
+
+
+// -----------------------------------------------------------------------------
+namespace icarus::ns::util { class CounterBasedEngine; }
+/**
+ * @brief A CLHEP random engine with counter-based (Philox) generation.
+ *
+ * A counter-based generator produces each random value as a pure function of
+ * a key and a counter: no state is carried from one draw to the next apart
+ * from the position in the stream. The key of this engine is derived from a
+ * seed and a "purpose" tag; the counter is composed of an event index, a
+ * channel (or other object) index and the index of the draw within that
+ * object. As a consequence, the value of every draw is fully determined by
+ * `(seed, purpose, event, channel, draw)`: the same configuration yields
+ * bit-identical streams no matter how the objects are scheduled across
+ * threads, or in which order they are processed.
+ *
+ * The intended use is one engine per purpose (e.g. dark noise) shared by a
+ * worker, with `setEventChannel()` called before the draws for each object:
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+ * icarus::ns::util::CounterBasedEngine engine { seed, DarkNoisePurpose };
+ *
+ * for (auto const& [ channel, photons ]: channelPhotons) {
+ *   engine.setEventChannel(eventIndex, channel);
+ *   // ... draws for this channel ...
+ * }
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * The generator is Philox-4x32 with 10 rounds (Salmon et al., SC'11), which
+ * passes the standard statistical batteries and needs only integer
+ * multiplications, so a fresh engine is essentially free to key and re-key.
+ */
+class icarus::ns::util::CounterBasedEngine: public CLHEP::HepRandomEngine {
+
+    public:
+
+  /// Constructor: keys the engine with a `seed` and a `purpose` tag.
+  CounterBasedEngine(long seed, std::uint32_t purpose);
+
+  /// Positions the stream at the first draw for the specified object;
+  /// each `(event, channel)` pair owns an independent stream.
+  void setEventChannel(std::uint32_t event, std::uint32_t channel);
+
+
+  // --- BEGIN -- CLHEP engine interface ---------------------------------------
+
+  /// Returns a uniform deviate in `(0, 1)`.
+  virtual double flat() override;
+
+  /// Fills `vect` with `size` uniform deviates in `(0, 1)`.
+  virtual void flatArray(const int size, double* vect) override;
+
+  /// Re-keys the engine with a new seed (the purpose tag is retained).
+  virtual void setSeed(long seed, int) override;
+
+  /// Re-keys the engine with the first of `seeds`.
+  virtual void setSeeds(const long* seeds, int) override;
+
+  /// Writes key and stream position to `filename`.
+  virtual void saveStatus(const char filename[] = "Config.conf") const override;
+
+  /// Restores key and stream position from `filename`.
+  virtual void restoreStatus(const char filename[] = "Config.conf") override;
+
+  /// Prints key and stream position on screen.
+  virtual void showStatus() const override;
+
+  /// Returns the name of this engine type.
+  virtual std::string name() const override { return "CounterBasedEngine"; }
+
+  // --- END ---- CLHEP engine interface ---------------------------------------
+
+
+    private:
+
+  std::uint32_t fKey[2U]; ///< Generator key: seed and purpose.
+  std::uint32_t fPurpose; ///< Purpose tag, preserved across `setSeed()`.
+  std::uint32_t fEvent = 0U; ///< Event word of the counter.
+  std::uint32_t fChannel = 0U; ///< Channel word of the counter.
+  std::uint64_t fDrawIndex = 0U; ///< Index of the next 4-word block.
+
+  std::uint32_t fBuffer[4U]; ///< Words from the last generated block.
+  unsigned int fBufferPos = 4U; ///< Words of the buffer already consumed.
+
+  /// Returns the next 32-bit word of the stream.
+  std::uint32_t next32();
+
+  /// Computes the Philox-4x32-10 block for counter `ctr` under key `key`.
+  static void philox4x32
+    (std::uint32_t const key[2U], std::uint32_t const ctr[4U],
+     std::uint32_t out[4U]);
+
+}; // class icarus::ns::util::CounterBasedEngine
+
+
+// -----------------------------------------------------------------------------
+// --- inline implementation
+// -----------------------------------------------------------------------------
+inline icarus::ns::util::CounterBasedEngine::CounterBasedEngine
+  (long seed, std::uint32_t purpose)
+  : fPurpose(purpose)
+{
+  setSeed(seed, 0);
+} // icarus::ns::util::CounterBasedEngine::CounterBasedEngine()
+
+
+// -----------------------------------------------------------------------------
+inline void icarus::ns::util::CounterBasedEngine::setEventChannel
+  (std::uint32_t event, std::uint32_t channel)
+{
+  fEvent = event;
+  fChannel = channel;
+  fDrawIndex = 0U;
+  fBufferPos = 4U; // discard any buffered words of the previous stream
+} // icarus::ns::util::CounterBasedEngine::setEventChannel()
+
+
+// -----------------------------------------------------------------------------
+inline void icarus::ns::util::CounterBasedEngine::philox4x32
+  (std::uint32_t const key[2U], std::uint32_t const ctr[4U],
+   std::uint32_t out[4U])
+{
+  constexpr std::uint64_t MultA = 0xD2511F53ULL;
+  constexpr std::uint64_t MultB = 0xCD9E8D57ULL;
+  constexpr std::uint32_t BumpA = 0x9E3779B9U; // golden ratio
+  constexpr std::uint32_t BumpB = 0xBB67AE85U; // sqrt(3) - 1
+
+  std::uint32_t k0 = key[0U], k1 = key[1U];
+  std::uint32_t c0 = ctr[0U], c1 = ctr[1U], c2 = ctr[2U], c3 = ctr[3U];
+
+  for (unsigned int round = 0U; round < 10U; ++round) {
+    std::uint64_t const prodA = MultA * c0;
+    std::uint64_t const prodB = MultB * c2;
+    std::uint32_t const hiA = static_cast<std::uint32_t>(prodA >> 32U);
+    std::uint32_t const loA = static_cast<std::uint32_t>(prodA);
+    std::uint32_t const hiB = static_cast<std::uint32_t>(prodB >> 32U);
+    std::uint32_t const loB = static_cast<std::uint32_t>(prodB);
+
+    c0 = hiB ^ c1 ^ k0;
+    c1 = loB;
+    c2 = hiA ^ c3 ^ k1;
+    c3 = loA;
+
+    k0 += BumpA;
+    k1 += BumpB;
+  } // for rounds
+
+  out[0U] = c0; out[1U] = c1; out[2U] = c2; out[3U] = c3;
+} // icarus::ns::util::CounterBasedEngine::philox4x32()
+
+
+// -----------------------------------------------------------------------------
+inline std::uint32_t icarus::ns::util::CounterBasedEngine::next32() {
+  if (fBufferPos >= 4U) {
+    std::uint32_t const ctr[4U] = {
+      static_cast<std::uint32_t>(fDrawIndex),
+      static_cast<std::uint32_t>(fDrawIndex >> 32U),
+      fChannel,
+      fEvent
+      };
+    philox4x32(fKey, ctr, fBuffer);
+    ++fDrawIndex;
+    fBufferPos = 0U;
+  }
+  return fBuffer[fBufferPos++];
+} // icarus::ns::util::CounterBasedEngine::next32()
+
+
+// -----------------------------------------------------------------------------
+inline double icarus::ns::util::CounterBasedEngine::flat() {
+  std::uint64_t const word
+    = (static_cast<std::uint64_t>(next32()) << 32U) | next32();
+  // 53 significant bits, offset by half a step to stay inside (0, 1)
+  return (static_cast<double>(word >> 11U) + 0.5) * 0x1.0p-53;
+} // icarus::ns::util::CounterBasedEngine::flat()
+
+
+// -----------------------------------------------------------------------------
+inline void icarus::ns::util::CounterBasedEngine::flatArray
+  (const int size, double* vect)
+{
+  for (int i = 0; i < size; ++i) vect[i] = flat();
+} // icarus::ns::util::CounterBasedEngine::flatArray()
+
+
+// -----------------------------------------------------------------------------
+inline void icarus::ns::util::CounterBasedEngine::setSeed(long seed, int) {
+  theSeed = seed;
+  auto const useed = static_cast<std::uint64_t>(seed);
+  fKey[0U] = static_cast<std::uint32_t>(useed)
+    ^ static_cast<std::uint32_t>(useed >> 32U);
+  fKey[1U] = fPurpose;
+  fDrawIndex = 0U;
+  fBufferPos = 4U;
+} // icarus::ns::util::CounterBasedEngine::setSeed()
+
+
+// -----------------------------------------------------------------------------
+inline void icarus::ns::util::CounterBasedEngine::setSeeds
+  (const long* seeds, int)
+{
+  setSeed(seeds[0U], 0);
+} // icarus::ns::util::CounterBasedEngine::setSeeds()
+
+
+// -----------------------------------------------------------------------------
+inline void icarus::ns::util::CounterBasedEngine::saveStatus
+  (const char filename[]) const
+{
+  std::ofstream out { filename };
+  if (!out) return;
+  out << theSeed << " " << fPurpose << " " << fEvent << " " << fChannel
+    << " " << fDrawIndex << " " << fBufferPos << "\n";
+} // icarus::ns::util::CounterBasedEngine::saveStatus()
+
+
+// -----------------------------------------------------------------------------
+inline void icarus::ns::util::CounterBasedEngine::restoreStatus
+  (const char filename[])
+{
+  std::ifstream in { filename };
+  if (!in) return;
+  long seed;
+  std::uint32_t purpose, event, channel;
+  std::uint64_t drawIndex;
+  unsigned int bufferPos;
+  if (!(in >> seed >> purpose >> event >> channel >> drawIndex >> bufferPos))
+    return;
+  fPurpose = purpose;
+  setSeed(seed, 0);
+  setEventChannel(event, channel);
+  // reposition within the stream, regenerating the partially consumed block
+  fDrawIndex = drawIndex;
+  fBufferPos = 4U;
+  if (bufferPos < 4U) {
+    --fDrawIndex;
+    next32(); // refills the buffer and restores fDrawIndex
+    fBufferPos = bufferPos;
+  }
+} // icarus::ns::util::CounterBasedEngine::restoreStatus()
+
+
+// -----------------------------------------------------------------------------
+inline void icarus::ns::util::CounterBasedEngine::showStatus() const {
+  std::cout << "CounterBasedEngine: seed " << theSeed << " purpose " << fPurpose
+    << " at event " << fEvent << " channel " << fChannel
+    << " draw " << fDrawIndex << std::endl;
+} // icarus::ns::util::CounterBasedEngine::showStatus()
+
+
+// -----------------------------------------------------------------------------
+
+
+#endif // ICARUSCODE_UTILITIES_COUNTERBASEDENGINE_H
@@ -83,13 +83,14 @@ auto sbn::EventRegistry::eventRecord(art::EventID const& event) const
   -> std::optional<EventRecord_t>
 {
   
-  auto const lg = lockEventRegistry();
+  EventRegistryShard_t const& shard = eventShard(event);
+  auto const lg = std::lock_guard{ shard.lock };
   // BEGIN needs lock
-  auto const iRecord = fEventRegistry.find(event);
-  return (iRecord != fEventRegistry.end())
+  auto const iRecord = shard.events.find(event);
+  return (iRecord != shard.events.end())
     ? std::optional{ iRecord->second }: std::nullopt;
   // END needs lock
-  
+
 } // sbn::EventRegistry::eventRecord()
 
 
@@ -97,13 +98,14 @@ auto sbn::EventRegistry::eventRecord(art::EventID const& event) const
 auto sbn::EventRegistry::recordEvent
   (EventID_t const& event, FileID_t sourceFileID) -> EventRecord_t
 {
-  auto const lg = lockEventRegistry();
+  EventRegistryShard_t& shard = eventShard(event);
+  auto const lg = std::lock_guard{ shard.lock };
   // BEGIN needs lock
-  auto& record = fEventRegistry[event];
+  auto& record = shard.events[event];
   record.sourceFiles.push_back(sourceFileID);
   return record;
   // END needs lock
-  
+
 } // sbn::EventRegistry::recordEvent()
 
 
@@ -121,19 +123,32 @@ auto sbn::EventRegistry::findSource(std::string const& fileName) const
 void sbn::EventRegistry::copyEventRecordsInto
   (std::vector<EventIDandRecord_t>& recordCopy) const
 {
-  recordCopy.reserve(fEventRegistry.size()); // bet size does not change
-  auto const lg = lockEventRegistry();
-  // BEGIN needs lock
-  recordCopy.reserve(fEventRegistry.size()); // has size() changed already?
-  std::copy(fEventRegistry.cbegin(), fEventRegistry.cend(),
-    std::back_inserter(recordCopy));
-  // END needs lock
+  // consolidation: one shard at a time, never holding more than one lock;
+  // the result is a snapshot only if no registration is concurrently going on
+  std::size_t totalEvents = 0U;
+  for (EventRegistryShard_t const& shard: fEventRegistry) {
+    auto const lg = std::lock_guard{ shard.lock };
+    totalEvents += shard.events.size();
+  } // for (sizes)
+  recordCopy.reserve(totalEvents); // bet sizes do not change
+  for (EventRegistryShard_t const& shard: fEventRegistry) {
+    auto const lg = std::lock_guard{ shard.lock };
+    // BEGIN needs lock
+    std::copy(shard.events.cbegin(), shard.events.cend(),
+      std::back_inserter(recordCopy));
+    // END needs lock
+  } // for (copy)
 } // sbn::EventRegistry::records()
 
 
 // -----------------------------------------------------------------------------
-std::lock_guard<std::mutex> sbn::EventRegistry::lockEventRegistry() const
-  { return std::lock_guard{ fEventRegistryLock }; }
+auto sbn::EventRegistry::eventShard(EventID_t const& event)
+  -> EventRegistryShard_t&
+  { return fEventRegistry[std::hash<EventID_t>{}(event) % NShards]; }
+
+auto sbn::EventRegistry::eventShard(EventID_t const& event) const
+  -> EventRegistryShard_t const&
+  { return fEventRegistry[std::hash<EventID_t>{}(event) % NShards]; }
 
 
 // -----------------------------------------------------------------------------
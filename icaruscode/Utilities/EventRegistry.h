@@ -20,6 +20,7 @@
 
 // C/C++ standard libraries
 #include <unordered_map>
+#include <array>
 #include <vector>
 #include <mutex>
 #include <utility> // std::pair<>
@@ -67,6 +68,9 @@ namespace sbn { class EventRegistry; }
  * --------------
  * 
  * Registration of events can happen concurrently (thread-safe).
+ * The event records are split ("sharded") by a hash of the event ID into a
+ * fixed number of independently locked registries, so that concurrent
+ * registrations of different events usually do not contend on the same lock.
  * Registration of source files, instead, is not protected.
  * 
  * It is guaranteed that the source file records are never modified once
@@ -172,27 +176,40 @@ class sbn::EventRegistry {
   
   /// Type for source file registry.
   using FileRegistry_t = std::vector<std::string>;
-  
+
+  /// Number of independently locked event registry shards.
+  static constexpr std::size_t NShards = 16U;
+
+  /// A slice of the event registry, with its own lock.
+  struct EventRegistryShard_t {
+
+    std::unordered_map<EventID_t, EventRecord_t> events; ///< Event records.
+
+    mutable std::mutex lock; ///< Lock for `events`.
+
+  }; // EventRegistryShard_t
+
   /// Registered source file, by file ID key.
   std::vector<std::string> fSourceFiles;
-  
-  /// Registry of all events.
-  std::unordered_map<EventID_t, EventRecord_t> fEventRegistry;
-  
-  mutable std::mutex fEventRegistryLock; ///< Lock for `fEventRegistry`.
-  
+
+  /// Registry of all events, sharded by hash of the event ID.
+  std::array<EventRegistryShard_t, NShards> fEventRegistry;
+
   //@{
   /// Returns an iterator pointing to the specified file registry entry.
   FileRegistry_t::iterator findSource(std::string const& fileName);
   FileRegistry_t::const_iterator findSource(std::string const& fileName) const;
   //@}
   
-  /// Copies all event records into `recordCopy`.
+  /// Copies all event records, from all the shards, into `recordCopy`.
   void copyEventRecordsInto(std::vector<EventIDandRecord_t>& recordCopy) const;
 
-  /// Returns a lock guard around `fEventRegistry`.
-  std::lock_guard<std::mutex> lockEventRegistry() const;
-  
+  //@{
+  /// Returns the registry shard holding the record of the specified `event`.
+  EventRegistryShard_t& eventShard(EventID_t const& event);
+  EventRegistryShard_t const& eventShard(EventID_t const& event) const;
+  //@}
+
   
   /// Converts an internal index in file source registry into a `FileID_t`.
   static FileID_t indexToFileID(std::size_t index);
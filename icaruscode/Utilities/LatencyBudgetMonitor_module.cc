@@ -0,0 +1,223 @@
+/**
+ * @file   icaruscode/Utilities/LatencyBudgetMonitor_module.cc
+ * @brief  Monitors the keep-up latency budget from the stage latency stamps.
+ * @see    icaruscode/Decode/DataProducts/LatencyStamp.h
+ *
+ * The keep-up stream (decode, hit finding, CRT matching...) operates under a
+ * hard end-to-end latency budget. Each participating module puts a
+ * `icarus::LatencyStamp` when it finishes an event; this analyzer reads the
+ * stamps in the configured pipeline order, histograms the latency of each
+ * stage (time from the previous stamp) and of the whole chain (time from the
+ * first stamp to the last), and emits an error-level alarm on the events
+ * exceeding the budget.
+ */
+
+// ICARUS libraries
+#include "icaruscode/Decode/DataProducts/LatencyStamp.h"
+
+// framework libraries
+#include "art/Framework/Core/EDAnalyzer.h"
+#include "art/Framework/Core/ModuleMacros.h"
+#include "art/Framework/Principal/Event.h"
+#include "art/Framework/Principal/Handle.h"
+#include "art/Framework/Services/Registry/ServiceHandle.h"
+#include "art_root_io/TFileService.h"
+#include "canvas/Utilities/InputTag.h"
+#include "messagefacility/MessageLogger/MessageLogger.h"
+#include "fhiclcpp/types/Atom.h"
+#include "fhiclcpp/types/Sequence.h"
+
+// ROOT libraries
+#include "TH1F.h"
+
+// C/C++ standard libraries
+#include <string>
+#include <vector>
+
+
+// -----------------------------------------------------------------------------
+namespace icarus { class LatencyBudgetMonitor; }
+
+/**
+ * @brief Histograms the per-stage keep-up latencies and alarms on violations.
+ *
+ * Configuration parameters
+ * -------------------------
+ *
+ * * `StampLabels` (list of input tags): the latency stamps of the chain, in
+ *     pipeline order; the first one is the reference (typically the decoder);
+ * * `BudgetMs` (real): end-to-end latency budget, in milliseconds;
+ * * `HistoMaxMs` (real, default: four times the budget): upper edge of the
+ *     latency histograms;
+ * * `LogCategory` (string, default: `LatencyBudgetMonitor`): name of the
+ *     message stream.
+ */
+class icarus::LatencyBudgetMonitor: public art::EDAnalyzer {
+
+    public:
+
+  struct Config {
+
+    using Name = fhicl::Name;
+    using Comment = fhicl::Comment;
+
+    fhicl::Sequence<art::InputTag> StampLabels {
+      Name("StampLabels"),
+      Comment("latency stamps of the chain, in pipeline order")
+      };
+
+    fhicl::Atom<double> BudgetMs {
+      Name("BudgetMs"),
+      Comment("end-to-end latency budget [ms]")
+      };
+
+    fhicl::Atom<double> HistoMaxMs {
+      Name("HistoMaxMs"),
+      Comment("upper edge of the latency histograms [ms] (default: 4 x budget)"),
+      0.0
+      };
+
+    fhicl::Atom<std::string> LogCategory {
+      Name("LogCategory"),
+      Comment("name of the category used for the output"),
+      "LatencyBudgetMonitor"
+      };
+
+  }; // struct Config
+
+  using Parameters = art::EDAnalyzer::Table<Config>;
+
+  explicit LatencyBudgetMonitor(Parameters const& config);
+
+  virtual void beginJob() override;
+  virtual void analyze(art::Event const& event) override;
+  virtual void endJob() override;
+
+    private:
+
+  // --- BEGIN -- Configuration ------------------------------------------------
+
+  /// Stamps of the chain, in pipeline order.
+  std::vector<art::InputTag> const fStampLabels;
+
+  double const fBudgetMs; ///< End-to-end latency budget [ms]
+
+  double const fHistoMaxMs; ///< Upper edge of the latency histograms [ms]
+
+  std::string const fLogCategory; ///< Category for messages.
+
+  // --- END -- Configuration --------------------------------------------------
+
+  /// Per-stage latency histograms, parallel to `fStampLabels` (first one is
+  /// left null: the first stamp is the reference).
+  std::vector<TH1F*> fStageHistograms;
+
+  TH1F* fTotalHistogram = nullptr; ///< End-to-end latency histogram.
+
+  unsigned int fNumEvents = 0U;     ///< Number of events seen.
+  unsigned int fNumViolations = 0U; ///< Number of events over budget.
+
+}; // class icarus::LatencyBudgetMonitor
+
+
+// -----------------------------------------------------------------------------
+icarus::LatencyBudgetMonitor::LatencyBudgetMonitor(Parameters const& config)
+  : art::EDAnalyzer(config)
+  , fStampLabels(config().StampLabels())
+  , fBudgetMs(config().BudgetMs())
+  , fHistoMaxMs
+    (config().HistoMaxMs() > 0.0? config().HistoMaxMs(): 4.0 * fBudgetMs)
+  , fLogCategory(config().LogCategory())
+{
+  for (art::InputTag const& label: fStampLabels)
+    consumes<icarus::LatencyStamp>(label);
+} // icarus::LatencyBudgetMonitor::LatencyBudgetMonitor()
+
+
+// -----------------------------------------------------------------------------
+void icarus::LatencyBudgetMonitor::beginJob() {
+
+  art::ServiceHandle<art::TFileService> tfs;
+
+  fStageHistograms.resize(fStampLabels.size(), nullptr);
+
+  // the first stamp is the time reference: stage histograms start at the
+  // second one and measure the time from the previous stamp
+  for (std::size_t iStage = 1U; iStage < fStampLabels.size(); ++iStage) {
+    std::string const name = "latency_" + fStampLabels[iStage].label();
+    std::string const title
+      = fStampLabels[iStage].encode() + " latency;latency  [ ms ];events";
+    fStageHistograms[iStage]
+      = tfs->make<TH1F>(name.c_str(), title.c_str(), 200, 0.0, fHistoMaxMs);
+  } // for
+
+  fTotalHistogram = tfs->make<TH1F>(
+    "latency_total", "end-to-end latency;latency  [ ms ];events",
+    200, 0.0, fHistoMaxMs
+    );
+
+} // icarus::LatencyBudgetMonitor::beginJob()
+
+
+// -----------------------------------------------------------------------------
+void icarus::LatencyBudgetMonitor::analyze(art::Event const& event) {
+
+  ++fNumEvents;
+
+  std::uint64_t referenceTime = 0U;
+  std::uint64_t previousTime = 0U;
+
+  for (std::size_t iStage = 0U; iStage < fStampLabels.size(); ++iStage) {
+
+    art::Handle<icarus::LatencyStamp> stampHandle;
+    event.getByLabel(fStampLabels[iStage], stampHandle);
+
+    if (!stampHandle.isValid() || !stampHandle->isValid()) {
+      mf::LogDebug(fLogCategory)
+        << "No latency stamp from '" << fStampLabels[iStage].encode()
+        << "' in " << event.id() << "; skipping the event.";
+      return;
+    }
+
+    std::uint64_t const time = stampHandle->time;
+
+    if (iStage == 0U) referenceTime = time;
+    else if (fStageHistograms[iStage] && time >= previousTime)
+      fStageHistograms[iStage]->Fill((time - previousTime) / 1.0e6);
+
+    previousTime = time;
+
+  } // for stages
+
+  if (previousTime < referenceTime) return; // unsynchronized clocks?
+
+  double const totalMs = (previousTime - referenceTime) / 1.0e6;
+
+  fTotalHistogram->Fill(totalMs);
+
+  if (totalMs > fBudgetMs) {
+    ++fNumViolations;
+    mf::LogError(fLogCategory)
+      << "Latency budget violation on " << event.id() << ": " << totalMs
+      << " ms from '" << fStampLabels.front().encode() << "' to '"
+      << fStampLabels.back().encode() << "' (budget: " << fBudgetMs << " ms).";
+  }
+
+} // icarus::LatencyBudgetMonitor::analyze()
+
+
+// -----------------------------------------------------------------------------
+void icarus::LatencyBudgetMonitor::endJob() {
+
+  mf::LogInfo(fLogCategory)
+    << "LatencyBudgetMonitor: " << fNumViolations << "/" << fNumEvents
+    << " events exceeded the " << fBudgetMs << " ms latency budget.";
+
+} // icarus::LatencyBudgetMonitor::endJob()
+
+
+// -----------------------------------------------------------------------------
+DEFINE_ART_MODULE(icarus::LatencyBudgetMonitor)
+
+
+// -----------------------------------------------------------------------------
@@ -0,0 +1,142 @@
+/**
+ * @file   icaruscode/Utilities/ProductSizeAdvisor.h
+ * @brief  Service recommending data product vector reservations.
+ * @see    icaruscode/Utilities/ProductSizeAdvisor_service.cc
+ *
+ * Producers that assemble large collections (most notably the raw data
+ * decoders) grow their output vectors from empty at every event, and the
+ * resulting reallocation cascade both copies several megabytes per event and
+ * fragments the heap. This service keeps a rolling window of the final sizes
+ * each client reports, keyed by an arbitrary string (conventionally
+ * `"<module>/<product>"`), and recommends a reservation slightly above a high
+ * percentile of that window.
+ *
+ * Typical usage in a producer:
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * auto& advisor = *art::ServiceHandle<icarus::ns::util::ProductSizeAdvisor>();
+ *
+ * auto digits = std::make_unique<std::vector<raw::RawDigit>>();
+ * digits->reserve(advisor.recommendedCapacity("TPCDecoder/RawDigit"));
+ *
+ * // ... fill ...
+ *
+ * advisor.reportSize("TPCDecoder/RawDigit", digits->size());
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * Because the recommendation follows a rolling window, a run of small events
+ * after a few huge ones automatically lowers the advice: clients that
+ * allocate a fresh vector per event (the pattern above) shed the excess
+ * capacity with no explicit shrink step.
+ *
+ * The service is thread safe and may be called concurrently from replicated
+ * module instances; all clients sharing a key also share its statistics.
+ */
+
+#ifndef ICARUSCODE_UTILITIES_PRODUCTSIZEADVISOR_H
+#define ICARUSCODE_UTILITIES_PRODUCTSIZEADVISOR_H
+
+
+// framework libraries
+#include "art/Framework/Services/Registry/ServiceDeclarationMacros.h"
+#include "art/Framework/Services/Registry/ServiceTable.h"
+#include "fhiclcpp/types/Atom.h"
+
+// C/C++ standard libraries
+#include <cstddef> // std::size_t
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+
+// -----------------------------------------------------------------------------
+namespace art { class ActivityRegistry; }
+namespace icarus::ns::util { class ProductSizeAdvisor; }
+
+/**
+ * @brief Tracks reported data product sizes and recommends reservations.
+ *
+ * Configuration parameters
+ * -------------------------
+ *
+ * * `WindowSize` (integral, default: `32`): how many of the most recent
+ *     reported sizes per key enter the statistics;
+ * * `Percentile` (real, default: `0.9`): the recommendation is based on this
+ *     percentile of the window (`1.0` tracks the maximum);
+ * * `Headroom` (real, default: `1.1`): the percentile is inflated by this
+ *     factor before being returned, so that a typical event fits without a
+ *     final reallocation.
+ */
+class icarus::ns::util::ProductSizeAdvisor {
+
+    public:
+
+  struct Config {
+
+    fhicl::Atom<unsigned int> WindowSize {
+      fhicl::Name("WindowSize"),
+      fhicl::Comment("number of most recent size reports kept per key"),
+      32U
+      };
+
+    fhicl::Atom<double> Percentile {
+      fhicl::Name("Percentile"),
+      fhicl::Comment("percentile of the size window used for the advice"),
+      0.9
+      };
+
+    fhicl::Atom<double> Headroom {
+      fhicl::Name("Headroom"),
+      fhicl::Comment("inflation factor applied to the advised size"),
+      1.1
+      };
+
+  }; // struct Config
+
+  using Parameters = art::ServiceTable<Config>;
+
+
+  /// Constructor: reads the configuration.
+  ProductSizeAdvisor(Parameters const& config, art::ActivityRegistry&);
+
+  // --- BEGIN -- Queries and registration -------------------------------------
+
+  /**
+   * @brief Returns the recommended reservation for the product at `key`.
+   * @return the advised capacity, `0` if no size was ever reported for `key`
+   *
+   * A return value of `0` is a valid `reserve()` argument (a no-op): clients
+   * do not need to treat the first event specially.
+   */
+  std::size_t recommendedCapacity(std::string const& key) const;
+
+  /// Records the final size of the product at `key` for the current event.
+  void reportSize(std::string const& key, std::size_t size);
+
+  // --- END -- Queries and registration ---------------------------------------
+
+
+    private:
+
+  /// Rolling window of the most recent reported sizes for one key.
+  struct SizeHistory_t {
+    std::vector<std::size_t> sizes; ///< Ring buffer of reported sizes.
+    std::size_t next = 0U;          ///< Index of the next slot to overwrite.
+  }; // struct SizeHistory_t
+
+  unsigned int const fWindowSize; ///< Depth of each rolling window.
+  double const fPercentile;       ///< Percentile driving the advice.
+  double const fHeadroom;         ///< Inflation factor on the advice.
+
+  /// Statistics per key; protected by `fMutex`.
+  std::unordered_map<std::string, SizeHistory_t> fHistories;
+
+  mutable std::mutex fMutex; ///< Protection of `fHistories` for concurrency.
+
+}; // class icarus::ns::util::ProductSizeAdvisor
+
+
+DECLARE_ART_SERVICE(icarus::ns::util::ProductSizeAdvisor, SHARED)
+
+
+#endif // ICARUSCODE_UTILITIES_PRODUCTSIZEADVISOR_H
@@ -0,0 +1,75 @@
+/**
+ * @file   icaruscode/Utilities/ProductSizeAdvisor_service.cc
+ * @brief  Service recommending data product vector reservations.
+ * @see    icaruscode/Utilities/ProductSizeAdvisor.h
+ */
+
+// library header
+#include "icaruscode/Utilities/ProductSizeAdvisor.h"
+
+// framework libraries
+#include "art/Framework/Services/Registry/ServiceDefinitionMacros.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::nth_element()
+#include <cmath> // std::ceil()
+
+
+// -----------------------------------------------------------------------------
+icarus::ns::util::ProductSizeAdvisor::ProductSizeAdvisor
+  (Parameters const& config, art::ActivityRegistry&)
+  : fWindowSize(std::max(config().WindowSize(), 1U))
+  , fPercentile(std::clamp(config().Percentile(), 0.0, 1.0))
+  , fHeadroom(std::max(config().Headroom(), 1.0))
+{}
+
+
+// -----------------------------------------------------------------------------
+std::size_t icarus::ns::util::ProductSizeAdvisor::recommendedCapacity
+  (std::string const& key) const
+{
+
+  std::vector<std::size_t> sizes; // local copy: keep the lock short
+  {
+    std::lock_guard lock { fMutex };
+    auto const itHistory = fHistories.find(key);
+    if (itHistory == fHistories.end()) return 0U;
+    sizes = itHistory->second.sizes;
+  }
+
+  // index of the requested percentile in the sorted window
+  std::size_t const iPerc = std::min(
+    static_cast<std::size_t>(fPercentile * sizes.size()),
+    sizes.size() - 1U
+    );
+  std::nth_element(sizes.begin(), sizes.begin() + iPerc, sizes.end());
+
+  return static_cast<std::size_t>(std::ceil(sizes[iPerc] * fHeadroom));
+
+} // icarus::ns::util::ProductSizeAdvisor::recommendedCapacity()
+
+
+// -----------------------------------------------------------------------------
+void icarus::ns::util::ProductSizeAdvisor::reportSize
+  (std::string const& key, std::size_t size)
+{
+
+  std::lock_guard lock { fMutex };
+
+  SizeHistory_t& history = fHistories[key];
+  if (history.sizes.size() < fWindowSize) { // window still filling up
+    history.sizes.push_back(size);
+  }
+  else { // overwrite the oldest entry
+    history.sizes[history.next] = size;
+    history.next = (history.next + 1U) % fWindowSize;
+  }
+
+} // icarus::ns::util::ProductSizeAdvisor::reportSize()
+
+
+// -----------------------------------------------------------------------------
+DEFINE_ART_SERVICE(icarus::ns::util::ProductSizeAdvisor)
+
+
+// -----------------------------------------------------------------------------
@@ -15,10 +15,53 @@
 #include "art_root_io/RootDB/SQLite3Wrapper.h"
 #include "fhiclcpp/ParameterSet.h"
 
+// C/C++ standard libraries
+#include <mutex>
+#include <string>
+
 
 // -----------------------------------------------------------------------------
-std::map<fhicl::ParameterSetID, fhicl::ParameterSet>
+namespace {
+
+  /// Actual read of the configuration database of `file` (no caching).
+  std::map<fhicl::ParameterSetID, fhicl::ParameterSet>
+    readConfigurationFromArtFileUncached(TFile& file);
+
+} // local namespace
+
+
+// -----------------------------------------------------------------------------
+std::map<fhicl::ParameterSetID, fhicl::ParameterSet> const&
 util::readConfigurationFromArtFile(TFile& file)
+{
+  /*
+   * Memoization of the uncached read below, keyed by the UUID that ROOT
+   * assigns to each file on creation. Each input file is read and parsed
+   * only once per job, no matter how many run boundaries it contains.
+   * The cache is never pruned: one configuration set per input file is
+   * cheap compared to the file itself, and returned references are
+   * guaranteed to stay valid. Node-based `std::map` storage keeps them
+   * valid also across later insertions.
+   */
+  static std::mutex cacheMutex;
+  static std::map<std::string, std::map<fhicl::ParameterSetID, fhicl::ParameterSet>>
+    cache;
+
+  std::string key = file.GetUUID().AsString();
+  if (key.empty()) key = file.GetName(); // pathologic file: fall back to name
+
+  std::lock_guard lock { cacheMutex };
+  auto const [ it, bNew ] = cache.try_emplace(key);
+  if (bNew) it->second = readConfigurationFromArtFileUncached(file);
+  return it->second;
+} // util::readConfigurationFromArtFile()
+
+
+// -----------------------------------------------------------------------------
+namespace {
+
+std::map<fhicl::ParameterSetID, fhicl::ParameterSet>
+readConfigurationFromArtFileUncached(TFile& file)
 {
   /*
    * This code is ripped from `fhiclcpp/ParameterSetRegistry.h` and
@@ -70,7 +113,9 @@ util::readConfigurationFromArtFile(TFile& file)
   throwOnSQLiteNotOK("[SELECT ID, PSetBlob from ParameterSets;]");
   
   return config;
-} // util::readConfigurationFromArtFile()
+} // readConfigurationFromArtFileUncached()
+
+} // local namespace
 
 
 // -----------------------------------------------------------------------------
@@ -36,14 +36,23 @@ namespace util {
    * @return the full configuration
    * @throw cet::exception (category: `"readConfigurationFromArtFile"`) on error
    * @see `readConfigurationFromArtPrincipal()`
-   * 
+   *
    * The configuration is expected to be stored by _art_ in the way it does
    * for _art_ ROOT files.
-   * 
+   *
    * The configuration is returned as a map of parameter set ID to parameter
    * set.
+   *
+   * The result of parsing each input file is memoized: the configuration
+   * database of a file is read and parsed only the first time this function
+   * is called on it, and the cached result (keyed by the unique identifier
+   * ROOT assigns to the file) is returned on all the following calls.
+   * This matters for input files concatenated out of many runs, where callers
+   * tend to ask for the same configuration at each run boundary.
+   * The returned reference stays valid for the rest of the job.
+   * This function is thread-safe.
    */
-  std::map<fhicl::ParameterSetID, fhicl::ParameterSet>
+  std::map<fhicl::ParameterSetID, fhicl::ParameterSet> const&
     readConfigurationFromArtFile(TFile& file);
   
   
@@ -0,0 +1,192 @@
+/**
+ * @file   icaruscode/Utilities/TimeProfiler.h
+ * @brief  Service collecting scoped timing probes into a trace file.
+ * @see    icaruscode/Utilities/TimeProfiler_service.cc
+ *
+ * Investigating where reconstruction time goes (hit finding, deconvolution,
+ * cluster building, CRT matching...) has so far required patching each module
+ * with ad hoc stopwatch code. This service centralizes that: a module opens a
+ * RAII probe around the section of interest and the service accumulates the
+ * intervals, thread by thread, until the end of the job, when it prints a
+ * per-label summary and optionally writes every interval to a JSON file in
+ * Chrome tracing format (loadable in `chrome://tracing`, Perfetto or
+ * flamegraph converters).
+ *
+ * Typical usage in a producer:
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * void MyProducer::produce(art::Event& event) {
+ *
+ *   auto& profiler = *art::ServiceHandle<icarus::ns::util::TimeProfiler>();
+ *
+ *   {
+ *     auto probe = profiler.probe("MyProducer:deconvolution");
+ *     // ... timed section ...
+ *   }
+ *
+ * }
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * The service ships disabled: unless `Enable` is set in its configuration,
+ * `probe()` returns an inert object and the cost of an instrumented section
+ * is one boolean test, so probes can be left in production code permanently.
+ *
+ * The service is thread safe; intervals recorded from different threads are
+ * kept apart in the trace so that replicated module instances show up as
+ * separate tracks.
+ */
+
+#ifndef ICARUSCODE_UTILITIES_TIMEPROFILER_H
+#define ICARUSCODE_UTILITIES_TIMEPROFILER_H
+
+
+// framework libraries
+#include "art/Framework/Services/Registry/ServiceDeclarationMacros.h"
+#include "art/Framework/Services/Registry/ServiceTable.h"
+#include "fhiclcpp/types/Atom.h"
+
+// C/C++ standard libraries
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+
+// -----------------------------------------------------------------------------
+namespace art { class ActivityRegistry; }
+namespace icarus::ns::util { class TimeProfiler; }
+
+/**
+ * @brief Accumulates scoped timing probes and exports them at end of job.
+ *
+ * Configuration parameters
+ * -------------------------
+ *
+ * * `Enable` (flag, default: `false`): whether probes record anything at all;
+ * * `OutputFile` (string, default: empty): path of the Chrome tracing JSON
+ *     file written at the end of the job; if empty, only the per-label
+ *     summary is printed.
+ */
+class icarus::ns::util::TimeProfiler {
+
+    public:
+
+  struct Config {
+
+    fhicl::Atom<bool> Enable {
+      fhicl::Name("Enable"),
+      fhicl::Comment("whether the probes record timing at all"),
+      false
+      };
+
+    fhicl::Atom<std::string> OutputFile {
+      fhicl::Name("OutputFile"),
+      fhicl::Comment
+        ("path of the Chrome tracing JSON file (empty: summary only)"),
+      ""
+      };
+
+  }; // struct Config
+
+  using Parameters = art::ServiceTable<Config>;
+
+  using Clock_t = std::chrono::steady_clock;
+
+
+  /**
+   * @brief RAII probe timing the scope it lives in.
+   *
+   * A default-constructed (or moved-from) probe is inert. The interval is
+   * reported to the service when the probe is destroyed.
+   */
+  class ScopedProbe {
+
+      public:
+
+    ScopedProbe() = default;
+
+    ScopedProbe(ScopedProbe const&) = delete;
+    ScopedProbe& operator= (ScopedProbe const&) = delete;
+
+    ScopedProbe(ScopedProbe&& from)
+      : fService(from.fService), fLabel(from.fLabel), fStart(from.fStart)
+      { from.fService = nullptr; }
+    ScopedProbe& operator= (ScopedProbe&& from)
+      {
+        std::swap(fService, from.fService);
+        std::swap(fLabel, from.fLabel);
+        std::swap(fStart, from.fStart);
+        return *this;
+      }
+
+    ~ScopedProbe()
+      { if (fService) fService->record(fLabel, fStart, Clock_t::now()); }
+
+      private:
+
+    friend class TimeProfiler;
+
+    ScopedProbe(TimeProfiler& service, char const* label)
+      : fService(&service), fLabel(label), fStart(Clock_t::now()) {}
+
+    TimeProfiler* fService = nullptr; ///< Destination; `nullptr` if inert.
+    char const* fLabel = nullptr;     ///< Label of the timed section.
+    Clock_t::time_point fStart;       ///< When the probe was opened.
+
+  }; // class ScopedProbe
+
+
+  /// Constructor: reads the configuration and hooks the end of the job.
+  TimeProfiler(Parameters const& config, art::ActivityRegistry& registry);
+
+  // --- BEGIN -- Probes -------------------------------------------------------
+
+  /**
+   * @brief Returns a probe timing its own lifetime under `label`.
+   *
+   * The label must stay valid until the end of the job: pass a string
+   * literal (conventionally `"<module>:<section>"`).
+   * If the service is disabled the returned probe is inert.
+   */
+  ScopedProbe probe(char const* label)
+    { return fEnabled? ScopedProbe{ *this, label }: ScopedProbe{}; }
+
+  /// Whether the probes are recording at all.
+  bool isEnabled() const { return fEnabled; }
+
+  // --- END -- Probes ---------------------------------------------------------
+
+
+    private:
+
+  /// One recorded interval.
+  struct Interval_t {
+    char const* label;           ///< Section label (string literal).
+    std::thread::id thread;      ///< Thread the interval was recorded on.
+    Clock_t::time_point start;   ///< Beginning of the interval.
+    Clock_t::duration duration;  ///< Length of the interval.
+  }; // struct Interval_t
+
+  /// Stores one completed interval (called by the probe destructor).
+  void record
+    (char const* label, Clock_t::time_point start, Clock_t::time_point stop);
+
+  /// Prints the per-label summary and writes the trace file if requested.
+  void exportTrace() const;
+
+  bool const fEnabled;           ///< Whether probes record anything.
+  std::string const fOutputFile; ///< Path of the trace file; empty: none.
+
+  Clock_t::time_point const fJobStart; ///< Origin of the trace timestamps.
+
+  std::vector<Interval_t> fIntervals; ///< All intervals; under `fMutex`.
+
+  mutable std::mutex fMutex; ///< Protection of `fIntervals` for concurrency.
+
+}; // class icarus::ns::util::TimeProfiler
+
+
+DECLARE_ART_SERVICE(icarus::ns::util::TimeProfiler, SHARED)
+
+
+#endif // ICARUSCODE_UTILITIES_TIMEPROFILER_H
@@ -0,0 +1,117 @@
+/**
+ * @file   icaruscode/Utilities/TimeProfiler_service.cc
+ * @brief  Service collecting scoped timing probes into a trace file.
+ * @see    icaruscode/Utilities/TimeProfiler.h
+ */
+
+// library header
+#include "icaruscode/Utilities/TimeProfiler.h"
+
+// framework libraries
+#include "art/Framework/Services/Registry/ActivityRegistry.h"
+#include "art/Framework/Services/Registry/ServiceDefinitionMacros.h"
+#include "messagefacility/MessageLogger/MessageLogger.h"
+
+// C/C++ standard libraries
+#include <fstream>
+#include <map>
+
+
+// -----------------------------------------------------------------------------
+icarus::ns::util::TimeProfiler::TimeProfiler
+  (Parameters const& config, art::ActivityRegistry& registry)
+  : fEnabled(config().Enable())
+  , fOutputFile(config().OutputFile())
+  , fJobStart(Clock_t::now())
+{
+
+  if (fEnabled)
+    registry.sPostEndJob.watch(this, &TimeProfiler::exportTrace);
+
+} // icarus::ns::util::TimeProfiler::TimeProfiler()
+
+
+// -----------------------------------------------------------------------------
+void icarus::ns::util::TimeProfiler::record
+  (char const* label, Clock_t::time_point start, Clock_t::time_point stop)
+{
+
+  std::lock_guard lock { fMutex };
+  fIntervals.push_back
+    ({ label, std::this_thread::get_id(), start, stop - start });
+
+} // icarus::ns::util::TimeProfiler::record()
+
+
+// -----------------------------------------------------------------------------
+void icarus::ns::util::TimeProfiler::exportTrace() const
+{
+
+  using std::chrono::duration_cast;
+  using std::chrono::microseconds;
+
+  std::lock_guard lock { fMutex };
+
+  // --- BEGIN -- per-label summary --------------------------------------------
+  struct LabelStats_t {
+    unsigned long count = 0U;
+    Clock_t::duration total {};
+  };
+  std::map<std::string, LabelStats_t> stats;
+  for (Interval_t const& interval: fIntervals) {
+    LabelStats_t& labelStats = stats[interval.label];
+    ++labelStats.count;
+    labelStats.total += interval.duration;
+  } // for intervals
+
+  mf::LogInfo log { "TimeProfiler" };
+  log << "timing of " << fIntervals.size() << " probed intervals in "
+    << stats.size() << " sections:";
+  for (auto const& [ label, labelStats ]: stats) {
+    log << "\n  '" << label << "': " << labelStats.count << " intervals, "
+      << (duration_cast<microseconds>(labelStats.total).count() / 1000.0)
+      << " ms total";
+  } // for labels
+  // --- END -- per-label summary ----------------------------------------------
+
+  if (fOutputFile.empty()) return;
+
+  // threads get consecutive small identifiers in order of appearance,
+  // which Chrome tracing shows as separate tracks
+  std::map<std::thread::id, unsigned int> threadIDs;
+
+  std::ofstream out { fOutputFile };
+  if (!out) {
+    mf::LogWarning("TimeProfiler")
+      << "could not write the trace file '" << fOutputFile << "'";
+    return;
+  }
+
+  out << "[";
+  bool first = true;
+  for (Interval_t const& interval: fIntervals) {
+    auto const [ itThread, _ ]
+      = threadIDs.try_emplace(interval.thread, threadIDs.size());
+    if (!first) out << ",";
+    first = false;
+    out << "\n{\"name\":\"" << interval.label
+      << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << itThread->second
+      << ",\"ts\":"
+      << duration_cast<microseconds>(interval.start - fJobStart).count()
+      << ",\"dur\":"
+      << duration_cast<microseconds>(interval.duration).count()
+      << "}";
+  } // for intervals
+  out << "\n]\n";
+
+  mf::LogInfo("TimeProfiler")
+    << "Chrome tracing profile written to '" << fOutputFile << "'";
+
+} // icarus::ns::util::TimeProfiler::exportTrace()
+
+
+// -----------------------------------------------------------------------------
+DEFINE_ART_SERVICE(icarus::ns::util::TimeProfiler)
+
+
+// -----------------------------------------------------------------------------
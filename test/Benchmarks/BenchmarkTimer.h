@@ -0,0 +1,71 @@
+/**
+ * @file   test/Benchmarks/BenchmarkTimer.h
+ * @brief  Minimal timing harness for the icaruscode micro-benchmarks.
+ *
+ * This is a deliberately small replacement for an external benchmark
+ * framework (none is available in the experiment software stack): it runs a
+ * callable repeatedly after a warm-up pass and reports the best and average
+ * time per iteration. The numbers are printed on standard output in a fixed
+ * `benchmark: <name>: ...` format so they can be grepped out of CI logs and
+ * compared across releases.
+ *
+ * This is a header-only library.
+ */
+
+#ifndef ICARUSCODE_TEST_BENCHMARKS_BENCHMARKTIMER_H
+#define ICARUSCODE_TEST_BENCHMARKS_BENCHMARKTIMER_H
+
+// C/C++ standard libraries
+#include <chrono>
+#include <iostream>
+#include <limits>
+#include <string>
+
+
+// -----------------------------------------------------------------------------
+namespace icarus::test {
+
+  /**
+   * @brief Runs `func` `iterations` times and prints per-iteration timing.
+   * @tparam Func type of callable to be benchmarked (no arguments)
+   * @param name benchmark name, reported on output
+   * @param iterations how many timed iterations to run
+   * @param func the callable to be benchmarked
+   * @return the best observed time per iteration, in seconds
+   *
+   * One untimed warm-up call is performed first to populate caches and touch
+   * the memory the kernel works on. The callable should return (or otherwise
+   * consume) its result so that the compiler can't discard the computation.
+   */
+  template <typename Func>
+  double benchmark
+    (std::string const& name, unsigned int iterations, Func func)
+  {
+    using clock_t = std::chrono::steady_clock;
+    using seconds_t = std::chrono::duration<double>;
+
+    func(); // warm-up, not timed
+
+    double best = std::numeric_limits<double>::max();
+    double total = 0.0;
+    for (unsigned int i = 0U; i < iterations; ++i) {
+      auto const start = clock_t::now();
+      func();
+      double const elapsed = seconds_t{ clock_t::now() - start }.count();
+      if (elapsed < best) best = elapsed;
+      total += elapsed;
+    } // for
+
+    std::cout << "benchmark: " << name
+      << ": best " << (best * 1.0e6) << " us"
+      << ", mean " << (total / iterations * 1.0e6) << " us"
+      << " (" << iterations << " iterations)"
+      << std::endl;
+
+    return best;
+  } // benchmark()
+
+} // namespace icarus::test
+
+
+#endif // ICARUSCODE_TEST_BENCHMARKS_BENCHMARKTIMER_H
@@ -0,0 +1,92 @@
+/**
+ * @file   test/Benchmarks/TriggerGateOperations_benchmark.cc
+ * @brief  Micro-benchmark for the gate combination kernels.
+ * @see    `icaruscode/PMT/Trigger/Utilities/TriggerGateOperations.h`
+ *
+ * Measures `sumGates()`, `maxGates()`, `minGates()` and `mulGates()` on a
+ * collection of gates resembling a full PMT readout: one gate per channel,
+ * each with a few tens of openings scattered over a beam-gate-sized window.
+ * The input is generated from a fixed seed so successive runs (and releases)
+ * measure the same workload.
+ *
+ * The test always succeeds: its purpose is the timing printout.
+ */
+
+// ICARUS libraries
+#include "icaruscode/PMT/Trigger/Utilities/TriggerGateOperations.h"
+
+// benchmark support
+#include "test/Benchmarks/BenchmarkTimer.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::sort()
+#include <random>
+#include <vector>
+
+
+// -----------------------------------------------------------------------------
+namespace {
+
+  using TriggerGate_t = icarus::trigger::OpticalTriggerGateData_t;
+
+  /// Creates `nGates` gates, each with `nOpenings` pulses in `[ 0, nTicks ]`.
+  std::vector<TriggerGate_t> makeGateCollection(
+    unsigned int nGates, unsigned int nOpenings, unsigned int nTicks,
+    unsigned int pulseWidth
+  ) {
+
+    std::mt19937 engine{ 20160107U }; // fixed seed: reproducible workload
+    std::uniform_int_distribution<int> startDist{ 0, int(nTicks) };
+
+    std::vector<TriggerGate_t> gates;
+    gates.reserve(nGates);
+    for (unsigned int iGate = 0U; iGate < nGates; ++iGate) {
+
+      std::vector<int> starts(nOpenings);
+      for (int& start: starts) start = startDist(engine);
+      std::sort(starts.begin(), starts.end());
+
+      TriggerGate_t gate;
+      gate.addChannel(iGate); // gate on channel number `iGate`
+      for (int const start: starts) {
+        gate.openAt(start);
+        gate.closeAt(start + int(pulseWidth));
+      }
+      gates.push_back(std::move(gate));
+
+    } // for gates
+
+    return gates;
+  } // makeGateCollection()
+
+} // local namespace
+
+
+// -----------------------------------------------------------------------------
+int main() {
+
+  // roughly one gate per PMT channel, a two-millisecond window of optical
+  // ticks and a discriminated pulse width of a couple hundred nanoseconds
+  constexpr unsigned int NGates = 360U;
+  constexpr unsigned int NOpenings = 40U;
+  constexpr unsigned int NTicks = 250'000U;
+  constexpr unsigned int PulseWidth = 40U;
+  constexpr unsigned int Iterations = 20U;
+
+  std::vector<TriggerGate_t> const gates
+    = makeGateCollection(NGates, NOpenings, NTicks, PulseWidth);
+
+  icarus::test::benchmark("sumGates", Iterations,
+    [&gates](){ return icarus::trigger::sumGates(gates); });
+
+  icarus::test::benchmark("maxGates", Iterations,
+    [&gates](){ return icarus::trigger::maxGates(gates); });
+
+  icarus::test::benchmark("minGates", Iterations,
+    [&gates](){ return icarus::trigger::minGates(gates); });
+
+  icarus::test::benchmark("mulGates", Iterations,
+    [&gates](){ return icarus::trigger::mulGates(gates); });
+
+  return 0;
+} // main()